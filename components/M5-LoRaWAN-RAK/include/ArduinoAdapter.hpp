@@ -5,6 +5,7 @@
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/queue.h"
 #include "driver/uart.h"
 #include "esp_log.h"
 #include "esp_timer.h"
@@ -155,6 +156,9 @@ private:
     int _tx_pin, _rx_pin;
     int _baud_rate;
     SemaphoreHandle_t _mutex;
+    QueueHandle_t _event_queue = nullptr;
+    int _event_queue_size = 0;
+    char _line_terminator = '\n';
 public:
     HardwareSerial(uart_port_t uart_num) : _uart_num(uart_num), _tx_pin(-1), _rx_pin(-1), _baud_rate(115200) {
         _mutex = xSemaphoreCreateMutex();
@@ -175,9 +179,44 @@ public:
             .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
             .source_clk = UART_SCLK_DEFAULT
         };
-        uart_driver_install(_uart_num, 1024, 0, 0, NULL, 0);
+        if (_event_queue_size > 0) {
+            uart_driver_install(_uart_num, 1024, 0, _event_queue_size, &_event_queue, 0);
+        } else {
+            uart_driver_install(_uart_num, 1024, 0, 0, NULL, 0);
+        }
         uart_param_config(_uart_num, &uart_config);
         uart_set_pin(_uart_num, _tx_pin, _rx_pin, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+        if (_event_queue_size > 0) {
+            // UART_PATTERN_DET event for every line terminator, no idle time around it
+            uart_enable_pattern_det_baud_intr(_uart_num, _line_terminator, 1, 9, 0, 0);
+            uart_pattern_queue_reset(_uart_num, _event_queue_size);
+        }
+    }
+
+    // Install the driver with an event queue on the next begin() instead of polling.
+    // The queue gets UART_DATA events and a UART_PATTERN_DET event for every terminator.
+    void enableLineEvents(char terminator = '\n', int queue_size = 20) {
+        _line_terminator = terminator;
+        _event_queue_size = queue_size;
+    }
+
+    // event queue of the driver, nullptr until begin() after enableLineEvents()
+    QueueHandle_t eventQueue() const {
+        return _event_queue;
+    }
+
+    // drop the positions of detected terminators, the received bytes are read with read()
+    void clearLineEvents() {
+        while (uart_pattern_pop_pos(_uart_num) != -1) {
+        }
+    }
+
+    // drop received data and pending events, e.g. after UART_FIFO_OVF
+    void flushInput() {
+        uart_flush_input(_uart_num);
+        if (_event_queue != nullptr) {
+            xQueueReset(_event_queue);
+        }
     }
 
     void println(const String& msg) {
@@ -186,6 +225,16 @@ public:
         uart_write_bytes(_uart_num, "\r\n", 2);
 
     }
+    // write the whole buffer in one driver call, the caller adds the line ending
+    size_t write(const uint8_t* buf, size_t size) {
+        int len = uart_write_bytes(_uart_num, buf, size);
+        return len < 0 ? 0 : (size_t)len;
+    }
+    // read up to size already received bytes without waiting
+    size_t read(char* buf, size_t size) {
+        int len = uart_read_bytes(_uart_num, (uint8_t*)buf, size, 0);
+        return len < 0 ? 0 : (size_t)len;
+    }
     String readString() {
         char buffer[128] = {0};
         uart_read_bytes(_uart_num, (uint8_t*)buffer, sizeof(buffer) - 1, 100 / portTICK_PERIOD_MS);
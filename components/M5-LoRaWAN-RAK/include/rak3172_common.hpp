@@ -8,6 +8,7 @@
 #define _RAK3172_COMMON_HPP_
 
 #include "ArduinoAdapter.hpp"
+#include "rak3172_parser.hpp"
 
 // #define RAK3172_DEBUGSerial  // This macro definition can be annotated without sending and receiving data prints
 //          Define the serial port you want to use, e.g., Serial1 or Serial2
@@ -19,6 +20,38 @@
 #else
 #endif
 
+/**
+ * @brief Size of the UART TX buffer that raw AT commands are formatted into.
+ *
+ * Fits the longest uplink: "AT+SEND=<port>:" with a three digit port, 500
+ * hexadecimal characters of payload and the "\r\n" line ending.
+ */
+#ifndef RAK3172_TX_BUFFER_SIZE
+#define RAK3172_TX_BUFFER_SIZE 520
+#endif
+
+/**
+ * @brief Size of the buffer collecting the data lines of a command response, e.g. "AT+VER=4.0.5".
+ */
+#define RAK3172_RX_BUFFER_SIZE 128
+
+/**
+ * @brief Longest wait for the OK / ERROR line of a command in milliseconds.
+ *
+ * A command completes as soon as its status line is parsed, the timeout only
+ * bounds a command the module does not answer.
+ */
+#ifndef RAK3172_COMMAND_TIMEOUT_MS
+#define RAK3172_COMMAND_TIMEOUT_MS 300
+#endif
+
+/**
+ * @brief Priority of the task reading UART events and dispatching the lines.
+ */
+#ifndef RAK3172_EVENT_TASK_PRIORITY
+#define RAK3172_EVENT_TASK_PRIORITY 5
+#endif
+
 typedef enum {
     RAK3172_BPS_115200 = 0, /**< Baud rate of 115200 bps */
     RAK3172_BPS_9600,       /**< Baud rate of 9600 bps */
@@ -84,6 +117,22 @@ String decodeMsg(String hexEncoded);
  */
 String bytes2hex(const uint8_t* buf, size_t size);
 
+/**
+ * @brief Converts a byte array to upper case hexadecimal characters in a caller provided buffer.
+ *
+ * Each byte is encoded with a lookup table into two characters, no terminating
+ * null character is written and nothing is allocated.
+ *
+ * @note
+ * - The output buffer must hold at least `size * 2` characters.
+ *
+ * @param buf Pointer to the byte array to be converted.
+ * @param size The number of bytes in the array.
+ * @param out Pointer to the output buffer.
+ * @return The number of characters written, `size * 2`.
+ */
+size_t bytes2hex(const uint8_t* buf, size_t size, char* out);
+
 /**
  * @brief Converts a hexadecimal string to a long integer.
  *
@@ -143,6 +192,50 @@ protected:
     int _tx_pin;
     int _rx_pin;
     SemaphoreHandle_t _serial_mutex;
+    char _tx_buffer[RAK3172_TX_BUFFER_SIZE]; /**< Raw AT commands are formatted here, guarded by `_serial_mutex` */
+
+    RAK3172LineParser _parser;                 /**< Splits the received bytes into lines, used by the event task only */
+    TaskHandle_t _event_task         = nullptr; /**< Task waiting on the UART event queue */
+    SemaphoreHandle_t _response_done = nullptr; /**< Given by the event task when the pending command completes */
+    volatile bool _response_pending  = false;   /**< A command waits for its OK / ERROR line */
+    volatile bool _response_ok       = false;   /**< The pending command got OK */
+    char _response[RAK3172_RX_BUFFER_SIZE];     /**< Data lines of the pending command separated by '\n' */
+    size_t _response_len = 0;
+
+    /**
+     * @brief Writes a raw command and waits for its status line, the caller holds `_serial_mutex`.
+     *
+     * @param cmd The command including the "\r\n" line ending.
+     * @param len The number of characters of the command.
+     * @return `true` if the whole command was written and the module answered "OK",
+     *         `false` otherwise.
+     */
+    bool sendCommandLocked(const char* cmd, size_t len);
+
+    /**
+     * @brief Prepares for the response of a command about to be written, the caller holds `_serial_mutex`.
+     */
+    void beginResponse();
+
+    /**
+     * @brief Waits until the event task parses the OK / ERROR line of the command or
+     *        `RAK3172_COMMAND_TIMEOUT_MS` elapses.
+     *
+     * @return `true` if the module answered "OK", `false` on ERROR or timeout.
+     */
+    bool waitResponse();
+
+    /**
+     * @brief Handles an unsolicited "+EVT:" line, called from the event task.
+     *
+     * @param line The null terminated line without the line ending.
+     * @param len The number of characters of the line.
+     */
+    virtual void handleEvent(const char*, size_t) {}
+
+private:
+    static void eventTask(void* arg);
+    static void onLine(void* ctx, rak3172_line_t type, const char* line, size_t len);
 
 public:
     /**
@@ -157,6 +250,10 @@ public:
      * - The function assumes that the serial interface is properly connected and
      *   that the RX and TX pins are correctly specified.
      * - The mutex is created and immediately released after initialization.
+     * - On the first call the UART driver is installed with an event queue and a
+     *   task is started that parses the received lines, completes the pending
+     *   command and dispatches "+EVT:" lines to `handleEvent`. Later calls only
+     *   send the "AT" command again.
      * - The function sends an "AT" command to test the connectivity with the RAK3172 module.
      *
      * @param serial A pointer to the `HardwareSerial` object to be used for communication.
@@ -173,22 +270,39 @@ public:
      * @brief Sends a command to the RAK3172 module and waits for a response.
      *
      * This function sends a specified command string to the RAK3172 module over
-     * the serial interface and reads the response. It uses a mutex to ensure
-     * thread-safe access to the serial communication. The function checks if the
-     * response contains "OK" to determine if the command was successful.
+     * the serial interface and waits for the response. It uses a mutex to ensure
+     * thread-safe access to the serial communication. The command completes as
+     * soon as the event task parses an "OK" or error line, at the latest after
+     * `RAK3172_COMMAND_TIMEOUT_MS`.
      *
      * @note
      * - The function assumes that the serial interface has been properly initialized
      *   before calling this function.
-     * - The mutex is acquired before sending the command and released after reading
-     *   the response.
+     * - The mutex is acquired before sending the command and released after the
+     *   response.
      *
      * @param cmd The command string to be sent to the RAK3172 module.
-     * @return `true` if the command was sent successfully and the response contains
+     * @return `true` if the command was sent successfully and the module answered
      *         "OK", `false` otherwise.
      */
     bool sendCommand(String cmd);
 
+    /**
+     * @brief Sends a raw command to the RAK3172 module and waits for a response.
+     *
+     * Same as `sendCommand(String)`, but the command is written with a single
+     * UART write, so nothing is allocated.
+     *
+     * @note
+     * - The command must already end with the "\r\n" line ending.
+     *
+     * @param cmd The command characters, not necessarily null terminated.
+     * @param len The number of characters of the command.
+     * @return `true` if the command was sent successfully and the response contains
+     *         "OK", `false` otherwise.
+     */
+    bool sendCommand(const char* cmd, size_t len);
+
     /**
      * @brief Sets the baud rate for communication with the RAK3172 module.
      *
@@ -282,7 +396,8 @@ public:
      * This function takes a command string, sends it to the RAK3172 module via the serial interface,
      * and reads the response. It uses a mutex to ensure thread safety during the communication.
      *
-     * @note The function looks for the first '=' character in the response to extract the relevant data.
+     * @note The function looks for the first '=' character in the data lines of the response to extract the
+     *       relevant data.
      *       Debug information can be printed if the RAK3172_DEBUG flag is defined.
      *
      * @param cmd The command string to be sent to the RAK3172 module.
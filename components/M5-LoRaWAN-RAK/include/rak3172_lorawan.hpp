@@ -161,6 +161,19 @@ typedef struct {
     char payload[500]; /**< Payload data received (up to 500 bytes) */
 } lorawan_frame_t;
 
+/**
+ * @brief Largest payload of one uplink in bytes, the AT+SEND command accepts at most 500 hexadecimal characters.
+ */
+#define RAK3172_LORAWAN_MAX_PAYLOAD 250
+
+/**
+ * @brief One part of a scatter-gather uplink, the parts are sent back to back as one payload.
+ */
+typedef struct {
+    const uint8_t* buf; /**< Pointer to the bytes of this part */
+    size_t size;        /**< Number of bytes of this part, may be 0 */
+} lorawan_iovec_t;
+
 class RAK3172LoRaWAN : public RAK3172 {
 public:
     /**
@@ -183,6 +196,25 @@ public:
      */
     bool init(HardwareSerial* serial, int rx, int tx, rak3172_bps_t baudRate = RAK3172_BPS_115200);
 
+    /**
+     * @brief Reconnects to a module that was configured and joined before the host slept.
+     *
+     * The module keeps its LoRaWAN session while the host is in deep sleep, so
+     * instead of the mode, band and key configuration only the UART handshake
+     * and one `AT+NJS=?` query are sent.
+     *
+     * @note The "AT" command is repeated once, the first character may only wake
+     *       the module from low power mode.
+     *
+     * @param serial A pointer to the `HardwareSerial` object to be used for communication.
+     * @param rx The RX pin number for serial communication.
+     * @param tx The TX pin number for serial communication.
+     * @param baudRate The baud rate to be used for serial communication.
+     * @return `true` if the module answered and reports that it is joined,
+     *         `false` otherwise, the module then needs the full `init` and `join`.
+     */
+    bool resume(HardwareSerial* serial, int rx, int tx, rak3172_bps_t baudRate = RAK3172_BPS_115200);
+
     /**
      * @brief Sets the global application identifier (AppEUI) for the RAK3172 LoRaWAN module.
      *
@@ -880,6 +912,28 @@ public:
      */
     size_t send(const uint8_t* buf, size_t size, int port = 1);
 
+    /**
+     * @brief Sends a payload gathered from several buffers to the LoRa® network.
+     *
+     * The parts are hex encoded one after another straight into the UART TX
+     * buffer of the module together with the "AT+SEND=<port>:" prefix, so the
+     * caller can keep a header, bounding boxes and a histogram in separate
+     * buffers and nothing is allocated or copied on the way.
+     *
+     * @note The total size of all parts must be between 1 and
+     *       `RAK3172_LORAWAN_MAX_PAYLOAD` bytes and the port between 1 and 233,
+     *       otherwise nothing is sent.
+     *
+     * @param parts A pointer to the array of payload parts.
+     * @param count The number of parts in the array.
+     * @param port An integer indicating the port number on which to send the data.
+     *
+     * @return The total size of all parts if the command was successfully sent;
+     *         0 if the payload or port is invalid or there was an error during the
+     *         command execution.
+     */
+    size_t send(const lorawan_iovec_t* parts, size_t count, int port = 1);
+
     /**
      * @brief Parses a received LoRaWAN frame and extracts relevant information.
      *
@@ -906,34 +960,11 @@ public:
     void parse(String frame);
 
     /**
-     * @brief Updates and processes incoming data from the LoRaWAN serial interface.
-     *
-     * This function is designed to periodically check for new data from the LoRaWAN
-     * module and handle various events based on the received response. It reads data
-     * from the serial interface, processes specific event messages (such as join status,
-     * transmission status, and received messages), and invokes corresponding callback
-     * functions if they are set.
-     *
-     * The function reads a line of data terminated by a newline character and checks
-     * for specific event keywords. It processes the following events:
-     * - **+EVT:JOINED**: Indicates that the device has successfully joined the LoRaWAN network.
-     * - **+EVT:JOIN_FAILED**: Indicates that the device failed to join the network.
-     * - **+EVT:TX_DONE**: Indicates that a transmission has been completed.
-     * - **+EVT:RX_**: Indicates that a received message is available, which is then parsed.
+     * @brief Kept for compatibility, the events are dispatched as they arrive.
      *
-     * If a corresponding event is found, the appropriate callback function (if set) is invoked:
-     * - `_onJoin`: Called with `true` if the device successfully joined the network, `false` if it failed.
-     * - `_onSend`: Placeholder for any send completion handler (currently commented out).
-     * - `parse`: Processes the received frame (if a "RX_" event is detected).
-     *
-     * @note This function requires a mutex (_serial_mutex) to safely access the serial
-     *       interface and ensure that other tasks or processes do not interfere during
-     *       the data read operation. This is particularly important in multi-threaded
-     *       or multi-core environments (e.g., FreeRTOS).
-     *
-     * @note The event handling sections (such as +EVT:TX_DONE) are placeholders
-     *       for future implementations, where actions may be taken upon completion
-     *       of a transmission, or additional event types may be added.
+     * The UART event task started by `init` parses every received line and
+     * passes the "+EVT:" lines to `handleEvent`, so there is nothing left to
+     * poll. Existing loops calling this function keep working.
      */
     void update();
 
@@ -1676,6 +1707,24 @@ public:
      */
     String getNetworkState();
 
+protected:
+    /**
+     * @brief Dispatches an unsolicited "+EVT:" line, called from the UART event task.
+     *
+     * The following events are processed:
+     * - **+EVT:JOINED**: `_onJoin` is called with `true`.
+     * - **+EVT:JOIN_FAILED**: `_onJoin` is called with `false`.
+     * - **+EVT:TX_DONE**: `_onSend` is called.
+     * - **+EVT:RX_**: The frame is parsed into the internal buffer and passed to `_onReceive`.
+     *
+     * @note The callbacks run in the event task, they should return quickly and
+     *       must not send commands to the module.
+     *
+     * @param line The null terminated line without the line ending.
+     * @param len The number of characters of the line.
+     */
+    void handleEvent(const char* line, size_t len) override;
+
 private:
     /**
      * @brief A vector holding received LoRaWAN frames.
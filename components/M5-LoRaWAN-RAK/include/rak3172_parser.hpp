@@ -0,0 +1,49 @@
+//author: Stepan Vondracek (xvondr27)
+
+#ifndef RAK3172_PARSER_HPP
+#define RAK3172_PARSER_HPP
+
+#include <stddef.h>
+
+// Longest line the module sends, +EVT:RX_ with 500 hexadecimal characters of payload fits
+#ifndef RAK3172_LINE_BUFFER_SIZE
+#define RAK3172_LINE_BUFFER_SIZE 600
+#endif
+
+// Kind of a complete response line
+typedef enum {
+    RAK3172_LINE_DATA = 0, // anything else, e.g. AT+VER=4.0.5 answering a query
+    RAK3172_LINE_OK,       // the pending command succeeded
+    RAK3172_LINE_ERROR,    // the pending command failed, ERROR or AT_xxx (AT_PARAM_ERROR, AT_BUSY_ERROR, ...)
+    RAK3172_LINE_EVENT,    // unsolicited +EVT: line, e.g. +EVT:JOINED
+} rak3172_line_t;
+
+// Called for every complete line, line is null terminated and without the line ending
+typedef void (*rak3172_line_callback_t)(void* ctx, rak3172_line_t type, const char* line, size_t len);
+
+// Splits the byte stream from the RAK3172 into lines and classifies them.
+// Does not touch the UART, so it can be fed from the UART event task or from a scripted fake on the host.
+class RAK3172LineParser {
+public:
+    // set the callback for complete lines and forget any partial line
+    void begin(rak3172_line_callback_t callback, void* ctx);
+
+    // feed received bytes, they may split lines anywhere
+    void feed(const char* data, size_t size);
+
+    // forget the partial line, e.g. after the UART dropped data
+    void reset();
+
+    // kind of a complete line without the line ending
+    static rak3172_line_t classify(const char* line, size_t len);
+
+private:
+    rak3172_line_callback_t _callback = nullptr;
+    void* _ctx = nullptr;
+    char _line[RAK3172_LINE_BUFFER_SIZE + 1];
+    size_t _len = 0;
+    // the current line did not fit and is dropped when it ends
+    bool _overflow = false;
+};
+
+#endif /* RAK3172_PARSER_HPP */
@@ -49,6 +49,16 @@ String bytes2hex(const uint8_t* buf, size_t size)
     return res;
 }
 
+size_t bytes2hex(const uint8_t* buf, size_t size, char* out)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    for (size_t i = 0; i < size; i++) {
+        out[2 * i]     = digits[buf[i] >> 4];
+        out[2 * i + 1] = digits[buf[i] & 0x0f];
+    }
+    return size * 2;
+}
+
 void hex2bytes(String hexEncoded, uint8_t* buf, size_t size)
 {
     if ((hexEncoded.length() & 1) == 0) {
@@ -108,19 +118,111 @@ bool RAK3172::init(HardwareSerial* serial, int rx, int tx, rak3172_bps_t baudRat
             baud = 4800;
             break;
     }
-    _serial = serial;
-    _tx_pin = tx;
-    _rx_pin = rx;
-    _serial->setTimeout(200);
-    _serial->begin(baud, SERIAL_8N1, rx, tx);
-    _serial_mutex = xSemaphoreCreateMutex();
-    xSemaphoreGive(_serial_mutex);
+    // the event task waits on the driver queue, so the driver is installed only once
+    if (_event_task == nullptr) {
+        _serial = serial;
+        _tx_pin = tx;
+        _rx_pin = rx;
+        _serial->setTimeout(200);
+        _serial->enableLineEvents('\n');
+        _serial->begin(baud, SERIAL_8N1, rx, tx);
+        _serial_mutex  = xSemaphoreCreateMutex();
+        _response_done = xSemaphoreCreateBinary();
+        _parser.begin(onLine, this);
+        xSemaphoreGive(_serial_mutex);
+        xTaskCreate(eventTask, "RAK3172Events", 1024 * 3, this, RAK3172_EVENT_TASK_PRIORITY, &_event_task);
+    }
     return sendCommand("AT");
 }
 
+void RAK3172::eventTask(void* arg)
+{
+    RAK3172* self = (RAK3172*)arg;
+    uart_event_t event;
+    char buf[64];
+    while (true) {
+        if (xQueueReceive(self->_serial->eventQueue(), &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        switch (event.type) {
+            case UART_PATTERN_DET:
+                self->_serial->clearLineEvents();
+                // fall through, the line is read with the rest of the received bytes
+            case UART_DATA: {
+                size_t len;
+                while ((len = self->_serial->read(buf, sizeof(buf))) > 0) {
+                    self->_parser.feed(buf, len);
+                }
+                break;
+            }
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                // a line is lost, the pending command times out
+                self->_serial->flushInput();
+                self->_parser.reset();
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void RAK3172::onLine(void* ctx, rak3172_line_t type, const char* line, size_t len)
+{
+    RAK3172* self = (RAK3172*)ctx;
+
+#if defined RAK3172_DEBUG
+    serialPrint("RESPONSE: ");
+    serialPrintln(line);
+#else
+#endif
+
+    switch (type) {
+        case RAK3172_LINE_OK:
+        case RAK3172_LINE_ERROR:
+            if (self->_response_pending) {
+                self->_response_ok      = type == RAK3172_LINE_OK;
+                self->_response_pending = false;
+                xSemaphoreGive(self->_response_done);
+            }
+            break;
+        case RAK3172_LINE_EVENT:
+            self->handleEvent(line, len);
+            break;
+        case RAK3172_LINE_DATA:
+            // keep as much of the response as fits, lines separated by '\n'
+            if (self->_response_pending && self->_response_len + len + 1 < sizeof(self->_response)) {
+                memcpy(self->_response + self->_response_len, line, len);
+                self->_response_len += len;
+                self->_response[self->_response_len++] = '\n';
+                self->_response[self->_response_len]   = '\0';
+            }
+            break;
+    }
+}
+
+void RAK3172::beginResponse()
+{
+    // drop a completion of a command that already timed out
+    xSemaphoreTake(_response_done, 0);
+    _response_len     = 0;
+    _response[0]      = '\0';
+    _response_ok      = false;
+    _response_pending = true;
+}
+
+bool RAK3172::waitResponse()
+{
+    bool done         = xSemaphoreTake(_response_done, RAK3172_COMMAND_TIMEOUT_MS / portTICK_PERIOD_MS) == pdTRUE;
+    _response_pending = false;
+    return done && _response_ok;
+}
+
 bool RAK3172::sendCommand(String cmd)
 {
+    bool ok = false;
     if (xSemaphoreTake(_serial_mutex, portMAX_DELAY) == pdTRUE) {
+        beginResponse();
         _serial->println(cmd);
 
 #if defined RAK3172_DEBUG
@@ -129,19 +231,37 @@ bool RAK3172::sendCommand(String cmd)
 #else
 #endif
 
-        String res = _serial->readString();
+        ok = waitResponse();
+        xSemaphoreGive(_serial_mutex);
+    }
+    return ok;
+}
+
+bool RAK3172::sendCommandLocked(const char* cmd, size_t len)
+{
+    beginResponse();
+    if (_serial->write((const uint8_t*)cmd, len) != len) {
+        _response_pending = false;
+        return false;
+    }
 
 #if defined RAK3172_DEBUG
-        serialPrint("RESPONSE: ");
-        serialPrint(res);
+    serialPrint("SEND CMD: ");
+    serialPrint(String(std::string(cmd, len)));
 #else
 #endif
+
+    return waitResponse();
+}
+
+bool RAK3172::sendCommand(const char* cmd, size_t len)
+{
+    bool ok = false;
+    if (xSemaphoreTake(_serial_mutex, portMAX_DELAY) == pdTRUE) {
+        ok = sendCommandLocked(cmd, len);
         xSemaphoreGive(_serial_mutex);
-        if (res.indexOf("OK") != -1) {
-            return true;
-        }
     }
-    return false;
+    return ok;
 }
 
 bool RAK3172::setBaudRate(rak3172_bps_t baudRate)
@@ -196,6 +316,7 @@ String RAK3172::getCommand(String cmd)
 {
     String data = "";
     if (xSemaphoreTake(_serial_mutex, portMAX_DELAY) == pdTRUE) {
+        beginResponse();
         _serial->println(cmd);
 
 #if defined RAK3172_DEBUG
@@ -204,13 +325,8 @@ String RAK3172::getCommand(String cmd)
 #else
 #endif
 
-        String res = _serial->readString();
-
-#if defined RAK3172_DEBUG
-        serialPrint("RESPONSE: ");
-        serialPrintln(res);
-#else
-#endif
+        waitResponse();
+        String res = String(_response);
         xSemaphoreGive(_serial_mutex);
         int index = res.indexOf('=');
         if (index != -1) {
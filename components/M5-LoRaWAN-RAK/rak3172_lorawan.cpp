@@ -13,6 +13,15 @@ bool RAK3172LoRaWAN::init(HardwareSerial* serial, int rx, int tx, rak3172_bps_t
     return (sendCommand("AT+NWM=1"));
 }
 
+bool RAK3172LoRaWAN::resume(HardwareSerial* serial, int rx, int tx, rak3172_bps_t baudRate)
+{
+    if (!RAK3172::init(serial, rx, tx, baudRate) && !sendCommand("AT")) {
+        return false;
+    }
+    _is_joined = getNetworkState() == "1";
+    return _is_joined;
+}
+
 bool RAK3172LoRaWAN::setApplicationIdentifier(const String& identifier)
 {
     if (!checkString(identifier, 8)) {
@@ -225,11 +234,46 @@ size_t RAK3172LoRaWAN::send(String data, int port)
 
 size_t RAK3172LoRaWAN::send(const uint8_t* buf, size_t size, int port)
 {
-    String hexEncoded = bytes2hex(buf, size);
-    if (sendCommand("AT+SEND=" + String(port) + ":" + hexEncoded)) {
-        return size;
-    };
-    return 0;
+    lorawan_iovec_t part = {buf, size};
+    return send(&part, 1, port);
+}
+
+size_t RAK3172LoRaWAN::send(const lorawan_iovec_t* parts, size_t count, int port)
+{
+    static const char prefix[] = "AT+SEND=";
+
+    size_t size = 0;
+    for (size_t i = 0; i < count; i++) {
+        size += parts[i].size;
+    }
+    if (size == 0 || size > RAK3172_LORAWAN_MAX_PAYLOAD || port < 1 || port > 233) {
+        return 0;
+    }
+
+    bool ok = false;
+    if (xSemaphoreTake(_serial_mutex, portMAX_DELAY) == pdTRUE) {
+        // AT+SEND=<port>:<hex payload>\r\n, the buffer fits the largest payload
+        char* p = _tx_buffer;
+        memcpy(p, prefix, sizeof(prefix) - 1);
+        p += sizeof(prefix) - 1;
+        if (port >= 100) {
+            *p++ = '0' + port / 100;
+        }
+        if (port >= 10) {
+            *p++ = '0' + port / 10 % 10;
+        }
+        *p++ = '0' + port % 10;
+        *p++ = ':';
+        for (size_t i = 0; i < count; i++) {
+            p += bytes2hex(parts[i].buf, parts[i].size, p);
+        }
+        *p++ = '\r';
+        *p++ = '\n';
+
+        ok = sendCommandLocked(_tx_buffer, p - _tx_buffer);
+        xSemaphoreGive(_serial_mutex);
+    }
+    return ok ? size : 0;
 }
 
 void RAK3172LoRaWAN::parse(String frame)
@@ -260,34 +304,28 @@ void RAK3172LoRaWAN::parse(String frame)
 
 void RAK3172LoRaWAN::update()
 {
-    String res = "";
-    if (xSemaphoreTake(_serial_mutex, portMAX_DELAY) == pdTRUE) {
-        String res = _serial->readStringUntil('\n');
-        xSemaphoreGive(_serial_mutex);
-        if(!res.isEmpty()){
-            printf("%s\n", res.c_str());
-            if (res.indexOf("+EVT:LINKCHECK") != -1) {
-            }
-    
-            if (res.indexOf("+EVT:JOINED") != -1) {
-                if (_onJoin) {
-                    _onJoin(true);
-                }
-            }
-            if (res.indexOf("+EVT:JOIN_FAILED") != -1) {
-                if (_onJoin) {
-                    _onJoin(false);
-                }
-            }
-            if (res.indexOf("+EVT:TX_DONE") != -1) {
-                if (_onSend) {
-                    // _onSend();
-                }
-            }
-            if (res.indexOf("+EVT:RX_") != -1) {
-                res.remove(res.length() - 1);
-                parse(res);
-            }
+    // events are dispatched by handleEvent() from the UART event task as they arrive
+}
+
+void RAK3172LoRaWAN::handleEvent(const char* line, size_t)
+{
+    printf("%s\n", line);
+    if (strncmp(line, "+EVT:JOINED", 11) == 0) {
+        if (_onJoin) {
+            _onJoin(true);
+        }
+    } else if (strncmp(line, "+EVT:JOIN_FAILED", 16) == 0) {
+        if (_onJoin) {
+            _onJoin(false);
+        }
+    } else if (strncmp(line, "+EVT:TX_DONE", 12) == 0) {
+        if (_onSend) {
+            _onSend();
+        }
+    } else if (strncmp(line, "+EVT:RX_", 8) == 0) {
+        parse(String(line));
+        if (_onReceive && !_frames.empty()) {
+            _onReceive(_frames.back());
         }
     }
 }
@@ -0,0 +1,56 @@
+//author: Stepan Vondracek (xvondr27)
+#include "include/rak3172_parser.hpp"
+#include <string.h>
+
+void RAK3172LineParser::begin(rak3172_line_callback_t callback, void* ctx)
+{
+    _callback = callback;
+    _ctx      = ctx;
+    reset();
+}
+
+void RAK3172LineParser::reset()
+{
+    _len      = 0;
+    _overflow = false;
+}
+
+void RAK3172LineParser::feed(const char* data, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        char ch = data[i];
+        if (ch == '\r') {
+            continue;
+        }
+        if (ch != '\n') {
+            if (_len < RAK3172_LINE_BUFFER_SIZE) {
+                _line[_len++] = ch;
+            } else {
+                _overflow = true;
+            }
+            continue;
+        }
+
+        // end of line, empty lines between responses are skipped
+        if (_len > 0 && !_overflow && _callback != nullptr) {
+            _line[_len] = '\0';
+            _callback(_ctx, classify(_line, _len), _line, _len);
+        }
+        reset();
+    }
+}
+
+rak3172_line_t RAK3172LineParser::classify(const char* line, size_t len)
+{
+    if (len == 2 && memcmp(line, "OK", 2) == 0) {
+        return RAK3172_LINE_OK;
+    }
+    // status codes of the RAK3172 AT command set, an echoed command starts with AT+
+    if ((len == 5 && memcmp(line, "ERROR", 5) == 0) || (len > 3 && memcmp(line, "AT_", 3) == 0)) {
+        return RAK3172_LINE_ERROR;
+    }
+    if (len >= 5 && memcmp(line, "+EVT:", 5) == 0) {
+        return RAK3172_LINE_EVENT;
+    }
+    return RAK3172_LINE_DATA;
+}
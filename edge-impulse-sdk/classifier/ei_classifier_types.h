@@ -166,6 +166,49 @@ typedef struct {
     float value;
 } ei_impulse_result_bounding_box_t;
 
+/**
+ * @brief Holds one connected group of FOMO grid cells.
+ *
+ * FOMO models output a grid of per-class scores. Neighbouring cells (including
+ * diagonal ones) of the same class that are above the threshold are merged into one
+ * blob, from which the matching bounding box is made. The blob keeps the details
+ * which are lost in the box: how many cells the object covers, where its centre is
+ * and how confident the strongest cell is.
+ *
+ * Coordinates are in pixels of the model input, like the bounding boxes.
+ */
+typedef struct {
+    /**
+     * Label of the class the cells belong to
+     */
+    const char *label;
+
+    /**
+     * Index of the class in `ei_classifier_inferencing_categories[]`
+     */
+    uint16_t label_ix;
+
+    /**
+     * Number of grid cells in the blob
+     */
+    uint16_t cell_count;
+
+    /**
+     * x coordinate of the mean of the cell centres
+     */
+    float centroid_x;
+
+    /**
+     * y coordinate of the mean of the cell centres
+     */
+    float centroid_y;
+
+    /**
+     * Highest score of the cells in the blob, same as `value` of the bounding box
+     */
+    float peak_value;
+} ei_impulse_result_fomo_blob_t;
+
 /**
  * @brief Holds timing information about the processing (DSP) and inference blocks.
  *
@@ -259,6 +302,17 @@ typedef struct {
      */
     uint32_t bounding_boxes_count;
 
+    /**
+     * Array of the blobs the bounding boxes were made from, if the model is FOMO.
+     * `fomo_blobs[i]` belongs to `bounding_boxes[i]`.
+     */
+    ei_impulse_result_fomo_blob_t *fomo_blobs;
+
+    /**
+     * Number of FOMO blobs, same as `bounding_boxes_count` for FOMO models, otherwise 0.
+     */
+    uint32_t fomo_blobs_count;
+
     /**
      * Array of classification results. If object detection is enabled, this will be
      * empty.
@@ -84,140 +84,343 @@ __attribute__((unused)) inline float sigmoid(float a) {
 }
 
 #ifdef EI_HAS_FOMO
-typedef struct cube {
-    size_t x;
-    size_t y;
-    size_t width;
-    size_t height;
-    float confidence;
-    const char *label;
-} ei_classifier_cube_t;
+// FOMO cuts the model at 1/8 of the input resolution, larger grids need these raised
+#ifndef EI_CLASSIFIER_FOMO_MAX_WIDTH
+#define EI_CLASSIFIER_FOMO_MAX_WIDTH    (EI_CLASSIFIER_INPUT_WIDTH / 8)
+#endif
+#ifndef EI_CLASSIFIER_FOMO_MAX_HEIGHT
+#define EI_CLASSIFIER_FOMO_MAX_HEIGHT   (EI_CLASSIFIER_INPUT_HEIGHT / 8)
+#endif
+#define EI_CLASSIFIER_FOMO_MAX_CELLS    (EI_CLASSIFIER_FOMO_MAX_WIDTH * EI_CLASSIFIER_FOMO_MAX_HEIGHT)
+
+// all cells of a 2x2 block touch each other, so each block holds cells of at most one blob per class
+#ifndef EI_CLASSIFIER_FOMO_MAX_BLOBS
+#define EI_CLASSIFIER_FOMO_MAX_BLOBS    (EI_CLASSIFIER_LABEL_COUNT * \
+                                         ((EI_CLASSIFIER_FOMO_MAX_WIDTH + 1) / 2) * \
+                                         ((EI_CLASSIFIER_FOMO_MAX_HEIGHT + 1) / 2))
+#endif
+
+// at least object_detection_count boxes are always returned
+#if EI_CLASSIFIER_FOMO_MAX_BLOBS > EI_CLASSIFIER_OBJECT_DETECTION_COUNT
+#define EI_CLASSIFIER_FOMO_MAX_BOXES    EI_CLASSIFIER_FOMO_MAX_BLOBS
+#else
+#define EI_CLASSIFIER_FOMO_MAX_BOXES    EI_CLASSIFIER_OBJECT_DETECTION_COUNT
+#endif
+
+#define EI_FOMO_NO_LABEL                0xffff
+
+static_assert(EI_CLASSIFIER_FOMO_MAX_CELLS < EI_FOMO_NO_LABEL, "FOMO grid too large for 16-bit labels");
 
 /**
- * Checks whether a new section overlaps with a cube,
- * and if so, will **update the cube**
+ * Part of a blob found by the labelling. Parts which turn out to be connected
+ * are merged into the one found first, which is the root of the set.
  */
-__attribute__((unused)) static bool ei_cube_check_overlap(ei_classifier_cube_t *c, int x, int y, int width, int height, float confidence) {
-    bool is_overlapping = !(c->x + c->width < x || c->y + c->height < y || c->x > x + width || c->y > y + height);
-    if (!is_overlapping) return false;
-
-    // if we overlap, but the x of the new box is lower than the x of the current box
-    if (x < c->x) {
-        // update x to match new box and make width larger (by the diff between the boxes)
-        c->x = x;
-        c->width += c->x - x;
+typedef struct {
+    uint16_t parent;
+    uint16_t cell_count;
+    uint16_t min_x;
+    uint16_t min_y;
+    uint16_t max_x;
+    uint16_t max_y;
+    uint32_t sum_x;
+    uint32_t sum_y;
+    uint32_t peak_loc;
+} ei_fomo_component_t;
+
+/**
+ * Working memory of the FOMO decoder, sized for the largest supported grid
+ */
+typedef struct {
+    ei_fomo_component_t components[EI_CLASSIFIER_FOMO_MAX_CELLS];
+    // labels of the previous and the current row of the grid
+    uint16_t rows[2][EI_CLASSIFIER_FOMO_MAX_WIDTH];
+    // rows with at least one class score at or above the threshold
+    uint8_t row_active[EI_CLASSIFIER_FOMO_MAX_HEIGHT];
+} ei_fomo_scratch_t;
+
+/**
+ * Quantized threshold of an int8 output tensor, kept until the model,
+ * its threshold or the quantization of the tensor changes
+ */
+typedef struct {
+    const ei_learning_block_config_tflite_graph_t *block_config;
+    float threshold;
+    float zero_point;
+    float scale;
+    bool reachable;
+    int8_t threshold_q;
+} ei_fomo_threshold_t;
+
+static ei_fomo_scratch_t ei_fomo_scratch;
+static ei_fomo_threshold_t ei_fomo_threshold;
+static ei_impulse_result_bounding_box_t ei_fomo_boxes[EI_CLASSIFIER_FOMO_MAX_BOXES];
+static ei_impulse_result_fomo_blob_t ei_fomo_blobs[EI_CLASSIFIER_FOMO_MAX_BOXES];
+
+__attribute__((unused)) static inline uint16_t ei_fomo_find(ei_fomo_component_t *components, uint16_t ix) {
+    // path halving, every visited part is moved up to its grandparent
+    while (components[ix].parent != ix) {
+        components[ix].parent = components[components[ix].parent].parent;
+        ix = components[ix].parent;
+    }
+    return ix;
+}
+
+/**
+ * Joins the sets of two parts and returns the root of the joined set
+ */
+template<typename T>
+static uint16_t ei_fomo_union(ei_fomo_component_t *components, const T *data, uint16_t a, uint16_t b) {
+    a = ei_fomo_find(components, a);
+    b = ei_fomo_find(components, b);
+    if (a == b) {
+        return a;
     }
-    // if we overlap, but the y of the new box is lower than the y of the current box
-    if (y < c->y) {
-        // update y to match new box and make height larger (by the diff between the boxes)
-        c->y = y;
-        c->height += c->y - y;
+    if (b < a) {
+        uint16_t tmp = a;
+        a = b;
+        b = tmp;
     }
-    // if we overlap, and x+width of the new box is higher than the x+width of the current box
-    if (x + width > c->x + c->width) {
-        // just make the box wider
-        c->width += (x + width) - (c->x + c->width);
+
+    ei_fomo_component_t *root = &components[a];
+    ei_fomo_component_t *child = &components[b];
+    child->parent = a;
+    root->cell_count += child->cell_count;
+    root->min_x = std::min(root->min_x, child->min_x);
+    root->min_y = std::min(root->min_y, child->min_y);
+    root->max_x = std::max(root->max_x, child->max_x);
+    root->max_y = std::max(root->max_y, child->max_y);
+    root->sum_x += child->sum_x;
+    root->sum_y += child->sum_y;
+    if (data[child->peak_loc] > data[root->peak_loc]) {
+        root->peak_loc = child->peak_loc;
+    }
+    return a;
+}
+
+/**
+ * Finds the lowest quantized score which dequantizes to at least `threshold`,
+ * so the output grid can be compared without dequantizing every cell.
+ * Returns false if no int8 score reaches the threshold.
+ */
+__attribute__((unused)) static bool ei_fomo_quantize_threshold(float threshold, float zero_point, float scale, int8_t *threshold_q) {
+    float q_f = threshold / scale + zero_point;
+    q_f = std::max(-129.0f, std::min(129.0f, q_f));
+    int32_t q = (int32_t)std::ceil(q_f);
+
+    // the division may round differently than the dequantization of the scores
+    while (q > -128 && static_cast<float>((q - 1) - zero_point) * scale >= threshold) {
+        q--;
     }
-    // if we overlap, and y+height of the new box is higher than the y+height of the current box
-    if (y + height > c->y + c->height) {
-        // just make the box higher
-        c->height += (y + height) - (c->y + c->height);
+    while (q < 128 && static_cast<float>(q - zero_point) * scale < threshold) {
+        q++;
     }
-    // if the new box has higher confidence, then override confidence of the whole box
-    if (confidence > c->confidence) {
-        c->confidence = confidence;
+    if (q > 127) {
+        return false;
     }
+    *threshold_q = (int8_t)std::max(q, (int32_t)-128);
     return true;
 }
 
-__attribute__((unused)) static void ei_handle_cube(std::vector<ei_classifier_cube_t*> *cubes, int x, int y, float vf, const char *label, float detection_threshold) {
-    if (vf < detection_threshold) return;
-
-    bool has_overlapping = false;
-    int width = 1;
-    int height = 1;
+/**
+ * Returns the quantized threshold of the block, computing it only on the first
+ * inference of the model or when the threshold was changed
+ */
+__attribute__((unused)) static bool ei_fomo_get_threshold_i8(const ei_learning_block_config_tflite_graph_t *block_config,
+                                                             float zero_point,
+                                                             float scale,
+                                                             int8_t *threshold_q) {
+    ei_fomo_threshold_t *t = &ei_fomo_threshold;
+    if (t->block_config != block_config || t->threshold != block_config->threshold ||
+        t->zero_point != zero_point || t->scale != scale) {
+        t->block_config = block_config;
+        t->threshold = block_config->threshold;
+        t->zero_point = zero_point;
+        t->scale = scale;
+        t->reachable = ei_fomo_quantize_threshold(t->threshold, zero_point, scale, &t->threshold_q);
+    }
+    *threshold_q = t->threshold_q;
+    return t->reachable;
+}
 
-    for (auto c : *cubes) {
-        // not cube for same class? continue
-        if (strcmp(c->label, label) != 0) continue;
+/**
+ * Groups the cells of a FOMO output grid which are at or above the threshold into blobs.
+ *
+ * Every class is labelled in one raster pass with union-find: a cell joins the blobs of
+ * its already visited neighbours (left, top-left, top and top-right), so touching and
+ * diagonal cells end up in the same blob. Only the root of each blob keeps the box,
+ * cell count, centroid sums and the location of the peak score.
+ *
+ * Blobs are written per class in raster order of their first cell into `boxes` and
+ * `blobs`, which must have room for `max_blobs` entries. Blobs beyond that are dropped.
+ *
+ * @param data Output tensor, `out_height` x `out_width` x (`label_count` + 1), channel 0 is background
+ * @param threshold Lowest score of a detected cell, in the type of the tensor
+ * @param zero_point, scale Dequantization of the scores, 0 and 1 for float tensors
+ */
+template<typename T>
+static EI_IMPULSE_ERROR ei_fomo_decode(const ei_impulse_t *impulse,
+                                       const T *data,
+                                       T threshold,
+                                       float zero_point,
+                                       float scale,
+                                       int out_width,
+                                       int out_height,
+                                       ei_fomo_scratch_t *scratch,
+                                       ei_impulse_result_bounding_box_t *boxes,
+                                       ei_impulse_result_fomo_blob_t *blobs,
+                                       uint32_t max_blobs,
+                                       uint32_t *blob_count) {
+    if (out_width > EI_CLASSIFIER_FOMO_MAX_WIDTH || out_height > EI_CLASSIFIER_FOMO_MAX_HEIGHT) {
+        ei_printf("ERR: FOMO output grid %dx%d is larger than EI_CLASSIFIER_FOMO_MAX_WIDTH x EI_CLASSIFIER_FOMO_MAX_HEIGHT (%dx%d)\n",
+            out_width, out_height, EI_CLASSIFIER_FOMO_MAX_WIDTH, EI_CLASSIFIER_FOMO_MAX_HEIGHT);
+        return EI_IMPULSE_OUT_OF_MEMORY;
+    }
 
-        if (ei_cube_check_overlap(c, x, y, width, height, vf)) {
-            has_overlapping = true;
-            break;
+    ei_fomo_component_t *components = scratch->components;
+    const size_t channels = impulse->label_count + 1;
+    const uint32_t cell_width = impulse->input_width / out_width;
+    const uint32_t cell_height = impulse->input_height / out_height;
+    uint32_t count = 0;
+
+    // Most cells are background, so find the rows with any detection first in one sweep
+    // over the class channels. The comparisons have no branches to keep the loop tight.
+    bool any_active = false;
+    for (int y = 0; y < out_height; y++) {
+        const T *row = &data[y * out_width * channels];
+        bool active = false;
+        for (int x = 0; x < out_width; x++) {
+            for (size_t ix = 1; ix < channels; ix++) {
+                active |= row[x * channels + ix] >= threshold;
+            }
         }
+        scratch->row_active[y] = active;
+        any_active |= active;
     }
-
-    if (!has_overlapping) {
-        ei_classifier_cube_t *cube = new ei_classifier_cube_t();
-        cube->x = x;
-        cube->y = y;
-        cube->width = 1;
-        cube->height = 1;
-        cube->confidence = vf;
-        cube->label = label;
-        cubes->push_back(cube);
+    if (!any_active) {
+        *blob_count = 0;
+        return EI_IMPULSE_OK;
     }
-}
 
-__attribute__((unused)) static void fill_result_struct_from_cubes(ei_impulse_result_t *result, std::vector<ei_classifier_cube_t*> *cubes, int out_width_factor, uint32_t object_detection_count) {
-    std::vector<ei_classifier_cube_t*> bbs;
-    static std::vector<ei_impulse_result_bounding_box_t> results;
-    int added_boxes_count = 0;
-    results.clear();
+    for (uint16_t ix = 1; ix < channels; ix++) {
+        uint16_t *prev = scratch->rows[0];
+        uint16_t *cur = scratch->rows[1];
+        uint16_t component_count = 0;
 
-    for (auto sc : *cubes) {
-        bool has_overlapping = false;
+        for (int x = 0; x < out_width; x++) {
+            prev[x] = EI_FOMO_NO_LABEL;
+        }
 
-        int x = sc->x;
-        int y = sc->y;
-        int width = sc->width;
-        int height = sc->height;
-        const char *label = sc->label;
-        float vf = sc->confidence;
+        for (int y = 0; y < out_height; y++) {
+            if (!scratch->row_active[y]) {
+                for (int x = 0; x < out_width; x++) {
+                    cur[x] = EI_FOMO_NO_LABEL;
+                }
+                uint16_t *tmp = prev;
+                prev = cur;
+                cur = tmp;
+                continue;
+            }
 
-        for (auto c : bbs) {
-            // not cube for same class? continue
-            if (strcmp(c->label, label) != 0) continue;
+            for (int x = 0; x < out_width; x++) {
+                uint32_t loc = ((y * out_width) + x) * channels + ix;
+                if (data[loc] < threshold) {
+                    cur[x] = EI_FOMO_NO_LABEL;
+                    continue;
+                }
 
-            if (ei_cube_check_overlap(c, x, y, width, height, vf)) {
-                has_overlapping = true;
-                break;
+                uint16_t neighbours[4] = {
+                    x > 0 ? cur[x - 1] : (uint16_t)EI_FOMO_NO_LABEL,
+                    x > 0 ? prev[x - 1] : (uint16_t)EI_FOMO_NO_LABEL,
+                    prev[x],
+                    x + 1 < out_width ? prev[x + 1] : (uint16_t)EI_FOMO_NO_LABEL,
+                };
+                uint16_t label = EI_FOMO_NO_LABEL;
+                for (uint16_t n : neighbours) {
+                    if (n == EI_FOMO_NO_LABEL) {
+                        continue;
+                    }
+                    label = label == EI_FOMO_NO_LABEL ?
+                        ei_fomo_find(components, n) :
+                        ei_fomo_union(components, data, label, n);
+                }
+
+                if (label == EI_FOMO_NO_LABEL) {
+                    label = component_count++;
+                    components[label] = {
+                        .parent = label,
+                        .cell_count = 1,
+                        .min_x = (uint16_t)x,
+                        .min_y = (uint16_t)y,
+                        .max_x = (uint16_t)x,
+                        .max_y = (uint16_t)y,
+                        .sum_x = (uint32_t)x,
+                        .sum_y = (uint32_t)y,
+                        .peak_loc = loc
+                    };
+                }
+                else {
+                    ei_fomo_component_t *c = &components[label];
+                    c->cell_count++;
+                    c->min_x = std::min(c->min_x, (uint16_t)x);
+                    c->max_x = std::max(c->max_x, (uint16_t)x);
+                    c->max_y = (uint16_t)y;
+                    c->sum_x += x;
+                    c->sum_y += y;
+                    if (data[loc] > data[c->peak_loc]) {
+                        c->peak_loc = loc;
+                    }
+                }
+                cur[x] = label;
             }
-        }
 
-        if (has_overlapping) {
-            continue;
+            uint16_t *tmp = prev;
+            prev = cur;
+            cur = tmp;
         }
 
-        bbs.push_back(sc);
-
-        ei_impulse_result_bounding_box_t tmp = {
-            .label = sc->label,
-            .x = (uint32_t)(sc->x * out_width_factor),
-            .y = (uint32_t)(sc->y * out_width_factor),
-            .width = (uint32_t)(sc->width * out_width_factor),
-            .height = (uint32_t)(sc->height * out_width_factor),
-            .value = sc->confidence
-        };
-
-        results.push_back(tmp);
-        added_boxes_count++;
-    }
+        for (uint16_t c_ix = 0; c_ix < component_count && count < max_blobs; c_ix++) {
+            const ei_fomo_component_t *c = &components[c_ix];
+            if (c->parent != c_ix) {
+                continue;
+            }
 
-    // if we didn't detect min required objects, fill the rest with fixed value
-    if (added_boxes_count < object_detection_count) {
-        results.resize(object_detection_count);
-        for (size_t ix = added_boxes_count; ix < object_detection_count; ix++) {
-            results[ix].value = 0.0f;
+            float value = static_cast<float>(data[c->peak_loc] - zero_point) * scale;
+            boxes[count] = {
+                .label = impulse->categories[ix - 1],
+                .x = (uint32_t)(c->min_x * cell_width),
+                .y = (uint32_t)(c->min_y * cell_height),
+                .width = (uint32_t)((c->max_x - c->min_x + 1) * cell_width),
+                .height = (uint32_t)((c->max_y - c->min_y + 1) * cell_height),
+                .value = value
+            };
+            blobs[count] = {
+                .label = impulse->categories[ix - 1],
+                .label_ix = (uint16_t)(ix - 1),
+                .cell_count = c->cell_count,
+                .centroid_x = ((float)c->sum_x / c->cell_count + 0.5f) * cell_width,
+                .centroid_y = ((float)c->sum_y / c->cell_count + 0.5f) * cell_height,
+                .peak_value = value
+            };
+            count++;
         }
     }
 
-    for (auto c : *cubes) {
-        delete c;
+    *blob_count = count;
+    return EI_IMPULSE_OK;
+}
+
+__attribute__((unused)) static void fill_result_struct_from_fomo_blobs(const ei_impulse_t *impulse, ei_impulse_result_t *result, uint32_t blob_count) {
+    // if we didn't detect min required objects, fill the rest with fixed value
+    uint32_t min_count = std::min((uint32_t)impulse->object_detection_count, (uint32_t)EI_CLASSIFIER_FOMO_MAX_BOXES);
+    for (uint32_t ix = blob_count; ix < min_count; ix++) {
+        ei_fomo_boxes[ix] = { };
+        ei_fomo_blobs[ix] = { };
     }
 
-    result->bounding_boxes = results.data();
-    result->bounding_boxes_count = added_boxes_count;
+    result->bounding_boxes = ei_fomo_boxes;
+    result->bounding_boxes_count = blob_count;
+    result->fomo_blobs = ei_fomo_blobs;
+    result->fomo_blobs_count = blob_count;
 }
 #endif
 
@@ -228,24 +431,15 @@ __attribute__((unused)) static EI_IMPULSE_ERROR fill_result_struct_f32_fomo(cons
                                                                             int out_width,
                                                                             int out_height) {
 #ifdef EI_HAS_FOMO
-    std::vector<ei_classifier_cube_t*> cubes;
-
-    int out_width_factor = impulse->input_width / out_width;
-
-    for (size_t y = 0; y < out_width; y++) {
-        // ei_printf("    [ ");
-        for (size_t x = 0; x < out_height; x++) {
-            size_t loc = ((y * out_height) + x) * (impulse->label_count + 1);
-
-            for (size_t ix = 1; ix < impulse->label_count + 1; ix++) {
-                float vf = data[loc+ix];
-
-                ei_handle_cube(&cubes, x, y, vf, impulse->categories[ix - 1], block_config->threshold);
-            }
-        }
+    uint32_t blob_count = 0;
+    EI_IMPULSE_ERROR res = ei_fomo_decode<float>(impulse, data, block_config->threshold, 0.0f, 1.0f,
+        out_width, out_height, &ei_fomo_scratch, ei_fomo_boxes, ei_fomo_blobs,
+        EI_CLASSIFIER_FOMO_MAX_BLOBS, &blob_count);
+    if (res != EI_IMPULSE_OK) {
+        return res;
     }
 
-    fill_result_struct_from_cubes(result, &cubes, out_width_factor, impulse->object_detection_count);
+    fill_result_struct_from_fomo_blobs(impulse, result, blob_count);
 
     return EI_IMPULSE_OK;
 #else
@@ -262,25 +456,20 @@ __attribute__((unused)) static EI_IMPULSE_ERROR fill_result_struct_i8_fomo(const
                                                                            int out_width,
                                                                            int out_height) {
 #ifdef EI_HAS_FOMO
-    std::vector<ei_classifier_cube_t*> cubes;
-
-    int out_width_factor = impulse->input_width / out_width;
-
-    for (size_t y = 0; y < out_width; y++) {
-        // ei_printf("    [ ");
-        for (size_t x = 0; x < out_height; x++) {
-            size_t loc = ((y * out_height) + x) * (impulse->label_count + 1);
-
-            for (size_t ix = 1; ix < impulse->label_count + 1; ix++) {
-                int8_t v = data[loc+ix];
-                float vf = static_cast<float>(v - zero_point) * scale;
-
-                ei_handle_cube(&cubes, x, y, vf, impulse->categories[ix - 1], block_config->threshold);
-            }
+    uint32_t blob_count = 0;
+    int8_t threshold_q;
+
+    // no cell can reach the threshold otherwise
+    if (ei_fomo_get_threshold_i8(block_config, zero_point, scale, &threshold_q)) {
+        EI_IMPULSE_ERROR res = ei_fomo_decode<int8_t>(impulse, data, threshold_q, zero_point, scale,
+            out_width, out_height, &ei_fomo_scratch, ei_fomo_boxes, ei_fomo_blobs,
+            EI_CLASSIFIER_FOMO_MAX_BLOBS, &blob_count);
+        if (res != EI_IMPULSE_OK) {
+            return res;
         }
     }
 
-    fill_result_struct_from_cubes(result, &cubes, out_width_factor, impulse->object_detection_count);
+    fill_result_struct_from_fomo_blobs(impulse, result, blob_count);
 
     return EI_IMPULSE_OK;
 #else
@@ -0,0 +1,170 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "edge-impulse-sdk/classifier/ei_profiling.h"
+
+#if EI_CLASSIFIER_PROFILING == 1
+
+#include <string.h>
+
+#if EI_PORTING_ESPRESSIF == 1
+#include "esp_cpu.h"
+#include "sdkconfig.h"
+#endif
+
+static ei_profiling_record_t ring[EI_CLASSIFIER_PROFILING_RING_SIZE];
+// number of records made since the last reset, the ring holds the last ones
+static uint32_t ring_head = 0;
+static const char *tags[EI_CLASSIFIER_PROFILING_MAX_TAGS];
+
+uint32_t ei_profiling_cycles(void)
+{
+#if EI_PORTING_ESPRESSIF == 1
+    return (uint32_t)esp_cpu_get_cycle_count();
+#else
+    return (uint32_t)ei_read_timer_us();
+#endif
+}
+
+static uint32_t cycles_per_second(void)
+{
+#if EI_PORTING_ESPRESSIF == 1
+    return CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ * 1000000;
+#else
+    return 1000000;
+#endif
+}
+
+// index of the tag in the table, added if it is not there yet
+static uint8_t tag_index(const char *tag)
+{
+    for (uint8_t ix = 0; ix < EI_CLASSIFIER_PROFILING_MAX_TAGS; ix++) {
+        const char *t = __atomic_load_n(&tags[ix], __ATOMIC_ACQUIRE);
+        if (t == nullptr) {
+            // another task may take the slot first, then it is compared again
+            if (__atomic_compare_exchange_n(&tags[ix], &t, tag, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                return ix;
+            }
+        }
+        if (t == tag || strcmp(t, tag) == 0) {
+            return ix;
+        }
+    }
+    return EI_PROFILING_NO_TAG;
+}
+
+void ei_profiling_record(ei_profiling_kind_t kind, const char *tag, uint16_t id, uint32_t value)
+{
+    uint32_t head = __atomic_fetch_add(&ring_head, 1, __ATOMIC_RELAXED);
+    ei_profiling_record_t *r = &ring[head % EI_CLASSIFIER_PROFILING_RING_SIZE];
+    r->kind = (uint8_t)kind;
+    r->tag = tag_index(tag);
+    r->id = id;
+    r->value = value;
+    r->time_us = (uint32_t)ei_read_timer_us();
+}
+
+void ei_profiling_reset(void)
+{
+    __atomic_store_n(&ring_head, 0, __ATOMIC_RELAXED);
+}
+
+bool ei_profiling_export(ei_profiling_write_fn write, void *ctx)
+{
+    uint32_t head = __atomic_load_n(&ring_head, __ATOMIC_ACQUIRE);
+    uint32_t count = head < EI_CLASSIFIER_PROFILING_RING_SIZE ? head : EI_CLASSIFIER_PROFILING_RING_SIZE;
+    uint16_t tag_count = 0;
+    while (tag_count < EI_CLASSIFIER_PROFILING_MAX_TAGS && tags[tag_count] != nullptr) {
+        tag_count++;
+    }
+
+    ei_profiling_header_t header = {
+        .magic = EI_PROFILING_MAGIC,
+        .version = EI_PROFILING_VERSION,
+        .record_size = sizeof(ei_profiling_record_t),
+        .cycles_per_second = cycles_per_second(),
+        .record_count = count,
+        .dropped = head - count,
+        .tag_count = tag_count,
+        .tag_size = EI_PROFILING_TAG_SIZE
+    };
+    if (!write(&header, sizeof(header), ctx)) {
+        return false;
+    }
+
+    for (uint16_t ix = 0; ix < tag_count; ix++) {
+        char name[EI_PROFILING_TAG_SIZE] = { 0 };
+        strncpy(name, tags[ix], EI_PROFILING_TAG_SIZE - 1);
+        if (!write(name, sizeof(name), ctx)) {
+            return false;
+        }
+    }
+
+    // oldest record first, the ring wraps around once it is full
+    uint32_t first = head - count;
+    for (uint32_t ix = 0; ix < count; ix++) {
+        const ei_profiling_record_t *r = &ring[(first + ix) % EI_CLASSIFIER_PROFILING_RING_SIZE];
+        if (!write(r, sizeof(*r), ctx)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool dump_hex(const void *data, size_t size, void *ctx)
+{
+    size_t *column = (size_t *)ctx;
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t ix = 0; ix < size; ix++) {
+        ei_printf("%02x", bytes[ix]);
+        if (++(*column) == 32) {
+            ei_printf("\n");
+            *column = 0;
+        }
+    }
+    return true;
+}
+
+void ei_profiling_dump(void)
+{
+    size_t column = 0;
+    ei_printf("EI_PROFILING_BEGIN\n");
+    ei_profiling_export(dump_hex, &column);
+    if (column != 0) {
+        ei_printf("\n");
+    }
+    ei_printf("EI_PROFILING_END\n");
+}
+
+#endif // EI_CLASSIFIER_PROFILING == 1
@@ -0,0 +1,156 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _EI_PROFILING_H_
+#define _EI_PROFILING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+
+/**
+ * Record operator cycles, stage timings and memory use into a fixed-size ring.
+ * The ring can be exported in a binary format (see ei_profiling_header_t) to be
+ * aggregated on a host, instead of reading timings from the console.
+ */
+#ifndef EI_CLASSIFIER_PROFILING
+#define EI_CLASSIFIER_PROFILING                 0
+#endif
+
+/**
+ * Number of records kept, the oldest ones are overwritten
+ */
+#ifndef EI_CLASSIFIER_PROFILING_RING_SIZE
+#define EI_CLASSIFIER_PROFILING_RING_SIZE       256
+#endif
+
+/**
+ * Number of distinct tags (operator and stage names) which can be recorded
+ */
+#ifndef EI_CLASSIFIER_PROFILING_MAX_TAGS
+#define EI_CLASSIFIER_PROFILING_MAX_TAGS        32
+#endif
+
+#define EI_PROFILING_MAGIC                      0x52504945 // "EIPR"
+#define EI_PROFILING_VERSION                    1
+#define EI_PROFILING_TAG_SIZE                   24
+#define EI_PROFILING_NO_TAG                     0xff
+
+typedef enum {
+    EI_PROFILING_OP = 1,        // cycles of one operator, id is its index in the graph
+    EI_PROFILING_STAGE = 2,     // microseconds of a processing stage
+    EI_PROFILING_MEMORY = 3,    // bytes in use, e.g. the high-water mark of an arena
+    EI_PROFILING_TIER = 4,      // bytes of an operator's tensors in fast memory, id is its index
+} ei_profiling_kind_t;
+
+/**
+ * One record of the ring, exported as is (little-endian on all supported targets)
+ */
+typedef struct {
+    uint8_t kind;               // ei_profiling_kind_t
+    uint8_t tag;                // index into the tag table, EI_PROFILING_NO_TAG if it was full
+    uint16_t id;
+    uint32_t value;
+    uint32_t time_us;           // lower 32 bits of ei_read_timer_us() when recorded
+} ei_profiling_record_t;
+
+/**
+ * Header of the exported ring. It is followed by tag_count names of tag_size bytes
+ * (NUL padded) and record_count records, oldest first.
+ */
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t cycles_per_second; // rate of the counter used for EI_PROFILING_OP
+    uint32_t record_count;
+    uint32_t dropped;           // records overwritten before the export
+    uint16_t tag_count;
+    uint16_t tag_size;
+} ei_profiling_header_t;
+
+/**
+ * Sink of ei_profiling_export, returns false to stop the export
+ */
+typedef bool (*ei_profiling_write_fn)(const void *data, size_t size, void *ctx);
+
+#if EI_CLASSIFIER_PROFILING == 1
+
+/**
+ * @brief Add a record to the ring, safe to call from several tasks
+ * @param tag Name of the operator or stage, must stay valid (e.g. a string literal)
+ */
+void ei_profiling_record(ei_profiling_kind_t kind, const char *tag, uint16_t id, uint32_t value);
+
+/**
+ * @brief Read the counter operators are measured with (CPU cycles where available)
+ */
+uint32_t ei_profiling_cycles(void);
+
+/**
+ * @brief Drop all records, the tag table is kept
+ */
+void ei_profiling_reset(void);
+
+/**
+ * @brief Write the header, tag table and records to `write`
+ * Records made while exporting may be torn, export when nothing is being profiled.
+ */
+bool ei_profiling_export(ei_profiling_write_fn write, void *ctx);
+
+/**
+ * @brief Print the exported ring as hex lines between EI_PROFILING_BEGIN and EI_PROFILING_END
+ */
+void ei_profiling_dump(void);
+
+#else
+
+static inline void ei_profiling_record(ei_profiling_kind_t kind, const char *tag, uint16_t id, uint32_t value) { }
+static inline uint32_t ei_profiling_cycles(void) { return 0; }
+static inline void ei_profiling_reset(void) { }
+static inline bool ei_profiling_export(ei_profiling_write_fn write, void *ctx) { return false; }
+static inline void ei_profiling_dump(void) { }
+
+#endif // EI_CLASSIFIER_PROFILING == 1
+
+/**
+ * @brief Record the microseconds since start_us as a stage
+ */
+static inline void ei_profiling_record_stage(const char *tag, uint64_t start_us) {
+#if EI_CLASSIFIER_PROFILING == 1
+    ei_profiling_record(EI_PROFILING_STAGE, tag, 0, (uint32_t)(ei_read_timer_us() - start_us));
+#endif
+}
+
+#endif // _EI_PROFILING_H_
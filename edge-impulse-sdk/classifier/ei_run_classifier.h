@@ -40,6 +40,7 @@
 
 #include "ei_run_dsp.h"
 #include "ei_classifier_types.h"
+#include "ei_profiling.h"
 #include "ei_signal_with_axes.h"
 #include "postprocessing/ei_postprocessing.h"
 
@@ -385,6 +386,7 @@ extern "C" EI_IMPULSE_ERROR process_impulse(ei_impulse_handle_t *handle,
 
     result->timing.dsp_us = ei_read_timer_us() - dsp_start_us;
     result->timing.dsp = (int)(result->timing.dsp_us / 1000);
+    ei_profiling_record(EI_PROFILING_STAGE, "dsp", 0, (uint32_t)result->timing.dsp_us);
 
     if (debug) {
         ei_printf("Features (%d ms.): ", result->timing.dsp);
@@ -521,6 +523,7 @@ extern "C" EI_IMPULSE_ERROR process_impulse_continuous(ei_impulse_handle_t *hand
 
     result->timing.dsp_us = ei_read_timer_us() - dsp_start_us;
     result->timing.dsp = (int)(result->timing.dsp_us / 1000);
+    ei_profiling_record(EI_PROFILING_STAGE, "dsp", 0, (uint32_t)result->timing.dsp_us);
 
     for (int i = 0; i < impulse->label_count; i++) {
         // set label correctly in the result struct if we have no results (otherwise is nullptr)
@@ -853,6 +856,10 @@ __attribute__((unused)) void run_classifier_init(ei_impulse_handle_t *handle)
  * includes the moving average filter (MAF). This function should be called when you
  * are done running continuous classification.
  *
+ * With `EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION` enabled, this also frees the TFLite
+ * interpreter and tensor arena that are kept alive between `run_classifier()` calls,
+ * or the arena of the compiled model with `EI_CLASSIFIER_COMPILED`.
+ *
  * **Blocking**: yes
  *
  * **Example**: [ei_run_audio_impulse.cpp](https://github.com/edgeimpulse/firmware-nordic-thingy53/blob/main/src/inference/ei_run_audio_impulse.cpp)
@@ -860,11 +867,17 @@ __attribute__((unused)) void run_classifier_init(ei_impulse_handle_t *handle)
 extern "C" void run_classifier_deinit(void)
 {
     deinit_postprocessing(&ei_default_impulse);
+#if EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE
+    inference_tflite_teardown();
+#endif
 }
 
 __attribute__((unused)) void run_classifier_deinit(ei_impulse_handle_t *handle)
 {
     deinit_postprocessing(handle);
+#if EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE
+    inference_tflite_teardown();
+#endif
 }
 
 /**
@@ -1046,6 +1059,89 @@ __attribute__((unused)) EI_IMPULSE_ERROR run_classifier(
     return process_impulse(impulse, signal, result, debug);
 }
 
+#if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1 && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE)
+/**
+ * @brief Run the classifier over a raw 8-bit image buffer.
+ *
+ * Fast path for quantized image models. Instead of paging the image in through
+ * `signal_t::get_data()` as packed floats, the pixels are read straight from the
+ * buffer described by `image` and quantized into the input tensor of the model.
+ * The result is bit-identical to `run_classifier()` with a `get_data()` callback
+ * that packs every pixel as `(r << 16) + (g << 8) + b`.
+ *
+ * For grayscale models the image can have any size. It is then resized to the input size
+ * of the model (`EI_CLASSIFIER_INPUT_WIDTH` x `EI_CLASSIFIER_INPUT_HEIGHT`) in the same pass
+ * that converts and quantizes it, using `EI_CLASSIFIER_IMAGE_RESIZE_INTERPOLATION`.
+ * Other models need the image to already have the input size.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] handle Pointer to an `ei_impulse_handle_t` struct that contains the model and
+ *  preprocessing information.
+ * @param[in] image Pointer to an `image_signal_t` struct that describes the image buffer.
+ * @param[out] result  Pointer to an ei_impulse_result_t struct that will contain the various output
+ *  results from inference after `run_classifier_image()` returns.
+ * @param[in] debug Print internal preprocessing and inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. Will be `EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES`
+ *  if the impulse can not take the quantized image shortcut.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_image(
+    ei_impulse_handle_t *handle,
+    const image_signal_t *image,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    if ((handle == nullptr) || (handle->impulse == nullptr) || (result == nullptr) || (image == nullptr)) {
+        return EI_IMPULSE_INFERENCE_ERROR;
+    }
+
+    const ei_impulse_t *impulse = handle->impulse;
+
+    if (can_run_classifier_image_quantized(impulse, impulse->learning_blocks[0]) != EI_IMPULSE_OK) {
+        return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
+    }
+
+    // other sizes are resized while quantizing, which is only implemented for grayscale models
+    if (image->width != impulse->input_width || image->height != impulse->input_height) {
+        ei_dsp_config_image_t *config = (ei_dsp_config_image_t *)impulse->dsp_blocks[0].config;
+        if (strcmp(config->channels, "Grayscale") != 0) {
+            return EI_IMPULSE_INVALID_SIZE;
+        }
+    }
+
+    EI_IMPULSE_ERROR res = run_nn_inference_image_raw_quantized(impulse, image, result, impulse->learning_blocks[0].config, debug);
+    if (res != EI_IMPULSE_OK) {
+        return res;
+    }
+
+    return run_postprocessing(handle, result);
+}
+
+/**
+ * @brief Run the classifier over a raw 8-bit image buffer.
+ *
+ * Overloaded function [run_classifier_image()](#run_classifier_image-1) that defaults to the single impulse.
+ *
+ * **Blocking**: yes
+ *
+ * @param[in] image Pointer to an `image_signal_t` struct that describes the image buffer.
+ * @param[out] result  Pointer to an ei_impulse_result_t struct that will contain the various output
+ *  results from inference after `run_classifier_image()` returns.
+ * @param[in] debug Print internal preprocessing and inference debugging information via `ei_printf()`.
+ *
+ * @return Error code as defined by `EI_IMPULSE_ERROR` enum. Will be `EI_IMPULSE_OK` if inference
+ *  completed successfully.
+ */
+__attribute__((unused)) EI_IMPULSE_ERROR run_classifier_image(
+    const image_signal_t *image,
+    ei_impulse_result_t *result,
+    bool debug = false)
+{
+    return run_classifier_image(&ei_default_impulse, image, result, debug);
+}
+#endif // EI_CLASSIFIER_QUANTIZATION_ENABLED == 1 && (EI_CLASSIFIER_INFERENCING_ENGINE == EI_CLASSIFIER_TFLITE)
+
 /** @} */ // end of ei_functions Doxygen group
 
 /* Deprecated functions ------------------------------------------------------- */
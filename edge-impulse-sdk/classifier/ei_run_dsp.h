@@ -40,6 +40,7 @@
 #include "edge-impulse-sdk/dsp/speechpy/speechpy.hpp"
 #include "edge-impulse-sdk/classifier/ei_signal_with_range.h"
 #include "edge-impulse-sdk/dsp/ei_flatten.h"
+#include "edge-impulse-sdk/dsp/image/processing.hpp"
 #include "model-parameters/model_metadata.h"
 
 #if EI_CLASSIFIER_HR_ENABLED
@@ -1369,6 +1370,179 @@ __attribute__((unused)) int extract_image_features_quantized(signal_t *signal, m
     }
     return EIDSP_OK;
 }
+
+/**
+ * Same as extract_image_features_quantized, but reads the pixels straight from a raw
+ * 8-bit image buffer instead of paging them in as packed floats through signal->get_data.
+ * The output is bit-identical to packing every pixel as (r << 16) + (g << 8) + b and
+ * running extract_image_features_quantized over it.
+ */
+__attribute__((unused)) int extract_image_features_quantized_raw(const image_signal_t *image, matrix_i8_t *output_matrix, void *config_ptr, float scale, float zero_point,
+                                                                 int image_scaling) {
+    ei_dsp_config_image_t config = *((ei_dsp_config_image_t*)config_ptr);
+
+    if (image->buffer == nullptr || (image->channels != 1 && image->channels != 3)) {
+        EIDSP_ERR(EIDSP_PARAMETER_INVALID);
+    }
+
+    const bool grayscale = strcmp(config.channels, "Grayscale") == 0;
+    const size_t features_per_pixel = grayscale ? 1 : 3;
+
+    if (image->width * image->height * features_per_pixel > output_matrix->rows * output_matrix->cols) {
+        EIDSP_ERR(EIDSP_MATRIX_SIZE_MISMATCH);
+    }
+
+    const bool fast_path = scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE;
+
+    // offsets of the color channels within one pixel
+    const size_t r_ix = image->channels == 1 ? 0 : (image->bgr ? 2 : 0);
+    const size_t g_ix = image->channels == 1 ? 0 : 1;
+    const size_t b_ix = image->channels == 1 ? 0 : (image->bgr ? 0 : 2);
+
+    const int32_t iRedToGray = (int32_t)(0.299f * 65536.0f);
+    const int32_t iGreenToGray = (int32_t)(0.587f * 65536.0f);
+    const int32_t iBlueToGray = (int32_t)(0.114f * 65536.0f);
+
+    static const float torch_mean[] = { 0.485, 0.456, 0.406 };
+    static const float torch_std[] = { 0.229, 0.224, 0.225 };
+
+    int8_t *out = output_matrix->buffer;
+
+    for (size_t y = 0; y < image->height; y++) {
+        const uint8_t *row = image->buffer + y * image->stride;
+
+        if (fast_path) {
+            if (grayscale) {
+                for (size_t x = 0; x < image->width; x++, row += image->channels) {
+                    // ITU-R 601-2 luma transform
+                    // see: https://pillow.readthedocs.io/en/stable/reference/Image.html#PIL.Image.Image.convert
+                    int32_t gray = (iRedToGray * row[r_ix]) + (iGreenToGray * row[g_ix]) + (iBlueToGray * row[b_ix]);
+                    gray >>= 16; // scale down to int8_t
+                    gray -= 128;
+                    *out++ = static_cast<int8_t>(gray);
+                }
+            }
+            else {
+                for (size_t x = 0; x < image->width; x++, row += image->channels) {
+                    *out++ = static_cast<int8_t>(row[r_ix] - 128);
+                    *out++ = static_cast<int8_t>(row[g_ix] - 128);
+                    *out++ = static_cast<int8_t>(row[b_ix] - 128);
+                }
+            }
+            continue;
+        }
+
+        // slow code path, same float math as extract_image_features_quantized
+        for (size_t x = 0; x < image->width; x++, row += image->channels) {
+            float r = static_cast<float>(row[r_ix]);
+            float g = static_cast<float>(row[g_ix]);
+            float b = static_cast<float>(row[b_ix]);
+
+            if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
+                r /= 255.0f;
+                g /= 255.0f;
+                b /= 255.0f;
+            }
+            else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
+                r /= 255.0f;
+                g /= 255.0f;
+                b /= 255.0f;
+
+                r = (r - torch_mean[0]) / torch_std[0];
+                g = (g - torch_mean[1]) / torch_std[1];
+                b = (b - torch_mean[2]) / torch_std[2];
+            }
+            else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
+                r -= 128.0f;
+                g -= 128.0f;
+                b -= 128.0f;
+            }
+
+            if (grayscale) {
+                float v = (0.299f * r) + (0.587f * g) + (0.114f * b);
+                *out++ = static_cast<int8_t>(round(v / scale) + zero_point);
+            }
+            else {
+                *out++ = static_cast<int8_t>(round(r / scale) + zero_point);
+                *out++ = static_cast<int8_t>(round(g / scale) + zero_point);
+                *out++ = static_cast<int8_t>(round(b / scale) + zero_point);
+            }
+        }
+    }
+
+    return EIDSP_OK;
+}
+
+#ifndef EI_CLASSIFIER_IMAGE_RESIZE_INTERPOLATION
+// ei::image::processing::RESIZE_INTERPOLATION used by extract_image_features_quantized_resized
+#define EI_CLASSIFIER_IMAGE_RESIZE_INTERPOLATION   0 // INTERPOLATION_BILINEAR
+#endif
+
+/**
+ * Same as extract_image_features_quantized_raw, but for an image of any size. The image is
+ * resized to output_width x output_height, converted to grayscale and quantized in one pass
+ * over the source (see ei::image::processing::crop_resize_luma_quantize). To crop, point
+ * image->buffer to the top left pixel of the crop and keep the stride of the full image.
+ * Only grayscale models are supported.
+ */
+__attribute__((unused)) int extract_image_features_quantized_resized(const image_signal_t *image, size_t output_width, size_t output_height,
+                                                                     matrix_i8_t *output_matrix, void *config_ptr, float scale, float zero_point,
+                                                                     int image_scaling) {
+    using namespace ei::image::processing;
+
+    ei_dsp_config_image_t config = *((ei_dsp_config_image_t*)config_ptr);
+
+    if (image->buffer == nullptr || (image->channels != 1 && image->channels != 3)) {
+        EIDSP_ERR(EIDSP_PARAMETER_INVALID);
+    }
+
+    // with torch scaling every channel is normalized differently, so luma alone can't be quantized
+    if (strcmp(config.channels, "Grayscale") != 0 || image_scaling == EI_CLASSIFIER_IMAGE_SCALING_TORCH) {
+        EIDSP_ERR(EIDSP_NOT_SUPPORTED);
+    }
+
+    if (output_width * output_height > output_matrix->rows * output_matrix->cols) {
+        EIDSP_ERR(EIDSP_MATRIX_SIZE_MISMATCH);
+    }
+
+    // quantized value of every 8-bit luma, same math as extract_image_features_quantized
+    const bool fast_path = scale == 0.003921568859368563f && zero_point == -128 && image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE;
+    int8_t lut[256];
+    for (int luma = 0; luma < 256; luma++) {
+        if (fast_path) {
+            lut[luma] = static_cast<int8_t>(luma - 128);
+            continue;
+        }
+
+        float v = static_cast<float>(luma);
+        if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_NONE) {
+            v /= 255.0f;
+        }
+        else if (image_scaling == EI_CLASSIFIER_IMAGE_SCALING_MIN128_127) {
+            v -= 128.0f;
+        }
+        float q = round(v / scale) + zero_point;
+        lut[luma] = static_cast<int8_t>(q < -128.0f ? -128.0f : (q > 127.0f ? 127.0f : q));
+    }
+
+    const bool area = EI_CLASSIFIER_IMAGE_RESIZE_INTERPOLATION == INTERPOLATION_AREA;
+    int (*resize_fn)(const uint8_t *, int, int, int, int, int, bool, int8_t *, int, int, const int8_t *);
+    if (image->channels == 1) {
+        resize_fn = area ? crop_resize_luma_quantize<MONO_B_SIZE, INTERPOLATION_AREA>
+                         : crop_resize_luma_quantize<MONO_B_SIZE, INTERPOLATION_BILINEAR>;
+    }
+    else {
+        resize_fn = area ? crop_resize_luma_quantize<RGB888_B_SIZE, INTERPOLATION_AREA>
+                         : crop_resize_luma_quantize<RGB888_B_SIZE, INTERPOLATION_BILINEAR>;
+    }
+
+    int ret = resize_fn(image->buffer, image->stride, 0, 0, image->width, image->height, image->bgr,
+                        output_matrix->buffer, output_width, output_height, lut);
+    if (ret != EIDSP_OK) {
+        EIDSP_ERR(ret);
+    }
+    return EIDSP_OK;
+}
 #endif // (EI_CLASSIFIER_QUANTIZATION_ENABLED == 1) && (EI_CLASSIFIER_INFERENCING_ENGINE != EI_CLASSIFIER_DRPAI)
 
 /**
@@ -42,9 +42,49 @@
 #include "edge-impulse-sdk/classifier/ei_aligned_malloc.h"
 #include "edge-impulse-sdk/classifier/ei_fill_result_struct.h"
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
+#include "edge-impulse-sdk/classifier/ei_profiling.h"
 #include "edge-impulse-sdk/classifier/inferencing_engines/tflite_helper.h"
 #include "edge-impulse-sdk/classifier/ei_run_dsp.h"
 
+// When enabled, the arena of the compiled model is allocated on the first run and kept alive
+// between inferences, later runs only bind the activations to it again. Call
+// inference_tflite_teardown() (or run_classifier_deinit()) to release it.
+#ifndef EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION
+#define EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION     0
+#endif
+
+#if EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+// reset function of the model whose arena is kept alive, nullptr when there is none
+static TfLiteStatus (*ei_tflite_eon_session_reset)(void (*free)(void* ptr)) = nullptr;
+
+/**
+ * Release the arena kept alive by the persistent session.
+ * Safe to call when no session exists.
+ */
+__attribute__((unused)) static void inference_tflite_teardown(void) {
+    if (ei_tflite_eon_session_reset) {
+        ei_tflite_eon_session_reset(ei_aligned_free);
+    }
+    ei_tflite_eon_session_reset = nullptr;
+}
+#else
+__attribute__((unused)) static void inference_tflite_teardown(void) {
+}
+#endif // EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+
+/**
+ * Free the arena allocated by inference_tflite_setup once the inference is done.
+ * The arena of the persistent session is kept alive.
+ */
+static TfLiteStatus inference_tflite_release(ei_config_tflite_eon_graph_t *graph_config) {
+#if EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+    if (graph_config->model_reset == ei_tflite_eon_session_reset) {
+        return kTfLiteOk;
+    }
+#endif
+    return graph_config->model_reset(ei_aligned_free);
+}
+
 /**
  * Setup the TFLite runtime
  *
@@ -68,12 +108,23 @@ static EI_IMPULSE_ERROR inference_tflite_setup(
 
     *ctx_start_us = ei_read_timer_us();
 
+#if EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+    // a different model (or the first run) starts from scratch, the same one reuses its arena
+    if (graph_config->model_reset != ei_tflite_eon_session_reset) {
+        inference_tflite_teardown();
+    }
+#endif
+
     TfLiteStatus init_status = graph_config->model_init(ei_aligned_calloc);
     if (init_status != kTfLiteOk) {
         ei_printf("Failed to initialize the model (error code %d)\n", init_status);
         return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
     }
 
+#if EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+    ei_tflite_eon_session_reset = graph_config->model_reset;
+#endif
+
     TfLiteStatus status;
 
     status = graph_config->model_input(0, input);
@@ -124,12 +175,16 @@ static EI_IMPULSE_ERROR inference_tflite_run(
 
     ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
 
+    uint64_t invoke_start_us = ei_read_timer_us();
+
     if (graph_config->model_invoke() != kTfLiteOk) {
         return EI_IMPULSE_TFLITE_ERROR;
     }
 
     uint64_t ctx_end_us = ei_read_timer_us();
 
+    ei_profiling_record(EI_PROFILING_STAGE, "invoke", 0, (uint32_t)(ctx_end_us - invoke_start_us));
+
     result->timing.classification_us = ctx_end_us - ctx_start_us;
     result->timing.classification = (int)(result->timing.classification_us / 1000);
 
@@ -138,8 +193,10 @@ static EI_IMPULSE_ERROR inference_tflite_run(
         ei_printf("Predictions (time: %d ms.):\n", result->timing.classification);
     }
 
+    uint64_t postprocess_start_us = ei_read_timer_us();
     EI_IMPULSE_ERROR fill_res = fill_result_struct_from_output_tensor_tflite(
         impulse, block_config, output, labels_tensor, scores_tensor, result, debug);
+    ei_profiling_record_stage("postprocess", postprocess_start_us);
 
     if (fill_res != EI_IMPULSE_OK) {
         return fill_res;
@@ -202,7 +259,7 @@ EI_IMPULSE_ERROR run_nn_inference_from_dsp(
         return output_res;
     }
 
-    if (graph_config->model_reset(ei_aligned_free) != kTfLiteOk) {
+    if (inference_tflite_release(graph_config) != kTfLiteOk) {
         return EI_IMPULSE_TFLITE_ERROR;
     }
 
@@ -276,7 +333,7 @@ EI_IMPULSE_ERROR run_nn_inference(
         }
     }
 
-    graph_config->model_reset(ei_aligned_free);
+    inference_tflite_release(graph_config);
 
     if (run_res != EI_IMPULSE_OK) {
         return run_res;
@@ -287,16 +344,20 @@ EI_IMPULSE_ERROR run_nn_inference(
 
 #if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1
 /**
- * Special function to run the classifier on images, only works on TFLite models (either interpreter or EON or for tensaiflow)
- * that allocates a lot less memory by quantizing in place. This only works if 'can_run_classifier_image_quantized'
- * returns EI_IMPULSE_OK.
+ * Shared implementation of the quantized image functions below. Initializes the model,
+ * lets 'extract_fn' write the quantized features straight into the input tensor and
+ * runs the model.
+ *
+ * @param   extract_fn  Callable with signature int(ei::matrix_i8_t *features, TfLiteTensor *input),
+ *                      returns EIDSP_OK on success
  */
-EI_IMPULSE_ERROR run_nn_inference_image_quantized(
+template<typename ExtractFn>
+static EI_IMPULSE_ERROR run_nn_inference_image_quantized_common(
     const ei_impulse_t *impulse,
-    signal_t *signal,
     ei_impulse_result_t *result,
     void *config_ptr,
-    bool debug = false) {
+    bool debug,
+    ExtractFn extract_fn) {
 
     ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
     ei_config_tflite_eon_graph_t *graph_config = (ei_config_tflite_eon_graph_t*)block_config->graph_config;
@@ -324,6 +385,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
     }
 
     if (input.type != TfLiteType::kTfLiteInt8 && input.type != TfLiteType::kTfLiteUInt8) {
+        inference_tflite_release(graph_config);
         return EI_IMPULSE_ONLY_SUPPORTED_FOR_IMAGES;
     }
 
@@ -333,20 +395,21 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
     ei::matrix_i8_t features_matrix(1, impulse->nn_input_frame_size, input.data.int8);
 
     // run DSP process and quantize automatically
-    int ret = extract_image_features_quantized(signal, &features_matrix, impulse->dsp_blocks[0].config, input.params.scale, input.params.zero_point,
-        impulse->frequency, impulse->learning_blocks[0].image_scaling);
-
+    int ret = extract_fn(&features_matrix, &input);
     if (ret != EIDSP_OK) {
         ei_printf("ERR: Failed to run DSP process (%d)\n", ret);
+        inference_tflite_release(graph_config);
         return EI_IMPULSE_DSP_ERROR;
     }
 
     if (ei_run_impulse_check_canceled() == EI_IMPULSE_CANCELED) {
+        inference_tflite_release(graph_config);
         return EI_IMPULSE_CANCELED;
     }
 
     result->timing.dsp_us = ei_read_timer_us() - dsp_start_us;
     result->timing.dsp = (int)(result->timing.dsp_us / 1000);
+    ei_profiling_record(EI_PROFILING_STAGE, "dsp", 0, (uint32_t)result->timing.dsp_us);
 
     if (debug) {
         ei_printf("Features (%d ms.): ", result->timing.dsp);
@@ -370,7 +433,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
         result,
         debug);
 
-    graph_config->model_reset(ei_aligned_free);
+    inference_tflite_release(graph_config);
 
     if (run_res != EI_IMPULSE_OK) {
         return run_res;
@@ -378,6 +441,49 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
 
     return EI_IMPULSE_OK;
 }
+
+/**
+ * Special function to run the classifier on images, only works on TFLite models (either interpreter or EON or for tensaiflow)
+ * that allocates a lot less memory by quantizing in place. This only works if 'can_run_classifier_image_quantized'
+ * returns EI_IMPULSE_OK.
+ */
+EI_IMPULSE_ERROR run_nn_inference_image_quantized(
+    const ei_impulse_t *impulse,
+    signal_t *signal,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    bool debug = false) {
+
+    return run_nn_inference_image_quantized_common(impulse, result, config_ptr, debug,
+        [impulse, signal](ei::matrix_i8_t *features_matrix, TfLiteTensor *input) {
+            return extract_image_features_quantized(signal, features_matrix, impulse->dsp_blocks[0].config, input->params.scale,
+                input->params.zero_point, impulse->frequency, impulse->learning_blocks[0].image_scaling);
+        });
+}
+
+/**
+ * Same as run_nn_inference_image_quantized, but takes a raw 8-bit image buffer. The pixels are
+ * quantized straight into the input tensor, without the float get_data() round trip.
+ * This only works if 'can_run_classifier_image_quantized' returns EI_IMPULSE_OK.
+ */
+EI_IMPULSE_ERROR run_nn_inference_image_raw_quantized(
+    const ei_impulse_t *impulse,
+    const image_signal_t *image,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    bool debug = false) {
+
+    return run_nn_inference_image_quantized_common(impulse, result, config_ptr, debug,
+        [impulse, image](ei::matrix_i8_t *features_matrix, TfLiteTensor *input) {
+            if (image->width == impulse->input_width && image->height == impulse->input_height) {
+                return extract_image_features_quantized_raw(image, features_matrix, impulse->dsp_blocks[0].config, input->params.scale,
+                    input->params.zero_point, impulse->learning_blocks[0].image_scaling);
+            }
+            // resize on the fly while quantizing
+            return extract_image_features_quantized_resized(image, impulse->input_width, impulse->input_height, features_matrix,
+                impulse->dsp_blocks[0].config, input->params.scale, input->params.zero_point, impulse->learning_blocks[0].image_scaling);
+        });
+}
 #endif // EI_CLASSIFIER_QUANTIZATION_ENABLED == 1
 
 __attribute__((unused)) int extract_tflite_eon_features(signal_t *signal, matrix_t *output_matrix, void *config_ptr, const float frequency) {
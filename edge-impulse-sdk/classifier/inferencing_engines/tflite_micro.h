@@ -40,13 +40,16 @@
 #include "model-parameters/model_metadata.h"
 
 #include <cmath>
+#if !defined(EI_CLASSIFIER_HAS_TFLITE_OPS_RESOLVER) || EI_CLASSIFIER_HAS_TFLITE_OPS_RESOLVER != 1
 #include "edge-impulse-sdk/tensorflow/lite/micro/all_ops_resolver.h"
+#endif
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_interpreter.h"
 #include "edge-impulse-sdk/tensorflow/lite/schema/schema_generated.h"
 #include "edge-impulse-sdk/tensorflow/lite/schema/schema_generated_full.h"
 #include "edge-impulse-sdk/classifier/ei_aligned_malloc.h"
 #include "edge-impulse-sdk/classifier/ei_fill_result_struct.h"
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
+#include "edge-impulse-sdk/classifier/ei_profiling.h"
 #include "edge-impulse-sdk/classifier/inferencing_engines/tflite_helper.h"
 
 #if defined(EI_CLASSIFIER_HAS_TFLITE_OPS_RESOLVER) && EI_CLASSIFIER_HAS_TFLITE_OPS_RESOLVER == 1
@@ -55,6 +58,36 @@
 
 #ifdef EI_CLASSIFIER_ENABLE_PROFILER
 #include "edge-impulse-sdk/tensorflow/lite/micro/micro_profiler.h"
+#elif EI_CLASSIFIER_PROFILING == 1
+/**
+ * Records the cycles of every operator into the profiling ring (see ei_profiling.h).
+ * Operators of the models run here do not nest, so only one event is open at a time.
+ */
+class EiProfilingMicroProfiler : public tflite::MicroProfilerInterface {
+public:
+    // operators are numbered from the start of each Invoke()
+    void Reset() {
+        op_ix = 0;
+    }
+
+    uint32_t BeginEvent(const char *tag) override {
+        event_tag = tag;
+        event_start = ei_profiling_cycles();
+        return op_ix;
+    }
+
+    void EndEvent(uint32_t event_handle) override {
+        ei_profiling_record(EI_PROFILING_OP, event_tag, (uint16_t)event_handle, ei_profiling_cycles() - event_start);
+        op_ix++;
+    }
+
+private:
+    const char *event_tag = nullptr;
+    uint32_t event_start = 0;
+    uint32_t op_ix = 0;
+};
+
+static EiProfilingMicroProfiler ei_profiling_micro_profiler;
 #endif
 
 #ifdef EI_CLASSIFIER_ALLOCATION_STATIC
@@ -89,6 +122,96 @@
 #define DEFINE_SECTION(x) __attribute__((section(x)))
 #endif
 
+// When enabled, the interpreter and the tensor arena are built once and kept alive
+// between inferences, so the arena allocation, AllocateTensors() and memory planning
+// are only paid on the first run. Call inference_tflite_teardown() (or run_classifier_deinit())
+// to release them.
+#ifndef EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION
+#define EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION     0
+#endif
+
+// Size of a second, small tensor arena in fast memory. The main arena comes from ei_calloc,
+// which puts it in PSRAM on the ESP32-S3, this one is a static buffer in internal SRAM.
+// Tensors the model places there ("FastArenaAllocation" metadata, see tools/memory_plan.py)
+// and then kernel scratch buffers that fit are moved into it (MicroAllocator::SetFastArena).
+// Only one interpreter may use it at a time. 0 disables it.
+#ifndef EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE
+#define EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE        0
+#endif
+
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+alignas(16) static uint8_t ei_tflite_fast_arena[EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE];
+#endif
+
+#if EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+typedef struct {
+    const unsigned char *model;
+    uint8_t *tensor_arena;
+    tflite::MicroInterpreter *interpreter;
+    void *micro_profiler;
+} ei_tflite_session_t;
+
+static ei_tflite_session_t ei_tflite_session = { nullptr, nullptr, nullptr, nullptr };
+
+/**
+ * Release the interpreter and the tensor arena kept alive by the persistent session.
+ * Safe to call when no session exists.
+ */
+__attribute__((unused)) static void inference_tflite_teardown(void) {
+    if (ei_tflite_session.interpreter) {
+        delete ei_tflite_session.interpreter;
+    }
+#ifdef EI_CLASSIFIER_ENABLE_PROFILER
+    if (ei_tflite_session.micro_profiler) {
+        delete (tflite::MicroProfiler*)ei_tflite_session.micro_profiler;
+    }
+#endif
+#ifndef EI_CLASSIFIER_ALLOCATION_STATIC
+    if (ei_tflite_session.tensor_arena) {
+        ei_aligned_free(ei_tflite_session.tensor_arena);
+    }
+#endif
+    ei_tflite_session = { nullptr, nullptr, nullptr, nullptr };
+}
+#else
+__attribute__((unused)) static void inference_tflite_teardown(void) {
+}
+#endif // EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+
+/**
+ * Free an interpreter created by inference_tflite_setup once the inference is done.
+ * Interpreters owned by the persistent session are kept alive.
+ */
+static void inference_tflite_release(tflite::MicroInterpreter *interpreter) {
+#if EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+    if (interpreter == ei_tflite_session.interpreter) {
+        return;
+    }
+#endif
+    delete interpreter;
+}
+
+/**
+ * Look up the output tensors of an interpreter
+ */
+static void inference_tflite_get_tensors(
+    ei_learning_block_config_tflite_graph_t *block_config,
+    tflite::MicroInterpreter *interpreter,
+    TfLiteTensor** input,
+    TfLiteTensor** output,
+    TfLiteTensor** output_labels,
+    TfLiteTensor** output_scores) {
+
+    // Obtain pointers to the model's input and output tensors.
+    *input = interpreter->input(0);
+    *output = interpreter->output(block_config->output_data_tensor);
+
+    if (block_config->object_detection_last_layer == EI_CLASSIFIER_LAST_LAYER_SSD) {
+        *output_scores = interpreter->output(block_config->output_score_tensor);
+        *output_labels = interpreter->output(block_config->output_labels_tensor);
+    }
+}
+
 /**
  * Setup the TFLite runtime
  *
@@ -115,6 +238,20 @@ static EI_IMPULSE_ERROR inference_tflite_setup(
 
     ei_config_tflite_graph_t *graph_config = (ei_config_tflite_graph_t*)block_config->graph_config;
 
+#if EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+    // reuse the interpreter (and its planned arena) from the previous inference
+    if (ei_tflite_session.interpreter && ei_tflite_session.model == graph_config->model) {
+        p_tensor_arena = ei_unique_ptr_t(ei_tflite_session.tensor_arena, [](void*){});
+        *micro_interpreter = ei_tflite_session.interpreter;
+        *micro_profiler = ei_tflite_session.micro_profiler;
+        inference_tflite_get_tensors(block_config, ei_tflite_session.interpreter, input, output, output_labels, output_scores);
+        return EI_IMPULSE_OK;
+    }
+
+    // different model (or first run), start from scratch
+    inference_tflite_teardown();
+#endif
+
 #ifdef EI_CLASSIFIER_ALLOCATION_STATIC
     // Assign a no-op lambda to the "free" function in case of static arena
     static uint8_t tensor_arena[EI_CLASSIFIER_TFLITE_LARGEST_ARENA_SIZE] ALIGN(16) DEFINE_SECTION(STRINGIZE_VALUE_OF(EI_TENSOR_ARENA_LOCATION));
@@ -159,26 +296,50 @@ static EI_IMPULSE_ERROR inference_tflite_setup(
     }
 
 #ifdef EI_TFLITE_RESOLVER
-    EI_TFLITE_RESOLVER
+    // the generated resolver adds its ops every time it is expanded and
+    // MicroMutableOpResolver rejects duplicates, so only register them once
+    static const tflite::MicroOpResolver &resolver = []() -> const tflite::MicroOpResolver & {
+        EI_TFLITE_RESOLVER
+        return resolver;
+    }();
 #else
     static tflite::AllOpsResolver resolver; // needs static to match the life of the interpreter
 #endif
 
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+    // the allocator lives in the tensor arena like the one the interpreter would create
+    tflite::MicroAllocator *allocator = tflite::MicroAllocator::Create(tensor_arena, graph_config->arena_size);
+    if (allocator == nullptr) {
+        ei_printf("Failed to create the TFLite allocator (%zu bytes)\n", graph_config->arena_size);
+        return EI_IMPULSE_TFLITE_ARENA_ALLOC_FAILED;
+    }
+    allocator->SetFastArena(ei_tflite_fast_arena, sizeof(ei_tflite_fast_arena));
+#define EI_TFLITE_INTERPRETER_ARENA allocator
+#else
+#define EI_TFLITE_INTERPRETER_ARENA tensor_arena, graph_config->arena_size
+#endif
+
     // Build an interpreter to run the model with.
     // only create profiler when enabled
 #ifdef EI_CLASSIFIER_ENABLE_PROFILER
     tflite::MicroProfiler *profiler = new tflite::MicroProfiler;
 
     tflite::MicroInterpreter *interpreter = new tflite::MicroInterpreter(
-        model, resolver, tensor_arena, graph_config->arena_size, nullptr, profiler);
+        model, resolver, EI_TFLITE_INTERPRETER_ARENA, nullptr, profiler);
 
     *micro_profiler = (void*)profiler;
+#elif EI_CLASSIFIER_PROFILING == 1
+    tflite::MicroInterpreter *interpreter = new tflite::MicroInterpreter(
+        model, resolver, EI_TFLITE_INTERPRETER_ARENA, nullptr, &ei_profiling_micro_profiler);
+
+    *micro_profiler = (void*)&ei_profiling_micro_profiler;
 #else
     tflite::MicroInterpreter *interpreter = new tflite::MicroInterpreter(
-        model, resolver, tensor_arena, graph_config->arena_size, nullptr, nullptr);
+        model, resolver, EI_TFLITE_INTERPRETER_ARENA, nullptr, nullptr);
 
-    micro_profiler = nullptr;
+    *micro_profiler = nullptr;
 #endif
+#undef EI_TFLITE_INTERPRETER_ARENA
 
     *micro_interpreter = interpreter;
 
@@ -189,14 +350,24 @@ static EI_IMPULSE_ERROR inference_tflite_setup(
         return EI_IMPULSE_TFLITE_ERROR;
     }
 
-    // Obtain pointers to the model's input and output tensors.
-    *input = interpreter->input(0);
-    *output = interpreter->output(block_config->output_data_tensor);
-
-    if (block_config->object_detection_last_layer == EI_CLASSIFIER_LAST_LAYER_SSD) {
-        *output_scores = interpreter->output(block_config->output_score_tensor);
-        *output_labels = interpreter->output(block_config->output_labels_tensor);
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0 && EI_CLASSIFIER_PROFILING == 1
+    // memory tier of every operator, to split its latency by tier in tools/profile_report.py
+    for (size_t ix = 0; ix < model->subgraphs()->Get(0)->operators()->size(); ix++) {
+        ei_profiling_record(EI_PROFILING_TIER, "fast_arena", (uint16_t)ix,
+            (uint32_t)interpreter->fast_arena_operator_bytes(ix));
     }
+#endif
+
+    inference_tflite_get_tensors(block_config, interpreter, input, output, output_labels, output_scores);
+
+#if EI_CLASSIFIER_TFLITE_PERSISTENT_SESSION == 1
+    // the session takes over the arena, the caller must not free it
+    ei_tflite_session.model = graph_config->model;
+    ei_tflite_session.tensor_arena = (uint8_t*)p_tensor_arena.release();
+    ei_tflite_session.interpreter = interpreter;
+    ei_tflite_session.micro_profiler = *micro_profiler;
+    p_tensor_arena = ei_unique_ptr_t(ei_tflite_session.tensor_arena, [](void*){});
+#endif
 
     if (tflite_first_run) {
         tflite_first_run = false;
@@ -230,16 +401,27 @@ static EI_IMPULSE_ERROR inference_tflite_run(
     bool debug,
     void* micro_profiler) {
 
+#if !defined(EI_CLASSIFIER_ENABLE_PROFILER) && EI_CLASSIFIER_PROFILING == 1
+    ((EiProfilingMicroProfiler*)micro_profiler)->Reset();
+#endif
+    uint64_t invoke_start_us = ei_read_timer_us();
+
     // Run inference, and report any error
     TfLiteStatus invoke_status = interpreter->Invoke();
     if (invoke_status != kTfLiteOk) {
-        delete interpreter;
+        inference_tflite_release(interpreter);
         ei_printf("Invoke failed (%d)\n", invoke_status);
         return EI_IMPULSE_TFLITE_ERROR;
     }
 
     uint64_t ctx_end_us = ei_read_timer_us();
 
+    ei_profiling_record(EI_PROFILING_STAGE, "invoke", 0, (uint32_t)(ctx_end_us - invoke_start_us));
+    ei_profiling_record(EI_PROFILING_MEMORY, "tflite_arena", 0, (uint32_t)interpreter->arena_used_bytes());
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+    ei_profiling_record(EI_PROFILING_MEMORY, "fast_arena", 0, (uint32_t)interpreter->fast_arena_used_bytes());
+#endif
+
     result->timing.classification_us = ctx_end_us - ctx_start_us;
     result->timing.classification = (int)(result->timing.classification_us / 1000);
 
@@ -258,12 +440,17 @@ static EI_IMPULSE_ERROR inference_tflite_run(
     ei_printf("Profiling per OP group\n");
     profiler->LogTicksPerTagCsv();
     ei_printf("\n");
+
+    // a persistent profiler would otherwise keep the events of all previous runs
+    profiler->ClearEvents();
 #endif
 
+    uint64_t postprocess_start_us = ei_read_timer_us();
     EI_IMPULSE_ERROR fill_res = fill_result_struct_from_output_tensor_tflite(
         impulse, block_config, output, labels_tensor, scores_tensor, result, debug);
+    ei_profiling_record_stage("postprocess", postprocess_start_us);
 
-    delete interpreter;
+    inference_tflite_release(interpreter);
 
     if (fill_res != EI_IMPULSE_OK) {
         return fill_res;
@@ -336,7 +523,7 @@ EI_IMPULSE_ERROR run_nn_inference_from_dsp(
         return output_res;
     }
 
-    delete interpreter;
+    inference_tflite_release(interpreter);
 
     return EI_IMPULSE_OK;
 }
@@ -427,16 +614,20 @@ EI_IMPULSE_ERROR run_nn_inference(
 
 #if EI_CLASSIFIER_QUANTIZATION_ENABLED == 1
 /**
- * Special function to run the classifier on images, only works on TFLite models (either interpreter or EON or for tensaiflow)
- * that allocates a lot less memory by quantizing in place. This only works if 'can_run_classifier_image_quantized'
- * returns EI_IMPULSE_OK.
+ * Shared implementation of the quantized image functions below. Sets up the interpreter,
+ * lets 'extract_fn' write the quantized features straight into the input tensor and
+ * runs the model.
+ *
+ * @param   extract_fn  Callable with signature int(ei::matrix_i8_t *features, TfLiteTensor *input),
+ *                      returns EIDSP_OK on success
  */
-EI_IMPULSE_ERROR run_nn_inference_image_quantized(
+template<typename ExtractFn>
+static EI_IMPULSE_ERROR run_nn_inference_image_quantized_common(
     const ei_impulse_t *impulse,
-    signal_t *signal,
     ei_impulse_result_t *result,
     void *config_ptr,
-    bool debug = false)
+    bool debug,
+    ExtractFn extract_fn)
 {
     ei_learning_block_config_tflite_graph_t *block_config = (ei_learning_block_config_tflite_graph_t*)config_ptr;
 
@@ -480,8 +671,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
     ei::matrix_i8_t features_matrix(1, impulse->nn_input_frame_size, input->data.int8);
 
     // run DSP process and quantize automatically
-    int ret = extract_image_features_quantized(signal, &features_matrix, impulse->dsp_blocks[0].config, input->params.scale, input->params.zero_point,
-        impulse->frequency, impulse->learning_blocks[0].image_scaling);
+    int ret = extract_fn(&features_matrix, input);
     if (ret != EIDSP_OK) {
         ei_printf("ERR: Failed to run DSP process (%d)\n", ret);
         return EI_IMPULSE_DSP_ERROR;
@@ -493,6 +683,7 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
 
     result->timing.dsp_us = ei_read_timer_us() - dsp_start_us;
     result->timing.dsp = (int)(result->timing.dsp_us / 1000);
+    ei_profiling_record(EI_PROFILING_STAGE, "dsp", 0, (uint32_t)result->timing.dsp_us);
 
     if (debug) {
         ei_printf("Features (%d ms.): ", result->timing.dsp);
@@ -523,6 +714,49 @@ EI_IMPULSE_ERROR run_nn_inference_image_quantized(
 
     return EI_IMPULSE_OK;
 }
+
+/**
+ * Special function to run the classifier on images, only works on TFLite models (either interpreter or EON or for tensaiflow)
+ * that allocates a lot less memory by quantizing in place. This only works if 'can_run_classifier_image_quantized'
+ * returns EI_IMPULSE_OK.
+ */
+EI_IMPULSE_ERROR run_nn_inference_image_quantized(
+    const ei_impulse_t *impulse,
+    signal_t *signal,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    bool debug = false)
+{
+    return run_nn_inference_image_quantized_common(impulse, result, config_ptr, debug,
+        [impulse, signal](ei::matrix_i8_t *features_matrix, TfLiteTensor *input) {
+            return extract_image_features_quantized(signal, features_matrix, impulse->dsp_blocks[0].config, input->params.scale,
+                input->params.zero_point, impulse->frequency, impulse->learning_blocks[0].image_scaling);
+        });
+}
+
+/**
+ * Same as run_nn_inference_image_quantized, but takes a raw 8-bit image buffer. The pixels are
+ * quantized straight into the input tensor, without the float get_data() round trip.
+ * This only works if 'can_run_classifier_image_quantized' returns EI_IMPULSE_OK.
+ */
+EI_IMPULSE_ERROR run_nn_inference_image_raw_quantized(
+    const ei_impulse_t *impulse,
+    const image_signal_t *image,
+    ei_impulse_result_t *result,
+    void *config_ptr,
+    bool debug = false)
+{
+    return run_nn_inference_image_quantized_common(impulse, result, config_ptr, debug,
+        [impulse, image](ei::matrix_i8_t *features_matrix, TfLiteTensor *input) {
+            if (image->width == impulse->input_width && image->height == impulse->input_height) {
+                return extract_image_features_quantized_raw(image, features_matrix, impulse->dsp_blocks[0].config, input->params.scale,
+                    input->params.zero_point, impulse->learning_blocks[0].image_scaling);
+            }
+            // resize on the fly while quantizing
+            return extract_image_features_quantized_resized(image, impulse->input_width, impulse->input_height, features_matrix,
+                impulse->dsp_blocks[0].config, input->params.scale, input->params.zero_point, impulse->learning_blocks[0].image_scaling);
+        });
+}
 #endif // EI_CLASSIFIER_QUANTIZATION_ENABLED == 1
 
 __attribute__((unused)) int extract_tflite_features(signal_t *signal, matrix_t *output_matrix, void *config_ptr, const float frequency) {
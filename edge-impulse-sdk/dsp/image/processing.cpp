@@ -323,6 +323,223 @@ int resize_image(
     return EIDSP_OK;
 } // resizeImage()
 
+static uint32_t greatest_common_divisor(uint32_t a, uint32_t b)
+{
+    while (b != 0) {
+        uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/**
+ * @brief Sum the columns of the row accumulator into destination pixels, weighted by the covered area
+ * Source pixels are src_unit wide and destination pixels dst_box wide (in common units),
+ * so destination pixel x covers [x * dst_box, (x + 1) * dst_box)
+ * Columns fully inside a destination pixel are summed first and weighted once
+ */
+template <int PIXEL_SIZE_B>
+static void area_sum_columns(
+    const uint32_t *acc,
+    uint8_t *dst,
+    int dstWidth,
+    int pixel_size_B,
+    uint32_t src_unit,
+    uint32_t dst_box,
+    uint32_t box_area)
+{
+    // compile time pixel size lets the color loops unroll, 0 means runtime pixel_size_B
+    const int ps = PIXEL_SIZE_B ? PIXEL_SIZE_B : pixel_size_B;
+    uint32_t src_left = src_unit; // part of the current source column not used yet
+
+    for (int x = 0; x < dstWidth; x++) {
+        uint32_t box_left = dst_box;
+        uint32_t sum[4] = { 0 };
+        uint32_t full_sum[4] = { 0 };
+
+        // rest of the source column shared with the previous destination pixel
+        if (src_left != src_unit) {
+            for (int color = 0; color < ps; color++) {
+                sum[color] = acc[color] * src_left;
+            }
+            box_left -= src_left;
+            acc += ps;
+        }
+
+        // whole source columns
+        uint32_t full = box_left / src_unit;
+        for (uint32_t i = 0; i < full; i++) {
+            for (int color = 0; color < ps; color++) {
+                full_sum[color] += acc[color];
+            }
+            acc += ps;
+        }
+        box_left -= full * src_unit;
+
+        // start of the source column shared with the next destination pixel
+        // (there is none after the last one, so acc is not read past the row then)
+        for (int color = 0; color < ps; color++) {
+            sum[color] += full_sum[color] * src_unit;
+        }
+        if (box_left > 0) {
+            for (int color = 0; color < ps; color++) {
+                sum[color] += acc[color] * box_left;
+            }
+            src_left = src_unit - box_left;
+        }
+        else {
+            src_left = src_unit;
+        }
+
+        for (int color = 0; color < ps; color++) {
+            *dst++ = (uint8_t)((sum[color] + box_area / 2) / box_area);
+        }
+    }
+}
+
+int area_resize_stream_init(
+    area_resize_stream_t *stream,
+    int srcWidth,
+    int srcHeight,
+    uint8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    int pixel_size_B)
+{
+    if (srcWidth <= 0 || srcHeight <= 0 || dstWidth <= 0 || dstHeight <= 0 ||
+        pixel_size_B <= 0 || pixel_size_B > 4 || dstWidth > srcWidth || dstHeight > srcHeight) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+
+    // one source pixel is dstWidth units wide and one destination pixel srcWidth units,
+    // divided by their gcd to keep the weights and sums small
+    const uint32_t gx = greatest_common_divisor(srcWidth, dstWidth);
+    const uint32_t gy = greatest_common_divisor(srcHeight, dstHeight);
+    stream->src_unit_x = dstWidth / gx;
+    stream->dst_box_x = srcWidth / gx;
+    stream->src_unit_y = dstHeight / gy;
+    stream->dst_box_y = srcHeight / gy;
+
+    if ((uint64_t)stream->dst_box_x * stream->dst_box_y * 255 > UINT32_MAX) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+
+    stream->src_row_size = srcWidth * pixel_size_B;
+    stream->acc = (uint32_t *)ei_calloc(stream->src_row_size, sizeof(uint32_t));
+    if (!stream->acc) {
+        return EIDSP_OUT_OF_MEM;
+    }
+
+    stream->dst = dstImage;
+    stream->dst_width = dstWidth;
+    stream->dst_rows_left = dstHeight;
+    stream->pixel_size_B = pixel_size_B;
+    stream->box_left = stream->dst_box_y;
+    return EIDSP_OK;
+}
+
+int area_resize_stream_push_row(area_resize_stream_t *stream, const uint8_t *srcRow)
+{
+    if (stream->dst_rows_left == 0) {
+        return EIDSP_OUT_OF_BOUNDS;
+    }
+
+    uint32_t *acc = stream->acc;
+    const int src_row_size = stream->src_row_size;
+    const uint32_t box_area = stream->dst_box_x * stream->dst_box_y;
+    uint32_t src_left = stream->src_unit_y; // part of this source row not used yet
+
+    // the row can be split between two destination rows
+    while (src_left > 0) {
+        uint32_t w = stream->box_left < src_left ? stream->box_left : src_left;
+        for (int i = 0; i < src_row_size; i++) {
+            acc[i] += srcRow[i] * w;
+        }
+        stream->box_left -= w;
+        src_left -= w;
+
+        if (stream->box_left == 0) {
+            const int ps = stream->pixel_size_B;
+            if (ps == RGB888_B_SIZE) {
+                area_sum_columns<RGB888_B_SIZE>(acc, stream->dst, stream->dst_width, ps,
+                    stream->src_unit_x, stream->dst_box_x, box_area);
+            }
+            else if (ps == MONO_B_SIZE) {
+                area_sum_columns<MONO_B_SIZE>(acc, stream->dst, stream->dst_width, ps,
+                    stream->src_unit_x, stream->dst_box_x, box_area);
+            }
+            else {
+                area_sum_columns<0>(acc, stream->dst, stream->dst_width, ps,
+                    stream->src_unit_x, stream->dst_box_x, box_area);
+            }
+            stream->dst += stream->dst_width * ps;
+            stream->box_left = stream->dst_box_y;
+            memset(acc, 0, src_row_size * sizeof(uint32_t));
+            if (--stream->dst_rows_left == 0) {
+                break;
+            }
+        }
+    }
+    return EIDSP_OK;
+}
+
+void area_resize_stream_free(area_resize_stream_t *stream)
+{
+    ei_free(stream->acc);
+    stream->acc = nullptr;
+}
+
+int resize_image_area(
+    const uint8_t *srcImage,
+    int srcWidth,
+    int srcHeight,
+    uint8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    int pixel_size_B)
+{
+    if (srcWidth <= 0 || srcHeight <= 0 || dstWidth <= 0 || dstHeight <= 0 ||
+        pixel_size_B <= 0 || pixel_size_B > 4) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+    // averaging only makes sense for shrinking
+    if (dstWidth > srcWidth || dstHeight > srcHeight) {
+        return resize_image(srcImage, srcWidth, srcHeight, dstImage, dstWidth, dstHeight, pixel_size_B);
+    }
+
+    area_resize_stream_t stream;
+    int res = area_resize_stream_init(&stream, srcWidth, srcHeight, dstImage, dstWidth, dstHeight, pixel_size_B);
+    if (res != EIDSP_OK) {
+        return res;
+    }
+
+    // destination row y never reaches source rows still needed, so this works in place
+    const int src_row_size = srcWidth * pixel_size_B;
+    for (int sy = 0; sy < srcHeight && res == EIDSP_OK; sy++) {
+        res = area_resize_stream_push_row(&stream, &srcImage[sy * src_row_size]);
+    }
+
+    area_resize_stream_free(&stream);
+    return res;
+}
+
+static int resize_image_interpolated(
+    const uint8_t *srcImage,
+    int srcWidth,
+    int srcHeight,
+    uint8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    int pixel_size_B,
+    RESIZE_INTERPOLATION interpolation)
+{
+    if (interpolation == INTERPOLATION_AREA) {
+        return resize_image_area(srcImage, srcWidth, srcHeight, dstImage, dstWidth, dstHeight, pixel_size_B);
+    }
+    return resize_image(srcImage, srcWidth, srcHeight, dstImage, dstWidth, dstHeight, pixel_size_B);
+}
+
 /**
  * @brief Calculate new dims that match the aspect ratio of destination
  * This prevents a squashed look
@@ -361,7 +578,8 @@ int crop_and_interpolate_rgb888(
     int srcHeight,
     uint8_t *dstImage,
     int dstWidth,
-    int dstHeight)
+    int dstHeight,
+    RESIZE_INTERPOLATION interpolation)
 {
     int cropWidth, cropHeight;
     // What are dimensions that maintain aspect ratio?
@@ -381,7 +599,7 @@ int crop_and_interpolate_rgb888(
         return res;
     }
     // Finally, interpolate down to desired dimensions, in place
-    return resize_image(dstImage, cropWidth, cropHeight, dstImage, dstWidth, dstHeight, 3);
+    return resize_image_interpolated(dstImage, cropWidth, cropHeight, dstImage, dstWidth, dstHeight, 3, interpolation);
 }
 
 int crop_and_interpolate_image(
@@ -391,7 +609,8 @@ int crop_and_interpolate_image(
     uint8_t *dstImage,
     int dstWidth,
     int dstHeight,
-    int pixel_size_B)
+    int pixel_size_B,
+    RESIZE_INTERPOLATION interpolation)
 {
     int cropWidth, cropHeight;
     // What are dimensions that maintain aspect ratio?
@@ -414,7 +633,15 @@ int crop_and_interpolate_image(
     }
 
     // Finally, interpolate down to desired dimensions, in place
-    return resize_image(dstImage, cropWidth, cropHeight, dstImage, dstWidth, dstHeight, pixel_size_B);
+    return resize_image_interpolated(
+        dstImage,
+        cropWidth,
+        cropHeight,
+        dstImage,
+        dstWidth,
+        dstHeight,
+        pixel_size_B,
+        interpolation);
 }
 
 int resize_image_using_mode(
@@ -425,7 +652,8 @@ int resize_image_using_mode(
     int dstWidth,
     int dstHeight,
     int pixel_size_B,
-    int mode)
+    int mode,
+    RESIZE_INTERPOLATION interpolation)
 {
 
     if (srcWidth == dstWidth && srcHeight == dstHeight) {
@@ -448,7 +676,8 @@ int resize_image_using_mode(
             dstImage,
             dstWidth,
             dstHeight,
-            pixel_size_B);
+            pixel_size_B,
+            interpolation);
 
         if (res != 0) {
             EI_LOGE("Error in crop_and_interpolate_image: %d\n", res);
@@ -458,8 +687,15 @@ int resize_image_using_mode(
     }
 
     if (mode == EI_CLASSIFIER_RESIZE_SQUASH) {
-        int res =
-            resize_image(srcImage, srcWidth, srcHeight, dstImage, dstWidth, dstHeight, pixel_size_B);
+        int res = resize_image_interpolated(
+            srcImage,
+            srcWidth,
+            srcHeight,
+            dstImage,
+            dstWidth,
+            dstHeight,
+            pixel_size_B,
+            interpolation);
 
         if (res != 0) {
             EI_LOGE("Error in resize_image: %d\n", res);
@@ -489,14 +725,15 @@ int resize_image_using_mode(
         int startY = (dstHeight - resizeHeight) / 2;
 
         // First, resize in place.  We can't resize into the middle as this may destroy source pixels needed later
-        int res = resize_image(
+        int res = resize_image_interpolated(
             srcImage,
             srcWidth,
             srcHeight,
             dstImage,
             resizeWidth,
             resizeHeight,
-            pixel_size_B);
+            pixel_size_B,
+            interpolation);
 
         if (res != 0) {
             EI_LOGE("Error in resize_image: %d\n", res);
@@ -544,6 +781,205 @@ int resize_image_using_mode(
     // shouldn't get here
     return -2;
 }
+
+/**
+ * @brief Convert one source row of the crop to luma with 8 fractional bits
+ * (luma << 8 for mono), (luma16 >> 8) equals the integer luma of extract_image_features_quantized
+ */
+template <int CHANNELS>
+static void luma16_row(const uint8_t *src, int width, int r_ix, int g_ix, int b_ix, uint32_t *out)
+{
+    const uint32_t iRedToGray = (uint32_t)(0.299f * 65536.0f);
+    const uint32_t iGreenToGray = (uint32_t)(0.587f * 65536.0f);
+    const uint32_t iBlueToGray = (uint32_t)(0.114f * 65536.0f);
+
+    for (int x = 0; x < width; x++, src += CHANNELS) {
+        if (CHANNELS == 1) {
+            out[x] = (uint32_t)src[0] << 8;
+        }
+        else {
+            out[x] = ((iRedToGray * src[r_ix]) + (iGreenToGray * src[g_ix]) + (iBlueToGray * src[b_ix])) >> 8;
+        }
+    }
+}
+
+template <int CHANNELS, RESIZE_INTERPOLATION INTERPOLATION>
+int crop_resize_luma_quantize(
+    const uint8_t *srcImage,
+    int srcStride,
+    int cropX,
+    int cropY,
+    int cropWidth,
+    int cropHeight,
+    bool bgr,
+    int8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    const int8_t *lut)
+{
+    static_assert(CHANNELS == 1 || CHANNELS == 3, "Only mono and RGB888 sources are supported");
+
+    if (!srcImage || !dstImage || !lut || cropX < 0 || cropY < 0 ||
+        cropWidth <= 0 || cropHeight <= 0 || dstWidth <= 0 || dstHeight <= 0) {
+        return EIDSP_PARAMETER_INVALID;
+    }
+
+    const int r_ix = bgr ? 2 : 0;
+    const int b_ix = bgr ? 0 : 2;
+    const uint8_t *crop = srcImage + cropY * srcStride + cropX * CHANNELS;
+
+    if (INTERPOLATION == INTERPOLATION_AREA && dstWidth <= cropWidth && dstHeight <= cropHeight) {
+        // same box walk as resize_image_area, on one luma channel
+        const uint32_t gx = greatest_common_divisor(cropWidth, dstWidth);
+        const uint32_t gy = greatest_common_divisor(cropHeight, dstHeight);
+        const uint32_t src_unit_x = dstWidth / gx, dst_box_x = cropWidth / gx;
+        const uint32_t src_unit_y = dstHeight / gy, dst_box_y = cropHeight / gy;
+        const uint64_t box_area = (uint64_t)dst_box_x * dst_box_y;
+
+        // vertical sums of luma16 fit as long as a box is less than 65793 rows high
+        if ((uint64_t)dst_box_y * (255 << 8) > UINT32_MAX) {
+            return EIDSP_PARAMETER_INVALID;
+        }
+
+        uint32_t *luma = (uint32_t *)ei_malloc(cropWidth * sizeof(uint32_t));
+        uint32_t *acc = (uint32_t *)ei_malloc(cropWidth * sizeof(uint32_t));
+        if (!luma || !acc) {
+            ei_free(luma);
+            ei_free(acc);
+            return EIDSP_OUT_OF_MEM;
+        }
+
+        int sy = 0;
+        int luma_y = -1; // source row currently converted in luma
+        uint32_t src_left_y = src_unit_y;
+
+        for (int y = 0; y < dstHeight; y++) {
+            uint32_t box_left_y = dst_box_y;
+
+            memset(acc, 0, cropWidth * sizeof(uint32_t));
+            while (box_left_y > 0) {
+                uint32_t w = box_left_y < src_left_y ? box_left_y : src_left_y;
+                // a source row on the border of two destination rows is only converted once
+                if (luma_y != sy) {
+                    luma16_row<CHANNELS>(crop + sy * srcStride, cropWidth, r_ix, 1, b_ix, luma);
+                    luma_y = sy;
+                }
+                for (int x = 0; x < cropWidth; x++) {
+                    acc[x] += luma[x] * w;
+                }
+                box_left_y -= w;
+                src_left_y -= w;
+                if (src_left_y == 0) {
+                    sy++;
+                    src_left_y = src_unit_y;
+                }
+            }
+
+            const uint32_t *a = acc;
+            uint32_t src_left_x = src_unit_x;
+            for (int x = 0; x < dstWidth; x++) {
+                uint32_t box_left_x = dst_box_x;
+                uint64_t sum = 0;
+                uint64_t full_sum = 0;
+
+                if (src_left_x != src_unit_x) {
+                    sum = (uint64_t)*a++ * src_left_x;
+                    box_left_x -= src_left_x;
+                }
+                uint32_t full = box_left_x / src_unit_x;
+                for (uint32_t i = 0; i < full; i++) {
+                    full_sum += *a++;
+                }
+                box_left_x -= full * src_unit_x;
+                sum += full_sum * src_unit_x;
+                if (box_left_x > 0) {
+                    sum += (uint64_t)*a * box_left_x;
+                    src_left_x = src_unit_x - box_left_x;
+                }
+                else {
+                    src_left_x = src_unit_x;
+                }
+
+                uint32_t luma16 = (uint32_t)((sum + box_area / 2) / box_area);
+                *dstImage++ = lut[luma16 >> 8];
+            }
+        }
+
+        ei_free(luma);
+        ei_free(acc);
+        return EIDSP_OK;
+    }
+
+    // bilinear, same fixed point stepping as resize_image
+    constexpr int FRAC_BITS = 14;
+    constexpr int FRAC_VAL = (1 << FRAC_BITS);
+    constexpr int FRAC_MASK = (FRAC_VAL - 1);
+
+    // luma of the two source rows around the current destination row
+    uint32_t *rows = (uint32_t *)ei_malloc(2 * cropWidth * sizeof(uint32_t));
+    if (!rows) {
+        return EIDSP_OUT_OF_MEM;
+    }
+    uint32_t *top = rows;
+    uint32_t *bottom = rows + cropWidth;
+    int top_y = -1, bottom_y = -1;
+
+    const uint32_t src_x_frac = (cropWidth * FRAC_VAL) / dstWidth;
+    const uint32_t src_y_frac = (cropHeight * FRAC_VAL) / dstHeight;
+    uint32_t src_y_accum = 0;
+
+    for (int y = 0; y < dstHeight; y++) {
+        int ty = src_y_accum >> FRAC_BITS;
+        int ty1 = ty + 1 < cropHeight ? ty + 1 : cropHeight - 1;
+        uint32_t y_frac = src_y_accum & FRAC_MASK;
+        uint32_t ny_frac = FRAC_VAL - y_frac;
+        src_y_accum += src_y_frac;
+
+        // rows only move down, reuse the bottom row as the new top one when possible
+        if (top_y != ty) {
+            if (bottom_y == ty) {
+                uint32_t *t = top;
+                top = bottom;
+                bottom = t;
+                bottom_y = -1;
+            }
+            else {
+                luma16_row<CHANNELS>(crop + ty * srcStride, cropWidth, r_ix, 1, b_ix, top);
+            }
+            top_y = ty;
+        }
+        if (bottom_y != ty1) {
+            luma16_row<CHANNELS>(crop + ty1 * srcStride, cropWidth, r_ix, 1, b_ix, bottom);
+            bottom_y = ty1;
+        }
+
+        uint32_t src_x_accum = 0;
+        for (int x = 0; x < dstWidth; x++) {
+            int tx = src_x_accum >> FRAC_BITS;
+            int tx1 = tx + 1 < cropWidth ? tx + 1 : cropWidth - 1;
+            uint32_t x_frac = src_x_accum & FRAC_MASK;
+            uint32_t nx_frac = FRAC_VAL - x_frac;
+            src_x_accum += src_x_frac;
+
+            uint32_t p0 = ((top[tx] * nx_frac) + (top[tx1] * x_frac) + FRAC_VAL / 2) >> FRAC_BITS;
+            uint32_t p1 = ((bottom[tx] * nx_frac) + (bottom[tx1] * x_frac) + FRAC_VAL / 2) >> FRAC_BITS;
+            uint32_t luma16 = ((p0 * ny_frac) + (p1 * y_frac) + FRAC_VAL / 2) >> FRAC_BITS;
+            *dstImage++ = lut[luma16 >> 8];
+        }
+    }
+
+    ei_free(rows);
+    return EIDSP_OK;
+}
+
+template int crop_resize_luma_quantize<MONO_B_SIZE, INTERPOLATION_BILINEAR>(
+    const uint8_t *, int, int, int, int, int, bool, int8_t *, int, int, const int8_t *);
+template int crop_resize_luma_quantize<MONO_B_SIZE, INTERPOLATION_AREA>(
+    const uint8_t *, int, int, int, int, int, bool, int8_t *, int, int, const int8_t *);
+template int crop_resize_luma_quantize<RGB888_B_SIZE, INTERPOLATION_BILINEAR>(
+    const uint8_t *, int, int, int, int, int, bool, int8_t *, int, int, const int8_t *);
+template int crop_resize_luma_quantize<RGB888_B_SIZE, INTERPOLATION_AREA>(
+    const uint8_t *, int, int, int, int, int, bool, int8_t *, int, int, const int8_t *);
 } //namespaces
 }
 }
@@ -43,6 +43,12 @@ enum YUV_OPTIONS
     PAD_4B = 2, // pad 0x00 on the high B. ie 0x00RRGGBB
 };
 
+enum RESIZE_INTERPOLATION
+{
+    INTERPOLATION_BILINEAR = 0, // interpolate from the 2x2 neighbourhood, see resize_image
+    INTERPOLATION_AREA = 1, // average all covered source pixels, see resize_image_area
+};
+
 /**
  * @brief Convert YUV to RGB
  *
@@ -111,6 +117,7 @@ constexpr int MONO_B_SIZE = 1;
  * @brief Resize an image using interpolation
  * Can be used to resize the image smaller or larger
  * If resizing much smaller than 1/3 size, then a more rubust algorithm should average all of the pixels
+ * (see resize_image_area)
  * This algorithm uses bilinear interpolation - averages a 2x2 region to generate each new pixel
  *
  * @param srcWidth Input image width in pixels
@@ -130,6 +137,78 @@ int resize_image(
     int dstHeight,
     int pixel_size_B);
 
+/**
+ * @brief Resize an image by averaging the area each new pixel covers
+ * Every source pixel contributes, weighted by how much of it falls into the new pixel,
+ * so large downscales don't alias like with bilinear interpolation
+ * Source rows are summed horizontally into a row accumulator, which is then summed vertically
+ * Only shrinks, when either axis grows this falls back to resize_image
+ *
+ * @param srcWidth Input image width in pixels
+ * @param srcHeight Input image height in pixels
+ * @param srcImage Input buffer
+ * @param dstWidth Output image width in pixels
+ * @param dstHeight Output image height in pixels
+ * @param dstImage Output buffer, can be same as input buffer
+ * @param pixel_size_B Size of pixels in Bytes.  3 for RGB, 1 for mono
+ */
+int resize_image_area(
+    const uint8_t *srcImage,
+    int srcWidth,
+    int srcHeight,
+    uint8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    int pixel_size_B);
+
+/**
+ * @brief State of an area downscale fed one source row at a time, see area_resize_stream_init
+ */
+typedef struct area_resize_stream_t {
+    uint8_t *dst; // next destination row
+    uint32_t *acc; // source rows covered by the current destination row, summed column by column
+    int src_row_size; // source row size in Bytes
+    int dst_width;
+    int dst_rows_left;
+    int pixel_size_B;
+    uint32_t src_unit_x, dst_box_x; // pixel widths in common units
+    uint32_t src_unit_y, dst_box_y; // pixel heights in common units
+    uint32_t box_left; // part of the current destination row not covered yet
+} area_resize_stream_t;
+
+/**
+ * @brief Start an area downscale (same result as resize_image_area) where the source
+ * is not in memory as a whole, e.g. rows coming out of a decoder
+ * Only one row accumulator of srcWidth * pixel_size_B words is allocated,
+ * destination rows are written as soon as all source rows they cover were pushed
+ *
+ * @param stream State to initialize, release with area_resize_stream_free
+ * @param srcWidth Input image width in pixels
+ * @param srcHeight Input image height in pixels
+ * @param dstImage Output buffer
+ * @param dstWidth Output image width in pixels, up to srcWidth
+ * @param dstHeight Output image height in pixels, up to srcHeight
+ * @param pixel_size_B Size of pixels in Bytes.  3 for RGB, 1 for mono
+ */
+int area_resize_stream_init(
+    area_resize_stream_t *stream,
+    int srcWidth,
+    int srcHeight,
+    uint8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    int pixel_size_B);
+
+/**
+ * @brief Add the next source row of srcWidth * pixel_size_B Bytes, rows have to come in order
+ */
+int area_resize_stream_push_row(area_resize_stream_t *stream, const uint8_t *srcRow);
+
+/**
+ * @brief Free the row accumulator of the stream
+ */
+void area_resize_stream_free(area_resize_stream_t *stream);
+
 /**
  * @brief Calculate new dims that match the aspect ratio of destination
  * This prevents a squashed look
@@ -160,6 +239,7 @@ void calculate_crop_dims(
  * @param dstImage Output image buffer, can be same as input buffer
  * @param dstWidth Desired new width in pixels
  * @param dstHeight Desired new height in pixels
+ * @param interpolation Resizing algorithm
  */
 int crop_and_interpolate_rgb888(
     const uint8_t *srcImage,
@@ -167,7 +247,8 @@ int crop_and_interpolate_rgb888(
     int srcHeight,
     uint8_t *dstImage,
     int dstWidth,
-    int dstHeight);
+    int dstHeight,
+    RESIZE_INTERPOLATION interpolation = INTERPOLATION_BILINEAR);
 
 /**
  * @brief Crops, then interpolates to a desired new image size
@@ -182,6 +263,7 @@ int crop_and_interpolate_rgb888(
  * @param dstWidth Desired new width in pixels
  * @param dstHeight Desired new height in pixels
  * @param pixel_size_B Size of pixels in Bytes.  3 for RGB, 1 for mono
+ * @param interpolation Resizing algorithm
  */
 int crop_and_interpolate_image(
     const uint8_t *srcImage,
@@ -190,7 +272,8 @@ int crop_and_interpolate_image(
     uint8_t *dstImage,
     int dstWidth,
     int dstHeight,
-    int pixel_size_B);
+    int pixel_size_B,
+    RESIZE_INTERPOLATION interpolation = INTERPOLATION_BILINEAR);
 
 
 
@@ -205,6 +288,7 @@ int crop_and_interpolate_image(
  * @param dstHeight Desired new height in pixels
  * @param pixel_size_B Size of pixels in Bytes. 3 for RGB, 1 for mono
  * @param mode Resizing mode (FIT_SHORTEST=1, FIT_LONGEST=2, SQUASH=3)
+ * @param interpolation Resizing algorithm, INTERPOLATION_AREA for large downscales
  * @return int Status code (0 for success, non-zero for failure)
  */
 int resize_image_using_mode(
@@ -215,6 +299,43 @@ int resize_image_using_mode(
     int dstWidth,
     int dstHeight,
     int pixel_size_B,
-    int mode);
+    int mode,
+    RESIZE_INTERPOLATION interpolation = INTERPOLATION_BILINEAR);
+
+/**
+ * @brief Crop, resize, convert to grayscale and quantize an image in a single pass
+ * Every source pixel of the crop is read once and converted to luma (ITU-R 601-2, same
+ * weights as extract_image_features_quantized) before resizing, so only one channel is resized.
+ * Output is produced row by row, only a row accumulator (area) or two luma rows (bilinear)
+ * of cropWidth are allocated.
+ * Instantiated for CHANNELS 1 (mono) and 3 (RGB888) and both interpolations.
+ *
+ * @tparam CHANNELS Bytes per source pixel
+ * @tparam INTERPOLATION Resizing algorithm, area falls back to bilinear when upscaling
+ * @param srcImage Input image buffer
+ * @param srcStride Bytes between the starts of two source rows
+ * @param cropX Left edge of the crop in pixels
+ * @param cropY Top edge of the crop in pixels
+ * @param cropWidth Width of the crop in pixels
+ * @param cropHeight Height of the crop in pixels
+ * @param bgr Source pixels are stored as BGR instead of RGB, ignored for mono
+ * @param dstImage Output buffer, dstWidth * dstHeight values
+ * @param dstWidth Output width in pixels
+ * @param dstHeight Output height in pixels
+ * @param lut Maps the 8-bit luma to the quantized output value, 256 entries
+ */
+template <int CHANNELS, RESIZE_INTERPOLATION INTERPOLATION>
+int crop_resize_luma_quantize(
+    const uint8_t *srcImage,
+    int srcStride,
+    int cropX,
+    int cropY,
+    int cropWidth,
+    int cropHeight,
+    bool bgr,
+    int8_t *dstImage,
+    int dstWidth,
+    int dstHeight,
+    const int8_t *lut);
 }}} //namespaces
 #endif //!__EI_IMAGE_PROCESSING__H__
\ No newline at end of file
@@ -625,6 +625,43 @@ typedef struct ei_signal_t {
     size_t total_length;
 } signal_t;
 
+/**
+ * @brief Describes a raw 8-bit image buffer that is passed to the DSP without
+ *  going through the paged `get_data()` float interface.
+ *
+ *  Pixels are stored row by row, `stride` bytes apart. With `channels == 3`
+ *  every pixel is an RGB888 triplet (or BGR888 if `bgr` is set, which is what
+ *  the esp32-camera JPEG decoder produces). With `channels == 1` every pixel
+ *  is already a luma value.
+ */
+typedef struct ei_image_signal_t {
+    /**
+     * Pointer to the first pixel of the image
+     */
+    const uint8_t *buffer;
+
+    /**
+     * Width and height of the image in pixels
+     */
+    size_t width;
+    size_t height;
+
+    /**
+     * Distance between the start of two consecutive rows in bytes
+     */
+    size_t stride;
+
+    /**
+     * Number of bytes per pixel, 3 for RGB888 / BGR888 or 1 for grayscale
+     */
+    uint8_t channels;
+
+    /**
+     * Set if the byte order of a 3 channel pixel is B, G, R
+     */
+    bool bgr;
+} image_signal_t;
+
 /** @} */
 
 #ifdef __cplusplus
@@ -120,6 +120,32 @@ int esp_nn_get_depthwise_conv_scratch_size_ansi(const data_dims_t *input_dims,
                                                 const dw_conv_params_t *conv_params);
 void esp_nn_set_depthwise_conv_scratch_buf_ansi(const void *buf);
 
+/**
+ * @brief       2d-convolution channelwise with a fused elementwise addition
+ *
+ * @note        out = add(conv(input), add_data), without writing conv(input) to memory.
+ *              add_data has the dims of the output, add_params are the params of
+ *              esp_nn_add_elementwise_s8 with the convolution output as input1.
+ *              Bit exact with esp_nn_conv_s8 followed by esp_nn_add_elementwise_s8
+ */
+void esp_nn_conv_add_s8_ansi(const data_dims_t *input_dims,
+                             const int8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const int8_t *filter_data,
+                             const int32_t *bias,
+                             const data_dims_t *output_dims,
+                             int8_t *out_data,
+                             const conv_params_t *conv_params,
+                             const quant_data_t *quant_data,
+                             const int8_t *add_data,
+                             const add_params_t *add_params);
+
+int esp_nn_get_conv_add_scratch_size_ansi(const data_dims_t *input_dims,
+                                          const data_dims_t *filter_dims,
+                                          const data_dims_t *output_dims,
+                                          const conv_params_t *conv_params);
+void esp_nn_set_conv_add_scratch_buf_ansi(const void *buf);
+
 /************************** Activation functions *****************************/
 
 /**
@@ -291,6 +317,58 @@ int esp_nn_get_depthwise_conv_scratch_size_opt(const data_dims_t *input_dims,
                                                const dw_conv_params_t *conv_params);
 void esp_nn_set_depthwise_conv_scratch_buf_opt(const void *buf);
 
+/**
+ * @brief       2d-convolution channelwise with a fused elementwise addition, optimized version
+ *
+ * @note        see esp_nn_conv_add_s8_ansi
+ */
+void esp_nn_conv_add_s8_opt(const data_dims_t *input_dims,
+                            const int8_t *input_data,
+                            const data_dims_t *filter_dims,
+                            const int8_t *filter_data,
+                            const int32_t *bias,
+                            const data_dims_t *output_dims,
+                            int8_t *out_data,
+                            const conv_params_t *conv_params,
+                            const quant_data_t *quant_data,
+                            const int8_t *add_data,
+                            const add_params_t *add_params);
+
+int esp_nn_get_conv_add_scratch_size_opt(const data_dims_t *input_dims,
+                                         const data_dims_t *filter_dims,
+                                         const data_dims_t *output_dims,
+                                         const conv_params_t *conv_params);
+void esp_nn_set_conv_add_scratch_buf_opt(const void *buf);
+
+/**
+ * @brief       2d-convolution channelwise with a fused elementwise addition, for targets
+ *              with SIMD convolution kernels (esp32s3, esp32p4)
+ *
+ * @note        see esp_nn_conv_add_s8_ansi
+ *              The requantization of the SIMD kernels is not in C, so a 1x1 convolution
+ *              with stride 1 runs in bands of output pixels into the scratch buffer and
+ *              every band is added to add_data from there. Only a band of the convolution
+ *              output is written and read again, not the whole output.
+ *              Other convolutions are added in place after the whole output.
+ */
+void esp_nn_conv_add_s8_banded(const data_dims_t *input_dims,
+                               const int8_t *input_data,
+                               const data_dims_t *filter_dims,
+                               const int8_t *filter_data,
+                               const int32_t *bias,
+                               const data_dims_t *output_dims,
+                               int8_t *out_data,
+                               const conv_params_t *conv_params,
+                               const quant_data_t *quant_data,
+                               const int8_t *add_data,
+                               const add_params_t *add_params);
+
+int esp_nn_get_conv_add_scratch_size_banded(const data_dims_t *input_dims,
+                                            const data_dims_t *filter_dims,
+                                            const data_dims_t *output_dims,
+                                            const conv_params_t *conv_params);
+void esp_nn_set_conv_add_scratch_buf_banded(const void *buf);
+
 /* ANSI C function to be hooked up when optimised version needed */
 void esp_nn_set_softmax_scratch_buf_opt(void *buffer);
 
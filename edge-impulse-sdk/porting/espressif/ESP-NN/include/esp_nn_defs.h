@@ -81,3 +81,23 @@ typedef struct dw_conv_params {
     data_2d_t dilation;
     act_params_t activation;
 } dw_conv_params_t;
+
+/**
+ * @brief params of an elementwise addition fused into the output stage of a convolution
+ *
+ * @note input1 is the requantized convolution output, input2 the added (residual) data.
+ *       Same meaning as the arguments of esp_nn_add_elementwise_s8
+ */
+typedef struct add_params {
+    int32_t input1_offset;
+    int32_t input2_offset;
+    int32_t input1_mult;
+    int32_t input2_mult;
+    int32_t input1_shift;
+    int32_t input2_shift;
+    int32_t left_shift;
+    int32_t out_offset;
+    int32_t out_mult;
+    int32_t out_shift;
+    act_params_t activation;
+} add_params_t;
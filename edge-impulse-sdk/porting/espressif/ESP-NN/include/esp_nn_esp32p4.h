@@ -49,6 +49,10 @@ void esp_nn_set_conv_scratch_buf_esp32p4(const void *buf);
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_esp32p4
 
+#define esp_nn_conv_add_s8 esp_nn_conv_add_s8_banded
+#define esp_nn_get_conv_add_scratch_size esp_nn_get_conv_add_scratch_size_banded
+#define esp_nn_set_conv_add_scratch_buf esp_nn_set_conv_add_scratch_buf_banded
+
 #define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_esp32p4
 #define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_esp32p4
 
@@ -219,6 +219,10 @@ void esp_nn_relu6_s8_esp32s3(int8_t *data, uint16_t size);
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_esp32s3
 
+#define esp_nn_conv_add_s8 esp_nn_conv_add_s8_banded
+#define esp_nn_get_conv_add_scratch_size esp_nn_get_conv_add_scratch_size_banded
+#define esp_nn_set_conv_add_scratch_buf esp_nn_set_conv_add_scratch_buf_banded
+
 #define esp_nn_relu6_s8 esp_nn_relu6_s8_esp32s3
 
 #define esp_nn_avg_pool_s8 esp_nn_avg_pool_s8_esp32s3
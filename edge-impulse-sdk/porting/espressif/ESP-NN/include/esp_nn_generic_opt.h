@@ -29,6 +29,10 @@
 
 #define esp_nn_conv_s8 esp_nn_conv_s8_opt
 
+#define esp_nn_conv_add_s8 esp_nn_conv_add_s8_opt
+#define esp_nn_get_conv_add_scratch_size esp_nn_get_conv_add_scratch_size_opt
+#define esp_nn_set_conv_add_scratch_buf esp_nn_set_conv_add_scratch_buf_opt
+
 #define esp_nn_get_conv_scratch_size esp_nn_get_conv_scratch_size_opt
 #define esp_nn_set_conv_scratch_buf esp_nn_set_conv_scratch_buf_opt
 
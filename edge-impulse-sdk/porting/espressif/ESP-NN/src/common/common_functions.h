@@ -18,6 +18,8 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include <edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn_defs.h>
+
 /**
  * c99 standard still doesn't strictly inline functions
  * We need to use attribute as well to do this.
@@ -170,6 +172,29 @@ __NN_FORCE_INLINE__ int32_t esp_nn_multiply_by_quantized_mult_fast(int32_t x, in
     return result;
 }
 
+/**
+ * Output stage of esp_nn_add_elementwise_s8_ansi for one element.
+ * `in1` is the int8 convolution output still in a register, `in2` the added value.
+ */
+__NN_FORCE_INLINE__ int32_t esp_nn_requantize_add_s8(int32_t in1, int32_t in2, const add_params_t *params)
+{
+    int32_t tmp1 = (in1 + params->input1_offset) << params->left_shift;
+    int32_t tmp2 = (in2 + params->input2_offset) << params->left_shift;
+
+    tmp1 = esp_nn_sat_round_doubling_high_mul(tmp1, params->input1_mult);
+    tmp2 = esp_nn_sat_round_doubling_high_mul(tmp2, params->input2_mult);
+
+    tmp1 = esp_nn_div_by_power_of_two(tmp1, -params->input1_shift);
+    tmp2 = esp_nn_div_by_power_of_two(tmp2, -params->input2_shift);
+
+    int32_t out = tmp1 + tmp2;
+    out = esp_nn_sat_round_doubling_high_mul(out, params->out_mult);
+    out = esp_nn_div_by_power_of_two(out, -params->out_shift);
+    out = out + params->out_offset;
+
+    return max(params->activation.min, min(out, params->activation.max));
+}
+
 static void esp_nn_aligned_s8_pad_with_value(const int8_t *src, int8_t *dst,
                                              const uint16_t input_wd,
                                              const uint16_t input_ht,
@@ -0,0 +1,148 @@
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#if EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN
+// Copyright 2020-2021 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Convolution with a fused residual addition on top of the SIMD convolution kernels
+// The requantization of esp_nn_conv_s8_esp32s3 / _esp32p4 is written in assembly, so the
+// addition cannot go into it. A 1x1 convolution with stride 1 maps every output pixel to the
+// input pixel at the same position, so it runs in bands of pixels into the scratch buffer,
+// and every band is added to add_data while it is still in the cache (or the internal SRAM
+// of the scratch buffer). Only the added output reaches the arena.
+// Without the SIMD kernels (host builds) the generic ones are used, the banding is the same.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#if EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN_S3
+#include <edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn_esp32s3.h>
+#elif EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN_P4
+#include <edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn_esp32p4.h>
+#else
+#include <edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn_generic_opt.h>
+#endif
+
+#include <edge-impulse-sdk/porting/espressif/ESP-NN/src/common/common_functions.h>
+
+/* bytes of the convolution output of one band, a multiple of 16 pixels */
+#define CONV_ADD_BAND_BYTES     2048
+
+static int8_t *scratch_buffer = NULL;
+
+/* output pixels of one band, 0 when the convolution cannot run in bands */
+static int32_t conv_add_band_pixels(const data_dims_t *filter_dims,
+                                    const data_dims_t *output_dims,
+                                    const conv_params_t *conv_params)
+{
+    if (filter_dims->width != 1 || filter_dims->height != 1 ||
+            conv_params->stride.width != 1 || conv_params->stride.height != 1 ||
+            conv_params->padding.width != 0 || conv_params->padding.height != 0) {
+        return 0;
+    }
+    /* multiple of 16 pixels, so every band of the input and output stays 16 bytes aligned */
+    int32_t band = (CONV_ADD_BAND_BYTES / output_dims->channels) & ~15;
+    band = max(band, 16);
+    return min(band, output_dims->width * output_dims->height);
+}
+
+static int conv_add_band_scratch_size(const data_dims_t *input_dims,
+                                      const data_dims_t *filter_dims,
+                                      const data_dims_t *output_dims,
+                                      const conv_params_t *conv_params,
+                                      int32_t band)
+{
+    const data_dims_t band_input = { band, 1, input_dims->channels, 1 };
+    const data_dims_t band_output = { band, 1, output_dims->channels, 1 };
+    return esp_nn_get_conv_scratch_size(&band_input, filter_dims, &band_output, conv_params);
+}
+
+int esp_nn_get_conv_add_scratch_size_banded(const data_dims_t *input_dims,
+                                            const data_dims_t *filter_dims,
+                                            const data_dims_t *output_dims,
+                                            const conv_params_t *conv_params)
+{
+    const int32_t band = conv_add_band_pixels(filter_dims, output_dims, conv_params);
+    if (band == 0) {
+        return esp_nn_get_conv_scratch_size(input_dims, filter_dims, output_dims, conv_params);
+    }
+    const int conv_size = conv_add_band_scratch_size(input_dims, filter_dims, output_dims,
+                                                     conv_params, band);
+    /* the band after the scratch of the convolution, 16 bytes aligned */
+    return conv_size + 16 + band * output_dims->channels;
+}
+
+void esp_nn_set_conv_add_scratch_buf_banded(const void *buf)
+{
+    scratch_buffer = (int8_t *) buf;
+    esp_nn_set_conv_scratch_buf(buf);
+}
+
+void esp_nn_conv_add_s8_banded(const data_dims_t *input_dims,
+                               const int8_t *input_data,
+                               const data_dims_t *filter_dims,
+                               const int8_t *filter_data,
+                               const int32_t *bias,
+                               const data_dims_t *output_dims,
+                               int8_t *out_data,
+                               const conv_params_t *conv_params,
+                               const quant_data_t *quant_data,
+                               const int8_t *add_data,
+                               const add_params_t *add_params)
+{
+    const int32_t band = conv_add_band_pixels(filter_dims, output_dims, conv_params);
+    const int32_t out_channels = output_dims->channels;
+    const int32_t pixels = output_dims->width * output_dims->height;
+
+    if (band == 0) {
+        /* every output pixel depends on more input pixels, add in place after the whole output */
+        esp_nn_conv_s8(input_dims, input_data, filter_dims, filter_data, bias,
+                       output_dims, out_data, conv_params, quant_data);
+        esp_nn_add_elementwise_s8(out_data, add_data,
+                                  add_params->input1_offset, add_params->input2_offset,
+                                  add_params->input1_mult, add_params->input2_mult,
+                                  add_params->input1_shift, add_params->input2_shift,
+                                  add_params->left_shift, out_data, add_params->out_offset,
+                                  add_params->out_mult, add_params->out_shift,
+                                  add_params->activation.min, add_params->activation.max,
+                                  pixels * out_channels);
+        return;
+    }
+
+    if (scratch_buffer == NULL) {
+        printf("esp_nn_conv_add error! scratch_buffer not set!\n");
+        return;
+    }
+    const int32_t in_channels = input_dims->channels;
+    const int conv_size = conv_add_band_scratch_size(input_dims, filter_dims, output_dims,
+                                                     conv_params, band);
+    int8_t *band_out = (int8_t *) (((uintptr_t) scratch_buffer + conv_size + 15) & ~(uintptr_t) 15);
+
+    for (int32_t start = 0; start < pixels; start += band) {
+        const int32_t count = min(band, pixels - start);
+        const data_dims_t band_input = { count, 1, in_channels, 1 };
+        const data_dims_t band_output = { count, 1, out_channels, 1 };
+        esp_nn_conv_s8(&band_input, input_data + start * in_channels, filter_dims, filter_data, bias,
+                       &band_output, band_out, conv_params, quant_data);
+        esp_nn_add_elementwise_s8(band_out, add_data + start * out_channels,
+                                  add_params->input1_offset, add_params->input2_offset,
+                                  add_params->input1_mult, add_params->input2_mult,
+                                  add_params->input1_shift, add_params->input2_shift,
+                                  add_params->left_shift, out_data + start * out_channels,
+                                  add_params->out_offset, add_params->out_mult, add_params->out_shift,
+                                  add_params->activation.min, add_params->activation.max,
+                                  count * out_channels);
+    }
+}
+
+#endif // EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN
@@ -107,16 +107,21 @@ void esp_nn_conv_u8_ansi(const uint8_t *input_data,
  * Assumption 1: i/p channels == o/p channels
  * Assumption 2: Pointers are valid
  * Assumption 3: dialation width = 1
+ *
+ * With `add_data`, every requantized output is added to the element of `add_data`
+ * at the same position before it is stored (esp_nn_conv_add_s8_ansi)
  */
-void esp_nn_conv_s8_ansi(const data_dims_t *input_dims,
-                         const int8_t *input_data,
-                         const data_dims_t *filter_dims,
-                         const int8_t *filter_data,
-                         const int32_t *bias,
-                         const data_dims_t *output_dims,
-                         int8_t *out_data,
-                         const conv_params_t *conv_params,
-                         const quant_data_t *quant_data)
+__NN_FORCE_INLINE__ void esp_nn_conv_s8_ansi_common(const data_dims_t *input_dims,
+                                                    const int8_t *input_data,
+                                                    const data_dims_t *filter_dims,
+                                                    const int8_t *filter_data,
+                                                    const int32_t *bias,
+                                                    const data_dims_t *output_dims,
+                                                    int8_t *out_data,
+                                                    const conv_params_t *conv_params,
+                                                    const quant_data_t *quant_data,
+                                                    const int8_t *add_data,
+                                                    const add_params_t *add_params)
 {
     const uint16_t input_wd = input_dims->width;
     const uint16_t input_ht = input_dims->height;
@@ -174,10 +179,56 @@ void esp_nn_conv_s8_ansi(const data_dims_t *input_dims,
                 conv_out += out_offset;
                 conv_out = max(conv_out, activation_min);
                 conv_out = min(conv_out, activation_max);
+                if (add_data) {
+                    conv_out = esp_nn_requantize_add_s8(conv_out, *add_data++, add_params);
+                }
                 *out_data++ = (int8_t) conv_out;
             }
         }
     }
 }
 
+void esp_nn_conv_s8_ansi(const data_dims_t *input_dims,
+                         const int8_t *input_data,
+                         const data_dims_t *filter_dims,
+                         const int8_t *filter_data,
+                         const int32_t *bias,
+                         const data_dims_t *output_dims,
+                         int8_t *out_data,
+                         const conv_params_t *conv_params,
+                         const quant_data_t *quant_data)
+{
+    esp_nn_conv_s8_ansi_common(input_dims, input_data, filter_dims, filter_data, bias,
+                               output_dims, out_data, conv_params, quant_data, NULL, NULL);
+}
+
+int esp_nn_get_conv_add_scratch_size_ansi(const data_dims_t *input_dims,
+                                          const data_dims_t *filter_dims,
+                                          const data_dims_t *output_dims,
+                                          const conv_params_t *conv_params)
+{
+    return 0;
+}
+
+void esp_nn_set_conv_add_scratch_buf_ansi(const void *buf)
+{
+
+}
+
+void esp_nn_conv_add_s8_ansi(const data_dims_t *input_dims,
+                             const int8_t *input_data,
+                             const data_dims_t *filter_dims,
+                             const int8_t *filter_data,
+                             const int32_t *bias,
+                             const data_dims_t *output_dims,
+                             int8_t *out_data,
+                             const conv_params_t *conv_params,
+                             const quant_data_t *quant_data,
+                             const int8_t *add_data,
+                             const add_params_t *add_params)
+{
+    esp_nn_conv_s8_ansi_common(input_dims, input_data, filter_dims, filter_data, bias,
+                               output_dims, out_data, conv_params, quant_data, add_data, add_params);
+}
+
 #endif // EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN
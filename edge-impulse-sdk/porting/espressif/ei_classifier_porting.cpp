@@ -36,6 +36,7 @@
 #if EI_PORTING_ESPRESSIF == 1
 
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <cstring>
@@ -49,6 +50,7 @@
 
 // memory handling
 #include "esp_heap_caps.h"
+#include "ei_wake_arena.h"
 
 #define EI_WEAK_FN __attribute__((weak))
 
@@ -97,7 +99,7 @@ __attribute__((weak)) void ei_printf_float(float f) {
 
 // we use alligned alloc instead of regular malloc
 // due to https://github.com/espressif/esp-nn/issues/7
-__attribute__((weak)) void *ei_malloc(size_t size) {
+static void *ei_heap_malloc(size_t size) {
 #if defined(CONFIG_IDF_TARGET_ESP32S3)
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 1)
     return heap_caps_aligned_alloc(16, size, MALLOC_CAP_DEFAULT);
@@ -108,7 +110,7 @@ __attribute__((weak)) void *ei_malloc(size_t size) {
     return malloc(size);
 }
 
-__attribute__((weak)) void *ei_calloc(size_t nitems, size_t size) {
+static void *ei_heap_calloc(size_t nitems, size_t size) {
 #if defined(CONFIG_IDF_TARGET_ESP32S3)
 #if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 2, 1)
     return heap_caps_calloc(nitems, size, MALLOC_CAP_DEFAULT);
@@ -125,10 +127,142 @@ __attribute__((weak)) void *ei_calloc(size_t nitems, size_t size) {
     return calloc(nitems, size);
 }
 
+#if EI_PORTING_ESPRESSIF_WAKE_ARENA_SIZE > 0
+
+// bump allocator, everything allocated during one wake-up is released at once by ei_wake_arena_reset
+// aligned to 16 bytes like the heap allocations above
+#define EI_WAKE_ARENA_ALIGN 16
+
+// The arena is one large region, in PSRAM when the chip has it. Blocks smaller than the size
+// malloc keeps in internal RAM (CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL) stay on the heap, so the
+// row buffers of the resize and quantization and the FOMO scratch stay in internal SRAM.
+#ifndef EI_PORTING_ESPRESSIF_WAKE_ARENA_MIN_ALLOC
+#if defined(CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL)
+#define EI_PORTING_ESPRESSIF_WAKE_ARENA_MIN_ALLOC   CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL
+#else
+#define EI_PORTING_ESPRESSIF_WAKE_ARENA_MIN_ALLOC   0
+#endif
+#endif
+
+static uint8_t *wake_arena = nullptr;
+static size_t wake_arena_size = 0;
+static size_t wake_arena_used = 0;
+static size_t wake_arena_fallbacks = 0;
+static size_t wake_arena_fallback_bytes = 0;
+static bool wake_arena_failed = false;
+// ei_malloc is called from the camera task too
+static portMUX_TYPE wake_arena_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// returns nullptr if the allocation does not fit or is small, the caller falls back to the heap then
+static void *wake_arena_alloc(size_t size) {
+    if (size < EI_PORTING_ESPRESSIF_WAKE_ARENA_MIN_ALLOC) {
+        return nullptr;
+    }
+    // the region itself comes from the heap on the first allocation, not while holding the lock
+    if (wake_arena == nullptr && !wake_arena_failed) {
+        uint8_t *region = (uint8_t *)heap_caps_aligned_alloc(EI_WAKE_ARENA_ALIGN,
+            EI_PORTING_ESPRESSIF_WAKE_ARENA_SIZE, MALLOC_CAP_DEFAULT);
+        portENTER_CRITICAL(&wake_arena_lock);
+        if (wake_arena == nullptr && region != nullptr) {
+            wake_arena = region;
+            wake_arena_size = EI_PORTING_ESPRESSIF_WAKE_ARENA_SIZE;
+            region = nullptr;
+        }
+        wake_arena_failed = wake_arena == nullptr;
+        portEXIT_CRITICAL(&wake_arena_lock);
+        // another task was faster
+        if (region != nullptr) {
+            heap_caps_free(region);
+        }
+    }
+
+    void *p = nullptr;
+    size = (size + EI_WAKE_ARENA_ALIGN - 1) & ~((size_t)EI_WAKE_ARENA_ALIGN - 1);
+    portENTER_CRITICAL(&wake_arena_lock);
+    if (wake_arena != nullptr && size <= wake_arena_size - wake_arena_used) {
+        p = wake_arena + wake_arena_used;
+        wake_arena_used += size;
+    }
+    else {
+        wake_arena_fallbacks++;
+        wake_arena_fallback_bytes += size;
+    }
+    portEXIT_CRITICAL(&wake_arena_lock);
+    return p;
+}
+
+static bool wake_arena_owns(const void *ptr) {
+    return wake_arena != nullptr && (const uint8_t *)ptr >= wake_arena &&
+        (const uint8_t *)ptr < wake_arena + wake_arena_size;
+}
+
+void ei_wake_arena_stats(ei_wake_arena_stats_t *stats) {
+    portENTER_CRITICAL(&wake_arena_lock);
+    stats->size = wake_arena_size;
+    stats->used = wake_arena_used;
+    stats->heap_fallbacks = wake_arena_fallbacks;
+    stats->heap_fallback_bytes = wake_arena_fallback_bytes;
+    portEXIT_CRITICAL(&wake_arena_lock);
+}
+
+void ei_wake_arena_reset(void) {
+    portENTER_CRITICAL(&wake_arena_lock);
+    wake_arena_used = 0;
+    wake_arena_fallbacks = 0;
+    wake_arena_fallback_bytes = 0;
+    portEXIT_CRITICAL(&wake_arena_lock);
+}
+
+__attribute__((weak)) void *ei_malloc(size_t size) {
+    void *p = wake_arena_alloc(size);
+    return p != nullptr ? p : ei_heap_malloc(size);
+}
+
+__attribute__((weak)) void *ei_calloc(size_t nitems, size_t size) {
+    // like calloc, a request whose size does not fit in size_t fails
+    if (size != 0 && nitems > SIZE_MAX / size) {
+        return nullptr;
+    }
+    const size_t bytes = nitems * size;
+    void *p = wake_arena_alloc(bytes);
+    if (p == nullptr) {
+        return ei_heap_calloc(nitems, size);
+    }
+    // arena memory is reused after a reset
+    memset(p, 0, bytes);
+    return p;
+}
+
+// arena memory is only released by ei_wake_arena_reset
+__attribute__((weak)) void ei_free(void *ptr) {
+    if (!wake_arena_owns(ptr)) {
+        free(ptr);
+    }
+}
+
+#else
+
+void ei_wake_arena_stats(ei_wake_arena_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+void ei_wake_arena_reset(void) {
+}
+
+__attribute__((weak)) void *ei_malloc(size_t size) {
+    return ei_heap_malloc(size);
+}
+
+__attribute__((weak)) void *ei_calloc(size_t nitems, size_t size) {
+    return ei_heap_calloc(nitems, size);
+}
+
 __attribute__((weak)) void ei_free(void *ptr) {
     free(ptr);
 }
 
+#endif // EI_PORTING_ESPRESSIF_WAKE_ARENA_SIZE > 0
+
 #if defined(__cplusplus) && EI_C_LINKAGE == 1
 extern "C"
 #endif
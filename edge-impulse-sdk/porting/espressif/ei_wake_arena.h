@@ -0,0 +1,72 @@
+/* The Clear BSD License
+ *
+ * Copyright (c) 2025 EdgeImpulse Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted (subject to the limitations in the disclaimer
+ * below) provided that the following conditions are met:
+ *
+ *   * Redistributions of source code must retain the above copyright notice,
+ *   this list of conditions and the following disclaimer.
+ *
+ *   * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ *   * Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * NO EXPRESS OR IMPLIED LICENSES TO ANY PARTY'S PATENT RIGHTS ARE GRANTED BY
+ * THIS LICENSE. THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+ * CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+ * BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER
+ * IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _EI_WAKE_ARENA_H_
+#define _EI_WAKE_ARENA_H_
+
+#include <stddef.h>
+
+/**
+ * Size of the arena ei_malloc / ei_calloc allocate from, 0 disables it
+ * Memory is only given back all at once with ei_wake_arena_reset, e.g. before deep sleep,
+ * so anything allocated during one wake-up should fit. When the arena is full,
+ * allocations fall back to the heap.
+ * Only blocks of at least EI_PORTING_ESPRESSIF_WAKE_ARENA_MIN_ALLOC bytes (by default
+ * CONFIG_SPIRAM_MALLOC_ALWAYSINTERNAL) come from the arena, smaller ones stay on the heap
+ * in internal RAM and are freed by ei_free as before. Only ei_malloc / ei_calloc are
+ * routed here, not operator new.
+ */
+#ifndef EI_PORTING_ESPRESSIF_WAKE_ARENA_SIZE
+#define EI_PORTING_ESPRESSIF_WAKE_ARENA_SIZE    0
+#endif
+
+typedef struct {
+    size_t size;                // size of the arena, 0 if it could not be allocated
+    size_t used;                // bytes allocated since the last reset, the peak as nothing is freed
+    size_t heap_fallbacks;      // large allocations which did not fit and went to the heap
+    size_t heap_fallback_bytes;
+} ei_wake_arena_stats_t;
+
+/**
+ * @brief Get the usage of the arena since the last reset
+ */
+void ei_wake_arena_stats(ei_wake_arena_stats_t *stats);
+
+/**
+ * @brief Release everything allocated from the arena at once
+ * Nothing allocated from it before may be used afterwards
+ */
+void ei_wake_arena_reset(void);
+
+#endif // _EI_WAKE_ARENA_H_
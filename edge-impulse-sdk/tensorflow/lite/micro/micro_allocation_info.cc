@@ -28,6 +28,9 @@ namespace tflite {
 
 namespace {
 constexpr char kOfflineMemAllocMetadata[] = "OfflineMemoryAllocation";
+// Edge Impulse: tensors placed in the fast arena, written by
+// tools/memory_plan.py in the same format as kOfflineMemAllocMetadata
+constexpr char kFastArenaMetadata[] = "FastArenaAllocation";
 constexpr int kUninitializedLifetime = -1;
 }  // namespace
 
@@ -176,7 +179,8 @@ TfLiteStatus AllocationInfoBuilder::ValidateSubgraph(
 }
 
 TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
-    const int32_t* offline_offsets, SubgraphAllocations* allocations) {
+    const int32_t* offline_offsets, SubgraphAllocations* allocations,
+    const int32_t* fast_offsets) {
   AllocationInfo* allocation_info = info_.allocation_info;
   // Initialize allocation info for every tensor in every subgraph.
   for (size_t subgraph_idx = 0; subgraph_idx < model_->subgraphs()->size();
@@ -215,6 +219,11 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
       } else {
         current->offline_offset = kOnlinePlannedBuffer;
       }
+      // Edge Impulse: variables stay persistent in the main arena
+      current->fast_offset =
+          fast_offsets && !subgraph->tensors()->Get(i)->is_variable()
+              ? fast_offsets[i]
+              : kOnlinePlannedBuffer;
     }
   }
   // Initialize allocation info for every scratch buffer.
@@ -226,6 +235,7 @@ TfLiteStatus AllocationInfoBuilder::InitializeAllocationInfo(
     current->last_used = kUninitializedLifetime;
     current->needs_allocating = true;
     current->offline_offset = kOnlinePlannedBuffer;
+    current->fast_offset = kOnlinePlannedBuffer;
   }
   return kTfLiteOk;
 }
@@ -337,6 +347,16 @@ TfLiteStatus AllocationInfoBuilder::MarkAllocationLifetimes(
 // micro/docs/memory_management.md for more info.
 TfLiteStatus AllocationInfoBuilder::GetOfflinePlannedOffsets(
     const int32_t** offline_planner_offsets) {
+  return GetMetadataOffsets(kOfflineMemAllocMetadata, offline_planner_offsets);
+}
+
+TfLiteStatus AllocationInfoBuilder::GetFastArenaOffsets(
+    const int32_t** fast_arena_offsets) {
+  return GetMetadataOffsets(kFastArenaMetadata, fast_arena_offsets);
+}
+
+TfLiteStatus AllocationInfoBuilder::GetMetadataOffsets(
+    const char* name, const int32_t** offsets) {
   if (model_->metadata()) {
     for (size_t i = 0; i < model_->metadata()->size(); ++i) {
       auto metadata = model_->metadata()->Get(i);
@@ -344,10 +364,9 @@ TfLiteStatus AllocationInfoBuilder::GetOfflinePlannedOffsets(
       if (metadata->name()) {
         const size_t metadata_name_size = metadata->name()->size();
 
-        if ((strncmp(metadata->name()->c_str(), kOfflineMemAllocMetadata,
-                     std::min(metadata_name_size,
-                              strlen(kOfflineMemAllocMetadata))) == 0) &&
-            metadata_name_size == strlen(kOfflineMemAllocMetadata)) {
+        if ((strncmp(metadata->name()->c_str(), name,
+                     std::min(metadata_name_size, strlen(name))) == 0) &&
+            metadata_name_size == strlen(name)) {
           const flatbuffers::Vector<flatbuffers::Offset<Buffer>>* buffers =
               model_->buffers();
           auto* buffer = (*buffers)[metadata->buffer()];
@@ -355,8 +374,7 @@ TfLiteStatus AllocationInfoBuilder::GetOfflinePlannedOffsets(
           const uint32_t* metadata_buffer =
               reinterpret_cast<const uint32_t*>(array->data());
           const size_t nbr_tensors = static_cast<size_t>(metadata_buffer[2]);
-          *offline_planner_offsets =
-              reinterpret_cast<const int32_t*>(&metadata_buffer[3]);
+          *offsets = reinterpret_cast<const int32_t*>(&metadata_buffer[3]);
 
           if (info_.tensor_count != nbr_tensors) {
             MicroPrintf(
@@ -31,6 +31,9 @@ struct AllocationInfo {
   int first_created;
   int last_used;
   int32_t offline_offset;
+  // Edge Impulse: offset in the fast arena (see MicroAllocator::SetFastArena),
+  // kOnlinePlannedBuffer when the buffer is planned in the main arena.
+  int32_t fast_offset;
   bool needs_allocating;
 };
 
@@ -73,6 +76,10 @@ class AllocationInfoBuilder {
   TfLiteStatus GetOfflinePlannedOffsets(
       const int32_t** offline_planner_offsets);
 
+  // Edge Impulse: same as GetOfflinePlannedOffsets for the tensors placed in
+  // the fast arena, read from the "FastArenaAllocation" metadata.
+  TfLiteStatus GetFastArenaOffsets(const int32_t** fast_arena_offsets);
+
   // Allocate memory for the allocation info array as well as offsets into that
   // array for each subgraph.
   TfLiteStatus CreateAllocationInfo(int scratch_buffer_request_count);
@@ -82,7 +89,8 @@ class AllocationInfoBuilder {
 
   // Initialize AllocationInfo for all tensors and scratch buffers in the graph.
   TfLiteStatus InitializeAllocationInfo(const int32_t* offline_offsets,
-                                        SubgraphAllocations* allocations);
+                                        SubgraphAllocations* allocations,
+                                        const int32_t* fast_offsets = nullptr);
 
   // Mark the scope of each tensor and scratch buffer across the graph. Enter
   // all possible subgraphs invoked by each control flow operator. This method
@@ -108,6 +116,10 @@ class AllocationInfoBuilder {
   // Returns the number of allocations.
   int AllocationCount() const { return info_.allocation_info_count; }
 
+  // Edge Impulse: index of the first scratch buffer in the AllocationInfo
+  // array.
+  size_t ScratchOffset() const { return info_.scratch_offset; }
+
   // Returns a pointer to the built AllocationInfo array.
   AllocationInfo* Finish() const { return info_.allocation_info; }
 
@@ -124,6 +136,10 @@ class AllocationInfoBuilder {
   // count monotonically increases through the lifetime marking process.
   void UpdateLastUsed(AllocationInfo* current, int allocation_scope_count);
 
+  // Edge Impulse: offsets of the metadata buffer with the given name, shared by
+  // the offline plan and the fast arena plan.
+  TfLiteStatus GetMetadataOffsets(const char* name, const int32_t** offsets);
+
   // Validate if a subgraph satisfies assumptions.
   TfLiteStatus ValidateSubgraph(const SubGraph* subgraph,
                                 TfLiteEvalTensor* eval_tensors);
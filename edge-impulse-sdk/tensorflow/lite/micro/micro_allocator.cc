@@ -154,6 +154,38 @@ INonPersistentBufferAllocator* CreateNonPersistentArenaAllocator(
   return non_persistent_buffer_allocator;
 }
 
+// Edge Impulse: lowest offset in the fast arena where the buffer does not
+// overlap any buffer placed there before with an overlapping lifetime, -1 if
+// it does not fit.
+int32_t FirstFitInFastArena(const AllocationInfo* allocation_info,
+                            size_t allocation_info_count,
+                            const AllocationInfo* current, size_t bytes,
+                            size_t fast_arena_size) {
+  size_t offset = 0;
+  bool moved = true;
+  while (moved && offset + bytes <= fast_arena_size) {
+    moved = false;
+    for (size_t i = 0; i < allocation_info_count; ++i) {
+      const AllocationInfo* placed = &allocation_info[i];
+      if (placed == current || placed->fast_offset == kOnlinePlannedBuffer ||
+          placed->first_created > current->last_used ||
+          current->first_created > placed->last_used) {
+        continue;
+      }
+      const size_t placed_offset = placed->fast_offset;
+      const size_t placed_end =
+          placed_offset +
+          AlignSizeUp(placed->bytes, MicroArenaBufferAlignment());
+      if (offset < placed_end && placed_offset < offset + bytes) {
+        offset = placed_end;
+        moved = true;
+      }
+    }
+  }
+  return offset + bytes <= fast_arena_size ? static_cast<int32_t>(offset)
+                                           : kOnlinePlannedBuffer;
+}
+
 }  // namespace
 
 namespace internal {
@@ -818,6 +850,12 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
   TF_LITE_ENSURE_STATUS(
       builder.GetOfflinePlannedOffsets(&offline_planner_offsets));
 
+  // Edge Impulse: tensors the model places in the fast arena
+  const int32_t* fast_arena_offsets = nullptr;
+  if (fast_arena_ != nullptr) {
+    TF_LITE_ENSURE_STATUS(builder.GetFastArenaOffsets(&fast_arena_offsets));
+  }
+
   // We allocate buffers for variable tensors here since the offline planner
   // offsets are conviently available here.
   for (size_t subgraph_idx = 0; subgraph_idx < model->subgraphs()->size();
@@ -828,8 +866,8 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
         subgraph, allocations[subgraph_idx].tensors, offline_planner_offsets));
   }
 
-  TF_LITE_ENSURE_STATUS(
-      builder.InitializeAllocationInfo(offline_planner_offsets, allocations));
+  TF_LITE_ENSURE_STATUS(builder.InitializeAllocationInfo(
+      offline_planner_offsets, allocations, fast_arena_offsets));
 
   internal::ScratchBufferRequest* scratch_buffer_requests =
       GetScratchBufferRequests();
@@ -838,6 +876,10 @@ TfLiteStatus MicroAllocator::CommitStaticMemoryPlan(
   int allocation_info_count = builder.AllocationCount();
   AllocationInfo* allocation_info = builder.Finish();
 
+  // Edge Impulse: buffers in the fast arena are not planned in the main arena
+  TF_LITE_ENSURE_STATUS(PlaceInFastArena(
+      allocation_info, allocation_info_count, builder.ScratchOffset()));
+
   // Remaining arena size that memory planner can use for calculating offsets.
   size_t remaining_arena_size =
       non_persistent_buffer_allocator_->GetAvailableMemory(
@@ -938,4 +980,55 @@ TfLiteBridgeBuiltinDataAllocator* MicroAllocator::GetBuiltinDataAllocator() {
   return builtin_data_allocator_;
 }
 
+void MicroAllocator::SetFastArena(uint8_t* fast_arena,
+                                  size_t fast_arena_size) {
+  fast_arena_ = fast_arena;
+  fast_arena_size_ = fast_arena != nullptr ? fast_arena_size : 0;
+  fast_arena_used_ = 0;
+}
+
+bool MicroAllocator::IsInFastArena(const void* ptr) const {
+  const uint8_t* p = static_cast<const uint8_t*>(ptr);
+  return fast_arena_ != nullptr && p >= fast_arena_ &&
+         p < fast_arena_ + fast_arena_size_;
+}
+
+TfLiteStatus MicroAllocator::PlaceInFastArena(AllocationInfo* allocation_info,
+                                              size_t allocation_info_count,
+                                              size_t scratch_offset) {
+  // Tensors at the offsets from the model first, then the scratch buffers,
+  // which kernels read many times per invocation (im2col, transposed filters),
+  // first fit into the gaps left.
+  for (size_t i = 0; i < allocation_info_count; ++i) {
+    AllocationInfo* current = &allocation_info[i];
+    int32_t offset = current->fast_offset;
+    current->fast_offset = kOnlinePlannedBuffer;
+    if (fast_arena_ == nullptr || !current->needs_allocating) {
+      continue;
+    }
+
+    const size_t bytes =
+        AlignSizeUp(current->bytes, MicroArenaBufferAlignment());
+    if (i >= scratch_offset) {
+      offset = FirstFitInFastArena(allocation_info, allocation_info_count,
+                                   current, bytes, fast_arena_size_);
+    } else if (offset != kOnlinePlannedBuffer &&
+               static_cast<size_t>(offset) + bytes > fast_arena_size_) {
+      // planned for a larger fast arena
+      offset = kOnlinePlannedBuffer;
+    }
+    if (offset == kOnlinePlannedBuffer) {
+      continue;
+    }
+
+    current->fast_offset = offset;
+    current->needs_allocating = false;
+    *current->output_ptr = fast_arena_ + offset;
+    if (fast_arena_used_ < offset + bytes) {
+      fast_arena_used_ = offset + bytes;
+    }
+  }
+  return kTfLiteOk;
+}
+
 }  // namespace tflite
@@ -28,6 +28,8 @@ limitations under the License.
 
 namespace tflite {
 
+struct AllocationInfo;
+
 // TODO(b/199402574): rename to tflite_internal or just remove internal
 // namespace.
 namespace internal {
@@ -228,6 +230,21 @@ class MicroAllocator {
 
   TfLiteBridgeBuiltinDataAllocator* GetBuiltinDataAllocator();
 
+  // Edge Impulse: second arena in faster memory, e.g. internal SRAM when the
+  // tensor arena is in PSRAM. Tensors with an offset in the
+  // "FastArenaAllocation" metadata are placed there, then scratch buffers
+  // first fit into the space left, everything else stays in the tensor arena.
+  // Must be set before the model is allocated, the arena must be 16 bytes
+  // aligned.
+  void SetFastArena(uint8_t* fast_arena, size_t fast_arena_size);
+
+  // Edge Impulse: high-water mark of the fast arena, including scratch
+  // buffers.
+  size_t fast_arena_used_bytes() const { return fast_arena_used_; }
+
+  // Edge Impulse: true if the buffer was placed in the fast arena.
+  bool IsInFastArena(const void* ptr) const;
+
  protected:
   MicroAllocator(SingleArenaBufferAllocator* memory_allocator,
                  MicroMemoryPlanner* memory_planner);
@@ -295,6 +312,12 @@ class MicroAllocator {
   // the head section.
   internal::ScratchBufferRequest* GetScratchBufferRequests();
 
+  // Edge Impulse: moves the buffers that fit into the fast arena and clears
+  // their needs_allocating flag, so the memory planner skips them.
+  TfLiteStatus PlaceInFastArena(AllocationInfo* allocation_info,
+                                size_t allocation_info_count,
+                                size_t scratch_offset);
+
   // A simple memory allocator that always allocate from the arena tail or head.
   INonPersistentBufferAllocator* non_persistent_buffer_allocator_;
   IPersistentBufferAllocator* persistent_buffer_allocator_;
@@ -318,6 +341,11 @@ class MicroAllocator {
   // to ensure that multi-tenant allocations can share the head for buffers.
   size_t max_head_buffer_usage_ = 0;
 
+  // Edge Impulse: see SetFastArena.
+  uint8_t* fast_arena_ = nullptr;
+  size_t fast_arena_size_ = 0;
+  size_t fast_arena_used_ = 0;
+
   TF_LITE_REMOVE_VIRTUAL_DELETE
 };
 
@@ -172,7 +172,9 @@ TfLiteStatus MicroGraph::InvokeSubgraph(int subgraph_idx) {
 // This ifdef is needed (even though ScopedMicroProfiler itself is a no-op with
 // -DTF_LITE_STRIP_ERROR_STRINGS) because the function OpNameFromRegistration is
 // only defined for builds with the error strings.
-#if !defined(TF_LITE_STRIP_ERROR_STRINGS)
+// Edge Impulse: error strings are always stripped (see micro_log.h), keep the
+// operator names when the profiling ring is enabled.
+#if !defined(TF_LITE_STRIP_ERROR_STRINGS) || EI_CLASSIFIER_PROFILING == 1
     ScopedMicroProfiler scoped_profiler(
         OpNameFromRegistration(registration),
         reinterpret_cast<MicroProfilerInterface*>(context_->profiler));
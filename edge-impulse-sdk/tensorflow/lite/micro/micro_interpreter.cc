@@ -339,6 +339,30 @@ TfLiteStatus MicroInterpreter::Reset() {
   return graph_.ResetVariableTensors();
 }
 
+size_t MicroInterpreter::fast_arena_operator_bytes(size_t node_index,
+                                                  size_t subgraph_idx) {
+  const SubgraphAllocations& allocations =
+      graph_.GetAllocations()[subgraph_idx];
+  const TfLiteNode& node = allocations.node_and_registrations[node_index].node;
+  const TfLiteIntArray* tensor_lists[] = {node.inputs, node.outputs};
+  size_t bytes = 0;
+  for (const TfLiteIntArray* tensors : tensor_lists) {
+    for (int i = 0; tensors != nullptr && i < tensors->size; ++i) {
+      // optional inputs are -1
+      if (tensors->data[i] < 0) {
+        continue;
+      }
+      const TfLiteEvalTensor* tensor = &allocations.tensors[tensors->data[i]];
+      size_t tensor_bytes = 0;
+      if (allocator_.IsInFastArena(tensor->data.data) &&
+          TfLiteEvalTensorByteLength(tensor, &tensor_bytes) == kTfLiteOk) {
+        bytes += tensor_bytes;
+      }
+    }
+  }
+  return bytes;
+}
+
 TfLiteStatus MicroInterpreter::SetMicroExternalContext(
     void* external_context_payload) {
   return micro_context_.set_external_context(external_context_payload);
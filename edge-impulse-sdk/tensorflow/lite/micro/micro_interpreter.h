@@ -164,6 +164,16 @@ class MicroInterpreter {
   // arena_used_bytes() + 16.
   size_t arena_used_bytes() const { return allocator_.used_bytes(); }
 
+  // Edge Impulse: high-water mark of the fast arena, see
+  // MicroAllocator::SetFastArena.
+  size_t fast_arena_used_bytes() const {
+    return allocator_.fast_arena_used_bytes();
+  }
+
+  // Edge Impulse: bytes of the inputs and outputs of an operator that were
+  // placed in the fast arena, to report operator latency per memory tier.
+  size_t fast_arena_operator_bytes(size_t node_index, size_t subgraph_idx = 0);
+
  protected:
   const MicroAllocator& allocator() const { return allocator_; }
   const TfLiteContext& context() const { return context_; }
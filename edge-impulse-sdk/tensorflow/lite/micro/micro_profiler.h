@@ -90,7 +90,9 @@ class MicroProfiler : public MicroProfilerInterface {
   TF_LITE_REMOVE_VIRTUAL_DELETE;
 };
 
-#if defined(TF_LITE_STRIP_ERROR_STRINGS)
+// Edge Impulse: error strings are always stripped (see micro_log.h), the
+// profiler is kept when the profiling ring is enabled (see ei_profiling.h).
+#if defined(TF_LITE_STRIP_ERROR_STRINGS) && EI_CLASSIFIER_PROFILING != 1
 // For release builds, the ScopedMicroProfiler is a noop.
 //
 // This is done because the ScipedProfiler is used as part of the
@@ -133,7 +135,7 @@ class ScopedMicroProfiler {
   uint32_t event_handle_ = 0;
   MicroProfilerInterface* profiler_ = nullptr;
 };
-#endif  // !defined(TF_LITE_STRIP_ERROR_STRINGS)
+#endif  // !defined(TF_LITE_STRIP_ERROR_STRINGS) || EI_CLASSIFIER_PROFILING == 1
 
 }  // namespace tflite
 
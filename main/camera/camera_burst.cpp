@@ -0,0 +1,161 @@
+//author: Stepan Vondracek (xvondr27) 
+#include "photo_trap_camera.hpp"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+static camera_frame_t burst_frames[CAMERA_BURST_SLOTS];
+// frames which can be captured into
+static QueueHandle_t burst_free_queue = NULL;
+// captured frames waiting for inference, nullptr marks the end of the burst
+static QueueHandle_t burst_ready_queue = NULL;
+// given by the capture task when it is done
+static SemaphoreHandle_t burst_done_sem = NULL;
+
+static uint32_t burst_img_width = 0;
+static uint32_t burst_img_height = 0;
+static size_t burst_frame_count = 0;
+static bool burst_finished = true;
+
+// free all buffers and queues of the burst
+static void free_burst(void)
+{
+    for (int i = 0; i < CAMERA_BURST_SLOTS; i++)
+    {
+        ei_free(burst_frames[i].detection);
+        burst_frames[i] = {};
+    }
+    if (burst_free_queue != NULL)
+    {
+        vQueueDelete(burst_free_queue);
+        burst_free_queue = NULL;
+    }
+    if (burst_ready_queue != NULL)
+    {
+        vQueueDelete(burst_ready_queue);
+        burst_ready_queue = NULL;
+    }
+    if (burst_done_sem != NULL)
+    {
+        vSemaphoreDelete(burst_done_sem);
+        burst_done_sem = NULL;
+    }
+}
+
+// capture frames of the burst one by one as the main task releases them
+static void camera_burst_task(void *arg)
+{
+    for (size_t i = 0; i < burst_frame_count; i++)
+    {
+        camera_frame_t *frame;
+        xQueueReceive(burst_free_queue, &frame, portMAX_DELAY);
+
+        frame->captured = camera_capture_frame(burst_img_width, burst_img_height, frame);
+        xQueueSend(burst_ready_queue, &frame, portMAX_DELAY);
+    }
+
+    camera_frame_t *end = nullptr;
+    xQueueSend(burst_ready_queue, &end, portMAX_DELAY);
+    xSemaphoreGive(burst_done_sem);
+    vTaskDelete(NULL);
+}
+
+bool camera_burst_start(uint32_t img_width, uint32_t img_height, size_t frame_count)
+{
+    if (image_buffer == nullptr)
+    {
+        printf("ERR: image buffers are not allocated\r\n");
+        return false;
+    }
+
+    burst_img_width = img_width;
+    burst_img_height = img_height;
+    burst_frame_count = frame_count;
+
+    burst_free_queue = xQueueCreate(CAMERA_BURST_SLOTS, sizeof(camera_frame_t *));
+    burst_ready_queue = xQueueCreate(CAMERA_BURST_SLOTS + 1, sizeof(camera_frame_t *));
+    burst_done_sem = xSemaphoreCreateBinary();
+    if (burst_free_queue == NULL || burst_ready_queue == NULL || burst_done_sem == NULL)
+    {
+        printf("ERR: Failed to create burst queues\r\n");
+        free_burst();
+        return false;
+    }
+
+    for (int i = 0; i < CAMERA_BURST_SLOTS; i++)
+    {
+        // frames are not copied out of the camera frame buffers, only the decoded image needs a buffer
+        camera_frame_t *frame = &burst_frames[i];
+        if (CAMERA_FRAME_DETECTION_BUFFER_SIZE > 0)
+        {
+            frame->detection = (uint8_t *)ei_malloc(CAMERA_FRAME_DETECTION_BUFFER_SIZE);
+        }
+        if (CAMERA_FRAME_DETECTION_BUFFER_SIZE > 0 && frame->detection == nullptr)
+        {
+            printf("ERR: Failed to allocate burst buffers\r\n");
+            free_burst();
+            return false;
+        }
+        xQueueSend(burst_free_queue, &frame, 0);
+    }
+
+    burst_finished = false;
+    // main task runs on core 0, capture on the other core if there is one
+    if (xTaskCreatePinnedToCore(camera_burst_task, "camera_burst_task", 4096 * 2, NULL, 5, NULL,
+                                portNUM_PROCESSORS - 1) != pdPASS)
+    {
+        printf("ERR: Failed to start burst task\r\n");
+        burst_finished = true;
+        free_burst();
+        return false;
+    }
+    return true;
+}
+
+camera_frame_t *camera_burst_next(void)
+{
+    if (burst_finished)
+    {
+        return nullptr;
+    }
+
+    camera_frame_t *frame;
+    xQueueReceive(burst_ready_queue, &frame, portMAX_DELAY);
+    if (frame == nullptr)
+    {
+        burst_finished = true;
+    }
+    return frame;
+}
+
+void camera_burst_release(camera_frame_t *frame)
+{
+    if (frame->fb != nullptr)
+    {
+        camera_fb_release(frame->fb);
+        frame->fb = nullptr;
+    }
+    xQueueSend(burst_free_queue, &frame, portMAX_DELAY);
+}
+
+void camera_burst_keep(camera_frame_t *frame)
+{
+    camera_fb_keep(frame->fb);
+}
+
+void camera_burst_stop(void)
+{
+    // let the task capture the remaining frames so it can finish
+    camera_frame_t *frame;
+    while ((frame = camera_burst_next()) != nullptr)
+    {
+        camera_burst_release(frame);
+    }
+    if (burst_done_sem != NULL)
+    {
+        xSemaphoreTake(burst_done_sem, portMAX_DELAY);
+    }
+    free_burst();
+    camera_fb_store_kept();
+}
@@ -1,11 +1,30 @@
 //author: Stepan Vondracek (xvondr27) 
 #include "photo_trap_camera.hpp"
+#include "freertos/FreeRTOS.h"
+#if defined(CONFIG_IDF_TARGET_ESP32P4)
+#include "esp_heap_caps.h"
+#include "esp_cache.h"
+#endif
 
 bool is_camera_buffer_allocated = false;
 uint8_t *image_buffer = NULL; 
 uint8_t *image_detection_buffer = NULL; // Buffer for the image data used for inference
 size_t image_buffer_size = 0;
 
+// image_buffer is from the wake arena (see ei_malloc), except on P4 where the camera driver can own it
+static void free_image_buffer(void)
+{
+    if (image_buffer == NULL) {
+        return;
+    }
+#if defined(CONFIG_IDF_TARGET_ESP32P4)
+    free(image_buffer);
+#else
+    ei_free(image_buffer);
+#endif
+    image_buffer = NULL;
+}
+
 bool allocate_image_buffers(void)
 {
     if (is_camera_buffer_allocated) {
@@ -13,18 +32,26 @@ bool allocate_image_buffers(void)
     }
 
     // Allocate the image buffer
-    image_buffer = (uint8_t *)malloc(CAMERA_RAW_FRAME_BUFFER_COLS * CAMERA_RAW_FRAME_BUFFER_ROWS * CAMERA_FRAME_BYTE_SIZE);
+#if defined(CONFIG_IDF_TARGET_ESP32P4)
+    // it is exchanged with camera frame buffers (see camera_fb_keep), so it is allocated the same way
+    size_t cache_line_size;
+    if (esp_cache_get_alignment(MALLOC_CAP_SPIRAM | MALLOC_CAP_DMA, &cache_line_size) != ESP_OK) {
+        return false;
+    }
+    image_buffer = (uint8_t *)heap_caps_aligned_alloc(cache_line_size, CAMERA_RAW_IMAGE_BUFFER_SIZE, MALLOC_CAP_SPIRAM);
+#else
+    image_buffer = (uint8_t *)ei_malloc(CAMERA_RAW_IMAGE_BUFFER_SIZE);
+#endif
     
     if (image_buffer == NULL) {
         ei_printf("Failed to allocate image buffer\n");
         return false;
     }
     
-    image_detection_buffer = (uint8_t *)malloc(CAMERA_RAW_FRAME_BUFFER_COLS * CAMERA_RAW_FRAME_BUFFER_ROWS * CAMERA_FRAME_BYTE_SIZE);;
+    image_detection_buffer = (uint8_t *)ei_malloc(CAMERA_DETECTION_BUFFER_SIZE);
     if (image_detection_buffer == NULL) {
         ei_printf("Failed to allocate image inference buffer\n");
-        free(image_buffer);
-        image_buffer = NULL;
+        free_image_buffer();
         return false;
     }
 
@@ -37,15 +64,97 @@ void free_image_buffers(void)
     if (!is_camera_buffer_allocated) {
         return;
     }
-    if (image_buffer != NULL) {
-        free(image_buffer);
-        image_buffer = NULL;
-    }
+    free_image_buffer();
 
     if (image_detection_buffer != NULL) {
-        free(image_detection_buffer);
+        ei_free(image_detection_buffer);
         image_detection_buffer = NULL;
     }
 
     is_camera_buffer_allocated = false;
-}
\ No newline at end of file
+}
+
+// frame buffers of the driver, a free one has refs == 0
+static camera_fb_ref_t camera_fb_refs[CAMERA_FB_COUNT];
+static portMUX_TYPE camera_fb_lock = portMUX_INITIALIZER_UNLOCKED;
+
+camera_fb_ref_t *camera_fb_acquire(void)
+{
+    camera_fb_ref_t *ref = nullptr;
+
+    portENTER_CRITICAL(&camera_fb_lock);
+    for (int i = 0; i < CAMERA_FB_COUNT; i++)
+    {
+        if (camera_fb_refs[i].refs == 0)
+        {
+            ref = &camera_fb_refs[i];
+            ref->refs = 1;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&camera_fb_lock);
+
+    if (ref == nullptr)
+    {
+        printf("ERR: All camera frame buffers are in use\r\n");
+        return nullptr;
+    }
+
+    // waiting for the frame is done outside of the lock, the slot is already taken
+    uint64_t capture_start_us = ei_read_timer_us();
+    if (!camera_driver_fb_get(ref))
+    {
+        portENTER_CRITICAL(&camera_fb_lock);
+        ref->refs = 0;
+        portEXIT_CRITICAL(&camera_fb_lock);
+        return nullptr;
+    }
+    ei_profiling_record_stage("capture", capture_start_us);
+    return ref;
+}
+
+void camera_fb_hold(camera_fb_ref_t *ref)
+{
+    portENTER_CRITICAL(&camera_fb_lock);
+    ref->refs++;
+    portEXIT_CRITICAL(&camera_fb_lock);
+}
+
+void camera_fb_release(camera_fb_ref_t *ref)
+{
+    portENTER_CRITICAL(&camera_fb_lock);
+    bool last = ref->refs == 1;
+    if (!last)
+    {
+        ref->refs--;
+    }
+    portEXIT_CRITICAL(&camera_fb_lock);
+
+    // the last user is the only one who can reach it, so the slot is freed only after the driver has it back
+    if (last)
+    {
+        camera_driver_fb_return(ref);
+        portENTER_CRITICAL(&camera_fb_lock);
+        ref->refs = 0;
+        portEXIT_CRITICAL(&camera_fb_lock);
+    }
+}
+
+// capture the image to the global image_buffer
+bool camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *out_buf)
+{
+    return camera_capture_to(img_width, img_height, image_buffer, &image_buffer_size, out_buf);
+}
+
+// centre crop of the image with the aspect ratio of img_width x img_height, like crop_and_interpolate_rgb888 does
+void camera_crop_image_signal(ei::image_signal_t *image, uint32_t img_width, uint32_t img_height)
+{
+    int crop_width, crop_height;
+    ei::image::processing::calculate_crop_dims(image->width, image->height, img_width, img_height,
+                                               crop_width, crop_height);
+
+    image->buffer += ((image->height - crop_height) / 2) * image->stride +
+                     ((image->width - crop_width) / 2) * image->channels;
+    image->width = crop_width;
+    image->height = crop_height;
+}
@@ -11,7 +11,7 @@ static bool is_camera_initialised = false;
 bool camera_init(void)
 {
 
-    camera = new who::cam::WhoP4Cam(who::cam::VIDEO_PIX_FMT_RGB888, 3, V4L2_MEMORY_USERPTR, true);
+    camera = new who::cam::WhoP4Cam(who::cam::VIDEO_PIX_FMT_RGB888, CAMERA_FB_COUNT, V4L2_MEMORY_USERPTR, true);
     if (camera == nullptr)
     {
         return false;
@@ -34,13 +34,8 @@ void camera_deinit(void)
 }
 
 
-// slightly modified version of the camera_capture function from Edge Impulse examples 
-// modified is storage of the image in buffers
-bool camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *out_buf)
+bool camera_driver_fb_get(camera_fb_ref_t *ref)
 {
-
-    bool do_resize = false;
-
     if (!is_camera_initialised)
     {
         printf("ERR: Camera is not initialized\r\n");
@@ -56,36 +51,115 @@ bool camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *out_buf)
 
     ESP_LOGI("Camera", "Captured image %d x %d", fb->width, fb->height);
     ESP_LOGI("Camera", "Image buffer size %d", fb->len);
-    memcpy(image_buffer, fb->buf, fb->len);
-    memcpy(out_buf, fb->buf, fb->len);
+    if (fb->format != who::cam::VIDEO_PIX_FMT_RGB888)
+    {
+        printf("Conversion failed\n");
+        camera->cam_fb_return();
+        return false;
+    }
+
+    ref->fb = fb;
+    ref->buf = (uint8_t *)fb->buf;
+    ref->len = fb->len;
+    ref->width = fb->width;
+    ref->height = fb->height;
+    return true;
+}
 
+// WhoP4Cam takes back the oldest frame buffer, frames are released in the order they were captured
+void camera_driver_fb_return(camera_fb_ref_t *ref)
+{
     camera->cam_fb_return();
+    ref->fb = nullptr;
+}
 
-    if (fb->format != who::cam::VIDEO_PIX_FMT_RGB888)
+// crop the frame to the aspect ratio of img_width x img_height and average it down to out_buf row by row
+static bool resize_frame(const camera_fb_ref_t *ref, uint32_t img_width, uint32_t img_height, uint8_t *out_buf)
+{
+    ei::image_signal_t image;
+    camera_get_image_signal(ref->buf, ref->width, ref->height, &image);
+    camera_crop_image_signal(&image, img_width, img_height);
+
+    uint64_t resize_start_us = ei_read_timer_us();
+    ei::image::processing::area_resize_stream_t resize;
+    if (ei::image::processing::area_resize_stream_init(&resize, image.width, image.height, out_buf,
+                                                       img_width, img_height, CAMERA_FRAME_BYTE_SIZE) != ei::EIDSP_OK)
     {
-        printf("Conversion failed\n");
+        printf("ERR: Image can not be resized to %d x %d\n", img_width, img_height);
         return false;
     }
+    for (size_t row = 0; row < image.height; row++)
+    {
+        ei::image::processing::area_resize_stream_push_row(&resize, image.buffer + row * image.stride);
+    }
+    ei::image::processing::area_resize_stream_free(&resize);
+    ei_profiling_record_stage("resize", resize_start_us);
+    return true;
+}
 
-    if ((img_width != CAMERA_RAW_FRAME_BUFFER_COLS) || (img_height != CAMERA_RAW_FRAME_BUFFER_ROWS))
+// slightly modified version of the camera_capture function from Edge Impulse examples 
+// modified is storage of the image in buffers
+bool camera_capture_to(uint32_t img_width, uint32_t img_height, uint8_t *raw_buf, size_t *raw_size, uint8_t *out_buf)
+{
+    camera_fb_ref_t *ref = camera_fb_acquire();
+    if (ref == nullptr)
     {
-        do_resize = true;
+        return false;
+    }
+
+    if (ref->len > CAMERA_RAW_IMAGE_BUFFER_SIZE)
+    {
+        printf("ERR: Frame does not fit the image buffer\r\n");
+        camera_fb_release(ref);
+        return false;
     }
+    *raw_size = ref->len;
+    memcpy(raw_buf, ref->buf, ref->len);
+
+    // average whole areas, bilinear interpolation skips most of the pixels when shrinking this much
+    bool resized = resize_frame(ref, img_width, img_height, out_buf);
+    camera_fb_release(ref);
+    return resized;
+}
 
-    if (do_resize)
+// the frame is already RGB888, the classifier crops and resizes it straight from the camera frame buffer
+bool camera_capture_frame(uint32_t img_width, uint32_t img_height, camera_frame_t *frame)
+{
+    frame->fb = camera_fb_acquire();
+    if (frame->fb == nullptr)
     {
-        ei::image::processing::crop_and_interpolate_rgb888(
-            out_buf,
-            CAMERA_RAW_FRAME_BUFFER_COLS,
-            CAMERA_RAW_FRAME_BUFFER_ROWS,
-            out_buf,
-            img_width,
-            img_height);
-        printf("Resized image to %d x %d\n", img_width, img_height);
+        return false;
     }
+
+    camera_get_image_signal(frame->fb->buf, frame->fb->width, frame->fb->height, &frame->image);
+    camera_crop_image_signal(&frame->image, img_width, img_height);
     return true;
 }
 
+// frame buffers are user pointers, so the kept one is exchanged with image_buffer instead of copied
+// the driver captures into the previous image_buffer from now on and the frame can be released in order
+void camera_fb_keep(camera_fb_ref_t *ref)
+{
+    auto *fb = (who::cam::cam_fb_t *)ref->fb;
+    if (fb->len <= CAMERA_RAW_IMAGE_BUFFER_SIZE)
+    {
+        uint8_t *kept = (uint8_t *)fb->buf;
+        fb->buf = image_buffer;
+        ref->buf = image_buffer;
+        image_buffer = kept;
+    }
+    else
+    {
+        memcpy(image_buffer, fb->buf, CAMERA_FRAME_BUFFER_SIZE);
+    }
+    image_buffer_size = CAMERA_FRAME_BUFFER_SIZE;
+}
+
+// kept frame is already in image_buffer
+void camera_fb_store_kept(void)
+{
+}
+
 // This function is from Edge Impulse examples
 // it is used to get the image data from the buffer
 // its modified because orginal function uses RGB888 with switched color channels
@@ -109,4 +183,15 @@ int camera_get_data(size_t offset, size_t length, float *out_ptr)
     return 0;
 }
 
+// describe the inference image so the classifier can read the pixels directly
+void camera_get_image_signal(const uint8_t *buffer, uint32_t img_width, uint32_t img_height, ei::image_signal_t *image)
+{
+    image->buffer = buffer;
+    image->width = img_width;
+    image->height = img_height;
+    image->stride = img_width * CAMERA_FRAME_BYTE_SIZE;
+    image->channels = CAMERA_FRAME_BYTE_SIZE;
+    image->bgr = false;
+}
+
 #endif
\ No newline at end of file
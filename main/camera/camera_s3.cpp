@@ -2,6 +2,8 @@
 #include "photo_trap_camera.hpp"
 #if defined(CONFIG_IDF_TARGET_ESP32S3)
 #include "esp_camera.h"
+#include "esp_heap_caps.h"
+#include "esp_jpg_decode.h"
 #include "esp_log.h"
 #include <string.h>
 
@@ -53,7 +55,7 @@ static camera_config_t camera_config = {
     .frame_size = FRAMESIZE_HD,     // 1280x720
 
     .jpeg_quality = 8, // 0-63 lower number means higher quality
-    .fb_count = 2,      // if more than one, i2s runs in continuous mode. Use only with JPEG
+    .fb_count = CAMERA_FB_COUNT, // if more than one, i2s runs in continuous mode. Use only with JPEG
     .fb_location = CAMERA_FB_IN_PSRAM,
     .grab_mode = CAMERA_GRAB_LATEST,
 };
@@ -102,17 +104,157 @@ void camera_deinit(void)
     return;
 }
 
-// slightly modified version of the ei_camera_capture function from Edge Impulse examples
-bool camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *out_buf)
+// Largest height of a decoded block, JPEG MCU is at most 16 rows before the decoder scaling
+#define JPEG_MAX_MCU_ROWS 16
+
+// JPEG decoder state for jpeg_decode_resized
+// decoded blocks of one MCU row are collected in band, then the cropped rows go to the downscale
+typedef struct jpeg_decoder_t {
+    const uint8_t *input;
+    uint32_t scale;
+    uint32_t img_width;
+    uint32_t img_height;
+    uint8_t *output;
+    uint32_t width;
+    uint32_t crop_x;
+    uint32_t crop_y;
+    uint32_t crop_width;
+    uint32_t crop_height;
+    uint8_t *band;
+    uint32_t band_rows;
+    ei::image::processing::area_resize_stream_t resize;
+} jpeg_decoder_t;
+
+// get the largest DCT scaling of the decoder which still keeps at least img_width x img_height
+static uint32_t jpeg_decode_scale(uint32_t width, uint32_t height, uint32_t img_width, uint32_t img_height)
 {
-    bool do_resize = false;
+    uint32_t scale = 8;
+    while (scale > 1 && (width / scale < img_width || height / scale < img_height))
+    {
+        scale /= 2;
+    }
+    return scale;
+}
 
-    if (out_buf == nullptr)
+// feed the decoder from the JPEG in memory
+static size_t jpeg_read(void *arg, size_t index, uint8_t *buf, size_t len)
+{
+    jpeg_decoder_t *jpeg = (jpeg_decoder_t *)arg;
+    if (buf)
+    {
+        memcpy(buf, jpeg->input + index, len);
+    }
+    return len;
+}
+
+// called with x = y = 0 and the decoded image size before the first block
+// set up the crop and the downscale, band is small enough to stay in internal RAM
+static bool jpeg_start(jpeg_decoder_t *jpeg, uint32_t width, uint32_t height)
+{
+    int crop_width, crop_height;
+    ei::image::processing::calculate_crop_dims(width, height, jpeg->img_width, jpeg->img_height,
+                                               crop_width, crop_height);
+    jpeg->width = width;
+    jpeg->crop_width = crop_width;
+    jpeg->crop_height = crop_height;
+    jpeg->crop_x = (width - crop_width) / 2;
+    jpeg->crop_y = (height - crop_height) / 2;
+
+    jpeg->band_rows = JPEG_MAX_MCU_ROWS / jpeg->scale;
+    jpeg->band = (uint8_t *)heap_caps_malloc(jpeg->crop_width * jpeg->band_rows * CAMERA_FRAME_BYTE_SIZE,
+                                             MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (jpeg->band == nullptr)
     {
-        printf("ERR: out_buf is null\r\n");
         return false;
     }
+    return ei::image::processing::area_resize_stream_init(&jpeg->resize, crop_width, crop_height, jpeg->output,
+                                                          jpeg->img_width, jpeg->img_height,
+                                                          CAMERA_FRAME_BYTE_SIZE) == ei::EIDSP_OK;
+}
+
+// store decoded block of pixels into the band, downscale the band when its MCU row is complete
+// pixels are stored as BGR, the same way as fmt2rgb888 does it
+static bool jpeg_write(void *arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data)
+{
+    jpeg_decoder_t *jpeg = (jpeg_decoder_t *)arg;
+    if (!data)
+    {
+        if (x == 0 && y == 0)
+        {
+            return jpeg_start(jpeg, w, h);
+        }
+        return true;
+    }
+
+    if (h > jpeg->band_rows)
+    {
+        return false;
+    }
+
+    // columns of the block inside the crop
+    uint32_t start = x > jpeg->crop_x ? x : jpeg->crop_x;
+    uint32_t end = x + w < jpeg->crop_x + jpeg->crop_width ? x + w : jpeg->crop_x + jpeg->crop_width;
+    for (uint16_t row = 0; row < h && start < end; row++)
+    {
+        const uint8_t *in = data + ((size_t)row * w + (start - x)) * CAMERA_FRAME_BYTE_SIZE;
+        uint8_t *out = jpeg->band + ((size_t)row * jpeg->crop_width + (start - jpeg->crop_x)) * CAMERA_FRAME_BYTE_SIZE;
+        for (uint32_t col = start; col < end; col++)
+        {
+            out[0] = in[2];
+            out[1] = in[1];
+            out[2] = in[0];
+            out += CAMERA_FRAME_BYTE_SIZE;
+            in += CAMERA_FRAME_BYTE_SIZE;
+        }
+    }
+
+    // blocks come left to right, the last one completes the band
+    if (x + w < jpeg->width)
+    {
+        return true;
+    }
+    for (uint16_t row = 0; row < h; row++)
+    {
+        if (y + row < jpeg->crop_y || y + row >= jpeg->crop_y + jpeg->crop_height)
+        {
+            continue;
+        }
+        const uint8_t *band_row = jpeg->band + (size_t)row * jpeg->crop_width * CAMERA_FRAME_BYTE_SIZE;
+        if (ei::image::processing::area_resize_stream_push_row(&jpeg->resize, band_row) != ei::EIDSP_OK)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// decode JPEG to BGR888 img_width x img_height cropped to its aspect ratio
+// the decoder downscales 1, 2, 4 or 8 times, the rest is area averaged one MCU row at a time,
+// so the decoded image is never stored as a whole
+static bool jpeg_decode_resized(const uint8_t *jpg, size_t len, uint32_t scale,
+                                uint32_t img_width, uint32_t img_height, uint8_t *out_buf)
+{
+    jpeg_decoder_t jpeg = {};
+    jpeg.input = jpg;
+    jpeg.scale = scale;
+    jpeg.img_width = img_width;
+    jpeg.img_height = img_height;
+    jpeg.output = out_buf;
+
+    jpg_scale_t jpg_scale = scale == 8 ? JPG_SCALE_8X :
+                            scale == 4 ? JPG_SCALE_4X :
+                            scale == 2 ? JPG_SCALE_2X : JPG_SCALE_NONE;
+    bool decoded = esp_jpg_decode(len, jpg_scale, jpeg_read, jpeg_write, &jpeg) == ESP_OK;
+
+    // all destination rows have to be written
+    decoded = decoded && jpeg.resize.acc != nullptr && jpeg.resize.dst_rows_left == 0;
+    ei::image::processing::area_resize_stream_free(&jpeg.resize);
+    heap_caps_free(jpeg.band);
+    return decoded;
+}
 
+bool camera_driver_fb_get(camera_fb_ref_t *ref)
+{
     if (!is_camera_initialised)
     {
         printf("ERR: Camera is not initialized\r\n");
@@ -120,46 +262,134 @@ bool camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *out_buf)
     }
 
     camera_fb_t *fb = esp_camera_fb_get();
-
     if (!fb)
     {
         printf("Camera capture failed\n");
         return false;
     }
-
-    image_buffer_size = fb->len;
-    memcpy(image_buffer, fb->buf, fb->len);
     ESP_LOGI("Camera", "Captured image %d x %d", fb->width, fb->height);
     ESP_LOGI("Camera", "Image buffer size %d", fb->len);
 
-    bool converted = fmt2rgb888(fb->buf, fb->len, PIXFORMAT_JPEG, out_buf);
+    ref->fb = fb;
+    ref->buf = fb->buf;
+    ref->len = fb->len;
+    ref->width = fb->width;
+    ref->height = fb->height;
+    return true;
+}
 
-    esp_camera_fb_return(fb);
+void camera_driver_fb_return(camera_fb_ref_t *ref)
+{
+    esp_camera_fb_return((camera_fb_t *)ref->fb);
+    ref->fb = nullptr;
+}
 
-    if (!converted)
+// decode the JPEG already downscaled, full resolution is not needed for inference
+// average whole areas, bilinear interpolation skips most of the pixels when shrinking this much
+static bool decode_frame(const camera_fb_ref_t *ref, uint32_t img_width, uint32_t img_height, uint8_t *out_buf)
+{
+    if (img_width > ref->width || img_height > ref->height)
+    {
+        printf("ERR: Image can not be upscaled\r\n");
+        return false;
+    }
+
+    uint64_t decode_start_us = ei_read_timer_us();
+    uint32_t scale = jpeg_decode_scale(ref->width, ref->height, img_width, img_height);
+    if (!jpeg_decode_resized(ref->buf, ref->len, scale, img_width, img_height, out_buf))
     {
         printf("Conversion failed\n");
         return false;
     }
+    ei_profiling_record_stage("decode", decode_start_us);
+    return true;
+}
+
+// slightly modified version of the ei_camera_capture function from Edge Impulse examples
+// the JPEG is stored to raw_buf and decoded straight into img_width x img_height in out_buf
+bool camera_capture_to(uint32_t img_width, uint32_t img_height, uint8_t *raw_buf, size_t *raw_size, uint8_t *out_buf)
+{
+    if (out_buf == nullptr || raw_buf == nullptr)
+    {
+        printf("ERR: out_buf is null\r\n");
+        return false;
+    }
 
-    if ((img_width != CAMERA_RAW_FRAME_BUFFER_COLS) || (img_height != CAMERA_RAW_FRAME_BUFFER_ROWS))
+    camera_fb_ref_t *ref = camera_fb_acquire();
+    if (ref == nullptr)
     {
-        do_resize = true;
+        return false;
     }
 
-    if (do_resize)
+    if (ref->len > CAMERA_RAW_IMAGE_BUFFER_SIZE)
     {
-        ei::image::processing::crop_and_interpolate_rgb888(
-            out_buf,
-            CAMERA_RAW_FRAME_BUFFER_COLS,
-            CAMERA_RAW_FRAME_BUFFER_ROWS,
-            out_buf,
-            img_width,
-            img_height);
+        printf("ERR: JPEG image does not fit the image buffer\r\n");
+        camera_fb_release(ref);
+        return false;
+    }
+
+    *raw_size = ref->len;
+    memcpy(raw_buf, ref->buf, ref->len);
+    bool decoded = decode_frame(ref, img_width, img_height, out_buf);
+    camera_fb_release(ref);
+    return decoded;
+}
+
+// JPEG is decoded from the camera frame buffer already resized, the classifier only quantizes it
+bool camera_capture_frame(uint32_t img_width, uint32_t img_height, camera_frame_t *frame)
+{
+    frame->fb = camera_fb_acquire();
+    if (frame->fb == nullptr)
+    {
+        return false;
+    }
+
+    if (!decode_frame(frame->fb, img_width, img_height, frame->detection))
+    {
+        camera_fb_release(frame->fb);
+        frame->fb = nullptr;
+        return false;
     }
+
+    camera_get_image_signal(frame->detection, img_width, img_height, &frame->image);
     return true;
 }
 
+// frame buffers of esp32-camera can not be taken over, the kept one is held until the burst stops
+static camera_fb_ref_t *kept_fb = nullptr;
+
+void camera_fb_keep(camera_fb_ref_t *ref)
+{
+    camera_fb_hold(ref);
+    if (kept_fb != nullptr)
+    {
+        camera_fb_release(kept_fb);
+    }
+    kept_fb = ref;
+}
+
+// only the kept JPEG is copied, once per wake-up
+void camera_fb_store_kept(void)
+{
+    if (kept_fb == nullptr)
+    {
+        return;
+    }
+
+    if (kept_fb->len <= CAMERA_RAW_IMAGE_BUFFER_SIZE)
+    {
+        memcpy(image_buffer, kept_fb->buf, kept_fb->len);
+        image_buffer_size = kept_fb->len;
+    }
+    else
+    {
+        printf("ERR: JPEG image does not fit the image buffer\r\n");
+        image_buffer_size = 0;
+    }
+    camera_fb_release(kept_fb);
+    kept_fb = nullptr;
+}
+
 
 // implementation of the get_data function for edge impulse classifier
 // this function is from Edge Impulse examples renamed from ei_camera_get_data
@@ -196,4 +426,18 @@ int camera_get_data(size_t offset, size_t length, float *out_ptr)
     // and done!
     return 0;
 }
+
+// describe the inference image so the classifier can read the pixels directly
+void camera_get_image_signal(const uint8_t *buffer, uint32_t img_width, uint32_t img_height, ei::image_signal_t *image)
+{
+    image->buffer = buffer;
+    image->width = img_width;
+    image->height = img_height;
+    image->stride = img_width * CAMERA_FRAME_BYTE_SIZE;
+    image->channels = CAMERA_FRAME_BYTE_SIZE;
+    // JPEG decoder of esp32-camera stores pixels as BGR
+    // due to https://github.com/espressif/esp32-camera/issues/379
+    image->bgr = true;
+}
+
 #endif
\ No newline at end of file
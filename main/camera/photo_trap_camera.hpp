@@ -2,7 +2,10 @@
 #ifndef PHOTO_TRAP_CAMERA_HPP
 #define PHOTO_TRAP_CAMERA_HPP
 
+#include "sdkconfig.h"
 #include "edge-impulse-sdk/dsp/image/image.hpp"
+#include "edge-impulse-sdk/dsp/numpy_types.h"
+#include "edge-impulse-sdk/classifier/ei_profiling.h"
 
 // 1280x720
 #define CAMERA_RAW_FRAME_BUFFER_COLS           1280
@@ -12,6 +15,55 @@
 #define CAMERA_FRAME_BYTE_SIZE                 3
 #define CAMERA_FRAME_BUFFER_SIZE                (CAMERA_RAW_FRAME_BUFFER_COLS * CAMERA_RAW_FRAME_BUFFER_ROWS * CAMERA_FRAME_BYTE_SIZE) 
 
+// Size of the frame as it comes from the camera
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+// esp32-camera JPEG frame buffers are width * height / 5 bytes
+#define CAMERA_RAW_IMAGE_BUFFER_SIZE            (CAMERA_RAW_FRAME_BUFFER_COLS * CAMERA_RAW_FRAME_BUFFER_ROWS / 5)
+#else
+#define CAMERA_RAW_IMAGE_BUFFER_SIZE            CAMERA_FRAME_BUFFER_SIZE
+#endif
+
+// Size of the work buffer the frame is converted and resized in
+// frame is decoded (S3) or read (P4) and downscaled row by row, only the inference image is stored
+#define CAMERA_DETECTION_BUFFER_SIZE            (EI_INFERENCE_FRAME_BUFFER_COLS * EI_INFERENCE_FRAME_BUFFER_ROWS * \
+                                                 CAMERA_FRAME_BYTE_SIZE)
+
+// Size of the per frame buffer the classifier reads the inference image from
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+// JPEG is decoded into it already resized
+#define CAMERA_FRAME_DETECTION_BUFFER_SIZE      CAMERA_DETECTION_BUFFER_SIZE
+#else
+// RGB888 frame is read straight from the camera frame buffer
+#define CAMERA_FRAME_DETECTION_BUFFER_SIZE      0
+#endif
+
+// Number of frames captured during one burst in flight at the same time
+// one is being classified while the next one is captured
+#define CAMERA_BURST_SLOTS                      2
+
+// Number of frame buffers of the camera driver
+// every burst slot holds one, on S3 the kept frame holds one more until the burst stops
+#define CAMERA_FB_COUNT                         (CAMERA_BURST_SLOTS + 1)
+
+// Frame buffer of the camera driver shared by its users (inference, storage)
+// It is not copied, it goes back to the driver when the last user releases it
+typedef struct camera_fb_ref_t {
+    void *fb;               // frame buffer of the driver (camera_fb_t on S3, who::cam::cam_fb_t on P4)
+    uint8_t *buf;           // frame data (JPEG on S3, RGB888 on P4)
+    size_t len;             // size of the data in buf
+    uint32_t width;
+    uint32_t height;
+    int refs;               // number of users, 0 when the buffer is back in the driver
+} camera_fb_ref_t;
+
+// Frame captured during a burst
+typedef struct camera_frame_t {
+    camera_fb_ref_t *fb;    // camera frame buffer, nullptr if capturing of this frame failed
+    uint8_t *detection;     // decoded RGB888 image, nullptr if the classifier reads fb directly
+    ei::image_signal_t image; // cropped view of the frame the classifier resizes and quantizes
+    bool captured;          // false if capturing of this frame failed
+} camera_frame_t;
+
 
 // Initialize the camera and start streaming
 // Returns true if successful, false otherwise
@@ -23,12 +75,72 @@ void camera_deinit(void);
 // Capture, rescale and crop image.
 // In image_buffer, the image is stored in jpeg format 1280x720.
 // To out_buf, the image is converted to RGB888 and in img_width x img_height format.
+// On S3 the JPEG is decoded and downscaled row band by row band, without a full size RGB888 copy.
 // Returns true if successful, false otherwise
 bool camera_capture(uint32_t img_width, uint32_t img_height, uint8_t *out_buf);
 
+// Same as camera_capture, but the camera frame is stored to raw_buf instead of image_buffer.
+// raw_buf has to be CAMERA_RAW_IMAGE_BUFFER_SIZE bytes, out_buf CAMERA_DETECTION_BUFFER_SIZE bytes
+// (on S3 img_width * img_height * CAMERA_FRAME_BYTE_SIZE bytes is enough).
+// Returns true if successful, false otherwise
+bool camera_capture_to(uint32_t img_width, uint32_t img_height, uint8_t *raw_buf, size_t *raw_size, uint8_t *out_buf);
+
+// Get the next frame buffer from the camera driver, the caller is its only user
+// Returns nullptr if capturing failed
+camera_fb_ref_t *camera_fb_acquire(void);
+
+// Add a user of the frame buffer
+void camera_fb_hold(camera_fb_ref_t *ref);
+
+// Remove a user of the frame buffer, the last one returns it to the driver
+// On P4 the driver takes frame buffers back in the order they were captured
+void camera_fb_release(camera_fb_ref_t *ref);
+
+// Driver specific part of camera_fb_acquire and camera_fb_release, fills or returns ref->fb
+bool camera_driver_fb_get(camera_fb_ref_t *ref);
+void camera_driver_fb_return(camera_fb_ref_t *ref);
+
+// Keep the frame for storing, it replaces the previously kept one
+// On P4 the frame buffer is exchanged with image_buffer, on S3 it is held until camera_fb_store_kept
+void camera_fb_keep(camera_fb_ref_t *ref);
+
+// Move the kept frame to image_buffer and image_buffer_size, call before camera_deinit
+void camera_fb_store_kept(void);
+
+// Capture a frame of the burst into a camera frame buffer without copying it.
+// frame->image is set to the centre crop with the aspect ratio of img_width x img_height,
+// the classifier resizes (P4) and quantizes it in one pass. On S3 it is already resized.
+// Returns true if successful, false otherwise
+bool camera_capture_frame(uint32_t img_width, uint32_t img_height, camera_frame_t *frame);
+
+// Start capturing frame_count frames in a task running on the other core.
+// Next frame is captured while the previous one is being classified.
+// Returns true if successful, false otherwise
+bool camera_burst_start(uint32_t img_width, uint32_t img_height, size_t frame_count);
+
+// Wait for the next captured frame of the burst
+// Returns nullptr when all frames were delivered
+camera_frame_t *camera_burst_next(void);
+
+// Release the camera frame buffer of the frame and give the frame back to the capture task
+void camera_burst_release(camera_frame_t *frame);
+
+// Keep the frame for storing, see camera_fb_keep
+void camera_burst_keep(camera_frame_t *frame);
+
+// Wait for the capture task to finish, free the burst buffers and move the kept frame to image_buffer
+void camera_burst_stop(void);
+
 // Get the image data to edge impulse classifier
 int camera_get_data(size_t offset, size_t length, float *out_ptr);
 
+// Describe the RGB888 inference image in buffer for run_classifier_image().
+// Lets the classifier read the pixels directly instead of going through camera_get_data.
+void camera_get_image_signal(const uint8_t *buffer, uint32_t img_width, uint32_t img_height, ei::image_signal_t *image);
+
+// Crop the image to the centre with the aspect ratio of img_width x img_height
+void camera_crop_image_signal(ei::image_signal_t *image, uint32_t img_width, uint32_t img_height);
+
 // allocate image buffers for the image data
 // Returns true if successful, false otherwise
 bool allocate_image_buffers(void);
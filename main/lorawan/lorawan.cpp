@@ -9,23 +9,96 @@ HardwareSerial Serial2(UART_NUM_2);
 
 RTC_NOINIT_ATTR bool lorawan_joined = false;
 
-// Check if lorawan module have new event
-// for example Join event
-void lorawan_loop_task(void *arg)
+#define LORAWAN_SESSION_MAGIC 0x4C57534E
+
+// Session of the module kept over deep sleep, RTC memory keeps garbage after power on,
+// so it is only used with the right magic and checksum
+typedef struct
+{
+    uint32_t magic;
+    // settings the module was configured with, other settings need the full configuration
+    uint32_t config_hash;
+    // device address assigned by the network server, empty until the first uplink after the join
+    char dev_addr[9];
+    // successful uplinks since the join
+    uint32_t uplink_count;
+    uint32_t checksum;
+} lorawan_session_t;
+
+RTC_NOINIT_ATTR static lorawan_session_t lorawan_session;
+
+// FNV-1a, enough to notice changed settings or garbage in RTC memory
+static uint32_t lorawan_hash(const void *data, size_t len, uint32_t hash = 2166136261u)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (size_t i = 0; i < len; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// hash of the settings lorawan_init() writes to the module
+static uint32_t lorawan_config_hash()
 {
-    while (1)
+    const char *config[] = { DevEUI, AppEUI, AppKey, EU868 };
+    uint32_t hash = 2166136261u;
+    for (const char *item : config)
     {
-        lorawan.update();
-        vTaskDelay(10 / portTICK_PERIOD_MS);
+        hash = lorawan_hash(item, strlen(item) + 1, hash);
     }
+    return hash;
+}
+
+static uint32_t lorawan_session_checksum()
+{
+    return lorawan_hash(&lorawan_session, offsetof(lorawan_session_t, checksum));
+}
+
+static bool lorawan_session_valid()
+{
+    return lorawan_session.magic == LORAWAN_SESSION_MAGIC &&
+           lorawan_session.checksum == lorawan_session_checksum() &&
+           lorawan_session.config_hash == lorawan_config_hash();
+}
+
+static void lorawan_session_store()
+{
+    lorawan_session.checksum = lorawan_session_checksum();
+}
+
+static void lorawan_session_clear()
+{
+    memset(&lorawan_session, 0, sizeof(lorawan_session));
+}
+
+// Remember the session after a successful uplink, DevAddr is asked for once per join
+static void lorawan_session_sent(size_t sent)
+{
+    if (sent == 0 || lorawan_session_valid() == false)
+    {
+        return;
+    }
+    if (lorawan_session.dev_addr[0] == '\0')
+    {
+        String dev_addr = lorawan.getDevAddr();
+        strncpy(lorawan_session.dev_addr, dev_addr.c_str(), sizeof(lorawan_session.dev_addr) - 1);
+    }
+    lorawan_session.uplink_count++;
+    lorawan_session_store();
 }
 
 void lorawan_join_callback(bool status)
 {
     lorawan_joined = status;
+    // runs in the UART event task, no module commands here
+    lorawan_session_clear();
     if (status)
     {
         printf("LoRaWAN joined\r\n");
+        lorawan_session.magic = LORAWAN_SESSION_MAGIC;
+        lorawan_session.config_hash = lorawan_config_hash();
+        lorawan_session_store();
     }
     else
     {
@@ -33,94 +106,176 @@ void lorawan_join_callback(bool status)
     }
 }
 
-bool lorawan_init()
+// Speculative bring-up state, see lorawan_bringup_start()
+typedef enum
 {
-    bool status = false;
+    BRINGUP_IDLE,    // not started, lorawan_bringup_wait() initializes the module itself
+    BRINGUP_STARTED, // task started on wake-up, the result is not used yet
+    BRINGUP_CLAIMED, // the uplink path waited for the task and owns the module
+} bringup_state_t;
 
-    for (int i = 0; i < 10; i++)
+static bringup_state_t bringup_state = BRINGUP_IDLE;
+static SemaphoreHandle_t bringup_done = NULL;
+static volatile bool bringup_aborted = false;
+static bool bringup_status = false;
+// the UART handshake succeeded, the module can be put to sleep
+static bool module_ready = false;
+
+// Repeat a module command up to 10 times, stop early when the bring-up is aborted
+template <typename F>
+static bool lorawan_retry(F command)
+{
+    for (int i = 0; i < 10 && bringup_aborted == false; i++)
     {
-        status = lorawan.init(&Serial2, RX, TX, RAK3172_BPS_115200);
-        if (status)
+        if (command())
         {
-            break;
+            return true;
         }
         delay(50);
     }
+    return false;
+}
 
-    if (!status)
-    {
-        printf("LoraWan device init failed\n");
-        return false;
-    }
-
-    for (int i = 0; i < 10; i++)
+bool lorawan_init()
+{
+    // joined with the same settings before the deep sleep, check that the module still is
+    if (lorawan_session_valid())
     {
-        status = lorawan.sendCommand("AT+BAND=" + String(EU868));
-        if (status)
+        if (lorawan.resume(&Serial2, RX, TX, RAK3172_BPS_115200))
         {
-            break;
+            module_ready = true;
+            lorawan_joined = true;
+            lorawan.onJoin(lorawan_join_callback);
+            printf("LoRaWAN session resumed, DevAddr %s, %u uplinks\r\n",
+                   lorawan_session.dev_addr, (unsigned)lorawan_session.uplink_count);
+            return true;
         }
-        delay(50);
+        printf("LoRaWAN session lost, configuring the module\r\n");
     }
+    // the module is configured again and has to join
+    lorawan_session_clear();
+    lorawan_joined = false;
 
+    bool status = lorawan_retry([] { return lorawan.init(&Serial2, RX, TX, RAK3172_BPS_115200); });
     if (!status)
     {
         printf("LoraWan device init failed\n");
         return false;
     }
+    module_ready = true;
 
-    for (int i = 0; i < 10; i++)
+    status = lorawan_retry([] { return lorawan.sendCommand("AT+BAND=" + String(EU868)); });
+    if (!status)
     {
-        if (lorawan.setOTAA(DevEUI, AppEUI, AppKey))
-        {
-            break;
-        }
-        delay(50);
+        printf("LoraWan device init failed\n");
+        return false;
     }
 
-    for (int i = 0; i < 10; i++)
+    lorawan_retry([] { return lorawan.setOTAA(DevEUI, AppEUI, AppKey); });
+    lorawan_retry([] { return lorawan.setDR(0); });
+    lorawan_retry([] { return lorawan.setMode(CLASS_A); });
+    lorawan_retry([] { return lorawan.setLinkCheck(DIS_LINKCHECK); });
+
+    if (bringup_aborted)
     {
-        if (lorawan.setDR(0))
-        {
-            break;
-        }
-        delay(50);
+        return false;
     }
 
-    for (int i = 0; i < 10; i++)
+    // called from the UART event task of the driver when the join event arrives
+    lorawan.onJoin(lorawan_join_callback);
+
+    return true;
+}
+
+// Initialize the module in the background, the session of a joined device is kept by the module
+static void lorawan_bringup_task(void *arg)
+{
+    int64_t start_time = esp_timer_get_time();
+    bringup_status = lorawan_init();
+    printf("LoRaWAN bring-up %s: %lld ms\r\n", bringup_status ? "done" : "failed",
+           (esp_timer_get_time() - start_time) / 1000);
+    xSemaphoreGive(bringup_done);
+    vTaskDelete(NULL);
+}
+
+bool lorawan_bringup_start()
+{
+    if (bringup_state != BRINGUP_IDLE)
     {
-        if (lorawan.setMode(CLASS_A))
-        {
-            break;
-        }
-        delay(50);
+        return true;
     }
-
-    for (int i = 0; i < 10; i++)
+    bringup_done = xSemaphoreCreateBinary();
+    if (bringup_done == NULL)
     {
-        if (lorawan.setLinkCheck(DIS_LINKCHECK))
-        {
-            break;
-        }
-        delay(50);
+        return false;
+    }
+    bringup_aborted = false;
+    if (xTaskCreate(lorawan_bringup_task, "lorawan_bringup_task", 4096, NULL, 4, NULL) != pdPASS)
+    {
+        vSemaphoreDelete(bringup_done);
+        bringup_done = NULL;
+        return false;
     }
+    bringup_state = BRINGUP_STARTED;
+    return true;
+}
 
+bool lorawan_bringup_wait()
+{
+    if (bringup_state == BRINGUP_IDLE)
+    {
+        // not started on wake-up
+        bringup_state = BRINGUP_CLAIMED;
+        bringup_status = lorawan_init();
+        return bringup_status;
+    }
+    if (bringup_state == BRINGUP_STARTED)
+    {
+        xSemaphoreTake(bringup_done, portMAX_DELAY);
+        bringup_state = BRINGUP_CLAIMED;
+    }
+    return bringup_status;
+}
 
-    lorawan.onJoin(lorawan_join_callback);
-    // Start the LoRaWAN loop task
-    xTaskCreate(lorawan_loop_task, "LoRaWANLoopTask", 1024 * 2, NULL, 1, NULL);
+void lorawan_bringup_abort()
+{
+    if (bringup_state != BRINGUP_STARTED)
+    {
+        return;
+    }
+    // remaining commands are skipped, the task finishes after the current one
+    bringup_aborted = true;
+    xSemaphoreTake(bringup_done, portMAX_DELAY);
+    vSemaphoreDelete(bringup_done);
+    bringup_done = NULL;
+    bringup_aborted = false;
+    bringup_state = BRINGUP_IDLE;
 
-    return true;
+    if (module_ready && lorawan.setLPM(true) == false)
+    {
+        printf("Failed to put LoRaWAN module to sleep\r\n");
+    }
 }
 
 size_t lorawan_send(const String &data)
 {
-    return lorawan.send(data);
+    size_t sent = lorawan.send(data);
+    lorawan_session_sent(sent);
+    return sent;
 }
 
 size_t lorawan_send(uint8_t *data, size_t len)
 {
-    return lorawan.send(data, len);
+    size_t sent = lorawan.send(data, len);
+    lorawan_session_sent(sent);
+    return sent;
+}
+
+size_t lorawan_send(const lorawan_iovec_t *parts, size_t count)
+{
+    size_t sent = lorawan.send(parts, count);
+    lorawan_session_sent(sent);
+    return sent;
 }
 
 bool lorawan_join()
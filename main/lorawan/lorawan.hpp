@@ -28,9 +28,23 @@
 
 // Initialize and set up the LoRaWAN module for EU868 band
 // and set The Things Network application settings.
-// Given a loop task to run in the background and a join callback function to call when the join process is finished.
+// Module events (e.g. join result) are dispatched by the UART event task of the driver, the join callback sets lorawan_joined.
 bool lorawan_init();
 
+// Start initializing the LoRaWAN module in a background task right after the wake-up,
+// so the UART handshake runs while the camera warms up and the burst is classified.
+// The module keeps the session of a joined device, lorawan_joined tells if a join is needed.
+// Returns false if the task could not be started, lorawan_bringup_wait() then initializes the module itself.
+bool lorawan_bringup_start();
+
+// Wait for the bring-up started by lorawan_bringup_start() and take over the module for the uplink.
+// Without a started bring-up the module is initialized now. Returns the result of lorawan_init().
+bool lorawan_bringup_wait();
+
+// Stop a bring-up nobody waited for (nothing detected) and put the module to sleep with setLPM.
+// Does nothing if the bring-up was not started or lorawan_bringup_wait() took over the module.
+void lorawan_bringup_abort();
+
 // Send data to the LoRaWAN network. Returns true if successfully started transmision.
 // Returns false if the device is not joined or if the send fails.
 size_t lorawan_send(const String &data);
@@ -41,6 +55,11 @@ size_t lorawan_send(const String &data);
 
 size_t lorawan_send(uint8_t *data, size_t len);
 
+// Send a payload gathered from several buffers, e.g. a header, bounding boxes and a histogram.
+// The parts are hex encoded straight into the AT command without allocation.
+// Returns the total number of bytes sent or 0 if the payload is too long or the send fails.
+size_t lorawan_send(const lorawan_iovec_t *parts, size_t count);
+
 
 // Try to join the LoRaWAN network. Check if the device is joined by joined variable.
 // Returns true if M5Stack module started the join process successfully else false.
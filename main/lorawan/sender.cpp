@@ -17,6 +17,23 @@ bool check_detection_result(const ei_impulse_result_t *result)
     return false;
 }
 
+// get the highest confidence of the detected objects
+float get_detection_score(const ei_impulse_result_t *result)
+{
+    float score = 0.0f;
+    if (result != nullptr)
+    {
+        for (uint32_t i = 0; i < result->bounding_boxes_count; i++)
+        {
+            if (result->bounding_boxes[i].value > score)
+            {
+                score = result->bounding_boxes[i].value;
+            }
+        }
+    }
+    return score;
+}
+
 bool send_data(const ei_impulse_result_t *result)
 {
     if (result != nullptr)
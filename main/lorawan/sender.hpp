@@ -16,6 +16,10 @@ typedef enum detected_class_t
 //  If so, return true, else return false
 bool check_detection_result(const ei_impulse_result_t *result);
 
+//  Get the highest confidence of the detected objects
+//  Returns 0 if nothing was detected
+float get_detection_score(const ei_impulse_result_t *result);
+
 //  Send the detected classes to the LoRaWAN network
 //  If the data is sent successfully, return true, else return false
 //  Device must be joined to the LoRaWAN network before sending data
@@ -1,5 +1,6 @@
 //author: Stepan Vondracek (xvondr27) 
 #include <stdio.h>
+#include <vector>
 #include "edge-impulse-sdk/classifier/ei_run_classifier.h"
 #include "edge-impulse-sdk/dsp/image/image.hpp"
 #include "camera/photo_trap_camera.hpp"
@@ -13,6 +14,7 @@
 #include "driver/gpio.h"
 #include "esp_idf_version.h"
 #include "bsp/esp-bsp.h"
+#include "edge-impulse-sdk/porting/espressif/ei_wake_arena.h"
 
 #define EDGE_IMPULSE_DEBUG false
 const char *TAG = "main";
@@ -39,12 +41,49 @@ bsp_led_t bsp_led = BSP_LED_GREEN;
 
 #endif
 
+// Copy the result of a burst frame
+// bounding boxes and blobs of the classifier are overwritten by the next inference, so they are copied too
+static void keep_result(const ei_impulse_result_t *frame_result, ei_impulse_result_t *result)
+{
+    static std::vector<ei_impulse_result_bounding_box_t> bounding_boxes;
+    static std::vector<ei_impulse_result_fomo_blob_t> fomo_blobs;
+
+    *result = *frame_result;
+    bounding_boxes.assign(frame_result->bounding_boxes,
+                          frame_result->bounding_boxes + frame_result->bounding_boxes_count);
+    result->bounding_boxes = bounding_boxes.data();
+    fomo_blobs.assign(frame_result->fomo_blobs, frame_result->fomo_blobs + frame_result->fomo_blobs_count);
+    result->fomo_blobs = fomo_blobs.data();
+}
+
+// Report the memory used during this wake-up and sleep until the PIR sensor is triggered
+static void deep_sleep(void)
+{
+    ei_wake_arena_stats_t stats;
+    ei_wake_arena_stats(&stats);
+    printf("Wake arena: %u of %u bytes used, %u allocations (%u bytes) from heap\r\n",
+           (unsigned)stats.used, (unsigned)stats.size,
+           (unsigned)stats.heap_fallbacks, (unsigned)stats.heap_fallback_bytes);
+
+#if defined(CONFIG_ProfilingUart)
+    // print the profiling records for tools/profile_report.py
+    ei_profiling_dump();
+#endif
+
+    // nothing to send, the LoRaWAN module sleeps too
+    lorawan_bringup_abort();
+
+    // everything allocated during this wake-up is released at once
+    ei_wake_arena_reset();
+    esp_deep_sleep_start();
+}
+
 extern "C" int app_main()
 {
     // Measure time for detection
     int64_t start_time = esp_timer_get_time();
 
-    // results of the detection
+    // results of the detection of the kept frame
     ei_impulse_result_t result = {nullptr};
     // semaphore for store task
     done_sem = xSemaphoreCreateBinary();
@@ -75,7 +114,7 @@ extern "C" int app_main()
     // check if last detection was less than 60 seconds ago
     // this will result that device will be sleeping 60 senconds after power on
     if ((difftime(now, last_detection_time) < 60)) {
-        esp_deep_sleep_start();
+        deep_sleep();
     }
     
     // turn off the LED
@@ -85,13 +124,22 @@ extern "C" int app_main()
     int64_t end_time = esp_timer_get_time();
     printf("Time before initialization: %lld ms\r\n", (end_time - start_time) / 1000);
     
+#if defined(CONFIG_SpeculativeLoRaWAN)
+    // initialize the LoRaWAN module while the camera warms up and the burst is classified,
+    // aborted in deep_sleep() when nothing is detected
+    if (lorawan_bringup_start() == false)
+    {
+        printf("Failed to start LoRaWAN bring-up\r\n");
+    }
+#endif
+
 
     // Initialize camera 
     // without camera will program go to deep sleep
     if (camera_init() == false)
     {
         printf("Failed to initialize Camera!\r\n");
-        esp_deep_sleep_start();
+        deep_sleep();
     }
     printf("Camera initialized\r\n");
 
@@ -105,7 +153,7 @@ extern "C" int app_main()
     if (allocate_image_buffers() == false)
     {
         printf("Failed to allocate image buffer\r\n");
-        esp_deep_sleep_start();
+        deep_sleep();
     }
     
     // for testing purposes
@@ -114,42 +162,74 @@ extern "C" int app_main()
     
     
     
-    // take a picture and store it in the image buffers
-    // without image buffer the program will go to deep sleep
-    if (camera_capture((size_t)EI_CLASSIFIER_INPUT_WIDTH, 
-                       (size_t)EI_CLASSIFIER_INPUT_HEIGHT, 
-                       image_detection_buffer) == false)
+    // Capture a burst of frames, the next frame is captured on the other core
+    // while the current one is classified
+    if (camera_burst_start((size_t)EI_CLASSIFIER_INPUT_WIDTH,
+                           (size_t)EI_CLASSIFIER_INPUT_HEIGHT,
+                           CONFIG_BurstFrameCount) == false)
     {
-        printf("Failed to capture image\r\n");
+        printf("Failed to start capturing\r\n");
         free_image_buffers();
         camera_deinit();
-        esp_deep_sleep_start();
+        deep_sleep();
+    }
+
+    // keep the frame with the most confident detection
+    float best_score = -1.0f;
+    camera_frame_t *frame;
+    while ((frame = camera_burst_next()) != nullptr)
+    {
+        if (frame->captured == false)
+        {
+            printf("Failed to capture image\r\n");
+            camera_burst_release(frame);
+            continue;
+        }
+
+        // pixels are resized and quantized straight from the frame into the input tensor
+        ei_impulse_result_t frame_result = {nullptr};
+        EI_IMPULSE_ERROR res = run_classifier_image(&frame->image, &frame_result, EDGE_IMPULSE_DEBUG);
+        if (res != EI_IMPULSE_OK)
+        {
+            printf("ERR: Failed to run classifier (%d)\n", res);
+        }
+        else
+        {
+            float score = get_detection_score(&frame_result);
+            if (score > best_score)
+            {
+                best_score = score;
+                camera_burst_keep(frame);
+                keep_result(&frame_result, &result);
+            }
+        }
+        camera_burst_release(frame);
     }
+    camera_burst_stop();
 
     // for testing purposes
     end_time = esp_timer_get_time();
-    printf("captured photo: %lld ms\r\n", (end_time - start_time) / 1000);
+    printf("captured and classified burst: %lld ms\r\n", (end_time - start_time) / 1000);
     
     // Stop the camera and deinitialize it
     camera_deinit();
     
-    // Set up signal for edge impulse classifier
-    signal_t signal;
-    signal.total_length = EI_CLASSIFIER_INPUT_WIDTH * EI_CLASSIFIER_INPUT_HEIGHT;
-    signal.get_data = &camera_get_data;
-    
-    // Start detection on the captured image
-    EI_IMPULSE_ERROR res = run_classifier(&signal, &result, EDGE_IMPULSE_DEBUG);
-    if (res != EI_IMPULSE_OK)
+    // Inference is done for this wake-up, free the interpreter and tensor arena
+    run_classifier_deinit();
+    if (best_score < 0.0f)
     {
-        printf("ERR: Failed to run classifier (%d)\n", res);
+        printf("ERR: No frame was classified\n");
         free_image_buffers();
-        esp_deep_sleep_start();
+        deep_sleep();
     }
     
     // Print the time it took to run from start to finish
     end_time = esp_timer_get_time();
     printf("From start to detection time: %lld ms\r\n", (end_time - start_time) / 1000);
+    ei_profiling_record(EI_PROFILING_STAGE, "detection", 0, (uint32_t)(end_time - start_time));
+    ei_wake_arena_stats_t arena_stats;
+    ei_wake_arena_stats(&arena_stats);
+    ei_profiling_record(EI_PROFILING_MEMORY, "wake_arena", 0, (uint32_t)arena_stats.used);
     // print the time it took to run the DSP and ce
     printf("DSP time: %d ms\r\n", result.timing.dsp);
     printf("Classification time: %d ms\r\n", result.timing.classification);
@@ -163,15 +243,15 @@ extern "C" int app_main()
         time(&last_detection_time);   // store the image to SD card
         xTaskCreate(store_to_sdcard_task, "store_to_sdcard_task", 4096 * 4, NULL, 5, NULL);
 
-        // loraWAN initialization
-        if (lorawan_init() == false)
+        // loraWAN initialization, already running since the wake-up with SpeculativeLoRaWAN
+        if (lorawan_bringup_wait() == false)
         {
             printf("Failed to initialize LoRaWAN!\r\n");
             // if LoRaWAN init fails wait for store task to finish and free the image buffers
             // then go to deep sleep
             xSemaphoreTake(done_sem, portMAX_DELAY);
             free_image_buffers();
-            esp_deep_sleep_start();
+            deep_sleep();
         }
         
         end_time = esp_timer_get_time();
@@ -195,6 +275,6 @@ extern "C" int app_main()
     free_image_buffers();
     
     // Sleep until the PIR sensor is triggered and start app_main() again
-    esp_deep_sleep_start();
+    deep_sleep();
 }
 ;
\ No newline at end of file
@@ -41,14 +41,12 @@ int get_nvs_flash_counter()
     return counter;
 }
 
-// increment NVS flash stored counter value
-void increment_nvs_flash_counter()
+// store the counter value to NVS flash
+void set_nvs_flash_counter(uint32_t counter)
 {
     nvs_handle_t my_handle;
     esp_err_t err = nvs_open("storage", NVS_READWRITE, &my_handle);
     if (err == ESP_OK) {
-        uint32_t counter = get_nvs_flash_counter();
-        counter++;
         err = nvs_set_u32(my_handle, "counter", counter);
         if (err != ESP_OK) {
             printf("Error (%s) writing!\n", esp_err_to_name(err));
@@ -65,72 +63,159 @@ void increment_nvs_flash_counter()
 // Convert the image buffer to JPEG format
 // return true if successful, false otherwise
 // store new image buffer to image_buffer and set jpeg_length to the length of the JPEG image
-bool get_jpg_from_image_buffer(uint8_t *image_buffer, size_t *jpeg_length)
+bool get_jpg_from_image_buffer(uint8_t **image_buffer, size_t *jpeg_length)
 {
     uint8_t *temp_buffer = NULL;
-    bool ret = fmt2jpg(image_buffer, CAMERA_FRAME_BUFFER_SIZE, CAMERA_RAW_FRAME_BUFFER_COLS, CAMERA_RAW_FRAME_BUFFER_ROWS, PIXFORMAT_RGB888, 5, &temp_buffer, jpeg_length);
+    bool ret = fmt2jpg(*image_buffer, CAMERA_FRAME_BUFFER_SIZE, CAMERA_RAW_FRAME_BUFFER_COLS, CAMERA_RAW_FRAME_BUFFER_ROWS, PIXFORMAT_RGB888, 5, &temp_buffer, jpeg_length);
     if (temp_buffer == NULL || ret == false) {
         ESP_LOGE(TAGsd, "Failed to convert image buffer to JPEG format");
         return false;
     }
     // free RGB888 image buffer
-    if(image_buffer != NULL) {
-        free(image_buffer);
+    if(*image_buffer != NULL) {
+        free(*image_buffer);
     }
-    // set the image buffer to the JPEG image buffer
-    image_buffer = temp_buffer;
+    // set the image buffer to the JPEG image buffer, it is freed by free_image_buffers
+    *image_buffer = temp_buffer;
     return true;
 }
 #elif defined(CONFIG_IDF_TARGET_ESP32S3)
-bool get_jpg_from_image_buffer(uint8_t *image_buffer, size_t *jpeg_length)
+// the camera already gives JPEG
+bool get_jpg_from_image_buffer(uint8_t **image_buffer, size_t *jpeg_length)
 {
     return true;
 }
 #endif
 
+// files of one mount session are numbered from the NVS counter, it is stored once at the end
+static bool storage_mounted = false;
+static uint32_t storage_counter = 0;
+static uint32_t storage_first_counter = 0;
+
+bool sd_storage_begin(void)
+{
+    if (storage_mounted) {
+        return true;
+    }
+    if (ESP_ERROR_CHECK_WITHOUT_ABORT(bsp_sdcard_mount()) != ESP_OK) {
+        ESP_LOGI(TAGsd, "Failed to mount SD card");
+        return false;
+    }
+    init_nvs_flash();
+    storage_counter = get_nvs_flash_counter();
+    storage_first_counter = storage_counter;
+    storage_mounted = true;
+    return true;
+}
+
+// write len bytes of buf to a new file without copying them through a stdio buffer
+static bool write_file(const char *path, const uint8_t *buf, size_t len)
+{
+    // all clusters are allocated in one run at once, the writes do not walk or extend the FAT chain
+    int flags = O_WRONLY;
+    if (esp_vfs_fat_create_contiguous_file(BSP_SD_MOUNT_POINT, path, len, true) != ESP_OK) {
+        ESP_LOGW(TAGsd, "No contiguous space for %s", path);
+        flags |= O_CREAT | O_TRUNC;
+    }
+    int fd = open(path, flags);
+    if (fd < 0) {
+        printf("Error opening file for writing\n");
+        return false;
+    }
+
+    // whole sectors are written by the FAT driver straight from buf
+    size_t written = 0;
+    while (written < len) {
+        size_t chunk = len - written < SD_STORAGE_CHUNK_SIZE ? len - written : SD_STORAGE_CHUNK_SIZE;
+        ssize_t ret = write(fd, buf + written, chunk);
+        if (ret <= 0) {
+            break;
+        }
+        written += ret;
+    }
+    bool closed = close(fd) == 0;
+    if (written != len || !closed) {
+        printf("Error writing %s\n", path);
+        unlink(path);
+        return false;
+    }
+    return true;
+}
+
+bool sd_storage_write_image(const uint8_t *buf, size_t len, uint32_t *counter)
+{
+    if (!storage_mounted || len == 0) {
+        return false;
+    }
+    char path[32];
+    snprintf(path, sizeof(path), "%s/%lu.jpg", BSP_SD_MOUNT_POINT, (unsigned long)storage_counter);
+    if (!write_file(path, buf, len)) {
+        return false;
+    }
+    if (counter != NULL) {
+        *counter = storage_counter;
+    }
+    storage_counter++;
+    return true;
+}
+
+void sd_storage_end(void)
+{
+    if (!storage_mounted) {
+        return;
+    }
+    if (storage_counter != storage_first_counter) {
+        set_nvs_flash_counter(storage_counter);
+    }
+    deinit_nvs_flash();
+    ESP_LOGI(TAGsd, "Closing NVS");
+    bsp_sdcard_unmount();
+    ESP_LOGI(TAGsd, "Unmounting SD card...");
+    storage_mounted = false;
+}
+
+#if EI_CLASSIFIER_PROFILING == 1
+static bool write_profile(const void *data, size_t size, void *ctx)
+{
+    return fwrite(data, 1, size, (FILE *)ctx) == size;
+}
+
+// store the profiling records of this wake-up next to the image as <counter>.prf
+// the file is read by tools/profile_report.py
+static void store_profile_to_sdcard(uint32_t counter)
+{
+    char path[32];
+    snprintf(path, sizeof(path), "%s/%lu.prf", BSP_SD_MOUNT_POINT, (unsigned long)counter);
+    FILE* f = fopen(path, "w");
+    if (f == NULL) {
+        printf("Error opening profile for writing\n");
+        return;
+    }
+    bool written = ei_profiling_export(write_profile, f);
+    fclose(f);
+    if (!written) {
+        remove(path);
+    }
+}
+#endif
+
 void store_to_sdcard_task(void *arg)
 {
-    if(ESP_ERROR_CHECK_WITHOUT_ABORT(bsp_sdcard_mount()) == ESP_OK)
-    {
+    // get jpeg image from image buffer
+    if (get_jpg_from_image_buffer(&image_buffer, &image_buffer_size) == false) {
+        ESP_LOGE(TAGsd, "Failed to convert image buffer to JPEG format");
+    } else if (sd_storage_begin()) {
         // store data to sd card
         ESP_LOGI(TAGsd, "Storing data to SD card...");
-        init_nvs_flash();
-        std::string path = BSP_SD_MOUNT_POINT;
-        path += "/";
-        path += std::to_string(get_nvs_flash_counter());
-        path += ".jpg";
-        // get jpeg image from image buffer
-        if(get_jpg_from_image_buffer(image_buffer, &image_buffer_size) == false) {
-            ESP_LOGE(TAGsd, "Failed to convert image buffer to JPEG format");
-            deinit_nvs_flash();
-            xSemaphoreGive(done_sem);
-            vTaskDelete(NULL);
-            return;
-        }
-        FILE* f = fopen(path.c_str(), "w");
-        if (f != NULL) {
-            // write the image buffer to the file
-            size_t written = fwrite(image_buffer, sizeof(uint8_t), image_buffer_size, f);
-            fflush(f);
-            fclose(f);
-            if (written != image_buffer_size) {
-                remove(path.c_str());
-            } else {
-                // increment the counter in NVS flash
-                increment_nvs_flash_counter();
-            }
-        }
-        else {
-            printf("Error opening file for writing\n");
+        uint64_t store_start_us = ei_read_timer_us();
+        uint32_t counter;
+        if (sd_storage_write_image(image_buffer, image_buffer_size, &counter)) {
+            ei_profiling_record_stage("store", store_start_us);
+#if EI_CLASSIFIER_PROFILING == 1
+            store_profile_to_sdcard(counter);
+#endif
         }
-        deinit_nvs_flash();
-        ESP_LOGI(TAGsd, "Closing NVS");
-        bsp_sdcard_unmount();
-        ESP_LOGI(TAGsd, "Unmounting SD card...");
-    }
-    else
-    {
-        ESP_LOGI(TAGsd, "Failed to mount SD card");
+        sd_storage_end();
     }
     ESP_LOGI(TAGsd, "semaphore give done_sem");
     xSemaphoreGive(done_sem);
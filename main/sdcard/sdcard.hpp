@@ -8,8 +8,27 @@
 #include "esp_camera.h"
 #include <iostream>
 #include "freertos/semphr.h"
+#include "esp_vfs_fat.h"
+#include <fcntl.h>
+#include <unistd.h>
 #include "../camera/photo_trap_camera.hpp"
 
+// Files are written in chunks of this size, a multiple of the cluster size of usual SD card formats
+#define SD_STORAGE_CHUNK_SIZE (32 * 1024)
+
+// Mount the SD card and read the file counter for the files of this wake-up
+// Several images (e.g. frames of a burst) can be stored before sd_storage_end
+// Returns true if successful, false otherwise
+bool sd_storage_begin(void);
+
+// Store len bytes of JPEG from buf as <counter>.jpg, the data is written straight from buf
+// to a file allocated in one run of clusters. counter is set to the number of the file (can be NULL).
+// Returns true if successful, false otherwise
+bool sd_storage_write_image(const uint8_t *buf, size_t len, uint32_t *counter);
+
+// Store the file counter and unmount the SD card
+void sd_storage_end(void);
+
 
 // Use this function in freertos task to store data to SD card
 void store_to_sdcard_task(void *arg);
@@ -118,8 +118,13 @@
 #define EI_CLASSIFIER_TFLITE_LARGEST_ARENA_SIZE  289580
 
 #define EI_CLASSIFIER_INFERENCING_ENGINE            EI_CLASSIFIER_TFLITE
+// 1 runs the ahead-of-time compiled model (tflite-model/tflite_learn_27_compiled.cpp, tools/aot_compile.py)
+#ifndef EI_CLASSIFIER_COMPILED
 #define EI_CLASSIFIER_COMPILED                      0
+#endif // EI_CLASSIFIER_COMPILED
+#ifndef EI_CLASSIFIER_HAS_TFLITE_OPS_RESOLVER
 #define EI_CLASSIFIER_HAS_TFLITE_OPS_RESOLVER       0
+#endif // EI_CLASSIFIER_HAS_TFLITE_OPS_RESOLVER
 
 #define EI_CLASSIFIER_QUANTIZATION_ENABLED       1
 #define EI_CLASSIFIER_LOAD_IMAGE_SCALING         0
@@ -43,6 +43,9 @@
 #include "model_metadata.h"
 
 #include "tflite-model/tflite_learn_27.h"
+#if EI_CLASSIFIER_COMPILED == 1
+#include "tflite-model/tflite_learn_27_compiled.h"
+#endif
 #include "edge-impulse-sdk/classifier/ei_model_types.h"
 #include "edge-impulse-sdk/classifier/inferencing_engines/engines.h"
 
@@ -76,12 +79,23 @@ ei_model_dsp_t ei_dsp_blocks[ei_dsp_blocks_size] = {
         nullptr, // factory function
     }
 };
+#if EI_CLASSIFIER_COMPILED == 1
+const ei_config_tflite_eon_graph_t ei_config_tflite_graph_27 = {
+    .implementation_version = 1,
+    .model_init = &tflite_learn_27_init,
+    .model_invoke = &tflite_learn_27_invoke,
+    .model_reset = &tflite_learn_27_reset,
+    .model_input = &tflite_learn_27_input,
+    .model_output = &tflite_learn_27_output,
+};
+#else
 const ei_config_tflite_graph_t ei_config_tflite_graph_27 = {
     .implementation_version = 1,
     .model = tflite_learn_27,
     .model_size = tflite_learn_27_len,
     .arena_size = tflite_learn_27_arena_size
 };
+#endif // EI_CLASSIFIER_COMPILED == 1
 
 ei_learning_block_config_tflite_graph_t ei_learning_block_config_27 = {
     .implementation_version = 1,
@@ -94,7 +108,7 @@ ei_learning_block_config_tflite_graph_t ei_learning_block_config_27 = {
     .output_score_tensor = 2,
     .threshold = 0.5,
     .quantized = 1,
-    .compiled = 0,
+    .compiled = EI_CLASSIFIER_COMPILED,
     .graph_config = (void*)&ei_config_tflite_graph_27
 };
 
@@ -24,11 +24,10 @@
 
 #include "edge-impulse-sdk/tensorflow/lite/micro/kernels/micro_ops.h"
 
-#define EI_TFLITE_RESOLVER static tflite::MicroMutableOpResolver<5> resolver; \
+#define EI_TFLITE_RESOLVER static tflite::MicroMutableOpResolver<4> resolver; \
     resolver.AddAdd(); \
     resolver.AddConv2D(); \
     resolver.AddDepthwiseConv2D(); \
-    resolver.AddSoftmax(); \
-    resolver.AddPad();
+    resolver.AddSoftmax();
 
 #endif // _EI_CLASSIFIER_TFLITE_RESOLVER_H_
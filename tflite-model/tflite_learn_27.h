@@ -56,2471 +56,2574 @@ const size_t tflite_learn_27_arena_size = 289580;
 
 MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[] = {
   0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
-  0x1c, 0x00, 0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x8c, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xa0, 0x55, 0x00, 0x00,
-  0xb0, 0x55, 0x00, 0x00, 0x54, 0xdb, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f,
-  0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70,
-  0x75, 0x74, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0xfa, 0xa9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff,
-  0x49, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
-  0x43, 0x4f, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d,
-  0x45, 0x54, 0x41, 0x44, 0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f,
-  0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73,
-  0x69, 0x6f, 0x6e, 0x00, 0x4a, 0x00, 0x00, 0x00, 0xb8, 0x54, 0x00, 0x00,
-  0xb0, 0x54, 0x00, 0x00, 0x80, 0x54, 0x00, 0x00, 0x64, 0x54, 0x00, 0x00,
-  0xf4, 0x53, 0x00, 0x00, 0x64, 0x53, 0x00, 0x00, 0x54, 0x47, 0x00, 0x00,
-  0xc4, 0x45, 0x00, 0x00, 0xb4, 0x3f, 0x00, 0x00, 0x64, 0x3f, 0x00, 0x00,
-  0x54, 0x39, 0x00, 0x00, 0xc4, 0x37, 0x00, 0x00, 0x54, 0x34, 0x00, 0x00,
-  0xc4, 0x32, 0x00, 0x00, 0xb4, 0x2c, 0x00, 0x00, 0x64, 0x2c, 0x00, 0x00,
-  0x54, 0x26, 0x00, 0x00, 0xc4, 0x24, 0x00, 0x00, 0x54, 0x21, 0x00, 0x00,
-  0xc4, 0x1f, 0x00, 0x00, 0xb4, 0x19, 0x00, 0x00, 0x64, 0x19, 0x00, 0x00,
-  0x54, 0x16, 0x00, 0x00, 0x84, 0x15, 0x00, 0x00, 0xc4, 0x13, 0x00, 0x00,
-  0xf4, 0x12, 0x00, 0x00, 0x64, 0x11, 0x00, 0x00, 0x34, 0x11, 0x00, 0x00,
-  0xa4, 0x0f, 0x00, 0x00, 0xd4, 0x0e, 0x00, 0x00, 0x14, 0x0d, 0x00, 0x00,
-  0x44, 0x0c, 0x00, 0x00, 0xb4, 0x0a, 0x00, 0x00, 0x84, 0x0a, 0x00, 0x00,
-  0xf4, 0x08, 0x00, 0x00, 0x24, 0x08, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00,
-  0x94, 0x05, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x00,
-  0x44, 0x03, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00,
-  0x04, 0x02, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00,
-  0x54, 0x01, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00,
-  0x3c, 0x01, 0x00, 0x00, 0x34, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00,
-  0x24, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00,
-  0x0c, 0x01, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
-  0xf4, 0x00, 0x00, 0x00, 0xec, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0xdc, 0x00, 0x00, 0x00, 0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00,
-  0xc4, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00,
-  0xac, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00,
-  0x94, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x92, 0xab, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x58, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
-  0x32, 0x2e, 0x31, 0x31, 0x2e, 0x31, 0x00, 0x00, 0xf6, 0xab, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34,
-  0x2e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0xfc, 0x27, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0x04, 0x28, 0xff, 0xff,
-  0x08, 0x28, 0xff, 0xff, 0x0c, 0x28, 0xff, 0xff, 0x10, 0x28, 0xff, 0xff,
-  0x14, 0x28, 0xff, 0xff, 0x18, 0x28, 0xff, 0xff, 0x1c, 0x28, 0xff, 0xff,
-  0x20, 0x28, 0xff, 0xff, 0x24, 0x28, 0xff, 0xff, 0x28, 0x28, 0xff, 0xff,
-  0x2c, 0x28, 0xff, 0xff, 0x30, 0x28, 0xff, 0xff, 0x34, 0x28, 0xff, 0xff,
-  0x38, 0x28, 0xff, 0xff, 0x3c, 0x28, 0xff, 0xff, 0x40, 0x28, 0xff, 0xff,
-  0x44, 0x28, 0xff, 0xff, 0x48, 0x28, 0xff, 0xff, 0x4c, 0x28, 0xff, 0xff,
-  0x50, 0x28, 0xff, 0xff, 0x54, 0x28, 0xff, 0xff, 0x58, 0x28, 0xff, 0xff,
-  0x5c, 0x28, 0xff, 0xff, 0x60, 0x28, 0xff, 0xff, 0x64, 0x28, 0xff, 0xff,
-  0x7e, 0xac, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
-  0xaa, 0x92, 0xe1, 0x43, 0xdb, 0x10, 0x21, 0x7f, 0x12, 0x69, 0xa1, 0xf5,
-  0x81, 0x68, 0x17, 0x0d, 0xfe, 0xf4, 0xe8, 0xff, 0xd1, 0x23, 0x60, 0x7f,
-  0xf3, 0xa1, 0xb0, 0x78, 0x7e, 0x3a, 0x02, 0xeb, 0xf2, 0x9b, 0x81, 0xd5,
-  0x1a, 0xd2, 0xfe, 0x20, 0x81, 0x01, 0x16, 0x9a, 0xe5, 0xb1, 0x0c, 0xfc,
-  0x81, 0x13, 0x01, 0xae, 0x08, 0xfb, 0xf0, 0x4f, 0x7f, 0xce, 0x37, 0xf0,
-  0xdc, 0xcd, 0xa8, 0x2d, 0x1c, 0xf9, 0x7f, 0x3e, 0xf3, 0x26, 0x09, 0xe7,
-  0xeb, 0xe2, 0x34, 0xca, 0xaa, 0x7f, 0xe5, 0xc3, 0x60, 0xe5, 0x2f, 0xfd,
-  0xe2, 0x7f, 0xfa, 0xf8, 0x60, 0xfc, 0x19, 0x58, 0x0c, 0xdb, 0x81, 0xe3,
-  0x0c, 0x27, 0x11, 0x07, 0xed, 0x0a, 0x40, 0xa2, 0x23, 0xab, 0x7f, 0xd3,
-  0xd7, 0x31, 0xf7, 0x81, 0x73, 0x07, 0xb2, 0x4f, 0x06, 0x2d, 0xf4, 0x00,
-  0x69, 0x52, 0x15, 0x6d, 0x7f, 0x36, 0xe2, 0xe5, 0x30, 0x2d, 0x63, 0x81,
-  0xf0, 0xbb, 0x50, 0xa4, 0xd9, 0x10, 0x8c, 0x81, 0x0c, 0xf8, 0xa1, 0xe5,
-  0x1a, 0xad, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0xa9, 0x00, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
-  0x6a, 0x05, 0x00, 0x00, 0x8c, 0xc1, 0x00, 0x00, 0x54, 0xfd, 0x00, 0x00,
-  0xca, 0x0d, 0x00, 0x00, 0x62, 0x22, 0x00, 0x00, 0xc0, 0x13, 0x00, 0x00,
-  0xd5, 0x0e, 0x00, 0x00, 0xe5, 0x03, 0x00, 0x00, 0xd7, 0xff, 0xff, 0xff,
-  0xf6, 0x10, 0x00, 0x00, 0xb6, 0xb5, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00,
-  0x5e, 0xad, 0x00, 0x00, 0x66, 0xad, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x90, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x11, 0xfc, 0xed, 0x09, 0x03, 0x11,
-  0xf6, 0xf3, 0x03, 0x05, 0x08, 0xfd, 0x06, 0xfd, 0xea, 0xf0, 0x15, 0xfe,
-  0x0f, 0xfd, 0x05, 0xe5, 0x00, 0x07, 0xef, 0x51, 0xfb, 0x16, 0xeb, 0x00,
-  0xfa, 0xfe, 0xfb, 0xf4, 0x01, 0xf1, 0xfd, 0x0b, 0x02, 0x00, 0x02, 0xfb,
-  0xfe, 0xfc, 0x01, 0xfd, 0x00, 0xe6, 0x02, 0x06, 0x7f, 0xe9, 0x81, 0xec,
-  0x7f, 0x7f, 0x02, 0x05, 0x7f, 0xe5, 0xf5, 0xe8, 0x81, 0x7f, 0x7f, 0x00,
-  0xab, 0xa5, 0xf6, 0x9a, 0x0c, 0x97, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f,
-  0x11, 0xf1, 0xf8, 0x03, 0xf4, 0x7f, 0x07, 0xf6, 0x00, 0xf4, 0x03, 0xfa,
-  0x0c, 0xf9, 0xea, 0xf2, 0x02, 0xfa, 0xfa, 0xea, 0xef, 0x10, 0x3a, 0x08,
-  0xf5, 0xf8, 0xfd, 0x04, 0x08, 0xfc, 0x01, 0xf3, 0x15, 0xe3, 0xf4, 0x81,
-  0x06, 0xf0, 0xf7, 0x7f, 0xfc, 0x02, 0xe7, 0xf6, 0xf6, 0xbd, 0xda, 0xdc,
-  0xff, 0x02, 0xf5, 0xfb, 0xfe, 0xfb, 0xf8, 0xff, 0x01, 0x02, 0xfb, 0x02,
-  0x06, 0xf5, 0xf8, 0xf2, 0x02, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x3b, 0x5e, 0x00, 0x00, 0x3c, 0xfd, 0xff, 0xff,
-  0x3a, 0x01, 0x00, 0x00, 0xb1, 0x0c, 0x00, 0x00, 0xd6, 0xfc, 0xff, 0xff,
-  0x26, 0x01, 0x00, 0x00, 0x9f, 0x23, 0x00, 0x00, 0x6d, 0x05, 0x00, 0x00,
-  0x35, 0xfc, 0xff, 0xff, 0xa3, 0x01, 0x00, 0x00, 0x36, 0xf8, 0xff, 0xff,
-  0xa0, 0x0d, 0x00, 0x00, 0xca, 0x03, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00,
-  0xf2, 0xfe, 0xff, 0xff, 0x40, 0xfb, 0xff, 0xff, 0x4e, 0xae, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x08, 0xef, 0xe7, 0xb8,
-  0xdf, 0xd8, 0x1a, 0xea, 0x21, 0x09, 0xea, 0xf5, 0x73, 0x7f, 0xf3, 0xa1,
-  0x7f, 0xce, 0xd7, 0x07, 0xd1, 0x43, 0xc5, 0xd2, 0xd2, 0x49, 0xe8, 0xd3,
-  0xf4, 0x06, 0xd4, 0xfa, 0xde, 0x99, 0x31, 0x2b, 0x38, 0xbb, 0xa5, 0xe6,
-  0x23, 0x9e, 0x17, 0x81, 0x35, 0xea, 0xa8, 0x28, 0x1f, 0x0d, 0x1a, 0x01,
-  0xf3, 0x43, 0xcb, 0xf0, 0x7f, 0x32, 0x0f, 0x0c, 0x04, 0xee, 0x0a, 0x14,
-  0xb7, 0xde, 0xd8, 0x81, 0xf0, 0x34, 0x3b, 0x88, 0x23, 0xde, 0xd0, 0xd7,
-  0x94, 0x20, 0xe3, 0xf1, 0x52, 0x2c, 0x3d, 0xd7, 0x2c, 0xda, 0x81, 0x95,
-  0xf1, 0xbd, 0x3a, 0x2f, 0xd6, 0x34, 0x33, 0xdb, 0x5f, 0x29, 0x81, 0xbc,
-  0x14, 0xba, 0x0e, 0xb1, 0xe4, 0x18, 0x9e, 0x4b, 0x53, 0xac, 0x1c, 0x37,
-  0x81, 0xf8, 0x69, 0xd5, 0xc6, 0x02, 0x00, 0xc0, 0xcf, 0x3c, 0x55, 0xe7,
-  0x3a, 0xed, 0x0c, 0x21, 0xda, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x5c, 0xd9, 0xff, 0xff, 0x8f, 0xf0, 0xff, 0xff,
-  0x68, 0x2f, 0x00, 0x00, 0x4e, 0xdd, 0xff, 0xff, 0x85, 0x53, 0x00, 0x00,
-  0xd8, 0x18, 0x00, 0x00, 0x96, 0xda, 0xff, 0xff, 0x5b, 0x31, 0x00, 0x00,
-  0x06, 0xaf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0xcc, 0x1d, 0x0e, 0xdc, 0xa9, 0xd1, 0x81, 0x0f, 0x42, 0xc2, 0xd6, 0xc8,
-  0x7f, 0xb5, 0x5f, 0x14, 0x8c, 0x7f, 0xc3, 0xa9, 0x26, 0xe8, 0xf7, 0x36,
-  0x4c, 0x0d, 0x5e, 0x26, 0x3c, 0x6e, 0x7f, 0xdf, 0xa1, 0x83, 0x4f, 0x05,
-  0xcb, 0x81, 0x08, 0xc0, 0x7f, 0xfd, 0x72, 0x48, 0x9c, 0xdb, 0xf7, 0xe5,
-  0x19, 0x22, 0x7f, 0xe6, 0x2d, 0xe7, 0xdc, 0x17, 0x25, 0x0b, 0x81, 0xe9,
-  0xc9, 0x69, 0x6e, 0xad, 0x0d, 0x4a, 0xfe, 0x1b, 0x22, 0x7f, 0x0e, 0x35,
-  0xd1, 0x5d, 0xa5, 0x56, 0x05, 0x81, 0x19, 0x6e, 0xf2, 0x81, 0xe9, 0xe2,
-  0xae, 0x93, 0xda, 0xa7, 0x81, 0xa5, 0x7a, 0x40, 0xf9, 0xb2, 0x6a, 0x43,
-  0xe5, 0x2c, 0x81, 0x3f, 0x21, 0xd6, 0xc6, 0x53, 0x6c, 0x81, 0x51, 0x67,
-  0xfe, 0x1a, 0x28, 0xbc, 0xdc, 0x68, 0xd7, 0xa2, 0xe9, 0x81, 0xe7, 0xbf,
-  0x07, 0x75, 0x1e, 0xec, 0x31, 0xcf, 0x7f, 0x96, 0x83, 0x81, 0xe8, 0x69,
-  0xd8, 0x25, 0xf8, 0x55, 0xd6, 0x9e, 0x81, 0x58, 0xcb, 0x74, 0xe3, 0x56,
-  0x94, 0xb3, 0xda, 0x3e, 0xfa, 0x39, 0xed, 0x7f, 0x38, 0x97, 0x61, 0x81,
-  0x0d, 0xab, 0x19, 0xd6, 0x09, 0x35, 0x11, 0x06, 0x3a, 0x7f, 0x42, 0xef,
-  0x1e, 0x77, 0x31, 0xdb, 0x26, 0xbd, 0x5f, 0x81, 0x36, 0x07, 0x5b, 0x09,
-  0x07, 0x7f, 0x1c, 0xd3, 0x96, 0xcc, 0x2c, 0xb7, 0x4b, 0x51, 0xc9, 0x81,
-  0x97, 0x9a, 0x3b, 0x96, 0x57, 0x7a, 0xce, 0x81, 0x7f, 0x15, 0xca, 0xea,
-  0x0f, 0x1d, 0xcc, 0xf4, 0xa6, 0xde, 0x81, 0xe2, 0xd8, 0xd2, 0xfc, 0xe8,
-  0x4e, 0x29, 0x00, 0xc2, 0x81, 0xe4, 0x61, 0x6d, 0x9f, 0xa7, 0x01, 0x40,
-  0xb5, 0x81, 0x18, 0xfb, 0x5e, 0x50, 0x22, 0x81, 0x13, 0xf9, 0xbb, 0xac,
-  0xa7, 0xb6, 0x2d, 0xbd, 0x46, 0x59, 0xdb, 0x81, 0x30, 0x22, 0xf5, 0x7f,
-  0x04, 0xaa, 0x07, 0x0e, 0xf6, 0x7f, 0xf1, 0x1f, 0x1c, 0x5e, 0xf0, 0x35,
-  0xfb, 0x7f, 0xaa, 0x1f, 0x1d, 0xf2, 0xe6, 0x0d, 0x81, 0x97, 0xe0, 0x6e,
-  0x01, 0x1f, 0x05, 0x6a, 0xc9, 0x7f, 0xd4, 0xfb, 0x49, 0x66, 0x3d, 0x42,
-  0x4c, 0x1c, 0x00, 0xc0, 0x85, 0xf1, 0x46, 0x7f, 0xb1, 0x79, 0x24, 0x14,
-  0x86, 0x7f, 0xf5, 0x9e, 0x2b, 0x2f, 0x3f, 0x00, 0x7f, 0x3a, 0x64, 0x1e,
-  0xe9, 0xcb, 0x20, 0xf5, 0x0d, 0x2c, 0xb5, 0x7f, 0x96, 0xbc, 0xc5, 0x71,
-  0xfd, 0x08, 0x13, 0x7f, 0x7f, 0x09, 0x49, 0x47, 0xc4, 0xf3, 0xf8, 0xff,
-  0xdb, 0x07, 0xbb, 0x81, 0x38, 0x9b, 0x10, 0x3f, 0x29, 0xfe, 0x54, 0x05,
-  0x24, 0x7f, 0x62, 0x06, 0xe2, 0xec, 0xca, 0x7f, 0x2a, 0x05, 0xcf, 0xe2,
-  0x25, 0x5f, 0x4b, 0xaa, 0x31, 0xc6, 0x1a, 0x81, 0xe6, 0x9a, 0xe4, 0x22,
-  0x0b, 0x2c, 0xc9, 0x7f, 0x06, 0x26, 0x48, 0x0d, 0x40, 0x55, 0x7f, 0xe1,
-  0x92, 0xb0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-  0xbc, 0x02, 0x00, 0x00, 0xf7, 0xfd, 0xff, 0xff, 0xc6, 0xfd, 0xff, 0xff,
-  0x34, 0x04, 0x00, 0x00, 0xfa, 0x1d, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x00,
-  0xde, 0xfe, 0xff, 0xff, 0x69, 0x0c, 0x00, 0x00, 0xa6, 0x04, 0x00, 0x00,
-  0xde, 0x04, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x38, 0x09, 0x00, 0x00,
-  0x1d, 0x03, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xf3, 0xfe, 0xff, 0xff,
-  0xa8, 0x02, 0x00, 0x00, 0x56, 0x09, 0x00, 0x00, 0x51, 0x25, 0x00, 0x00,
-  0x18, 0x09, 0x00, 0x00, 0xa5, 0xfe, 0xff, 0xff, 0xd5, 0x02, 0x00, 0x00,
-  0xf7, 0xfb, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xa7, 0x0c, 0x00, 0x00,
-  0x77, 0xfe, 0xff, 0xff, 0xca, 0xfc, 0xff, 0xff, 0x41, 0x03, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x85, 0x11, 0x00, 0x00, 0x74, 0x38, 0x00, 0x00,
-  0x5f, 0x0b, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff, 0x4b, 0x01, 0x00, 0x00,
-  0x43, 0xff, 0xff, 0xff, 0x18, 0x0a, 0x00, 0x00, 0xca, 0xff, 0xff, 0xff,
-  0xf0, 0x01, 0x00, 0x00, 0xfd, 0xfe, 0xff, 0xff, 0x9a, 0x02, 0x00, 0x00,
-  0xe2, 0x02, 0x00, 0x00, 0x89, 0x05, 0x00, 0x00, 0x3c, 0x06, 0x00, 0x00,
-  0x2b, 0x01, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xa7, 0x01, 0x00, 0x00,
-  0xbd, 0x04, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x00, 0xb3, 0xff, 0xff, 0xff,
-  0x5e, 0xb1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
-  0xde, 0x9c, 0xf4, 0xc1, 0x7f, 0xbd, 0x4f, 0xbf, 0xa4, 0xc2, 0x03, 0xd2,
-  0x5e, 0x45, 0x52, 0x93, 0x38, 0xdb, 0xfc, 0xe6, 0x95, 0x65, 0xef, 0xfc,
-  0x09, 0x2a, 0x43, 0xea, 0x57, 0xa9, 0x03, 0xcd, 0xb9, 0xa9, 0x43, 0x3d,
-  0x19, 0x61, 0x6e, 0xbe, 0xa1, 0xd4, 0x1b, 0x3f, 0x39, 0x9b, 0x4a, 0x68,
-  0xe8, 0x8b, 0xd9, 0x44, 0xb1, 0x75, 0x47, 0xa0, 0xa9, 0x1a, 0x64, 0x85,
-  0x7f, 0x55, 0x77, 0xab, 0xb0, 0xa0, 0x12, 0xd5, 0xc2, 0x7a, 0xb2, 0x4e,
-  0xbb, 0x2e, 0x68, 0x8f, 0x55, 0xc5, 0x02, 0x95, 0x98, 0x94, 0x5f, 0x7f,
-  0x67, 0x74, 0x7f, 0xb2, 0x97, 0xba, 0x3a, 0x47, 0x5e, 0x7f, 0x57, 0x49,
-  0x0e, 0xe6, 0xcc, 0x41, 0xdb, 0xee, 0x25, 0xfa, 0x6d, 0x39, 0x51, 0xb0,
-  0x2c, 0x2f, 0xe5, 0xee, 0xa8, 0xde, 0x1c, 0xdc, 0xee, 0x3b, 0xbe, 0xf1,
-  0xc7, 0x17, 0x20, 0xb7, 0x22, 0x48, 0x6f, 0xcd, 0xe6, 0xff, 0xf5, 0x49,
-  0x3b, 0x5f, 0x30, 0xf0, 0xe4, 0x68, 0x3f, 0x0f, 0x2c, 0x2a, 0x13, 0x95,
-  0xa0, 0xad, 0xf8, 0xa1, 0xc4, 0x92, 0x7f, 0x82, 0x81, 0x81, 0x7a, 0xbb,
-  0x3b, 0x55, 0x8b, 0xc2, 0x7f, 0x81, 0xcd, 0xb8, 0xb0, 0x69, 0xba, 0xf8,
-  0xfa, 0x67, 0x6a, 0xcf, 0x93, 0xa7, 0x04, 0xae, 0xc1, 0x85, 0x81, 0x46,
-  0x24, 0x7f, 0x0a, 0xc2, 0x4f, 0xf8, 0x41, 0x7f, 0x52, 0x75, 0x7c, 0xad,
-  0xa8, 0x81, 0xbe, 0x81, 0xe8, 0x7f, 0x7e, 0x81, 0x52, 0x42, 0x7f, 0x81,
-  0x4d, 0x7f, 0x33, 0x81, 0x2d, 0xbc, 0x8f, 0x81, 0x81, 0x7f, 0x81, 0x7f,
-  0x81, 0x7f, 0x7f, 0x81, 0x81, 0x7f, 0xef, 0x81, 0x81, 0x81, 0x4a, 0x79,
-  0x7f, 0x77, 0xf0, 0x81, 0x7f, 0x93, 0x7f, 0x6c, 0x7f, 0x03, 0x7f, 0x7f,
-  0xe6, 0xfc, 0x81, 0x6c, 0x37, 0xd9, 0x2c, 0xcf, 0x4e, 0x28, 0x12, 0xc9,
-  0x13, 0x36, 0x64, 0xac, 0xe7, 0x02, 0xfa, 0xbb, 0xb6, 0x1f, 0xd2, 0xf0,
-  0x92, 0x35, 0x1c, 0xa6, 0xd2, 0x2d, 0x7f, 0xb9, 0xa2, 0xf9, 0x55, 0x5f,
-  0x4a, 0x48, 0xd5, 0xbe, 0x35, 0x7f, 0x57, 0x12, 0x2d, 0xca, 0x20, 0x26,
-  0xac, 0xca, 0x13, 0x23, 0xc6, 0xd0, 0x3f, 0xe2, 0x16, 0xca, 0x1c, 0x1b,
-  0xe7, 0x2a, 0xcb, 0xda, 0xbc, 0xc8, 0x7f, 0xc3, 0xf4, 0x20, 0x9e, 0xf4,
-  0xfa, 0x2b, 0x4c, 0xd5, 0x03, 0x30, 0xfb, 0xd7, 0x18, 0x90, 0xd0, 0x24,
-  0x12, 0x11, 0xbb, 0xd9, 0x18, 0xff, 0x14, 0x51, 0x2d, 0x2d, 0x1b, 0xc0,
-  0x81, 0xb7, 0xd6, 0xb1, 0x44, 0x31, 0x41, 0xcd, 0x7a, 0x23, 0xcb, 0xf1,
-  0xeb, 0x2b, 0x81, 0xa7, 0x09, 0x04, 0x49, 0xa5, 0xbf, 0x28, 0xc6, 0x2b,
-  0xa1, 0x4e, 0x40, 0xaf, 0x00, 0xf5, 0xf3, 0xac, 0xbc, 0xce, 0xab, 0x60,
-  0x2d, 0x23, 0x8e, 0x89, 0x0a, 0xb7, 0x50, 0x4c, 0x3f, 0x8a, 0x2d, 0xfb,
-  0xe3, 0xdc, 0xd0, 0xd0, 0xf0, 0xf7, 0x35, 0xe1, 0xba, 0x20, 0xdb, 0xfb,
-  0x02, 0x03, 0x20, 0xdd, 0xf7, 0x10, 0x0a, 0xe1, 0xd9, 0x12, 0x0c, 0xf0,
-  0xb7, 0x28, 0xff, 0xdc, 0xef, 0xb8, 0x26, 0xf0, 0xa0, 0x0a, 0x10, 0x4a,
-  0x28, 0x11, 0xcd, 0xd0, 0xf2, 0x14, 0x1e, 0x10, 0x23, 0xe3, 0x13, 0x4a,
-  0x1a, 0xb3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
-  0x89, 0x26, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x00, 0x0e, 0x09, 0x00, 0x00,
-  0x23, 0x08, 0x00, 0x00, 0x26, 0x03, 0x00, 0x00, 0xd4, 0xfe, 0xff, 0xff,
-  0x16, 0xf8, 0xff, 0xff, 0x2d, 0x80, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff,
-  0x95, 0xfc, 0xff, 0xff, 0x2f, 0x1d, 0x00, 0x00, 0x02, 0xca, 0x00, 0x00,
-  0x6c, 0x00, 0x00, 0x00, 0x75, 0x19, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff,
-  0x7a, 0x35, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x89, 0x3e, 0x00, 0x00,
-  0x16, 0xfb, 0xff, 0xff, 0x8f, 0x26, 0x00, 0x00, 0x7e, 0x37, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x11, 0x13, 0x00, 0x00, 0x98, 0xe4, 0xff, 0xff,
-  0x27, 0x2d, 0x00, 0x00, 0xe7, 0x09, 0x00, 0x00, 0x9b, 0x0c, 0x00, 0x00,
-  0x63, 0x37, 0x00, 0x00, 0x81, 0x0c, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00,
-  0x0d, 0xdc, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x1e, 0x16, 0x00, 0x00,
-  0x07, 0x07, 0x00, 0x00, 0xac, 0xf5, 0xff, 0xff, 0x69, 0x2b, 0x00, 0x00,
-  0xd1, 0xd6, 0xff, 0xff, 0xe6, 0x15, 0x00, 0x00, 0x24, 0xfd, 0xff, 0xff,
-  0xa3, 0x4b, 0x00, 0x00, 0x96, 0xf2, 0xff, 0xff, 0x3e, 0x05, 0x00, 0x00,
-  0xb5, 0x03, 0x00, 0x00, 0x67, 0x08, 0x00, 0x00, 0x3f, 0x04, 0x00, 0x00,
-  0x95, 0xfb, 0xff, 0xff, 0x73, 0x02, 0x00, 0x00, 0x20, 0xf6, 0xff, 0xff,
-  0xe6, 0xb3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0xd6, 0x03, 0x1e, 0x06, 0xe3, 0xf2, 0x14, 0x04, 0xd4, 0xf5, 0xbf, 0xd2,
-  0xe7, 0xc0, 0xfe, 0xdb, 0x2b, 0xd3, 0x2a, 0x31, 0xed, 0x22, 0xf2, 0x08,
-  0x07, 0xdc, 0x2e, 0xf6, 0xff, 0xf2, 0x0e, 0x10, 0x4f, 0x20, 0x22, 0x81,
-  0x0f, 0x01, 0xf6, 0xe1, 0x05, 0xeb, 0x2a, 0x33, 0x20, 0xfd, 0x19, 0xfd,
-  0x09, 0x0e, 0x31, 0xe7, 0xfc, 0x27, 0xc5, 0xf2, 0xfa, 0x0a, 0xf1, 0xa2,
-  0x01, 0x5e, 0xe9, 0x3c, 0xe7, 0x0a, 0xeb, 0xc4, 0x0d, 0x9f, 0xd9, 0x0f,
-  0xbb, 0xf9, 0xf4, 0x81, 0xe3, 0xf5, 0x11, 0xa6, 0x25, 0x38, 0xd1, 0xf8,
-  0x7c, 0xe8, 0x08, 0x3d, 0xe2, 0x1c, 0xa8, 0xdd, 0x7a, 0xe9, 0xd9, 0xe0,
-  0x05, 0xe7, 0xc4, 0x13, 0xfe, 0x32, 0x10, 0x0a, 0x01, 0x2c, 0xed, 0x12,
-  0x45, 0xa9, 0x0e, 0xc0, 0x1f, 0xb2, 0x21, 0x21, 0xda, 0x2e, 0xd6, 0x19,
-  0xe2, 0x3a, 0xe8, 0xc0, 0x0a, 0xf8, 0x11, 0xbc, 0xaa, 0x9e, 0x21, 0xf2,
-  0x61, 0x17, 0xf5, 0xc7, 0xfa, 0x21, 0x51, 0x22, 0x7f, 0x13, 0x13, 0x1e,
-  0xea, 0x19, 0xbf, 0x31, 0x15, 0xd9, 0xbb, 0x9d, 0x16, 0xf4, 0xef, 0x0c,
-  0x03, 0x10, 0x1c, 0x4b, 0xf0, 0x05, 0xe9, 0x0d, 0x17, 0x96, 0x24, 0xcf,
-  0xba, 0xf1, 0x7f, 0xf4, 0xe3, 0x00, 0xc2, 0x0d, 0x0a, 0xa5, 0xfe, 0xf2,
-  0xf3, 0xdd, 0xf6, 0x65, 0xd7, 0xdb, 0x04, 0x0c, 0x22, 0x0f, 0xd3, 0x30,
-  0xe7, 0xc8, 0xfe, 0x0e, 0x23, 0xe1, 0xf8, 0xfb, 0x24, 0xda, 0x3f, 0xb5,
-  0x02, 0x17, 0x0c, 0x19, 0xf1, 0xe6, 0x16, 0xf4, 0xfa, 0xcd, 0xfc, 0xea,
-  0x10, 0xfb, 0x24, 0x22, 0x26, 0x10, 0xe9, 0x22, 0xf4, 0xfa, 0xfa, 0x0a,
-  0xbf, 0x64, 0x2a, 0xda, 0x1b, 0xe2, 0xea, 0xf2, 0xb4, 0x09, 0x7f, 0x14,
-  0x43, 0x06, 0xf8, 0x10, 0x15, 0xd5, 0x1c, 0x81, 0x24, 0xe2, 0xf0, 0x62,
-  0xa9, 0x53, 0x1d, 0xb0, 0x02, 0xae, 0x21, 0x12, 0xc5, 0x44, 0xbf, 0xd2,
-  0xca, 0x58, 0xe5, 0x19, 0xe2, 0x34, 0xd3, 0xea, 0xf6, 0x2d, 0x13, 0xff,
-  0xca, 0xe9, 0xd5, 0xd0, 0x0a, 0xde, 0xcd, 0xfe, 0xd6, 0x2e, 0x5d, 0x13,
-  0x2d, 0xd6, 0x13, 0xf4, 0xda, 0xe9, 0xde, 0x1a, 0xd9, 0x01, 0xd5, 0x7f,
-  0xd0, 0xd6, 0xf3, 0x3d, 0x05, 0x3b, 0x14, 0x24, 0x21, 0xa5, 0xf1, 0x10,
-  0x15, 0x21, 0xbf, 0x01, 0x0a, 0xd3, 0x11, 0x28, 0xff, 0x09, 0xe9, 0xff,
-  0x08, 0x10, 0x07, 0xf3, 0xee, 0xf1, 0x28, 0x3c, 0xf7, 0xdd, 0x4e, 0xf6,
-  0xf2, 0xfd, 0xe8, 0x41, 0x1e, 0x24, 0x03, 0x1b, 0x19, 0xf5, 0x4c, 0xf7,
-  0x6d, 0x61, 0x3a, 0x3a, 0x37, 0x26, 0xf8, 0xe8, 0x28, 0xee, 0xb5, 0xf4,
-  0x05, 0x0f, 0xe9, 0x34, 0x18, 0xe7, 0xed, 0xf1, 0x11, 0xf0, 0x1a, 0xa7,
-  0xcc, 0x1f, 0x25, 0x37, 0xec, 0x22, 0x56, 0x7f, 0xcd, 0xe1, 0x9d, 0x2a,
-  0x72, 0xb5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x1b, 0x26, 0x00, 0x00, 0x31, 0x42, 0x00, 0x00, 0x2f, 0xf6, 0xff, 0xff,
-  0x5b, 0x0d, 0x00, 0x00, 0xca, 0xf7, 0xff, 0xff, 0x29, 0x10, 0x00, 0x00,
-  0x02, 0xda, 0xff, 0xff, 0xbc, 0xbb, 0xff, 0xff, 0x9e, 0xb5, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x2b, 0x7f, 0xa5, 0xa8,
-  0xfb, 0x5c, 0x0a, 0x2f, 0x45, 0x9a, 0x01, 0x81, 0xcd, 0x49, 0xa8, 0xd7,
-  0xd4, 0x7f, 0x74, 0x2e, 0x7a, 0xfa, 0x3d, 0x1c, 0x4e, 0x14, 0xb5, 0x23,
-  0xed, 0xb1, 0x81, 0xef, 0xd7, 0x2c, 0x03, 0xc2, 0xa9, 0x76, 0x7f, 0x1e,
-  0x14, 0x63, 0x81, 0xc6, 0x32, 0x41, 0x0d, 0xef, 0xff, 0x68, 0x26, 0x41,
-  0x7f, 0x10, 0x3e, 0xc8, 0x75, 0xf0, 0xdc, 0x1d, 0x4c, 0xe8, 0x7f, 0xfd,
-  0x28, 0x7f, 0x3a, 0x6f, 0x58, 0x4b, 0x67, 0xc1, 0x1e, 0x5d, 0x81, 0xdb,
-  0x08, 0x49, 0xe8, 0x42, 0xb7, 0xb9, 0x2f, 0xbd, 0x0f, 0xed, 0xa3, 0x7f,
-  0xf2, 0x81, 0xa1, 0xd9, 0x12, 0x06, 0x1c, 0xfa, 0xd7, 0x9c, 0x8c, 0xd1,
-  0x81, 0x24, 0x92, 0x12, 0xfa, 0x1b, 0x99, 0x77, 0x81, 0xd8, 0xfb, 0xfa,
-  0xcf, 0xd0, 0x81, 0x04, 0x2b, 0xfb, 0x07, 0xb3, 0x27, 0x81, 0x90, 0x01,
-  0xba, 0xe3, 0xb8, 0xfa, 0x7f, 0xb7, 0xe4, 0x3f, 0xa2, 0x1a, 0x1f, 0x5e,
-  0xdc, 0x69, 0x7f, 0xeb, 0xd7, 0xe7, 0xf1, 0xe9, 0xf1, 0x81, 0x2b, 0x57,
-  0xf9, 0xd2, 0x37, 0xda, 0x7f, 0xc9, 0xbc, 0x1c, 0x9c, 0xf9, 0x1f, 0x5e,
-  0xe0, 0x81, 0x5c, 0x54, 0xe5, 0xa8, 0xf9, 0xba, 0x15, 0xc0, 0xcc, 0xdf,
-  0x7f, 0xe4, 0x1a, 0x18, 0x81, 0x1c, 0xb4, 0x2d, 0x20, 0x21, 0x9a, 0x97,
-  0xc9, 0xc3, 0x17, 0xe6, 0x93, 0x7f, 0x52, 0xe2, 0xfb, 0x1b, 0xf4, 0xcd,
-  0xde, 0x7f, 0x4c, 0x16, 0xf6, 0x81, 0xad, 0xd3, 0x81, 0xe2, 0xcc, 0xab,
-  0x12, 0x42, 0x08, 0x7f, 0xc0, 0x28, 0xb9, 0xf7, 0x13, 0xa2, 0x22, 0x42,
-  0x11, 0xdd, 0xf6, 0x81, 0x0e, 0x42, 0x13, 0x1a, 0x7f, 0x01, 0x26, 0xd5,
-  0x72, 0x10, 0xb8, 0xfa, 0x03, 0x81, 0x8f, 0xfb, 0x14, 0x05, 0x1d, 0x81,
-  0x1d, 0xd5, 0x09, 0xf2, 0x22, 0xb7, 0x0b, 0x45, 0xe6, 0x10, 0x0e, 0x7f,
-  0x8e, 0xea, 0x38, 0xb1, 0xd1, 0x7f, 0x5c, 0x5c, 0xce, 0x23, 0x31, 0xe4,
-  0x1c, 0x7f, 0xa8, 0x49, 0x1e, 0x7f, 0xc8, 0xe9, 0x0f, 0x26, 0xbb, 0x39,
-  0x21, 0x81, 0x23, 0x39, 0xdd, 0xce, 0x12, 0xc9, 0xed, 0xdb, 0xa6, 0xfe,
-  0x81, 0xb7, 0xfe, 0x30, 0xdb, 0x81, 0x35, 0x5b, 0xae, 0xa9, 0xea, 0xad,
-  0xc4, 0x1b, 0x34, 0xd1, 0x81, 0xae, 0xc1, 0x44, 0x60, 0x92, 0x0b, 0x7f,
-  0xea, 0x86, 0xfa, 0xa3, 0xfb, 0x47, 0x06, 0x51, 0x81, 0xf5, 0xbd, 0x03,
-  0x7f, 0x79, 0xab, 0x9f, 0x21, 0x34, 0xed, 0x12, 0x16, 0xd2, 0xe8, 0x00,
-  0x7f, 0xff, 0x21, 0xf0, 0x75, 0x2f, 0x4f, 0x11, 0xa6, 0xec, 0x38, 0x7f,
-  0x56, 0x35, 0xfb, 0x33, 0x7a, 0x81, 0x97, 0x11, 0x15, 0x05, 0x21, 0x2b,
-  0x49, 0x81, 0x11, 0x9c, 0x21, 0xdc, 0xf2, 0x7f, 0x24, 0x2f, 0x18, 0x37,
-  0x96, 0x81, 0x4b, 0x14, 0xc2, 0x2e, 0x48, 0xb2, 0x2a, 0xb7, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x64, 0x09, 0x00, 0x00,
-  0x56, 0x18, 0x00, 0x00, 0xc9, 0x3a, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00,
-  0xf7, 0x06, 0x00, 0x00, 0x18, 0xfb, 0xff, 0xff, 0xb6, 0x14, 0x00, 0x00,
-  0x7b, 0x2c, 0x00, 0x00, 0x5a, 0x0a, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff,
-  0x80, 0x08, 0x00, 0x00, 0xe9, 0xf8, 0xff, 0xff, 0xf6, 0x26, 0x00, 0x00,
-  0x3f, 0xfd, 0xff, 0xff, 0xfa, 0x04, 0x00, 0x00, 0xf3, 0x3a, 0x00, 0x00,
-  0x34, 0xff, 0xff, 0xff, 0x4b, 0x05, 0x00, 0x00, 0xaf, 0x02, 0x00, 0x00,
-  0xdf, 0x08, 0x00, 0x00, 0x18, 0x11, 0x00, 0x00, 0xd1, 0x07, 0x00, 0x00,
-  0x3b, 0x02, 0x00, 0x00, 0x8d, 0x23, 0x00, 0x00, 0x4a, 0x0f, 0x00, 0x00,
-  0x4a, 0x10, 0x00, 0x00, 0xf0, 0x11, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00,
-  0xb4, 0x0f, 0x00, 0x00, 0x27, 0x13, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00,
-  0xa2, 0x03, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x5f, 0x03, 0x00, 0x00,
-  0x33, 0xfe, 0xff, 0xff, 0x65, 0x00, 0x00, 0x00, 0xe8, 0xf7, 0xff, 0xff,
-  0x7c, 0xff, 0xff, 0xff, 0x20, 0x09, 0x00, 0x00, 0x39, 0x08, 0x00, 0x00,
-  0x14, 0x3f, 0x00, 0x00, 0x70, 0x0c, 0x00, 0x00, 0xe7, 0x0b, 0x00, 0x00,
-  0x79, 0x11, 0x00, 0x00, 0x4a, 0x0d, 0x00, 0x00, 0xd8, 0x0d, 0x00, 0x00,
-  0x47, 0x05, 0x00, 0x00, 0xeb, 0x10, 0x00, 0x00, 0xf6, 0xb7, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x02, 0x92, 0x0a, 0x06,
-  0xd0, 0xe4, 0xe9, 0x45, 0xde, 0x0d, 0xc7, 0x0f, 0x47, 0x5d, 0x0c, 0x13,
-  0x50, 0x0f, 0x44, 0x09, 0x23, 0xf8, 0xc5, 0x0e, 0xf5, 0x01, 0xf4, 0xf9,
-  0xd8, 0x54, 0xff, 0x81, 0x38, 0xfd, 0xc5, 0xd0, 0xde, 0xd9, 0x15, 0x0e,
-  0xe2, 0x70, 0x14, 0xec, 0xed, 0x66, 0x76, 0xe4, 0x81, 0x81, 0xea, 0x7f,
-  0xa5, 0x2a, 0xaa, 0x7f, 0x0b, 0x23, 0xc6, 0xf1, 0x38, 0x6d, 0x1f, 0xe6,
-  0xed, 0x39, 0x24, 0x1e, 0x11, 0x7f, 0x18, 0x7f, 0x7f, 0xe1, 0xc1, 0x20,
-  0x4e, 0x81, 0x0e, 0xb3, 0x22, 0xf0, 0xb8, 0x81, 0x0a, 0x1f, 0xc2, 0xd9,
-  0x81, 0x02, 0xb9, 0x81, 0x17, 0x75, 0x60, 0x7f, 0x02, 0x92, 0x09, 0xfb,
-  0xd6, 0x30, 0x18, 0x3f, 0xec, 0xd8, 0xde, 0x09, 0xf0, 0x44, 0x19, 0x0c,
-  0xda, 0x15, 0xad, 0xf2, 0x07, 0xd3, 0x7f, 0x0a, 0xce, 0x0e, 0x00, 0x41,
-  0x21, 0x26, 0x0e, 0x07, 0x11, 0xf9, 0xe9, 0x3c, 0x10, 0x35, 0x08, 0x31,
-  0x11, 0x08, 0x1a, 0xf8, 0xf6, 0x46, 0xd7, 0xd3, 0xea, 0x22, 0xef, 0x0c,
-  0x13, 0xa9, 0x7f, 0xc5, 0xff, 0x06, 0xf6, 0x24, 0x7f, 0x41, 0x0c, 0xe2,
-  0xee, 0xee, 0x26, 0x15, 0x71, 0xcd, 0x32, 0x08, 0xb0, 0x7f, 0xa6, 0xeb,
-  0x7f, 0xa9, 0x00, 0xca, 0xe4, 0x14, 0xb9, 0x15, 0xfa, 0xa4, 0xd7, 0x06,
-  0x64, 0x7f, 0x16, 0x8f, 0xc8, 0xb6, 0xdd, 0x6a, 0x66, 0xdc, 0x7f, 0x17,
-  0x7f, 0x19, 0xc9, 0xe7, 0x2e, 0x7f, 0x7f, 0x81, 0x9d, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x5e, 0x7f, 0x7f, 0x50, 0x00, 0xf7, 0x77, 0x92, 0x81, 0x4c,
-  0x23, 0x75, 0x7f, 0xfc, 0x81, 0x7f, 0x7f, 0x73, 0x81, 0x7f, 0x81, 0x81,
-  0x20, 0x19, 0x81, 0xd9, 0x7f, 0x81, 0xd2, 0x70, 0x0e, 0x58, 0xe0, 0x03,
-  0xc1, 0x7f, 0x97, 0x52, 0x2f, 0x9f, 0x06, 0x34, 0xd0, 0x36, 0x05, 0xbe,
-  0x1b, 0x03, 0x81, 0x10, 0x11, 0x9c, 0xd2, 0xf8, 0x60, 0xe6, 0xef, 0x7f,
-  0xbd, 0xdf, 0xff, 0xe2, 0xe9, 0x10, 0x62, 0xe2, 0x29, 0x04, 0xff, 0xae,
-  0x5d, 0x08, 0x21, 0x3e, 0xcf, 0x6c, 0x7f, 0x9d, 0x01, 0xf3, 0x01, 0xe0,
-  0x1c, 0xc2, 0xff, 0x04, 0x1e, 0x1d, 0xff, 0x14, 0xf6, 0x20, 0x17, 0xf9,
-  0xd9, 0xf1, 0x05, 0xce, 0x10, 0x28, 0x74, 0xed, 0xa2, 0x02, 0x22, 0xdb,
-  0x03, 0x04, 0x10, 0x0a, 0x24, 0x09, 0xc7, 0x0e, 0xfc, 0xd6, 0xe9, 0x2b,
-  0xec, 0xee, 0x0f, 0x0e, 0xde, 0x08, 0x10, 0x31, 0x24, 0xf3, 0xd6, 0xe2,
-  0x30, 0x13, 0x6f, 0xc1, 0x7f, 0xd2, 0x00, 0xff, 0xb7, 0x02, 0xdd, 0xa6,
-  0xec, 0x3e, 0xf6, 0x21, 0xfa, 0x3a, 0xf1, 0xd3, 0xb1, 0x2f, 0x43, 0xf0,
-  0x9f, 0x04, 0xfd, 0xf6, 0x09, 0x0a, 0xdf, 0xf7, 0x3e, 0xce, 0xe0, 0x72,
-  0x9f, 0xbd, 0xd6, 0x1b, 0x15, 0x3c, 0x2c, 0x92, 0xfa, 0xf2, 0xff, 0xe9,
-  0xf2, 0x06, 0xf6, 0xd3, 0xfa, 0xd8, 0x07, 0x16, 0x0c, 0x13, 0xf0, 0x05,
-  0x2f, 0x0b, 0xe5, 0xfc, 0x0a, 0x25, 0xcb, 0xe8, 0x21, 0xd7, 0x14, 0xe9,
-  0xe4, 0xf9, 0x01, 0x12, 0x27, 0xf8, 0xec, 0xda, 0x08, 0x0f, 0x0f, 0x19,
-  0xf3, 0xb9, 0xfc, 0x03, 0xec, 0x1f, 0x7b, 0xd0, 0xb2, 0xb9, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0xff,
-  0x9c, 0x30, 0x00, 0x00, 0xb2, 0xfd, 0xff, 0xff, 0x09, 0xfb, 0xff, 0xff,
-  0x37, 0x0d, 0x00, 0x00, 0x84, 0xfa, 0xff, 0xff, 0xa4, 0x02, 0x00, 0x00,
-  0xb2, 0xe9, 0xff, 0xff, 0x40, 0xf1, 0xff, 0xff, 0xb7, 0xfd, 0xff, 0xff,
-  0xee, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-  0x2e, 0xeb, 0xff, 0xff, 0x9f, 0xed, 0xff, 0xff, 0xf4, 0x11, 0x00, 0x00,
-  0x5a, 0x1b, 0x00, 0x00, 0x18, 0x0b, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00,
-  0x17, 0xed, 0xff, 0xff, 0x0d, 0xd0, 0xff, 0xff, 0x5c, 0xf1, 0xff, 0xff,
-  0xa7, 0x56, 0x00, 0x00, 0xa7, 0xfb, 0xff, 0xff, 0xce, 0xf5, 0xff, 0xff,
-  0x9f, 0xfe, 0xff, 0xff, 0xab, 0x17, 0x00, 0x00, 0x23, 0xe6, 0xff, 0xff,
-  0x0f, 0xf9, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x17, 0xe1, 0xff, 0xff,
-  0x2e, 0x1f, 0x00, 0x00, 0x18, 0x08, 0x00, 0x00, 0x7b, 0xfd, 0xff, 0xff,
-  0x59, 0x0e, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00,
-  0xd6, 0xfb, 0xff, 0xff, 0xed, 0x2b, 0x00, 0x00, 0x53, 0xfd, 0xff, 0xff,
-  0xef, 0x14, 0x00, 0x00, 0x3a, 0xfb, 0xff, 0xff, 0xe1, 0x09, 0x00, 0x00,
-  0xcf, 0x19, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x16, 0x1d, 0x00, 0x00,
-  0x88, 0xfb, 0xff, 0xff, 0xa4, 0xf8, 0xff, 0xff, 0x7e, 0xba, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xd7, 0xcc, 0x06, 0x96,
-  0x11, 0xf5, 0x5f, 0x4c, 0xa1, 0xa2, 0x06, 0x21, 0xc4, 0x02, 0xc6, 0x1a,
-  0xb6, 0x10, 0x00, 0x79, 0x4b, 0xe8, 0x01, 0x7f, 0x54, 0x22, 0x1b, 0x24,
-  0xa2, 0xbf, 0xbe, 0xe4, 0xcc, 0x6c, 0x2b, 0xda, 0x14, 0xe8, 0x5e, 0xfc,
-  0x1d, 0x06, 0xea, 0xaa, 0x09, 0xd4, 0xe4, 0xc0, 0xfe, 0x44, 0xe1, 0xb7,
-  0x98, 0x3c, 0xe2, 0xb3, 0xd7, 0x36, 0xdb, 0xff, 0x25, 0x27, 0xbb, 0x00,
-  0xf4, 0x81, 0x58, 0xc6, 0x7d, 0x1a, 0xc3, 0x19, 0x3b, 0xf4, 0xae, 0x46,
-  0x1b, 0xf1, 0x45, 0x20, 0xc7, 0xf6, 0x09, 0x0d, 0x03, 0x5b, 0xea, 0xd6,
-  0x44, 0x28, 0xec, 0x1d, 0x7e, 0xf0, 0xe2, 0x35, 0xfc, 0xe9, 0x76, 0xfd,
-  0x57, 0xd5, 0x05, 0x05, 0xcf, 0x09, 0xe8, 0x2c, 0xf0, 0xcb, 0xd9, 0x81,
-  0xd2, 0x96, 0xef, 0x14, 0x89, 0x1e, 0xe3, 0xd0, 0xc7, 0x24, 0xff, 0xd2,
-  0xe7, 0x02, 0xe5, 0xe9, 0xea, 0xf8, 0x0c, 0x0d, 0x23, 0xe3, 0xca, 0x0a,
-  0x35, 0xd8, 0x1b, 0xd7, 0xe6, 0xd2, 0xc2, 0xb9, 0x3a, 0x23, 0x34, 0x0b,
-  0x0e, 0xcc, 0xf2, 0x22, 0xb5, 0xd4, 0x12, 0xee, 0x94, 0x48, 0xed, 0x21,
-  0x35, 0x0e, 0xd8, 0x07, 0xac, 0xcd, 0x7f, 0xd3, 0xec, 0xee, 0xc8, 0xc7,
-  0x95, 0x52, 0x5f, 0xb9, 0xf1, 0x82, 0xfd, 0x32, 0x20, 0xa3, 0xe4, 0x51,
-  0xaf, 0xa5, 0x0c, 0xfe, 0xb0, 0xfa, 0x35, 0xf0, 0x18, 0xee, 0x5d, 0xe8,
-  0x0c, 0x00, 0xfc, 0x09, 0xbd, 0xe8, 0xf5, 0xf2, 0x21, 0xbd, 0x2d, 0xa1,
-  0x2e, 0x33, 0xf0, 0xd9, 0x10, 0x27, 0x1c, 0x01, 0x06, 0xec, 0x53, 0xe9,
-  0x26, 0x23, 0x81, 0xee, 0xd5, 0xf8, 0x19, 0x08, 0x2c, 0xf0, 0x25, 0x07,
-  0xd4, 0xf3, 0xa0, 0x2a, 0xf2, 0xa2, 0x09, 0x27, 0x0e, 0xca, 0x27, 0x2d,
-  0x17, 0x27, 0x20, 0x29, 0xb7, 0x08, 0xe0, 0x30, 0x2e, 0xe8, 0x05, 0xd7,
-  0x4a, 0x44, 0x15, 0xe6, 0x41, 0xb1, 0x7f, 0xa1, 0xe4, 0x39, 0x07, 0x24,
-  0x0b, 0x0d, 0xdc, 0xd6, 0xf5, 0xcf, 0xce, 0xfb, 0x25, 0x16, 0x3c, 0x07,
-  0xa7, 0x25, 0x24, 0x19, 0x1c, 0xff, 0x57, 0xfb, 0xc8, 0x2a, 0xa0, 0x55,
-  0x29, 0x1d, 0x0e, 0x0e, 0xf2, 0x09, 0x2e, 0xa7, 0x9e, 0xda, 0xe2, 0x23,
-  0xa2, 0x19, 0x09, 0x46, 0x11, 0x27, 0xce, 0xbf, 0xe3, 0xf6, 0x12, 0x29,
-  0xec, 0xef, 0xd8, 0x06, 0x1a, 0x39, 0xf3, 0xea, 0x04, 0x0e, 0x48, 0x04,
-  0x3f, 0x3c, 0xc0, 0xc1, 0xfe, 0x7f, 0xe0, 0xc4, 0x1b, 0x47, 0xbc, 0x23,
-  0xf8, 0x24, 0x70, 0x5a, 0x2b, 0x3a, 0x81, 0x11, 0xcc, 0x08, 0xc0, 0xce,
-  0x09, 0x37, 0x76, 0x5c, 0x6a, 0x05, 0x5b, 0x0e, 0x76, 0x53, 0xd3, 0x5d,
-  0xce, 0x19, 0x0d, 0xaa, 0x24, 0xbc, 0xf2, 0x2b, 0x15, 0x48, 0xc2, 0x2d,
-  0xb7, 0x17, 0x0a, 0xa6, 0x43, 0xd9, 0x34, 0xf5, 0x0a, 0xbc, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
-  0x4a, 0x13, 0x00, 0x00, 0x13, 0x56, 0x00, 0x00, 0x1d, 0x04, 0x00, 0x00,
-  0x8d, 0x04, 0x00, 0x00, 0xc7, 0xd3, 0xff, 0xff, 0xae, 0xf9, 0xff, 0xff,
-  0xd4, 0xdb, 0xff, 0xff, 0x36, 0xbc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x80, 0x01, 0x00, 0x00, 0x49, 0x2b, 0x7f, 0xf6, 0x41, 0x6c, 0xad, 0xbd,
-  0x0c, 0x9c, 0x81, 0x07, 0x2b, 0x23, 0x31, 0xf9, 0x81, 0x06, 0xd7, 0xe8,
-  0x2a, 0x18, 0xbd, 0xd6, 0x21, 0x51, 0x7f, 0xd8, 0xeb, 0x82, 0xc7, 0xe2,
-  0x81, 0x14, 0xde, 0xec, 0x34, 0x12, 0xe2, 0xda, 0x9a, 0x0f, 0xbb, 0xfb,
-  0x13, 0x24, 0xae, 0x81, 0xca, 0x82, 0x81, 0x49, 0x61, 0xe3, 0x23, 0x21,
-  0xc1, 0x99, 0xaf, 0xbf, 0x81, 0xbf, 0x14, 0x47, 0x5b, 0x27, 0xfc, 0x07,
-  0x69, 0xad, 0x81, 0x11, 0xdf, 0x2f, 0xd9, 0x61, 0xd4, 0xe3, 0x7f, 0xd5,
-  0xe7, 0x7f, 0x11, 0x39, 0x75, 0xe0, 0x03, 0x37, 0xb0, 0xe2, 0xdf, 0xfd,
-  0xa4, 0x2e, 0x7f, 0xf8, 0x53, 0x1c, 0x81, 0x13, 0xfe, 0xd2, 0xb6, 0xec,
-  0x39, 0xf8, 0xc0, 0x02, 0xfa, 0x81, 0xe5, 0xfe, 0x16, 0x90, 0x58, 0x0b,
-  0x7f, 0xa7, 0xe3, 0xf7, 0xde, 0xdf, 0xf1, 0x7f, 0x2a, 0x33, 0xd2, 0x07,
-  0x5f, 0x26, 0xe4, 0x13, 0x35, 0xbe, 0x81, 0xee, 0x30, 0x7f, 0x3c, 0x4a,
-  0x24, 0x21, 0x1c, 0xa7, 0x0c, 0xe1, 0x23, 0x2e, 0x7f, 0xed, 0x0f, 0x0e,
-  0x16, 0x7f, 0x19, 0x0b, 0x83, 0x0a, 0xf6, 0xe0, 0xef, 0x2e, 0x36, 0x81,
-  0x18, 0x12, 0xdd, 0x68, 0xd4, 0x44, 0x1f, 0x8a, 0x23, 0x2e, 0xfd, 0x7f,
-  0xb8, 0xc1, 0xc7, 0x13, 0x85, 0x7f, 0x66, 0xec, 0x64, 0xf9, 0x81, 0x28,
-  0xf8, 0xe4, 0xbc, 0xd3, 0xd6, 0x2c, 0x16, 0x01, 0xd3, 0x3b, 0x81, 0x59,
-  0xa9, 0xd5, 0x81, 0x0c, 0xc8, 0xb3, 0x40, 0x4d, 0x4a, 0xf7, 0xdf, 0xd1,
-  0x6a, 0xe6, 0x7f, 0xcd, 0x7f, 0xc0, 0x18, 0x58, 0x10, 0x2c, 0xf2, 0x69,
-  0x34, 0x56, 0x1e, 0xef, 0x7f, 0xd4, 0x48, 0xc2, 0x07, 0xda, 0xe4, 0xa8,
-  0x8d, 0x1a, 0x7f, 0xca, 0x19, 0x8e, 0xb1, 0xbe, 0x81, 0xfb, 0x1a, 0xdd,
-  0x1a, 0x19, 0xf0, 0xe6, 0x81, 0x01, 0xd7, 0xee, 0x21, 0xc3, 0xcd, 0x3f,
-  0xfc, 0xaa, 0x7f, 0x97, 0x27, 0x7f, 0x2b, 0x47, 0x24, 0xe7, 0xfd, 0xda,
-  0x82, 0xef, 0x58, 0x06, 0xe7, 0x7f, 0x45, 0x28, 0x05, 0x72, 0x7f, 0xf9,
-  0xb8, 0x94, 0xac, 0x14, 0x90, 0x0d, 0x4c, 0x0c, 0x08, 0x7f, 0x34, 0x2e,
-  0xe9, 0xa4, 0xee, 0x9c, 0xc8, 0x81, 0x64, 0x24, 0x35, 0xd8, 0x67, 0xad,
-  0x39, 0x45, 0x81, 0x07, 0xfb, 0x6f, 0x81, 0xbd, 0xec, 0x40, 0xea, 0x7a,
-  0x35, 0xcf, 0x27, 0x2c, 0x0c, 0x02, 0x11, 0x7f, 0xd8, 0x7f, 0x60, 0x0e,
-  0xfb, 0x39, 0x9e, 0x0c, 0x2f, 0xc0, 0x81, 0xf8, 0xc0, 0x06, 0x06, 0xce,
-  0x01, 0xbc, 0x00, 0xac, 0x7f, 0xaf, 0x05, 0x2b, 0x26, 0x77, 0x7f, 0x15,
-  0xe7, 0x1c, 0x9d, 0x23, 0xc9, 0x2d, 0x13, 0x4e, 0x81, 0x2e, 0x88, 0x1c,
-  0xd4, 0xd5, 0x35, 0x1f, 0xa9, 0x81, 0x0b, 0x04, 0xd9, 0x37, 0x2b, 0xdc,
-  0x81, 0x2e, 0x05, 0x17, 0xc2, 0xbd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xc0, 0x00, 0x00, 0x00, 0x90, 0x05, 0x00, 0x00, 0x2c, 0xfc, 0xff, 0xff,
-  0x01, 0x03, 0x00, 0x00, 0xbe, 0xf9, 0xff, 0xff, 0x9a, 0x0d, 0x00, 0x00,
-  0x74, 0xfd, 0xff, 0xff, 0x6b, 0x10, 0x00, 0x00, 0x9c, 0xf4, 0xff, 0xff,
-  0x0e, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0xca, 0x07, 0x00, 0x00,
-  0x15, 0x0f, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x68, 0xfd, 0xff, 0xff,
-  0x6c, 0x05, 0x00, 0x00, 0xd2, 0x10, 0x00, 0x00, 0x0e, 0xf9, 0xff, 0xff,
-  0x73, 0x0c, 0x00, 0x00, 0xc9, 0x17, 0x00, 0x00, 0x76, 0x03, 0x00, 0x00,
-  0xfc, 0x00, 0x00, 0x00, 0xdc, 0x07, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0xdb, 0x0e, 0x00, 0x00, 0xc3, 0x05, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00,
-  0x23, 0x04, 0x00, 0x00, 0xfb, 0xfa, 0xff, 0xff, 0xcb, 0x63, 0x00, 0x00,
-  0xb6, 0xff, 0xff, 0xff, 0x28, 0x06, 0x00, 0x00, 0xef, 0xf8, 0xff, 0xff,
-  0x85, 0xfd, 0xff, 0xff, 0x40, 0x10, 0x00, 0x00, 0xcd, 0xff, 0xff, 0xff,
-  0x4a, 0x0a, 0x00, 0x00, 0x05, 0x0a, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00,
-  0xc0, 0xff, 0xff, 0xff, 0xf4, 0x15, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00,
-  0x67, 0x1e, 0x00, 0x00, 0x3e, 0xf3, 0xff, 0xff, 0xdb, 0x02, 0x00, 0x00,
-  0x54, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00,
-  0xae, 0x0a, 0x00, 0x00, 0x8e, 0xbe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xb0, 0x01, 0x00, 0x00, 0x87, 0x75, 0x81, 0x50, 0x81, 0x59, 0xd2, 0x39,
-  0x81, 0xa8, 0x5e, 0xb2, 0x74, 0xb5, 0xf4, 0xa9, 0x4b, 0x4a, 0x50, 0xa3,
-  0x77, 0x81, 0x67, 0xb2, 0x97, 0xa0, 0x59, 0x7d, 0xae, 0xfe, 0x82, 0x43,
-  0x4b, 0xa7, 0x53, 0x94, 0x85, 0xb3, 0x55, 0x93, 0xdb, 0x99, 0x7f, 0xb0,
-  0x57, 0x33, 0xb0, 0xb1, 0x81, 0x7f, 0xb7, 0x4f, 0xb2, 0x70, 0xd6, 0x5e,
-  0x99, 0x81, 0x7f, 0x8f, 0x7f, 0x8c, 0xdc, 0x9e, 0x4c, 0x61, 0x7f, 0x81,
-  0x7f, 0xa2, 0x6a, 0xab, 0x81, 0x90, 0x59, 0x7f, 0x2d, 0xf1, 0x81, 0x7f,
-  0x5f, 0x81, 0x59, 0x81, 0x85, 0x8d, 0x63, 0x81, 0x81, 0x46, 0x7d, 0x9c,
-  0xd6, 0x5b, 0x81, 0x81, 0xf4, 0x68, 0xe0, 0x0c, 0xf2, 0x4c, 0xed, 0x1d,
-  0xb8, 0xc1, 0x4e, 0xd4, 0x37, 0xb0, 0x00, 0xd1, 0x02, 0x3a, 0x40, 0xe2,
-  0x4f, 0xae, 0x44, 0xda, 0xb5, 0xe2, 0x1d, 0x50, 0x70, 0x19, 0x98, 0x4a,
-  0x2c, 0xbc, 0x2a, 0xef, 0xd3, 0xc1, 0x2d, 0xb1, 0x85, 0xd6, 0x42, 0xfc,
-  0xa8, 0x16, 0xb4, 0xa0, 0x9c, 0x37, 0xbb, 0x71, 0xa6, 0x7f, 0x81, 0x73,
-  0xa2, 0xa4, 0x4f, 0xab, 0x6a, 0xaf, 0xa7, 0x93, 0x70, 0x66, 0xe4, 0x9f,
-  0x4e, 0xb1, 0x6d, 0xa5, 0xc4, 0x9d, 0x5f, 0x6d, 0x81, 0xc0, 0x9f, 0x56,
-  0x6a, 0x19, 0x6a, 0x92, 0x9a, 0x82, 0x6e, 0x99, 0x9c, 0x81, 0x6b, 0x92,
-  0x7f, 0x50, 0xaf, 0xb2, 0x87, 0x61, 0xae, 0x7f, 0x9b, 0x7c, 0x86, 0x7f,
-  0xb9, 0x81, 0x6e, 0x81, 0x7f, 0x9a, 0x81, 0x81, 0x7f, 0x7f, 0xee, 0x90,
-  0x4c, 0xc1, 0x7f, 0x81, 0xc4, 0x81, 0x7f, 0x76, 0x28, 0xbe, 0x9c, 0x60,
-  0x7f, 0x19, 0x7f, 0xad, 0x81, 0x81, 0x7f, 0x93, 0x88, 0x53, 0x7a, 0x97,
-  0xc1, 0x7f, 0xaf, 0x9a, 0xcf, 0x4b, 0x90, 0x22, 0xc3, 0x27, 0xc3, 0x54,
-  0xeb, 0xc6, 0x51, 0xa5, 0x2b, 0x94, 0x9b, 0xe7, 0x29, 0x3b, 0xe3, 0xd4,
-  0x24, 0xdb, 0x66, 0xe2, 0xe7, 0xd6, 0x27, 0x67, 0x7d, 0xea, 0xc1, 0x3a,
-  0x30, 0x03, 0x29, 0xde, 0xc0, 0xc5, 0x3a, 0xb6, 0xc4, 0xc9, 0x56, 0xbf,
-  0x8b, 0x44, 0xd6, 0xad, 0xae, 0x1a, 0xfa, 0x31, 0xdb, 0x4f, 0xb7, 0x4d,
-  0xc6, 0xda, 0x18, 0xd3, 0x4b, 0xb4, 0xc6, 0xb5, 0x49, 0x28, 0xa0, 0xb8,
-  0x07, 0xce, 0x44, 0xdd, 0x05, 0xd5, 0x24, 0x18, 0xbb, 0x9c, 0xc2, 0x52,
-  0x41, 0x2e, 0x34, 0xa6, 0xc9, 0xb5, 0x1b, 0xb9, 0xae, 0xaf, 0x3b, 0x91,
-  0x56, 0x32, 0xe1, 0xcc, 0xa2, 0x30, 0xb2, 0x51, 0xb2, 0x45, 0x99, 0x6b,
-  0xb7, 0xc3, 0x25, 0xc5, 0x39, 0x81, 0x95, 0xb4, 0x50, 0x36, 0x85, 0xb2,
-  0xf3, 0xfa, 0x58, 0xcd, 0x02, 0xce, 0x40, 0x46, 0x16, 0x81, 0xae, 0x53,
-  0x43, 0x4c, 0x45, 0xd3, 0xbf, 0xb4, 0x2f, 0xba, 0xc6, 0x3e, 0x22, 0x81,
-  0xd8, 0x4c, 0xe2, 0xda, 0xd3, 0x44, 0x8a, 0x2d, 0xde, 0x09, 0xc2, 0x53,
-  0xe6, 0x0f, 0x25, 0xdc, 0x1e, 0xc3, 0xa6, 0x02, 0x24, 0x0a, 0x9d, 0xe1,
-  0xfa, 0xf3, 0x46, 0xe1, 0x17, 0xfb, 0x0f, 0x3d, 0x5f, 0x97, 0x9a, 0x08,
-  0x25, 0x3d, 0x38, 0xd0, 0xce, 0xd2, 0x19, 0xe3, 0xfb, 0xe2, 0x38, 0xde,
-  0xb2, 0x3c, 0x03, 0xcf, 0x4a, 0xc0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0xc0, 0x00, 0x00, 0x00, 0xfb, 0x3d, 0x00, 0x00, 0x2c, 0xff, 0xff, 0xff,
-  0xda, 0x4d, 0x00, 0x00, 0xe9, 0xff, 0xff, 0xff, 0xc0, 0x47, 0x00, 0x00,
-  0xe5, 0xf9, 0xff, 0xff, 0x6f, 0x9f, 0x00, 0x00, 0x39, 0xfd, 0xff, 0xff,
-  0x17, 0x22, 0x00, 0x00, 0x79, 0xd2, 0x00, 0x00, 0x90, 0x0a, 0x00, 0x00,
-  0x43, 0x79, 0x00, 0x00, 0x13, 0xf1, 0xff, 0xff, 0x60, 0x35, 0x00, 0x00,
-  0x13, 0x96, 0x00, 0x00, 0x52, 0x7c, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00,
-  0x74, 0xfb, 0xff, 0xff, 0x64, 0x09, 0x00, 0x00, 0x80, 0xbe, 0x00, 0x00,
-  0xa8, 0x08, 0x00, 0x00, 0xb9, 0x48, 0x00, 0x00, 0x36, 0xf5, 0xff, 0xff,
-  0xe1, 0x31, 0x00, 0x00, 0x3f, 0x29, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00,
-  0xee, 0x0b, 0x00, 0x00, 0xbd, 0xfb, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xff,
-  0x71, 0x5c, 0x00, 0x00, 0x5b, 0x78, 0x00, 0x00, 0xa0, 0xfd, 0xff, 0xff,
-  0x84, 0x03, 0x00, 0x00, 0x7a, 0x06, 0x00, 0x00, 0xf6, 0x01, 0x00, 0x00,
-  0x89, 0x3f, 0x00, 0x00, 0x08, 0x33, 0x00, 0x00, 0xf0, 0xaf, 0x00, 0x00,
-  0xb2, 0x0e, 0x00, 0x00, 0x1c, 0x6b, 0x00, 0x00, 0xfa, 0x6e, 0x00, 0x00,
-  0xda, 0x1a, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0xc7, 0x35, 0x00, 0x00,
-  0xfa, 0x0b, 0x00, 0x00, 0x4b, 0x05, 0x00, 0x00, 0x45, 0x87, 0x00, 0x00,
-  0x4e, 0x7b, 0x00, 0x00, 0x16, 0xc1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x00, 0x00, 0x18, 0x28, 0x1b, 0xdc, 0x32, 0x3b, 0xe4, 0x35,
-  0x03, 0x56, 0x02, 0x20, 0xf2, 0x25, 0xfc, 0x2b, 0x10, 0x42, 0x08, 0xc1,
-  0xd2, 0x58, 0xfb, 0x23, 0x50, 0x11, 0x26, 0x34, 0xe6, 0xc3, 0xdd, 0x43,
-  0xf2, 0x04, 0xbd, 0x1e, 0x30, 0x81, 0xdc, 0x11, 0x0f, 0xdc, 0x51, 0xf5,
-  0xf4, 0xcb, 0xb8, 0xde, 0xd9, 0x04, 0xc2, 0xc9, 0x0f, 0x4b, 0xc5, 0x13,
-  0xf9, 0xe3, 0xdb, 0x37, 0x3f, 0xfb, 0xd1, 0xdd, 0xdb, 0xe7, 0x05, 0x10,
-  0xca, 0x3f, 0x96, 0xcf, 0xd3, 0xe7, 0x35, 0x2f, 0xd7, 0xf2, 0x2f, 0xeb,
-  0xfe, 0xc9, 0xdf, 0x3c, 0x1c, 0xda, 0x7f, 0xe2, 0xed, 0x24, 0xe5, 0xf2,
-  0x23, 0x2c, 0x29, 0x18, 0x14, 0x06, 0x21, 0xfc, 0xef, 0xc6, 0x09, 0xe0,
-  0x5b, 0x36, 0xcd, 0x0f, 0x7f, 0xce, 0x79, 0x42, 0xbe, 0xfb, 0xf7, 0x25,
-  0x5c, 0xa6, 0xdc, 0xa4, 0xea, 0xd8, 0x25, 0xc7, 0x37, 0x26, 0xe4, 0x19,
-  0x00, 0xee, 0x3f, 0x34, 0xcd, 0x1a, 0x0e, 0xd0, 0x0d, 0x1c, 0x57, 0xe6,
-  0x09, 0xa9, 0x65, 0xab, 0x2a, 0xfd, 0xe1, 0xe1, 0x18, 0x78, 0x18, 0x03,
-  0x28, 0xc6, 0x1b, 0xe3, 0xcf, 0x12, 0x08, 0x39, 0xd5, 0xb4, 0x34, 0x81,
-  0x01, 0x0f, 0xe5, 0x04, 0xde, 0x57, 0x7f, 0x44, 0x11, 0xcf, 0x19, 0x36,
-  0x42, 0xd2, 0x5b, 0x18, 0xd0, 0xc7, 0x00, 0x2d, 0x13, 0x0b, 0x0c, 0xf6,
-  0x13, 0x1e, 0xed, 0xe9, 0x5f, 0xe7, 0x11, 0xca, 0x64, 0x58, 0x2b, 0x04,
-  0x1d, 0xfb, 0x9d, 0x1e, 0x28, 0xe9, 0xfd, 0xf4, 0x99, 0x94, 0xde, 0xaa,
-  0xfd, 0x14, 0xdb, 0xc4, 0xa7, 0x7f, 0xb6, 0x78, 0xfb, 0xc8, 0x22, 0x5c,
-  0x11, 0xc2, 0x09, 0xf6, 0xdc, 0x13, 0xdc, 0x18, 0xd0, 0xe4, 0xfc, 0x35,
-  0xc7, 0x72, 0xf2, 0xbb, 0xf4, 0xf4, 0xc1, 0x12, 0xe4, 0x37, 0x1c, 0xf6,
-  0x37, 0x40, 0x28, 0x5d, 0x34, 0xe7, 0x1b, 0xf5, 0xd0, 0x7f, 0xdf, 0x26,
-  0xfd, 0xf3, 0xbd, 0xf5, 0x18, 0xfd, 0xba, 0xdd, 0xf6, 0x28, 0x11, 0xef,
-  0xc5, 0x18, 0x26, 0xff, 0xd6, 0x01, 0xa8, 0xf7, 0x4b, 0xeb, 0x18, 0x3f,
-  0xd3, 0x01, 0xd2, 0x19, 0x18, 0x01, 0x06, 0x4f, 0x13, 0xe4, 0x7c, 0x06,
-  0xe0, 0x53, 0x7d, 0x55, 0x1a, 0x4a, 0xe1, 0x3a, 0x0d, 0xd4, 0xc1, 0x65,
-  0x3b, 0xc7, 0xcb, 0x3e, 0xaa, 0x61, 0x48, 0x00, 0x58, 0x19, 0xe2, 0xf3,
-  0x46, 0xfb, 0x81, 0xd5, 0x50, 0x1c, 0x04, 0x14, 0x06, 0x2f, 0x3c, 0xea,
-  0x3c, 0x76, 0x2c, 0xe7, 0x9b, 0xfa, 0xf1, 0x17, 0xcf, 0xcf, 0x1a, 0x32,
-  0x55, 0x6a, 0xcb, 0xa1, 0x9c, 0x0b, 0xe9, 0xf0, 0x99, 0x69, 0x08, 0x7f,
-  0xd8, 0x35, 0x13, 0x22, 0x01, 0x95, 0xed, 0xb0, 0x24, 0x3b, 0xfd, 0x12,
-  0x04, 0xfa, 0x0f, 0xf3, 0xf0, 0xd3, 0x6f, 0x1f, 0x0b, 0x14, 0x1d, 0xe7,
-  0x1f, 0x3f, 0xe1, 0xfa, 0xe5, 0x9c, 0x34, 0xbc, 0x3c, 0xc5, 0x55, 0xbf,
-  0xf2, 0x9b, 0x29, 0x1c, 0xda, 0x20, 0x22, 0x37, 0xf8, 0x0d, 0xe0, 0x6e,
-  0x1a, 0x2a, 0xda, 0x19, 0x60, 0x02, 0xce, 0xe1, 0x9d, 0xdb, 0xb8, 0x82,
-  0xe4, 0xb7, 0xf9, 0x57, 0x04, 0x22, 0x7b, 0x22, 0x18, 0xe4, 0x68, 0x7f,
-  0xeb, 0xa9, 0xef, 0x46, 0x10, 0xe3, 0x01, 0xc1, 0x18, 0x3e, 0xd0, 0x2b,
-  0x30, 0xc0, 0xf0, 0xe6, 0x0f, 0xcc, 0x72, 0xf4, 0xf1, 0x92, 0x32, 0x24,
-  0xb8, 0x2e, 0x1d, 0xde, 0xf9, 0x99, 0xef, 0x3f, 0x11, 0x47, 0xf1, 0xef,
-  0xda, 0x1c, 0xe0, 0x7f, 0xf8, 0xd5, 0xe0, 0xc1, 0xe6, 0x01, 0x18, 0x52,
-  0x1a, 0x41, 0xa2, 0x1d, 0xe6, 0x13, 0xdd, 0xf4, 0x10, 0x12, 0xba, 0xf5,
-  0x2b, 0x0f, 0x3f, 0xf4, 0xe8, 0xfa, 0x30, 0xc3, 0xba, 0x7f, 0xe3, 0x2f,
-  0xf4, 0xfe, 0x0e, 0x23, 0xda, 0x17, 0x09, 0x5a, 0x31, 0x14, 0xd6, 0x01,
-  0x62, 0x10, 0xf8, 0x11, 0xf1, 0xcd, 0xbe, 0x09, 0xa6, 0xfb, 0x1e, 0x06,
-  0x14, 0x38, 0x0a, 0x37, 0xdd, 0x36, 0xed, 0x20, 0x17, 0x3b, 0x0c, 0xf5,
-  0x13, 0x2b, 0x81, 0xcb, 0x4d, 0x21, 0xf7, 0xe2, 0xfb, 0x0e, 0xe0, 0xc6,
-  0xfb, 0xf2, 0x4d, 0xff, 0x42, 0x19, 0xec, 0x25, 0xf1, 0x12, 0xfd, 0x2e,
-  0x05, 0xec, 0xd7, 0x0f, 0x3e, 0x45, 0x60, 0x12, 0x28, 0xe5, 0x47, 0x0f,
-  0xd3, 0x03, 0x4e, 0xec, 0xd3, 0x02, 0x21, 0x42, 0xdc, 0xd3, 0x17, 0xfd,
-  0xe2, 0xeb, 0x81, 0x09, 0x4c, 0xa6, 0x24, 0x2c, 0x3b, 0x56, 0x57, 0x92,
-  0xec, 0x39, 0xc3, 0xd2, 0xee, 0x06, 0x14, 0xeb, 0xf7, 0x05, 0xf6, 0x54,
-  0x36, 0x54, 0x3a, 0xd9, 0xd9, 0xd8, 0x2e, 0x03, 0xe7, 0x1b, 0x33, 0xf9,
-  0x2b, 0x02, 0xca, 0xe3, 0xd4, 0xad, 0xdb, 0x97, 0x0a, 0x1b, 0x2e, 0x47,
-  0x91, 0x01, 0x69, 0xcb, 0x3d, 0x29, 0x7e, 0xfe, 0x6e, 0x0d, 0x13, 0xa4,
-  0x3a, 0xb4, 0x7f, 0xed, 0xc5, 0xf8, 0xe3, 0x10, 0xdc, 0xa2, 0xab, 0x17,
-  0x4a, 0xda, 0xb0, 0x2a, 0x18, 0xc3, 0x4d, 0xc0, 0x00, 0x41, 0x2e, 0x30,
-  0x3b, 0xf0, 0x60, 0xc6, 0x30, 0x29, 0xc7, 0x11, 0xd9, 0x19, 0xae, 0xc4,
-  0xe5, 0x33, 0x52, 0x22, 0xf6, 0xc9, 0x1d, 0xda, 0x36, 0x88, 0x12, 0x13,
-  0x70, 0xb4, 0x0e, 0x13, 0xeb, 0x72, 0xa5, 0xff, 0xb8, 0xe8, 0xa4, 0xf3,
-  0x7f, 0x47, 0x59, 0xee, 0xa3, 0x09, 0xfe, 0x3b, 0xe1, 0xd7, 0x7b, 0xd8,
-  0xd2, 0xbe, 0xc4, 0x31, 0xc5, 0x1b, 0x15, 0x26, 0x65, 0x0d, 0x18, 0x45,
-  0x21, 0x54, 0xf0, 0x55, 0x46, 0xed, 0xde, 0xed, 0x08, 0x24, 0x15, 0xcc,
-  0x18, 0xb3, 0xcb, 0xbd, 0x2e, 0xad, 0xc5, 0x62, 0xe0, 0x25, 0x15, 0x18,
-  0xb4, 0x0d, 0x7f, 0xff, 0x93, 0x22, 0x50, 0xd2, 0xc0, 0xda, 0x1c, 0xee,
-  0xda, 0xe7, 0xff, 0xf8, 0x22, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0xd8, 0x04, 0x00, 0x00, 0x7f, 0x18, 0x00, 0x00,
-  0xc6, 0xbf, 0xff, 0xff, 0xf1, 0x06, 0x00, 0x00, 0x23, 0x2b, 0x00, 0x00,
-  0xfa, 0xcd, 0xff, 0xff, 0x01, 0x63, 0xff, 0xff, 0xc5, 0xdd, 0xff, 0xff,
-  0x0b, 0xcc, 0xff, 0xff, 0xed, 0x38, 0x00, 0x00, 0x2f, 0xd4, 0xff, 0xff,
-  0x04, 0xc4, 0xff, 0xff, 0x15, 0x03, 0x00, 0x00, 0x4e, 0xe5, 0xff, 0xff,
-  0x9b, 0xeb, 0xff, 0xff, 0x90, 0xec, 0xff, 0xff, 0x6e, 0xc4, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x3c, 0xe2, 0xe9, 0x6f,
-  0x81, 0xc8, 0x69, 0x0a, 0x26, 0x44, 0xe8, 0x2c, 0x18, 0x30, 0x01, 0x29,
-  0xea, 0xe9, 0xb4, 0xc2, 0x6e, 0x2f, 0x20, 0xe7, 0x01, 0x0d, 0xbd, 0xf3,
-  0xa6, 0x50, 0x81, 0xc9, 0xdf, 0x40, 0x4b, 0xf4, 0x57, 0x4f, 0x16, 0x34,
-  0x06, 0x05, 0x13, 0x02, 0x46, 0x81, 0xf6, 0x13, 0x7f, 0xae, 0x3f, 0x2a,
-  0x43, 0x2d, 0xb9, 0x25, 0x11, 0x40, 0xf8, 0x08, 0xd9, 0x3b, 0xd4, 0x1c,
-  0x81, 0xd9, 0xff, 0x20, 0x8d, 0x15, 0x83, 0xb2, 0xae, 0x31, 0x0a, 0xe4,
-  0xd6, 0x1d, 0xf0, 0x6e, 0x81, 0x07, 0x25, 0xf6, 0x76, 0x02, 0x24, 0x49,
-  0x8f, 0x3f, 0xf4, 0xe3, 0xa2, 0x4f, 0xaa, 0xf3, 0x92, 0x1c, 0xe6, 0x03,
-  0x01, 0xb8, 0x7f, 0x16, 0x0b, 0xd6, 0xc3, 0x23, 0x35, 0xf2, 0xd4, 0x12,
-  0xf4, 0x43, 0xba, 0x98, 0x5c, 0x71, 0x7f, 0xdb, 0xc3, 0x31, 0x12, 0x37,
-  0x65, 0x31, 0xae, 0x30, 0x02, 0x14, 0x8d, 0x3e, 0x1d, 0x1c, 0xdb, 0xdf,
-  0x05, 0xf5, 0x1f, 0x31, 0x7f, 0x2f, 0xb5, 0xef, 0xc9, 0x8c, 0xf2, 0x6c,
-  0xec, 0xb2, 0x03, 0x60, 0x40, 0x10, 0xe6, 0x7f, 0x85, 0x24, 0xed, 0xff,
-  0xec, 0xfc, 0x93, 0x42, 0xaa, 0x4a, 0x29, 0xae, 0x25, 0x9d, 0x34, 0xdb,
-  0x21, 0x4a, 0x81, 0x54, 0xf2, 0xa2, 0x1d, 0x2a, 0x5c, 0x7f, 0x1a, 0x2f,
-  0x02, 0x39, 0xd6, 0xdc, 0xd6, 0x6a, 0xb4, 0x64, 0xde, 0xe2, 0xd5, 0x53,
-  0xb3, 0x81, 0x2b, 0x50, 0xe4, 0x22, 0xd1, 0x53, 0x22, 0x04, 0x5e, 0x31,
-  0xc6, 0xf1, 0xd8, 0x01, 0x01, 0xf6, 0x18, 0x10, 0xfc, 0x7f, 0xf2, 0xf6,
-  0x29, 0x15, 0x0f, 0xed, 0xaf, 0xa8, 0x02, 0xf2, 0xea, 0x0f, 0x19, 0xf0,
-  0x6b, 0x94, 0x58, 0x14, 0x7c, 0xe8, 0x12, 0x81, 0xf7, 0x81, 0x6c, 0xb5,
-  0xb6, 0xde, 0x0b, 0x40, 0x1b, 0xc2, 0xa7, 0xd9, 0x78, 0xcd, 0xc7, 0xbd,
-  0xf9, 0xde, 0x0e, 0xed, 0x12, 0x1d, 0xf9, 0x18, 0x50, 0x81, 0x2b, 0xf3,
-  0x15, 0xdf, 0xd5, 0x9a, 0xda, 0x03, 0x62, 0xe0, 0x36, 0xfb, 0x1d, 0xf9,
-  0x48, 0xa0, 0x22, 0x4b, 0x7f, 0xe1, 0x0f, 0xa1, 0x3e, 0xfc, 0xec, 0x98,
-  0xec, 0x05, 0x3b, 0xdd, 0x2f, 0x1f, 0x0e, 0x45, 0xff, 0x32, 0xef, 0x81,
-  0x8b, 0xe7, 0xd2, 0x81, 0xeb, 0x37, 0xf6, 0xfd, 0xd8, 0x21, 0x3c, 0x01,
-  0xea, 0x2b, 0xe9, 0x1d, 0x0f, 0x30, 0x35, 0xd4, 0x31, 0xdc, 0xeb, 0x36,
-  0x9f, 0x81, 0x26, 0xe0, 0xd2, 0x5a, 0xfe, 0xf4, 0x11, 0xb3, 0xb5, 0x3c,
-  0x7f, 0x01, 0x17, 0x2a, 0xb3, 0xf9, 0xe1, 0xf6, 0x3c, 0xca, 0xc3, 0xfe,
-  0x41, 0x03, 0x6d, 0x06, 0x45, 0x25, 0x54, 0xff, 0x18, 0x7f, 0xf0, 0x1c,
-  0xf8, 0xf4, 0x54, 0x06, 0xa5, 0xb1, 0xdf, 0x7f, 0x40, 0x22, 0x18, 0x06,
-  0xc8, 0xef, 0x1a, 0xcd, 0x0a, 0x4c, 0x04, 0x47, 0x2c, 0x09, 0x2f, 0x3d,
-  0x05, 0x90, 0xf8, 0xfc, 0x23, 0x7f, 0xab, 0x52, 0xdc, 0xca, 0x40, 0xd3,
-  0x30, 0xc0, 0x58, 0x34, 0x29, 0x04, 0xf0, 0x35, 0x81, 0x63, 0x5f, 0x83,
-  0xef, 0x25, 0x55, 0x01, 0xec, 0x1e, 0x0f, 0x21, 0xc8, 0x7f, 0xf1, 0x2c,
-  0xdb, 0xdb, 0xac, 0x2e, 0x07, 0x1d, 0x41, 0x89, 0x3f, 0x07, 0x08, 0xd7,
-  0xd7, 0xf4, 0xae, 0x14, 0x96, 0xf4, 0x9c, 0xdd, 0xb9, 0x3f, 0xde, 0x7f,
-  0xbb, 0xfb, 0x1a, 0xfc, 0x39, 0x00, 0x81, 0xd8, 0xf6, 0xcf, 0xdf, 0xfa,
-  0x1e, 0xbc, 0xac, 0xc5, 0xf3, 0x81, 0xf7, 0x4a, 0xc5, 0x17, 0x7e, 0xf4,
-  0x5d, 0x1f, 0x97, 0x42, 0x26, 0xe9, 0xdc, 0x32, 0xee, 0xbf, 0xc3, 0xd1,
-  0x81, 0x1c, 0x11, 0xe1, 0xee, 0x1e, 0xf3, 0xe5, 0xe3, 0x0d, 0x1e, 0x41,
-  0x81, 0xe7, 0xdc, 0x3e, 0xbb, 0xd8, 0xba, 0xe0, 0xcf, 0xcd, 0x15, 0xe3,
-  0xae, 0xd5, 0xc9, 0x31, 0x85, 0xbf, 0xc9, 0xed, 0x81, 0xe7, 0x1d, 0xd5,
-  0x3b, 0x10, 0xbf, 0xbf, 0x1c, 0x4c, 0x2e, 0x19, 0xd1, 0x02, 0xae, 0x4b,
-  0xb2, 0xae, 0x4c, 0x2e, 0x81, 0x07, 0xcf, 0xb9, 0xf3, 0x56, 0x58, 0x5e,
-  0x0c, 0x2f, 0x3e, 0x46, 0xe1, 0xf8, 0x3b, 0xfc, 0xce, 0x94, 0xff, 0x53,
-  0xe4, 0x7f, 0xdf, 0x60, 0x79, 0x09, 0xd3, 0xdf, 0x81, 0xed, 0x7b, 0x00,
-  0x25, 0x20, 0xa0, 0x14, 0x3a, 0x65, 0x59, 0x5f, 0x14, 0xf1, 0xec, 0x21,
-  0x7f, 0x29, 0x37, 0x27, 0xf3, 0x0b, 0xca, 0xe4, 0x19, 0xf8, 0xe4, 0x16,
-  0x81, 0x1b, 0x04, 0xcf, 0x0e, 0xae, 0xdd, 0xe9, 0xf1, 0xd9, 0xed, 0x08,
-  0x24, 0xd2, 0x0e, 0xa6, 0x16, 0x2f, 0x16, 0xe5, 0xe8, 0xf3, 0xa6, 0xd2,
-  0xdf, 0xcd, 0x11, 0x0c, 0xd9, 0x81, 0x42, 0xf7, 0x13, 0x2e, 0xe3, 0x30,
-  0xfe, 0x0a, 0x74, 0xea, 0xe3, 0x36, 0x07, 0xe1, 0x10, 0x7f, 0x18, 0x2f,
-  0x47, 0x0d, 0x27, 0x36, 0x81, 0xff, 0x16, 0x2f, 0xde, 0x07, 0x05, 0xed,
-  0xde, 0xd7, 0x54, 0xde, 0xd9, 0xd4, 0x23, 0x3e, 0x94, 0x7f, 0xed, 0x3e,
-  0xbd, 0x30, 0x8b, 0x0e, 0x02, 0x48, 0x66, 0x86, 0xf5, 0xad, 0x24, 0xfa,
-  0x7f, 0x02, 0x3b, 0x1a, 0x06, 0xc1, 0xbc, 0xe3, 0xab, 0xf4, 0xe0, 0x22,
-  0xdb, 0xc1, 0xd7, 0x12, 0x69, 0x0e, 0xef, 0x59, 0xbe, 0xd7, 0x81, 0xa4,
-  0x69, 0xe3, 0xb9, 0x50, 0x03, 0xaf, 0xd5, 0x81, 0x24, 0x6d, 0x17, 0xee,
-  0xf4, 0xc0, 0xce, 0xfd, 0xdb, 0x0e, 0xf5, 0x79, 0xf8, 0xb2, 0xaa, 0x12,
-  0x81, 0x51, 0xbb, 0xbf, 0x3f, 0xe4, 0x2c, 0xf6, 0x02, 0x48, 0xb1, 0x36,
-  0xf6, 0xa6, 0xdf, 0xe7, 0x41, 0xf2, 0xc4, 0x43, 0x20, 0xe9, 0x6c, 0x29,
-  0xea, 0xee, 0x11, 0x81, 0xde, 0xb6, 0xda, 0x5b, 0xa0, 0xef, 0x3a, 0x08,
-  0xd8, 0x7f, 0x5c, 0x1e, 0xaa, 0x28, 0xf8, 0x1e, 0x34, 0xef, 0x9c, 0x81,
-  0x2e, 0xbf, 0x1b, 0x6c, 0x3a, 0x8c, 0xe8, 0x2e, 0xd4, 0x06, 0xc0, 0x9b,
-  0x27, 0xf6, 0x15, 0x1a, 0x20, 0xf3, 0x39, 0x3b, 0xae, 0x7f, 0xe0, 0x21,
-  0xb3, 0x19, 0x4d, 0x6c, 0x0e, 0x08, 0x01, 0xfa, 0x81, 0xfd, 0x01, 0xd6,
-  0x37, 0x1a, 0x12, 0x1b, 0xef, 0xcb, 0x0b, 0x0b, 0xfc, 0xd3, 0xe7, 0x81,
-  0xb6, 0x28, 0xd9, 0xcb, 0x02, 0x1e, 0x13, 0xef, 0x1b, 0x24, 0xf2, 0xf8,
-  0x05, 0xfe, 0xee, 0xbd, 0x3b, 0xd4, 0xe4, 0xf7, 0x30, 0xf2, 0x7f, 0xdb,
-  0x0e, 0xf2, 0xe1, 0x1c, 0xc1, 0xaa, 0x20, 0xf6, 0xc1, 0x81, 0xe8, 0x8b,
-  0x19, 0x7f, 0x9f, 0x68, 0xbd, 0xf4, 0x16, 0x86, 0x6d, 0x49, 0xfd, 0x05,
-  0x81, 0xad, 0xab, 0xa7, 0xe1, 0x1c, 0x63, 0x64, 0xed, 0xcc, 0x47, 0xeb,
-  0x10, 0x15, 0xe1, 0x37, 0xac, 0xf9, 0x3b, 0x31, 0x1f, 0x7f, 0x39, 0x17,
-  0xef, 0xe9, 0x14, 0x07, 0x18, 0x83, 0xe8, 0x47, 0xcd, 0xe4, 0xff, 0x35,
-  0x19, 0xf8, 0x23, 0x2c, 0xb3, 0x1b, 0x05, 0x7f, 0xeb, 0x27, 0x7c, 0x92,
-  0x6a, 0x1d, 0x1e, 0x01, 0xf1, 0xf4, 0x04, 0x7f, 0x5c, 0x0e, 0x43, 0xe1,
-  0x55, 0xa0, 0x0c, 0xe6, 0x39, 0x26, 0xfe, 0x7f, 0x37, 0x5c, 0x1f, 0x39,
-  0x13, 0xeb, 0x0c, 0xce, 0xd0, 0x28, 0x4f, 0x9a, 0xe2, 0xfd, 0xe9, 0x04,
-  0x22, 0x23, 0xfe, 0xc0, 0x81, 0xe8, 0x26, 0x08, 0x14, 0x0c, 0x1e, 0x16,
-  0xe5, 0x06, 0xff, 0xd3, 0xfa, 0x7f, 0x01, 0xfc, 0xe3, 0xcb, 0xdd, 0xf8,
-  0x53, 0x2e, 0x23, 0xda, 0xc1, 0x81, 0xdf, 0xe3, 0xea, 0x0f, 0xd1, 0x30,
-  0x88, 0xdf, 0x5b, 0x05, 0xe7, 0x6b, 0xe3, 0x17, 0xd2, 0x7f, 0xbd, 0x1e,
-  0xfe, 0x1d, 0x15, 0x15, 0xe4, 0x0d, 0x11, 0x9a, 0x2c, 0xf2, 0xd0, 0x86,
-  0x0f, 0xcc, 0x7f, 0xd5, 0x15, 0x98, 0x9d, 0x0b, 0xf5, 0x30, 0x16, 0xd4,
-  0xeb, 0x00, 0xf5, 0x14, 0x14, 0xcf, 0x26, 0x52, 0x97, 0xed, 0xd1, 0xcf,
-  0xe7, 0x7f, 0x18, 0x61, 0xb9, 0xd2, 0xa7, 0xd0, 0x66, 0x7d, 0xaf, 0xcd,
-  0x81, 0xd2, 0x27, 0xbb, 0xb9, 0x64, 0x31, 0x41, 0xd6, 0x37, 0xfd, 0x32,
-  0xd5, 0x7f, 0xd7, 0x20, 0xb3, 0x0b, 0xe4, 0x3c, 0xcb, 0x21, 0x35, 0xb5,
-  0xf4, 0xef, 0xca, 0x2d, 0xe4, 0x81, 0x18, 0xa7, 0xff, 0x09, 0x35, 0x7b,
-  0xc0, 0x1b, 0x31, 0x96, 0x01, 0x9e, 0xfb, 0x60, 0x3f, 0x06, 0x02, 0x5a,
-  0xf1, 0x7f, 0x18, 0x1e, 0xe7, 0x5e, 0xdb, 0xfd, 0x09, 0x62, 0x76, 0xb0,
-  0xe4, 0xe7, 0xd8, 0x4a, 0x2a, 0x5f, 0x3a, 0x2f, 0x1f, 0x81, 0x13, 0xea,
-  0x1f, 0x53, 0x2e, 0xdb, 0x59, 0x03, 0x81, 0xe4, 0x88, 0x9c, 0xfd, 0x30,
-  0xf7, 0x15, 0x9b, 0x0b, 0xe8, 0xb0, 0x56, 0xf9, 0x4e, 0xce, 0x00, 0x2b,
-  0xca, 0x1d, 0x81, 0xc9, 0x10, 0x26, 0xdc, 0xe7, 0x06, 0xfe, 0x2a, 0xfe,
-  0xe5, 0xdb, 0xc3, 0xc2, 0xf6, 0x0c, 0xf7, 0x1f, 0x07, 0x49, 0x81, 0xf3,
-  0xff, 0xd9, 0xe0, 0xb9, 0x02, 0x8c, 0x40, 0xe8, 0x73, 0x3f, 0x7f, 0xd2,
-  0x2d, 0xf7, 0xb6, 0x7d, 0x07, 0x05, 0xed, 0x45, 0xc0, 0xfc, 0x5f, 0x34,
-  0x30, 0x59, 0x22, 0x7f, 0x7e, 0x24, 0xcb, 0x01, 0xe2, 0x23, 0xe6, 0x1d,
-  0xc5, 0x7f, 0x09, 0x27, 0xdd, 0x0b, 0xda, 0x1f, 0x03, 0x3a, 0x1c, 0xbc,
-  0xa6, 0x40, 0x04, 0x46, 0xa8, 0x02, 0xeb, 0xf6, 0x2c, 0xff, 0xd7, 0xf0,
-  0x1d, 0xed, 0x81, 0x4a, 0x52, 0x75, 0xb1, 0x6a, 0x1f, 0x48, 0x3b, 0x67,
-  0x74, 0xed, 0x7f, 0xf4, 0x32, 0xf8, 0x46, 0x28, 0x0a, 0xe9, 0x17, 0xd1,
-  0x30, 0x81, 0x12, 0xf7, 0x21, 0x37, 0x6a, 0xe6, 0x00, 0xf0, 0xe1, 0x77,
-  0xc9, 0x65, 0x04, 0x26, 0x14, 0xcf, 0xd9, 0x07, 0x85, 0x11, 0x20, 0xee,
-  0x7f, 0xf1, 0xdd, 0xd5, 0xac, 0x0c, 0x22, 0x0e, 0x7a, 0x12, 0xf6, 0xf6,
-  0xba, 0x2a, 0x8a, 0xe7, 0xe0, 0xb6, 0x4e, 0x7f, 0x4f, 0x5e, 0xeb, 0xf1,
-  0x15, 0xdb, 0x59, 0x7f, 0xb9, 0x5b, 0x9e, 0xe4, 0xec, 0x06, 0x77, 0x60,
-  0x15, 0x33, 0xc5, 0x18, 0x61, 0x20, 0x7f, 0xd7, 0xe0, 0xf8, 0xc7, 0x59,
-  0x2e, 0x33, 0x1c, 0xe7, 0xeb, 0xd3, 0xf0, 0x03, 0xf7, 0x29, 0xd3, 0xa4,
-  0x2f, 0xce, 0x48, 0x1b, 0x26, 0xd9, 0xaa, 0x81, 0x85, 0xc8, 0xd0, 0xed,
-  0xed, 0x5c, 0x7f, 0x32, 0x2d, 0x27, 0x6b, 0x4a, 0x15, 0x42, 0x9f, 0x30,
-  0x5e, 0x3b, 0x7f, 0xb4, 0x0f, 0xe6, 0x03, 0x25, 0xfc, 0x2e, 0xbe, 0x26,
-  0x14, 0x23, 0x6a, 0x28, 0xc6, 0x37, 0xe7, 0xff, 0xf9, 0x77, 0x03, 0x11,
-  0x62, 0x40, 0x7f, 0xcd, 0xec, 0x2e, 0xd7, 0xe5, 0x10, 0xd3, 0x16, 0xd7,
-  0x29, 0x81, 0x27, 0xe9, 0x35, 0xf1, 0x4b, 0xdc, 0x29, 0xdb, 0xd7, 0x4e,
-  0xe6, 0x3c, 0x1a, 0x10, 0x5a, 0xf0, 0x47, 0x06, 0xdf, 0xb1, 0x4a, 0xad,
-  0x7f, 0x61, 0x54, 0x9a, 0xe1, 0x26, 0xe7, 0x1c, 0xda, 0x7f, 0xd8, 0x1f,
-  0xe8, 0x09, 0xe6, 0x10, 0xfb, 0x33, 0x0d, 0x9b, 0x2a, 0xa5, 0xfc, 0x0c,
-  0x7f, 0x16, 0x2a, 0x16, 0xd5, 0xbf, 0xa2, 0xf9, 0xf1, 0xf8, 0xd2, 0x25,
-  0xfb, 0x41, 0xe9, 0xf6, 0xe8, 0xe8, 0x81, 0x3a, 0xc1, 0x0d, 0xda, 0xdd,
-  0xbf, 0xb1, 0x13, 0xdc, 0x40, 0x30, 0x0c, 0x24, 0x8a, 0x81, 0xfa, 0xfd,
-  0xd4, 0x4e, 0x15, 0xe3, 0x0c, 0xad, 0x1f, 0xef, 0xea, 0xdd, 0x03, 0x3b,
-  0x06, 0xee, 0x01, 0x26, 0x5c, 0x30, 0xfd, 0x7f, 0xdd, 0x26, 0xea, 0x11,
-  0x30, 0xd6, 0x7f, 0xd5, 0xf4, 0xfb, 0xef, 0x25, 0x37, 0x2e, 0x1a, 0x18,
-  0x01, 0xfe, 0x42, 0xe5, 0xc1, 0xde, 0xef, 0x18, 0x7f, 0x3a, 0x21, 0x18,
-  0xe4, 0xfe, 0xdf, 0xa9, 0xee, 0x26, 0xaf, 0x35, 0x7a, 0xca, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00,
-  0x93, 0x12, 0x00, 0x00, 0xed, 0xfe, 0xff, 0xff, 0x0e, 0x0d, 0x00, 0x00,
-  0xcc, 0x10, 0x00, 0x00, 0x52, 0x47, 0x00, 0x00, 0xc5, 0xfd, 0xff, 0xff,
-  0x92, 0x05, 0x00, 0x00, 0xbe, 0x25, 0x00, 0x00, 0x84, 0xfc, 0xff, 0xff,
-  0xca, 0x28, 0x00, 0x00, 0x46, 0x1b, 0x00, 0x00, 0xfb, 0x0b, 0x00, 0x00,
-  0xf7, 0x00, 0x00, 0x00, 0x45, 0x08, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00,
-  0x52, 0x07, 0x00, 0x00, 0x29, 0x08, 0x00, 0x00, 0xac, 0xfe, 0xff, 0xff,
-  0x59, 0x21, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0xb1, 0x14, 0x00, 0x00,
-  0x7d, 0xee, 0xff, 0xff, 0x60, 0x02, 0x00, 0x00, 0x56, 0xd6, 0xff, 0xff,
-  0xd9, 0x0f, 0x00, 0x00, 0x14, 0x0c, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00,
-  0xd9, 0x0a, 0x00, 0x00, 0x13, 0x05, 0x00, 0x00, 0x05, 0x08, 0x00, 0x00,
-  0x73, 0x18, 0x00, 0x00, 0x3e, 0x06, 0x00, 0x00, 0x27, 0x46, 0x00, 0x00,
-  0xfd, 0x07, 0x00, 0x00, 0xe3, 0x22, 0x00, 0x00, 0x18, 0x11, 0x00, 0x00,
-  0xe1, 0x05, 0x00, 0x00, 0xb4, 0x07, 0x00, 0x00, 0xbd, 0x03, 0x00, 0x00,
-  0xfa, 0x36, 0x00, 0x00, 0xf2, 0x06, 0x00, 0x00, 0xfe, 0x05, 0x00, 0x00,
-  0x90, 0x06, 0x00, 0x00, 0x80, 0x0d, 0x00, 0x00, 0x13, 0x25, 0x00, 0x00,
-  0xdc, 0x10, 0x00, 0x00, 0x3f, 0x28, 0x00, 0x00, 0x3c, 0x09, 0x00, 0x00,
-  0xe0, 0xff, 0xff, 0xff, 0x94, 0x05, 0x00, 0x00, 0x9c, 0x0b, 0x00, 0x00,
-  0x2f, 0x0b, 0x00, 0x00, 0x51, 0xf7, 0xff, 0xff, 0x2e, 0x1f, 0x00, 0x00,
-  0x23, 0x00, 0x00, 0x00, 0xec, 0x05, 0x00, 0x00, 0x3d, 0x26, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0xf0, 0x06, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00,
-  0x27, 0x2e, 0x00, 0x00, 0x92, 0x11, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0x24, 0x16, 0x00, 0x00, 0x3b, 0x2b, 0x00, 0x00, 0x7d, 0x06, 0x00, 0x00,
-  0x70, 0x10, 0x00, 0x00, 0x43, 0x22, 0x00, 0x00, 0x07, 0x0f, 0x00, 0x00,
-  0xa5, 0x06, 0x00, 0x00, 0x35, 0x05, 0x00, 0x00, 0xb8, 0xf5, 0xff, 0xff,
-  0x5c, 0x12, 0x00, 0x00, 0xda, 0x0b, 0x00, 0x00, 0x8a, 0x09, 0x00, 0x00,
-  0xd2, 0xff, 0xff, 0xff, 0x8c, 0x1a, 0x00, 0x00, 0x6d, 0x0c, 0x00, 0x00,
-  0xc9, 0x0f, 0x00, 0x00, 0xb1, 0x08, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00,
-  0x50, 0x0c, 0x00, 0x00, 0x43, 0x32, 0x00, 0x00, 0x95, 0xf9, 0xff, 0xff,
-  0xcb, 0x19, 0x00, 0x00, 0xa6, 0x10, 0x00, 0x00, 0x2b, 0x05, 0x00, 0x00,
-  0xc2, 0xfb, 0xff, 0xff, 0x57, 0x0d, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00,
-  0x25, 0x1f, 0x00, 0x00, 0x65, 0x0e, 0x00, 0x00, 0x33, 0x08, 0x00, 0x00,
-  0xf9, 0x0a, 0x00, 0x00, 0x20, 0x0c, 0x00, 0x00, 0x06, 0xcc, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0xf9, 0x25, 0x29, 0x9f,
-  0x48, 0x08, 0x29, 0x03, 0xea, 0x49, 0xe1, 0xac, 0x81, 0x35, 0xe5, 0xf7,
-  0xf2, 0x00, 0x03, 0x01, 0xb6, 0x12, 0x24, 0x44, 0xfc, 0x81, 0xf8, 0x0a,
-  0x1d, 0x21, 0xf4, 0xf8, 0xbb, 0xff, 0x24, 0xbb, 0xf8, 0x81, 0x1d, 0xc9,
-  0x0b, 0x99, 0x29, 0xd0, 0xfe, 0x38, 0xd7, 0xde, 0x42, 0x19, 0x3e, 0x32,
-  0xac, 0x43, 0x0b, 0xe8, 0x91, 0xdd, 0x06, 0xf6, 0xeb, 0xe3, 0xf2, 0xbe,
-  0xea, 0xe1, 0xcb, 0xd2, 0x01, 0x13, 0x81, 0x2d, 0x57, 0x1a, 0xe8, 0x02,
-  0xdb, 0xd3, 0x7f, 0x81, 0x81, 0x15, 0x81, 0xed, 0x29, 0xfb, 0x08, 0x43,
-  0xeb, 0xe8, 0xdd, 0xe9, 0x00, 0x32, 0xea, 0xf5, 0x81, 0x20, 0x6f, 0xd5,
-  0xde, 0x04, 0x7f, 0xfd, 0xf1, 0x1c, 0xb5, 0x20, 0xd7, 0x1a, 0xc7, 0x7f,
-  0x02, 0x7f, 0x7f, 0xd6, 0xe2, 0x7f, 0x7f, 0x7d, 0x19, 0xfe, 0x5c, 0x19,
-  0x7f, 0x56, 0x7f, 0xc9, 0xc1, 0xeb, 0xcc, 0xaf, 0xe3, 0xaa, 0x7f, 0x43,
-  0xe1, 0x81, 0xee, 0xaf, 0x27, 0xea, 0xeb, 0x11, 0x5c, 0x04, 0x2a, 0x7f,
-  0xce, 0x7f, 0x81, 0xe4, 0x94, 0xef, 0xf9, 0x23, 0xfc, 0x81, 0x9a, 0xcc,
-  0xa5, 0xfd, 0x00, 0x81, 0x0a, 0x06, 0xda, 0x7f, 0x81, 0xfc, 0xf9, 0xd9,
-  0x81, 0xca, 0xe7, 0xa6, 0xf0, 0x11, 0x29, 0x8d, 0x7c, 0x76, 0x81, 0x21,
-  0x81, 0x04, 0xe0, 0xfc, 0x0a, 0x73, 0xeb, 0xaf, 0xea, 0x26, 0x00, 0x9f,
-  0x42, 0xfd, 0x26, 0xf8, 0xdb, 0x7f, 0xe7, 0x15, 0x92, 0x54, 0xed, 0x15,
-  0xee, 0xed, 0x21, 0xfe, 0xb7, 0x00, 0x1e, 0x3c, 0xfa, 0x92, 0x44, 0x28,
-  0x22, 0x2e, 0xed, 0xfd, 0xa7, 0xfb, 0x3c, 0x2a, 0xe8, 0xa6, 0x09, 0xc4,
-  0xf0, 0xdd, 0x21, 0xd4, 0xf8, 0xc3, 0xca, 0xd0, 0x7b, 0x10, 0x4e, 0x16,
-  0x09, 0x38, 0x16, 0xe3, 0x29, 0xda, 0x0c, 0xf7, 0xfd, 0xf6, 0x9f, 0x06,
-  0xe3, 0xdb, 0x7f, 0xe3, 0xf6, 0x04, 0xa8, 0x4b, 0x3d, 0x07, 0xe8, 0x43,
-  0xaa, 0x01, 0xcc, 0x90, 0xa4, 0xff, 0xb3, 0xe2, 0x11, 0xf2, 0x01, 0x10,
-  0xe0, 0xdb, 0xe3, 0x2e, 0x0c, 0x30, 0xd8, 0xf6, 0xcb, 0x01, 0x39, 0x81,
-  0x27, 0x4a, 0x0a, 0x0b, 0xed, 0x37, 0xf0, 0xd2, 0x9e, 0x2f, 0x1c, 0x45,
-  0xfc, 0x3b, 0x40, 0x28, 0x0b, 0xd1, 0x44, 0xf3, 0x27, 0x4d, 0x7f, 0x3d,
-  0xdc, 0xfe, 0xea, 0x03, 0xb9, 0xfc, 0x66, 0xeb, 0x05, 0xb1, 0xd1, 0x82,
-  0xfa, 0x23, 0x7f, 0xba, 0xbf, 0x7f, 0xcd, 0xa0, 0x50, 0x2b, 0x52, 0xeb,
-  0xc0, 0x7f, 0x50, 0xf2, 0xc6, 0xe3, 0x26, 0xf5, 0xfb, 0xdd, 0x39, 0xfd,
-  0xc8, 0x07, 0xe5, 0xc6, 0xf3, 0x02, 0xd4, 0xe7, 0x55, 0x6d, 0x01, 0xd4,
-  0xbb, 0x81, 0xce, 0x04, 0xf2, 0xff, 0x00, 0xca, 0x7f, 0x21, 0xd7, 0x14,
-  0x11, 0x7f, 0x35, 0xac, 0x7f, 0x07, 0xf2, 0xf8, 0x44, 0x7f, 0x7f, 0x62,
-  0x81, 0x81, 0x2f, 0xa9, 0x7f, 0x69, 0xc7, 0xb1, 0xdf, 0x7f, 0xfe, 0x52,
-  0x7f, 0x84, 0x38, 0x7f, 0x7f, 0xa9, 0x01, 0x81, 0x81, 0x93, 0x4a, 0x7f,
-  0x91, 0x7f, 0xf0, 0x7f, 0x85, 0x7f, 0x59, 0xab, 0x7f, 0x33, 0x02, 0xd0,
-  0x7f, 0x00, 0x9d, 0x81, 0x7f, 0xe9, 0x7f, 0x71, 0x7f, 0x81, 0x7f, 0x9c,
-  0x7f, 0x74, 0xa2, 0x7f, 0x96, 0x7f, 0x81, 0x7f, 0x8d, 0x4f, 0x55, 0xd6,
-  0x6b, 0x7f, 0xf1, 0x7a, 0x81, 0x81, 0x52, 0x81, 0xe7, 0x7f, 0x7f, 0x73,
-  0x1b, 0x00, 0x6a, 0xf4, 0x18, 0x7f, 0x53, 0x74, 0x35, 0x5f, 0x87, 0x7f,
-  0xde, 0x32, 0x6a, 0xfb, 0x8f, 0xf9, 0xa6, 0x0e, 0xd9, 0xed, 0x30, 0x98,
-  0x18, 0x29, 0xeb, 0x0d, 0xd3, 0x37, 0x0a, 0x7f, 0xa6, 0x39, 0x1b, 0x67,
-  0xe7, 0x36, 0x2a, 0x1b, 0x07, 0xd4, 0x50, 0xe8, 0x26, 0x43, 0x1b, 0x43,
-  0xe5, 0x02, 0xe3, 0x08, 0x81, 0xe9, 0x74, 0x7f, 0x01, 0xdc, 0xcd, 0x86,
-  0xe1, 0xec, 0x36, 0xb7, 0xd3, 0xa8, 0xcd, 0x81, 0x5b, 0x29, 0x43, 0xe6,
-  0x55, 0x3e, 0x73, 0xe9, 0x6e, 0xe4, 0x2a, 0xef, 0xf7, 0xe9, 0x9b, 0x34,
-  0xad, 0xfb, 0xc5, 0xce, 0xef, 0x06, 0xc0, 0xe5, 0x35, 0xd8, 0xeb, 0x7f,
-  0xe9, 0x8d, 0xcc, 0xe2, 0xed, 0xe9, 0xb0, 0xa0, 0x40, 0x26, 0xe1, 0x31,
-  0xf8, 0x9b, 0x29, 0x7f, 0xd8, 0x04, 0xe5, 0xff, 0xd2, 0xd0, 0xf2, 0xd3,
-  0x2c, 0x11, 0x0d, 0x23, 0xda, 0x45, 0x24, 0xce, 0x34, 0x3e, 0x21, 0xf2,
-  0x00, 0xf1, 0xec, 0xd6, 0x43, 0xbb, 0x2e, 0xce, 0x05, 0x01, 0xf9, 0xbf,
-  0xf2, 0xe8, 0x84, 0x02, 0xe5, 0xf6, 0x3c, 0xd5, 0xf3, 0xd2, 0xd7, 0xd4,
-  0xe9, 0x37, 0x4f, 0xca, 0x06, 0x27, 0xa3, 0xe2, 0xba, 0x0b, 0xe1, 0xf6,
-  0x39, 0x32, 0x1d, 0xdf, 0x1a, 0xe5, 0x0f, 0xd3, 0x1d, 0x28, 0x1a, 0x6b,
-  0x81, 0xe2, 0x68, 0x20, 0x15, 0x2e, 0xd5, 0xf9, 0x26, 0x0a, 0xef, 0xd0,
-  0xf3, 0x04, 0xf3, 0x02, 0x0f, 0x0a, 0x82, 0xef, 0x72, 0xfe, 0x0b, 0xe5,
-  0x30, 0x12, 0xdc, 0xec, 0x01, 0xd6, 0x81, 0xf9, 0x25, 0xbc, 0x33, 0xdb,
-  0x08, 0x04, 0x08, 0x7f, 0xaa, 0x51, 0x7f, 0xe5, 0xe8, 0x26, 0x7f, 0x21,
-  0xf0, 0xe2, 0xf9, 0xa8, 0x37, 0xc9, 0x72, 0xc7, 0x04, 0x2d, 0x05, 0xe4,
-  0xf9, 0xf6, 0x9c, 0xb2, 0x0a, 0xea, 0x81, 0x09, 0x97, 0xfc, 0xf7, 0x81,
-  0xdf, 0xc6, 0xfb, 0x57, 0x04, 0xec, 0x0a, 0xf3, 0x38, 0xff, 0xd4, 0xf3,
-  0x59, 0x4a, 0xce, 0xd1, 0x04, 0xbb, 0x22, 0xae, 0x7f, 0x1a, 0x7f, 0x40,
-  0x81, 0xc9, 0xfa, 0x91, 0x66, 0x18, 0xed, 0x2b, 0x1a, 0xf2, 0x01, 0xec,
-  0xf4, 0xc8, 0x0a, 0x19, 0x00, 0xe7, 0xbb, 0x81, 0x56, 0x81, 0x02, 0x04,
-  0xf0, 0x06, 0x7f, 0x10, 0x14, 0x81, 0xaf, 0x7f, 0xe9, 0xf3, 0xd9, 0xd2,
-  0x29, 0x0b, 0x03, 0x16, 0xd4, 0x35, 0x1a, 0x37, 0x36, 0x41, 0x1a, 0xf2,
-  0xec, 0xf8, 0xf2, 0xd1, 0x34, 0xbf, 0x11, 0xd2, 0xfe, 0x01, 0xd4, 0xc4,
-  0xe3, 0xfe, 0x9e, 0x0e, 0x20, 0xfc, 0x09, 0xd0, 0xf7, 0xfb, 0xde, 0xed,
-  0xda, 0xe4, 0x1c, 0xbd, 0x00, 0xf6, 0xaf, 0xcf, 0xdf, 0x06, 0xf0, 0x03,
-  0x2f, 0x28, 0x16, 0xf0, 0x7f, 0xe5, 0x11, 0xe1, 0x13, 0x31, 0x2e, 0x7f,
-  0xb5, 0xe5, 0xf9, 0xfe, 0x17, 0x22, 0xd3, 0xd9, 0xe9, 0xdd, 0xf4, 0x02,
-  0xf5, 0xec, 0x4e, 0xfd, 0x15, 0x08, 0x96, 0xf0, 0x36, 0x03, 0x07, 0xe6,
-  0xe9, 0xf4, 0xcf, 0x27, 0x06, 0xdb, 0x9b, 0xf9, 0x72, 0xcf, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x1b, 0x14, 0x00, 0x00,
-  0x98, 0xf9, 0xff, 0xff, 0x77, 0xe6, 0xff, 0xff, 0x11, 0x3c, 0x00, 0x00,
-  0xe1, 0xf4, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x9b, 0xfd, 0xff, 0xff,
-  0xf1, 0xf6, 0xff, 0xff, 0x82, 0x21, 0x00, 0x00, 0xab, 0xcd, 0xff, 0xff,
-  0x71, 0x02, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0x32, 0x2a, 0x00, 0x00,
-  0x14, 0xe4, 0xff, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0x49, 0xe0, 0xff, 0xff,
-  0x0b, 0x02, 0x00, 0x00, 0xb1, 0xf7, 0xff, 0xff, 0x9e, 0xe6, 0xff, 0xff,
-  0x34, 0x01, 0x00, 0x00, 0x9b, 0xf1, 0xff, 0xff, 0xe8, 0x14, 0x00, 0x00,
-  0x91, 0xf1, 0xff, 0xff, 0x59, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
-  0x02, 0x20, 0x00, 0x00, 0x4c, 0xd1, 0xff, 0xff, 0x13, 0xf2, 0xff, 0xff,
-  0xcb, 0xfc, 0xff, 0xff, 0x0c, 0xf2, 0xff, 0xff, 0x8b, 0x22, 0x00, 0x00,
-  0x22, 0x00, 0x00, 0x00, 0xb8, 0x3e, 0x00, 0x00, 0x3e, 0xfd, 0xff, 0xff,
-  0xe3, 0xeb, 0xff, 0xff, 0x51, 0x0e, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00,
-  0x48, 0x25, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x7b, 0x3f, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x49, 0x16, 0x00, 0x00, 0xb6, 0xe9, 0xff, 0xff,
-  0x43, 0x41, 0x00, 0x00, 0x2f, 0xfe, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff,
-  0x7a, 0x1a, 0x00, 0x00, 0x14, 0x1f, 0x00, 0x00, 0x63, 0xca, 0xff, 0xff,
-  0x16, 0xff, 0xff, 0xff, 0x57, 0xde, 0xff, 0xff, 0xa6, 0xfa, 0xff, 0xff,
-  0xe4, 0xeb, 0xff, 0xff, 0x06, 0xd3, 0xff, 0xff, 0xa6, 0xfd, 0xff, 0xff,
-  0xb0, 0x0d, 0x00, 0x00, 0xd9, 0x08, 0x00, 0x00, 0x37, 0x17, 0x00, 0x00,
-  0xde, 0xff, 0xff, 0xff, 0xa5, 0x07, 0x00, 0x00, 0xdd, 0xfc, 0xff, 0xff,
-  0x1e, 0x04, 0x00, 0x00, 0xe7, 0xfd, 0xff, 0xff, 0x60, 0x02, 0x00, 0x00,
-  0xf3, 0x41, 0x00, 0x00, 0x6a, 0x03, 0x00, 0x00, 0xf8, 0x4f, 0x00, 0x00,
-  0x39, 0x36, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0x69, 0xff, 0xff, 0xff,
-  0x26, 0x23, 0x00, 0x00, 0x91, 0xf5, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
-  0x08, 0xf5, 0xff, 0xff, 0x4f, 0xfc, 0xff, 0xff, 0xeb, 0xf5, 0xff, 0xff,
-  0x1b, 0x2a, 0x00, 0x00, 0xb9, 0x32, 0x00, 0x00, 0x1b, 0x35, 0x00, 0x00,
-  0x14, 0x2b, 0x00, 0x00, 0x5c, 0x12, 0x00, 0x00, 0xc8, 0xf7, 0xff, 0xff,
-  0x5b, 0x24, 0x00, 0x00, 0x34, 0x40, 0x00, 0x00, 0x5f, 0xf3, 0xff, 0xff,
-  0xfd, 0xed, 0xff, 0xff, 0xd6, 0x29, 0x00, 0x00, 0x36, 0xe6, 0xff, 0xff,
-  0xed, 0x16, 0x00, 0x00, 0x42, 0xfe, 0xff, 0xff, 0x9c, 0xef, 0xff, 0xff,
-  0x33, 0xf3, 0xff, 0xff, 0xb2, 0xfd, 0xff, 0xff, 0xb0, 0x08, 0x00, 0x00,
-  0x25, 0x4b, 0x00, 0x00, 0xb9, 0xf9, 0xff, 0xff, 0xfe, 0xd0, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xeb, 0x2a, 0x27, 0x1f,
-  0xe3, 0xa9, 0xf0, 0xdf, 0xe5, 0xbc, 0x28, 0xe7, 0x3a, 0xb6, 0x2e, 0x30,
-  0xb2, 0xf1, 0x1d, 0x18, 0x4b, 0x0a, 0xd1, 0xfc, 0xf5, 0x2b, 0x7f, 0x2e,
-  0xff, 0x58, 0x30, 0xfe, 0xf7, 0xfa, 0x08, 0xd0, 0x23, 0x36, 0xf3, 0x08,
-  0x59, 0x0e, 0x16, 0xec, 0xfa, 0xfc, 0x12, 0xd7, 0x0f, 0xee, 0x38, 0xf1,
-  0xd4, 0x08, 0x25, 0x19, 0x17, 0xd8, 0x00, 0x1c, 0xfa, 0x2e, 0xc0, 0xef,
-  0x08, 0x1d, 0x34, 0x09, 0x0e, 0xea, 0x21, 0xfa, 0x11, 0x0d, 0xfe, 0x19,
-  0x3d, 0xef, 0x1f, 0x23, 0x0c, 0x1c, 0x27, 0x1b, 0xd2, 0x16, 0xfc, 0x42,
-  0x1b, 0x11, 0xb7, 0xec, 0x0c, 0x16, 0x5d, 0x54, 0xfa, 0x32, 0xfe, 0x1b,
-  0xe5, 0xed, 0x3d, 0xd4, 0xd3, 0xdc, 0xbc, 0xbb, 0xf5, 0xed, 0xf2, 0xeb,
-  0xfc, 0xf7, 0xe6, 0xf7, 0xef, 0xd3, 0x7f, 0xfa, 0x05, 0x0e, 0x0a, 0x32,
-  0xd5, 0x07, 0xf6, 0x1f, 0xc0, 0x03, 0x25, 0x0a, 0xf3, 0x3a, 0xce, 0x72,
-  0x09, 0x07, 0x1a, 0xc1, 0x43, 0xf5, 0x15, 0x05, 0xcb, 0xfa, 0x18, 0xa6,
-  0xed, 0x3e, 0x12, 0x2d, 0x48, 0x08, 0xdb, 0x27, 0xd6, 0x21, 0x07, 0xfe,
-  0x1b, 0x37, 0x45, 0x0e, 0xc8, 0xa0, 0x03, 0x1c, 0x28, 0x16, 0xd3, 0x09,
-  0xd3, 0x16, 0x3f, 0xf5, 0x30, 0xde, 0x46, 0xe0, 0xea, 0xe5, 0xfe, 0xfa,
-  0xf4, 0xe4, 0x1a, 0xf7, 0x19, 0x90, 0xe4, 0x20, 0xef, 0x15, 0x21, 0x02,
-  0x66, 0x3c, 0xdd, 0x0c, 0xb4, 0x08, 0x08, 0xe3, 0x42, 0xed, 0x18, 0x1d,
-  0x01, 0xec, 0x81, 0xf5, 0x08, 0xda, 0xf5, 0x3e, 0xf6, 0xf3, 0xd0, 0xfd,
-  0xdb, 0xde, 0xd6, 0x39, 0xe3, 0xe2, 0x05, 0x14, 0x03, 0x1b, 0xf3, 0xec,
-  0x33, 0xf8, 0xf9, 0x3c, 0x0b, 0x40, 0xec, 0xe5, 0xa2, 0x0f, 0xe5, 0xe2,
-  0xee, 0x22, 0x37, 0xcd, 0x1c, 0xff, 0x32, 0x0a, 0xf6, 0x08, 0xf8, 0x10,
-  0x2b, 0xd6, 0xd6, 0xf0, 0x12, 0x19, 0xc7, 0xeb, 0x15, 0x36, 0x3e, 0x46,
-  0xc2, 0xe6, 0xdc, 0xd2, 0x26, 0x36, 0x3b, 0xe9, 0xfe, 0xba, 0xe5, 0xd9,
-  0xec, 0xee, 0xc3, 0x32, 0xff, 0x0e, 0x56, 0xf1, 0x10, 0xf2, 0x01, 0xaf,
-  0x0b, 0xe6, 0x5e, 0xc1, 0x14, 0x6f, 0xa6, 0xeb, 0xf0, 0xf3, 0xea, 0x5f,
-  0x33, 0x1e, 0xc9, 0x1d, 0xe0, 0x1b, 0x29, 0x08, 0xc3, 0x4d, 0x33, 0xf3,
-  0xc2, 0x08, 0xd0, 0x48, 0xdf, 0xef, 0x34, 0xeb, 0x20, 0xde, 0xf3, 0x46,
-  0x1c, 0x16, 0x03, 0x15, 0x32, 0xf6, 0x02, 0x14, 0x36, 0x05, 0x1b, 0xcd,
-  0x64, 0x1a, 0x3b, 0x0b, 0x1c, 0xf1, 0xe9, 0xe3, 0xf4, 0x3a, 0x39, 0xea,
-  0xe8, 0xc4, 0x7f, 0xd8, 0xe1, 0xe3, 0xc5, 0xfd, 0x02, 0xaf, 0x11, 0xb6,
-  0x27, 0xe6, 0x79, 0x09, 0x02, 0xdb, 0xf2, 0xdc, 0xdf, 0xdd, 0x49, 0x43,
-  0xd9, 0x3e, 0xad, 0xf2, 0x06, 0xa6, 0xf9, 0x2a, 0xd1, 0x52, 0x32, 0x05,
-  0xfb, 0x44, 0xc6, 0xe7, 0xfc, 0xda, 0x1a, 0xee, 0x3d, 0x32, 0xe6, 0x34,
-  0xde, 0xe2, 0xd3, 0xa4, 0x5c, 0xcd, 0xb9, 0x00, 0xd4, 0xf3, 0xfb, 0x06,
-  0xd1, 0x7f, 0xb7, 0xf4, 0xe6, 0xd6, 0x08, 0xba, 0x31, 0x52, 0xd1, 0x27,
-  0x06, 0x24, 0x39, 0xdb, 0xc7, 0x25, 0x34, 0xb7, 0x08, 0xee, 0xce, 0xdf,
-  0xc9, 0x2c, 0x0e, 0x14, 0x3d, 0x58, 0xd1, 0x1f, 0xaf, 0xdc, 0xfb, 0xfc,
-  0x33, 0xfb, 0xd6, 0xf2, 0x39, 0xf5, 0xf6, 0x95, 0xf7, 0x23, 0x40, 0x30,
-  0xd5, 0x2f, 0xd3, 0x4a, 0x33, 0x4b, 0x30, 0xba, 0x39, 0xc8, 0xdd, 0xce,
-  0xf2, 0xd5, 0xb1, 0xd7, 0xe7, 0x03, 0x38, 0x02, 0xf5, 0xca, 0x1a, 0xb7,
-  0x04, 0xfb, 0x04, 0xde, 0x2c, 0x1c, 0xe7, 0x0e, 0xf8, 0x0c, 0x06, 0xe1,
-  0xe6, 0xf3, 0xaf, 0xe0, 0xf1, 0x2f, 0xef, 0x23, 0x34, 0xa8, 0x3c, 0xe7,
-  0x07, 0x35, 0x1f, 0x60, 0xf9, 0xcc, 0x08, 0x00, 0xe3, 0xfe, 0xdc, 0xc8,
-  0xcc, 0xdd, 0xf8, 0x1b, 0xd8, 0x27, 0x81, 0xe2, 0xfe, 0x26, 0x38, 0x00,
-  0xfb, 0x98, 0x22, 0xdc, 0xfa, 0xbb, 0x1e, 0xc9, 0x29, 0x0b, 0x07, 0x48,
-  0xb3, 0x01, 0x6d, 0xff, 0xf5, 0xff, 0x11, 0x1f, 0xef, 0x1a, 0x23, 0x1d,
-  0xd2, 0xef, 0x78, 0x48, 0xe7, 0x0c, 0xdb, 0x01, 0x25, 0x56, 0xfe, 0x64,
-  0xbe, 0xd2, 0xda, 0x16, 0x14, 0xfb, 0xbe, 0x00, 0x07, 0x90, 0x18, 0x2d,
-  0xb7, 0x61, 0xbe, 0x95, 0xe8, 0xae, 0x81, 0x1e, 0xe8, 0xfc, 0xf8, 0x3c,
-  0x19, 0x1c, 0xdf, 0xca, 0xce, 0xd9, 0xb5, 0xc5, 0x17, 0xdb, 0xf0, 0x54,
-  0xaf, 0x1b, 0xfd, 0xfc, 0x2d, 0x4d, 0xdb, 0x05, 0xe9, 0xe5, 0x1c, 0xdf,
-  0xcb, 0x3a, 0xf7, 0xdd, 0x17, 0x2c, 0xa2, 0xe2, 0x2b, 0x1c, 0x9b, 0xa9,
-  0x60, 0x00, 0x23, 0xc4, 0x0b, 0xbe, 0x1f, 0xf8, 0xdd, 0xcd, 0x1c, 0x02,
-  0x3c, 0xdb, 0xbe, 0xe4, 0xaf, 0x42, 0xe6, 0xc5, 0xeb, 0xb4, 0xf1, 0xad,
-  0x59, 0xf4, 0xa4, 0x17, 0xc3, 0x37, 0x03, 0xc0, 0x34, 0xd3, 0x00, 0xf9,
-  0xaf, 0x33, 0xb8, 0x35, 0x18, 0x8b, 0x4e, 0x90, 0xe0, 0x0d, 0x01, 0x3e,
-  0xd7, 0x0f, 0xff, 0xd7, 0xb0, 0x00, 0x28, 0x16, 0xe4, 0xb9, 0x13, 0x23,
-  0xee, 0xff, 0xdd, 0x01, 0xd9, 0xd9, 0xde, 0xd0, 0x19, 0x22, 0x16, 0x43,
-  0xf8, 0x2a, 0x2d, 0x01, 0xdf, 0x81, 0x27, 0x24, 0xe5, 0x2b, 0xe1, 0x24,
-  0xe3, 0xf5, 0x21, 0xbf, 0x07, 0x12, 0x28, 0x51, 0xdb, 0x45, 0xe4, 0xf5,
-  0x2b, 0x09, 0x03, 0xc1, 0x0b, 0x11, 0xb3, 0xfb, 0x38, 0x0a, 0x0f, 0xbe,
-  0x45, 0xed, 0x3a, 0xe9, 0x00, 0xd7, 0x2d, 0x0a, 0xfc, 0xe0, 0xcc, 0xe7,
-  0x2f, 0xd1, 0x31, 0xdc, 0xea, 0x00, 0xbb, 0x05, 0x15, 0x0c, 0xde, 0x31,
-  0x0d, 0x12, 0x04, 0x00, 0x1e, 0x14, 0x3c, 0xeb, 0xf5, 0xcb, 0xfc, 0xfb,
-  0xe1, 0xf1, 0x16, 0xe8, 0x02, 0xfb, 0x61, 0x34, 0x22, 0x0e, 0xdb, 0xf6,
-  0x1f, 0xfe, 0x1e, 0xfa, 0xf9, 0xb8, 0xee, 0x0c, 0xeb, 0xaa, 0x2a, 0xfa,
-  0xea, 0x26, 0x02, 0xf8, 0xfa, 0x17, 0xf6, 0xf9, 0xce, 0xfd, 0x15, 0xe2,
-  0xf7, 0x1a, 0x1d, 0xe6, 0x10, 0x0c, 0x1b, 0xf6, 0x1c, 0xf8, 0x36, 0xe7,
-  0xf5, 0x09, 0xd2, 0x09, 0xf6, 0x75, 0xd2, 0x17, 0xd3, 0xc0, 0xb9, 0x2c,
-  0xb1, 0xe2, 0xcf, 0x07, 0xef, 0xec, 0x33, 0xe9, 0xe4, 0x81, 0x16, 0xa2,
-  0x03, 0xfe, 0xc5, 0x26, 0xfd, 0xf9, 0x07, 0x36, 0x4a, 0xdb, 0xda, 0x33,
-  0xd3, 0x5a, 0x22, 0xed, 0xb6, 0xfe, 0x01, 0xd7, 0xec, 0xc4, 0xe9, 0x2d,
-  0x4a, 0x10, 0x1d, 0x10, 0xdb, 0x09, 0x12, 0x40, 0xc7, 0x40, 0x18, 0xe8,
-  0x11, 0x20, 0xc7, 0xd4, 0xef, 0x29, 0xe4, 0x37, 0xe2, 0x05, 0xfc, 0xfd,
-  0x34, 0x06, 0x32, 0xf6, 0xfb, 0xde, 0xff, 0x3f, 0xe5, 0xc1, 0x3d, 0xf6,
-  0xec, 0xd7, 0xf5, 0x10, 0xea, 0x2c, 0xfd, 0x34, 0xbc, 0xf1, 0xf1, 0x1d,
-  0x6f, 0xf4, 0xdd, 0xe4, 0x07, 0xed, 0x07, 0x16, 0x14, 0xf9, 0x45, 0xf9,
-  0x14, 0x09, 0x28, 0x0e, 0x49, 0x03, 0xd5, 0x33, 0xfd, 0x87, 0xd8, 0x81,
-  0xdc, 0xe8, 0x22, 0xd0, 0xd5, 0x25, 0xfa, 0xe8, 0x25, 0xff, 0xc4, 0xec,
-  0xd7, 0x5c, 0x33, 0x24, 0x24, 0x12, 0xfc, 0x0a, 0x19, 0x39, 0x08, 0x10,
-  0xde, 0xf8, 0xc6, 0xca, 0x39, 0xe5, 0xc1, 0x1c, 0x02, 0xf9, 0x01, 0xdc,
-  0xec, 0xe9, 0xfe, 0xee, 0xfd, 0xf7, 0xe6, 0xc3, 0xf7, 0xd9, 0xa9, 0x28,
-  0xbd, 0x56, 0x2c, 0xfd, 0x1f, 0xec, 0xbb, 0xe4, 0x2d, 0x16, 0x03, 0x1f,
-  0x11, 0xe3, 0x20, 0xd1, 0xe4, 0xfe, 0xe4, 0x21, 0x10, 0xfa, 0x17, 0xf8,
-  0xd6, 0x11, 0x02, 0xec, 0x0d, 0x16, 0xe4, 0xe6, 0x0c, 0xb0, 0xeb, 0xd4,
-  0x29, 0xf6, 0x81, 0xb0, 0xd7, 0x0a, 0x43, 0xce, 0x0c, 0x33, 0x19, 0x2f,
-  0x4e, 0xe7, 0x8c, 0x08, 0xee, 0x24, 0xf9, 0xe1, 0xe7, 0xf6, 0x99, 0xa4,
-  0xe1, 0x1c, 0x09, 0x19, 0x49, 0xe4, 0x09, 0x02, 0x18, 0x02, 0x2c, 0x26,
-  0x20, 0x29, 0x1b, 0x19, 0x34, 0x09, 0x24, 0xf4, 0xf2, 0xf0, 0x0b, 0xf0,
-  0xde, 0x36, 0x24, 0xc5, 0x0e, 0x0b, 0xfe, 0xec, 0x2c, 0xeb, 0x1a, 0x00,
-  0x29, 0xba, 0xa7, 0x15, 0x32, 0x50, 0xb4, 0xff, 0x2c, 0xd4, 0x55, 0xd7,
-  0xd4, 0x01, 0xf5, 0x13, 0xe2, 0x0f, 0x10, 0xf0, 0x25, 0x00, 0xee, 0xc5,
-  0xfa, 0xe5, 0xbb, 0x37, 0xe1, 0x07, 0xf7, 0xfb, 0xfd, 0x09, 0xe9, 0xbf,
-  0x00, 0xe3, 0x81, 0xa4, 0xe8, 0xc4, 0x8c, 0x1d, 0x0e, 0x19, 0x02, 0x06,
-  0x0e, 0xfc, 0x8c, 0xa1, 0x04, 0xfd, 0xed, 0x32, 0x1d, 0xe1, 0x38, 0x24,
-  0x01, 0xe4, 0x2a, 0xf0, 0xd4, 0x3c, 0x7c, 0x34, 0xf2, 0x06, 0xac, 0xfe,
-  0x14, 0xca, 0x14, 0x0b, 0x6c, 0xce, 0x2a, 0xe3, 0xff, 0xfb, 0xcd, 0x17,
-  0x20, 0xcb, 0x0c, 0x02, 0xe4, 0x29, 0x21, 0x09, 0x00, 0xcc, 0x88, 0x0c,
-  0x45, 0xfc, 0x2d, 0x2f, 0xfe, 0xb7, 0x49, 0x07, 0x38, 0xe4, 0x0e, 0xfe,
-  0x26, 0xb4, 0xe8, 0x3a, 0x33, 0x06, 0x12, 0xde, 0xd5, 0xfa, 0x93, 0x7f,
-  0x47, 0xfa, 0x2e, 0xb2, 0x01, 0xef, 0xbb, 0xdf, 0xed, 0x33, 0x47, 0x0a,
-  0xd7, 0x24, 0x07, 0x17, 0x4b, 0x28, 0x26, 0x0b, 0x1b, 0xf6, 0xe1, 0xf3,
-  0xe0, 0xd3, 0x0f, 0xd8, 0x1c, 0xc9, 0x10, 0xed, 0x12, 0x0c, 0xf5, 0xa1,
-  0xfd, 0x13, 0xf7, 0x38, 0xfe, 0x12, 0xfe, 0x3f, 0x03, 0x01, 0xb0, 0x4f,
-  0x1a, 0x02, 0xf3, 0x14, 0x38, 0x60, 0xeb, 0x27, 0x85, 0xd7, 0x58, 0xe2,
-  0x33, 0x1c, 0x40, 0x0f, 0xb0, 0xbc, 0xcd, 0xe4, 0x38, 0x5b, 0xeb, 0x37,
-  0x27, 0x22, 0x3d, 0xc9, 0x09, 0x48, 0xdc, 0x3f, 0xf6, 0xd0, 0xd7, 0xb3,
-  0x0d, 0xf8, 0x0e, 0x1f, 0x2f, 0xee, 0xcb, 0x5d, 0xd9, 0x24, 0xf8, 0x17,
-  0xe4, 0xfb, 0x45, 0x10, 0xef, 0xb1, 0xd4, 0xf6, 0x31, 0xea, 0x0a, 0xd7,
-  0x11, 0x7f, 0x75, 0x2d, 0x53, 0xf5, 0xc4, 0x05, 0x2b, 0x49, 0xac, 0x43,
-  0x13, 0x96, 0x72, 0xab, 0xbf, 0xea, 0xed, 0x31, 0x17, 0x24, 0xcb, 0xd3,
-  0xee, 0xda, 0x3c, 0x42, 0x2f, 0xfe, 0x5a, 0x46, 0xcd, 0x4e, 0x30, 0x3c,
-  0xec, 0xa5, 0x15, 0x0b, 0xcf, 0x06, 0x5a, 0xdb, 0xb9, 0xfa, 0x2d, 0x07,
-  0xf7, 0x0c, 0xa1, 0x21, 0xea, 0x2c, 0x81, 0xfe, 0xd8, 0xfd, 0xcc, 0x98,
-  0xf3, 0x1d, 0x1e, 0x56, 0x95, 0x04, 0x1c, 0xf5, 0x09, 0xd7, 0xfd, 0xe2,
-  0x33, 0xe5, 0x31, 0xe4, 0xee, 0x4d, 0xca, 0x0a, 0xf2, 0xcf, 0x11, 0x32,
-  0xdd, 0x17, 0xec, 0x2d, 0xcd, 0x32, 0x05, 0x2f, 0x14, 0x4e, 0xec, 0x2a,
-  0x03, 0xe1, 0xf4, 0xa9, 0x3d, 0x05, 0x62, 0x22, 0xc2, 0x29, 0x13, 0x01,
-  0x24, 0x20, 0x21, 0x0c, 0xd5, 0x5a, 0x0b, 0x97, 0x4f, 0x00, 0xf0, 0x14,
-  0xbf, 0xea, 0xeb, 0x09, 0xef, 0xe9, 0x19, 0x28, 0x38, 0x03, 0xf6, 0x12,
-  0x28, 0x09, 0xf8, 0x0f, 0x08, 0x11, 0xdf, 0xeb, 0x4e, 0x30, 0x2a, 0xeb,
-  0xff, 0x19, 0xd4, 0x1b, 0xf3, 0xcb, 0x08, 0xdc, 0x22, 0x0a, 0x50, 0x0a,
-  0x06, 0xde, 0xec, 0x20, 0x54, 0x04, 0x10, 0xc0, 0x2c, 0x36, 0x44, 0x2b,
-  0x41, 0x14, 0xf9, 0x17, 0xd2, 0x81, 0x1d, 0xee, 0xd5, 0xfe, 0x10, 0xfd,
-  0xfd, 0xe5, 0xdf, 0x1f, 0xfc, 0x0b, 0xd4, 0x11, 0xe9, 0xc4, 0xec, 0x10,
-  0x29, 0x0d, 0xcb, 0x14, 0xfe, 0xef, 0xf2, 0xe9, 0x0c, 0x97, 0xca, 0xb6,
-  0xe0, 0x17, 0x96, 0x0d, 0x22, 0xdc, 0x10, 0x1e, 0xde, 0x03, 0xee, 0xf6,
-  0x38, 0x50, 0x03, 0xd1, 0xee, 0xe0, 0x10, 0xf1, 0x0a, 0xd7, 0xff, 0xff,
-  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xc5, 0xa3, 0xff, 0xff,
-  0x04, 0xea, 0xff, 0xff, 0x1b, 0x10, 0x00, 0x00, 0x04, 0xc2, 0xff, 0xff,
-  0x72, 0x11, 0x00, 0x00, 0xc2, 0xfc, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00,
-  0xa9, 0xf0, 0xff, 0xff, 0xee, 0x3c, 0x00, 0x00, 0xb2, 0xfe, 0xff, 0xff,
-  0x91, 0x5f, 0x00, 0x00, 0x65, 0x30, 0x00, 0x00, 0xb9, 0xf6, 0xff, 0xff,
-  0x02, 0x9d, 0xff, 0xff, 0xd7, 0x04, 0x00, 0x00, 0x9e, 0x11, 0x00, 0x00,
-  0x56, 0xd7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-  0xeb, 0x1a, 0xeb, 0xfc, 0x03, 0xde, 0xd1, 0xeb, 0x4d, 0xd1, 0x0e, 0xfb,
-  0x54, 0xaf, 0x0a, 0x81, 0x88, 0x75, 0x81, 0x95, 0x95, 0x33, 0x0e, 0x4e,
-  0xe3, 0x0e, 0x61, 0xc5, 0x18, 0x68, 0x28, 0x17, 0xb6, 0x81, 0xaf, 0xd3,
-  0xbd, 0xeb, 0x3b, 0x86, 0xa3, 0x5a, 0x32, 0x2a, 0x36, 0x6e, 0xaa, 0x79,
-  0xba, 0xae, 0xe2, 0xcc, 0x81, 0x02, 0xfc, 0x96, 0xf9, 0xf8, 0xf2, 0xbd,
-  0xe5, 0x05, 0xb5, 0xd2, 0x2f, 0xf5, 0x1d, 0x10, 0xfa, 0x21, 0x81, 0xfa,
-  0x17, 0xf5, 0xf1, 0x2e, 0x0d, 0xe3, 0xf8, 0xd4, 0xc6, 0x74, 0x81, 0xd0,
-  0x52, 0xe3, 0xe2, 0x91, 0x20, 0x8e, 0xff, 0xdb, 0x49, 0xcb, 0x89, 0xbb,
-  0xed, 0xe2, 0x0e, 0xff, 0xba, 0x34, 0x0e, 0xe6, 0xc9, 0xda, 0x7f, 0xe1,
-  0xeb, 0x0f, 0xbc, 0x10, 0x8a, 0x70, 0x7f, 0xd9, 0x51, 0x5c, 0xd4, 0x8b,
-  0x74, 0x2a, 0xc1, 0x22, 0x64, 0xc3, 0x08, 0x55, 0xbe, 0x13, 0x04, 0xb9,
-  0x57, 0x13, 0x57, 0x7f, 0xb9, 0xea, 0xf3, 0xcf, 0xee, 0x4f, 0xeb, 0xc9,
-  0xe9, 0x0e, 0x03, 0x33, 0x81, 0x50, 0xd5, 0x97, 0xc6, 0xed, 0x71, 0xf0,
-  0xf4, 0x08, 0x1c, 0xc4, 0xd0, 0xbb, 0x19, 0x9f, 0x81, 0x77, 0x39, 0x3b,
-  0xbb, 0xc6, 0x14, 0xf9, 0xf4, 0x44, 0x94, 0x14, 0x48, 0xbe, 0x00, 0x4b,
-  0x97, 0x1e, 0x6a, 0x0d, 0x7f, 0x78, 0xc5, 0x4e, 0xfa, 0xb2, 0xcc, 0x37,
-  0xa1, 0xe5, 0x60, 0x01, 0x24, 0xf6, 0xfc, 0x05, 0x1e, 0x01, 0x0b, 0x7f,
-  0xc9, 0x2c, 0xf0, 0x1a, 0xef, 0xde, 0x35, 0x16, 0xe9, 0xf5, 0x7f, 0x23,
-  0xae, 0x09, 0xf5, 0x19, 0x13, 0x51, 0x19, 0xb6, 0x64, 0xc1, 0x69, 0x06,
-  0x5a, 0x5e, 0x41, 0x3c, 0xf2, 0x14, 0x3f, 0x12, 0x72, 0x3f, 0x7f, 0xea,
-  0xfb, 0x66, 0xf6, 0xd0, 0x11, 0x56, 0x81, 0x04, 0xd1, 0xf7, 0xb6, 0xf2,
-  0xe2, 0x4c, 0x02, 0xdc, 0xed, 0x3b, 0x54, 0xcd, 0x1a, 0x3b, 0x1c, 0xf9,
-  0x04, 0x01, 0xfb, 0x01, 0x69, 0xcb, 0x3b, 0x7f, 0x02, 0x35, 0x7f, 0xba,
-  0xf4, 0xf8, 0xf4, 0xc5, 0xde, 0x2c, 0xb6, 0x10, 0xcb, 0xea, 0x5a, 0xb3,
-  0xb5, 0xe4, 0xd5, 0xbc, 0x7f, 0x5a, 0x05, 0xf3, 0x4a, 0x44, 0x24, 0x1a,
-  0x07, 0x35, 0xcb, 0x2b, 0x41, 0x74, 0x6b, 0x4a, 0x44, 0xc8, 0x13, 0x1d,
-  0x9d, 0x7f, 0x40, 0x69, 0x6a, 0x36, 0xd3, 0x31, 0x6e, 0xe5, 0x11, 0x59,
-  0xf7, 0x07, 0xdc, 0x4a, 0xe4, 0x15, 0x81, 0x03, 0x3e, 0xbc, 0xfb, 0xf1,
-  0xcd, 0xc4, 0xdd, 0x7f, 0xef, 0xe8, 0xdf, 0x33, 0xe5, 0x23, 0x20, 0x05,
-  0xbb, 0x1e, 0x06, 0x4e, 0xd0, 0xf5, 0x91, 0xc4, 0x5a, 0xe1, 0xd4, 0x2e,
-  0x54, 0x7f, 0x3a, 0x26, 0xa4, 0xf6, 0xf4, 0xdc, 0xa5, 0xed, 0xfa, 0x29,
-  0x20, 0x4a, 0x7f, 0x48, 0xf3, 0x6d, 0xf3, 0xc4, 0xff, 0x16, 0xc0, 0xa1,
-  0x09, 0x98, 0x1e, 0x0a, 0x7f, 0x21, 0x63, 0xf3, 0x1f, 0x23, 0x30, 0x20,
-  0xd9, 0x49, 0x00, 0xfa, 0x47, 0x81, 0x4f, 0xfa, 0x11, 0x0a, 0xe9, 0x4c,
-  0x3d, 0xf3, 0xe6, 0x12, 0x70, 0xd4, 0xfd, 0x12, 0x28, 0x2c, 0x7f, 0x3a,
-  0x26, 0x03, 0xb6, 0x0a, 0x11, 0x1e, 0xf2, 0x57, 0xf9, 0xcd, 0x2d, 0xac,
-  0x02, 0xed, 0xc1, 0x08, 0x0d, 0x6e, 0x23, 0x97, 0x42, 0x81, 0x33, 0xf1,
-  0xfe, 0xde, 0x1a, 0x40, 0xb6, 0x16, 0xb6, 0xa7, 0x7f, 0xcd, 0xc9, 0x0f,
-  0xa6, 0x3d, 0xb8, 0x5a, 0xdc, 0x01, 0xdf, 0x16, 0x27, 0x1e, 0xd6, 0x2f,
-  0xfc, 0x7f, 0xae, 0xf9, 0x1d, 0x65, 0xe5, 0x41, 0x8b, 0xf1, 0xaf, 0x2a,
-  0xd1, 0x27, 0xc3, 0xdf, 0x39, 0xe6, 0xf0, 0x47, 0xb8, 0x38, 0xd4, 0xe1,
-  0xd9, 0x47, 0xf9, 0x7f, 0x0e, 0xa4, 0x76, 0x24, 0x7f, 0x08, 0x98, 0x00,
-  0xb9, 0x0c, 0xee, 0xd9, 0xea, 0x32, 0x54, 0x43, 0xd7, 0x22, 0xf5, 0xf1,
-  0x81, 0x39, 0x2b, 0xe7, 0x2c, 0xac, 0x0b, 0x0c, 0x45, 0x5e, 0xf1, 0x3a,
-  0x81, 0x02, 0x27, 0x31, 0xcd, 0x26, 0xb8, 0xfc, 0xbe, 0xd7, 0x47, 0xe5,
-  0xdd, 0x02, 0xf9, 0x71, 0xec, 0xf2, 0x01, 0xb3, 0x57, 0xe9, 0x12, 0x49,
-  0x03, 0xf6, 0xe9, 0xff, 0xc2, 0x16, 0xd8, 0x7f, 0x67, 0xca, 0x15, 0xdd,
-  0xf5, 0x33, 0xbe, 0xd6, 0xed, 0x81, 0xbc, 0x1b, 0xf0, 0xee, 0x41, 0xf0,
-  0xe9, 0x0c, 0xcd, 0xfa, 0xe2, 0x7f, 0xf3, 0x3a, 0xfe, 0x0c, 0x4e, 0x1b,
-  0x42, 0x24, 0xe5, 0xf2, 0xf9, 0xea, 0x21, 0xbc, 0x0b, 0xa3, 0x2c, 0xde,
-  0x81, 0x3d, 0xa8, 0xde, 0x2f, 0x26, 0x60, 0x2a, 0x93, 0x5c, 0x1a, 0x9f,
-  0x47, 0x13, 0x47, 0xb8, 0x0e, 0xf7, 0xb2, 0x14, 0xc8, 0xab, 0x81, 0x11,
-  0x49, 0x1c, 0x81, 0xac, 0xcd, 0xe5, 0x36, 0xc1, 0x0e, 0xb9, 0xe6, 0xbf,
-  0x50, 0x0c, 0xd4, 0xf0, 0xb0, 0x0e, 0xc0, 0x81, 0xae, 0xcf, 0x1e, 0x95,
-  0x0c, 0xdd, 0x28, 0xad, 0x65, 0x4c, 0x0c, 0x71, 0x9d, 0x81, 0xd8, 0x34,
-  0x18, 0x01, 0xb3, 0xeb, 0xfc, 0xef, 0x45, 0xcf, 0x8a, 0x19, 0xda, 0x2c,
-  0xd1, 0x4a, 0xfe, 0x81, 0x3e, 0x27, 0x0b, 0xa0, 0x41, 0x20, 0xe0, 0xea,
-  0x5e, 0x03, 0xef, 0x1c, 0xf2, 0x1a, 0x20, 0xf6, 0x7f, 0x5e, 0x3d, 0x13,
-  0x0c, 0xfb, 0xe9, 0xb4, 0x9c, 0xb0, 0xea, 0xd9, 0x5a, 0x04, 0x1f, 0x0a,
-  0x1c, 0x06, 0x16, 0x32, 0x0e, 0xaa, 0x24, 0xda, 0x7f, 0xf0, 0xf3, 0xec,
-  0xf9, 0xaf, 0x81, 0x0a, 0xd0, 0xab, 0xf8, 0x6b, 0x0f, 0xc1, 0x15, 0xde,
-  0xc3, 0x7b, 0x3c, 0xf9, 0xec, 0x81, 0x32, 0x17, 0xf6, 0x08, 0x96, 0x7e,
-  0x14, 0x9d, 0x44, 0x2d, 0x0e, 0x6a, 0x58, 0x35, 0xd3, 0xaa, 0xdf, 0x7f,
-  0x2d, 0xf6, 0x5f, 0x09, 0x1d, 0xaa, 0x92, 0xb9, 0x2a, 0xd1, 0x9b, 0x26,
-  0xa4, 0x23, 0xf7, 0xe2, 0xd7, 0x57, 0x10, 0xcb, 0x25, 0xed, 0x39, 0xec,
-  0xfc, 0x81, 0xa9, 0xf3, 0xaf, 0x2b, 0x24, 0x81, 0xf1, 0xd4, 0x70, 0x78,
-  0xbb, 0xe3, 0xf3, 0x64, 0xad, 0x15, 0xb5, 0xeb, 0x44, 0x2a, 0x81, 0xe6,
-  0x38, 0xa5, 0x2b, 0x22, 0xb3, 0x47, 0xbe, 0x0b, 0x42, 0xd5, 0xb6, 0xd9,
-  0x9f, 0x00, 0xd7, 0x70, 0xa2, 0x00, 0xb3, 0xc8, 0xc2, 0x81, 0x0b, 0xdb,
-  0xc1, 0x22, 0xf8, 0x7e, 0x81, 0xf9, 0x0d, 0xd7, 0x05, 0x24, 0x25, 0x02,
-  0x24, 0xdd, 0xda, 0xc6, 0xa0, 0xa2, 0xbf, 0x10, 0xf6, 0xea, 0x85, 0x9b,
-  0xf1, 0xeb, 0xea, 0x4d, 0xfd, 0xba, 0xa1, 0x1e, 0xc5, 0x2c, 0x56, 0x7f,
-  0xdf, 0x9c, 0x08, 0x08, 0xbf, 0x26, 0x5c, 0xce, 0xdb, 0xcc, 0x15, 0xe0,
-  0xd9, 0x14, 0x81, 0x61, 0xf6, 0xf5, 0xf1, 0x02, 0x13, 0xff, 0x3d, 0x4c,
-  0xc4, 0xf1, 0x81, 0xe2, 0x1e, 0xf0, 0x00, 0x45, 0x5e, 0x2d, 0xc2, 0xec,
-  0x81, 0x08, 0xaf, 0xcf, 0x03, 0xfc, 0xf8, 0x38, 0x23, 0xda, 0x11, 0xd4,
-  0xec, 0xf3, 0xfd, 0xea, 0x53, 0x09, 0x37, 0x0f, 0x16, 0x46, 0xf9, 0x1f,
-  0xcf, 0x24, 0x81, 0xd4, 0x41, 0x25, 0x15, 0xf3, 0x37, 0xf5, 0xd6, 0xd8,
-  0x18, 0x81, 0xd0, 0xff, 0xcc, 0xb2, 0xff, 0x20, 0xe6, 0x1d, 0x03, 0x1c,
-  0x2d, 0x1d, 0xbb, 0xdd, 0x16, 0x7f, 0xea, 0x1f, 0x05, 0xe9, 0xd3, 0xc3,
-  0xf6, 0xce, 0x06, 0xe3, 0x81, 0xd4, 0x1e, 0xd9, 0x07, 0x5e, 0xd9, 0x35,
-  0x17, 0x06, 0x1a, 0x29, 0x08, 0xf6, 0xd4, 0x1d, 0xce, 0xe2, 0x81, 0xb6,
-  0xe5, 0x03, 0xf9, 0x6a, 0x53, 0xf8, 0x5d, 0x0b, 0x1b, 0x18, 0xfe, 0xe1,
-  0xeb, 0x23, 0xfc, 0x7f, 0xd7, 0x4e, 0xfe, 0x68, 0xff, 0x50, 0x68, 0x23,
-  0x0f, 0x81, 0xcc, 0xe7, 0xb9, 0xfe, 0x19, 0xe8, 0xe4, 0x03, 0x01, 0xf2,
-  0xe0, 0x7f, 0x68, 0x16, 0xea, 0xde, 0x93, 0xd2, 0xce, 0x7a, 0x18, 0xd0,
-  0xeb, 0xc2, 0xfc, 0x09, 0x46, 0x23, 0xe7, 0x7f, 0xee, 0xe4, 0x1a, 0x10,
-  0x04, 0xdf, 0x47, 0x40, 0xec, 0x14, 0xa4, 0xf1, 0x24, 0x7f, 0xcd, 0x3e,
-  0xdd, 0xa4, 0x3d, 0xc6, 0xf6, 0xb6, 0x2f, 0xf8, 0x1d, 0xe5, 0x29, 0x5e,
-  0xda, 0xfa, 0x81, 0x19, 0xe2, 0x89, 0x9d, 0x0c, 0x9f, 0x71, 0xd9, 0x81,
-  0xf4, 0xdc, 0xae, 0xb6, 0x2a, 0xd9, 0xd0, 0x27, 0x4e, 0x29, 0x03, 0x0a,
-  0xd1, 0x0c, 0xee, 0xe3, 0xed, 0x81, 0xec, 0x01, 0x21, 0xe7, 0xf8, 0xea,
-  0x48, 0x24, 0x40, 0xee, 0xff, 0xf1, 0xd4, 0x21, 0xf3, 0x66, 0xd7, 0x17,
-  0x19, 0x55, 0x7f, 0xde, 0xdf, 0xc7, 0xf9, 0x0f, 0x81, 0x34, 0xe0, 0xa1,
-  0x3f, 0x4e, 0x09, 0x60, 0x3e, 0x01, 0xf9, 0x4a, 0x69, 0xc6, 0x49, 0x30,
-  0xb7, 0xb7, 0xfb, 0xdb, 0x7f, 0xea, 0xf4, 0x2d, 0xe9, 0xdf, 0x6b, 0xd8,
-  0x26, 0x04, 0x5f, 0x71, 0x4e, 0xe5, 0x81, 0x39, 0x50, 0xcf, 0x14, 0x44,
-  0xd7, 0xb3, 0x9e, 0x06, 0x3d, 0x12, 0xfe, 0x92, 0x0b, 0x81, 0x90, 0x0f,
-  0x24, 0x12, 0xc6, 0x18, 0xdf, 0xa7, 0x14, 0xed, 0x5f, 0x15, 0x45, 0x34,
-  0xa5, 0xf4, 0x11, 0x2f, 0x81, 0xed, 0xf2, 0x02, 0x57, 0xdc, 0x0a, 0xf0,
-  0x50, 0x72, 0xc0, 0x24, 0x28, 0x1d, 0x07, 0xfa, 0x20, 0x01, 0x2e, 0x39,
-  0x81, 0x2a, 0x2a, 0x52, 0x81, 0xad, 0x05, 0xdd, 0xca, 0xff, 0x5e, 0x21,
-  0xbf, 0x18, 0x5f, 0x46, 0xcb, 0x89, 0xd3, 0x54, 0xc7, 0xf3, 0x24, 0x5e,
-  0xed, 0x92, 0x40, 0x3c, 0x3a, 0xa8, 0x2e, 0x49, 0xbd, 0x7f, 0xe7, 0x62,
-  0x43, 0x3a, 0xe2, 0xfe, 0xb5, 0x30, 0x94, 0xc1, 0x3f, 0xc9, 0xbd, 0x10,
-  0x4b, 0x81, 0x24, 0x32, 0xbb, 0xdc, 0x41, 0xde, 0xf8, 0xe8, 0xe8, 0xc3,
-  0x01, 0x27, 0x0e, 0x22, 0xab, 0x7f, 0xd9, 0x3e, 0x22, 0x4e, 0x10, 0x8a,
-  0x16, 0x25, 0x60, 0xf2, 0x06, 0x21, 0xb9, 0x1d, 0x7f, 0x04, 0x03, 0xf4,
-  0x32, 0xa1, 0x26, 0x81, 0x17, 0x2c, 0x13, 0x6d, 0x70, 0xf9, 0x1a, 0xf8,
-  0xd9, 0xde, 0xad, 0xdd, 0x25, 0x20, 0x01, 0xe3, 0x64, 0x88, 0xfa, 0xe8,
-  0x03, 0x7c, 0x81, 0x0b, 0xd3, 0x18, 0x18, 0xf7, 0xbd, 0x0d, 0x1e, 0x22,
-  0x31, 0x6b, 0x76, 0x59, 0xcd, 0x4f, 0xc3, 0xe6, 0xa4, 0x47, 0x03, 0x81,
-  0x0b, 0xa1, 0xc8, 0x3b, 0xfd, 0xd9, 0x81, 0x17, 0xda, 0x1f, 0xcf, 0xf6,
-  0xc8, 0x0c, 0xe0, 0x8b, 0x81, 0x48, 0xd6, 0xed, 0x00, 0xcc, 0xd6, 0x14,
-  0xc7, 0xff, 0xf5, 0xb1, 0x93, 0xc9, 0xb3, 0xfb, 0x15, 0x01, 0x15, 0x7f,
-  0x15, 0xd3, 0x4a, 0xfe, 0xef, 0x0b, 0xcf, 0xbd, 0xf4, 0x59, 0xad, 0xf2,
-  0xd2, 0xfa, 0x7f, 0x14, 0x94, 0xdd, 0x41, 0x3c, 0x10, 0xe1, 0x1c, 0x25,
-  0xc2, 0x12, 0xf4, 0x0e, 0xdb, 0xd5, 0x9f, 0x3e, 0x32, 0x56, 0x40, 0x0a,
-  0xeb, 0xd7, 0x81, 0x92, 0x53, 0x10, 0x0e, 0x05, 0x27, 0x07, 0x1a, 0xa0,
-  0xd6, 0xd3, 0xa9, 0x17, 0x7f, 0xf4, 0x29, 0xa5, 0xd6, 0xe4, 0x39, 0xa2,
-  0xd0, 0x53, 0x16, 0x39, 0xa4, 0x4d, 0x6a, 0x7f, 0xec, 0xeb, 0xec, 0x77,
-  0x42, 0xfb, 0xf5, 0x6f, 0x01, 0x5f, 0x23, 0x14, 0x3a, 0x13, 0xf6, 0xc2,
-  0xa3, 0x09, 0xd4, 0x18, 0xeb, 0x81, 0xc2, 0xc6, 0xde, 0x23, 0xfd, 0xd6,
-  0x81, 0xec, 0xd4, 0x12, 0xab, 0x3b, 0x5d, 0x4a, 0xf7, 0x0c, 0x0a, 0x06,
-  0x51, 0xe8, 0x68, 0x2f, 0x81, 0xc7, 0x20, 0x2a, 0xdb, 0xba, 0xf6, 0xcc,
-  0x1b, 0xf9, 0xe8, 0xca, 0xbe, 0x89, 0x2a, 0x81, 0x25, 0x24, 0xf8, 0xec,
-  0x6b, 0xdd, 0xf8, 0x45, 0x17, 0x17, 0xd3, 0x35, 0xd7, 0xb9, 0x81, 0xcf,
-  0x44, 0x14, 0x9f, 0x2b, 0x7a, 0x22, 0x97, 0x5b, 0xdd, 0x44, 0xeb, 0x30,
-  0x62, 0xdd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0x38, 0x10, 0x00, 0x00, 0xde, 0x0f, 0x00, 0x00, 0x1d, 0x08, 0x00, 0x00,
-  0x16, 0xfa, 0xff, 0xff, 0x45, 0x08, 0x00, 0x00, 0x89, 0x1a, 0x00, 0x00,
-  0xe5, 0x1c, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x00, 0x19, 0x03, 0x00, 0x00,
-  0xb2, 0x18, 0x00, 0x00, 0xb2, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xff,
-  0x30, 0x08, 0x00, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x9f, 0x02, 0x00, 0x00,
-  0x7a, 0xff, 0xff, 0xff, 0x3d, 0x0b, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00,
-  0x6d, 0xf8, 0xff, 0xff, 0x8f, 0xfd, 0xff, 0xff, 0x97, 0x0c, 0x00, 0x00,
-  0x15, 0x24, 0x00, 0x00, 0x5c, 0x36, 0x00, 0x00, 0xe2, 0xfb, 0xff, 0xff,
-  0x80, 0xf4, 0xff, 0xff, 0xe8, 0xfc, 0xff, 0xff, 0xf9, 0x1f, 0x00, 0x00,
-  0x2f, 0xf9, 0xff, 0xff, 0x48, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x35, 0x19, 0x00, 0x00, 0x8e, 0xfd, 0xff, 0xff, 0x08, 0x1c, 0x00, 0x00,
-  0x7c, 0x0f, 0x00, 0x00, 0x86, 0x0d, 0x00, 0x00, 0xf9, 0xed, 0xff, 0xff,
-  0x6e, 0x03, 0x00, 0x00, 0x3f, 0xf4, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x00,
-  0x55, 0x07, 0x00, 0x00, 0x93, 0x0a, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00,
-  0x8b, 0x08, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00,
-  0xbc, 0x04, 0x00, 0x00, 0x43, 0x11, 0x00, 0x00, 0xa2, 0x10, 0x00, 0x00,
-  0x74, 0x14, 0x00, 0x00, 0xc9, 0x07, 0x00, 0x00, 0x51, 0x20, 0x00, 0x00,
-  0xbe, 0x06, 0x00, 0x00, 0x10, 0xf9, 0xff, 0xff, 0xf4, 0x0a, 0x00, 0x00,
-  0xf0, 0x02, 0x00, 0x00, 0xea, 0x08, 0x00, 0x00, 0x44, 0x08, 0x00, 0x00,
-  0xa4, 0x09, 0x00, 0x00, 0x97, 0x13, 0x00, 0x00, 0xe4, 0xfe, 0xff, 0xff,
-  0x97, 0xfc, 0xff, 0xff, 0xcb, 0x14, 0x00, 0x00, 0x98, 0x06, 0x00, 0x00,
-  0xce, 0x16, 0x00, 0x00, 0x4d, 0x0f, 0x00, 0x00, 0xfc, 0x0e, 0x00, 0x00,
-  0x25, 0xf1, 0xff, 0xff, 0x22, 0x0a, 0x00, 0x00, 0x3a, 0x0e, 0x00, 0x00,
-  0x5f, 0xfd, 0xff, 0xff, 0x36, 0x12, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00,
-  0xdc, 0x06, 0x00, 0x00, 0x3e, 0x08, 0x00, 0x00, 0xa2, 0x0b, 0x00, 0x00,
-  0xa9, 0x07, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x56, 0x06, 0x00, 0x00,
-  0x1f, 0x09, 0x00, 0x00, 0xdc, 0x09, 0x00, 0x00, 0x5f, 0x09, 0x00, 0x00,
-  0xbd, 0x05, 0x00, 0x00, 0x58, 0x1d, 0x00, 0x00, 0x6b, 0x0a, 0x00, 0x00,
-  0x6d, 0x08, 0x00, 0x00, 0x96, 0x0a, 0x00, 0x00, 0x6e, 0xfd, 0xff, 0xff,
-  0x95, 0xf9, 0xff, 0xff, 0x40, 0x33, 0x00, 0x00, 0xa1, 0xff, 0xff, 0xff,
-  0x51, 0x03, 0x00, 0x00, 0x25, 0xf9, 0xff, 0xff, 0x35, 0x16, 0x00, 0x00,
-  0x41, 0x0a, 0x00, 0x00, 0x34, 0xf9, 0xff, 0xff, 0x1a, 0xfc, 0xff, 0xff,
-  0xee, 0xde, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00,
-  0x2e, 0xf5, 0xda, 0x50, 0xf1, 0xfe, 0x2b, 0x3a, 0x38, 0xaf, 0x81, 0x65,
-  0xd1, 0xa1, 0xc4, 0xf4, 0xd1, 0xf8, 0x2f, 0x3c, 0x57, 0x45, 0x57, 0x7f,
-  0xf1, 0x67, 0xe9, 0x32, 0xad, 0x0a, 0x15, 0xce, 0xe5, 0xf4, 0xa9, 0x69,
-  0xb8, 0x43, 0x04, 0xc4, 0x34, 0xc9, 0x3e, 0x68, 0xcf, 0xed, 0x07, 0xc4,
-  0xf1, 0xb0, 0xfc, 0x09, 0x56, 0x4c, 0xa0, 0xe7, 0xa5, 0xa0, 0x9e, 0x81,
-  0x93, 0x1e, 0x81, 0xfb, 0xd8, 0x15, 0x78, 0xde, 0xfc, 0x2d, 0x60, 0xe0,
-  0xd5, 0x1a, 0x16, 0xc8, 0x21, 0xb8, 0xe4, 0x40, 0x22, 0x8b, 0x48, 0xcc,
-  0x92, 0xd0, 0x07, 0x14, 0x91, 0x21, 0xa2, 0x7f, 0x77, 0xf1, 0x7f, 0x3d,
-  0xe4, 0xdd, 0xca, 0x45, 0x11, 0x43, 0xd6, 0x31, 0x7f, 0x09, 0xbe, 0x7f,
-  0xe1, 0xa2, 0x97, 0x58, 0xae, 0x3b, 0x06, 0x7f, 0x5d, 0xf9, 0x60, 0x74,
-  0xfb, 0x7f, 0x17, 0x2b, 0xd0, 0x7f, 0xee, 0x81, 0x46, 0x58, 0xf4, 0x6a,
-  0x2c, 0x3b, 0xf7, 0x8c, 0x7f, 0x01, 0x4f, 0x7f, 0xdf, 0x81, 0x7f, 0x9d,
-  0x0d, 0x81, 0x0b, 0xe1, 0x55, 0x7f, 0x9d, 0x81, 0xe9, 0xc3, 0x91, 0xa3,
-  0xe3, 0xbb, 0xd2, 0x2c, 0xf0, 0x49, 0x7f, 0xeb, 0x0d, 0x7f, 0x7f, 0x02,
-  0xd5, 0x12, 0xdd, 0x9a, 0x37, 0xba, 0x0e, 0x73, 0xff, 0xe6, 0x7f, 0xa1,
-  0xc3, 0xac, 0x64, 0x76, 0x6e, 0x48, 0x81, 0x0a, 0x7b, 0xcd, 0x54, 0x55,
-  0x18, 0xd5, 0xcf, 0x46, 0xfc, 0xe9, 0xe7, 0x25, 0x1b, 0x2f, 0x85, 0x5a,
-  0xbe, 0xc6, 0xce, 0xc6, 0xd3, 0xe9, 0x3a, 0x27, 0x6b, 0x4a, 0x52, 0x64,
-  0xe7, 0x0b, 0x26, 0x33, 0xce, 0x13, 0x0b, 0xd6, 0xee, 0xb0, 0xac, 0x7f,
-  0xa3, 0x26, 0x03, 0xfb, 0x1a, 0x4b, 0x1c, 0x6a, 0xc4, 0xe6, 0x09, 0xe5,
-  0x1c, 0xaf, 0xe8, 0xfc, 0x35, 0x1d, 0xeb, 0xfc, 0x6e, 0xa8, 0x97, 0x9f,
-  0x81, 0x20, 0xa0, 0xfb, 0x4a, 0x0e, 0x62, 0xe7, 0xeb, 0x33, 0x4e, 0xa9,
-  0xe1, 0xbd, 0x15, 0xa6, 0x0c, 0xb8, 0xaf, 0x25, 0x11, 0xac, 0x1a, 0xe2,
-  0x87, 0xdd, 0xf8, 0x08, 0xae, 0x0d, 0xbf, 0x4e, 0x39, 0x26, 0x62, 0x2a,
-  0x7f, 0xc3, 0x25, 0x4f, 0xed, 0xc3, 0x7f, 0x28, 0xe5, 0x82, 0xc0, 0x70,
-  0xc9, 0xb1, 0x98, 0x4f, 0xd7, 0xcb, 0x6e, 0x2f, 0x81, 0x24, 0x8a, 0xcc,
-  0xcc, 0x43, 0x81, 0x1a, 0xa2, 0x2d, 0x7f, 0xd6, 0xfa, 0x23, 0xf0, 0x61,
-  0x98, 0x3f, 0xf6, 0xa2, 0x49, 0x81, 0x11, 0x4c, 0xbd, 0xa9, 0xfb, 0x8a,
-  0x81, 0xb1, 0xbd, 0x3d, 0x6d, 0xe4, 0x26, 0xfe, 0x81, 0xf7, 0xbd, 0xfa,
-  0xa2, 0x81, 0x9e, 0x59, 0x81, 0xe2, 0x67, 0xab, 0xce, 0xee, 0xc6, 0x83,
-  0x81, 0x2b, 0x62, 0xa7, 0x26, 0x2a, 0x8a, 0xec, 0x7f, 0x81, 0xe0, 0x7c,
-  0x9d, 0x13, 0x1a, 0x56, 0xcc, 0x24, 0xf8, 0x59, 0x17, 0xac, 0x32, 0x05,
-  0x89, 0x0e, 0xcc, 0x41, 0xcb, 0x81, 0x86, 0x81, 0x73, 0xe4, 0xf5, 0x7b,
-  0xc2, 0x9d, 0xf9, 0x7f, 0x81, 0x81, 0x7f, 0x7a, 0xff, 0x81, 0x81, 0x1f,
-  0x81, 0x49, 0x13, 0x36, 0x81, 0xf8, 0xa7, 0xf0, 0x94, 0x4c, 0x7f, 0xd6,
-  0xe9, 0x72, 0x7f, 0xb1, 0xbc, 0x11, 0xeb, 0x13, 0x11, 0xb2, 0xb2, 0x81,
-  0xfe, 0x92, 0xe8, 0x7f, 0x7f, 0x44, 0x7f, 0xad, 0x05, 0x29, 0x7f, 0x10,
-  0x43, 0xf2, 0x87, 0x7f, 0xe8, 0x81, 0x1d, 0x7f, 0x00, 0x61, 0x9d, 0xb3,
-  0x9a, 0x2a, 0x81, 0xf0, 0x7f, 0x7f, 0x26, 0x81, 0xbb, 0xdb, 0x8f, 0x43,
-  0x81, 0xcb, 0x7f, 0x75, 0x7f, 0x3a, 0x8f, 0xe1, 0x81, 0xa5, 0xca, 0x7f,
-  0x53, 0x00, 0x47, 0x56, 0xfb, 0xdb, 0xfe, 0x4b, 0xcf, 0x7f, 0xd6, 0x2d,
-  0xf4, 0xb3, 0x86, 0x2a, 0xe3, 0xe2, 0x50, 0x07, 0x87, 0x2e, 0xba, 0xb1,
-  0xe7, 0x7a, 0x65, 0xea, 0x5e, 0x15, 0x37, 0xc1, 0xee, 0x81, 0xce, 0x5c,
-  0x81, 0x32, 0xf7, 0x98, 0x13, 0x4f, 0x12, 0x6a, 0xd6, 0xb2, 0xee, 0x9e,
-  0x4d, 0xe4, 0xce, 0x20, 0x53, 0xc3, 0x9e, 0x04, 0x76, 0xf0, 0x8b, 0x0c,
-  0xa8, 0xa4, 0xc0, 0x51, 0x72, 0xed, 0x4c, 0xc1, 0xc1, 0xd4, 0xd7, 0xb7,
-  0x97, 0x81, 0x29, 0x81, 0xf6, 0xdb, 0x81, 0xec, 0xf6, 0x91, 0xed, 0x7f,
-  0xcd, 0x2a, 0x0c, 0x48, 0xce, 0x1b, 0x15, 0x68, 0x17, 0x7f, 0x3c, 0xe2,
-  0x33, 0x81, 0x06, 0x54, 0x19, 0x02, 0x37, 0x2c, 0xc5, 0xd0, 0xea, 0x29,
-  0x4f, 0x81, 0xae, 0x4c, 0xa2, 0x11, 0x05, 0x33, 0xed, 0x4f, 0x1e, 0xf7,
-  0x11, 0x19, 0xfe, 0x68, 0x94, 0x1e, 0x15, 0xaf, 0xcd, 0xc6, 0xe2, 0x15,
-  0x5a, 0x4e, 0xf0, 0xc2, 0x32, 0xf5, 0xba, 0x05, 0xa2, 0xe1, 0x03, 0x01,
-  0x04, 0x20, 0x8e, 0x46, 0x1b, 0xa6, 0x9d, 0x0d, 0xd8, 0x1c, 0xaa, 0x34,
-  0xe4, 0xb0, 0x2d, 0x2a, 0xa7, 0x30, 0x0b, 0xc1, 0x1e, 0xc1, 0x01, 0x73,
-  0xb0, 0x19, 0x2c, 0xb5, 0xf2, 0x23, 0x00, 0x35, 0x1b, 0xe9, 0xca, 0xd2,
-  0xe3, 0x44, 0x07, 0x44, 0xec, 0x7f, 0x1a, 0x43, 0xd3, 0xf7, 0x3f, 0xe1,
-  0xc9, 0xe1, 0x7f, 0x3e, 0x7f, 0x42, 0x05, 0x0e, 0xe1, 0x11, 0xbc, 0x3e,
-  0x7f, 0xa1, 0x81, 0x3e, 0xa6, 0x44, 0xfd, 0x37, 0x07, 0x2c, 0x10, 0xf9,
-  0x2a, 0x8b, 0xe9, 0x7f, 0xa6, 0x1c, 0x0f, 0xcf, 0x81, 0x22, 0xe9, 0xf3,
-  0x73, 0x7f, 0x0c, 0x81, 0x1e, 0xef, 0x81, 0x2d, 0xc0, 0xbf, 0xea, 0xf4,
-  0x03, 0x20, 0xb9, 0x2d, 0x1d, 0x8e, 0xca, 0x8f, 0xec, 0x7f, 0xd4, 0x3b,
-  0x4e, 0xad, 0x4a, 0x4d, 0xea, 0x3c, 0x14, 0xe2, 0x7f, 0xd9, 0x02, 0x2b,
-  0x92, 0xf6, 0x06, 0xa8, 0x02, 0x14, 0xf2, 0x17, 0x0c, 0x9e, 0xb5, 0xc5,
-  0x34, 0x7f, 0x0d, 0x7f, 0x6d, 0x5b, 0x03, 0x41, 0xcf, 0xfc, 0x14, 0xf8,
-  0x14, 0x29, 0x11, 0x7f, 0x0a, 0xe1, 0x03, 0x45, 0xdc, 0x3d, 0xed, 0x1c,
-  0x46, 0xa1, 0xdb, 0x38, 0xb5, 0x14, 0xd7, 0x34, 0xf6, 0x39, 0xff, 0xd8,
-  0x0f, 0x51, 0x07, 0x52, 0xed, 0x1a, 0x0a, 0xd2, 0xc3, 0xe3, 0xe4, 0x1b,
-  0x42, 0x38, 0xfb, 0xe9, 0x2a, 0x1b, 0xc1, 0x17, 0x81, 0xbd, 0x01, 0x01,
-  0x2c, 0x3c, 0x81, 0x21, 0xf4, 0x99, 0x06, 0x0d, 0x59, 0x09, 0xcb, 0x14,
-  0xed, 0xb4, 0x27, 0x22, 0x5d, 0x21, 0xf4, 0xd8, 0x0a, 0xe3, 0x01, 0x7f,
-  0xda, 0xdc, 0x1d, 0x8c, 0x08, 0x10, 0xd9, 0x3c, 0x02, 0xe5, 0xd1, 0xe5,
-  0xec, 0x49, 0x04, 0x2f, 0xd8, 0x65, 0xfb, 0x3d, 0xe1, 0x1d, 0x35, 0x00,
-  0x5a, 0xe2, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
-  0xc7, 0xf5, 0xff, 0xff, 0xe4, 0x13, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x00,
-  0x2c, 0xed, 0xff, 0xff, 0x8c, 0xf6, 0xff, 0xff, 0x3b, 0x14, 0x00, 0x00,
-  0xff, 0xf8, 0xff, 0xff, 0xe8, 0xf1, 0xff, 0xff, 0x40, 0xfa, 0xff, 0xff,
-  0x2d, 0x00, 0x00, 0x00, 0xce, 0x2c, 0x00, 0x00, 0x4d, 0xe8, 0xff, 0xff,
-  0x4b, 0xf9, 0xff, 0xff, 0xfe, 0x63, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00,
-  0xf3, 0xe2, 0xff, 0xff, 0xd4, 0x4f, 0x00, 0x00, 0x08, 0x0a, 0x00, 0x00,
-  0x4f, 0xf3, 0xff, 0xff, 0x30, 0x02, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00,
-  0x0c, 0xe4, 0xff, 0xff, 0xc9, 0xfc, 0xff, 0xff, 0x81, 0xf9, 0xff, 0xff,
-  0xb9, 0x07, 0x00, 0x00, 0xc1, 0xe6, 0xff, 0xff, 0xbd, 0xfc, 0xff, 0xff,
-  0xd1, 0xf2, 0xff, 0xff, 0x20, 0x28, 0x00, 0x00, 0x62, 0xe8, 0xff, 0xff,
-  0xdd, 0xeb, 0xff, 0xff, 0x3a, 0x1c, 0x00, 0x00, 0xe7, 0x2f, 0x00, 0x00,
-  0xa4, 0x07, 0x00, 0x00, 0x42, 0x17, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff,
-  0xb6, 0x0b, 0x00, 0x00, 0x19, 0xf5, 0xff, 0xff, 0x12, 0xfd, 0xff, 0xff,
-  0x9b, 0x2b, 0x00, 0x00, 0x48, 0xf6, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-  0x2c, 0x0d, 0x00, 0x00, 0x3d, 0xd8, 0xff, 0xff, 0x2c, 0x33, 0x00, 0x00,
-  0xd4, 0x43, 0x00, 0x00, 0x36, 0xfd, 0xff, 0xff, 0x62, 0x3f, 0x00, 0x00,
-  0xeb, 0xfa, 0xff, 0xff, 0x6d, 0x22, 0x00, 0x00, 0xc6, 0x2c, 0x00, 0x00,
-  0x79, 0xea, 0xff, 0xff, 0xa2, 0xfa, 0xff, 0xff, 0x85, 0x11, 0x00, 0x00,
-  0xc8, 0x01, 0x00, 0x00, 0x0f, 0x28, 0x00, 0x00, 0x7c, 0xf6, 0xff, 0xff,
-  0x7c, 0x05, 0x00, 0x00, 0x88, 0x69, 0x00, 0x00, 0x1a, 0x1e, 0x00, 0x00,
-  0x06, 0x1d, 0x00, 0x00, 0xd9, 0x3e, 0x00, 0x00, 0xce, 0x30, 0x00, 0x00,
-  0x73, 0xcf, 0xff, 0xff, 0x78, 0x04, 0x00, 0x00, 0x2b, 0x04, 0x00, 0x00,
-  0xae, 0xf6, 0xff, 0xff, 0xc1, 0x26, 0x00, 0x00, 0xa8, 0xf7, 0xff, 0xff,
-  0x96, 0x00, 0x00, 0x00, 0x2d, 0xf9, 0xff, 0xff, 0xb1, 0x10, 0x00, 0x00,
-  0x97, 0x54, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x00, 0x14, 0xf5, 0xff, 0xff,
-  0x66, 0x4e, 0x00, 0x00, 0x85, 0xf7, 0xff, 0xff, 0x84, 0xf7, 0xff, 0xff,
-  0x75, 0x23, 0x00, 0x00, 0x3d, 0xea, 0xff, 0xff, 0x9b, 0xef, 0xff, 0xff,
-  0xc2, 0x43, 0x00, 0x00, 0xbf, 0x0e, 0x00, 0x00, 0x05, 0x0e, 0x00, 0x00,
-  0x9d, 0x43, 0x00, 0x00, 0x0e, 0xf7, 0xff, 0xff, 0x0f, 0xf1, 0xff, 0xff,
-  0x02, 0xeb, 0xff, 0xff, 0x5a, 0xfb, 0xff, 0xff, 0xf7, 0xdd, 0xff, 0xff,
-  0x3b, 0x2f, 0x00, 0x00, 0xa8, 0xf8, 0xff, 0xff, 0x81, 0xfa, 0xff, 0xff,
-  0x6a, 0x00, 0x00, 0x00, 0xe4, 0xf8, 0xff, 0xff, 0x7d, 0xe8, 0xff, 0xff,
-  0xe6, 0xe3, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
-  0xa9, 0x2f, 0x35, 0xe4, 0xbe, 0xe5, 0xcf, 0xe9, 0xce, 0xe4, 0x12, 0xd0,
-  0x35, 0x53, 0xf7, 0xdc, 0x0d, 0x01, 0x6f, 0x1b, 0x0f, 0xb4, 0x6d, 0x4b,
-  0x28, 0x19, 0xfd, 0x45, 0xd2, 0x8c, 0xb0, 0xdb, 0xee, 0xd4, 0x15, 0x36,
-  0x19, 0x26, 0xfd, 0x3f, 0xde, 0x12, 0xb9, 0x2b, 0xaf, 0xef, 0x14, 0x50,
-  0xea, 0x2b, 0xd1, 0xfe, 0x29, 0x15, 0x10, 0xd0, 0x8e, 0x09, 0xdb, 0x7f,
-  0x4f, 0x23, 0x07, 0x09, 0xf5, 0xd9, 0xc2, 0x16, 0xdb, 0xca, 0xfb, 0xf1,
-  0xed, 0xeb, 0xc5, 0xd0, 0xef, 0x10, 0xe0, 0xf6, 0xcf, 0x24, 0x3f, 0xb2,
-  0x1a, 0x3a, 0x03, 0x37, 0x11, 0x1c, 0x0b, 0xe7, 0xb9, 0xe3, 0xd5, 0x16,
-  0x52, 0x18, 0x0d, 0xc8, 0xa9, 0xbf, 0x12, 0xe5, 0xe9, 0x01, 0x55, 0xb7,
-  0x1f, 0x28, 0xa1, 0xc8, 0x07, 0x03, 0xf1, 0x35, 0x1a, 0xaa, 0x0a, 0x33,
-  0xe3, 0xc4, 0xfa, 0x01, 0x58, 0x91, 0x7b, 0x8b, 0x4f, 0x1c, 0xdb, 0x4e,
-  0x29, 0x50, 0x0f, 0xfa, 0xf4, 0x35, 0xf3, 0x05, 0x1e, 0x39, 0xab, 0xae,
-  0xcb, 0xec, 0xfa, 0x0c, 0x51, 0xc2, 0xd9, 0x3b, 0xd6, 0x45, 0xbe, 0x53,
-  0x3c, 0x38, 0x20, 0x81, 0xfa, 0xfc, 0xa7, 0x2b, 0x1c, 0xfa, 0xc0, 0x04,
-  0xa9, 0xe6, 0x19, 0x9b, 0x23, 0x05, 0x25, 0xba, 0xd3, 0xfa, 0x88, 0xd5,
-  0x37, 0x0b, 0xef, 0x18, 0xcc, 0x29, 0xbe, 0x25, 0x00, 0x47, 0xb6, 0x63,
-  0x43, 0xfa, 0xec, 0xca, 0x28, 0xb7, 0x24, 0x2e, 0xc7, 0xf1, 0xf7, 0xf7,
-  0xaa, 0xc5, 0xf0, 0xd1, 0x9f, 0xe2, 0xe1, 0x0b, 0xdc, 0xb7, 0x02, 0x29,
-  0xe6, 0xc5, 0xe3, 0xee, 0x0e, 0x15, 0xcd, 0x5b, 0xce, 0x7f, 0x03, 0x0c,
-  0xfd, 0xe3, 0x02, 0x06, 0xac, 0x2f, 0x64, 0x0c, 0xbc, 0x02, 0x04, 0xd3,
-  0x32, 0x1d, 0xc1, 0xe6, 0x38, 0xe9, 0xd1, 0x36, 0x32, 0xdb, 0x32, 0x09,
-  0x0b, 0x35, 0xf3, 0x0a, 0x34, 0x0a, 0xcb, 0x05, 0x09, 0x1d, 0xce, 0x30,
-  0x56, 0x13, 0x37, 0x04, 0xf8, 0xd6, 0x65, 0x40, 0x3f, 0xd4, 0xce, 0x33,
-  0xed, 0x07, 0xfb, 0x3f, 0x1c, 0x0f, 0xf7, 0x33, 0xd2, 0x2e, 0xfa, 0x14,
-  0xda, 0xf9, 0xdf, 0x0b, 0x06, 0xff, 0xf5, 0x96, 0xf9, 0x37, 0x6b, 0x60,
-  0x1b, 0x08, 0x8a, 0x39, 0xe5, 0xfc, 0x13, 0x12, 0x02, 0x7f, 0x5d, 0xcb,
-  0x15, 0x2f, 0xe9, 0x0d, 0x7e, 0xda, 0x59, 0xbe, 0x08, 0x25, 0xd3, 0x1d,
-  0x2b, 0x7a, 0x1a, 0x23, 0x8b, 0xe9, 0xdd, 0x34, 0xc3, 0x21, 0x22, 0x15,
-  0xe7, 0xe9, 0xe2, 0xdb, 0x47, 0xc5, 0xe7, 0xcb, 0x29, 0x3d, 0xe3, 0x35,
-  0x1c, 0xeb, 0xef, 0x19, 0x2b, 0x4d, 0x07, 0x0f, 0xef, 0x09, 0x04, 0xad,
-  0xcf, 0xc6, 0x3e, 0xed, 0x28, 0x1d, 0xdf, 0xea, 0xec, 0xcb, 0xc7, 0x01,
-  0x15, 0xa3, 0x2c, 0xeb, 0x0b, 0x3b, 0x26, 0xf3, 0x1b, 0x11, 0xed, 0x3c,
-  0x25, 0x14, 0xe5, 0x04, 0x28, 0x01, 0xcc, 0xeb, 0xe9, 0x23, 0x7c, 0xfe,
-  0xfa, 0x11, 0xe5, 0xcb, 0xe5, 0x02, 0x08, 0x1a, 0xfc, 0xd5, 0x4e, 0x68,
-  0xc8, 0xfd, 0x81, 0x1c, 0xf5, 0xdd, 0x17, 0xd6, 0xeb, 0xe7, 0x0f, 0x4b,
-  0x05, 0x38, 0x2c, 0x27, 0xde, 0xf3, 0x39, 0xe3, 0xf4, 0x0e, 0xf2, 0x27,
-  0xdd, 0x50, 0xee, 0x21, 0x52, 0xf5, 0xd3, 0x15, 0x33, 0xef, 0xf8, 0x0a,
-  0x1e, 0xf3, 0x35, 0x0e, 0xd9, 0x0e, 0x05, 0x20, 0xd2, 0x32, 0xef, 0x43,
-  0x03, 0xc4, 0xe9, 0xbb, 0x28, 0xe0, 0x11, 0x20, 0xf0, 0x1e, 0xbc, 0xed,
-  0x0f, 0xf7, 0x25, 0xf6, 0x52, 0x0e, 0x12, 0xf7, 0xc2, 0xf0, 0x3d, 0x18,
-  0xad, 0x21, 0x1e, 0x10, 0x48, 0xee, 0x45, 0x0b, 0x1b, 0x33, 0xe7, 0xfa,
-  0x57, 0x0a, 0xf5, 0xd0, 0x15, 0xde, 0x44, 0x1c, 0x84, 0xe2, 0xa1, 0x45,
-  0xab, 0xee, 0x2c, 0x1b, 0x1b, 0xc0, 0xea, 0x41, 0x1c, 0x76, 0x0e, 0xe6,
-  0xd5, 0x10, 0x17, 0xbf, 0x10, 0x7f, 0x71, 0xed, 0xf6, 0x76, 0x11, 0xe2,
-  0x09, 0x1e, 0x27, 0x47, 0xef, 0xeb, 0x05, 0xc5, 0x00, 0xe3, 0xc3, 0x85,
-  0x29, 0x40, 0xb9, 0xe7, 0x5b, 0xa1, 0xc2, 0x9e, 0xcd, 0x04, 0xf0, 0x05,
-  0xd6, 0x15, 0xe3, 0xae, 0x07, 0x0c, 0xd5, 0xe1, 0x78, 0x38, 0x03, 0xd2,
-  0x94, 0x3b, 0x0a, 0x16, 0x02, 0x16, 0x22, 0xe1, 0x0e, 0x26, 0x0e, 0x66,
-  0x48, 0xeb, 0xbd, 0x29, 0xd6, 0xb1, 0x61, 0x5d, 0x9e, 0x48, 0xd3, 0x0e,
-  0x9f, 0xa4, 0x65, 0x0e, 0x1d, 0xbe, 0xff, 0x0c, 0xf7, 0xfc, 0xb9, 0xa3,
-  0xc9, 0x28, 0x38, 0xff, 0x09, 0x05, 0x40, 0xde, 0x06, 0x0b, 0x26, 0x9b,
-  0x15, 0xe7, 0x14, 0x26, 0x1c, 0xf6, 0xbc, 0xb2, 0xfb, 0xcf, 0x96, 0x29,
-  0x1c, 0x81, 0xf8, 0x41, 0xf1, 0x0c, 0xf1, 0xb8, 0x2d, 0x34, 0x21, 0xc9,
-  0xb6, 0x14, 0x9c, 0xf3, 0x05, 0x07, 0xb6, 0x2e, 0x26, 0x01, 0xf2, 0xbf,
-  0xea, 0x10, 0x33, 0x52, 0x2d, 0xdd, 0x0e, 0x8a, 0x06, 0x04, 0xcd, 0x4f,
-  0xd9, 0xd1, 0x09, 0xf8, 0xb2, 0x1c, 0x37, 0x38, 0xef, 0xf5, 0xb2, 0x65,
-  0xf3, 0x50, 0xde, 0xba, 0xec, 0x09, 0x01, 0x03, 0xb7, 0x15, 0xe9, 0xd3,
-  0xd5, 0x0c, 0xef, 0xf2, 0xa2, 0xf1, 0xd7, 0x2b, 0xfb, 0x73, 0x30, 0x1d,
-  0x10, 0xfe, 0x07, 0x25, 0x59, 0x2a, 0x66, 0xb3, 0x5e, 0x0d, 0xc5, 0x34,
-  0x0e, 0x21, 0xff, 0x4b, 0xa9, 0x03, 0x20, 0xc5, 0x11, 0xb9, 0x3d, 0xff,
-  0x12, 0xdb, 0x81, 0xe4, 0x07, 0x23, 0x13, 0xf5, 0x41, 0xe4, 0xaa, 0x2a,
-  0xfa, 0x73, 0x23, 0xed, 0xd1, 0x1c, 0xd6, 0x31, 0xdf, 0x00, 0x82, 0x1b,
-  0x18, 0x36, 0xee, 0x3d, 0xeb, 0x20, 0x21, 0xbf, 0xf3, 0x8f, 0x54, 0xbf,
-  0x49, 0xcf, 0xf2, 0xeb, 0xf7, 0x4a, 0xb1, 0x2f, 0x1f, 0xd4, 0xeb, 0x04,
-  0x18, 0x64, 0xd3, 0x3e, 0xe0, 0xc3, 0xbc, 0x16, 0xbf, 0xda, 0x18, 0x0b,
-  0xfe, 0x54, 0xfa, 0x6e, 0x09, 0xd2, 0x2a, 0x17, 0x43, 0xe4, 0xfc, 0x0d,
-  0xe4, 0x61, 0x14, 0x40, 0xea, 0xe8, 0xd9, 0xd0, 0xf2, 0xce, 0xf4, 0xc2,
-  0xca, 0x30, 0x35, 0xf4, 0xf7, 0xfc, 0x28, 0x3d, 0xde, 0xea, 0x14, 0xde,
-  0xf5, 0x0b, 0x3d, 0x5c, 0x0b, 0xdd, 0xae, 0x75, 0xd9, 0x50, 0xf1, 0xe9,
-  0xd4, 0x15, 0x19, 0x4c, 0x0a, 0xc9, 0xdd, 0xf0, 0xd6, 0x22, 0x13, 0x0b,
-  0xdc, 0xd1, 0x88, 0xd4, 0xd4, 0x37, 0xc7, 0xf1, 0xd6, 0x05, 0xc4, 0xc9,
-  0x09, 0x16, 0x19, 0x2f, 0x30, 0x5e, 0xcc, 0xed, 0x81, 0x99, 0x25, 0xc6,
-  0xe5, 0x03, 0xb7, 0x1b, 0xda, 0xd7, 0x33, 0x3e, 0xe8, 0x20, 0xe9, 0x6c,
-  0x99, 0xd0, 0x0a, 0x77, 0x01, 0x10, 0x4b, 0xda, 0xdc, 0x3f, 0x2e, 0xb1,
-  0xe5, 0xfd, 0xee, 0xe6, 0x43, 0xd9, 0x48, 0x2f, 0xec, 0xf8, 0xdc, 0x81,
-  0xe7, 0xed, 0xfa, 0x13, 0x14, 0x08, 0x3e, 0xd3, 0xfa, 0xd4, 0x17, 0x02,
-  0xf6, 0x73, 0xec, 0xfa, 0xcd, 0x9b, 0xf0, 0xf1, 0x0b, 0xdd, 0x3a, 0x09,
-  0xcb, 0x57, 0xe5, 0xdd, 0x37, 0x0d, 0x10, 0x00, 0x9b, 0x01, 0x2e, 0x53,
-  0xf8, 0x61, 0xbb, 0xaa, 0xc8, 0x04, 0xf1, 0x2a, 0x38, 0xbb, 0x26, 0xf4,
-  0x39, 0xd0, 0xf2, 0xf3, 0xce, 0xfb, 0xef, 0xd4, 0x6b, 0x1d, 0x0c, 0xfc,
-  0x1f, 0xfa, 0xd3, 0xea, 0xdb, 0x1a, 0x31, 0xf2, 0xf4, 0xde, 0x1a, 0xe2,
-  0xae, 0xfb, 0xed, 0xf0, 0xa7, 0xf6, 0x0a, 0x1f, 0x16, 0x09, 0x23, 0xee,
-  0x09, 0x49, 0x0e, 0x04, 0xea, 0xc4, 0xef, 0xe1, 0x67, 0xd5, 0x00, 0x2e,
-  0x41, 0xd0, 0x3d, 0x7f, 0xea, 0xdb, 0x12, 0x1e, 0xce, 0xa2, 0xe2, 0x3f,
-  0x0f, 0x76, 0x8e, 0xc3, 0x08, 0x3a, 0x19, 0x1e, 0x19, 0xca, 0x2a, 0x4c,
-  0x10, 0x3f, 0xd2, 0xdd, 0xd4, 0xe1, 0xde, 0x61, 0x33, 0xee, 0xca, 0x29,
-  0x63, 0x10, 0x2b, 0xb9, 0x1e, 0xc2, 0x23, 0xe9, 0xee, 0xd9, 0x1c, 0x15,
-  0xf3, 0xdb, 0x01, 0xe6, 0xd5, 0xf8, 0x23, 0x45, 0x29, 0x18, 0xc8, 0x0b,
-  0xd7, 0xef, 0x2b, 0xd7, 0x30, 0xb6, 0xf0, 0xe1, 0x3f, 0xc8, 0x16, 0x23,
-  0xff, 0x3c, 0xd0, 0x32, 0xc1, 0xdf, 0x54, 0xf7, 0xef, 0xf6, 0xbb, 0xc3,
-  0x19, 0x14, 0xe7, 0x58, 0x43, 0xa1, 0x3b, 0xbe, 0x0c, 0x01, 0x18, 0xee,
-  0x99, 0x1b, 0x9a, 0x01, 0xc0, 0x33, 0xbe, 0x40, 0xe7, 0x29, 0x0f, 0xc1,
-  0x07, 0x20, 0xba, 0xfe, 0x24, 0xf8, 0x4b, 0xd3, 0xe7, 0xdf, 0xe9, 0x02,
-  0xef, 0xd1, 0x0e, 0xa3, 0x22, 0xd1, 0x55, 0x5e, 0x7f, 0x19, 0x43, 0x2b,
-  0xd9, 0x03, 0x29, 0x9b, 0x59, 0x41, 0x34, 0x4e, 0x09, 0xf2, 0xcf, 0x55,
-  0x6e, 0x2d, 0x17, 0x05, 0x0d, 0xf0, 0x0a, 0xe1, 0x2e, 0x3f, 0x60, 0x42,
-  0x5c, 0xdc, 0xe1, 0xf4, 0x44, 0x68, 0x1f, 0x23, 0x2e, 0x4a, 0xd8, 0x1f,
-  0x33, 0x60, 0x23, 0xdf, 0x00, 0xec, 0x36, 0x49, 0x78, 0xd5, 0x07, 0xc3,
-  0xff, 0x07, 0xe6, 0xf0, 0xc4, 0x60, 0xfa, 0x1d, 0x1f, 0x32, 0x25, 0xa6,
-  0x43, 0xe2, 0xf9, 0xc5, 0x1d, 0xff, 0x25, 0x62, 0xd1, 0x5a, 0xf8, 0xda,
-  0xd5, 0x10, 0x3a, 0x31, 0xed, 0xec, 0x1b, 0x16, 0xab, 0x45, 0xf8, 0x35,
-  0x24, 0x89, 0x09, 0x93, 0xf1, 0x69, 0xc3, 0xf4, 0x23, 0xc2, 0x41, 0x33,
-  0xea, 0x04, 0x21, 0x58, 0x23, 0x18, 0xa0, 0xce, 0xec, 0x7f, 0x54, 0x2a,
-  0xcb, 0x7e, 0xec, 0xb3, 0x44, 0x22, 0xb7, 0x36, 0x2a, 0xfa, 0xa0, 0xc6,
-  0xe3, 0x0b, 0x0d, 0xdf, 0xd8, 0x0b, 0xf6, 0xe6, 0xde, 0xed, 0xe8, 0xbb,
-  0x17, 0x81, 0xfb, 0xbb, 0xe9, 0xd0, 0xad, 0x06, 0xa8, 0xe9, 0xff, 0x36,
-  0xf4, 0x17, 0x37, 0xe9, 0x1e, 0xf9, 0x37, 0x26, 0x12, 0x16, 0x9c, 0x66,
-  0xfb, 0xec, 0x25, 0xf4, 0x5e, 0xff, 0x0b, 0xdb, 0x01, 0x93, 0x23, 0x0e,
-  0x2d, 0xf2, 0xce, 0xfe, 0x06, 0x05, 0xf7, 0x1c, 0x3b, 0xc1, 0x09, 0xff,
-  0x3a, 0x2a, 0x01, 0xbe, 0xdb, 0x38, 0xc8, 0x1a, 0xe1, 0xdd, 0xb5, 0xfc,
-  0xe5, 0x17, 0xe5, 0xd7, 0xb7, 0xea, 0x2a, 0x3e, 0x0a, 0x29, 0x27, 0xbf,
-  0x3a, 0x0c, 0x12, 0xdb, 0xe2, 0xeb, 0xd3, 0x10, 0xde, 0xe5, 0xd4, 0xfe,
-  0x02, 0x0b, 0x99, 0xec, 0x4a, 0x26, 0xb7, 0xe0, 0x30, 0xae, 0x53, 0xd7,
-  0x11, 0x09, 0xb9, 0xb8, 0xce, 0x37, 0x35, 0x7f, 0x03, 0xdb, 0xed, 0x00,
-  0xdd, 0x23, 0xe1, 0x53, 0x22, 0xde, 0xdf, 0xe2, 0x59, 0xef, 0xef, 0xfd,
-  0x08, 0x35, 0x53, 0x35, 0x31, 0x39, 0x12, 0x0e, 0x04, 0xe3, 0x6b, 0xd2,
-  0x1c, 0x02, 0x14, 0xf2, 0x3c, 0x1f, 0xdb, 0x33, 0xf5, 0x42, 0xb0, 0x10,
-  0xfd, 0xbe, 0xe0, 0xb1, 0x23, 0xd6, 0xbd, 0xfb, 0xe9, 0x2f, 0x07, 0x29,
-  0xde, 0xce, 0xe3, 0xe6, 0x47, 0x12, 0xe3, 0xd1, 0x20, 0x01, 0xd6, 0xe7,
-  0xfb, 0x4c, 0xe4, 0xf2, 0xf8, 0x57, 0x72, 0x07, 0x11, 0xd4, 0xe3, 0xc6,
-  0xa4, 0xc5, 0x1c, 0xad, 0x13, 0xf5, 0xc3, 0xc5, 0xea, 0x35, 0xe7, 0x39,
-  0xe7, 0xa2, 0x4e, 0x5b, 0x82, 0xe4, 0xfd, 0xb1, 0x07, 0xed, 0xf9, 0x9a,
-  0x3d, 0xfd, 0x19, 0xaf, 0xcc, 0x97, 0xc8, 0x46, 0xba, 0x31, 0x30, 0x99,
-  0xf7, 0xdb, 0x0a, 0xd4, 0x15, 0xeb, 0x0f, 0xbe, 0xdf, 0xe1, 0x26, 0x76,
-  0xbb, 0xc4, 0x1c, 0xb2, 0xc2, 0x42, 0x12, 0x95, 0xba, 0xce, 0x77, 0xf6,
-  0xe4, 0x1c, 0x95, 0x10, 0x9a, 0xfa, 0xf4, 0x0c, 0x41, 0xa9, 0x3c, 0xf1,
-  0x50, 0xe8, 0xd2, 0xde, 0xef, 0xf7, 0x22, 0x09, 0x08, 0x4d, 0x56, 0x21,
-  0x08, 0xd2, 0x81, 0xe2, 0xe5, 0xa5, 0x86, 0x15, 0x65, 0xc2, 0xd3, 0x57,
-  0xf2, 0xe9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x84, 0x0b, 0x00, 0x00, 0x81, 0x10, 0x00, 0x00, 0x58, 0xf6, 0xff, 0xff,
-  0xdf, 0xee, 0xff, 0xff, 0x65, 0xdb, 0xff, 0xff, 0x64, 0x18, 0x00, 0x00,
-  0x1a, 0x2b, 0x00, 0x00, 0xea, 0x03, 0x00, 0x00, 0x28, 0x1a, 0x00, 0x00,
-  0x86, 0x0c, 0x00, 0x00, 0x52, 0xde, 0xff, 0xff, 0x9d, 0xeb, 0xff, 0xff,
-  0xd1, 0x9c, 0xff, 0xff, 0x7c, 0x31, 0x00, 0x00, 0x6d, 0xec, 0xff, 0xff,
-  0x10, 0x56, 0x00, 0x00, 0x3e, 0xea, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x06, 0x00, 0x00, 0xcc, 0x59, 0xc5, 0x1e, 0x25, 0xee, 0x78, 0x44,
-  0xa9, 0xf0, 0x45, 0x81, 0x64, 0x69, 0xbf, 0x2f, 0xe1, 0xfd, 0xc0, 0xe9,
-  0xe1, 0x2c, 0x22, 0x81, 0x11, 0xd8, 0xd8, 0xc0, 0xf8, 0xda, 0xcb, 0xf9,
-  0xdd, 0xe1, 0x24, 0x38, 0x1b, 0x3b, 0x93, 0x7f, 0xd6, 0x02, 0x69, 0xb1,
-  0xf8, 0xb3, 0xdb, 0x46, 0x63, 0xcc, 0x52, 0x02, 0x20, 0xf8, 0xf2, 0x7f,
-  0xea, 0x17, 0x3f, 0x28, 0x0b, 0x35, 0x4a, 0xfd, 0xd4, 0xdc, 0xf0, 0x31,
-  0xa3, 0x18, 0xea, 0x8e, 0xf4, 0x02, 0x25, 0xdf, 0x28, 0x2d, 0x6b, 0x7f,
-  0x7f, 0x24, 0xd1, 0xe8, 0xd1, 0x01, 0x20, 0x43, 0x1f, 0xed, 0x39, 0x4c,
-  0x5e, 0x32, 0xd1, 0x00, 0x0b, 0x01, 0xaa, 0xc8, 0xab, 0x02, 0x07, 0xaf,
-  0xcd, 0xe9, 0xd7, 0x09, 0x7f, 0x50, 0x7f, 0x11, 0xd2, 0x29, 0xf1, 0xc9,
-  0x0f, 0xc3, 0xac, 0x3f, 0xa7, 0x4e, 0xc1, 0xbe, 0x81, 0xf5, 0xfa, 0x59,
-  0x2a, 0x30, 0x37, 0x00, 0x4c, 0x0e, 0x42, 0x00, 0x43, 0xf4, 0x15, 0x05,
-  0x81, 0xef, 0xb9, 0x0d, 0xca, 0x44, 0x24, 0xa4, 0xef, 0xed, 0x22, 0xe7,
-  0xd0, 0x36, 0xd3, 0x14, 0x47, 0x7f, 0x13, 0x1f, 0x44, 0x09, 0xcd, 0x39,
-  0xcc, 0x03, 0x44, 0x01, 0x8f, 0xf1, 0xef, 0x81, 0x83, 0xb4, 0xf9, 0x67,
-  0x18, 0xe2, 0x18, 0xff, 0x0f, 0xdd, 0x1d, 0x7e, 0xa6, 0x12, 0x15, 0xe5,
-  0xe4, 0xf3, 0x54, 0x7f, 0xc8, 0xef, 0xfd, 0xf0, 0x08, 0xfa, 0x78, 0x2d,
-  0xc8, 0x20, 0xfc, 0xef, 0x00, 0x53, 0xd5, 0x7f, 0xeb, 0x10, 0x23, 0x03,
-  0x5e, 0x34, 0x7f, 0x6b, 0xbe, 0x42, 0xd1, 0xc2, 0x21, 0x4b, 0xa6, 0xe0,
-  0xc5, 0x7f, 0xf4, 0x14, 0x1c, 0xf5, 0x24, 0x2f, 0xfc, 0x15, 0x5c, 0x0f,
-  0xcc, 0x17, 0xe2, 0x2c, 0xfb, 0x06, 0x81, 0xe3, 0x41, 0xeb, 0xb5, 0xea,
-  0xf4, 0xef, 0xf5, 0xce, 0x05, 0xb4, 0xe5, 0x14, 0x5f, 0xd8, 0xfa, 0xfb,
-  0x1f, 0xd2, 0x1f, 0xd6, 0xdc, 0x24, 0x7f, 0x57, 0x15, 0xf2, 0xd0, 0x03,
-  0xfa, 0x08, 0xec, 0x9e, 0xf6, 0xde, 0x71, 0x81, 0xfe, 0xf9, 0xeb, 0x1d,
-  0x1f, 0x34, 0x02, 0x2b, 0x30, 0x75, 0xf0, 0x06, 0x38, 0xbc, 0xf4, 0xe5,
-  0xd5, 0x7f, 0xc9, 0x10, 0x21, 0xfd, 0xf3, 0xe6, 0xd0, 0xa4, 0x6d, 0x94,
-  0x38, 0x81, 0x29, 0xbc, 0x2f, 0x1c, 0x63, 0x59, 0x11, 0x00, 0x4f, 0xdb,
-  0xf1, 0x61, 0x3b, 0xfe, 0x0d, 0x05, 0x0a, 0xd5, 0x2f, 0x11, 0x64, 0xd4,
-  0x81, 0xfe, 0xb2, 0xfe, 0xbd, 0x0b, 0x06, 0xf1, 0x4d, 0x27, 0x4d, 0xf3,
-  0x81, 0x14, 0xb5, 0x24, 0xe2, 0x03, 0xc0, 0xc8, 0x0a, 0x9f, 0x1c, 0x16,
-  0x0e, 0x83, 0x7f, 0x21, 0xf6, 0xcb, 0xf7, 0xc8, 0x1e, 0xae, 0xbe, 0xd9,
-  0xce, 0x8f, 0x17, 0x55, 0x1c, 0xf1, 0x25, 0xcd, 0xf8, 0xe8, 0x70, 0x0d,
-  0x11, 0x3d, 0x5f, 0x7f, 0x14, 0x0c, 0x16, 0x5e, 0x3c, 0x0e, 0xd1, 0x81,
-  0x54, 0x07, 0xd8, 0x0f, 0x0a, 0xec, 0xec, 0xdf, 0xf2, 0x22, 0x18, 0xca,
-  0xe7, 0xef, 0x0b, 0xdb, 0xdc, 0x2c, 0xcc, 0xf8, 0x30, 0x7f, 0x00, 0x15,
-  0xc9, 0x39, 0xfb, 0x0f, 0x18, 0xb6, 0xfb, 0xed, 0x0a, 0x30, 0x1b, 0x43,
-  0xfa, 0x15, 0xad, 0x7f, 0xe1, 0x81, 0xc5, 0xfd, 0xb6, 0x4f, 0x01, 0xc9,
-  0x02, 0xdf, 0x2e, 0xdd, 0x1f, 0xd2, 0xa0, 0xf1, 0xd7, 0xf3, 0x45, 0x60,
-  0x26, 0x1f, 0xd2, 0x81, 0x88, 0x32, 0x4e, 0xff, 0x35, 0x0c, 0xe5, 0xc7,
-  0x81, 0x6b, 0xd6, 0xe2, 0xee, 0x10, 0x83, 0xb7, 0xd3, 0xdd, 0xfe, 0x00,
-  0x1a, 0xd9, 0x8d, 0x3c, 0x61, 0x6c, 0xba, 0x68, 0xb7, 0x81, 0x9f, 0xd9,
-  0xff, 0xfa, 0xf3, 0x96, 0x62, 0x21, 0x03, 0x5d, 0x7f, 0x27, 0xbf, 0xee,
-  0xe2, 0x2c, 0x49, 0x25, 0xe0, 0xf1, 0x2a, 0x52, 0x0a, 0x18, 0x00, 0xfa,
-  0xd8, 0xf4, 0x7f, 0xf7, 0xe7, 0x4f, 0x5f, 0x07, 0xe6, 0xf6, 0xe9, 0x19,
-  0x1e, 0x40, 0x46, 0x35, 0x02, 0x28, 0xc6, 0xae, 0xe2, 0x1a, 0x7f, 0x11,
-  0xf6, 0xeb, 0x1a, 0xd0, 0x69, 0x57, 0xcf, 0x46, 0xa9, 0xd6, 0x4c, 0x00,
-  0x06, 0xca, 0x5b, 0xf5, 0x81, 0x10, 0x34, 0xc7, 0x3a, 0x1f, 0xcc, 0xe1,
-  0xf1, 0x11, 0xd2, 0x1d, 0xac, 0x7f, 0xd7, 0xf3, 0xdf, 0x75, 0xfe, 0x58,
-  0xc3, 0x4c, 0xf6, 0x28, 0xfe, 0x9f, 0x7f, 0xe2, 0xdf, 0x22, 0xc5, 0xdf,
-  0x23, 0x15, 0xb7, 0x72, 0xff, 0x92, 0xd2, 0x3a, 0x58, 0xfd, 0x5c, 0xe0,
-  0x7f, 0xc4, 0xf2, 0x11, 0xe4, 0x57, 0xb2, 0x14, 0xc8, 0xba, 0x6a, 0x00,
-  0x53, 0x4e, 0x11, 0x92, 0x08, 0x9b, 0x81, 0x2f, 0xbb, 0x33, 0xa7, 0xd1,
-  0xc5, 0xa0, 0xa8, 0x5b, 0xb3, 0x12, 0xc2, 0xfd, 0xac, 0xc4, 0x4b, 0x14,
-  0x81, 0xef, 0x41, 0x40, 0x32, 0xf4, 0xe4, 0x21, 0x77, 0x29, 0xb0, 0x81,
-  0x90, 0xfe, 0x24, 0xef, 0xcf, 0xb0, 0xed, 0x8a, 0x0a, 0x2a, 0x3a, 0x1e,
-  0x5c, 0x92, 0xbd, 0xb9, 0xe4, 0x29, 0xce, 0xb2, 0x7e, 0x23, 0xdb, 0xa2,
-  0x7f, 0x9d, 0x5e, 0xc8, 0xf0, 0xac, 0xd0, 0x75, 0x1f, 0x99, 0x81, 0x23,
-  0xfc, 0x1a, 0x1a, 0x23, 0x94, 0x3e, 0xb6, 0xf6, 0xb1, 0xd8, 0xc6, 0x9e,
-  0xcf, 0x01, 0x03, 0x4e, 0x20, 0x81, 0xd6, 0x17, 0xec, 0xd7, 0xd2, 0x67,
-  0xd5, 0x10, 0xff, 0x9c, 0xd6, 0xea, 0x30, 0x7b, 0x7f, 0xd0, 0x39, 0x69,
-  0x61, 0x2e, 0x0e, 0xfa, 0x31, 0x3a, 0xab, 0x4e, 0x5b, 0xbd, 0xe5, 0xd7,
-  0x7f, 0x98, 0x1e, 0xe1, 0xfe, 0xfb, 0xc7, 0x23, 0xe1, 0xcb, 0x06, 0x04,
-  0x53, 0xe0, 0x14, 0x2c, 0xd7, 0x62, 0xf7, 0x81, 0x0e, 0x4e, 0xcf, 0x48,
-  0x37, 0xb5, 0xeb, 0x01, 0x42, 0xf5, 0xcd, 0xdf, 0x01, 0x7f, 0xe8, 0x34,
-  0xbc, 0xb6, 0xa4, 0x2a, 0x00, 0xf0, 0xe4, 0xae, 0xde, 0xf9, 0x49, 0x81,
-  0x0d, 0x05, 0xc5, 0x02, 0x3e, 0x0c, 0xfa, 0x02, 0xf2, 0x6c, 0xbc, 0x4a,
-  0x56, 0xe5, 0x2e, 0x2f, 0xed, 0x13, 0xf7, 0xe9, 0xea, 0x05, 0x7f, 0x81,
-  0x1b, 0x3a, 0xe7, 0x1b, 0x81, 0x01, 0xb8, 0xd4, 0x52, 0x50, 0x18, 0x14,
-  0xe4, 0xea, 0x1d, 0x26, 0x7f, 0xd3, 0xc3, 0x11, 0xc7, 0x44, 0x9f, 0xe6,
-  0x24, 0xf6, 0xec, 0x3b, 0xec, 0xcb, 0xfa, 0x0e, 0xe8, 0xbc, 0x27, 0x4b,
-  0xb9, 0xa3, 0x81, 0xf7, 0xec, 0xc1, 0xcd, 0xc8, 0xfa, 0xcf, 0x05, 0x3b,
-  0x12, 0x4b, 0x2e, 0x81, 0xfe, 0x79, 0x5d, 0xdd, 0xd9, 0x0a, 0xf4, 0xe6,
-  0x67, 0xb9, 0x07, 0x49, 0x44, 0x74, 0x07, 0x02, 0x04, 0x86, 0xab, 0x40,
-  0xf7, 0xd0, 0xc9, 0x7f, 0x4f, 0x4f, 0x07, 0x25, 0xee, 0x24, 0x36, 0x4e,
-  0x3b, 0xe8, 0x65, 0x7f, 0xcc, 0x01, 0x0c, 0x17, 0x55, 0x20, 0x1f, 0xfb,
-  0x63, 0x30, 0x1f, 0xf6, 0xe5, 0x7f, 0xc9, 0xb7, 0xe6, 0x4d, 0x96, 0x19,
-  0xb6, 0x76, 0xe3, 0x3b, 0xdc, 0xf4, 0xcd, 0xdd, 0xc5, 0xa2, 0x29, 0x00,
-  0x81, 0xed, 0x51, 0x26, 0x24, 0x1d, 0xf1, 0x2f, 0x47, 0xe0, 0x4f, 0x29,
-  0x13, 0x9c, 0xdf, 0x07, 0x11, 0xcc, 0x81, 0xde, 0x25, 0xfc, 0xdf, 0x23,
-  0x42, 0x00, 0x82, 0x44, 0xfb, 0x19, 0x6b, 0xf6, 0xc8, 0x9f, 0x13, 0x8c,
-  0x81, 0xbd, 0x3c, 0x64, 0xfe, 0x0b, 0xe7, 0x0c, 0xce, 0xee, 0xed, 0x06,
-  0xd2, 0xcb, 0x42, 0x7f, 0xe9, 0x90, 0xdd, 0x12, 0xda, 0x04, 0x44, 0xbe,
-  0xbf, 0x1b, 0x05, 0x7f, 0xeb, 0x95, 0x36, 0x18, 0x4e, 0xf4, 0x04, 0x65,
-  0x3a, 0x1a, 0xf3, 0x81, 0xea, 0x25, 0x16, 0xef, 0xe9, 0x37, 0xda, 0x2d,
-  0x23, 0xfc, 0xa5, 0xc8, 0xfa, 0xcc, 0xec, 0xf6, 0xab, 0xa7, 0xd8, 0x0f,
-  0x99, 0xec, 0xe1, 0xec, 0x7f, 0xf1, 0x2d, 0x0c, 0x26, 0xfd, 0xee, 0x59,
-  0xab, 0xbe, 0xe8, 0xcb, 0x2a, 0x7f, 0x1c, 0xfc, 0x17, 0xf5, 0xa9, 0x72,
-  0xde, 0x0e, 0xe3, 0x01, 0xa1, 0x4a, 0x1e, 0xea, 0x1a, 0xa1, 0x68, 0xa6,
-  0x68, 0x36, 0x81, 0x36, 0x9c, 0x64, 0x9d, 0xba, 0x36, 0xe9, 0x9c, 0xd7,
-  0xb0, 0x51, 0x40, 0x20, 0x81, 0xcc, 0x3e, 0x10, 0x03, 0xea, 0x81, 0x9f,
-  0x4b, 0x3f, 0x06, 0xf3, 0xe5, 0x0e, 0x4d, 0xfa, 0x09, 0x28, 0x12, 0x31,
-  0x47, 0x21, 0xe7, 0xdf, 0xd4, 0x0f, 0x00, 0x23, 0xd7, 0x41, 0x7f, 0xeb,
-  0xfa, 0xce, 0xac, 0xed, 0x3c, 0x9f, 0x25, 0xec, 0x0c, 0xad, 0xce, 0x7f,
-  0xd5, 0x4e, 0x69, 0x10, 0xf2, 0x58, 0xd7, 0xf1, 0x3f, 0x3e, 0x59, 0x27,
-  0x69, 0xd3, 0x77, 0x09, 0x4d, 0x1d, 0xa7, 0x05, 0x9c, 0x7f, 0xb4, 0x0a,
-  0x03, 0x15, 0x5a, 0xaa, 0x81, 0xa0, 0x17, 0x0d, 0xf0, 0xe7, 0x0f, 0xb1,
-  0xa3, 0xf8, 0x12, 0x19, 0xb8, 0x92, 0x04, 0x8a, 0x30, 0xf2, 0x0f, 0x24,
-  0xbd, 0x11, 0x81, 0xe2, 0x35, 0x70, 0xb9, 0x70, 0x0c, 0xfc, 0x12, 0xf0,
-  0x5d, 0xc0, 0xcc, 0x0f, 0x05, 0x65, 0xb7, 0x1e, 0x81, 0x07, 0x40, 0x0c,
-  0x81, 0xee, 0x82, 0xb1, 0x31, 0xd7, 0xdf, 0x11, 0x9f, 0x13, 0x87, 0xdd,
-  0xe7, 0xd0, 0xc0, 0x67, 0x5c, 0xe2, 0x31, 0xc5, 0x1b, 0x00, 0x81, 0xe1,
-  0xf8, 0x8d, 0x37, 0x11, 0xf3, 0xee, 0xf8, 0xfb, 0x0a, 0xee, 0x03, 0x46,
-  0x33, 0x2f, 0x1a, 0xf3, 0x26, 0x81, 0x21, 0x34, 0x15, 0xe3, 0xe2, 0xee,
-  0xe5, 0xf1, 0x66, 0xea, 0x19, 0xef, 0x06, 0x81, 0x21, 0x13, 0x27, 0x5c,
-  0x2d, 0x36, 0x07, 0x13, 0xe0, 0xfe, 0xf8, 0xea, 0xe4, 0xc8, 0x09, 0x11,
-  0xec, 0xdd, 0x1a, 0xa5, 0xb6, 0xde, 0x81, 0xc6, 0xaa, 0xb8, 0xd2, 0x45,
-  0x69, 0x0f, 0xc2, 0x07, 0x31, 0x68, 0xc1, 0x7f, 0xb6, 0xa2, 0xa4, 0xfc,
-  0xf4, 0x8b, 0x2d, 0x7f, 0xcb, 0xe0, 0x92, 0x62, 0xda, 0x35, 0x6c, 0xef,
-  0xa7, 0x10, 0xde, 0x5e, 0x7f, 0x33, 0xa9, 0x29, 0x09, 0x32, 0x04, 0x77,
-  0x71, 0xfd, 0x65, 0x79, 0x73, 0x19, 0x50, 0xe9, 0xd1, 0x24, 0x2e, 0xdb,
-  0x26, 0x8a, 0x90, 0xbd, 0x23, 0x4f, 0xe5, 0xd7, 0xd2, 0x7f, 0xcd, 0xe2,
-  0x5d, 0xb2, 0x7f, 0xfa, 0xd2, 0x2b, 0xa5, 0x15, 0x24, 0x9b, 0xec, 0xf0,
-  0xf4, 0xe1, 0x14, 0xef, 0x0d, 0xcd, 0xb5, 0x02, 0x7f, 0x0d, 0x14, 0x0d,
-  0xa6, 0x06, 0xa0, 0xf2, 0x2c, 0xf0, 0xa0, 0x13, 0xff, 0x7f, 0x24, 0xd9,
-  0x61, 0x0a, 0x42, 0xa4, 0x66, 0xd4, 0x71, 0xe8, 0x7e, 0xd6, 0x31, 0x13,
-  0x71, 0xf2, 0x7f, 0x38, 0xfc, 0xd7, 0x3d, 0x35, 0xce, 0xd0, 0x95, 0xd9,
-  0x1d, 0x11, 0xc6, 0x0a, 0xff, 0x2c, 0x12, 0xb2, 0x3d, 0x13, 0xe8, 0x24,
-  0x1c, 0xde, 0x58, 0xcd, 0xce, 0x81, 0x01, 0x07, 0xcb, 0xe7, 0x0e, 0xf4,
-  0x02, 0x0c, 0xcd, 0xcc, 0xfc, 0x04, 0xc7, 0x81, 0xe2, 0xe5, 0xf6, 0xf2,
-  0xa2, 0x1f, 0x17, 0xda, 0x28, 0x1f, 0x81, 0x18, 0x71, 0x36, 0xca, 0xfb,
-  0x06, 0xa4, 0xed, 0xd9, 0xf9, 0xfc, 0xf8, 0xbf, 0x7f, 0x27, 0xb4, 0x1b,
-  0x2d, 0x4d, 0xe8, 0x04, 0x32, 0x1b, 0x98, 0xf0, 0xe3, 0xda, 0x21, 0x3a,
-  0xe1, 0x0b, 0xe9, 0x69, 0xba, 0xe0, 0x2a, 0xc8, 0x04, 0x37, 0xff, 0x7f,
-  0xd6, 0x51, 0x2d, 0xfe, 0xf6, 0x2f, 0xa1, 0x56, 0xd3, 0x12, 0x64, 0xfe,
-  0xbc, 0x7f, 0x19, 0x33, 0x00, 0x44, 0xc8, 0xa2, 0x6c, 0x6d, 0x81, 0x08,
-  0x45, 0x0e, 0x3e, 0x4b, 0xbc, 0xf7, 0xed, 0x34, 0x1e, 0x49, 0x7f, 0x0d,
-  0x97, 0xf8, 0x0e, 0x01, 0x12, 0xe3, 0x1d, 0x0b, 0xb9, 0xdf, 0x17, 0xce,
-  0xf5, 0x08, 0x45, 0x05, 0x7f, 0xbe, 0x87, 0x44, 0xf1, 0xfc, 0x86, 0x35,
-  0x1d, 0x25, 0x2e, 0x95, 0x4a, 0xf0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x80, 0x01, 0x00, 0x00, 0xe5, 0x03, 0x00, 0x00, 0xe3, 0xff, 0xff, 0xff,
-  0xff, 0x0e, 0x00, 0x00, 0x83, 0x0f, 0x00, 0x00, 0x7c, 0x10, 0x00, 0x00,
-  0x4b, 0xf8, 0xff, 0xff, 0x98, 0x0c, 0x00, 0x00, 0xa6, 0xfa, 0xff, 0xff,
-  0xa3, 0xf9, 0xff, 0xff, 0x82, 0xfc, 0xff, 0xff, 0xd2, 0x0e, 0x00, 0x00,
-  0x68, 0xf9, 0xff, 0xff, 0x99, 0x0e, 0x00, 0x00, 0xb9, 0x16, 0x00, 0x00,
-  0x46, 0x04, 0x00, 0x00, 0xa1, 0x07, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
-  0xfe, 0xfe, 0xff, 0xff, 0x56, 0xfc, 0xff, 0xff, 0x01, 0x11, 0x00, 0x00,
-  0x21, 0x08, 0x00, 0x00, 0xbf, 0xfc, 0xff, 0xff, 0xb3, 0x07, 0x00, 0x00,
-  0x11, 0xfe, 0xff, 0xff, 0x95, 0xfa, 0xff, 0xff, 0xa0, 0x0b, 0x00, 0x00,
-  0xea, 0x02, 0x00, 0x00, 0xc2, 0x06, 0x00, 0x00, 0x18, 0x1d, 0x00, 0x00,
-  0x04, 0x07, 0x00, 0x00, 0x4a, 0x0e, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00,
-  0x59, 0x06, 0x00, 0x00, 0x7a, 0x0d, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00,
-  0x52, 0x0c, 0x00, 0x00, 0xb5, 0xfc, 0xff, 0xff, 0x55, 0x08, 0x00, 0x00,
-  0x85, 0x06, 0x00, 0x00, 0x5a, 0xf5, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff,
-  0x44, 0x0a, 0x00, 0x00, 0xc5, 0xfc, 0xff, 0xff, 0x42, 0x05, 0x00, 0x00,
-  0x12, 0xfe, 0xff, 0xff, 0xc1, 0x02, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0xff,
-  0xa7, 0xff, 0xff, 0xff, 0xd8, 0xef, 0xff, 0xff, 0xfd, 0x06, 0x00, 0x00,
-  0xd7, 0x03, 0x00, 0x00, 0x56, 0xf5, 0xff, 0xff, 0xd6, 0x12, 0x00, 0x00,
-  0x35, 0xfd, 0xff, 0xff, 0x44, 0x0b, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00,
-  0x58, 0x04, 0x00, 0x00, 0xdb, 0x08, 0x00, 0x00, 0x18, 0xfd, 0xff, 0xff,
-  0x78, 0xf8, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0xce, 0x04, 0x00, 0x00,
-  0xe0, 0x01, 0x00, 0x00, 0x7e, 0x11, 0x00, 0x00, 0xf4, 0x0e, 0x00, 0x00,
-  0x33, 0x07, 0x00, 0x00, 0xfb, 0x0b, 0x00, 0x00, 0x28, 0x11, 0x00, 0x00,
-  0xb4, 0x0e, 0x00, 0x00, 0x0e, 0xfd, 0xff, 0xff, 0x49, 0x0d, 0x00, 0x00,
-  0xcf, 0x15, 0x00, 0x00, 0x4f, 0x0d, 0x00, 0x00, 0x8b, 0xfc, 0xff, 0xff,
-  0x65, 0x13, 0x00, 0x00, 0xca, 0x25, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00,
-  0x29, 0xf7, 0xff, 0xff, 0x02, 0x02, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00,
-  0x35, 0x24, 0x00, 0x00, 0xe5, 0x08, 0x00, 0x00, 0x86, 0xfd, 0xff, 0xff,
-  0x19, 0xfc, 0xff, 0xff, 0x55, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
-  0x1c, 0x07, 0x00, 0x00, 0x10, 0xfb, 0xff, 0xff, 0x20, 0x0a, 0x00, 0x00,
-  0xd1, 0xfe, 0xff, 0xff, 0x81, 0x0c, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00,
-  0x72, 0x00, 0x00, 0x00, 0x1c, 0xf5, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00,
-  0xeb, 0x08, 0x00, 0x00, 0xd6, 0xf1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x0c, 0x00, 0x00, 0xf1, 0xc6, 0x52, 0x02, 0x55, 0xea, 0xc4, 0xbb,
-  0x30, 0xc5, 0xb7, 0x07, 0x37, 0x19, 0xef, 0x35, 0xe0, 0xe8, 0xe0, 0xdf,
-  0xd5, 0xb2, 0xfa, 0x55, 0xc7, 0x1d, 0x50, 0xdf, 0x67, 0x09, 0xf7, 0xcc,
-  0x56, 0xdd, 0xc9, 0x40, 0xaa, 0xd2, 0xd6, 0x13, 0x38, 0xa6, 0xc4, 0x4c,
-  0x16, 0xbb, 0x56, 0x0b, 0xb1, 0xd9, 0xf4, 0x66, 0xdb, 0xd2, 0xc5, 0x65,
-  0x21, 0x40, 0x73, 0xb4, 0xce, 0x5a, 0xef, 0x3f, 0x0a, 0x16, 0x4a, 0x4b,
-  0x3a, 0x37, 0x55, 0xb2, 0x5a, 0xe0, 0x29, 0x55, 0x9c, 0x1f, 0xd0, 0x25,
-  0x35, 0x03, 0x7f, 0xd7, 0xd1, 0xd4, 0xc3, 0x36, 0x1c, 0x4e, 0x02, 0xb6,
-  0x05, 0x1c, 0xf6, 0x0f, 0xd9, 0x19, 0xbb, 0xdc, 0xf2, 0x4b, 0x34, 0xfb,
-  0x38, 0xbb, 0xb5, 0x23, 0x3c, 0xf4, 0x08, 0x33, 0x5d, 0xea, 0x16, 0x6c,
-  0xd7, 0x0b, 0x30, 0x1f, 0x21, 0x1b, 0xe0, 0x5a, 0x0e, 0x15, 0x73, 0xca,
-  0x2e, 0x68, 0xfe, 0x1c, 0x38, 0x42, 0xf1, 0xcc, 0xf3, 0x07, 0xfc, 0xbc,
-  0xe6, 0x19, 0xd4, 0xe0, 0xc3, 0x8a, 0x7f, 0x23, 0x16, 0x50, 0xc6, 0xc7,
-  0x1c, 0x5b, 0x1b, 0x51, 0xd8, 0x55, 0xd7, 0xc8, 0xda, 0x2c, 0x35, 0x2f,
-  0x54, 0x0c, 0x14, 0x17, 0xab, 0x44, 0xe6, 0x2c, 0x54, 0xd0, 0xe9, 0x53,
-  0xc9, 0x44, 0xc7, 0xb1, 0x2f, 0x6c, 0xd9, 0xa2, 0x4b, 0x55, 0x5a, 0x12,
-  0x3c, 0x5d, 0x2b, 0x17, 0x20, 0x06, 0xc9, 0x2d, 0xee, 0xcc, 0x2f, 0x3f,
-  0x81, 0x3c, 0xe4, 0x57, 0x34, 0xf1, 0x2d, 0xb9, 0xe1, 0xf3, 0x15, 0x1b,
-  0xb3, 0xf8, 0x39, 0x0f, 0xf5, 0x2e, 0x45, 0xf1, 0xce, 0x27, 0x30, 0x34,
-  0xc9, 0xef, 0xc0, 0xb6, 0xb3, 0x39, 0x38, 0xf4, 0xab, 0xd5, 0xf6, 0xef,
-  0xca, 0x44, 0xff, 0xbe, 0x2f, 0x03, 0x2f, 0xc4, 0xdb, 0x0a, 0x09, 0x05,
-  0xca, 0x38, 0xdd, 0xfa, 0xe3, 0x0e, 0xc7, 0x22, 0x37, 0x0f, 0x18, 0x2f,
-  0xba, 0x1b, 0x05, 0xc9, 0x11, 0xd6, 0x0f, 0x04, 0xd6, 0xee, 0xf2, 0xf8,
-  0x0d, 0xba, 0x00, 0xd9, 0xfe, 0xb9, 0xee, 0xe6, 0x28, 0x3c, 0xe6, 0xfd,
-  0xd7, 0xb1, 0xce, 0xe5, 0x45, 0x09, 0x2e, 0xd6, 0xdf, 0x1e, 0xc1, 0x2a,
-  0x12, 0x1c, 0x3b, 0xeb, 0x52, 0x52, 0x32, 0x09, 0x68, 0x5d, 0xe0, 0x17,
-  0x4d, 0xcc, 0xe2, 0xc4, 0xdb, 0xbc, 0xc4, 0x65, 0x2e, 0xce, 0x46, 0xf4,
-  0xe2, 0xfa, 0x05, 0xfb, 0xd0, 0xe6, 0x30, 0x40, 0x14, 0xab, 0xda, 0x0d,
-  0x1c, 0xff, 0xdf, 0xda, 0x2f, 0xb7, 0x35, 0xdc, 0x51, 0x2b, 0x39, 0xbd,
-  0xb0, 0xc4, 0x81, 0xf4, 0xc4, 0x27, 0xfc, 0x4c, 0x2e, 0xfd, 0xd3, 0xf5,
-  0xf8, 0xf5, 0xfe, 0x5b, 0x21, 0xb0, 0x38, 0xd9, 0x0f, 0x5f, 0x5a, 0xe3,
-  0xcb, 0x95, 0x29, 0x42, 0x2b, 0x39, 0xe8, 0x83, 0xcd, 0x35, 0x12, 0xcd,
-  0x4e, 0xc1, 0xc6, 0x21, 0x31, 0x6c, 0x0c, 0x1f, 0xf6, 0xea, 0x30, 0x28,
-  0x32, 0x5b, 0x06, 0x0c, 0x22, 0xe2, 0xe8, 0xd6, 0x00, 0x13, 0xe0, 0x25,
-  0x4f, 0xc3, 0x6d, 0x27, 0xd6, 0x0b, 0x36, 0xdc, 0xd9, 0x38, 0xd4, 0xc4,
-  0x3f, 0x75, 0x18, 0xa0, 0xf2, 0x24, 0xc0, 0x45, 0x02, 0xcc, 0xd8, 0xcb,
-  0x05, 0x41, 0x27, 0x54, 0x29, 0xbf, 0x0d, 0xac, 0xc3, 0x49, 0xb3, 0x02,
-  0x25, 0xc4, 0xed, 0x1d, 0x16, 0xc4, 0xff, 0xdd, 0xd8, 0x42, 0xfe, 0xed,
-  0x24, 0xe0, 0xa2, 0xcd, 0xe4, 0x44, 0x6f, 0x2d, 0x3c, 0x09, 0x13, 0xdd,
-  0x09, 0xc8, 0xcc, 0xfe, 0x1d, 0x53, 0x50, 0xe9, 0xa8, 0xe1, 0x40, 0x31,
-  0x24, 0x7f, 0xc2, 0x23, 0x3f, 0xc2, 0x32, 0x2b, 0x1f, 0xb2, 0x10, 0x24,
-  0x43, 0xc8, 0x07, 0xdf, 0x16, 0x41, 0x1f, 0x1a, 0x2a, 0x21, 0xd9, 0x3d,
-  0x1d, 0x1b, 0x06, 0xf6, 0xcc, 0xe9, 0x03, 0xd3, 0x26, 0x16, 0x09, 0xcd,
-  0xfa, 0x09, 0xe4, 0x14, 0xbd, 0xec, 0x27, 0x0d, 0xcb, 0xc9, 0x21, 0x38,
-  0xde, 0x0b, 0x18, 0xf0, 0x81, 0x40, 0x16, 0x14, 0x20, 0x02, 0x12, 0x00,
-  0x42, 0x26, 0xdf, 0xfb, 0x18, 0xed, 0x1c, 0xe7, 0xf6, 0x41, 0xff, 0x14,
-  0x38, 0xf9, 0x44, 0xe2, 0xef, 0x3b, 0xf7, 0xe1, 0xf4, 0xf7, 0x0b, 0x36,
-  0x46, 0x0f, 0x34, 0x19, 0xce, 0x1b, 0xf8, 0x10, 0x2b, 0xbf, 0x46, 0x3c,
-  0xf5, 0xff, 0x19, 0xc8, 0xe1, 0xd0, 0x49, 0x47, 0xca, 0xec, 0xfe, 0xfa,
-  0xb6, 0xc3, 0xec, 0x81, 0x30, 0x3a, 0x3d, 0xd2, 0x0c, 0xe2, 0xfd, 0x61,
-  0xda, 0xcb, 0x4e, 0xfd, 0xc2, 0xd6, 0xe5, 0xf3, 0x0d, 0xc3, 0x0d, 0xc8,
-  0xec, 0xb6, 0xf8, 0xdb, 0x02, 0x2b, 0xb5, 0x03, 0x04, 0x4d, 0xfc, 0xfa,
-  0xef, 0x41, 0xa1, 0xe7, 0xcc, 0x24, 0xda, 0xf5, 0x26, 0x2f, 0x31, 0xe9,
-  0xfe, 0xe5, 0x00, 0xf9, 0xda, 0x02, 0x40, 0xde, 0xdb, 0x09, 0x4c, 0x0f,
-  0x37, 0xf9, 0xd3, 0x04, 0x1b, 0xbe, 0xd3, 0x19, 0x01, 0xc6, 0xd7, 0xfe,
-  0x1c, 0x01, 0xf3, 0x2c, 0xcd, 0xfb, 0xfc, 0xdc, 0x49, 0x49, 0x5a, 0xed,
-  0xeb, 0x09, 0x2a, 0xf7, 0x76, 0x42, 0xdf, 0xb0, 0xce, 0x69, 0xfe, 0x02,
-  0x71, 0x13, 0xb1, 0xe0, 0x3f, 0xbb, 0x23, 0x45, 0x3c, 0x1f, 0xf6, 0x78,
-  0x31, 0x34, 0x10, 0x5f, 0xb8, 0x6d, 0x27, 0x3f, 0xbd, 0x78, 0x00, 0x1c,
-  0x1c, 0x2b, 0x48, 0x61, 0xac, 0x59, 0xfd, 0xf3, 0x7f, 0xa9, 0x5e, 0x50,
-  0x1d, 0xec, 0x5a, 0xa5, 0x0d, 0xa8, 0xb5, 0x9c, 0xf2, 0x65, 0x04, 0x0f,
-  0x75, 0xbe, 0xd8, 0xe1, 0x0f, 0xfe, 0x5b, 0xa3, 0xc3, 0xe0, 0x3c, 0x21,
-  0xa1, 0x15, 0x42, 0x60, 0x5d, 0x19, 0x46, 0x35, 0xca, 0x3c, 0xb6, 0x3e,
-  0x5d, 0xcd, 0xf9, 0xa8, 0x66, 0x2f, 0x9e, 0x2d, 0x58, 0x11, 0x61, 0x42,
-  0xc9, 0xee, 0x0b, 0xcb, 0x14, 0x15, 0xea, 0xab, 0x3f, 0x04, 0xc7, 0xfb,
-  0x1b, 0x28, 0x2d, 0x41, 0x0f, 0xe9, 0xc1, 0xcb, 0xd8, 0x5a, 0xc6, 0x1c,
-  0x20, 0xf2, 0x4c, 0x6c, 0xa7, 0x58, 0x2c, 0x49, 0xd3, 0x1e, 0xb9, 0x5a,
-  0x5a, 0xf2, 0x33, 0x08, 0x6f, 0x12, 0x02, 0x49, 0x51, 0x37, 0xc3, 0xab,
-  0xdb, 0xdd, 0xf6, 0x76, 0xe4, 0xb5, 0xea, 0xfd, 0xd8, 0x09, 0xdc, 0xb0,
-  0x30, 0x69, 0x92, 0x6a, 0x68, 0x36, 0x36, 0x69, 0xee, 0xec, 0xf8, 0x57,
-  0xcc, 0x36, 0x24, 0x0c, 0x4d, 0x6b, 0x12, 0x10, 0xd2, 0x7f, 0x56, 0x54,
-  0x2b, 0x37, 0xd4, 0x85, 0x1b, 0x24, 0x31, 0xca, 0x27, 0xea, 0xcc, 0x60,
-  0xc2, 0xb3, 0xd9, 0x35, 0xf2, 0x00, 0x36, 0x16, 0x27, 0xd2, 0xf7, 0xba,
-  0x1a, 0x14, 0xe2, 0x07, 0xea, 0xce, 0xce, 0xeb, 0xe6, 0x08, 0xad, 0xe9,
-  0x0f, 0x32, 0xc4, 0xc0, 0x27, 0xf4, 0xe9, 0x0d, 0xea, 0xf1, 0xcd, 0x3f,
-  0x1b, 0x09, 0xfa, 0xf8, 0xd7, 0x05, 0xd0, 0xd0, 0x37, 0xfb, 0x1b, 0xfb,
-  0x5a, 0x26, 0xaa, 0x12, 0x27, 0x0a, 0xda, 0xd6, 0x1b, 0xfa, 0xd7, 0x2d,
-  0x1f, 0xc8, 0xda, 0xe9, 0xef, 0x46, 0x1a, 0xba, 0xbb, 0x0b, 0x3d, 0x2b,
-  0xdb, 0x1c, 0x29, 0xd4, 0xf7, 0x1d, 0xcb, 0xdf, 0xf4, 0x81, 0xe8, 0x55,
-  0x0c, 0x1b, 0x2a, 0x36, 0xed, 0x02, 0xea, 0x0e, 0x32, 0x30, 0x04, 0x27,
-  0x41, 0x1e, 0x3e, 0xef, 0xcf, 0x4b, 0x5b, 0x97, 0x06, 0x5f, 0x7a, 0x1b,
-  0x28, 0x2f, 0x23, 0x87, 0x6d, 0x60, 0xd8, 0x0c, 0xe8, 0x5d, 0x9a, 0xd4,
-  0xef, 0x2f, 0x49, 0xce, 0x27, 0x45, 0x92, 0x9a, 0xdb, 0x62, 0xbb, 0xaa,
-  0x58, 0x77, 0x7f, 0x51, 0xec, 0x1d, 0xe6, 0x2a, 0x03, 0x62, 0xb1, 0xea,
-  0x8d, 0xb5, 0xf3, 0xdd, 0xc3, 0xde, 0x4d, 0xf9, 0x4b, 0x22, 0xbc, 0xd2,
-  0xa9, 0x03, 0xf6, 0xeb, 0x07, 0x51, 0x7e, 0x37, 0x7c, 0xcb, 0xa1, 0xf7,
-  0x1b, 0xe2, 0xae, 0xd0, 0x62, 0x56, 0xc0, 0x6b, 0xf7, 0x46, 0x52, 0x34,
-  0x5b, 0xef, 0x43, 0x4b, 0xb4, 0x4e, 0x67, 0xb7, 0x2f, 0x1b, 0x0e, 0xc2,
-  0xc6, 0xe0, 0xde, 0xd8, 0x13, 0x3a, 0xf4, 0x23, 0x2a, 0x14, 0x20, 0xf7,
-  0x22, 0x15, 0xef, 0x13, 0xfa, 0xe4, 0xfc, 0xf9, 0xe2, 0xf6, 0x0f, 0x15,
-  0x01, 0x14, 0x0f, 0xed, 0xed, 0xe6, 0xef, 0x20, 0x14, 0x08, 0x10, 0xf8,
-  0xeb, 0xeb, 0x0c, 0x0c, 0x02, 0x1d, 0xf8, 0xe0, 0x0d, 0x31, 0xda, 0x00,
-  0xf7, 0x06, 0xdf, 0xee, 0x7f, 0x30, 0x24, 0x1b, 0xe8, 0xfe, 0x15, 0x05,
-  0xf3, 0xe2, 0x23, 0xf1, 0xe8, 0x04, 0x24, 0x03, 0x08, 0x12, 0xf3, 0x0e,
-  0x0e, 0x0b, 0xee, 0xef, 0x10, 0x1e, 0xed, 0x12, 0x07, 0xfc, 0xf6, 0x26,
-  0xda, 0x04, 0xdb, 0x0e, 0x13, 0xee, 0x0d, 0x09, 0x01, 0x25, 0x0b, 0xcc,
-  0xde, 0x13, 0xef, 0xfd, 0x04, 0x0e, 0xeb, 0x17, 0x34, 0x0a, 0xd6, 0x35,
-  0xc3, 0x23, 0xef, 0x36, 0xe2, 0x0f, 0x30, 0xbe, 0xb8, 0xd5, 0xe5, 0xbf,
-  0x1e, 0xfe, 0x00, 0x4f, 0xc8, 0xd4, 0x53, 0xa9, 0x3c, 0xf4, 0xdb, 0x50,
-  0xbc, 0xc4, 0xda, 0x10, 0xe5, 0xb1, 0xf3, 0x1c, 0x33, 0x32, 0xcd, 0xe5,
-  0x02, 0xc0, 0xfa, 0x2c, 0xd1, 0xa3, 0xba, 0x66, 0x16, 0xcf, 0xc3, 0x4b,
-  0xed, 0xd1, 0x53, 0x24, 0x1b, 0x4e, 0xda, 0x19, 0x50, 0x03, 0xdb, 0x51,
-  0x24, 0x7f, 0x31, 0x2b, 0x3b, 0x42, 0xf0, 0xfb, 0xe8, 0xe7, 0x96, 0xa8,
-  0xe3, 0x4e, 0x2e, 0x54, 0xe3, 0x0a, 0x42, 0x4b, 0xa7, 0x99, 0x3f, 0x2d,
-  0x53, 0xdc, 0x18, 0x49, 0x56, 0xde, 0x5c, 0x55, 0x49, 0x37, 0x2f, 0x37,
-  0x4e, 0xbf, 0x10, 0x0c, 0x4c, 0x3d, 0x46, 0xec, 0xab, 0xc9, 0xcd, 0x16,
-  0x49, 0xe6, 0x42, 0xec, 0xf1, 0x25, 0x10, 0x15, 0xca, 0xc6, 0x2b, 0x20,
-  0x32, 0x51, 0xf9, 0x25, 0xbe, 0xef, 0x22, 0x29, 0xb7, 0x23, 0xd5, 0x0b,
-  0xc7, 0x1b, 0x0e, 0xe6, 0x2c, 0x5d, 0xee, 0xe2, 0xbb, 0x1f, 0x41, 0xde,
-  0xec, 0x17, 0xf1, 0xd3, 0xf4, 0x6f, 0xca, 0x0d, 0xdd, 0xdc, 0xd3, 0x42,
-  0xfa, 0xf4, 0x58, 0x06, 0xc7, 0x35, 0xcb, 0xee, 0xb9, 0x36, 0x40, 0xd2,
-  0x2d, 0xb8, 0x65, 0xed, 0xb8, 0xbd, 0x38, 0x7f, 0xfe, 0xea, 0xd0, 0x37,
-  0x5a, 0xdb, 0x19, 0xed, 0xcf, 0x9f, 0x3e, 0x23, 0x51, 0xca, 0x01, 0xa1,
-  0xe6, 0xe2, 0x42, 0x25, 0xee, 0xc3, 0xa3, 0xbc, 0xca, 0xde, 0xf3, 0x18,
-  0xd4, 0x2a, 0x05, 0x4c, 0xc5, 0xcc, 0xe4, 0x16, 0x9c, 0x9e, 0xc5, 0x2c,
-  0x5b, 0xfa, 0xe2, 0x0a, 0x5d, 0x79, 0x24, 0xa0, 0x1d, 0x8b, 0x45, 0x50,
-  0x07, 0x8d, 0x23, 0xdb, 0x35, 0xf8, 0x60, 0x33, 0x5d, 0x06, 0xd4, 0x00,
-  0xe5, 0x12, 0x17, 0x7a, 0xf7, 0xb5, 0xfb, 0x47, 0xb9, 0xfe, 0x40, 0xad,
-  0xb2, 0xa7, 0xce, 0x55, 0x0d, 0x6f, 0x33, 0xbc, 0x32, 0x98, 0x3a, 0x37,
-  0x2d, 0xe3, 0xbb, 0xb5, 0xbc, 0xb2, 0x9a, 0x29, 0x58, 0x12, 0x5c, 0xd0,
-  0x31, 0x7f, 0xfc, 0x48, 0x17, 0xf3, 0xe7, 0x25, 0x66, 0xbb, 0x4c, 0xab,
-  0x31, 0x0d, 0xcf, 0xe1, 0x69, 0x0a, 0xa7, 0xa0, 0x59, 0x1c, 0xa6, 0x26,
-  0x28, 0x26, 0x58, 0x72, 0x4d, 0x49, 0x25, 0x5f, 0x18, 0x47, 0x55, 0xa4,
-  0x05, 0x1b, 0xd2, 0x03, 0xdf, 0x77, 0x61, 0xd2, 0x38, 0x66, 0xec, 0xff,
-  0x13, 0xb0, 0xd3, 0xcc, 0xeb, 0x8c, 0x24, 0x12, 0xb8, 0xbf, 0xd0, 0xe9,
-  0x41, 0x3e, 0xb6, 0x73, 0xe6, 0xc3, 0x12, 0x64, 0xec, 0x69, 0xbb, 0x13,
-  0xce, 0x11, 0x39, 0xd2, 0x1e, 0xf9, 0x45, 0xa1, 0x10, 0x33, 0x70, 0x61,
-  0xc5, 0x32, 0x96, 0xd5, 0xb3, 0xf6, 0xba, 0x01, 0x59, 0x57, 0xad, 0xe2,
-  0x32, 0x7f, 0xbe, 0x7a, 0xcd, 0xfa, 0x6e, 0xdf, 0x1e, 0x46, 0xb9, 0x41,
-  0x3d, 0x2c, 0xa4, 0x6b, 0x01, 0xdf, 0xeb, 0xd8, 0x62, 0x37, 0x48, 0x32,
-  0x71, 0x41, 0xca, 0x2e, 0xe2, 0x37, 0xcb, 0x44, 0xb6, 0x12, 0x06, 0x07,
-  0xb7, 0x43, 0x40, 0x41, 0xd4, 0x2a, 0xf1, 0xc9, 0xe9, 0xb0, 0x50, 0x4b,
-  0x16, 0x4f, 0x75, 0xf3, 0xe3, 0xc1, 0xea, 0x68, 0xdd, 0x5b, 0x2b, 0x45,
-  0x21, 0x59, 0x38, 0x13, 0x67, 0x7f, 0x13, 0x41, 0x2b, 0x10, 0xfd, 0x4f,
-  0x41, 0x6c, 0xee, 0xf7, 0x26, 0x75, 0x3a, 0x4a, 0xc9, 0x72, 0xa7, 0xf2,
-  0x16, 0xae, 0x71, 0xcb, 0xfc, 0x3f, 0x47, 0x1d, 0x48, 0xf6, 0xf9, 0x79,
-  0x4c, 0xd8, 0x92, 0xf4, 0xe9, 0xa0, 0x1b, 0x5a, 0xe6, 0xfe, 0xe0, 0xb3,
-  0xf7, 0xb3, 0x48, 0xfc, 0x3b, 0x32, 0xbb, 0x36, 0xf9, 0xf8, 0x4d, 0x58,
-  0xea, 0xfb, 0x15, 0xc0, 0x0d, 0x2d, 0xc3, 0x10, 0x56, 0xd8, 0xf4, 0x43,
-  0xfb, 0xe5, 0x1c, 0x16, 0xd4, 0x61, 0xda, 0xca, 0xb9, 0x0f, 0xe6, 0xfe,
-  0x5c, 0x2f, 0x02, 0xb2, 0xbe, 0x61, 0xee, 0x1a, 0x0f, 0x37, 0x6d, 0xd4,
-  0xc6, 0x22, 0x28, 0x97, 0x24, 0xd0, 0x40, 0x49, 0xd9, 0xb4, 0x37, 0xdf,
-  0xc4, 0xe1, 0x57, 0x25, 0x01, 0xa6, 0xe1, 0x6f, 0x7f, 0x92, 0x03, 0xd6,
-  0x23, 0x1e, 0xba, 0x35, 0xbb, 0x26, 0x55, 0x09, 0x2b, 0x28, 0xe2, 0x97,
-  0xe3, 0x3b, 0x2f, 0x2b, 0xc7, 0xf1, 0x37, 0x19, 0x08, 0x01, 0xfc, 0xdf,
-  0xe3, 0x25, 0xfa, 0xde, 0xed, 0x2a, 0x2f, 0x25, 0x04, 0xe9, 0x60, 0x0b,
-  0x62, 0xfa, 0x1c, 0xb8, 0x18, 0xe4, 0x00, 0xfd, 0x28, 0xfa, 0x4f, 0x5d,
-  0x22, 0xfc, 0xce, 0xd2, 0xac, 0x70, 0x06, 0xda, 0x0e, 0x5b, 0xbc, 0x03,
-  0x34, 0x7f, 0xd6, 0xe6, 0x96, 0x41, 0x38, 0x11, 0xfa, 0xfb, 0x7b, 0x3a,
-  0xf5, 0xf4, 0x76, 0xec, 0x33, 0x35, 0x15, 0x31, 0x00, 0xac, 0x25, 0x66,
-  0x29, 0xa4, 0x04, 0x5e, 0xba, 0xea, 0xe3, 0x44, 0x69, 0xad, 0xd0, 0xbf,
-  0x04, 0x51, 0xc8, 0x68, 0x45, 0x1f, 0x65, 0x53, 0xdc, 0xe5, 0x13, 0x10,
-  0x1d, 0xee, 0x53, 0x55, 0x0c, 0x16, 0x41, 0x1f, 0x31, 0xac, 0x5d, 0x4e,
-  0x3b, 0xbf, 0x13, 0xe0, 0x96, 0x1b, 0xbd, 0x36, 0x42, 0x93, 0x6a, 0x30,
-  0xdc, 0x47, 0xc6, 0xfe, 0x38, 0xb0, 0x12, 0xb8, 0xb1, 0x8c, 0xc2, 0x21,
-  0x49, 0xa4, 0x20, 0xee, 0x0b, 0xbb, 0xc4, 0x91, 0x26, 0xa3, 0xa1, 0xf9,
-  0xa1, 0x19, 0x3b, 0x99, 0xd0, 0x30, 0xcd, 0x1a, 0xe0, 0x2a, 0xfe, 0xf8,
-  0x05, 0x54, 0x06, 0xdb, 0x32, 0xc1, 0x71, 0x42, 0xb6, 0xf5, 0xe3, 0xf5,
-  0xf1, 0x24, 0x37, 0xca, 0xb9, 0x81, 0xc0, 0xb4, 0xe7, 0xa0, 0x03, 0x55,
-  0x30, 0x8c, 0xe4, 0x7c, 0xa7, 0x02, 0x13, 0xf7, 0x57, 0x1c, 0xf6, 0x31,
-  0xd1, 0x57, 0x55, 0xd8, 0xf2, 0x16, 0x38, 0x52, 0xab, 0x3c, 0x13, 0x25,
-  0x17, 0x10, 0x9c, 0xfd, 0xf1, 0x3f, 0x20, 0xc4, 0xb5, 0xd2, 0xaa, 0xf3,
-  0x1e, 0xd9, 0xb9, 0xb3, 0x15, 0xbf, 0xad, 0x0e, 0x0c, 0x0d, 0xd7, 0x50,
-  0x48, 0x21, 0xeb, 0x25, 0x20, 0xe9, 0xd8, 0x81, 0xdf, 0xcd, 0xbb, 0xac,
-  0xfb, 0xc3, 0xb1, 0x45, 0x40, 0xad, 0x90, 0xf5, 0x18, 0x5d, 0x17, 0x06,
-  0x35, 0x2b, 0x15, 0x2f, 0x52, 0xd6, 0x9f, 0xc9, 0xc4, 0xbd, 0xdb, 0x13,
-  0xa7, 0xbf, 0xbc, 0x3a, 0xc1, 0xb7, 0x15, 0x1a, 0x66, 0x12, 0x55, 0x62,
-  0x40, 0x07, 0x31, 0x01, 0x2e, 0x78, 0xcd, 0x3c, 0x0f, 0x5b, 0x24, 0x2a,
-  0x25, 0x31, 0x26, 0x07, 0x4b, 0x3b, 0x3e, 0x8e, 0x5b, 0x9d, 0x3f, 0x14,
-  0x08, 0xd8, 0xd0, 0x02, 0x10, 0x29, 0xcb, 0xb7, 0xab, 0xf5, 0xf7, 0xff,
-  0x48, 0xea, 0x43, 0xdb, 0x33, 0xc7, 0xe3, 0x43, 0x0b, 0x0e, 0xf8, 0xd1,
-  0x11, 0x1f, 0xc0, 0xb4, 0x68, 0x5a, 0xab, 0xf5, 0x13, 0xf6, 0x2d, 0x05,
-  0x92, 0xa0, 0xc4, 0x5c, 0xcf, 0x9c, 0x17, 0x39, 0x22, 0x4a, 0x81, 0x0d,
-  0xe0, 0x33, 0xb2, 0x6e, 0x30, 0xcf, 0x15, 0xfc, 0x40, 0x26, 0xde, 0xd1,
-  0xaf, 0x02, 0x32, 0x43, 0x28, 0x11, 0x44, 0x23, 0xab, 0xf6, 0x3e, 0x69,
-  0x13, 0x2e, 0x23, 0xa8, 0x20, 0xbf, 0x28, 0x9b, 0xb9, 0x4b, 0x5e, 0xb5,
-  0xd8, 0xe3, 0x2e, 0xf5, 0x23, 0xcf, 0xd8, 0xbb, 0x48, 0xd3, 0x49, 0x3d,
-  0xd1, 0x48, 0xd4, 0xc5, 0x5f, 0xbf, 0xbe, 0xd5, 0x2f, 0x3a, 0xbe, 0xd8,
-  0x50, 0xc8, 0x10, 0x1d, 0x63, 0x0c, 0xc4, 0x52, 0xe8, 0xd8, 0xcc, 0xb6,
-  0x36, 0x35, 0x1a, 0x18, 0x03, 0x01, 0xfb, 0xae, 0xf3, 0xd3, 0x15, 0x47,
-  0x10, 0xc4, 0x4e, 0x09, 0x9c, 0xd6, 0x15, 0x13, 0xe0, 0xbe, 0xe8, 0x2d,
-  0x08, 0xf7, 0xf9, 0xfb, 0x5d, 0xe9, 0xde, 0xc4, 0xdd, 0x1a, 0xc8, 0xe3,
-  0x6b, 0x51, 0x02, 0x07, 0xdd, 0x38, 0x38, 0xd1, 0x0d, 0xf7, 0x36, 0x50,
-  0x5b, 0xa8, 0x10, 0x81, 0x35, 0x35, 0x43, 0xec, 0xdc, 0x1c, 0xe0, 0x3c,
-  0x11, 0x06, 0xd3, 0x46, 0x41, 0xb7, 0x10, 0x46, 0x50, 0x94, 0xf3, 0xc6,
-  0x3d, 0xbb, 0x4d, 0x73, 0x15, 0xa8, 0x2a, 0xf1, 0x53, 0xd8, 0xbe, 0x3c,
-  0x57, 0xac, 0x31, 0xe9, 0xfa, 0xfc, 0x45, 0x08, 0x40, 0x2e, 0x3a, 0xe9,
-  0xf6, 0x29, 0x12, 0x21, 0x32, 0xe7, 0xb4, 0x01, 0x81, 0xeb, 0x10, 0x96,
-  0xc6, 0xcd, 0x75, 0x06, 0x59, 0xd0, 0x9b, 0xe6, 0x44, 0xc5, 0xd7, 0x66,
-  0xce, 0xea, 0x64, 0x17, 0x8f, 0xda, 0xbf, 0xfa, 0x10, 0x2f, 0xae, 0x9c,
-  0x40, 0xfc, 0x6a, 0xc1, 0xff, 0xfb, 0xdb, 0xba, 0x04, 0xf9, 0x43, 0x47,
-  0xd2, 0xd3, 0x51, 0xb5, 0x42, 0x0f, 0x56, 0xf4, 0xb2, 0x0d, 0x56, 0x1c,
-  0x79, 0xc1, 0xd7, 0x21, 0xc9, 0xe5, 0xc8, 0xb5, 0xd1, 0xa0, 0xd3, 0xcd,
-  0x3b, 0x5d, 0x45, 0x08, 0x63, 0x36, 0xd9, 0xb1, 0xcf, 0x2f, 0x07, 0xeb,
-  0x41, 0xce, 0xea, 0x02, 0x2a, 0xf1, 0x37, 0x41, 0x54, 0x39, 0xfe, 0xbd,
-  0x07, 0x15, 0x30, 0x1d, 0xf2, 0xd2, 0x3c, 0x08, 0xde, 0xa6, 0x72, 0x17,
-  0xe9, 0xbe, 0x2a, 0x54, 0xb3, 0xc5, 0x0d, 0x0a, 0x41, 0x49, 0x17, 0xc3,
-  0x01, 0x4f, 0xdb, 0x17, 0x51, 0x0c, 0x2d, 0x57, 0xba, 0x5a, 0xdf, 0xc7,
-  0xbd, 0x46, 0xd6, 0xf8, 0xf4, 0x4b, 0x57, 0x43, 0x32, 0xe7, 0xc7, 0xe0,
-  0xd4, 0xa4, 0xee, 0x81, 0x10, 0x3b, 0xe8, 0x99, 0x21, 0xc7, 0x18, 0xd5,
-  0xf8, 0x2d, 0xad, 0x23, 0xcb, 0x0d, 0xc9, 0xfd, 0x3c, 0xe8, 0xc7, 0x21,
-  0x05, 0x8a, 0xf1, 0xec, 0x13, 0xe4, 0xa0, 0xdc, 0xb3, 0x1f, 0x41, 0xb3,
-  0x1e, 0x3c, 0xf3, 0xb6, 0x2d, 0xd1, 0x8f, 0x35, 0x3c, 0xc0, 0x10, 0x45,
-  0x38, 0x96, 0x1e, 0x21, 0x56, 0xda, 0xe8, 0xe9, 0xd0, 0x59, 0xbb, 0xfa,
-  0x4d, 0x13, 0x12, 0x27, 0x01, 0x7f, 0xbb, 0x11, 0x22, 0x0f, 0xc7, 0x00,
-  0xda, 0xfa, 0xed, 0x3e, 0x35, 0x17, 0x39, 0x1b, 0x00, 0x2e, 0xef, 0xf6,
-  0xc2, 0xd1, 0xaf, 0xab, 0x10, 0xbf, 0x25, 0x09, 0x24, 0x64, 0x02, 0x0e,
-  0x12, 0x34, 0xf3, 0x61, 0xc3, 0xd4, 0x9e, 0xc9, 0x1d, 0xfc, 0x2d, 0xf8,
-  0x87, 0xc9, 0x03, 0x9f, 0x51, 0x81, 0xfa, 0x07, 0xaf, 0xfa, 0xf6, 0x09,
-  0x99, 0xdf, 0x39, 0x6b, 0xd1, 0xed, 0x1e, 0xf8, 0x5f, 0x04, 0xfc, 0xbc,
-  0xf2, 0x37, 0x2f, 0x0d, 0x04, 0x36, 0x12, 0x06, 0x18, 0x0a, 0xb9, 0xfc,
-  0xf4, 0xd9, 0xc1, 0xc3, 0xb0, 0x17, 0xd5, 0x52, 0xab, 0x3a, 0x32, 0xf8,
-  0xd3, 0x25, 0x1f, 0x34, 0xdd, 0x30, 0xe8, 0x4c, 0xf7, 0xb6, 0x1b, 0xe1,
-  0x50, 0x2f, 0x28, 0xf2, 0x0b, 0xae, 0x05, 0xf4, 0x45, 0xda, 0xe2, 0x2e,
-  0xb9, 0x43, 0x40, 0x27, 0x32, 0xae, 0xc0, 0x07, 0x21, 0x8e, 0x89, 0xfa,
-  0xed, 0x2d, 0x3c, 0xf2, 0x45, 0xf7, 0xee, 0xf7, 0xa0, 0x4a, 0x0a, 0x33,
-  0x30, 0x4a, 0x13, 0x4c, 0x09, 0xfe, 0xba, 0x92, 0x81, 0xb6, 0xb1, 0xfe,
-  0x16, 0x56, 0x26, 0x9e, 0xe4, 0x32, 0x48, 0xe7, 0x2b, 0xea, 0x3a, 0x93,
-  0x95, 0x05, 0xcf, 0xed, 0x83, 0x25, 0x9f, 0xf2, 0x35, 0x16, 0xde, 0xf0,
-  0x2f, 0x3d, 0xa2, 0xa1, 0xb0, 0xb7, 0x84, 0x45, 0x9e, 0xfb, 0x24, 0x0b,
-  0x5a, 0x13, 0x4e, 0x6a, 0x4b, 0x39, 0x23, 0xab, 0xa5, 0x9b, 0xf1, 0xd9,
-  0x55, 0xdc, 0xa1, 0xaf, 0x94, 0xbd, 0xd2, 0x2b, 0x22, 0xcb, 0x8b, 0x61,
-  0x24, 0x04, 0x87, 0xff, 0x3f, 0xdc, 0xfd, 0x9d, 0x1e, 0xb5, 0x4d, 0x5d,
-  0x4c, 0xde, 0x6f, 0x1a, 0xc0, 0xaa, 0xe0, 0x3b, 0xc9, 0xea, 0xda, 0xd8,
-  0x2f, 0x09, 0x55, 0x31, 0x52, 0xf7, 0x51, 0x26, 0x83, 0xb9, 0x95, 0xab,
-  0xd7, 0x8a, 0x33, 0x43, 0xa1, 0x9b, 0xfe, 0x61, 0x5f, 0x72, 0xb9, 0x4d,
-  0xdd, 0x12, 0x87, 0xab, 0xa1, 0x4b, 0xa0, 0xba, 0xab, 0xab, 0xf4, 0xe4,
-  0x8e, 0x07, 0x49, 0x48, 0x2b, 0x87, 0xcd, 0x1d, 0x68, 0x28, 0x94, 0x2f,
-  0x8d, 0xed, 0x05, 0x32, 0x19, 0xb7, 0xae, 0xe1, 0x9c, 0x16, 0x31, 0x1f,
-  0x37, 0xea, 0x4b, 0x2d, 0xf6, 0xcc, 0x9a, 0xfd, 0x38, 0x43, 0xe6, 0x4d,
-  0xa3, 0x14, 0x8a, 0xd1, 0x40, 0x35, 0xf1, 0x90, 0x81, 0xc8, 0xa2, 0x2c,
-  0xa7, 0x97, 0x6a, 0xea, 0x37, 0x8a, 0x3a, 0xac, 0x8b, 0xc8, 0xd2, 0xaf,
-  0xcf, 0x36, 0x9a, 0xb3, 0x22, 0x22, 0x2e, 0xda, 0xae, 0x27, 0x94, 0xfc,
-  0x27, 0xf1, 0xa9, 0x9c, 0x52, 0xa0, 0xd1, 0xd8, 0xa2, 0x51, 0x4b, 0xc7,
-  0xc4, 0xd7, 0x32, 0xf8, 0x03, 0x01, 0xdc, 0xdd, 0xaa, 0xfb, 0x5b, 0x03,
-  0x20, 0xf8, 0xb5, 0xcf, 0xfa, 0x49, 0x02, 0x46, 0x1e, 0x56, 0xda, 0x43,
-  0x18, 0x76, 0xbc, 0xe8, 0xfb, 0x16, 0x38, 0xe9, 0x3f, 0x98, 0x7f, 0x2b,
-  0xb5, 0x25, 0x08, 0x55, 0xa6, 0x50, 0xbc, 0xd5, 0xd7, 0xbc, 0x31, 0x44,
-  0x4b, 0xaf, 0x1a, 0xc4, 0x53, 0x25, 0x2d, 0x22, 0x71, 0x9d, 0xd6, 0x20,
-  0xfc, 0xd1, 0x10, 0x25, 0x24, 0x68, 0x3a, 0x52, 0xdd, 0x7b, 0x42, 0x3b,
-  0xa3, 0xff, 0xfc, 0x56, 0x14, 0xd3, 0xd9, 0x10, 0xc4, 0x0e, 0xd6, 0xee,
-  0x2d, 0xe8, 0x01, 0xc5, 0xbf, 0x09, 0x29, 0x09, 0xee, 0x18, 0x2a, 0xaa,
-  0x1b, 0x98, 0xa3, 0x0e, 0xac, 0x10, 0xb7, 0x53, 0xcd, 0xbc, 0xc1, 0x01,
-  0xc8, 0xd3, 0xa4, 0xdc, 0x07, 0xc1, 0xf6, 0x14, 0x3e, 0xc9, 0xe1, 0x47,
-  0x46, 0xdf, 0x3f, 0x1c, 0xcc, 0x2a, 0xde, 0xae, 0x30, 0xd3, 0xf6, 0x40,
-  0xc2, 0xdf, 0xc5, 0xdf, 0x9f, 0x00, 0xc1, 0xb5, 0xaa, 0xc9, 0xb2, 0x3f,
-  0xd8, 0x45, 0xf7, 0xec, 0xc9, 0x2a, 0x22, 0xc2, 0xd5, 0xcd, 0xcb, 0xc9,
-  0x15, 0x0c, 0xb2, 0xbd, 0x87, 0x09, 0x92, 0x32, 0xe9, 0x81, 0x34, 0x29,
-  0xea, 0xfe, 0xb4, 0x93, 0x41, 0x9a, 0x1e, 0x60, 0x2e, 0x5b, 0xdc, 0xef,
-  0x18, 0xea, 0xc2, 0xcf, 0x58, 0xb2, 0xea, 0x46, 0xb1, 0xb1, 0xef, 0x15,
-  0x4a, 0x11, 0xa3, 0x40, 0x0e, 0xc6, 0x1b, 0x02, 0xb2, 0xc3, 0x37, 0x66,
-  0x1f, 0x27, 0xa2, 0x1a, 0x33, 0xed, 0xd2, 0x81, 0x46, 0xc6, 0xb7, 0x26,
-  0x2e, 0xdf, 0xee, 0xf8, 0x09, 0x12, 0x5d, 0xdb, 0x94, 0xd1, 0xbb, 0xf6,
-  0xc4, 0x20, 0x0a, 0x3f, 0xbe, 0x15, 0x12, 0xb0, 0x32, 0x68, 0xea, 0xd8,
-  0x37, 0x88, 0xbd, 0x0f, 0xaf, 0xd0, 0x02, 0x10, 0xcd, 0xac, 0xfa, 0x2c,
-  0xc4, 0xef, 0x58, 0x4a, 0x0b, 0x4e, 0x9c, 0xf0, 0x18, 0xc1, 0xa8, 0xde,
-  0x49, 0x6a, 0xe0, 0xe5, 0xe2, 0xfd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00,
-  0x61, 0xfe, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,
-  0xa9, 0x01, 0x00, 0x00, 0xed, 0x05, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00,
-  0x58, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0xc2, 0x02, 0x00, 0x00,
-  0xcd, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0x1a, 0x01, 0x00, 0x00,
-  0x19, 0x01, 0x00, 0x00, 0xcb, 0x01, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff,
-  0x7d, 0x08, 0x00, 0x00, 0xfd, 0x10, 0x00, 0x00, 0xc0, 0xfe, 0xff, 0xff,
-  0x54, 0xff, 0xff, 0xff, 0x07, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x00,
-  0x37, 0xff, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x35, 0xfe, 0xff, 0xff,
-  0x64, 0xfe, 0xff, 0xff, 0x16, 0xfe, 0xff, 0xff, 0x51, 0xfe, 0xff, 0xff,
-  0x71, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0xff, 0x84, 0x01, 0x00, 0x00,
-  0x6e, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x2b, 0x19, 0x55, 0xdf, 0xbe, 0x33, 0x42, 0xfd, 0xd7, 0xfa, 0x20, 0xd1,
-  0xc7, 0xdb, 0xeb, 0x00, 0xc7, 0x7f, 0x79, 0x2a, 0xf9, 0xe3, 0x02, 0xd6,
-  0xcd, 0x2e, 0xfb, 0xe8, 0x2c, 0x11, 0xfe, 0x3d, 0x43, 0xe1, 0xba, 0x14,
-  0xf5, 0x7f, 0xc3, 0xfd, 0x78, 0xc4, 0x04, 0x82, 0xb5, 0x66, 0x26, 0xd2,
-  0x5c, 0x83, 0xb8, 0xac, 0x8a, 0x1f, 0x6a, 0x43, 0x25, 0x05, 0xf4, 0xf7,
-  0xc2, 0xc8, 0xfb, 0xc4, 0xe9, 0x4f, 0xaf, 0x4d, 0x48, 0xdf, 0xaf, 0x70,
-  0x5f, 0x3a, 0x7d, 0xec, 0x92, 0xac, 0x63, 0x78, 0xb7, 0x84, 0xbf, 0x92,
-  0x40, 0x7f, 0xe9, 0xb4, 0x5d, 0x9c, 0xd2, 0x92, 0x18, 0xb5, 0x53, 0xfe,
-  0xda, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x0e, 0x42, 0x00, 0x00, 0x9e, 0x92, 0xff, 0xff, 0xe5, 0x8e, 0xff, 0xff,
-  0xf2, 0xfe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7b, 0xff, 0xff,
-  0x0c, 0x7b, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52,
-  0x20, 0x43, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x30, 0x07, 0x00, 0x00, 0x34, 0x07, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0xcc, 0x06, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00,
-  0x0c, 0x06, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x00, 0x98, 0x05, 0x00, 0x00,
-  0x3c, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00,
-  0x78, 0x04, 0x00, 0x00, 0x3c, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00,
-  0xc8, 0x03, 0x00, 0x00, 0x94, 0x03, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00,
-  0x0c, 0x03, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0x84, 0x02, 0x00, 0x00,
-  0x48, 0x02, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00,
-  0x8c, 0x01, 0x00, 0x00, 0x50, 0x01, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x00,
-  0xdc, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x12, 0xfa, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00,
-  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00,
-  0xe6, 0xf9, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x10, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x54, 0xe1, 0x00, 0x00, 0xa8, 0x5b, 0x00, 0x00, 0x90, 0x5b, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0xf4, 0x05, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x78, 0x5b, 0x00, 0x00, 0x70, 0x5b, 0x00, 0x00,
+  0x40, 0x5b, 0x00, 0x00, 0x24, 0x5b, 0x00, 0x00, 0xb4, 0x5a, 0x00, 0x00,
+  0x24, 0x5a, 0x00, 0x00, 0x14, 0x4e, 0x00, 0x00, 0x84, 0x4c, 0x00, 0x00,
+  0x74, 0x46, 0x00, 0x00, 0x24, 0x46, 0x00, 0x00, 0x14, 0x40, 0x00, 0x00,
+  0x84, 0x3e, 0x00, 0x00, 0x14, 0x3b, 0x00, 0x00, 0x84, 0x39, 0x00, 0x00,
+  0x74, 0x33, 0x00, 0x00, 0x24, 0x33, 0x00, 0x00, 0x14, 0x2d, 0x00, 0x00,
+  0x84, 0x2b, 0x00, 0x00, 0x14, 0x28, 0x00, 0x00, 0x84, 0x26, 0x00, 0x00,
+  0x74, 0x20, 0x00, 0x00, 0x24, 0x20, 0x00, 0x00, 0x14, 0x1d, 0x00, 0x00,
+  0x44, 0x1c, 0x00, 0x00, 0x84, 0x1a, 0x00, 0x00, 0xb4, 0x19, 0x00, 0x00,
+  0x24, 0x18, 0x00, 0x00, 0xf4, 0x17, 0x00, 0x00, 0x64, 0x16, 0x00, 0x00,
+  0x94, 0x15, 0x00, 0x00, 0xd4, 0x13, 0x00, 0x00, 0x04, 0x13, 0x00, 0x00,
+  0x74, 0x11, 0x00, 0x00, 0x44, 0x11, 0x00, 0x00, 0xb4, 0x0f, 0x00, 0x00,
+  0xe4, 0x0e, 0x00, 0x00, 0x24, 0x0d, 0x00, 0x00, 0x54, 0x0c, 0x00, 0x00,
+  0xc4, 0x0a, 0x00, 0x00, 0x94, 0x0a, 0x00, 0x00, 0x04, 0x0a, 0x00, 0x00,
+  0xb4, 0x09, 0x00, 0x00, 0x14, 0x09, 0x00, 0x00, 0xc4, 0x08, 0x00, 0x00,
+  0x24, 0x08, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x00, 0x14, 0x08, 0x00, 0x00,
+  0x0c, 0x08, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00,
+  0xf4, 0x07, 0x00, 0x00, 0xec, 0x07, 0x00, 0x00, 0xe4, 0x07, 0x00, 0x00,
+  0xdc, 0x07, 0x00, 0x00, 0xd4, 0x07, 0x00, 0x00, 0xcc, 0x07, 0x00, 0x00,
+  0xc4, 0x07, 0x00, 0x00, 0xbc, 0x07, 0x00, 0x00, 0xb4, 0x07, 0x00, 0x00,
+  0xac, 0x07, 0x00, 0x00, 0xa4, 0x07, 0x00, 0x00, 0x9c, 0x07, 0x00, 0x00,
+  0x94, 0x07, 0x00, 0x00, 0x8c, 0x07, 0x00, 0x00, 0x84, 0x07, 0x00, 0x00,
+  0x7c, 0x07, 0x00, 0x00, 0x74, 0x07, 0x00, 0x00, 0x6c, 0x07, 0x00, 0x00,
+  0x64, 0x07, 0x00, 0x00, 0x5c, 0x07, 0x00, 0x00, 0x54, 0x07, 0x00, 0x00,
+  0x4c, 0x07, 0x00, 0x00, 0x2c, 0x07, 0x00, 0x00, 0xc4, 0x06, 0x00, 0x00,
+  0x4c, 0x03, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x64, 0x05, 0x00, 0x00, 0x34, 0x05, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x46, 0x61, 0x73, 0x74, 0x41, 0x72, 0x65, 0x6e,
+  0x61, 0x41, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00,
+  0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x40, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x52, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x64, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00,
+  0x00, 0x6d, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x52, 0x00, 0x00,
+  0x00, 0x49, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x00, 0x52, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00,
+  0x00, 0x7f, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00,
+  0xb0, 0x53, 0x00, 0x00, 0xb0, 0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0xb0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x1c, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x54, 0xde, 0x00, 0x00, 0xa8, 0x58, 0x00, 0x00, 0x90, 0x58, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00,
+  0x4b, 0x00, 0x00, 0x00, 0x78, 0x58, 0x00, 0x00, 0x70, 0x58, 0x00, 0x00,
+  0x40, 0x58, 0x00, 0x00, 0x24, 0x58, 0x00, 0x00, 0xb4, 0x57, 0x00, 0x00,
+  0x24, 0x57, 0x00, 0x00, 0x14, 0x4b, 0x00, 0x00, 0x84, 0x49, 0x00, 0x00,
+  0x74, 0x43, 0x00, 0x00, 0x24, 0x43, 0x00, 0x00, 0x14, 0x3d, 0x00, 0x00,
+  0x84, 0x3b, 0x00, 0x00, 0x14, 0x38, 0x00, 0x00, 0x84, 0x36, 0x00, 0x00,
+  0x74, 0x30, 0x00, 0x00, 0x24, 0x30, 0x00, 0x00, 0x14, 0x2a, 0x00, 0x00,
+  0x84, 0x28, 0x00, 0x00, 0x14, 0x25, 0x00, 0x00, 0x84, 0x23, 0x00, 0x00,
+  0x74, 0x1d, 0x00, 0x00, 0x24, 0x1d, 0x00, 0x00, 0x14, 0x1a, 0x00, 0x00,
+  0x44, 0x19, 0x00, 0x00, 0x84, 0x17, 0x00, 0x00, 0xb4, 0x16, 0x00, 0x00,
+  0x24, 0x15, 0x00, 0x00, 0xf4, 0x14, 0x00, 0x00, 0x64, 0x13, 0x00, 0x00,
+  0x94, 0x12, 0x00, 0x00, 0xd4, 0x10, 0x00, 0x00, 0x04, 0x10, 0x00, 0x00,
+  0x74, 0x0e, 0x00, 0x00, 0x44, 0x0e, 0x00, 0x00, 0xb4, 0x0c, 0x00, 0x00,
+  0xe4, 0x0b, 0x00, 0x00, 0x24, 0x0a, 0x00, 0x00, 0x54, 0x09, 0x00, 0x00,
+  0xc4, 0x07, 0x00, 0x00, 0x94, 0x07, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00,
+  0xb4, 0x06, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0xc4, 0x05, 0x00, 0x00,
+  0x24, 0x05, 0x00, 0x00, 0x1c, 0x05, 0x00, 0x00, 0x14, 0x05, 0x00, 0x00,
+  0x0c, 0x05, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00,
+  0xf4, 0x04, 0x00, 0x00, 0xec, 0x04, 0x00, 0x00, 0xe4, 0x04, 0x00, 0x00,
+  0xdc, 0x04, 0x00, 0x00, 0xd4, 0x04, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00,
+  0xc4, 0x04, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00,
+  0xac, 0x04, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00,
+  0x94, 0x04, 0x00, 0x00, 0x8c, 0x04, 0x00, 0x00, 0x84, 0x04, 0x00, 0x00,
+  0x7c, 0x04, 0x00, 0x00, 0x74, 0x04, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00,
+  0x64, 0x04, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x54, 0x04, 0x00, 0x00,
+  0x4c, 0x04, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
+  0x38, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0c, 0x00,
+  0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4f, 0x66, 0x66, 0x6c,
+  0x69, 0x6e, 0x65, 0x4d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x41, 0x6c, 0x6c,
+  0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x06, 0x00, 0x08, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x28, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x54, 0x46, 0x4c, 0x33, 0x14, 0x00, 0x20, 0x00, 0x1c, 0x00, 0x18, 0x00,
+  0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0xa0, 0x55, 0x00, 0x00, 0xb0, 0x55, 0x00, 0x00,
+  0x54, 0xdb, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
+  0x75, 0x6c, 0x74, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x9c, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5f, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0xfa, 0xa9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x78, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xff, 0xff, 0x49, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x43, 0x4f, 0x4e, 0x56,
+  0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54, 0x41, 0x44,
+  0x41, 0x54, 0x41, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x6d, 0x69, 0x6e, 0x5f, 0x72, 0x75, 0x6e, 0x74,
+  0x69, 0x6d, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x00,
+  0x4a, 0x00, 0x00, 0x00, 0xb8, 0x54, 0x00, 0x00, 0xb0, 0x54, 0x00, 0x00,
+  0x80, 0x54, 0x00, 0x00, 0x64, 0x54, 0x00, 0x00, 0xf4, 0x53, 0x00, 0x00,
+  0x64, 0x53, 0x00, 0x00, 0x54, 0x47, 0x00, 0x00, 0xc4, 0x45, 0x00, 0x00,
+  0xb4, 0x3f, 0x00, 0x00, 0x64, 0x3f, 0x00, 0x00, 0x54, 0x39, 0x00, 0x00,
+  0xc4, 0x37, 0x00, 0x00, 0x54, 0x34, 0x00, 0x00, 0xc4, 0x32, 0x00, 0x00,
+  0xb4, 0x2c, 0x00, 0x00, 0x64, 0x2c, 0x00, 0x00, 0x54, 0x26, 0x00, 0x00,
+  0xc4, 0x24, 0x00, 0x00, 0x54, 0x21, 0x00, 0x00, 0xc4, 0x1f, 0x00, 0x00,
+  0xb4, 0x19, 0x00, 0x00, 0x64, 0x19, 0x00, 0x00, 0x54, 0x16, 0x00, 0x00,
+  0x84, 0x15, 0x00, 0x00, 0xc4, 0x13, 0x00, 0x00, 0xf4, 0x12, 0x00, 0x00,
+  0x64, 0x11, 0x00, 0x00, 0x34, 0x11, 0x00, 0x00, 0xa4, 0x0f, 0x00, 0x00,
+  0xd4, 0x0e, 0x00, 0x00, 0x14, 0x0d, 0x00, 0x00, 0x44, 0x0c, 0x00, 0x00,
+  0xb4, 0x0a, 0x00, 0x00, 0x84, 0x0a, 0x00, 0x00, 0xf4, 0x08, 0x00, 0x00,
+  0x24, 0x08, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00, 0x94, 0x05, 0x00, 0x00,
+  0x04, 0x04, 0x00, 0x00, 0xd4, 0x03, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00,
+  0xf4, 0x02, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00,
+  0x64, 0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00,
+  0x4c, 0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00,
+  0x34, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+  0x1c, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00,
+  0x04, 0x01, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00,
+  0xec, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00,
+  0xd4, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x00, 0x00,
+  0xbc, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+  0xa4, 0x00, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00,
+  0x8c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x92, 0xab, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x0e, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x2e, 0x31, 0x31,
+  0x2e, 0x31, 0x00, 0x00, 0xf6, 0xab, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x31, 0x2e, 0x31, 0x34, 0x2e, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x27, 0xff, 0xff,
+  0x00, 0x28, 0xff, 0xff, 0x04, 0x28, 0xff, 0xff, 0x08, 0x28, 0xff, 0xff,
+  0x0c, 0x28, 0xff, 0xff, 0x10, 0x28, 0xff, 0xff, 0x14, 0x28, 0xff, 0xff,
+  0x18, 0x28, 0xff, 0xff, 0x1c, 0x28, 0xff, 0xff, 0x20, 0x28, 0xff, 0xff,
+  0x24, 0x28, 0xff, 0xff, 0x28, 0x28, 0xff, 0xff, 0x2c, 0x28, 0xff, 0xff,
+  0x30, 0x28, 0xff, 0xff, 0x34, 0x28, 0xff, 0xff, 0x38, 0x28, 0xff, 0xff,
+  0x3c, 0x28, 0xff, 0xff, 0x40, 0x28, 0xff, 0xff, 0x44, 0x28, 0xff, 0xff,
+  0x48, 0x28, 0xff, 0xff, 0x4c, 0x28, 0xff, 0xff, 0x50, 0x28, 0xff, 0xff,
+  0x54, 0x28, 0xff, 0xff, 0x58, 0x28, 0xff, 0xff, 0x5c, 0x28, 0xff, 0xff,
+  0x60, 0x28, 0xff, 0xff, 0x64, 0x28, 0xff, 0xff, 0x7e, 0xac, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xaa, 0x92, 0xe1, 0x43,
+  0xdb, 0x10, 0x21, 0x7f, 0x12, 0x69, 0xa1, 0xf5, 0x81, 0x68, 0x17, 0x0d,
+  0xfe, 0xf4, 0xe8, 0xff, 0xd1, 0x23, 0x60, 0x7f, 0xf3, 0xa1, 0xb0, 0x78,
+  0x7e, 0x3a, 0x02, 0xeb, 0xf2, 0x9b, 0x81, 0xd5, 0x1a, 0xd2, 0xfe, 0x20,
+  0x81, 0x01, 0x16, 0x9a, 0xe5, 0xb1, 0x0c, 0xfc, 0x81, 0x13, 0x01, 0xae,
+  0x08, 0xfb, 0xf0, 0x4f, 0x7f, 0xce, 0x37, 0xf0, 0xdc, 0xcd, 0xa8, 0x2d,
+  0x1c, 0xf9, 0x7f, 0x3e, 0xf3, 0x26, 0x09, 0xe7, 0xeb, 0xe2, 0x34, 0xca,
+  0xaa, 0x7f, 0xe5, 0xc3, 0x60, 0xe5, 0x2f, 0xfd, 0xe2, 0x7f, 0xfa, 0xf8,
+  0x60, 0xfc, 0x19, 0x58, 0x0c, 0xdb, 0x81, 0xe3, 0x0c, 0x27, 0x11, 0x07,
+  0xed, 0x0a, 0x40, 0xa2, 0x23, 0xab, 0x7f, 0xd3, 0xd7, 0x31, 0xf7, 0x81,
+  0x73, 0x07, 0xb2, 0x4f, 0x06, 0x2d, 0xf4, 0x00, 0x69, 0x52, 0x15, 0x6d,
+  0x7f, 0x36, 0xe2, 0xe5, 0x30, 0x2d, 0x63, 0x81, 0xf0, 0xbb, 0x50, 0xa4,
+  0xd9, 0x10, 0x8c, 0x81, 0x0c, 0xf8, 0xa1, 0xe5, 0x1a, 0xad, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00,
+  0xf7, 0x01, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x6a, 0x05, 0x00, 0x00,
+  0x8c, 0xc1, 0x00, 0x00, 0x54, 0xfd, 0x00, 0x00, 0xca, 0x0d, 0x00, 0x00,
+  0x62, 0x22, 0x00, 0x00, 0xc0, 0x13, 0x00, 0x00, 0xd5, 0x0e, 0x00, 0x00,
+  0xe5, 0x03, 0x00, 0x00, 0xd7, 0xff, 0xff, 0xff, 0xf6, 0x10, 0x00, 0x00,
+  0xb6, 0xb5, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x5e, 0xad, 0x00, 0x00,
+  0x66, 0xad, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00,
+  0xf8, 0xff, 0x11, 0xfc, 0xed, 0x09, 0x03, 0x11, 0xf6, 0xf3, 0x03, 0x05,
+  0x08, 0xfd, 0x06, 0xfd, 0xea, 0xf0, 0x15, 0xfe, 0x0f, 0xfd, 0x05, 0xe5,
+  0x00, 0x07, 0xef, 0x51, 0xfb, 0x16, 0xeb, 0x00, 0xfa, 0xfe, 0xfb, 0xf4,
+  0x01, 0xf1, 0xfd, 0x0b, 0x02, 0x00, 0x02, 0xfb, 0xfe, 0xfc, 0x01, 0xfd,
+  0x00, 0xe6, 0x02, 0x06, 0x7f, 0xe9, 0x81, 0xec, 0x7f, 0x7f, 0x02, 0x05,
+  0x7f, 0xe5, 0xf5, 0xe8, 0x81, 0x7f, 0x7f, 0x00, 0xab, 0xa5, 0xf6, 0x9a,
+  0x0c, 0x97, 0x7f, 0x7f, 0x7a, 0x7f, 0x7f, 0x7f, 0x11, 0xf1, 0xf8, 0x03,
+  0xf4, 0x7f, 0x07, 0xf6, 0x00, 0xf4, 0x03, 0xfa, 0x0c, 0xf9, 0xea, 0xf2,
+  0x02, 0xfa, 0xfa, 0xea, 0xef, 0x10, 0x3a, 0x08, 0xf5, 0xf8, 0xfd, 0x04,
+  0x08, 0xfc, 0x01, 0xf3, 0x15, 0xe3, 0xf4, 0x81, 0x06, 0xf0, 0xf7, 0x7f,
+  0xfc, 0x02, 0xe7, 0xf6, 0xf6, 0xbd, 0xda, 0xdc, 0xff, 0x02, 0xf5, 0xfb,
+  0xfe, 0xfb, 0xf8, 0xff, 0x01, 0x02, 0xfb, 0x02, 0x06, 0xf5, 0xf8, 0xf2,
+  0x02, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x3b, 0x5e, 0x00, 0x00, 0x3c, 0xfd, 0xff, 0xff, 0x3a, 0x01, 0x00, 0x00,
+  0xb1, 0x0c, 0x00, 0x00, 0xd6, 0xfc, 0xff, 0xff, 0x26, 0x01, 0x00, 0x00,
+  0x9f, 0x23, 0x00, 0x00, 0x6d, 0x05, 0x00, 0x00, 0x35, 0xfc, 0xff, 0xff,
+  0xa3, 0x01, 0x00, 0x00, 0x36, 0xf8, 0xff, 0xff, 0xa0, 0x0d, 0x00, 0x00,
+  0xca, 0x03, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0xf2, 0xfe, 0xff, 0xff,
+  0x40, 0xfb, 0xff, 0xff, 0x4e, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x00, 0x00, 0x00, 0x08, 0xef, 0xe7, 0xb8, 0xdf, 0xd8, 0x1a, 0xea,
+  0x21, 0x09, 0xea, 0xf5, 0x73, 0x7f, 0xf3, 0xa1, 0x7f, 0xce, 0xd7, 0x07,
+  0xd1, 0x43, 0xc5, 0xd2, 0xd2, 0x49, 0xe8, 0xd3, 0xf4, 0x06, 0xd4, 0xfa,
+  0xde, 0x99, 0x31, 0x2b, 0x38, 0xbb, 0xa5, 0xe6, 0x23, 0x9e, 0x17, 0x81,
+  0x35, 0xea, 0xa8, 0x28, 0x1f, 0x0d, 0x1a, 0x01, 0xf3, 0x43, 0xcb, 0xf0,
+  0x7f, 0x32, 0x0f, 0x0c, 0x04, 0xee, 0x0a, 0x14, 0xb7, 0xde, 0xd8, 0x81,
+  0xf0, 0x34, 0x3b, 0x88, 0x23, 0xde, 0xd0, 0xd7, 0x94, 0x20, 0xe3, 0xf1,
+  0x52, 0x2c, 0x3d, 0xd7, 0x2c, 0xda, 0x81, 0x95, 0xf1, 0xbd, 0x3a, 0x2f,
+  0xd6, 0x34, 0x33, 0xdb, 0x5f, 0x29, 0x81, 0xbc, 0x14, 0xba, 0x0e, 0xb1,
+  0xe4, 0x18, 0x9e, 0x4b, 0x53, 0xac, 0x1c, 0x37, 0x81, 0xf8, 0x69, 0xd5,
+  0xc6, 0x02, 0x00, 0xc0, 0xcf, 0x3c, 0x55, 0xe7, 0x3a, 0xed, 0x0c, 0x21,
+  0xda, 0xae, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x5c, 0xd9, 0xff, 0xff, 0x8f, 0xf0, 0xff, 0xff, 0x68, 0x2f, 0x00, 0x00,
+  0x4e, 0xdd, 0xff, 0xff, 0x85, 0x53, 0x00, 0x00, 0xd8, 0x18, 0x00, 0x00,
+  0x96, 0xda, 0xff, 0xff, 0x5b, 0x31, 0x00, 0x00, 0x06, 0xaf, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xcc, 0x1d, 0x0e, 0xdc,
+  0xa9, 0xd1, 0x81, 0x0f, 0x42, 0xc2, 0xd6, 0xc8, 0x7f, 0xb5, 0x5f, 0x14,
+  0x8c, 0x7f, 0xc3, 0xa9, 0x26, 0xe8, 0xf7, 0x36, 0x4c, 0x0d, 0x5e, 0x26,
+  0x3c, 0x6e, 0x7f, 0xdf, 0xa1, 0x83, 0x4f, 0x05, 0xcb, 0x81, 0x08, 0xc0,
+  0x7f, 0xfd, 0x72, 0x48, 0x9c, 0xdb, 0xf7, 0xe5, 0x19, 0x22, 0x7f, 0xe6,
+  0x2d, 0xe7, 0xdc, 0x17, 0x25, 0x0b, 0x81, 0xe9, 0xc9, 0x69, 0x6e, 0xad,
+  0x0d, 0x4a, 0xfe, 0x1b, 0x22, 0x7f, 0x0e, 0x35, 0xd1, 0x5d, 0xa5, 0x56,
+  0x05, 0x81, 0x19, 0x6e, 0xf2, 0x81, 0xe9, 0xe2, 0xae, 0x93, 0xda, 0xa7,
+  0x81, 0xa5, 0x7a, 0x40, 0xf9, 0xb2, 0x6a, 0x43, 0xe5, 0x2c, 0x81, 0x3f,
+  0x21, 0xd6, 0xc6, 0x53, 0x6c, 0x81, 0x51, 0x67, 0xfe, 0x1a, 0x28, 0xbc,
+  0xdc, 0x68, 0xd7, 0xa2, 0xe9, 0x81, 0xe7, 0xbf, 0x07, 0x75, 0x1e, 0xec,
+  0x31, 0xcf, 0x7f, 0x96, 0x83, 0x81, 0xe8, 0x69, 0xd8, 0x25, 0xf8, 0x55,
+  0xd6, 0x9e, 0x81, 0x58, 0xcb, 0x74, 0xe3, 0x56, 0x94, 0xb3, 0xda, 0x3e,
+  0xfa, 0x39, 0xed, 0x7f, 0x38, 0x97, 0x61, 0x81, 0x0d, 0xab, 0x19, 0xd6,
+  0x09, 0x35, 0x11, 0x06, 0x3a, 0x7f, 0x42, 0xef, 0x1e, 0x77, 0x31, 0xdb,
+  0x26, 0xbd, 0x5f, 0x81, 0x36, 0x07, 0x5b, 0x09, 0x07, 0x7f, 0x1c, 0xd3,
+  0x96, 0xcc, 0x2c, 0xb7, 0x4b, 0x51, 0xc9, 0x81, 0x97, 0x9a, 0x3b, 0x96,
+  0x57, 0x7a, 0xce, 0x81, 0x7f, 0x15, 0xca, 0xea, 0x0f, 0x1d, 0xcc, 0xf4,
+  0xa6, 0xde, 0x81, 0xe2, 0xd8, 0xd2, 0xfc, 0xe8, 0x4e, 0x29, 0x00, 0xc2,
+  0x81, 0xe4, 0x61, 0x6d, 0x9f, 0xa7, 0x01, 0x40, 0xb5, 0x81, 0x18, 0xfb,
+  0x5e, 0x50, 0x22, 0x81, 0x13, 0xf9, 0xbb, 0xac, 0xa7, 0xb6, 0x2d, 0xbd,
+  0x46, 0x59, 0xdb, 0x81, 0x30, 0x22, 0xf5, 0x7f, 0x04, 0xaa, 0x07, 0x0e,
+  0xf6, 0x7f, 0xf1, 0x1f, 0x1c, 0x5e, 0xf0, 0x35, 0xfb, 0x7f, 0xaa, 0x1f,
+  0x1d, 0xf2, 0xe6, 0x0d, 0x81, 0x97, 0xe0, 0x6e, 0x01, 0x1f, 0x05, 0x6a,
+  0xc9, 0x7f, 0xd4, 0xfb, 0x49, 0x66, 0x3d, 0x42, 0x4c, 0x1c, 0x00, 0xc0,
+  0x85, 0xf1, 0x46, 0x7f, 0xb1, 0x79, 0x24, 0x14, 0x86, 0x7f, 0xf5, 0x9e,
+  0x2b, 0x2f, 0x3f, 0x00, 0x7f, 0x3a, 0x64, 0x1e, 0xe9, 0xcb, 0x20, 0xf5,
+  0x0d, 0x2c, 0xb5, 0x7f, 0x96, 0xbc, 0xc5, 0x71, 0xfd, 0x08, 0x13, 0x7f,
+  0x7f, 0x09, 0x49, 0x47, 0xc4, 0xf3, 0xf8, 0xff, 0xdb, 0x07, 0xbb, 0x81,
+  0x38, 0x9b, 0x10, 0x3f, 0x29, 0xfe, 0x54, 0x05, 0x24, 0x7f, 0x62, 0x06,
+  0xe2, 0xec, 0xca, 0x7f, 0x2a, 0x05, 0xcf, 0xe2, 0x25, 0x5f, 0x4b, 0xaa,
+  0x31, 0xc6, 0x1a, 0x81, 0xe6, 0x9a, 0xe4, 0x22, 0x0b, 0x2c, 0xc9, 0x7f,
+  0x06, 0x26, 0x48, 0x0d, 0x40, 0x55, 0x7f, 0xe1, 0x92, 0xb0, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00,
+  0xf7, 0xfd, 0xff, 0xff, 0xc6, 0xfd, 0xff, 0xff, 0x34, 0x04, 0x00, 0x00,
+  0xfa, 0x1d, 0x00, 0x00, 0x0f, 0x07, 0x00, 0x00, 0xde, 0xfe, 0xff, 0xff,
+  0x69, 0x0c, 0x00, 0x00, 0xa6, 0x04, 0x00, 0x00, 0xde, 0x04, 0x00, 0x00,
+  0x15, 0x00, 0x00, 0x00, 0x38, 0x09, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xf3, 0xfe, 0xff, 0xff, 0xa8, 0x02, 0x00, 0x00,
+  0x56, 0x09, 0x00, 0x00, 0x51, 0x25, 0x00, 0x00, 0x18, 0x09, 0x00, 0x00,
+  0xa5, 0xfe, 0xff, 0xff, 0xd5, 0x02, 0x00, 0x00, 0xf7, 0xfb, 0xff, 0xff,
+  0xf8, 0xff, 0xff, 0xff, 0xa7, 0x0c, 0x00, 0x00, 0x77, 0xfe, 0xff, 0xff,
+  0xca, 0xfc, 0xff, 0xff, 0x41, 0x03, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x85, 0x11, 0x00, 0x00, 0x74, 0x38, 0x00, 0x00, 0x5f, 0x0b, 0x00, 0x00,
+  0xc0, 0xff, 0xff, 0xff, 0x4b, 0x01, 0x00, 0x00, 0x43, 0xff, 0xff, 0xff,
+  0x18, 0x0a, 0x00, 0x00, 0xca, 0xff, 0xff, 0xff, 0xf0, 0x01, 0x00, 0x00,
+  0xfd, 0xfe, 0xff, 0xff, 0x9a, 0x02, 0x00, 0x00, 0xe2, 0x02, 0x00, 0x00,
+  0x89, 0x05, 0x00, 0x00, 0x3c, 0x06, 0x00, 0x00, 0x2b, 0x01, 0x00, 0x00,
+  0x3f, 0xff, 0xff, 0xff, 0xa7, 0x01, 0x00, 0x00, 0xbd, 0x04, 0x00, 0x00,
+  0x9c, 0x03, 0x00, 0x00, 0xb3, 0xff, 0xff, 0xff, 0x5e, 0xb1, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0xde, 0x9c, 0xf4, 0xc1,
+  0x7f, 0xbd, 0x4f, 0xbf, 0xa4, 0xc2, 0x03, 0xd2, 0x5e, 0x45, 0x52, 0x93,
+  0x38, 0xdb, 0xfc, 0xe6, 0x95, 0x65, 0xef, 0xfc, 0x09, 0x2a, 0x43, 0xea,
+  0x57, 0xa9, 0x03, 0xcd, 0xb9, 0xa9, 0x43, 0x3d, 0x19, 0x61, 0x6e, 0xbe,
+  0xa1, 0xd4, 0x1b, 0x3f, 0x39, 0x9b, 0x4a, 0x68, 0xe8, 0x8b, 0xd9, 0x44,
+  0xb1, 0x75, 0x47, 0xa0, 0xa9, 0x1a, 0x64, 0x85, 0x7f, 0x55, 0x77, 0xab,
+  0xb0, 0xa0, 0x12, 0xd5, 0xc2, 0x7a, 0xb2, 0x4e, 0xbb, 0x2e, 0x68, 0x8f,
+  0x55, 0xc5, 0x02, 0x95, 0x98, 0x94, 0x5f, 0x7f, 0x67, 0x74, 0x7f, 0xb2,
+  0x97, 0xba, 0x3a, 0x47, 0x5e, 0x7f, 0x57, 0x49, 0x0e, 0xe6, 0xcc, 0x41,
+  0xdb, 0xee, 0x25, 0xfa, 0x6d, 0x39, 0x51, 0xb0, 0x2c, 0x2f, 0xe5, 0xee,
+  0xa8, 0xde, 0x1c, 0xdc, 0xee, 0x3b, 0xbe, 0xf1, 0xc7, 0x17, 0x20, 0xb7,
+  0x22, 0x48, 0x6f, 0xcd, 0xe6, 0xff, 0xf5, 0x49, 0x3b, 0x5f, 0x30, 0xf0,
+  0xe4, 0x68, 0x3f, 0x0f, 0x2c, 0x2a, 0x13, 0x95, 0xa0, 0xad, 0xf8, 0xa1,
+  0xc4, 0x92, 0x7f, 0x82, 0x81, 0x81, 0x7a, 0xbb, 0x3b, 0x55, 0x8b, 0xc2,
+  0x7f, 0x81, 0xcd, 0xb8, 0xb0, 0x69, 0xba, 0xf8, 0xfa, 0x67, 0x6a, 0xcf,
+  0x93, 0xa7, 0x04, 0xae, 0xc1, 0x85, 0x81, 0x46, 0x24, 0x7f, 0x0a, 0xc2,
+  0x4f, 0xf8, 0x41, 0x7f, 0x52, 0x75, 0x7c, 0xad, 0xa8, 0x81, 0xbe, 0x81,
+  0xe8, 0x7f, 0x7e, 0x81, 0x52, 0x42, 0x7f, 0x81, 0x4d, 0x7f, 0x33, 0x81,
+  0x2d, 0xbc, 0x8f, 0x81, 0x81, 0x7f, 0x81, 0x7f, 0x81, 0x7f, 0x7f, 0x81,
+  0x81, 0x7f, 0xef, 0x81, 0x81, 0x81, 0x4a, 0x79, 0x7f, 0x77, 0xf0, 0x81,
+  0x7f, 0x93, 0x7f, 0x6c, 0x7f, 0x03, 0x7f, 0x7f, 0xe6, 0xfc, 0x81, 0x6c,
+  0x37, 0xd9, 0x2c, 0xcf, 0x4e, 0x28, 0x12, 0xc9, 0x13, 0x36, 0x64, 0xac,
+  0xe7, 0x02, 0xfa, 0xbb, 0xb6, 0x1f, 0xd2, 0xf0, 0x92, 0x35, 0x1c, 0xa6,
+  0xd2, 0x2d, 0x7f, 0xb9, 0xa2, 0xf9, 0x55, 0x5f, 0x4a, 0x48, 0xd5, 0xbe,
+  0x35, 0x7f, 0x57, 0x12, 0x2d, 0xca, 0x20, 0x26, 0xac, 0xca, 0x13, 0x23,
+  0xc6, 0xd0, 0x3f, 0xe2, 0x16, 0xca, 0x1c, 0x1b, 0xe7, 0x2a, 0xcb, 0xda,
+  0xbc, 0xc8, 0x7f, 0xc3, 0xf4, 0x20, 0x9e, 0xf4, 0xfa, 0x2b, 0x4c, 0xd5,
+  0x03, 0x30, 0xfb, 0xd7, 0x18, 0x90, 0xd0, 0x24, 0x12, 0x11, 0xbb, 0xd9,
+  0x18, 0xff, 0x14, 0x51, 0x2d, 0x2d, 0x1b, 0xc0, 0x81, 0xb7, 0xd6, 0xb1,
+  0x44, 0x31, 0x41, 0xcd, 0x7a, 0x23, 0xcb, 0xf1, 0xeb, 0x2b, 0x81, 0xa7,
+  0x09, 0x04, 0x49, 0xa5, 0xbf, 0x28, 0xc6, 0x2b, 0xa1, 0x4e, 0x40, 0xaf,
+  0x00, 0xf5, 0xf3, 0xac, 0xbc, 0xce, 0xab, 0x60, 0x2d, 0x23, 0x8e, 0x89,
+  0x0a, 0xb7, 0x50, 0x4c, 0x3f, 0x8a, 0x2d, 0xfb, 0xe3, 0xdc, 0xd0, 0xd0,
+  0xf0, 0xf7, 0x35, 0xe1, 0xba, 0x20, 0xdb, 0xfb, 0x02, 0x03, 0x20, 0xdd,
+  0xf7, 0x10, 0x0a, 0xe1, 0xd9, 0x12, 0x0c, 0xf0, 0xb7, 0x28, 0xff, 0xdc,
+  0xef, 0xb8, 0x26, 0xf0, 0xa0, 0x0a, 0x10, 0x4a, 0x28, 0x11, 0xcd, 0xd0,
+  0xf2, 0x14, 0x1e, 0x10, 0x23, 0xe3, 0x13, 0x4a, 0x1a, 0xb3, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x89, 0x26, 0x00, 0x00,
+  0xb8, 0x13, 0x00, 0x00, 0x0e, 0x09, 0x00, 0x00, 0x23, 0x08, 0x00, 0x00,
+  0x26, 0x03, 0x00, 0x00, 0xd4, 0xfe, 0xff, 0xff, 0x16, 0xf8, 0xff, 0xff,
+  0x2d, 0x80, 0x00, 0x00, 0x82, 0xff, 0xff, 0xff, 0x95, 0xfc, 0xff, 0xff,
+  0x2f, 0x1d, 0x00, 0x00, 0x02, 0xca, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
+  0x75, 0x19, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff, 0x7a, 0x35, 0x00, 0x00,
+  0x06, 0x04, 0x00, 0x00, 0x89, 0x3e, 0x00, 0x00, 0x16, 0xfb, 0xff, 0xff,
+  0x8f, 0x26, 0x00, 0x00, 0x7e, 0x37, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x11, 0x13, 0x00, 0x00, 0x98, 0xe4, 0xff, 0xff, 0x27, 0x2d, 0x00, 0x00,
+  0xe7, 0x09, 0x00, 0x00, 0x9b, 0x0c, 0x00, 0x00, 0x63, 0x37, 0x00, 0x00,
+  0x81, 0x0c, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x0d, 0xdc, 0xff, 0xff,
+  0xff, 0x31, 0x00, 0x00, 0x1e, 0x16, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00,
+  0xac, 0xf5, 0xff, 0xff, 0x69, 0x2b, 0x00, 0x00, 0xd1, 0xd6, 0xff, 0xff,
+  0xe6, 0x15, 0x00, 0x00, 0x24, 0xfd, 0xff, 0xff, 0xa3, 0x4b, 0x00, 0x00,
+  0x96, 0xf2, 0xff, 0xff, 0x3e, 0x05, 0x00, 0x00, 0xb5, 0x03, 0x00, 0x00,
+  0x67, 0x08, 0x00, 0x00, 0x3f, 0x04, 0x00, 0x00, 0x95, 0xfb, 0xff, 0xff,
+  0x73, 0x02, 0x00, 0x00, 0x20, 0xf6, 0xff, 0xff, 0xe6, 0xb3, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xd6, 0x03, 0x1e, 0x06,
+  0xe3, 0xf2, 0x14, 0x04, 0xd4, 0xf5, 0xbf, 0xd2, 0xe7, 0xc0, 0xfe, 0xdb,
+  0x2b, 0xd3, 0x2a, 0x31, 0xed, 0x22, 0xf2, 0x08, 0x07, 0xdc, 0x2e, 0xf6,
+  0xff, 0xf2, 0x0e, 0x10, 0x4f, 0x20, 0x22, 0x81, 0x0f, 0x01, 0xf6, 0xe1,
+  0x05, 0xeb, 0x2a, 0x33, 0x20, 0xfd, 0x19, 0xfd, 0x09, 0x0e, 0x31, 0xe7,
+  0xfc, 0x27, 0xc5, 0xf2, 0xfa, 0x0a, 0xf1, 0xa2, 0x01, 0x5e, 0xe9, 0x3c,
+  0xe7, 0x0a, 0xeb, 0xc4, 0x0d, 0x9f, 0xd9, 0x0f, 0xbb, 0xf9, 0xf4, 0x81,
+  0xe3, 0xf5, 0x11, 0xa6, 0x25, 0x38, 0xd1, 0xf8, 0x7c, 0xe8, 0x08, 0x3d,
+  0xe2, 0x1c, 0xa8, 0xdd, 0x7a, 0xe9, 0xd9, 0xe0, 0x05, 0xe7, 0xc4, 0x13,
+  0xfe, 0x32, 0x10, 0x0a, 0x01, 0x2c, 0xed, 0x12, 0x45, 0xa9, 0x0e, 0xc0,
+  0x1f, 0xb2, 0x21, 0x21, 0xda, 0x2e, 0xd6, 0x19, 0xe2, 0x3a, 0xe8, 0xc0,
+  0x0a, 0xf8, 0x11, 0xbc, 0xaa, 0x9e, 0x21, 0xf2, 0x61, 0x17, 0xf5, 0xc7,
+  0xfa, 0x21, 0x51, 0x22, 0x7f, 0x13, 0x13, 0x1e, 0xea, 0x19, 0xbf, 0x31,
+  0x15, 0xd9, 0xbb, 0x9d, 0x16, 0xf4, 0xef, 0x0c, 0x03, 0x10, 0x1c, 0x4b,
+  0xf0, 0x05, 0xe9, 0x0d, 0x17, 0x96, 0x24, 0xcf, 0xba, 0xf1, 0x7f, 0xf4,
+  0xe3, 0x00, 0xc2, 0x0d, 0x0a, 0xa5, 0xfe, 0xf2, 0xf3, 0xdd, 0xf6, 0x65,
+  0xd7, 0xdb, 0x04, 0x0c, 0x22, 0x0f, 0xd3, 0x30, 0xe7, 0xc8, 0xfe, 0x0e,
+  0x23, 0xe1, 0xf8, 0xfb, 0x24, 0xda, 0x3f, 0xb5, 0x02, 0x17, 0x0c, 0x19,
+  0xf1, 0xe6, 0x16, 0xf4, 0xfa, 0xcd, 0xfc, 0xea, 0x10, 0xfb, 0x24, 0x22,
+  0x26, 0x10, 0xe9, 0x22, 0xf4, 0xfa, 0xfa, 0x0a, 0xbf, 0x64, 0x2a, 0xda,
+  0x1b, 0xe2, 0xea, 0xf2, 0xb4, 0x09, 0x7f, 0x14, 0x43, 0x06, 0xf8, 0x10,
+  0x15, 0xd5, 0x1c, 0x81, 0x24, 0xe2, 0xf0, 0x62, 0xa9, 0x53, 0x1d, 0xb0,
+  0x02, 0xae, 0x21, 0x12, 0xc5, 0x44, 0xbf, 0xd2, 0xca, 0x58, 0xe5, 0x19,
+  0xe2, 0x34, 0xd3, 0xea, 0xf6, 0x2d, 0x13, 0xff, 0xca, 0xe9, 0xd5, 0xd0,
+  0x0a, 0xde, 0xcd, 0xfe, 0xd6, 0x2e, 0x5d, 0x13, 0x2d, 0xd6, 0x13, 0xf4,
+  0xda, 0xe9, 0xde, 0x1a, 0xd9, 0x01, 0xd5, 0x7f, 0xd0, 0xd6, 0xf3, 0x3d,
+  0x05, 0x3b, 0x14, 0x24, 0x21, 0xa5, 0xf1, 0x10, 0x15, 0x21, 0xbf, 0x01,
+  0x0a, 0xd3, 0x11, 0x28, 0xff, 0x09, 0xe9, 0xff, 0x08, 0x10, 0x07, 0xf3,
+  0xee, 0xf1, 0x28, 0x3c, 0xf7, 0xdd, 0x4e, 0xf6, 0xf2, 0xfd, 0xe8, 0x41,
+  0x1e, 0x24, 0x03, 0x1b, 0x19, 0xf5, 0x4c, 0xf7, 0x6d, 0x61, 0x3a, 0x3a,
+  0x37, 0x26, 0xf8, 0xe8, 0x28, 0xee, 0xb5, 0xf4, 0x05, 0x0f, 0xe9, 0x34,
+  0x18, 0xe7, 0xed, 0xf1, 0x11, 0xf0, 0x1a, 0xa7, 0xcc, 0x1f, 0x25, 0x37,
+  0xec, 0x22, 0x56, 0x7f, 0xcd, 0xe1, 0x9d, 0x2a, 0x72, 0xb5, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1b, 0x26, 0x00, 0x00,
+  0x31, 0x42, 0x00, 0x00, 0x2f, 0xf6, 0xff, 0xff, 0x5b, 0x0d, 0x00, 0x00,
+  0xca, 0xf7, 0xff, 0xff, 0x29, 0x10, 0x00, 0x00, 0x02, 0xda, 0xff, 0xff,
+  0xbc, 0xbb, 0xff, 0xff, 0x9e, 0xb5, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0x2b, 0x7f, 0xa5, 0xa8, 0xfb, 0x5c, 0x0a, 0x2f,
+  0x45, 0x9a, 0x01, 0x81, 0xcd, 0x49, 0xa8, 0xd7, 0xd4, 0x7f, 0x74, 0x2e,
+  0x7a, 0xfa, 0x3d, 0x1c, 0x4e, 0x14, 0xb5, 0x23, 0xed, 0xb1, 0x81, 0xef,
+  0xd7, 0x2c, 0x03, 0xc2, 0xa9, 0x76, 0x7f, 0x1e, 0x14, 0x63, 0x81, 0xc6,
+  0x32, 0x41, 0x0d, 0xef, 0xff, 0x68, 0x26, 0x41, 0x7f, 0x10, 0x3e, 0xc8,
+  0x75, 0xf0, 0xdc, 0x1d, 0x4c, 0xe8, 0x7f, 0xfd, 0x28, 0x7f, 0x3a, 0x6f,
+  0x58, 0x4b, 0x67, 0xc1, 0x1e, 0x5d, 0x81, 0xdb, 0x08, 0x49, 0xe8, 0x42,
+  0xb7, 0xb9, 0x2f, 0xbd, 0x0f, 0xed, 0xa3, 0x7f, 0xf2, 0x81, 0xa1, 0xd9,
+  0x12, 0x06, 0x1c, 0xfa, 0xd7, 0x9c, 0x8c, 0xd1, 0x81, 0x24, 0x92, 0x12,
+  0xfa, 0x1b, 0x99, 0x77, 0x81, 0xd8, 0xfb, 0xfa, 0xcf, 0xd0, 0x81, 0x04,
+  0x2b, 0xfb, 0x07, 0xb3, 0x27, 0x81, 0x90, 0x01, 0xba, 0xe3, 0xb8, 0xfa,
+  0x7f, 0xb7, 0xe4, 0x3f, 0xa2, 0x1a, 0x1f, 0x5e, 0xdc, 0x69, 0x7f, 0xeb,
+  0xd7, 0xe7, 0xf1, 0xe9, 0xf1, 0x81, 0x2b, 0x57, 0xf9, 0xd2, 0x37, 0xda,
+  0x7f, 0xc9, 0xbc, 0x1c, 0x9c, 0xf9, 0x1f, 0x5e, 0xe0, 0x81, 0x5c, 0x54,
+  0xe5, 0xa8, 0xf9, 0xba, 0x15, 0xc0, 0xcc, 0xdf, 0x7f, 0xe4, 0x1a, 0x18,
+  0x81, 0x1c, 0xb4, 0x2d, 0x20, 0x21, 0x9a, 0x97, 0xc9, 0xc3, 0x17, 0xe6,
+  0x93, 0x7f, 0x52, 0xe2, 0xfb, 0x1b, 0xf4, 0xcd, 0xde, 0x7f, 0x4c, 0x16,
+  0xf6, 0x81, 0xad, 0xd3, 0x81, 0xe2, 0xcc, 0xab, 0x12, 0x42, 0x08, 0x7f,
+  0xc0, 0x28, 0xb9, 0xf7, 0x13, 0xa2, 0x22, 0x42, 0x11, 0xdd, 0xf6, 0x81,
+  0x0e, 0x42, 0x13, 0x1a, 0x7f, 0x01, 0x26, 0xd5, 0x72, 0x10, 0xb8, 0xfa,
+  0x03, 0x81, 0x8f, 0xfb, 0x14, 0x05, 0x1d, 0x81, 0x1d, 0xd5, 0x09, 0xf2,
+  0x22, 0xb7, 0x0b, 0x45, 0xe6, 0x10, 0x0e, 0x7f, 0x8e, 0xea, 0x38, 0xb1,
+  0xd1, 0x7f, 0x5c, 0x5c, 0xce, 0x23, 0x31, 0xe4, 0x1c, 0x7f, 0xa8, 0x49,
+  0x1e, 0x7f, 0xc8, 0xe9, 0x0f, 0x26, 0xbb, 0x39, 0x21, 0x81, 0x23, 0x39,
+  0xdd, 0xce, 0x12, 0xc9, 0xed, 0xdb, 0xa6, 0xfe, 0x81, 0xb7, 0xfe, 0x30,
+  0xdb, 0x81, 0x35, 0x5b, 0xae, 0xa9, 0xea, 0xad, 0xc4, 0x1b, 0x34, 0xd1,
+  0x81, 0xae, 0xc1, 0x44, 0x60, 0x92, 0x0b, 0x7f, 0xea, 0x86, 0xfa, 0xa3,
+  0xfb, 0x47, 0x06, 0x51, 0x81, 0xf5, 0xbd, 0x03, 0x7f, 0x79, 0xab, 0x9f,
+  0x21, 0x34, 0xed, 0x12, 0x16, 0xd2, 0xe8, 0x00, 0x7f, 0xff, 0x21, 0xf0,
+  0x75, 0x2f, 0x4f, 0x11, 0xa6, 0xec, 0x38, 0x7f, 0x56, 0x35, 0xfb, 0x33,
+  0x7a, 0x81, 0x97, 0x11, 0x15, 0x05, 0x21, 0x2b, 0x49, 0x81, 0x11, 0x9c,
+  0x21, 0xdc, 0xf2, 0x7f, 0x24, 0x2f, 0x18, 0x37, 0x96, 0x81, 0x4b, 0x14,
+  0xc2, 0x2e, 0x48, 0xb2, 0x2a, 0xb7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x64, 0x09, 0x00, 0x00, 0x56, 0x18, 0x00, 0x00,
+  0xc9, 0x3a, 0x00, 0x00, 0x35, 0x02, 0x00, 0x00, 0xf7, 0x06, 0x00, 0x00,
+  0x18, 0xfb, 0xff, 0xff, 0xb6, 0x14, 0x00, 0x00, 0x7b, 0x2c, 0x00, 0x00,
+  0x5a, 0x0a, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0x80, 0x08, 0x00, 0x00,
+  0xe9, 0xf8, 0xff, 0xff, 0xf6, 0x26, 0x00, 0x00, 0x3f, 0xfd, 0xff, 0xff,
+  0xfa, 0x04, 0x00, 0x00, 0xf3, 0x3a, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff,
+  0x4b, 0x05, 0x00, 0x00, 0xaf, 0x02, 0x00, 0x00, 0xdf, 0x08, 0x00, 0x00,
+  0x18, 0x11, 0x00, 0x00, 0xd1, 0x07, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00,
+  0x8d, 0x23, 0x00, 0x00, 0x4a, 0x0f, 0x00, 0x00, 0x4a, 0x10, 0x00, 0x00,
+  0xf0, 0x11, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0xb4, 0x0f, 0x00, 0x00,
+  0x27, 0x13, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00,
+  0xaa, 0x01, 0x00, 0x00, 0x5f, 0x03, 0x00, 0x00, 0x33, 0xfe, 0xff, 0xff,
+  0x65, 0x00, 0x00, 0x00, 0xe8, 0xf7, 0xff, 0xff, 0x7c, 0xff, 0xff, 0xff,
+  0x20, 0x09, 0x00, 0x00, 0x39, 0x08, 0x00, 0x00, 0x14, 0x3f, 0x00, 0x00,
+  0x70, 0x0c, 0x00, 0x00, 0xe7, 0x0b, 0x00, 0x00, 0x79, 0x11, 0x00, 0x00,
+  0x4a, 0x0d, 0x00, 0x00, 0xd8, 0x0d, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00,
+  0xeb, 0x10, 0x00, 0x00, 0xf6, 0xb7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0xb0, 0x01, 0x00, 0x00, 0x02, 0x92, 0x0a, 0x06, 0xd0, 0xe4, 0xe9, 0x45,
+  0xde, 0x0d, 0xc7, 0x0f, 0x47, 0x5d, 0x0c, 0x13, 0x50, 0x0f, 0x44, 0x09,
+  0x23, 0xf8, 0xc5, 0x0e, 0xf5, 0x01, 0xf4, 0xf9, 0xd8, 0x54, 0xff, 0x81,
+  0x38, 0xfd, 0xc5, 0xd0, 0xde, 0xd9, 0x15, 0x0e, 0xe2, 0x70, 0x14, 0xec,
+  0xed, 0x66, 0x76, 0xe4, 0x81, 0x81, 0xea, 0x7f, 0xa5, 0x2a, 0xaa, 0x7f,
+  0x0b, 0x23, 0xc6, 0xf1, 0x38, 0x6d, 0x1f, 0xe6, 0xed, 0x39, 0x24, 0x1e,
+  0x11, 0x7f, 0x18, 0x7f, 0x7f, 0xe1, 0xc1, 0x20, 0x4e, 0x81, 0x0e, 0xb3,
+  0x22, 0xf0, 0xb8, 0x81, 0x0a, 0x1f, 0xc2, 0xd9, 0x81, 0x02, 0xb9, 0x81,
+  0x17, 0x75, 0x60, 0x7f, 0x02, 0x92, 0x09, 0xfb, 0xd6, 0x30, 0x18, 0x3f,
+  0xec, 0xd8, 0xde, 0x09, 0xf0, 0x44, 0x19, 0x0c, 0xda, 0x15, 0xad, 0xf2,
+  0x07, 0xd3, 0x7f, 0x0a, 0xce, 0x0e, 0x00, 0x41, 0x21, 0x26, 0x0e, 0x07,
+  0x11, 0xf9, 0xe9, 0x3c, 0x10, 0x35, 0x08, 0x31, 0x11, 0x08, 0x1a, 0xf8,
+  0xf6, 0x46, 0xd7, 0xd3, 0xea, 0x22, 0xef, 0x0c, 0x13, 0xa9, 0x7f, 0xc5,
+  0xff, 0x06, 0xf6, 0x24, 0x7f, 0x41, 0x0c, 0xe2, 0xee, 0xee, 0x26, 0x15,
+  0x71, 0xcd, 0x32, 0x08, 0xb0, 0x7f, 0xa6, 0xeb, 0x7f, 0xa9, 0x00, 0xca,
+  0xe4, 0x14, 0xb9, 0x15, 0xfa, 0xa4, 0xd7, 0x06, 0x64, 0x7f, 0x16, 0x8f,
+  0xc8, 0xb6, 0xdd, 0x6a, 0x66, 0xdc, 0x7f, 0x17, 0x7f, 0x19, 0xc9, 0xe7,
+  0x2e, 0x7f, 0x7f, 0x81, 0x9d, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x5e, 0x7f,
+  0x7f, 0x50, 0x00, 0xf7, 0x77, 0x92, 0x81, 0x4c, 0x23, 0x75, 0x7f, 0xfc,
+  0x81, 0x7f, 0x7f, 0x73, 0x81, 0x7f, 0x81, 0x81, 0x20, 0x19, 0x81, 0xd9,
+  0x7f, 0x81, 0xd2, 0x70, 0x0e, 0x58, 0xe0, 0x03, 0xc1, 0x7f, 0x97, 0x52,
+  0x2f, 0x9f, 0x06, 0x34, 0xd0, 0x36, 0x05, 0xbe, 0x1b, 0x03, 0x81, 0x10,
+  0x11, 0x9c, 0xd2, 0xf8, 0x60, 0xe6, 0xef, 0x7f, 0xbd, 0xdf, 0xff, 0xe2,
+  0xe9, 0x10, 0x62, 0xe2, 0x29, 0x04, 0xff, 0xae, 0x5d, 0x08, 0x21, 0x3e,
+  0xcf, 0x6c, 0x7f, 0x9d, 0x01, 0xf3, 0x01, 0xe0, 0x1c, 0xc2, 0xff, 0x04,
+  0x1e, 0x1d, 0xff, 0x14, 0xf6, 0x20, 0x17, 0xf9, 0xd9, 0xf1, 0x05, 0xce,
+  0x10, 0x28, 0x74, 0xed, 0xa2, 0x02, 0x22, 0xdb, 0x03, 0x04, 0x10, 0x0a,
+  0x24, 0x09, 0xc7, 0x0e, 0xfc, 0xd6, 0xe9, 0x2b, 0xec, 0xee, 0x0f, 0x0e,
+  0xde, 0x08, 0x10, 0x31, 0x24, 0xf3, 0xd6, 0xe2, 0x30, 0x13, 0x6f, 0xc1,
+  0x7f, 0xd2, 0x00, 0xff, 0xb7, 0x02, 0xdd, 0xa6, 0xec, 0x3e, 0xf6, 0x21,
+  0xfa, 0x3a, 0xf1, 0xd3, 0xb1, 0x2f, 0x43, 0xf0, 0x9f, 0x04, 0xfd, 0xf6,
+  0x09, 0x0a, 0xdf, 0xf7, 0x3e, 0xce, 0xe0, 0x72, 0x9f, 0xbd, 0xd6, 0x1b,
+  0x15, 0x3c, 0x2c, 0x92, 0xfa, 0xf2, 0xff, 0xe9, 0xf2, 0x06, 0xf6, 0xd3,
+  0xfa, 0xd8, 0x07, 0x16, 0x0c, 0x13, 0xf0, 0x05, 0x2f, 0x0b, 0xe5, 0xfc,
+  0x0a, 0x25, 0xcb, 0xe8, 0x21, 0xd7, 0x14, 0xe9, 0xe4, 0xf9, 0x01, 0x12,
+  0x27, 0xf8, 0xec, 0xda, 0x08, 0x0f, 0x0f, 0x19, 0xf3, 0xb9, 0xfc, 0x03,
+  0xec, 0x1f, 0x7b, 0xd0, 0xb2, 0xb9, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0xc0, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0xff, 0x9c, 0x30, 0x00, 0x00,
+  0xb2, 0xfd, 0xff, 0xff, 0x09, 0xfb, 0xff, 0xff, 0x37, 0x0d, 0x00, 0x00,
+  0x84, 0xfa, 0xff, 0xff, 0xa4, 0x02, 0x00, 0x00, 0xb2, 0xe9, 0xff, 0xff,
+  0x40, 0xf1, 0xff, 0xff, 0xb7, 0xfd, 0xff, 0xff, 0xee, 0x00, 0x00, 0x00,
+  0x50, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x2e, 0xeb, 0xff, 0xff,
+  0x9f, 0xed, 0xff, 0xff, 0xf4, 0x11, 0x00, 0x00, 0x5a, 0x1b, 0x00, 0x00,
+  0x18, 0x0b, 0x00, 0x00, 0x75, 0x00, 0x00, 0x00, 0x17, 0xed, 0xff, 0xff,
+  0x0d, 0xd0, 0xff, 0xff, 0x5c, 0xf1, 0xff, 0xff, 0xa7, 0x56, 0x00, 0x00,
+  0xa7, 0xfb, 0xff, 0xff, 0xce, 0xf5, 0xff, 0xff, 0x9f, 0xfe, 0xff, 0xff,
+  0xab, 0x17, 0x00, 0x00, 0x23, 0xe6, 0xff, 0xff, 0x0f, 0xf9, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x17, 0xe1, 0xff, 0xff, 0x2e, 0x1f, 0x00, 0x00,
+  0x18, 0x08, 0x00, 0x00, 0x7b, 0xfd, 0xff, 0xff, 0x59, 0x0e, 0x00, 0x00,
+  0x29, 0x03, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0xd6, 0xfb, 0xff, 0xff,
+  0xed, 0x2b, 0x00, 0x00, 0x53, 0xfd, 0xff, 0xff, 0xef, 0x14, 0x00, 0x00,
+  0x3a, 0xfb, 0xff, 0xff, 0xe1, 0x09, 0x00, 0x00, 0xcf, 0x19, 0x00, 0x00,
+  0xe1, 0x00, 0x00, 0x00, 0x16, 0x1d, 0x00, 0x00, 0x88, 0xfb, 0xff, 0xff,
+  0xa4, 0xf8, 0xff, 0xff, 0x7e, 0xba, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0xd7, 0xcc, 0x06, 0x96, 0x11, 0xf5, 0x5f, 0x4c,
+  0xa1, 0xa2, 0x06, 0x21, 0xc4, 0x02, 0xc6, 0x1a, 0xb6, 0x10, 0x00, 0x79,
+  0x4b, 0xe8, 0x01, 0x7f, 0x54, 0x22, 0x1b, 0x24, 0xa2, 0xbf, 0xbe, 0xe4,
+  0xcc, 0x6c, 0x2b, 0xda, 0x14, 0xe8, 0x5e, 0xfc, 0x1d, 0x06, 0xea, 0xaa,
+  0x09, 0xd4, 0xe4, 0xc0, 0xfe, 0x44, 0xe1, 0xb7, 0x98, 0x3c, 0xe2, 0xb3,
+  0xd7, 0x36, 0xdb, 0xff, 0x25, 0x27, 0xbb, 0x00, 0xf4, 0x81, 0x58, 0xc6,
+  0x7d, 0x1a, 0xc3, 0x19, 0x3b, 0xf4, 0xae, 0x46, 0x1b, 0xf1, 0x45, 0x20,
+  0xc7, 0xf6, 0x09, 0x0d, 0x03, 0x5b, 0xea, 0xd6, 0x44, 0x28, 0xec, 0x1d,
+  0x7e, 0xf0, 0xe2, 0x35, 0xfc, 0xe9, 0x76, 0xfd, 0x57, 0xd5, 0x05, 0x05,
+  0xcf, 0x09, 0xe8, 0x2c, 0xf0, 0xcb, 0xd9, 0x81, 0xd2, 0x96, 0xef, 0x14,
+  0x89, 0x1e, 0xe3, 0xd0, 0xc7, 0x24, 0xff, 0xd2, 0xe7, 0x02, 0xe5, 0xe9,
+  0xea, 0xf8, 0x0c, 0x0d, 0x23, 0xe3, 0xca, 0x0a, 0x35, 0xd8, 0x1b, 0xd7,
+  0xe6, 0xd2, 0xc2, 0xb9, 0x3a, 0x23, 0x34, 0x0b, 0x0e, 0xcc, 0xf2, 0x22,
+  0xb5, 0xd4, 0x12, 0xee, 0x94, 0x48, 0xed, 0x21, 0x35, 0x0e, 0xd8, 0x07,
+  0xac, 0xcd, 0x7f, 0xd3, 0xec, 0xee, 0xc8, 0xc7, 0x95, 0x52, 0x5f, 0xb9,
+  0xf1, 0x82, 0xfd, 0x32, 0x20, 0xa3, 0xe4, 0x51, 0xaf, 0xa5, 0x0c, 0xfe,
+  0xb0, 0xfa, 0x35, 0xf0, 0x18, 0xee, 0x5d, 0xe8, 0x0c, 0x00, 0xfc, 0x09,
+  0xbd, 0xe8, 0xf5, 0xf2, 0x21, 0xbd, 0x2d, 0xa1, 0x2e, 0x33, 0xf0, 0xd9,
+  0x10, 0x27, 0x1c, 0x01, 0x06, 0xec, 0x53, 0xe9, 0x26, 0x23, 0x81, 0xee,
+  0xd5, 0xf8, 0x19, 0x08, 0x2c, 0xf0, 0x25, 0x07, 0xd4, 0xf3, 0xa0, 0x2a,
+  0xf2, 0xa2, 0x09, 0x27, 0x0e, 0xca, 0x27, 0x2d, 0x17, 0x27, 0x20, 0x29,
+  0xb7, 0x08, 0xe0, 0x30, 0x2e, 0xe8, 0x05, 0xd7, 0x4a, 0x44, 0x15, 0xe6,
+  0x41, 0xb1, 0x7f, 0xa1, 0xe4, 0x39, 0x07, 0x24, 0x0b, 0x0d, 0xdc, 0xd6,
+  0xf5, 0xcf, 0xce, 0xfb, 0x25, 0x16, 0x3c, 0x07, 0xa7, 0x25, 0x24, 0x19,
+  0x1c, 0xff, 0x57, 0xfb, 0xc8, 0x2a, 0xa0, 0x55, 0x29, 0x1d, 0x0e, 0x0e,
+  0xf2, 0x09, 0x2e, 0xa7, 0x9e, 0xda, 0xe2, 0x23, 0xa2, 0x19, 0x09, 0x46,
+  0x11, 0x27, 0xce, 0xbf, 0xe3, 0xf6, 0x12, 0x29, 0xec, 0xef, 0xd8, 0x06,
+  0x1a, 0x39, 0xf3, 0xea, 0x04, 0x0e, 0x48, 0x04, 0x3f, 0x3c, 0xc0, 0xc1,
+  0xfe, 0x7f, 0xe0, 0xc4, 0x1b, 0x47, 0xbc, 0x23, 0xf8, 0x24, 0x70, 0x5a,
+  0x2b, 0x3a, 0x81, 0x11, 0xcc, 0x08, 0xc0, 0xce, 0x09, 0x37, 0x76, 0x5c,
+  0x6a, 0x05, 0x5b, 0x0e, 0x76, 0x53, 0xd3, 0x5d, 0xce, 0x19, 0x0d, 0xaa,
+  0x24, 0xbc, 0xf2, 0x2b, 0x15, 0x48, 0xc2, 0x2d, 0xb7, 0x17, 0x0a, 0xa6,
+  0x43, 0xd9, 0x34, 0xf5, 0x0a, 0xbc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x4a, 0x13, 0x00, 0x00,
+  0x13, 0x56, 0x00, 0x00, 0x1d, 0x04, 0x00, 0x00, 0x8d, 0x04, 0x00, 0x00,
+  0xc7, 0xd3, 0xff, 0xff, 0xae, 0xf9, 0xff, 0xff, 0xd4, 0xdb, 0xff, 0xff,
+  0x36, 0xbc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0x49, 0x2b, 0x7f, 0xf6, 0x41, 0x6c, 0xad, 0xbd, 0x0c, 0x9c, 0x81, 0x07,
+  0x2b, 0x23, 0x31, 0xf9, 0x81, 0x06, 0xd7, 0xe8, 0x2a, 0x18, 0xbd, 0xd6,
+  0x21, 0x51, 0x7f, 0xd8, 0xeb, 0x82, 0xc7, 0xe2, 0x81, 0x14, 0xde, 0xec,
+  0x34, 0x12, 0xe2, 0xda, 0x9a, 0x0f, 0xbb, 0xfb, 0x13, 0x24, 0xae, 0x81,
+  0xca, 0x82, 0x81, 0x49, 0x61, 0xe3, 0x23, 0x21, 0xc1, 0x99, 0xaf, 0xbf,
+  0x81, 0xbf, 0x14, 0x47, 0x5b, 0x27, 0xfc, 0x07, 0x69, 0xad, 0x81, 0x11,
+  0xdf, 0x2f, 0xd9, 0x61, 0xd4, 0xe3, 0x7f, 0xd5, 0xe7, 0x7f, 0x11, 0x39,
+  0x75, 0xe0, 0x03, 0x37, 0xb0, 0xe2, 0xdf, 0xfd, 0xa4, 0x2e, 0x7f, 0xf8,
+  0x53, 0x1c, 0x81, 0x13, 0xfe, 0xd2, 0xb6, 0xec, 0x39, 0xf8, 0xc0, 0x02,
+  0xfa, 0x81, 0xe5, 0xfe, 0x16, 0x90, 0x58, 0x0b, 0x7f, 0xa7, 0xe3, 0xf7,
+  0xde, 0xdf, 0xf1, 0x7f, 0x2a, 0x33, 0xd2, 0x07, 0x5f, 0x26, 0xe4, 0x13,
+  0x35, 0xbe, 0x81, 0xee, 0x30, 0x7f, 0x3c, 0x4a, 0x24, 0x21, 0x1c, 0xa7,
+  0x0c, 0xe1, 0x23, 0x2e, 0x7f, 0xed, 0x0f, 0x0e, 0x16, 0x7f, 0x19, 0x0b,
+  0x83, 0x0a, 0xf6, 0xe0, 0xef, 0x2e, 0x36, 0x81, 0x18, 0x12, 0xdd, 0x68,
+  0xd4, 0x44, 0x1f, 0x8a, 0x23, 0x2e, 0xfd, 0x7f, 0xb8, 0xc1, 0xc7, 0x13,
+  0x85, 0x7f, 0x66, 0xec, 0x64, 0xf9, 0x81, 0x28, 0xf8, 0xe4, 0xbc, 0xd3,
+  0xd6, 0x2c, 0x16, 0x01, 0xd3, 0x3b, 0x81, 0x59, 0xa9, 0xd5, 0x81, 0x0c,
+  0xc8, 0xb3, 0x40, 0x4d, 0x4a, 0xf7, 0xdf, 0xd1, 0x6a, 0xe6, 0x7f, 0xcd,
+  0x7f, 0xc0, 0x18, 0x58, 0x10, 0x2c, 0xf2, 0x69, 0x34, 0x56, 0x1e, 0xef,
+  0x7f, 0xd4, 0x48, 0xc2, 0x07, 0xda, 0xe4, 0xa8, 0x8d, 0x1a, 0x7f, 0xca,
+  0x19, 0x8e, 0xb1, 0xbe, 0x81, 0xfb, 0x1a, 0xdd, 0x1a, 0x19, 0xf0, 0xe6,
+  0x81, 0x01, 0xd7, 0xee, 0x21, 0xc3, 0xcd, 0x3f, 0xfc, 0xaa, 0x7f, 0x97,
+  0x27, 0x7f, 0x2b, 0x47, 0x24, 0xe7, 0xfd, 0xda, 0x82, 0xef, 0x58, 0x06,
+  0xe7, 0x7f, 0x45, 0x28, 0x05, 0x72, 0x7f, 0xf9, 0xb8, 0x94, 0xac, 0x14,
+  0x90, 0x0d, 0x4c, 0x0c, 0x08, 0x7f, 0x34, 0x2e, 0xe9, 0xa4, 0xee, 0x9c,
+  0xc8, 0x81, 0x64, 0x24, 0x35, 0xd8, 0x67, 0xad, 0x39, 0x45, 0x81, 0x07,
+  0xfb, 0x6f, 0x81, 0xbd, 0xec, 0x40, 0xea, 0x7a, 0x35, 0xcf, 0x27, 0x2c,
+  0x0c, 0x02, 0x11, 0x7f, 0xd8, 0x7f, 0x60, 0x0e, 0xfb, 0x39, 0x9e, 0x0c,
+  0x2f, 0xc0, 0x81, 0xf8, 0xc0, 0x06, 0x06, 0xce, 0x01, 0xbc, 0x00, 0xac,
+  0x7f, 0xaf, 0x05, 0x2b, 0x26, 0x77, 0x7f, 0x15, 0xe7, 0x1c, 0x9d, 0x23,
+  0xc9, 0x2d, 0x13, 0x4e, 0x81, 0x2e, 0x88, 0x1c, 0xd4, 0xd5, 0x35, 0x1f,
+  0xa9, 0x81, 0x0b, 0x04, 0xd9, 0x37, 0x2b, 0xdc, 0x81, 0x2e, 0x05, 0x17,
+  0xc2, 0xbd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0x90, 0x05, 0x00, 0x00, 0x2c, 0xfc, 0xff, 0xff, 0x01, 0x03, 0x00, 0x00,
+  0xbe, 0xf9, 0xff, 0xff, 0x9a, 0x0d, 0x00, 0x00, 0x74, 0xfd, 0xff, 0xff,
+  0x6b, 0x10, 0x00, 0x00, 0x9c, 0xf4, 0xff, 0xff, 0x0e, 0x02, 0x00, 0x00,
+  0x08, 0x02, 0x00, 0x00, 0xca, 0x07, 0x00, 0x00, 0x15, 0x0f, 0x00, 0x00,
+  0x69, 0x01, 0x00, 0x00, 0x68, 0xfd, 0xff, 0xff, 0x6c, 0x05, 0x00, 0x00,
+  0xd2, 0x10, 0x00, 0x00, 0x0e, 0xf9, 0xff, 0xff, 0x73, 0x0c, 0x00, 0x00,
+  0xc9, 0x17, 0x00, 0x00, 0x76, 0x03, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  0xdc, 0x07, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0xdb, 0x0e, 0x00, 0x00,
+  0xc3, 0x05, 0x00, 0x00, 0x55, 0x05, 0x00, 0x00, 0x23, 0x04, 0x00, 0x00,
+  0xfb, 0xfa, 0xff, 0xff, 0xcb, 0x63, 0x00, 0x00, 0xb6, 0xff, 0xff, 0xff,
+  0x28, 0x06, 0x00, 0x00, 0xef, 0xf8, 0xff, 0xff, 0x85, 0xfd, 0xff, 0xff,
+  0x40, 0x10, 0x00, 0x00, 0xcd, 0xff, 0xff, 0xff, 0x4a, 0x0a, 0x00, 0x00,
+  0x05, 0x0a, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff,
+  0xf4, 0x15, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00, 0x67, 0x1e, 0x00, 0x00,
+  0x3e, 0xf3, 0xff, 0xff, 0xdb, 0x02, 0x00, 0x00, 0x54, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x07, 0x00, 0x00, 0xae, 0x0a, 0x00, 0x00,
+  0x8e, 0xbe, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00,
+  0x87, 0x75, 0x81, 0x50, 0x81, 0x59, 0xd2, 0x39, 0x81, 0xa8, 0x5e, 0xb2,
+  0x74, 0xb5, 0xf4, 0xa9, 0x4b, 0x4a, 0x50, 0xa3, 0x77, 0x81, 0x67, 0xb2,
+  0x97, 0xa0, 0x59, 0x7d, 0xae, 0xfe, 0x82, 0x43, 0x4b, 0xa7, 0x53, 0x94,
+  0x85, 0xb3, 0x55, 0x93, 0xdb, 0x99, 0x7f, 0xb0, 0x57, 0x33, 0xb0, 0xb1,
+  0x81, 0x7f, 0xb7, 0x4f, 0xb2, 0x70, 0xd6, 0x5e, 0x99, 0x81, 0x7f, 0x8f,
+  0x7f, 0x8c, 0xdc, 0x9e, 0x4c, 0x61, 0x7f, 0x81, 0x7f, 0xa2, 0x6a, 0xab,
+  0x81, 0x90, 0x59, 0x7f, 0x2d, 0xf1, 0x81, 0x7f, 0x5f, 0x81, 0x59, 0x81,
+  0x85, 0x8d, 0x63, 0x81, 0x81, 0x46, 0x7d, 0x9c, 0xd6, 0x5b, 0x81, 0x81,
+  0xf4, 0x68, 0xe0, 0x0c, 0xf2, 0x4c, 0xed, 0x1d, 0xb8, 0xc1, 0x4e, 0xd4,
+  0x37, 0xb0, 0x00, 0xd1, 0x02, 0x3a, 0x40, 0xe2, 0x4f, 0xae, 0x44, 0xda,
+  0xb5, 0xe2, 0x1d, 0x50, 0x70, 0x19, 0x98, 0x4a, 0x2c, 0xbc, 0x2a, 0xef,
+  0xd3, 0xc1, 0x2d, 0xb1, 0x85, 0xd6, 0x42, 0xfc, 0xa8, 0x16, 0xb4, 0xa0,
+  0x9c, 0x37, 0xbb, 0x71, 0xa6, 0x7f, 0x81, 0x73, 0xa2, 0xa4, 0x4f, 0xab,
+  0x6a, 0xaf, 0xa7, 0x93, 0x70, 0x66, 0xe4, 0x9f, 0x4e, 0xb1, 0x6d, 0xa5,
+  0xc4, 0x9d, 0x5f, 0x6d, 0x81, 0xc0, 0x9f, 0x56, 0x6a, 0x19, 0x6a, 0x92,
+  0x9a, 0x82, 0x6e, 0x99, 0x9c, 0x81, 0x6b, 0x92, 0x7f, 0x50, 0xaf, 0xb2,
+  0x87, 0x61, 0xae, 0x7f, 0x9b, 0x7c, 0x86, 0x7f, 0xb9, 0x81, 0x6e, 0x81,
+  0x7f, 0x9a, 0x81, 0x81, 0x7f, 0x7f, 0xee, 0x90, 0x4c, 0xc1, 0x7f, 0x81,
+  0xc4, 0x81, 0x7f, 0x76, 0x28, 0xbe, 0x9c, 0x60, 0x7f, 0x19, 0x7f, 0xad,
+  0x81, 0x81, 0x7f, 0x93, 0x88, 0x53, 0x7a, 0x97, 0xc1, 0x7f, 0xaf, 0x9a,
+  0xcf, 0x4b, 0x90, 0x22, 0xc3, 0x27, 0xc3, 0x54, 0xeb, 0xc6, 0x51, 0xa5,
+  0x2b, 0x94, 0x9b, 0xe7, 0x29, 0x3b, 0xe3, 0xd4, 0x24, 0xdb, 0x66, 0xe2,
+  0xe7, 0xd6, 0x27, 0x67, 0x7d, 0xea, 0xc1, 0x3a, 0x30, 0x03, 0x29, 0xde,
+  0xc0, 0xc5, 0x3a, 0xb6, 0xc4, 0xc9, 0x56, 0xbf, 0x8b, 0x44, 0xd6, 0xad,
+  0xae, 0x1a, 0xfa, 0x31, 0xdb, 0x4f, 0xb7, 0x4d, 0xc6, 0xda, 0x18, 0xd3,
+  0x4b, 0xb4, 0xc6, 0xb5, 0x49, 0x28, 0xa0, 0xb8, 0x07, 0xce, 0x44, 0xdd,
+  0x05, 0xd5, 0x24, 0x18, 0xbb, 0x9c, 0xc2, 0x52, 0x41, 0x2e, 0x34, 0xa6,
+  0xc9, 0xb5, 0x1b, 0xb9, 0xae, 0xaf, 0x3b, 0x91, 0x56, 0x32, 0xe1, 0xcc,
+  0xa2, 0x30, 0xb2, 0x51, 0xb2, 0x45, 0x99, 0x6b, 0xb7, 0xc3, 0x25, 0xc5,
+  0x39, 0x81, 0x95, 0xb4, 0x50, 0x36, 0x85, 0xb2, 0xf3, 0xfa, 0x58, 0xcd,
+  0x02, 0xce, 0x40, 0x46, 0x16, 0x81, 0xae, 0x53, 0x43, 0x4c, 0x45, 0xd3,
+  0xbf, 0xb4, 0x2f, 0xba, 0xc6, 0x3e, 0x22, 0x81, 0xd8, 0x4c, 0xe2, 0xda,
+  0xd3, 0x44, 0x8a, 0x2d, 0xde, 0x09, 0xc2, 0x53, 0xe6, 0x0f, 0x25, 0xdc,
+  0x1e, 0xc3, 0xa6, 0x02, 0x24, 0x0a, 0x9d, 0xe1, 0xfa, 0xf3, 0x46, 0xe1,
+  0x17, 0xfb, 0x0f, 0x3d, 0x5f, 0x97, 0x9a, 0x08, 0x25, 0x3d, 0x38, 0xd0,
+  0xce, 0xd2, 0x19, 0xe3, 0xfb, 0xe2, 0x38, 0xde, 0xb2, 0x3c, 0x03, 0xcf,
+  0x4a, 0xc0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+  0xfb, 0x3d, 0x00, 0x00, 0x2c, 0xff, 0xff, 0xff, 0xda, 0x4d, 0x00, 0x00,
+  0xe9, 0xff, 0xff, 0xff, 0xc0, 0x47, 0x00, 0x00, 0xe5, 0xf9, 0xff, 0xff,
+  0x6f, 0x9f, 0x00, 0x00, 0x39, 0xfd, 0xff, 0xff, 0x17, 0x22, 0x00, 0x00,
+  0x79, 0xd2, 0x00, 0x00, 0x90, 0x0a, 0x00, 0x00, 0x43, 0x79, 0x00, 0x00,
+  0x13, 0xf1, 0xff, 0xff, 0x60, 0x35, 0x00, 0x00, 0x13, 0x96, 0x00, 0x00,
+  0x52, 0x7c, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x74, 0xfb, 0xff, 0xff,
+  0x64, 0x09, 0x00, 0x00, 0x80, 0xbe, 0x00, 0x00, 0xa8, 0x08, 0x00, 0x00,
+  0xb9, 0x48, 0x00, 0x00, 0x36, 0xf5, 0xff, 0xff, 0xe1, 0x31, 0x00, 0x00,
+  0x3f, 0x29, 0x00, 0x00, 0x08, 0xc0, 0x00, 0x00, 0xee, 0x0b, 0x00, 0x00,
+  0xbd, 0xfb, 0xff, 0xff, 0xef, 0xdd, 0xff, 0xff, 0x71, 0x5c, 0x00, 0x00,
+  0x5b, 0x78, 0x00, 0x00, 0xa0, 0xfd, 0xff, 0xff, 0x84, 0x03, 0x00, 0x00,
+  0x7a, 0x06, 0x00, 0x00, 0xf6, 0x01, 0x00, 0x00, 0x89, 0x3f, 0x00, 0x00,
+  0x08, 0x33, 0x00, 0x00, 0xf0, 0xaf, 0x00, 0x00, 0xb2, 0x0e, 0x00, 0x00,
+  0x1c, 0x6b, 0x00, 0x00, 0xfa, 0x6e, 0x00, 0x00, 0xda, 0x1a, 0x00, 0x00,
+  0xb7, 0x03, 0x00, 0x00, 0xc7, 0x35, 0x00, 0x00, 0xfa, 0x0b, 0x00, 0x00,
+  0x4b, 0x05, 0x00, 0x00, 0x45, 0x87, 0x00, 0x00, 0x4e, 0x7b, 0x00, 0x00,
+  0x16, 0xc1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x18, 0x28, 0x1b, 0xdc, 0x32, 0x3b, 0xe4, 0x35, 0x03, 0x56, 0x02, 0x20,
+  0xf2, 0x25, 0xfc, 0x2b, 0x10, 0x42, 0x08, 0xc1, 0xd2, 0x58, 0xfb, 0x23,
+  0x50, 0x11, 0x26, 0x34, 0xe6, 0xc3, 0xdd, 0x43, 0xf2, 0x04, 0xbd, 0x1e,
+  0x30, 0x81, 0xdc, 0x11, 0x0f, 0xdc, 0x51, 0xf5, 0xf4, 0xcb, 0xb8, 0xde,
+  0xd9, 0x04, 0xc2, 0xc9, 0x0f, 0x4b, 0xc5, 0x13, 0xf9, 0xe3, 0xdb, 0x37,
+  0x3f, 0xfb, 0xd1, 0xdd, 0xdb, 0xe7, 0x05, 0x10, 0xca, 0x3f, 0x96, 0xcf,
+  0xd3, 0xe7, 0x35, 0x2f, 0xd7, 0xf2, 0x2f, 0xeb, 0xfe, 0xc9, 0xdf, 0x3c,
+  0x1c, 0xda, 0x7f, 0xe2, 0xed, 0x24, 0xe5, 0xf2, 0x23, 0x2c, 0x29, 0x18,
+  0x14, 0x06, 0x21, 0xfc, 0xef, 0xc6, 0x09, 0xe0, 0x5b, 0x36, 0xcd, 0x0f,
+  0x7f, 0xce, 0x79, 0x42, 0xbe, 0xfb, 0xf7, 0x25, 0x5c, 0xa6, 0xdc, 0xa4,
+  0xea, 0xd8, 0x25, 0xc7, 0x37, 0x26, 0xe4, 0x19, 0x00, 0xee, 0x3f, 0x34,
+  0xcd, 0x1a, 0x0e, 0xd0, 0x0d, 0x1c, 0x57, 0xe6, 0x09, 0xa9, 0x65, 0xab,
+  0x2a, 0xfd, 0xe1, 0xe1, 0x18, 0x78, 0x18, 0x03, 0x28, 0xc6, 0x1b, 0xe3,
+  0xcf, 0x12, 0x08, 0x39, 0xd5, 0xb4, 0x34, 0x81, 0x01, 0x0f, 0xe5, 0x04,
+  0xde, 0x57, 0x7f, 0x44, 0x11, 0xcf, 0x19, 0x36, 0x42, 0xd2, 0x5b, 0x18,
+  0xd0, 0xc7, 0x00, 0x2d, 0x13, 0x0b, 0x0c, 0xf6, 0x13, 0x1e, 0xed, 0xe9,
+  0x5f, 0xe7, 0x11, 0xca, 0x64, 0x58, 0x2b, 0x04, 0x1d, 0xfb, 0x9d, 0x1e,
+  0x28, 0xe9, 0xfd, 0xf4, 0x99, 0x94, 0xde, 0xaa, 0xfd, 0x14, 0xdb, 0xc4,
+  0xa7, 0x7f, 0xb6, 0x78, 0xfb, 0xc8, 0x22, 0x5c, 0x11, 0xc2, 0x09, 0xf6,
+  0xdc, 0x13, 0xdc, 0x18, 0xd0, 0xe4, 0xfc, 0x35, 0xc7, 0x72, 0xf2, 0xbb,
+  0xf4, 0xf4, 0xc1, 0x12, 0xe4, 0x37, 0x1c, 0xf6, 0x37, 0x40, 0x28, 0x5d,
+  0x34, 0xe7, 0x1b, 0xf5, 0xd0, 0x7f, 0xdf, 0x26, 0xfd, 0xf3, 0xbd, 0xf5,
+  0x18, 0xfd, 0xba, 0xdd, 0xf6, 0x28, 0x11, 0xef, 0xc5, 0x18, 0x26, 0xff,
+  0xd6, 0x01, 0xa8, 0xf7, 0x4b, 0xeb, 0x18, 0x3f, 0xd3, 0x01, 0xd2, 0x19,
+  0x18, 0x01, 0x06, 0x4f, 0x13, 0xe4, 0x7c, 0x06, 0xe0, 0x53, 0x7d, 0x55,
+  0x1a, 0x4a, 0xe1, 0x3a, 0x0d, 0xd4, 0xc1, 0x65, 0x3b, 0xc7, 0xcb, 0x3e,
+  0xaa, 0x61, 0x48, 0x00, 0x58, 0x19, 0xe2, 0xf3, 0x46, 0xfb, 0x81, 0xd5,
+  0x50, 0x1c, 0x04, 0x14, 0x06, 0x2f, 0x3c, 0xea, 0x3c, 0x76, 0x2c, 0xe7,
+  0x9b, 0xfa, 0xf1, 0x17, 0xcf, 0xcf, 0x1a, 0x32, 0x55, 0x6a, 0xcb, 0xa1,
+  0x9c, 0x0b, 0xe9, 0xf0, 0x99, 0x69, 0x08, 0x7f, 0xd8, 0x35, 0x13, 0x22,
+  0x01, 0x95, 0xed, 0xb0, 0x24, 0x3b, 0xfd, 0x12, 0x04, 0xfa, 0x0f, 0xf3,
+  0xf0, 0xd3, 0x6f, 0x1f, 0x0b, 0x14, 0x1d, 0xe7, 0x1f, 0x3f, 0xe1, 0xfa,
+  0xe5, 0x9c, 0x34, 0xbc, 0x3c, 0xc5, 0x55, 0xbf, 0xf2, 0x9b, 0x29, 0x1c,
+  0xda, 0x20, 0x22, 0x37, 0xf8, 0x0d, 0xe0, 0x6e, 0x1a, 0x2a, 0xda, 0x19,
+  0x60, 0x02, 0xce, 0xe1, 0x9d, 0xdb, 0xb8, 0x82, 0xe4, 0xb7, 0xf9, 0x57,
+  0x04, 0x22, 0x7b, 0x22, 0x18, 0xe4, 0x68, 0x7f, 0xeb, 0xa9, 0xef, 0x46,
+  0x10, 0xe3, 0x01, 0xc1, 0x18, 0x3e, 0xd0, 0x2b, 0x30, 0xc0, 0xf0, 0xe6,
+  0x0f, 0xcc, 0x72, 0xf4, 0xf1, 0x92, 0x32, 0x24, 0xb8, 0x2e, 0x1d, 0xde,
+  0xf9, 0x99, 0xef, 0x3f, 0x11, 0x47, 0xf1, 0xef, 0xda, 0x1c, 0xe0, 0x7f,
+  0xf8, 0xd5, 0xe0, 0xc1, 0xe6, 0x01, 0x18, 0x52, 0x1a, 0x41, 0xa2, 0x1d,
+  0xe6, 0x13, 0xdd, 0xf4, 0x10, 0x12, 0xba, 0xf5, 0x2b, 0x0f, 0x3f, 0xf4,
+  0xe8, 0xfa, 0x30, 0xc3, 0xba, 0x7f, 0xe3, 0x2f, 0xf4, 0xfe, 0x0e, 0x23,
+  0xda, 0x17, 0x09, 0x5a, 0x31, 0x14, 0xd6, 0x01, 0x62, 0x10, 0xf8, 0x11,
+  0xf1, 0xcd, 0xbe, 0x09, 0xa6, 0xfb, 0x1e, 0x06, 0x14, 0x38, 0x0a, 0x37,
+  0xdd, 0x36, 0xed, 0x20, 0x17, 0x3b, 0x0c, 0xf5, 0x13, 0x2b, 0x81, 0xcb,
+  0x4d, 0x21, 0xf7, 0xe2, 0xfb, 0x0e, 0xe0, 0xc6, 0xfb, 0xf2, 0x4d, 0xff,
+  0x42, 0x19, 0xec, 0x25, 0xf1, 0x12, 0xfd, 0x2e, 0x05, 0xec, 0xd7, 0x0f,
+  0x3e, 0x45, 0x60, 0x12, 0x28, 0xe5, 0x47, 0x0f, 0xd3, 0x03, 0x4e, 0xec,
+  0xd3, 0x02, 0x21, 0x42, 0xdc, 0xd3, 0x17, 0xfd, 0xe2, 0xeb, 0x81, 0x09,
+  0x4c, 0xa6, 0x24, 0x2c, 0x3b, 0x56, 0x57, 0x92, 0xec, 0x39, 0xc3, 0xd2,
+  0xee, 0x06, 0x14, 0xeb, 0xf7, 0x05, 0xf6, 0x54, 0x36, 0x54, 0x3a, 0xd9,
+  0xd9, 0xd8, 0x2e, 0x03, 0xe7, 0x1b, 0x33, 0xf9, 0x2b, 0x02, 0xca, 0xe3,
+  0xd4, 0xad, 0xdb, 0x97, 0x0a, 0x1b, 0x2e, 0x47, 0x91, 0x01, 0x69, 0xcb,
+  0x3d, 0x29, 0x7e, 0xfe, 0x6e, 0x0d, 0x13, 0xa4, 0x3a, 0xb4, 0x7f, 0xed,
+  0xc5, 0xf8, 0xe3, 0x10, 0xdc, 0xa2, 0xab, 0x17, 0x4a, 0xda, 0xb0, 0x2a,
+  0x18, 0xc3, 0x4d, 0xc0, 0x00, 0x41, 0x2e, 0x30, 0x3b, 0xf0, 0x60, 0xc6,
+  0x30, 0x29, 0xc7, 0x11, 0xd9, 0x19, 0xae, 0xc4, 0xe5, 0x33, 0x52, 0x22,
+  0xf6, 0xc9, 0x1d, 0xda, 0x36, 0x88, 0x12, 0x13, 0x70, 0xb4, 0x0e, 0x13,
+  0xeb, 0x72, 0xa5, 0xff, 0xb8, 0xe8, 0xa4, 0xf3, 0x7f, 0x47, 0x59, 0xee,
+  0xa3, 0x09, 0xfe, 0x3b, 0xe1, 0xd7, 0x7b, 0xd8, 0xd2, 0xbe, 0xc4, 0x31,
+  0xc5, 0x1b, 0x15, 0x26, 0x65, 0x0d, 0x18, 0x45, 0x21, 0x54, 0xf0, 0x55,
+  0x46, 0xed, 0xde, 0xed, 0x08, 0x24, 0x15, 0xcc, 0x18, 0xb3, 0xcb, 0xbd,
+  0x2e, 0xad, 0xc5, 0x62, 0xe0, 0x25, 0x15, 0x18, 0xb4, 0x0d, 0x7f, 0xff,
+  0x93, 0x22, 0x50, 0xd2, 0xc0, 0xda, 0x1c, 0xee, 0xda, 0xe7, 0xff, 0xf8,
+  0x22, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0xd8, 0x04, 0x00, 0x00, 0x7f, 0x18, 0x00, 0x00, 0xc6, 0xbf, 0xff, 0xff,
+  0xf1, 0x06, 0x00, 0x00, 0x23, 0x2b, 0x00, 0x00, 0xfa, 0xcd, 0xff, 0xff,
+  0x01, 0x63, 0xff, 0xff, 0xc5, 0xdd, 0xff, 0xff, 0x0b, 0xcc, 0xff, 0xff,
+  0xed, 0x38, 0x00, 0x00, 0x2f, 0xd4, 0xff, 0xff, 0x04, 0xc4, 0xff, 0xff,
+  0x15, 0x03, 0x00, 0x00, 0x4e, 0xe5, 0xff, 0xff, 0x9b, 0xeb, 0xff, 0xff,
+  0x90, 0xec, 0xff, 0xff, 0x6e, 0xc4, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0x3c, 0xe2, 0xe9, 0x6f, 0x81, 0xc8, 0x69, 0x0a,
+  0x26, 0x44, 0xe8, 0x2c, 0x18, 0x30, 0x01, 0x29, 0xea, 0xe9, 0xb4, 0xc2,
+  0x6e, 0x2f, 0x20, 0xe7, 0x01, 0x0d, 0xbd, 0xf3, 0xa6, 0x50, 0x81, 0xc9,
+  0xdf, 0x40, 0x4b, 0xf4, 0x57, 0x4f, 0x16, 0x34, 0x06, 0x05, 0x13, 0x02,
+  0x46, 0x81, 0xf6, 0x13, 0x7f, 0xae, 0x3f, 0x2a, 0x43, 0x2d, 0xb9, 0x25,
+  0x11, 0x40, 0xf8, 0x08, 0xd9, 0x3b, 0xd4, 0x1c, 0x81, 0xd9, 0xff, 0x20,
+  0x8d, 0x15, 0x83, 0xb2, 0xae, 0x31, 0x0a, 0xe4, 0xd6, 0x1d, 0xf0, 0x6e,
+  0x81, 0x07, 0x25, 0xf6, 0x76, 0x02, 0x24, 0x49, 0x8f, 0x3f, 0xf4, 0xe3,
+  0xa2, 0x4f, 0xaa, 0xf3, 0x92, 0x1c, 0xe6, 0x03, 0x01, 0xb8, 0x7f, 0x16,
+  0x0b, 0xd6, 0xc3, 0x23, 0x35, 0xf2, 0xd4, 0x12, 0xf4, 0x43, 0xba, 0x98,
+  0x5c, 0x71, 0x7f, 0xdb, 0xc3, 0x31, 0x12, 0x37, 0x65, 0x31, 0xae, 0x30,
+  0x02, 0x14, 0x8d, 0x3e, 0x1d, 0x1c, 0xdb, 0xdf, 0x05, 0xf5, 0x1f, 0x31,
+  0x7f, 0x2f, 0xb5, 0xef, 0xc9, 0x8c, 0xf2, 0x6c, 0xec, 0xb2, 0x03, 0x60,
+  0x40, 0x10, 0xe6, 0x7f, 0x85, 0x24, 0xed, 0xff, 0xec, 0xfc, 0x93, 0x42,
+  0xaa, 0x4a, 0x29, 0xae, 0x25, 0x9d, 0x34, 0xdb, 0x21, 0x4a, 0x81, 0x54,
+  0xf2, 0xa2, 0x1d, 0x2a, 0x5c, 0x7f, 0x1a, 0x2f, 0x02, 0x39, 0xd6, 0xdc,
+  0xd6, 0x6a, 0xb4, 0x64, 0xde, 0xe2, 0xd5, 0x53, 0xb3, 0x81, 0x2b, 0x50,
+  0xe4, 0x22, 0xd1, 0x53, 0x22, 0x04, 0x5e, 0x31, 0xc6, 0xf1, 0xd8, 0x01,
+  0x01, 0xf6, 0x18, 0x10, 0xfc, 0x7f, 0xf2, 0xf6, 0x29, 0x15, 0x0f, 0xed,
+  0xaf, 0xa8, 0x02, 0xf2, 0xea, 0x0f, 0x19, 0xf0, 0x6b, 0x94, 0x58, 0x14,
+  0x7c, 0xe8, 0x12, 0x81, 0xf7, 0x81, 0x6c, 0xb5, 0xb6, 0xde, 0x0b, 0x40,
+  0x1b, 0xc2, 0xa7, 0xd9, 0x78, 0xcd, 0xc7, 0xbd, 0xf9, 0xde, 0x0e, 0xed,
+  0x12, 0x1d, 0xf9, 0x18, 0x50, 0x81, 0x2b, 0xf3, 0x15, 0xdf, 0xd5, 0x9a,
+  0xda, 0x03, 0x62, 0xe0, 0x36, 0xfb, 0x1d, 0xf9, 0x48, 0xa0, 0x22, 0x4b,
+  0x7f, 0xe1, 0x0f, 0xa1, 0x3e, 0xfc, 0xec, 0x98, 0xec, 0x05, 0x3b, 0xdd,
+  0x2f, 0x1f, 0x0e, 0x45, 0xff, 0x32, 0xef, 0x81, 0x8b, 0xe7, 0xd2, 0x81,
+  0xeb, 0x37, 0xf6, 0xfd, 0xd8, 0x21, 0x3c, 0x01, 0xea, 0x2b, 0xe9, 0x1d,
+  0x0f, 0x30, 0x35, 0xd4, 0x31, 0xdc, 0xeb, 0x36, 0x9f, 0x81, 0x26, 0xe0,
+  0xd2, 0x5a, 0xfe, 0xf4, 0x11, 0xb3, 0xb5, 0x3c, 0x7f, 0x01, 0x17, 0x2a,
+  0xb3, 0xf9, 0xe1, 0xf6, 0x3c, 0xca, 0xc3, 0xfe, 0x41, 0x03, 0x6d, 0x06,
+  0x45, 0x25, 0x54, 0xff, 0x18, 0x7f, 0xf0, 0x1c, 0xf8, 0xf4, 0x54, 0x06,
+  0xa5, 0xb1, 0xdf, 0x7f, 0x40, 0x22, 0x18, 0x06, 0xc8, 0xef, 0x1a, 0xcd,
+  0x0a, 0x4c, 0x04, 0x47, 0x2c, 0x09, 0x2f, 0x3d, 0x05, 0x90, 0xf8, 0xfc,
+  0x23, 0x7f, 0xab, 0x52, 0xdc, 0xca, 0x40, 0xd3, 0x30, 0xc0, 0x58, 0x34,
+  0x29, 0x04, 0xf0, 0x35, 0x81, 0x63, 0x5f, 0x83, 0xef, 0x25, 0x55, 0x01,
+  0xec, 0x1e, 0x0f, 0x21, 0xc8, 0x7f, 0xf1, 0x2c, 0xdb, 0xdb, 0xac, 0x2e,
+  0x07, 0x1d, 0x41, 0x89, 0x3f, 0x07, 0x08, 0xd7, 0xd7, 0xf4, 0xae, 0x14,
+  0x96, 0xf4, 0x9c, 0xdd, 0xb9, 0x3f, 0xde, 0x7f, 0xbb, 0xfb, 0x1a, 0xfc,
+  0x39, 0x00, 0x81, 0xd8, 0xf6, 0xcf, 0xdf, 0xfa, 0x1e, 0xbc, 0xac, 0xc5,
+  0xf3, 0x81, 0xf7, 0x4a, 0xc5, 0x17, 0x7e, 0xf4, 0x5d, 0x1f, 0x97, 0x42,
+  0x26, 0xe9, 0xdc, 0x32, 0xee, 0xbf, 0xc3, 0xd1, 0x81, 0x1c, 0x11, 0xe1,
+  0xee, 0x1e, 0xf3, 0xe5, 0xe3, 0x0d, 0x1e, 0x41, 0x81, 0xe7, 0xdc, 0x3e,
+  0xbb, 0xd8, 0xba, 0xe0, 0xcf, 0xcd, 0x15, 0xe3, 0xae, 0xd5, 0xc9, 0x31,
+  0x85, 0xbf, 0xc9, 0xed, 0x81, 0xe7, 0x1d, 0xd5, 0x3b, 0x10, 0xbf, 0xbf,
+  0x1c, 0x4c, 0x2e, 0x19, 0xd1, 0x02, 0xae, 0x4b, 0xb2, 0xae, 0x4c, 0x2e,
+  0x81, 0x07, 0xcf, 0xb9, 0xf3, 0x56, 0x58, 0x5e, 0x0c, 0x2f, 0x3e, 0x46,
+  0xe1, 0xf8, 0x3b, 0xfc, 0xce, 0x94, 0xff, 0x53, 0xe4, 0x7f, 0xdf, 0x60,
+  0x79, 0x09, 0xd3, 0xdf, 0x81, 0xed, 0x7b, 0x00, 0x25, 0x20, 0xa0, 0x14,
+  0x3a, 0x65, 0x59, 0x5f, 0x14, 0xf1, 0xec, 0x21, 0x7f, 0x29, 0x37, 0x27,
+  0xf3, 0x0b, 0xca, 0xe4, 0x19, 0xf8, 0xe4, 0x16, 0x81, 0x1b, 0x04, 0xcf,
+  0x0e, 0xae, 0xdd, 0xe9, 0xf1, 0xd9, 0xed, 0x08, 0x24, 0xd2, 0x0e, 0xa6,
+  0x16, 0x2f, 0x16, 0xe5, 0xe8, 0xf3, 0xa6, 0xd2, 0xdf, 0xcd, 0x11, 0x0c,
+  0xd9, 0x81, 0x42, 0xf7, 0x13, 0x2e, 0xe3, 0x30, 0xfe, 0x0a, 0x74, 0xea,
+  0xe3, 0x36, 0x07, 0xe1, 0x10, 0x7f, 0x18, 0x2f, 0x47, 0x0d, 0x27, 0x36,
+  0x81, 0xff, 0x16, 0x2f, 0xde, 0x07, 0x05, 0xed, 0xde, 0xd7, 0x54, 0xde,
+  0xd9, 0xd4, 0x23, 0x3e, 0x94, 0x7f, 0xed, 0x3e, 0xbd, 0x30, 0x8b, 0x0e,
+  0x02, 0x48, 0x66, 0x86, 0xf5, 0xad, 0x24, 0xfa, 0x7f, 0x02, 0x3b, 0x1a,
+  0x06, 0xc1, 0xbc, 0xe3, 0xab, 0xf4, 0xe0, 0x22, 0xdb, 0xc1, 0xd7, 0x12,
+  0x69, 0x0e, 0xef, 0x59, 0xbe, 0xd7, 0x81, 0xa4, 0x69, 0xe3, 0xb9, 0x50,
+  0x03, 0xaf, 0xd5, 0x81, 0x24, 0x6d, 0x17, 0xee, 0xf4, 0xc0, 0xce, 0xfd,
+  0xdb, 0x0e, 0xf5, 0x79, 0xf8, 0xb2, 0xaa, 0x12, 0x81, 0x51, 0xbb, 0xbf,
+  0x3f, 0xe4, 0x2c, 0xf6, 0x02, 0x48, 0xb1, 0x36, 0xf6, 0xa6, 0xdf, 0xe7,
+  0x41, 0xf2, 0xc4, 0x43, 0x20, 0xe9, 0x6c, 0x29, 0xea, 0xee, 0x11, 0x81,
+  0xde, 0xb6, 0xda, 0x5b, 0xa0, 0xef, 0x3a, 0x08, 0xd8, 0x7f, 0x5c, 0x1e,
+  0xaa, 0x28, 0xf8, 0x1e, 0x34, 0xef, 0x9c, 0x81, 0x2e, 0xbf, 0x1b, 0x6c,
+  0x3a, 0x8c, 0xe8, 0x2e, 0xd4, 0x06, 0xc0, 0x9b, 0x27, 0xf6, 0x15, 0x1a,
+  0x20, 0xf3, 0x39, 0x3b, 0xae, 0x7f, 0xe0, 0x21, 0xb3, 0x19, 0x4d, 0x6c,
+  0x0e, 0x08, 0x01, 0xfa, 0x81, 0xfd, 0x01, 0xd6, 0x37, 0x1a, 0x12, 0x1b,
+  0xef, 0xcb, 0x0b, 0x0b, 0xfc, 0xd3, 0xe7, 0x81, 0xb6, 0x28, 0xd9, 0xcb,
+  0x02, 0x1e, 0x13, 0xef, 0x1b, 0x24, 0xf2, 0xf8, 0x05, 0xfe, 0xee, 0xbd,
+  0x3b, 0xd4, 0xe4, 0xf7, 0x30, 0xf2, 0x7f, 0xdb, 0x0e, 0xf2, 0xe1, 0x1c,
+  0xc1, 0xaa, 0x20, 0xf6, 0xc1, 0x81, 0xe8, 0x8b, 0x19, 0x7f, 0x9f, 0x68,
+  0xbd, 0xf4, 0x16, 0x86, 0x6d, 0x49, 0xfd, 0x05, 0x81, 0xad, 0xab, 0xa7,
+  0xe1, 0x1c, 0x63, 0x64, 0xed, 0xcc, 0x47, 0xeb, 0x10, 0x15, 0xe1, 0x37,
+  0xac, 0xf9, 0x3b, 0x31, 0x1f, 0x7f, 0x39, 0x17, 0xef, 0xe9, 0x14, 0x07,
+  0x18, 0x83, 0xe8, 0x47, 0xcd, 0xe4, 0xff, 0x35, 0x19, 0xf8, 0x23, 0x2c,
+  0xb3, 0x1b, 0x05, 0x7f, 0xeb, 0x27, 0x7c, 0x92, 0x6a, 0x1d, 0x1e, 0x01,
+  0xf1, 0xf4, 0x04, 0x7f, 0x5c, 0x0e, 0x43, 0xe1, 0x55, 0xa0, 0x0c, 0xe6,
+  0x39, 0x26, 0xfe, 0x7f, 0x37, 0x5c, 0x1f, 0x39, 0x13, 0xeb, 0x0c, 0xce,
+  0xd0, 0x28, 0x4f, 0x9a, 0xe2, 0xfd, 0xe9, 0x04, 0x22, 0x23, 0xfe, 0xc0,
+  0x81, 0xe8, 0x26, 0x08, 0x14, 0x0c, 0x1e, 0x16, 0xe5, 0x06, 0xff, 0xd3,
+  0xfa, 0x7f, 0x01, 0xfc, 0xe3, 0xcb, 0xdd, 0xf8, 0x53, 0x2e, 0x23, 0xda,
+  0xc1, 0x81, 0xdf, 0xe3, 0xea, 0x0f, 0xd1, 0x30, 0x88, 0xdf, 0x5b, 0x05,
+  0xe7, 0x6b, 0xe3, 0x17, 0xd2, 0x7f, 0xbd, 0x1e, 0xfe, 0x1d, 0x15, 0x15,
+  0xe4, 0x0d, 0x11, 0x9a, 0x2c, 0xf2, 0xd0, 0x86, 0x0f, 0xcc, 0x7f, 0xd5,
+  0x15, 0x98, 0x9d, 0x0b, 0xf5, 0x30, 0x16, 0xd4, 0xeb, 0x00, 0xf5, 0x14,
+  0x14, 0xcf, 0x26, 0x52, 0x97, 0xed, 0xd1, 0xcf, 0xe7, 0x7f, 0x18, 0x61,
+  0xb9, 0xd2, 0xa7, 0xd0, 0x66, 0x7d, 0xaf, 0xcd, 0x81, 0xd2, 0x27, 0xbb,
+  0xb9, 0x64, 0x31, 0x41, 0xd6, 0x37, 0xfd, 0x32, 0xd5, 0x7f, 0xd7, 0x20,
+  0xb3, 0x0b, 0xe4, 0x3c, 0xcb, 0x21, 0x35, 0xb5, 0xf4, 0xef, 0xca, 0x2d,
+  0xe4, 0x81, 0x18, 0xa7, 0xff, 0x09, 0x35, 0x7b, 0xc0, 0x1b, 0x31, 0x96,
+  0x01, 0x9e, 0xfb, 0x60, 0x3f, 0x06, 0x02, 0x5a, 0xf1, 0x7f, 0x18, 0x1e,
+  0xe7, 0x5e, 0xdb, 0xfd, 0x09, 0x62, 0x76, 0xb0, 0xe4, 0xe7, 0xd8, 0x4a,
+  0x2a, 0x5f, 0x3a, 0x2f, 0x1f, 0x81, 0x13, 0xea, 0x1f, 0x53, 0x2e, 0xdb,
+  0x59, 0x03, 0x81, 0xe4, 0x88, 0x9c, 0xfd, 0x30, 0xf7, 0x15, 0x9b, 0x0b,
+  0xe8, 0xb0, 0x56, 0xf9, 0x4e, 0xce, 0x00, 0x2b, 0xca, 0x1d, 0x81, 0xc9,
+  0x10, 0x26, 0xdc, 0xe7, 0x06, 0xfe, 0x2a, 0xfe, 0xe5, 0xdb, 0xc3, 0xc2,
+  0xf6, 0x0c, 0xf7, 0x1f, 0x07, 0x49, 0x81, 0xf3, 0xff, 0xd9, 0xe0, 0xb9,
+  0x02, 0x8c, 0x40, 0xe8, 0x73, 0x3f, 0x7f, 0xd2, 0x2d, 0xf7, 0xb6, 0x7d,
+  0x07, 0x05, 0xed, 0x45, 0xc0, 0xfc, 0x5f, 0x34, 0x30, 0x59, 0x22, 0x7f,
+  0x7e, 0x24, 0xcb, 0x01, 0xe2, 0x23, 0xe6, 0x1d, 0xc5, 0x7f, 0x09, 0x27,
+  0xdd, 0x0b, 0xda, 0x1f, 0x03, 0x3a, 0x1c, 0xbc, 0xa6, 0x40, 0x04, 0x46,
+  0xa8, 0x02, 0xeb, 0xf6, 0x2c, 0xff, 0xd7, 0xf0, 0x1d, 0xed, 0x81, 0x4a,
+  0x52, 0x75, 0xb1, 0x6a, 0x1f, 0x48, 0x3b, 0x67, 0x74, 0xed, 0x7f, 0xf4,
+  0x32, 0xf8, 0x46, 0x28, 0x0a, 0xe9, 0x17, 0xd1, 0x30, 0x81, 0x12, 0xf7,
+  0x21, 0x37, 0x6a, 0xe6, 0x00, 0xf0, 0xe1, 0x77, 0xc9, 0x65, 0x04, 0x26,
+  0x14, 0xcf, 0xd9, 0x07, 0x85, 0x11, 0x20, 0xee, 0x7f, 0xf1, 0xdd, 0xd5,
+  0xac, 0x0c, 0x22, 0x0e, 0x7a, 0x12, 0xf6, 0xf6, 0xba, 0x2a, 0x8a, 0xe7,
+  0xe0, 0xb6, 0x4e, 0x7f, 0x4f, 0x5e, 0xeb, 0xf1, 0x15, 0xdb, 0x59, 0x7f,
+  0xb9, 0x5b, 0x9e, 0xe4, 0xec, 0x06, 0x77, 0x60, 0x15, 0x33, 0xc5, 0x18,
+  0x61, 0x20, 0x7f, 0xd7, 0xe0, 0xf8, 0xc7, 0x59, 0x2e, 0x33, 0x1c, 0xe7,
+  0xeb, 0xd3, 0xf0, 0x03, 0xf7, 0x29, 0xd3, 0xa4, 0x2f, 0xce, 0x48, 0x1b,
+  0x26, 0xd9, 0xaa, 0x81, 0x85, 0xc8, 0xd0, 0xed, 0xed, 0x5c, 0x7f, 0x32,
+  0x2d, 0x27, 0x6b, 0x4a, 0x15, 0x42, 0x9f, 0x30, 0x5e, 0x3b, 0x7f, 0xb4,
+  0x0f, 0xe6, 0x03, 0x25, 0xfc, 0x2e, 0xbe, 0x26, 0x14, 0x23, 0x6a, 0x28,
+  0xc6, 0x37, 0xe7, 0xff, 0xf9, 0x77, 0x03, 0x11, 0x62, 0x40, 0x7f, 0xcd,
+  0xec, 0x2e, 0xd7, 0xe5, 0x10, 0xd3, 0x16, 0xd7, 0x29, 0x81, 0x27, 0xe9,
+  0x35, 0xf1, 0x4b, 0xdc, 0x29, 0xdb, 0xd7, 0x4e, 0xe6, 0x3c, 0x1a, 0x10,
+  0x5a, 0xf0, 0x47, 0x06, 0xdf, 0xb1, 0x4a, 0xad, 0x7f, 0x61, 0x54, 0x9a,
+  0xe1, 0x26, 0xe7, 0x1c, 0xda, 0x7f, 0xd8, 0x1f, 0xe8, 0x09, 0xe6, 0x10,
+  0xfb, 0x33, 0x0d, 0x9b, 0x2a, 0xa5, 0xfc, 0x0c, 0x7f, 0x16, 0x2a, 0x16,
+  0xd5, 0xbf, 0xa2, 0xf9, 0xf1, 0xf8, 0xd2, 0x25, 0xfb, 0x41, 0xe9, 0xf6,
+  0xe8, 0xe8, 0x81, 0x3a, 0xc1, 0x0d, 0xda, 0xdd, 0xbf, 0xb1, 0x13, 0xdc,
+  0x40, 0x30, 0x0c, 0x24, 0x8a, 0x81, 0xfa, 0xfd, 0xd4, 0x4e, 0x15, 0xe3,
+  0x0c, 0xad, 0x1f, 0xef, 0xea, 0xdd, 0x03, 0x3b, 0x06, 0xee, 0x01, 0x26,
+  0x5c, 0x30, 0xfd, 0x7f, 0xdd, 0x26, 0xea, 0x11, 0x30, 0xd6, 0x7f, 0xd5,
+  0xf4, 0xfb, 0xef, 0x25, 0x37, 0x2e, 0x1a, 0x18, 0x01, 0xfe, 0x42, 0xe5,
+  0xc1, 0xde, 0xef, 0x18, 0x7f, 0x3a, 0x21, 0x18, 0xe4, 0xfe, 0xdf, 0xa9,
+  0xee, 0x26, 0xaf, 0x35, 0x7a, 0xca, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x93, 0x12, 0x00, 0x00,
+  0xed, 0xfe, 0xff, 0xff, 0x0e, 0x0d, 0x00, 0x00, 0xcc, 0x10, 0x00, 0x00,
+  0x52, 0x47, 0x00, 0x00, 0xc5, 0xfd, 0xff, 0xff, 0x92, 0x05, 0x00, 0x00,
+  0xbe, 0x25, 0x00, 0x00, 0x84, 0xfc, 0xff, 0xff, 0xca, 0x28, 0x00, 0x00,
+  0x46, 0x1b, 0x00, 0x00, 0xfb, 0x0b, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00,
+  0x45, 0x08, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x52, 0x07, 0x00, 0x00,
+  0x29, 0x08, 0x00, 0x00, 0xac, 0xfe, 0xff, 0xff, 0x59, 0x21, 0x00, 0x00,
+  0xc5, 0x00, 0x00, 0x00, 0xb1, 0x14, 0x00, 0x00, 0x7d, 0xee, 0xff, 0xff,
+  0x60, 0x02, 0x00, 0x00, 0x56, 0xd6, 0xff, 0xff, 0xd9, 0x0f, 0x00, 0x00,
+  0x14, 0x0c, 0x00, 0x00, 0x5c, 0x03, 0x00, 0x00, 0xd9, 0x0a, 0x00, 0x00,
+  0x13, 0x05, 0x00, 0x00, 0x05, 0x08, 0x00, 0x00, 0x73, 0x18, 0x00, 0x00,
+  0x3e, 0x06, 0x00, 0x00, 0x27, 0x46, 0x00, 0x00, 0xfd, 0x07, 0x00, 0x00,
+  0xe3, 0x22, 0x00, 0x00, 0x18, 0x11, 0x00, 0x00, 0xe1, 0x05, 0x00, 0x00,
+  0xb4, 0x07, 0x00, 0x00, 0xbd, 0x03, 0x00, 0x00, 0xfa, 0x36, 0x00, 0x00,
+  0xf2, 0x06, 0x00, 0x00, 0xfe, 0x05, 0x00, 0x00, 0x90, 0x06, 0x00, 0x00,
+  0x80, 0x0d, 0x00, 0x00, 0x13, 0x25, 0x00, 0x00, 0xdc, 0x10, 0x00, 0x00,
+  0x3f, 0x28, 0x00, 0x00, 0x3c, 0x09, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff,
+  0x94, 0x05, 0x00, 0x00, 0x9c, 0x0b, 0x00, 0x00, 0x2f, 0x0b, 0x00, 0x00,
+  0x51, 0xf7, 0xff, 0xff, 0x2e, 0x1f, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00,
+  0xec, 0x05, 0x00, 0x00, 0x3d, 0x26, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0xf0, 0x06, 0x00, 0x00, 0xfc, 0x07, 0x00, 0x00, 0x27, 0x2e, 0x00, 0x00,
+  0x92, 0x11, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x24, 0x16, 0x00, 0x00,
+  0x3b, 0x2b, 0x00, 0x00, 0x7d, 0x06, 0x00, 0x00, 0x70, 0x10, 0x00, 0x00,
+  0x43, 0x22, 0x00, 0x00, 0x07, 0x0f, 0x00, 0x00, 0xa5, 0x06, 0x00, 0x00,
+  0x35, 0x05, 0x00, 0x00, 0xb8, 0xf5, 0xff, 0xff, 0x5c, 0x12, 0x00, 0x00,
+  0xda, 0x0b, 0x00, 0x00, 0x8a, 0x09, 0x00, 0x00, 0xd2, 0xff, 0xff, 0xff,
+  0x8c, 0x1a, 0x00, 0x00, 0x6d, 0x0c, 0x00, 0x00, 0xc9, 0x0f, 0x00, 0x00,
+  0xb1, 0x08, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x50, 0x0c, 0x00, 0x00,
+  0x43, 0x32, 0x00, 0x00, 0x95, 0xf9, 0xff, 0xff, 0xcb, 0x19, 0x00, 0x00,
+  0xa6, 0x10, 0x00, 0x00, 0x2b, 0x05, 0x00, 0x00, 0xc2, 0xfb, 0xff, 0xff,
+  0x57, 0x0d, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x25, 0x1f, 0x00, 0x00,
+  0x65, 0x0e, 0x00, 0x00, 0x33, 0x08, 0x00, 0x00, 0xf9, 0x0a, 0x00, 0x00,
+  0x20, 0x0c, 0x00, 0x00, 0x06, 0xcc, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x60, 0x03, 0x00, 0x00, 0xf9, 0x25, 0x29, 0x9f, 0x48, 0x08, 0x29, 0x03,
+  0xea, 0x49, 0xe1, 0xac, 0x81, 0x35, 0xe5, 0xf7, 0xf2, 0x00, 0x03, 0x01,
+  0xb6, 0x12, 0x24, 0x44, 0xfc, 0x81, 0xf8, 0x0a, 0x1d, 0x21, 0xf4, 0xf8,
+  0xbb, 0xff, 0x24, 0xbb, 0xf8, 0x81, 0x1d, 0xc9, 0x0b, 0x99, 0x29, 0xd0,
+  0xfe, 0x38, 0xd7, 0xde, 0x42, 0x19, 0x3e, 0x32, 0xac, 0x43, 0x0b, 0xe8,
+  0x91, 0xdd, 0x06, 0xf6, 0xeb, 0xe3, 0xf2, 0xbe, 0xea, 0xe1, 0xcb, 0xd2,
+  0x01, 0x13, 0x81, 0x2d, 0x57, 0x1a, 0xe8, 0x02, 0xdb, 0xd3, 0x7f, 0x81,
+  0x81, 0x15, 0x81, 0xed, 0x29, 0xfb, 0x08, 0x43, 0xeb, 0xe8, 0xdd, 0xe9,
+  0x00, 0x32, 0xea, 0xf5, 0x81, 0x20, 0x6f, 0xd5, 0xde, 0x04, 0x7f, 0xfd,
+  0xf1, 0x1c, 0xb5, 0x20, 0xd7, 0x1a, 0xc7, 0x7f, 0x02, 0x7f, 0x7f, 0xd6,
+  0xe2, 0x7f, 0x7f, 0x7d, 0x19, 0xfe, 0x5c, 0x19, 0x7f, 0x56, 0x7f, 0xc9,
+  0xc1, 0xeb, 0xcc, 0xaf, 0xe3, 0xaa, 0x7f, 0x43, 0xe1, 0x81, 0xee, 0xaf,
+  0x27, 0xea, 0xeb, 0x11, 0x5c, 0x04, 0x2a, 0x7f, 0xce, 0x7f, 0x81, 0xe4,
+  0x94, 0xef, 0xf9, 0x23, 0xfc, 0x81, 0x9a, 0xcc, 0xa5, 0xfd, 0x00, 0x81,
+  0x0a, 0x06, 0xda, 0x7f, 0x81, 0xfc, 0xf9, 0xd9, 0x81, 0xca, 0xe7, 0xa6,
+  0xf0, 0x11, 0x29, 0x8d, 0x7c, 0x76, 0x81, 0x21, 0x81, 0x04, 0xe0, 0xfc,
+  0x0a, 0x73, 0xeb, 0xaf, 0xea, 0x26, 0x00, 0x9f, 0x42, 0xfd, 0x26, 0xf8,
+  0xdb, 0x7f, 0xe7, 0x15, 0x92, 0x54, 0xed, 0x15, 0xee, 0xed, 0x21, 0xfe,
+  0xb7, 0x00, 0x1e, 0x3c, 0xfa, 0x92, 0x44, 0x28, 0x22, 0x2e, 0xed, 0xfd,
+  0xa7, 0xfb, 0x3c, 0x2a, 0xe8, 0xa6, 0x09, 0xc4, 0xf0, 0xdd, 0x21, 0xd4,
+  0xf8, 0xc3, 0xca, 0xd0, 0x7b, 0x10, 0x4e, 0x16, 0x09, 0x38, 0x16, 0xe3,
+  0x29, 0xda, 0x0c, 0xf7, 0xfd, 0xf6, 0x9f, 0x06, 0xe3, 0xdb, 0x7f, 0xe3,
+  0xf6, 0x04, 0xa8, 0x4b, 0x3d, 0x07, 0xe8, 0x43, 0xaa, 0x01, 0xcc, 0x90,
+  0xa4, 0xff, 0xb3, 0xe2, 0x11, 0xf2, 0x01, 0x10, 0xe0, 0xdb, 0xe3, 0x2e,
+  0x0c, 0x30, 0xd8, 0xf6, 0xcb, 0x01, 0x39, 0x81, 0x27, 0x4a, 0x0a, 0x0b,
+  0xed, 0x37, 0xf0, 0xd2, 0x9e, 0x2f, 0x1c, 0x45, 0xfc, 0x3b, 0x40, 0x28,
+  0x0b, 0xd1, 0x44, 0xf3, 0x27, 0x4d, 0x7f, 0x3d, 0xdc, 0xfe, 0xea, 0x03,
+  0xb9, 0xfc, 0x66, 0xeb, 0x05, 0xb1, 0xd1, 0x82, 0xfa, 0x23, 0x7f, 0xba,
+  0xbf, 0x7f, 0xcd, 0xa0, 0x50, 0x2b, 0x52, 0xeb, 0xc0, 0x7f, 0x50, 0xf2,
+  0xc6, 0xe3, 0x26, 0xf5, 0xfb, 0xdd, 0x39, 0xfd, 0xc8, 0x07, 0xe5, 0xc6,
+  0xf3, 0x02, 0xd4, 0xe7, 0x55, 0x6d, 0x01, 0xd4, 0xbb, 0x81, 0xce, 0x04,
+  0xf2, 0xff, 0x00, 0xca, 0x7f, 0x21, 0xd7, 0x14, 0x11, 0x7f, 0x35, 0xac,
+  0x7f, 0x07, 0xf2, 0xf8, 0x44, 0x7f, 0x7f, 0x62, 0x81, 0x81, 0x2f, 0xa9,
+  0x7f, 0x69, 0xc7, 0xb1, 0xdf, 0x7f, 0xfe, 0x52, 0x7f, 0x84, 0x38, 0x7f,
+  0x7f, 0xa9, 0x01, 0x81, 0x81, 0x93, 0x4a, 0x7f, 0x91, 0x7f, 0xf0, 0x7f,
+  0x85, 0x7f, 0x59, 0xab, 0x7f, 0x33, 0x02, 0xd0, 0x7f, 0x00, 0x9d, 0x81,
+  0x7f, 0xe9, 0x7f, 0x71, 0x7f, 0x81, 0x7f, 0x9c, 0x7f, 0x74, 0xa2, 0x7f,
+  0x96, 0x7f, 0x81, 0x7f, 0x8d, 0x4f, 0x55, 0xd6, 0x6b, 0x7f, 0xf1, 0x7a,
+  0x81, 0x81, 0x52, 0x81, 0xe7, 0x7f, 0x7f, 0x73, 0x1b, 0x00, 0x6a, 0xf4,
+  0x18, 0x7f, 0x53, 0x74, 0x35, 0x5f, 0x87, 0x7f, 0xde, 0x32, 0x6a, 0xfb,
+  0x8f, 0xf9, 0xa6, 0x0e, 0xd9, 0xed, 0x30, 0x98, 0x18, 0x29, 0xeb, 0x0d,
+  0xd3, 0x37, 0x0a, 0x7f, 0xa6, 0x39, 0x1b, 0x67, 0xe7, 0x36, 0x2a, 0x1b,
+  0x07, 0xd4, 0x50, 0xe8, 0x26, 0x43, 0x1b, 0x43, 0xe5, 0x02, 0xe3, 0x08,
+  0x81, 0xe9, 0x74, 0x7f, 0x01, 0xdc, 0xcd, 0x86, 0xe1, 0xec, 0x36, 0xb7,
+  0xd3, 0xa8, 0xcd, 0x81, 0x5b, 0x29, 0x43, 0xe6, 0x55, 0x3e, 0x73, 0xe9,
+  0x6e, 0xe4, 0x2a, 0xef, 0xf7, 0xe9, 0x9b, 0x34, 0xad, 0xfb, 0xc5, 0xce,
+  0xef, 0x06, 0xc0, 0xe5, 0x35, 0xd8, 0xeb, 0x7f, 0xe9, 0x8d, 0xcc, 0xe2,
+  0xed, 0xe9, 0xb0, 0xa0, 0x40, 0x26, 0xe1, 0x31, 0xf8, 0x9b, 0x29, 0x7f,
+  0xd8, 0x04, 0xe5, 0xff, 0xd2, 0xd0, 0xf2, 0xd3, 0x2c, 0x11, 0x0d, 0x23,
+  0xda, 0x45, 0x24, 0xce, 0x34, 0x3e, 0x21, 0xf2, 0x00, 0xf1, 0xec, 0xd6,
+  0x43, 0xbb, 0x2e, 0xce, 0x05, 0x01, 0xf9, 0xbf, 0xf2, 0xe8, 0x84, 0x02,
+  0xe5, 0xf6, 0x3c, 0xd5, 0xf3, 0xd2, 0xd7, 0xd4, 0xe9, 0x37, 0x4f, 0xca,
+  0x06, 0x27, 0xa3, 0xe2, 0xba, 0x0b, 0xe1, 0xf6, 0x39, 0x32, 0x1d, 0xdf,
+  0x1a, 0xe5, 0x0f, 0xd3, 0x1d, 0x28, 0x1a, 0x6b, 0x81, 0xe2, 0x68, 0x20,
+  0x15, 0x2e, 0xd5, 0xf9, 0x26, 0x0a, 0xef, 0xd0, 0xf3, 0x04, 0xf3, 0x02,
+  0x0f, 0x0a, 0x82, 0xef, 0x72, 0xfe, 0x0b, 0xe5, 0x30, 0x12, 0xdc, 0xec,
+  0x01, 0xd6, 0x81, 0xf9, 0x25, 0xbc, 0x33, 0xdb, 0x08, 0x04, 0x08, 0x7f,
+  0xaa, 0x51, 0x7f, 0xe5, 0xe8, 0x26, 0x7f, 0x21, 0xf0, 0xe2, 0xf9, 0xa8,
+  0x37, 0xc9, 0x72, 0xc7, 0x04, 0x2d, 0x05, 0xe4, 0xf9, 0xf6, 0x9c, 0xb2,
+  0x0a, 0xea, 0x81, 0x09, 0x97, 0xfc, 0xf7, 0x81, 0xdf, 0xc6, 0xfb, 0x57,
+  0x04, 0xec, 0x0a, 0xf3, 0x38, 0xff, 0xd4, 0xf3, 0x59, 0x4a, 0xce, 0xd1,
+  0x04, 0xbb, 0x22, 0xae, 0x7f, 0x1a, 0x7f, 0x40, 0x81, 0xc9, 0xfa, 0x91,
+  0x66, 0x18, 0xed, 0x2b, 0x1a, 0xf2, 0x01, 0xec, 0xf4, 0xc8, 0x0a, 0x19,
+  0x00, 0xe7, 0xbb, 0x81, 0x56, 0x81, 0x02, 0x04, 0xf0, 0x06, 0x7f, 0x10,
+  0x14, 0x81, 0xaf, 0x7f, 0xe9, 0xf3, 0xd9, 0xd2, 0x29, 0x0b, 0x03, 0x16,
+  0xd4, 0x35, 0x1a, 0x37, 0x36, 0x41, 0x1a, 0xf2, 0xec, 0xf8, 0xf2, 0xd1,
+  0x34, 0xbf, 0x11, 0xd2, 0xfe, 0x01, 0xd4, 0xc4, 0xe3, 0xfe, 0x9e, 0x0e,
+  0x20, 0xfc, 0x09, 0xd0, 0xf7, 0xfb, 0xde, 0xed, 0xda, 0xe4, 0x1c, 0xbd,
+  0x00, 0xf6, 0xaf, 0xcf, 0xdf, 0x06, 0xf0, 0x03, 0x2f, 0x28, 0x16, 0xf0,
+  0x7f, 0xe5, 0x11, 0xe1, 0x13, 0x31, 0x2e, 0x7f, 0xb5, 0xe5, 0xf9, 0xfe,
+  0x17, 0x22, 0xd3, 0xd9, 0xe9, 0xdd, 0xf4, 0x02, 0xf5, 0xec, 0x4e, 0xfd,
+  0x15, 0x08, 0x96, 0xf0, 0x36, 0x03, 0x07, 0xe6, 0xe9, 0xf4, 0xcf, 0x27,
+  0x06, 0xdb, 0x9b, 0xf9, 0x72, 0xcf, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x80, 0x01, 0x00, 0x00, 0x1b, 0x14, 0x00, 0x00, 0x98, 0xf9, 0xff, 0xff,
+  0x77, 0xe6, 0xff, 0xff, 0x11, 0x3c, 0x00, 0x00, 0xe1, 0xf4, 0xff, 0xff,
+  0xf4, 0x00, 0x00, 0x00, 0x9b, 0xfd, 0xff, 0xff, 0xf1, 0xf6, 0xff, 0xff,
+  0x82, 0x21, 0x00, 0x00, 0xab, 0xcd, 0xff, 0xff, 0x71, 0x02, 0x00, 0x00,
+  0xdc, 0x00, 0x00, 0x00, 0x32, 0x2a, 0x00, 0x00, 0x14, 0xe4, 0xff, 0xff,
+  0x9f, 0xf1, 0xff, 0xff, 0x49, 0xe0, 0xff, 0xff, 0x0b, 0x02, 0x00, 0x00,
+  0xb1, 0xf7, 0xff, 0xff, 0x9e, 0xe6, 0xff, 0xff, 0x34, 0x01, 0x00, 0x00,
+  0x9b, 0xf1, 0xff, 0xff, 0xe8, 0x14, 0x00, 0x00, 0x91, 0xf1, 0xff, 0xff,
+  0x59, 0x03, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00,
+  0x4c, 0xd1, 0xff, 0xff, 0x13, 0xf2, 0xff, 0xff, 0xcb, 0xfc, 0xff, 0xff,
+  0x0c, 0xf2, 0xff, 0xff, 0x8b, 0x22, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+  0xb8, 0x3e, 0x00, 0x00, 0x3e, 0xfd, 0xff, 0xff, 0xe3, 0xeb, 0xff, 0xff,
+  0x51, 0x0e, 0x00, 0x00, 0x9c, 0x04, 0x00, 0x00, 0x48, 0x25, 0x00, 0x00,
+  0x4e, 0x04, 0x00, 0x00, 0x7b, 0x3f, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x49, 0x16, 0x00, 0x00, 0xb6, 0xe9, 0xff, 0xff, 0x43, 0x41, 0x00, 0x00,
+  0x2f, 0xfe, 0xff, 0xff, 0xbc, 0xff, 0xff, 0xff, 0x7a, 0x1a, 0x00, 0x00,
+  0x14, 0x1f, 0x00, 0x00, 0x63, 0xca, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff,
+  0x57, 0xde, 0xff, 0xff, 0xa6, 0xfa, 0xff, 0xff, 0xe4, 0xeb, 0xff, 0xff,
+  0x06, 0xd3, 0xff, 0xff, 0xa6, 0xfd, 0xff, 0xff, 0xb0, 0x0d, 0x00, 0x00,
+  0xd9, 0x08, 0x00, 0x00, 0x37, 0x17, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff,
+  0xa5, 0x07, 0x00, 0x00, 0xdd, 0xfc, 0xff, 0xff, 0x1e, 0x04, 0x00, 0x00,
+  0xe7, 0xfd, 0xff, 0xff, 0x60, 0x02, 0x00, 0x00, 0xf3, 0x41, 0x00, 0x00,
+  0x6a, 0x03, 0x00, 0x00, 0xf8, 0x4f, 0x00, 0x00, 0x39, 0x36, 0x00, 0x00,
+  0xbe, 0xff, 0xff, 0xff, 0x69, 0xff, 0xff, 0xff, 0x26, 0x23, 0x00, 0x00,
+  0x91, 0xf5, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x08, 0xf5, 0xff, 0xff,
+  0x4f, 0xfc, 0xff, 0xff, 0xeb, 0xf5, 0xff, 0xff, 0x1b, 0x2a, 0x00, 0x00,
+  0xb9, 0x32, 0x00, 0x00, 0x1b, 0x35, 0x00, 0x00, 0x14, 0x2b, 0x00, 0x00,
+  0x5c, 0x12, 0x00, 0x00, 0xc8, 0xf7, 0xff, 0xff, 0x5b, 0x24, 0x00, 0x00,
+  0x34, 0x40, 0x00, 0x00, 0x5f, 0xf3, 0xff, 0xff, 0xfd, 0xed, 0xff, 0xff,
+  0xd6, 0x29, 0x00, 0x00, 0x36, 0xe6, 0xff, 0xff, 0xed, 0x16, 0x00, 0x00,
+  0x42, 0xfe, 0xff, 0xff, 0x9c, 0xef, 0xff, 0xff, 0x33, 0xf3, 0xff, 0xff,
+  0xb2, 0xfd, 0xff, 0xff, 0xb0, 0x08, 0x00, 0x00, 0x25, 0x4b, 0x00, 0x00,
+  0xb9, 0xf9, 0xff, 0xff, 0xfe, 0xd0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0x00, 0x00, 0xeb, 0x2a, 0x27, 0x1f, 0xe3, 0xa9, 0xf0, 0xdf,
+  0xe5, 0xbc, 0x28, 0xe7, 0x3a, 0xb6, 0x2e, 0x30, 0xb2, 0xf1, 0x1d, 0x18,
+  0x4b, 0x0a, 0xd1, 0xfc, 0xf5, 0x2b, 0x7f, 0x2e, 0xff, 0x58, 0x30, 0xfe,
+  0xf7, 0xfa, 0x08, 0xd0, 0x23, 0x36, 0xf3, 0x08, 0x59, 0x0e, 0x16, 0xec,
+  0xfa, 0xfc, 0x12, 0xd7, 0x0f, 0xee, 0x38, 0xf1, 0xd4, 0x08, 0x25, 0x19,
+  0x17, 0xd8, 0x00, 0x1c, 0xfa, 0x2e, 0xc0, 0xef, 0x08, 0x1d, 0x34, 0x09,
+  0x0e, 0xea, 0x21, 0xfa, 0x11, 0x0d, 0xfe, 0x19, 0x3d, 0xef, 0x1f, 0x23,
+  0x0c, 0x1c, 0x27, 0x1b, 0xd2, 0x16, 0xfc, 0x42, 0x1b, 0x11, 0xb7, 0xec,
+  0x0c, 0x16, 0x5d, 0x54, 0xfa, 0x32, 0xfe, 0x1b, 0xe5, 0xed, 0x3d, 0xd4,
+  0xd3, 0xdc, 0xbc, 0xbb, 0xf5, 0xed, 0xf2, 0xeb, 0xfc, 0xf7, 0xe6, 0xf7,
+  0xef, 0xd3, 0x7f, 0xfa, 0x05, 0x0e, 0x0a, 0x32, 0xd5, 0x07, 0xf6, 0x1f,
+  0xc0, 0x03, 0x25, 0x0a, 0xf3, 0x3a, 0xce, 0x72, 0x09, 0x07, 0x1a, 0xc1,
+  0x43, 0xf5, 0x15, 0x05, 0xcb, 0xfa, 0x18, 0xa6, 0xed, 0x3e, 0x12, 0x2d,
+  0x48, 0x08, 0xdb, 0x27, 0xd6, 0x21, 0x07, 0xfe, 0x1b, 0x37, 0x45, 0x0e,
+  0xc8, 0xa0, 0x03, 0x1c, 0x28, 0x16, 0xd3, 0x09, 0xd3, 0x16, 0x3f, 0xf5,
+  0x30, 0xde, 0x46, 0xe0, 0xea, 0xe5, 0xfe, 0xfa, 0xf4, 0xe4, 0x1a, 0xf7,
+  0x19, 0x90, 0xe4, 0x20, 0xef, 0x15, 0x21, 0x02, 0x66, 0x3c, 0xdd, 0x0c,
+  0xb4, 0x08, 0x08, 0xe3, 0x42, 0xed, 0x18, 0x1d, 0x01, 0xec, 0x81, 0xf5,
+  0x08, 0xda, 0xf5, 0x3e, 0xf6, 0xf3, 0xd0, 0xfd, 0xdb, 0xde, 0xd6, 0x39,
+  0xe3, 0xe2, 0x05, 0x14, 0x03, 0x1b, 0xf3, 0xec, 0x33, 0xf8, 0xf9, 0x3c,
+  0x0b, 0x40, 0xec, 0xe5, 0xa2, 0x0f, 0xe5, 0xe2, 0xee, 0x22, 0x37, 0xcd,
+  0x1c, 0xff, 0x32, 0x0a, 0xf6, 0x08, 0xf8, 0x10, 0x2b, 0xd6, 0xd6, 0xf0,
+  0x12, 0x19, 0xc7, 0xeb, 0x15, 0x36, 0x3e, 0x46, 0xc2, 0xe6, 0xdc, 0xd2,
+  0x26, 0x36, 0x3b, 0xe9, 0xfe, 0xba, 0xe5, 0xd9, 0xec, 0xee, 0xc3, 0x32,
+  0xff, 0x0e, 0x56, 0xf1, 0x10, 0xf2, 0x01, 0xaf, 0x0b, 0xe6, 0x5e, 0xc1,
+  0x14, 0x6f, 0xa6, 0xeb, 0xf0, 0xf3, 0xea, 0x5f, 0x33, 0x1e, 0xc9, 0x1d,
+  0xe0, 0x1b, 0x29, 0x08, 0xc3, 0x4d, 0x33, 0xf3, 0xc2, 0x08, 0xd0, 0x48,
+  0xdf, 0xef, 0x34, 0xeb, 0x20, 0xde, 0xf3, 0x46, 0x1c, 0x16, 0x03, 0x15,
+  0x32, 0xf6, 0x02, 0x14, 0x36, 0x05, 0x1b, 0xcd, 0x64, 0x1a, 0x3b, 0x0b,
+  0x1c, 0xf1, 0xe9, 0xe3, 0xf4, 0x3a, 0x39, 0xea, 0xe8, 0xc4, 0x7f, 0xd8,
+  0xe1, 0xe3, 0xc5, 0xfd, 0x02, 0xaf, 0x11, 0xb6, 0x27, 0xe6, 0x79, 0x09,
+  0x02, 0xdb, 0xf2, 0xdc, 0xdf, 0xdd, 0x49, 0x43, 0xd9, 0x3e, 0xad, 0xf2,
+  0x06, 0xa6, 0xf9, 0x2a, 0xd1, 0x52, 0x32, 0x05, 0xfb, 0x44, 0xc6, 0xe7,
+  0xfc, 0xda, 0x1a, 0xee, 0x3d, 0x32, 0xe6, 0x34, 0xde, 0xe2, 0xd3, 0xa4,
+  0x5c, 0xcd, 0xb9, 0x00, 0xd4, 0xf3, 0xfb, 0x06, 0xd1, 0x7f, 0xb7, 0xf4,
+  0xe6, 0xd6, 0x08, 0xba, 0x31, 0x52, 0xd1, 0x27, 0x06, 0x24, 0x39, 0xdb,
+  0xc7, 0x25, 0x34, 0xb7, 0x08, 0xee, 0xce, 0xdf, 0xc9, 0x2c, 0x0e, 0x14,
+  0x3d, 0x58, 0xd1, 0x1f, 0xaf, 0xdc, 0xfb, 0xfc, 0x33, 0xfb, 0xd6, 0xf2,
+  0x39, 0xf5, 0xf6, 0x95, 0xf7, 0x23, 0x40, 0x30, 0xd5, 0x2f, 0xd3, 0x4a,
+  0x33, 0x4b, 0x30, 0xba, 0x39, 0xc8, 0xdd, 0xce, 0xf2, 0xd5, 0xb1, 0xd7,
+  0xe7, 0x03, 0x38, 0x02, 0xf5, 0xca, 0x1a, 0xb7, 0x04, 0xfb, 0x04, 0xde,
+  0x2c, 0x1c, 0xe7, 0x0e, 0xf8, 0x0c, 0x06, 0xe1, 0xe6, 0xf3, 0xaf, 0xe0,
+  0xf1, 0x2f, 0xef, 0x23, 0x34, 0xa8, 0x3c, 0xe7, 0x07, 0x35, 0x1f, 0x60,
+  0xf9, 0xcc, 0x08, 0x00, 0xe3, 0xfe, 0xdc, 0xc8, 0xcc, 0xdd, 0xf8, 0x1b,
+  0xd8, 0x27, 0x81, 0xe2, 0xfe, 0x26, 0x38, 0x00, 0xfb, 0x98, 0x22, 0xdc,
+  0xfa, 0xbb, 0x1e, 0xc9, 0x29, 0x0b, 0x07, 0x48, 0xb3, 0x01, 0x6d, 0xff,
+  0xf5, 0xff, 0x11, 0x1f, 0xef, 0x1a, 0x23, 0x1d, 0xd2, 0xef, 0x78, 0x48,
+  0xe7, 0x0c, 0xdb, 0x01, 0x25, 0x56, 0xfe, 0x64, 0xbe, 0xd2, 0xda, 0x16,
+  0x14, 0xfb, 0xbe, 0x00, 0x07, 0x90, 0x18, 0x2d, 0xb7, 0x61, 0xbe, 0x95,
+  0xe8, 0xae, 0x81, 0x1e, 0xe8, 0xfc, 0xf8, 0x3c, 0x19, 0x1c, 0xdf, 0xca,
+  0xce, 0xd9, 0xb5, 0xc5, 0x17, 0xdb, 0xf0, 0x54, 0xaf, 0x1b, 0xfd, 0xfc,
+  0x2d, 0x4d, 0xdb, 0x05, 0xe9, 0xe5, 0x1c, 0xdf, 0xcb, 0x3a, 0xf7, 0xdd,
+  0x17, 0x2c, 0xa2, 0xe2, 0x2b, 0x1c, 0x9b, 0xa9, 0x60, 0x00, 0x23, 0xc4,
+  0x0b, 0xbe, 0x1f, 0xf8, 0xdd, 0xcd, 0x1c, 0x02, 0x3c, 0xdb, 0xbe, 0xe4,
+  0xaf, 0x42, 0xe6, 0xc5, 0xeb, 0xb4, 0xf1, 0xad, 0x59, 0xf4, 0xa4, 0x17,
+  0xc3, 0x37, 0x03, 0xc0, 0x34, 0xd3, 0x00, 0xf9, 0xaf, 0x33, 0xb8, 0x35,
+  0x18, 0x8b, 0x4e, 0x90, 0xe0, 0x0d, 0x01, 0x3e, 0xd7, 0x0f, 0xff, 0xd7,
+  0xb0, 0x00, 0x28, 0x16, 0xe4, 0xb9, 0x13, 0x23, 0xee, 0xff, 0xdd, 0x01,
+  0xd9, 0xd9, 0xde, 0xd0, 0x19, 0x22, 0x16, 0x43, 0xf8, 0x2a, 0x2d, 0x01,
+  0xdf, 0x81, 0x27, 0x24, 0xe5, 0x2b, 0xe1, 0x24, 0xe3, 0xf5, 0x21, 0xbf,
+  0x07, 0x12, 0x28, 0x51, 0xdb, 0x45, 0xe4, 0xf5, 0x2b, 0x09, 0x03, 0xc1,
+  0x0b, 0x11, 0xb3, 0xfb, 0x38, 0x0a, 0x0f, 0xbe, 0x45, 0xed, 0x3a, 0xe9,
+  0x00, 0xd7, 0x2d, 0x0a, 0xfc, 0xe0, 0xcc, 0xe7, 0x2f, 0xd1, 0x31, 0xdc,
+  0xea, 0x00, 0xbb, 0x05, 0x15, 0x0c, 0xde, 0x31, 0x0d, 0x12, 0x04, 0x00,
+  0x1e, 0x14, 0x3c, 0xeb, 0xf5, 0xcb, 0xfc, 0xfb, 0xe1, 0xf1, 0x16, 0xe8,
+  0x02, 0xfb, 0x61, 0x34, 0x22, 0x0e, 0xdb, 0xf6, 0x1f, 0xfe, 0x1e, 0xfa,
+  0xf9, 0xb8, 0xee, 0x0c, 0xeb, 0xaa, 0x2a, 0xfa, 0xea, 0x26, 0x02, 0xf8,
+  0xfa, 0x17, 0xf6, 0xf9, 0xce, 0xfd, 0x15, 0xe2, 0xf7, 0x1a, 0x1d, 0xe6,
+  0x10, 0x0c, 0x1b, 0xf6, 0x1c, 0xf8, 0x36, 0xe7, 0xf5, 0x09, 0xd2, 0x09,
+  0xf6, 0x75, 0xd2, 0x17, 0xd3, 0xc0, 0xb9, 0x2c, 0xb1, 0xe2, 0xcf, 0x07,
+  0xef, 0xec, 0x33, 0xe9, 0xe4, 0x81, 0x16, 0xa2, 0x03, 0xfe, 0xc5, 0x26,
+  0xfd, 0xf9, 0x07, 0x36, 0x4a, 0xdb, 0xda, 0x33, 0xd3, 0x5a, 0x22, 0xed,
+  0xb6, 0xfe, 0x01, 0xd7, 0xec, 0xc4, 0xe9, 0x2d, 0x4a, 0x10, 0x1d, 0x10,
+  0xdb, 0x09, 0x12, 0x40, 0xc7, 0x40, 0x18, 0xe8, 0x11, 0x20, 0xc7, 0xd4,
+  0xef, 0x29, 0xe4, 0x37, 0xe2, 0x05, 0xfc, 0xfd, 0x34, 0x06, 0x32, 0xf6,
+  0xfb, 0xde, 0xff, 0x3f, 0xe5, 0xc1, 0x3d, 0xf6, 0xec, 0xd7, 0xf5, 0x10,
+  0xea, 0x2c, 0xfd, 0x34, 0xbc, 0xf1, 0xf1, 0x1d, 0x6f, 0xf4, 0xdd, 0xe4,
+  0x07, 0xed, 0x07, 0x16, 0x14, 0xf9, 0x45, 0xf9, 0x14, 0x09, 0x28, 0x0e,
+  0x49, 0x03, 0xd5, 0x33, 0xfd, 0x87, 0xd8, 0x81, 0xdc, 0xe8, 0x22, 0xd0,
+  0xd5, 0x25, 0xfa, 0xe8, 0x25, 0xff, 0xc4, 0xec, 0xd7, 0x5c, 0x33, 0x24,
+  0x24, 0x12, 0xfc, 0x0a, 0x19, 0x39, 0x08, 0x10, 0xde, 0xf8, 0xc6, 0xca,
+  0x39, 0xe5, 0xc1, 0x1c, 0x02, 0xf9, 0x01, 0xdc, 0xec, 0xe9, 0xfe, 0xee,
+  0xfd, 0xf7, 0xe6, 0xc3, 0xf7, 0xd9, 0xa9, 0x28, 0xbd, 0x56, 0x2c, 0xfd,
+  0x1f, 0xec, 0xbb, 0xe4, 0x2d, 0x16, 0x03, 0x1f, 0x11, 0xe3, 0x20, 0xd1,
+  0xe4, 0xfe, 0xe4, 0x21, 0x10, 0xfa, 0x17, 0xf8, 0xd6, 0x11, 0x02, 0xec,
+  0x0d, 0x16, 0xe4, 0xe6, 0x0c, 0xb0, 0xeb, 0xd4, 0x29, 0xf6, 0x81, 0xb0,
+  0xd7, 0x0a, 0x43, 0xce, 0x0c, 0x33, 0x19, 0x2f, 0x4e, 0xe7, 0x8c, 0x08,
+  0xee, 0x24, 0xf9, 0xe1, 0xe7, 0xf6, 0x99, 0xa4, 0xe1, 0x1c, 0x09, 0x19,
+  0x49, 0xe4, 0x09, 0x02, 0x18, 0x02, 0x2c, 0x26, 0x20, 0x29, 0x1b, 0x19,
+  0x34, 0x09, 0x24, 0xf4, 0xf2, 0xf0, 0x0b, 0xf0, 0xde, 0x36, 0x24, 0xc5,
+  0x0e, 0x0b, 0xfe, 0xec, 0x2c, 0xeb, 0x1a, 0x00, 0x29, 0xba, 0xa7, 0x15,
+  0x32, 0x50, 0xb4, 0xff, 0x2c, 0xd4, 0x55, 0xd7, 0xd4, 0x01, 0xf5, 0x13,
+  0xe2, 0x0f, 0x10, 0xf0, 0x25, 0x00, 0xee, 0xc5, 0xfa, 0xe5, 0xbb, 0x37,
+  0xe1, 0x07, 0xf7, 0xfb, 0xfd, 0x09, 0xe9, 0xbf, 0x00, 0xe3, 0x81, 0xa4,
+  0xe8, 0xc4, 0x8c, 0x1d, 0x0e, 0x19, 0x02, 0x06, 0x0e, 0xfc, 0x8c, 0xa1,
+  0x04, 0xfd, 0xed, 0x32, 0x1d, 0xe1, 0x38, 0x24, 0x01, 0xe4, 0x2a, 0xf0,
+  0xd4, 0x3c, 0x7c, 0x34, 0xf2, 0x06, 0xac, 0xfe, 0x14, 0xca, 0x14, 0x0b,
+  0x6c, 0xce, 0x2a, 0xe3, 0xff, 0xfb, 0xcd, 0x17, 0x20, 0xcb, 0x0c, 0x02,
+  0xe4, 0x29, 0x21, 0x09, 0x00, 0xcc, 0x88, 0x0c, 0x45, 0xfc, 0x2d, 0x2f,
+  0xfe, 0xb7, 0x49, 0x07, 0x38, 0xe4, 0x0e, 0xfe, 0x26, 0xb4, 0xe8, 0x3a,
+  0x33, 0x06, 0x12, 0xde, 0xd5, 0xfa, 0x93, 0x7f, 0x47, 0xfa, 0x2e, 0xb2,
+  0x01, 0xef, 0xbb, 0xdf, 0xed, 0x33, 0x47, 0x0a, 0xd7, 0x24, 0x07, 0x17,
+  0x4b, 0x28, 0x26, 0x0b, 0x1b, 0xf6, 0xe1, 0xf3, 0xe0, 0xd3, 0x0f, 0xd8,
+  0x1c, 0xc9, 0x10, 0xed, 0x12, 0x0c, 0xf5, 0xa1, 0xfd, 0x13, 0xf7, 0x38,
+  0xfe, 0x12, 0xfe, 0x3f, 0x03, 0x01, 0xb0, 0x4f, 0x1a, 0x02, 0xf3, 0x14,
+  0x38, 0x60, 0xeb, 0x27, 0x85, 0xd7, 0x58, 0xe2, 0x33, 0x1c, 0x40, 0x0f,
+  0xb0, 0xbc, 0xcd, 0xe4, 0x38, 0x5b, 0xeb, 0x37, 0x27, 0x22, 0x3d, 0xc9,
+  0x09, 0x48, 0xdc, 0x3f, 0xf6, 0xd0, 0xd7, 0xb3, 0x0d, 0xf8, 0x0e, 0x1f,
+  0x2f, 0xee, 0xcb, 0x5d, 0xd9, 0x24, 0xf8, 0x17, 0xe4, 0xfb, 0x45, 0x10,
+  0xef, 0xb1, 0xd4, 0xf6, 0x31, 0xea, 0x0a, 0xd7, 0x11, 0x7f, 0x75, 0x2d,
+  0x53, 0xf5, 0xc4, 0x05, 0x2b, 0x49, 0xac, 0x43, 0x13, 0x96, 0x72, 0xab,
+  0xbf, 0xea, 0xed, 0x31, 0x17, 0x24, 0xcb, 0xd3, 0xee, 0xda, 0x3c, 0x42,
+  0x2f, 0xfe, 0x5a, 0x46, 0xcd, 0x4e, 0x30, 0x3c, 0xec, 0xa5, 0x15, 0x0b,
+  0xcf, 0x06, 0x5a, 0xdb, 0xb9, 0xfa, 0x2d, 0x07, 0xf7, 0x0c, 0xa1, 0x21,
+  0xea, 0x2c, 0x81, 0xfe, 0xd8, 0xfd, 0xcc, 0x98, 0xf3, 0x1d, 0x1e, 0x56,
+  0x95, 0x04, 0x1c, 0xf5, 0x09, 0xd7, 0xfd, 0xe2, 0x33, 0xe5, 0x31, 0xe4,
+  0xee, 0x4d, 0xca, 0x0a, 0xf2, 0xcf, 0x11, 0x32, 0xdd, 0x17, 0xec, 0x2d,
+  0xcd, 0x32, 0x05, 0x2f, 0x14, 0x4e, 0xec, 0x2a, 0x03, 0xe1, 0xf4, 0xa9,
+  0x3d, 0x05, 0x62, 0x22, 0xc2, 0x29, 0x13, 0x01, 0x24, 0x20, 0x21, 0x0c,
+  0xd5, 0x5a, 0x0b, 0x97, 0x4f, 0x00, 0xf0, 0x14, 0xbf, 0xea, 0xeb, 0x09,
+  0xef, 0xe9, 0x19, 0x28, 0x38, 0x03, 0xf6, 0x12, 0x28, 0x09, 0xf8, 0x0f,
+  0x08, 0x11, 0xdf, 0xeb, 0x4e, 0x30, 0x2a, 0xeb, 0xff, 0x19, 0xd4, 0x1b,
+  0xf3, 0xcb, 0x08, 0xdc, 0x22, 0x0a, 0x50, 0x0a, 0x06, 0xde, 0xec, 0x20,
+  0x54, 0x04, 0x10, 0xc0, 0x2c, 0x36, 0x44, 0x2b, 0x41, 0x14, 0xf9, 0x17,
+  0xd2, 0x81, 0x1d, 0xee, 0xd5, 0xfe, 0x10, 0xfd, 0xfd, 0xe5, 0xdf, 0x1f,
+  0xfc, 0x0b, 0xd4, 0x11, 0xe9, 0xc4, 0xec, 0x10, 0x29, 0x0d, 0xcb, 0x14,
+  0xfe, 0xef, 0xf2, 0xe9, 0x0c, 0x97, 0xca, 0xb6, 0xe0, 0x17, 0x96, 0x0d,
+  0x22, 0xdc, 0x10, 0x1e, 0xde, 0x03, 0xee, 0xf6, 0x38, 0x50, 0x03, 0xd1,
+  0xee, 0xe0, 0x10, 0xf1, 0x0a, 0xd7, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0xc5, 0xa3, 0xff, 0xff, 0x04, 0xea, 0xff, 0xff,
+  0x1b, 0x10, 0x00, 0x00, 0x04, 0xc2, 0xff, 0xff, 0x72, 0x11, 0x00, 0x00,
+  0xc2, 0xfc, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00, 0xa9, 0xf0, 0xff, 0xff,
+  0xee, 0x3c, 0x00, 0x00, 0xb2, 0xfe, 0xff, 0xff, 0x91, 0x5f, 0x00, 0x00,
+  0x65, 0x30, 0x00, 0x00, 0xb9, 0xf6, 0xff, 0xff, 0x02, 0x9d, 0xff, 0xff,
+  0xd7, 0x04, 0x00, 0x00, 0x9e, 0x11, 0x00, 0x00, 0x56, 0xd7, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xeb, 0x1a, 0xeb, 0xfc,
+  0x03, 0xde, 0xd1, 0xeb, 0x4d, 0xd1, 0x0e, 0xfb, 0x54, 0xaf, 0x0a, 0x81,
+  0x88, 0x75, 0x81, 0x95, 0x95, 0x33, 0x0e, 0x4e, 0xe3, 0x0e, 0x61, 0xc5,
+  0x18, 0x68, 0x28, 0x17, 0xb6, 0x81, 0xaf, 0xd3, 0xbd, 0xeb, 0x3b, 0x86,
+  0xa3, 0x5a, 0x32, 0x2a, 0x36, 0x6e, 0xaa, 0x79, 0xba, 0xae, 0xe2, 0xcc,
+  0x81, 0x02, 0xfc, 0x96, 0xf9, 0xf8, 0xf2, 0xbd, 0xe5, 0x05, 0xb5, 0xd2,
+  0x2f, 0xf5, 0x1d, 0x10, 0xfa, 0x21, 0x81, 0xfa, 0x17, 0xf5, 0xf1, 0x2e,
+  0x0d, 0xe3, 0xf8, 0xd4, 0xc6, 0x74, 0x81, 0xd0, 0x52, 0xe3, 0xe2, 0x91,
+  0x20, 0x8e, 0xff, 0xdb, 0x49, 0xcb, 0x89, 0xbb, 0xed, 0xe2, 0x0e, 0xff,
+  0xba, 0x34, 0x0e, 0xe6, 0xc9, 0xda, 0x7f, 0xe1, 0xeb, 0x0f, 0xbc, 0x10,
+  0x8a, 0x70, 0x7f, 0xd9, 0x51, 0x5c, 0xd4, 0x8b, 0x74, 0x2a, 0xc1, 0x22,
+  0x64, 0xc3, 0x08, 0x55, 0xbe, 0x13, 0x04, 0xb9, 0x57, 0x13, 0x57, 0x7f,
+  0xb9, 0xea, 0xf3, 0xcf, 0xee, 0x4f, 0xeb, 0xc9, 0xe9, 0x0e, 0x03, 0x33,
+  0x81, 0x50, 0xd5, 0x97, 0xc6, 0xed, 0x71, 0xf0, 0xf4, 0x08, 0x1c, 0xc4,
+  0xd0, 0xbb, 0x19, 0x9f, 0x81, 0x77, 0x39, 0x3b, 0xbb, 0xc6, 0x14, 0xf9,
+  0xf4, 0x44, 0x94, 0x14, 0x48, 0xbe, 0x00, 0x4b, 0x97, 0x1e, 0x6a, 0x0d,
+  0x7f, 0x78, 0xc5, 0x4e, 0xfa, 0xb2, 0xcc, 0x37, 0xa1, 0xe5, 0x60, 0x01,
+  0x24, 0xf6, 0xfc, 0x05, 0x1e, 0x01, 0x0b, 0x7f, 0xc9, 0x2c, 0xf0, 0x1a,
+  0xef, 0xde, 0x35, 0x16, 0xe9, 0xf5, 0x7f, 0x23, 0xae, 0x09, 0xf5, 0x19,
+  0x13, 0x51, 0x19, 0xb6, 0x64, 0xc1, 0x69, 0x06, 0x5a, 0x5e, 0x41, 0x3c,
+  0xf2, 0x14, 0x3f, 0x12, 0x72, 0x3f, 0x7f, 0xea, 0xfb, 0x66, 0xf6, 0xd0,
+  0x11, 0x56, 0x81, 0x04, 0xd1, 0xf7, 0xb6, 0xf2, 0xe2, 0x4c, 0x02, 0xdc,
+  0xed, 0x3b, 0x54, 0xcd, 0x1a, 0x3b, 0x1c, 0xf9, 0x04, 0x01, 0xfb, 0x01,
+  0x69, 0xcb, 0x3b, 0x7f, 0x02, 0x35, 0x7f, 0xba, 0xf4, 0xf8, 0xf4, 0xc5,
+  0xde, 0x2c, 0xb6, 0x10, 0xcb, 0xea, 0x5a, 0xb3, 0xb5, 0xe4, 0xd5, 0xbc,
+  0x7f, 0x5a, 0x05, 0xf3, 0x4a, 0x44, 0x24, 0x1a, 0x07, 0x35, 0xcb, 0x2b,
+  0x41, 0x74, 0x6b, 0x4a, 0x44, 0xc8, 0x13, 0x1d, 0x9d, 0x7f, 0x40, 0x69,
+  0x6a, 0x36, 0xd3, 0x31, 0x6e, 0xe5, 0x11, 0x59, 0xf7, 0x07, 0xdc, 0x4a,
+  0xe4, 0x15, 0x81, 0x03, 0x3e, 0xbc, 0xfb, 0xf1, 0xcd, 0xc4, 0xdd, 0x7f,
+  0xef, 0xe8, 0xdf, 0x33, 0xe5, 0x23, 0x20, 0x05, 0xbb, 0x1e, 0x06, 0x4e,
+  0xd0, 0xf5, 0x91, 0xc4, 0x5a, 0xe1, 0xd4, 0x2e, 0x54, 0x7f, 0x3a, 0x26,
+  0xa4, 0xf6, 0xf4, 0xdc, 0xa5, 0xed, 0xfa, 0x29, 0x20, 0x4a, 0x7f, 0x48,
+  0xf3, 0x6d, 0xf3, 0xc4, 0xff, 0x16, 0xc0, 0xa1, 0x09, 0x98, 0x1e, 0x0a,
+  0x7f, 0x21, 0x63, 0xf3, 0x1f, 0x23, 0x30, 0x20, 0xd9, 0x49, 0x00, 0xfa,
+  0x47, 0x81, 0x4f, 0xfa, 0x11, 0x0a, 0xe9, 0x4c, 0x3d, 0xf3, 0xe6, 0x12,
+  0x70, 0xd4, 0xfd, 0x12, 0x28, 0x2c, 0x7f, 0x3a, 0x26, 0x03, 0xb6, 0x0a,
+  0x11, 0x1e, 0xf2, 0x57, 0xf9, 0xcd, 0x2d, 0xac, 0x02, 0xed, 0xc1, 0x08,
+  0x0d, 0x6e, 0x23, 0x97, 0x42, 0x81, 0x33, 0xf1, 0xfe, 0xde, 0x1a, 0x40,
+  0xb6, 0x16, 0xb6, 0xa7, 0x7f, 0xcd, 0xc9, 0x0f, 0xa6, 0x3d, 0xb8, 0x5a,
+  0xdc, 0x01, 0xdf, 0x16, 0x27, 0x1e, 0xd6, 0x2f, 0xfc, 0x7f, 0xae, 0xf9,
+  0x1d, 0x65, 0xe5, 0x41, 0x8b, 0xf1, 0xaf, 0x2a, 0xd1, 0x27, 0xc3, 0xdf,
+  0x39, 0xe6, 0xf0, 0x47, 0xb8, 0x38, 0xd4, 0xe1, 0xd9, 0x47, 0xf9, 0x7f,
+  0x0e, 0xa4, 0x76, 0x24, 0x7f, 0x08, 0x98, 0x00, 0xb9, 0x0c, 0xee, 0xd9,
+  0xea, 0x32, 0x54, 0x43, 0xd7, 0x22, 0xf5, 0xf1, 0x81, 0x39, 0x2b, 0xe7,
+  0x2c, 0xac, 0x0b, 0x0c, 0x45, 0x5e, 0xf1, 0x3a, 0x81, 0x02, 0x27, 0x31,
+  0xcd, 0x26, 0xb8, 0xfc, 0xbe, 0xd7, 0x47, 0xe5, 0xdd, 0x02, 0xf9, 0x71,
+  0xec, 0xf2, 0x01, 0xb3, 0x57, 0xe9, 0x12, 0x49, 0x03, 0xf6, 0xe9, 0xff,
+  0xc2, 0x16, 0xd8, 0x7f, 0x67, 0xca, 0x15, 0xdd, 0xf5, 0x33, 0xbe, 0xd6,
+  0xed, 0x81, 0xbc, 0x1b, 0xf0, 0xee, 0x41, 0xf0, 0xe9, 0x0c, 0xcd, 0xfa,
+  0xe2, 0x7f, 0xf3, 0x3a, 0xfe, 0x0c, 0x4e, 0x1b, 0x42, 0x24, 0xe5, 0xf2,
+  0xf9, 0xea, 0x21, 0xbc, 0x0b, 0xa3, 0x2c, 0xde, 0x81, 0x3d, 0xa8, 0xde,
+  0x2f, 0x26, 0x60, 0x2a, 0x93, 0x5c, 0x1a, 0x9f, 0x47, 0x13, 0x47, 0xb8,
+  0x0e, 0xf7, 0xb2, 0x14, 0xc8, 0xab, 0x81, 0x11, 0x49, 0x1c, 0x81, 0xac,
+  0xcd, 0xe5, 0x36, 0xc1, 0x0e, 0xb9, 0xe6, 0xbf, 0x50, 0x0c, 0xd4, 0xf0,
+  0xb0, 0x0e, 0xc0, 0x81, 0xae, 0xcf, 0x1e, 0x95, 0x0c, 0xdd, 0x28, 0xad,
+  0x65, 0x4c, 0x0c, 0x71, 0x9d, 0x81, 0xd8, 0x34, 0x18, 0x01, 0xb3, 0xeb,
+  0xfc, 0xef, 0x45, 0xcf, 0x8a, 0x19, 0xda, 0x2c, 0xd1, 0x4a, 0xfe, 0x81,
+  0x3e, 0x27, 0x0b, 0xa0, 0x41, 0x20, 0xe0, 0xea, 0x5e, 0x03, 0xef, 0x1c,
+  0xf2, 0x1a, 0x20, 0xf6, 0x7f, 0x5e, 0x3d, 0x13, 0x0c, 0xfb, 0xe9, 0xb4,
+  0x9c, 0xb0, 0xea, 0xd9, 0x5a, 0x04, 0x1f, 0x0a, 0x1c, 0x06, 0x16, 0x32,
+  0x0e, 0xaa, 0x24, 0xda, 0x7f, 0xf0, 0xf3, 0xec, 0xf9, 0xaf, 0x81, 0x0a,
+  0xd0, 0xab, 0xf8, 0x6b, 0x0f, 0xc1, 0x15, 0xde, 0xc3, 0x7b, 0x3c, 0xf9,
+  0xec, 0x81, 0x32, 0x17, 0xf6, 0x08, 0x96, 0x7e, 0x14, 0x9d, 0x44, 0x2d,
+  0x0e, 0x6a, 0x58, 0x35, 0xd3, 0xaa, 0xdf, 0x7f, 0x2d, 0xf6, 0x5f, 0x09,
+  0x1d, 0xaa, 0x92, 0xb9, 0x2a, 0xd1, 0x9b, 0x26, 0xa4, 0x23, 0xf7, 0xe2,
+  0xd7, 0x57, 0x10, 0xcb, 0x25, 0xed, 0x39, 0xec, 0xfc, 0x81, 0xa9, 0xf3,
+  0xaf, 0x2b, 0x24, 0x81, 0xf1, 0xd4, 0x70, 0x78, 0xbb, 0xe3, 0xf3, 0x64,
+  0xad, 0x15, 0xb5, 0xeb, 0x44, 0x2a, 0x81, 0xe6, 0x38, 0xa5, 0x2b, 0x22,
+  0xb3, 0x47, 0xbe, 0x0b, 0x42, 0xd5, 0xb6, 0xd9, 0x9f, 0x00, 0xd7, 0x70,
+  0xa2, 0x00, 0xb3, 0xc8, 0xc2, 0x81, 0x0b, 0xdb, 0xc1, 0x22, 0xf8, 0x7e,
+  0x81, 0xf9, 0x0d, 0xd7, 0x05, 0x24, 0x25, 0x02, 0x24, 0xdd, 0xda, 0xc6,
+  0xa0, 0xa2, 0xbf, 0x10, 0xf6, 0xea, 0x85, 0x9b, 0xf1, 0xeb, 0xea, 0x4d,
+  0xfd, 0xba, 0xa1, 0x1e, 0xc5, 0x2c, 0x56, 0x7f, 0xdf, 0x9c, 0x08, 0x08,
+  0xbf, 0x26, 0x5c, 0xce, 0xdb, 0xcc, 0x15, 0xe0, 0xd9, 0x14, 0x81, 0x61,
+  0xf6, 0xf5, 0xf1, 0x02, 0x13, 0xff, 0x3d, 0x4c, 0xc4, 0xf1, 0x81, 0xe2,
+  0x1e, 0xf0, 0x00, 0x45, 0x5e, 0x2d, 0xc2, 0xec, 0x81, 0x08, 0xaf, 0xcf,
+  0x03, 0xfc, 0xf8, 0x38, 0x23, 0xda, 0x11, 0xd4, 0xec, 0xf3, 0xfd, 0xea,
+  0x53, 0x09, 0x37, 0x0f, 0x16, 0x46, 0xf9, 0x1f, 0xcf, 0x24, 0x81, 0xd4,
+  0x41, 0x25, 0x15, 0xf3, 0x37, 0xf5, 0xd6, 0xd8, 0x18, 0x81, 0xd0, 0xff,
+  0xcc, 0xb2, 0xff, 0x20, 0xe6, 0x1d, 0x03, 0x1c, 0x2d, 0x1d, 0xbb, 0xdd,
+  0x16, 0x7f, 0xea, 0x1f, 0x05, 0xe9, 0xd3, 0xc3, 0xf6, 0xce, 0x06, 0xe3,
+  0x81, 0xd4, 0x1e, 0xd9, 0x07, 0x5e, 0xd9, 0x35, 0x17, 0x06, 0x1a, 0x29,
+  0x08, 0xf6, 0xd4, 0x1d, 0xce, 0xe2, 0x81, 0xb6, 0xe5, 0x03, 0xf9, 0x6a,
+  0x53, 0xf8, 0x5d, 0x0b, 0x1b, 0x18, 0xfe, 0xe1, 0xeb, 0x23, 0xfc, 0x7f,
+  0xd7, 0x4e, 0xfe, 0x68, 0xff, 0x50, 0x68, 0x23, 0x0f, 0x81, 0xcc, 0xe7,
+  0xb9, 0xfe, 0x19, 0xe8, 0xe4, 0x03, 0x01, 0xf2, 0xe0, 0x7f, 0x68, 0x16,
+  0xea, 0xde, 0x93, 0xd2, 0xce, 0x7a, 0x18, 0xd0, 0xeb, 0xc2, 0xfc, 0x09,
+  0x46, 0x23, 0xe7, 0x7f, 0xee, 0xe4, 0x1a, 0x10, 0x04, 0xdf, 0x47, 0x40,
+  0xec, 0x14, 0xa4, 0xf1, 0x24, 0x7f, 0xcd, 0x3e, 0xdd, 0xa4, 0x3d, 0xc6,
+  0xf6, 0xb6, 0x2f, 0xf8, 0x1d, 0xe5, 0x29, 0x5e, 0xda, 0xfa, 0x81, 0x19,
+  0xe2, 0x89, 0x9d, 0x0c, 0x9f, 0x71, 0xd9, 0x81, 0xf4, 0xdc, 0xae, 0xb6,
+  0x2a, 0xd9, 0xd0, 0x27, 0x4e, 0x29, 0x03, 0x0a, 0xd1, 0x0c, 0xee, 0xe3,
+  0xed, 0x81, 0xec, 0x01, 0x21, 0xe7, 0xf8, 0xea, 0x48, 0x24, 0x40, 0xee,
+  0xff, 0xf1, 0xd4, 0x21, 0xf3, 0x66, 0xd7, 0x17, 0x19, 0x55, 0x7f, 0xde,
+  0xdf, 0xc7, 0xf9, 0x0f, 0x81, 0x34, 0xe0, 0xa1, 0x3f, 0x4e, 0x09, 0x60,
+  0x3e, 0x01, 0xf9, 0x4a, 0x69, 0xc6, 0x49, 0x30, 0xb7, 0xb7, 0xfb, 0xdb,
+  0x7f, 0xea, 0xf4, 0x2d, 0xe9, 0xdf, 0x6b, 0xd8, 0x26, 0x04, 0x5f, 0x71,
+  0x4e, 0xe5, 0x81, 0x39, 0x50, 0xcf, 0x14, 0x44, 0xd7, 0xb3, 0x9e, 0x06,
+  0x3d, 0x12, 0xfe, 0x92, 0x0b, 0x81, 0x90, 0x0f, 0x24, 0x12, 0xc6, 0x18,
+  0xdf, 0xa7, 0x14, 0xed, 0x5f, 0x15, 0x45, 0x34, 0xa5, 0xf4, 0x11, 0x2f,
+  0x81, 0xed, 0xf2, 0x02, 0x57, 0xdc, 0x0a, 0xf0, 0x50, 0x72, 0xc0, 0x24,
+  0x28, 0x1d, 0x07, 0xfa, 0x20, 0x01, 0x2e, 0x39, 0x81, 0x2a, 0x2a, 0x52,
+  0x81, 0xad, 0x05, 0xdd, 0xca, 0xff, 0x5e, 0x21, 0xbf, 0x18, 0x5f, 0x46,
+  0xcb, 0x89, 0xd3, 0x54, 0xc7, 0xf3, 0x24, 0x5e, 0xed, 0x92, 0x40, 0x3c,
+  0x3a, 0xa8, 0x2e, 0x49, 0xbd, 0x7f, 0xe7, 0x62, 0x43, 0x3a, 0xe2, 0xfe,
+  0xb5, 0x30, 0x94, 0xc1, 0x3f, 0xc9, 0xbd, 0x10, 0x4b, 0x81, 0x24, 0x32,
+  0xbb, 0xdc, 0x41, 0xde, 0xf8, 0xe8, 0xe8, 0xc3, 0x01, 0x27, 0x0e, 0x22,
+  0xab, 0x7f, 0xd9, 0x3e, 0x22, 0x4e, 0x10, 0x8a, 0x16, 0x25, 0x60, 0xf2,
+  0x06, 0x21, 0xb9, 0x1d, 0x7f, 0x04, 0x03, 0xf4, 0x32, 0xa1, 0x26, 0x81,
+  0x17, 0x2c, 0x13, 0x6d, 0x70, 0xf9, 0x1a, 0xf8, 0xd9, 0xde, 0xad, 0xdd,
+  0x25, 0x20, 0x01, 0xe3, 0x64, 0x88, 0xfa, 0xe8, 0x03, 0x7c, 0x81, 0x0b,
+  0xd3, 0x18, 0x18, 0xf7, 0xbd, 0x0d, 0x1e, 0x22, 0x31, 0x6b, 0x76, 0x59,
+  0xcd, 0x4f, 0xc3, 0xe6, 0xa4, 0x47, 0x03, 0x81, 0x0b, 0xa1, 0xc8, 0x3b,
+  0xfd, 0xd9, 0x81, 0x17, 0xda, 0x1f, 0xcf, 0xf6, 0xc8, 0x0c, 0xe0, 0x8b,
+  0x81, 0x48, 0xd6, 0xed, 0x00, 0xcc, 0xd6, 0x14, 0xc7, 0xff, 0xf5, 0xb1,
+  0x93, 0xc9, 0xb3, 0xfb, 0x15, 0x01, 0x15, 0x7f, 0x15, 0xd3, 0x4a, 0xfe,
+  0xef, 0x0b, 0xcf, 0xbd, 0xf4, 0x59, 0xad, 0xf2, 0xd2, 0xfa, 0x7f, 0x14,
+  0x94, 0xdd, 0x41, 0x3c, 0x10, 0xe1, 0x1c, 0x25, 0xc2, 0x12, 0xf4, 0x0e,
+  0xdb, 0xd5, 0x9f, 0x3e, 0x32, 0x56, 0x40, 0x0a, 0xeb, 0xd7, 0x81, 0x92,
+  0x53, 0x10, 0x0e, 0x05, 0x27, 0x07, 0x1a, 0xa0, 0xd6, 0xd3, 0xa9, 0x17,
+  0x7f, 0xf4, 0x29, 0xa5, 0xd6, 0xe4, 0x39, 0xa2, 0xd0, 0x53, 0x16, 0x39,
+  0xa4, 0x4d, 0x6a, 0x7f, 0xec, 0xeb, 0xec, 0x77, 0x42, 0xfb, 0xf5, 0x6f,
+  0x01, 0x5f, 0x23, 0x14, 0x3a, 0x13, 0xf6, 0xc2, 0xa3, 0x09, 0xd4, 0x18,
+  0xeb, 0x81, 0xc2, 0xc6, 0xde, 0x23, 0xfd, 0xd6, 0x81, 0xec, 0xd4, 0x12,
+  0xab, 0x3b, 0x5d, 0x4a, 0xf7, 0x0c, 0x0a, 0x06, 0x51, 0xe8, 0x68, 0x2f,
+  0x81, 0xc7, 0x20, 0x2a, 0xdb, 0xba, 0xf6, 0xcc, 0x1b, 0xf9, 0xe8, 0xca,
+  0xbe, 0x89, 0x2a, 0x81, 0x25, 0x24, 0xf8, 0xec, 0x6b, 0xdd, 0xf8, 0x45,
+  0x17, 0x17, 0xd3, 0x35, 0xd7, 0xb9, 0x81, 0xcf, 0x44, 0x14, 0x9f, 0x2b,
+  0x7a, 0x22, 0x97, 0x5b, 0xdd, 0x44, 0xeb, 0x30, 0x62, 0xdd, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x38, 0x10, 0x00, 0x00,
+  0xde, 0x0f, 0x00, 0x00, 0x1d, 0x08, 0x00, 0x00, 0x16, 0xfa, 0xff, 0xff,
+  0x45, 0x08, 0x00, 0x00, 0x89, 0x1a, 0x00, 0x00, 0xe5, 0x1c, 0x00, 0x00,
+  0xdc, 0x06, 0x00, 0x00, 0x19, 0x03, 0x00, 0x00, 0xb2, 0x18, 0x00, 0x00,
+  0xb2, 0x00, 0x00, 0x00, 0xff, 0xf5, 0xff, 0xff, 0x30, 0x08, 0x00, 0x00,
+  0x0d, 0x08, 0x00, 0x00, 0x9f, 0x02, 0x00, 0x00, 0x7a, 0xff, 0xff, 0xff,
+  0x3d, 0x0b, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00, 0x6d, 0xf8, 0xff, 0xff,
+  0x8f, 0xfd, 0xff, 0xff, 0x97, 0x0c, 0x00, 0x00, 0x15, 0x24, 0x00, 0x00,
+  0x5c, 0x36, 0x00, 0x00, 0xe2, 0xfb, 0xff, 0xff, 0x80, 0xf4, 0xff, 0xff,
+  0xe8, 0xfc, 0xff, 0xff, 0xf9, 0x1f, 0x00, 0x00, 0x2f, 0xf9, 0xff, 0xff,
+  0x48, 0x0a, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x35, 0x19, 0x00, 0x00,
+  0x8e, 0xfd, 0xff, 0xff, 0x08, 0x1c, 0x00, 0x00, 0x7c, 0x0f, 0x00, 0x00,
+  0x86, 0x0d, 0x00, 0x00, 0xf9, 0xed, 0xff, 0xff, 0x6e, 0x03, 0x00, 0x00,
+  0x3f, 0xf4, 0xff, 0xff, 0x8c, 0x06, 0x00, 0x00, 0x55, 0x07, 0x00, 0x00,
+  0x93, 0x0a, 0x00, 0x00, 0x24, 0x06, 0x00, 0x00, 0x8b, 0x08, 0x00, 0x00,
+  0x0e, 0x02, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00,
+  0x43, 0x11, 0x00, 0x00, 0xa2, 0x10, 0x00, 0x00, 0x74, 0x14, 0x00, 0x00,
+  0xc9, 0x07, 0x00, 0x00, 0x51, 0x20, 0x00, 0x00, 0xbe, 0x06, 0x00, 0x00,
+  0x10, 0xf9, 0xff, 0xff, 0xf4, 0x0a, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00,
+  0xea, 0x08, 0x00, 0x00, 0x44, 0x08, 0x00, 0x00, 0xa4, 0x09, 0x00, 0x00,
+  0x97, 0x13, 0x00, 0x00, 0xe4, 0xfe, 0xff, 0xff, 0x97, 0xfc, 0xff, 0xff,
+  0xcb, 0x14, 0x00, 0x00, 0x98, 0x06, 0x00, 0x00, 0xce, 0x16, 0x00, 0x00,
+  0x4d, 0x0f, 0x00, 0x00, 0xfc, 0x0e, 0x00, 0x00, 0x25, 0xf1, 0xff, 0xff,
+  0x22, 0x0a, 0x00, 0x00, 0x3a, 0x0e, 0x00, 0x00, 0x5f, 0xfd, 0xff, 0xff,
+  0x36, 0x12, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x00,
+  0x3e, 0x08, 0x00, 0x00, 0xa2, 0x0b, 0x00, 0x00, 0xa9, 0x07, 0x00, 0x00,
+  0x6a, 0x01, 0x00, 0x00, 0x56, 0x06, 0x00, 0x00, 0x1f, 0x09, 0x00, 0x00,
+  0xdc, 0x09, 0x00, 0x00, 0x5f, 0x09, 0x00, 0x00, 0xbd, 0x05, 0x00, 0x00,
+  0x58, 0x1d, 0x00, 0x00, 0x6b, 0x0a, 0x00, 0x00, 0x6d, 0x08, 0x00, 0x00,
+  0x96, 0x0a, 0x00, 0x00, 0x6e, 0xfd, 0xff, 0xff, 0x95, 0xf9, 0xff, 0xff,
+  0x40, 0x33, 0x00, 0x00, 0xa1, 0xff, 0xff, 0xff, 0x51, 0x03, 0x00, 0x00,
+  0x25, 0xf9, 0xff, 0xff, 0x35, 0x16, 0x00, 0x00, 0x41, 0x0a, 0x00, 0x00,
+  0x34, 0xf9, 0xff, 0xff, 0x1a, 0xfc, 0xff, 0xff, 0xee, 0xde, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x00, 0x2e, 0xf5, 0xda, 0x50,
+  0xf1, 0xfe, 0x2b, 0x3a, 0x38, 0xaf, 0x81, 0x65, 0xd1, 0xa1, 0xc4, 0xf4,
+  0xd1, 0xf8, 0x2f, 0x3c, 0x57, 0x45, 0x57, 0x7f, 0xf1, 0x67, 0xe9, 0x32,
+  0xad, 0x0a, 0x15, 0xce, 0xe5, 0xf4, 0xa9, 0x69, 0xb8, 0x43, 0x04, 0xc4,
+  0x34, 0xc9, 0x3e, 0x68, 0xcf, 0xed, 0x07, 0xc4, 0xf1, 0xb0, 0xfc, 0x09,
+  0x56, 0x4c, 0xa0, 0xe7, 0xa5, 0xa0, 0x9e, 0x81, 0x93, 0x1e, 0x81, 0xfb,
+  0xd8, 0x15, 0x78, 0xde, 0xfc, 0x2d, 0x60, 0xe0, 0xd5, 0x1a, 0x16, 0xc8,
+  0x21, 0xb8, 0xe4, 0x40, 0x22, 0x8b, 0x48, 0xcc, 0x92, 0xd0, 0x07, 0x14,
+  0x91, 0x21, 0xa2, 0x7f, 0x77, 0xf1, 0x7f, 0x3d, 0xe4, 0xdd, 0xca, 0x45,
+  0x11, 0x43, 0xd6, 0x31, 0x7f, 0x09, 0xbe, 0x7f, 0xe1, 0xa2, 0x97, 0x58,
+  0xae, 0x3b, 0x06, 0x7f, 0x5d, 0xf9, 0x60, 0x74, 0xfb, 0x7f, 0x17, 0x2b,
+  0xd0, 0x7f, 0xee, 0x81, 0x46, 0x58, 0xf4, 0x6a, 0x2c, 0x3b, 0xf7, 0x8c,
+  0x7f, 0x01, 0x4f, 0x7f, 0xdf, 0x81, 0x7f, 0x9d, 0x0d, 0x81, 0x0b, 0xe1,
+  0x55, 0x7f, 0x9d, 0x81, 0xe9, 0xc3, 0x91, 0xa3, 0xe3, 0xbb, 0xd2, 0x2c,
+  0xf0, 0x49, 0x7f, 0xeb, 0x0d, 0x7f, 0x7f, 0x02, 0xd5, 0x12, 0xdd, 0x9a,
+  0x37, 0xba, 0x0e, 0x73, 0xff, 0xe6, 0x7f, 0xa1, 0xc3, 0xac, 0x64, 0x76,
+  0x6e, 0x48, 0x81, 0x0a, 0x7b, 0xcd, 0x54, 0x55, 0x18, 0xd5, 0xcf, 0x46,
+  0xfc, 0xe9, 0xe7, 0x25, 0x1b, 0x2f, 0x85, 0x5a, 0xbe, 0xc6, 0xce, 0xc6,
+  0xd3, 0xe9, 0x3a, 0x27, 0x6b, 0x4a, 0x52, 0x64, 0xe7, 0x0b, 0x26, 0x33,
+  0xce, 0x13, 0x0b, 0xd6, 0xee, 0xb0, 0xac, 0x7f, 0xa3, 0x26, 0x03, 0xfb,
+  0x1a, 0x4b, 0x1c, 0x6a, 0xc4, 0xe6, 0x09, 0xe5, 0x1c, 0xaf, 0xe8, 0xfc,
+  0x35, 0x1d, 0xeb, 0xfc, 0x6e, 0xa8, 0x97, 0x9f, 0x81, 0x20, 0xa0, 0xfb,
+  0x4a, 0x0e, 0x62, 0xe7, 0xeb, 0x33, 0x4e, 0xa9, 0xe1, 0xbd, 0x15, 0xa6,
+  0x0c, 0xb8, 0xaf, 0x25, 0x11, 0xac, 0x1a, 0xe2, 0x87, 0xdd, 0xf8, 0x08,
+  0xae, 0x0d, 0xbf, 0x4e, 0x39, 0x26, 0x62, 0x2a, 0x7f, 0xc3, 0x25, 0x4f,
+  0xed, 0xc3, 0x7f, 0x28, 0xe5, 0x82, 0xc0, 0x70, 0xc9, 0xb1, 0x98, 0x4f,
+  0xd7, 0xcb, 0x6e, 0x2f, 0x81, 0x24, 0x8a, 0xcc, 0xcc, 0x43, 0x81, 0x1a,
+  0xa2, 0x2d, 0x7f, 0xd6, 0xfa, 0x23, 0xf0, 0x61, 0x98, 0x3f, 0xf6, 0xa2,
+  0x49, 0x81, 0x11, 0x4c, 0xbd, 0xa9, 0xfb, 0x8a, 0x81, 0xb1, 0xbd, 0x3d,
+  0x6d, 0xe4, 0x26, 0xfe, 0x81, 0xf7, 0xbd, 0xfa, 0xa2, 0x81, 0x9e, 0x59,
+  0x81, 0xe2, 0x67, 0xab, 0xce, 0xee, 0xc6, 0x83, 0x81, 0x2b, 0x62, 0xa7,
+  0x26, 0x2a, 0x8a, 0xec, 0x7f, 0x81, 0xe0, 0x7c, 0x9d, 0x13, 0x1a, 0x56,
+  0xcc, 0x24, 0xf8, 0x59, 0x17, 0xac, 0x32, 0x05, 0x89, 0x0e, 0xcc, 0x41,
+  0xcb, 0x81, 0x86, 0x81, 0x73, 0xe4, 0xf5, 0x7b, 0xc2, 0x9d, 0xf9, 0x7f,
+  0x81, 0x81, 0x7f, 0x7a, 0xff, 0x81, 0x81, 0x1f, 0x81, 0x49, 0x13, 0x36,
+  0x81, 0xf8, 0xa7, 0xf0, 0x94, 0x4c, 0x7f, 0xd6, 0xe9, 0x72, 0x7f, 0xb1,
+  0xbc, 0x11, 0xeb, 0x13, 0x11, 0xb2, 0xb2, 0x81, 0xfe, 0x92, 0xe8, 0x7f,
+  0x7f, 0x44, 0x7f, 0xad, 0x05, 0x29, 0x7f, 0x10, 0x43, 0xf2, 0x87, 0x7f,
+  0xe8, 0x81, 0x1d, 0x7f, 0x00, 0x61, 0x9d, 0xb3, 0x9a, 0x2a, 0x81, 0xf0,
+  0x7f, 0x7f, 0x26, 0x81, 0xbb, 0xdb, 0x8f, 0x43, 0x81, 0xcb, 0x7f, 0x75,
+  0x7f, 0x3a, 0x8f, 0xe1, 0x81, 0xa5, 0xca, 0x7f, 0x53, 0x00, 0x47, 0x56,
+  0xfb, 0xdb, 0xfe, 0x4b, 0xcf, 0x7f, 0xd6, 0x2d, 0xf4, 0xb3, 0x86, 0x2a,
+  0xe3, 0xe2, 0x50, 0x07, 0x87, 0x2e, 0xba, 0xb1, 0xe7, 0x7a, 0x65, 0xea,
+  0x5e, 0x15, 0x37, 0xc1, 0xee, 0x81, 0xce, 0x5c, 0x81, 0x32, 0xf7, 0x98,
+  0x13, 0x4f, 0x12, 0x6a, 0xd6, 0xb2, 0xee, 0x9e, 0x4d, 0xe4, 0xce, 0x20,
+  0x53, 0xc3, 0x9e, 0x04, 0x76, 0xf0, 0x8b, 0x0c, 0xa8, 0xa4, 0xc0, 0x51,
+  0x72, 0xed, 0x4c, 0xc1, 0xc1, 0xd4, 0xd7, 0xb7, 0x97, 0x81, 0x29, 0x81,
+  0xf6, 0xdb, 0x81, 0xec, 0xf6, 0x91, 0xed, 0x7f, 0xcd, 0x2a, 0x0c, 0x48,
+  0xce, 0x1b, 0x15, 0x68, 0x17, 0x7f, 0x3c, 0xe2, 0x33, 0x81, 0x06, 0x54,
+  0x19, 0x02, 0x37, 0x2c, 0xc5, 0xd0, 0xea, 0x29, 0x4f, 0x81, 0xae, 0x4c,
+  0xa2, 0x11, 0x05, 0x33, 0xed, 0x4f, 0x1e, 0xf7, 0x11, 0x19, 0xfe, 0x68,
+  0x94, 0x1e, 0x15, 0xaf, 0xcd, 0xc6, 0xe2, 0x15, 0x5a, 0x4e, 0xf0, 0xc2,
+  0x32, 0xf5, 0xba, 0x05, 0xa2, 0xe1, 0x03, 0x01, 0x04, 0x20, 0x8e, 0x46,
+  0x1b, 0xa6, 0x9d, 0x0d, 0xd8, 0x1c, 0xaa, 0x34, 0xe4, 0xb0, 0x2d, 0x2a,
+  0xa7, 0x30, 0x0b, 0xc1, 0x1e, 0xc1, 0x01, 0x73, 0xb0, 0x19, 0x2c, 0xb5,
+  0xf2, 0x23, 0x00, 0x35, 0x1b, 0xe9, 0xca, 0xd2, 0xe3, 0x44, 0x07, 0x44,
+  0xec, 0x7f, 0x1a, 0x43, 0xd3, 0xf7, 0x3f, 0xe1, 0xc9, 0xe1, 0x7f, 0x3e,
+  0x7f, 0x42, 0x05, 0x0e, 0xe1, 0x11, 0xbc, 0x3e, 0x7f, 0xa1, 0x81, 0x3e,
+  0xa6, 0x44, 0xfd, 0x37, 0x07, 0x2c, 0x10, 0xf9, 0x2a, 0x8b, 0xe9, 0x7f,
+  0xa6, 0x1c, 0x0f, 0xcf, 0x81, 0x22, 0xe9, 0xf3, 0x73, 0x7f, 0x0c, 0x81,
+  0x1e, 0xef, 0x81, 0x2d, 0xc0, 0xbf, 0xea, 0xf4, 0x03, 0x20, 0xb9, 0x2d,
+  0x1d, 0x8e, 0xca, 0x8f, 0xec, 0x7f, 0xd4, 0x3b, 0x4e, 0xad, 0x4a, 0x4d,
+  0xea, 0x3c, 0x14, 0xe2, 0x7f, 0xd9, 0x02, 0x2b, 0x92, 0xf6, 0x06, 0xa8,
+  0x02, 0x14, 0xf2, 0x17, 0x0c, 0x9e, 0xb5, 0xc5, 0x34, 0x7f, 0x0d, 0x7f,
+  0x6d, 0x5b, 0x03, 0x41, 0xcf, 0xfc, 0x14, 0xf8, 0x14, 0x29, 0x11, 0x7f,
+  0x0a, 0xe1, 0x03, 0x45, 0xdc, 0x3d, 0xed, 0x1c, 0x46, 0xa1, 0xdb, 0x38,
+  0xb5, 0x14, 0xd7, 0x34, 0xf6, 0x39, 0xff, 0xd8, 0x0f, 0x51, 0x07, 0x52,
+  0xed, 0x1a, 0x0a, 0xd2, 0xc3, 0xe3, 0xe4, 0x1b, 0x42, 0x38, 0xfb, 0xe9,
+  0x2a, 0x1b, 0xc1, 0x17, 0x81, 0xbd, 0x01, 0x01, 0x2c, 0x3c, 0x81, 0x21,
+  0xf4, 0x99, 0x06, 0x0d, 0x59, 0x09, 0xcb, 0x14, 0xed, 0xb4, 0x27, 0x22,
+  0x5d, 0x21, 0xf4, 0xd8, 0x0a, 0xe3, 0x01, 0x7f, 0xda, 0xdc, 0x1d, 0x8c,
+  0x08, 0x10, 0xd9, 0x3c, 0x02, 0xe5, 0xd1, 0xe5, 0xec, 0x49, 0x04, 0x2f,
+  0xd8, 0x65, 0xfb, 0x3d, 0xe1, 0x1d, 0x35, 0x00, 0x5a, 0xe2, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0xc7, 0xf5, 0xff, 0xff,
+  0xe4, 0x13, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x00, 0x2c, 0xed, 0xff, 0xff,
+  0x8c, 0xf6, 0xff, 0xff, 0x3b, 0x14, 0x00, 0x00, 0xff, 0xf8, 0xff, 0xff,
+  0xe8, 0xf1, 0xff, 0xff, 0x40, 0xfa, 0xff, 0xff, 0x2d, 0x00, 0x00, 0x00,
+  0xce, 0x2c, 0x00, 0x00, 0x4d, 0xe8, 0xff, 0xff, 0x4b, 0xf9, 0xff, 0xff,
+  0xfe, 0x63, 0x00, 0x00, 0xe0, 0x40, 0x00, 0x00, 0xf3, 0xe2, 0xff, 0xff,
+  0xd4, 0x4f, 0x00, 0x00, 0x08, 0x0a, 0x00, 0x00, 0x4f, 0xf3, 0xff, 0xff,
+  0x30, 0x02, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x0c, 0xe4, 0xff, 0xff,
+  0xc9, 0xfc, 0xff, 0xff, 0x81, 0xf9, 0xff, 0xff, 0xb9, 0x07, 0x00, 0x00,
+  0xc1, 0xe6, 0xff, 0xff, 0xbd, 0xfc, 0xff, 0xff, 0xd1, 0xf2, 0xff, 0xff,
+  0x20, 0x28, 0x00, 0x00, 0x62, 0xe8, 0xff, 0xff, 0xdd, 0xeb, 0xff, 0xff,
+  0x3a, 0x1c, 0x00, 0x00, 0xe7, 0x2f, 0x00, 0x00, 0xa4, 0x07, 0x00, 0x00,
+  0x42, 0x17, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xb6, 0x0b, 0x00, 0x00,
+  0x19, 0xf5, 0xff, 0xff, 0x12, 0xfd, 0xff, 0xff, 0x9b, 0x2b, 0x00, 0x00,
+  0x48, 0xf6, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x2c, 0x0d, 0x00, 0x00,
+  0x3d, 0xd8, 0xff, 0xff, 0x2c, 0x33, 0x00, 0x00, 0xd4, 0x43, 0x00, 0x00,
+  0x36, 0xfd, 0xff, 0xff, 0x62, 0x3f, 0x00, 0x00, 0xeb, 0xfa, 0xff, 0xff,
+  0x6d, 0x22, 0x00, 0x00, 0xc6, 0x2c, 0x00, 0x00, 0x79, 0xea, 0xff, 0xff,
+  0xa2, 0xfa, 0xff, 0xff, 0x85, 0x11, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00,
+  0x0f, 0x28, 0x00, 0x00, 0x7c, 0xf6, 0xff, 0xff, 0x7c, 0x05, 0x00, 0x00,
+  0x88, 0x69, 0x00, 0x00, 0x1a, 0x1e, 0x00, 0x00, 0x06, 0x1d, 0x00, 0x00,
+  0xd9, 0x3e, 0x00, 0x00, 0xce, 0x30, 0x00, 0x00, 0x73, 0xcf, 0xff, 0xff,
+  0x78, 0x04, 0x00, 0x00, 0x2b, 0x04, 0x00, 0x00, 0xae, 0xf6, 0xff, 0xff,
+  0xc1, 0x26, 0x00, 0x00, 0xa8, 0xf7, 0xff, 0xff, 0x96, 0x00, 0x00, 0x00,
+  0x2d, 0xf9, 0xff, 0xff, 0xb1, 0x10, 0x00, 0x00, 0x97, 0x54, 0x00, 0x00,
+  0xf8, 0x07, 0x00, 0x00, 0x14, 0xf5, 0xff, 0xff, 0x66, 0x4e, 0x00, 0x00,
+  0x85, 0xf7, 0xff, 0xff, 0x84, 0xf7, 0xff, 0xff, 0x75, 0x23, 0x00, 0x00,
+  0x3d, 0xea, 0xff, 0xff, 0x9b, 0xef, 0xff, 0xff, 0xc2, 0x43, 0x00, 0x00,
+  0xbf, 0x0e, 0x00, 0x00, 0x05, 0x0e, 0x00, 0x00, 0x9d, 0x43, 0x00, 0x00,
+  0x0e, 0xf7, 0xff, 0xff, 0x0f, 0xf1, 0xff, 0xff, 0x02, 0xeb, 0xff, 0xff,
+  0x5a, 0xfb, 0xff, 0xff, 0xf7, 0xdd, 0xff, 0xff, 0x3b, 0x2f, 0x00, 0x00,
+  0xa8, 0xf8, 0xff, 0xff, 0x81, 0xfa, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00,
+  0xe4, 0xf8, 0xff, 0xff, 0x7d, 0xe8, 0xff, 0xff, 0xe6, 0xe3, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0xa9, 0x2f, 0x35, 0xe4,
+  0xbe, 0xe5, 0xcf, 0xe9, 0xce, 0xe4, 0x12, 0xd0, 0x35, 0x53, 0xf7, 0xdc,
+  0x0d, 0x01, 0x6f, 0x1b, 0x0f, 0xb4, 0x6d, 0x4b, 0x28, 0x19, 0xfd, 0x45,
+  0xd2, 0x8c, 0xb0, 0xdb, 0xee, 0xd4, 0x15, 0x36, 0x19, 0x26, 0xfd, 0x3f,
+  0xde, 0x12, 0xb9, 0x2b, 0xaf, 0xef, 0x14, 0x50, 0xea, 0x2b, 0xd1, 0xfe,
+  0x29, 0x15, 0x10, 0xd0, 0x8e, 0x09, 0xdb, 0x7f, 0x4f, 0x23, 0x07, 0x09,
+  0xf5, 0xd9, 0xc2, 0x16, 0xdb, 0xca, 0xfb, 0xf1, 0xed, 0xeb, 0xc5, 0xd0,
+  0xef, 0x10, 0xe0, 0xf6, 0xcf, 0x24, 0x3f, 0xb2, 0x1a, 0x3a, 0x03, 0x37,
+  0x11, 0x1c, 0x0b, 0xe7, 0xb9, 0xe3, 0xd5, 0x16, 0x52, 0x18, 0x0d, 0xc8,
+  0xa9, 0xbf, 0x12, 0xe5, 0xe9, 0x01, 0x55, 0xb7, 0x1f, 0x28, 0xa1, 0xc8,
+  0x07, 0x03, 0xf1, 0x35, 0x1a, 0xaa, 0x0a, 0x33, 0xe3, 0xc4, 0xfa, 0x01,
+  0x58, 0x91, 0x7b, 0x8b, 0x4f, 0x1c, 0xdb, 0x4e, 0x29, 0x50, 0x0f, 0xfa,
+  0xf4, 0x35, 0xf3, 0x05, 0x1e, 0x39, 0xab, 0xae, 0xcb, 0xec, 0xfa, 0x0c,
+  0x51, 0xc2, 0xd9, 0x3b, 0xd6, 0x45, 0xbe, 0x53, 0x3c, 0x38, 0x20, 0x81,
+  0xfa, 0xfc, 0xa7, 0x2b, 0x1c, 0xfa, 0xc0, 0x04, 0xa9, 0xe6, 0x19, 0x9b,
+  0x23, 0x05, 0x25, 0xba, 0xd3, 0xfa, 0x88, 0xd5, 0x37, 0x0b, 0xef, 0x18,
+  0xcc, 0x29, 0xbe, 0x25, 0x00, 0x47, 0xb6, 0x63, 0x43, 0xfa, 0xec, 0xca,
+  0x28, 0xb7, 0x24, 0x2e, 0xc7, 0xf1, 0xf7, 0xf7, 0xaa, 0xc5, 0xf0, 0xd1,
+  0x9f, 0xe2, 0xe1, 0x0b, 0xdc, 0xb7, 0x02, 0x29, 0xe6, 0xc5, 0xe3, 0xee,
+  0x0e, 0x15, 0xcd, 0x5b, 0xce, 0x7f, 0x03, 0x0c, 0xfd, 0xe3, 0x02, 0x06,
+  0xac, 0x2f, 0x64, 0x0c, 0xbc, 0x02, 0x04, 0xd3, 0x32, 0x1d, 0xc1, 0xe6,
+  0x38, 0xe9, 0xd1, 0x36, 0x32, 0xdb, 0x32, 0x09, 0x0b, 0x35, 0xf3, 0x0a,
+  0x34, 0x0a, 0xcb, 0x05, 0x09, 0x1d, 0xce, 0x30, 0x56, 0x13, 0x37, 0x04,
+  0xf8, 0xd6, 0x65, 0x40, 0x3f, 0xd4, 0xce, 0x33, 0xed, 0x07, 0xfb, 0x3f,
+  0x1c, 0x0f, 0xf7, 0x33, 0xd2, 0x2e, 0xfa, 0x14, 0xda, 0xf9, 0xdf, 0x0b,
+  0x06, 0xff, 0xf5, 0x96, 0xf9, 0x37, 0x6b, 0x60, 0x1b, 0x08, 0x8a, 0x39,
+  0xe5, 0xfc, 0x13, 0x12, 0x02, 0x7f, 0x5d, 0xcb, 0x15, 0x2f, 0xe9, 0x0d,
+  0x7e, 0xda, 0x59, 0xbe, 0x08, 0x25, 0xd3, 0x1d, 0x2b, 0x7a, 0x1a, 0x23,
+  0x8b, 0xe9, 0xdd, 0x34, 0xc3, 0x21, 0x22, 0x15, 0xe7, 0xe9, 0xe2, 0xdb,
+  0x47, 0xc5, 0xe7, 0xcb, 0x29, 0x3d, 0xe3, 0x35, 0x1c, 0xeb, 0xef, 0x19,
+  0x2b, 0x4d, 0x07, 0x0f, 0xef, 0x09, 0x04, 0xad, 0xcf, 0xc6, 0x3e, 0xed,
+  0x28, 0x1d, 0xdf, 0xea, 0xec, 0xcb, 0xc7, 0x01, 0x15, 0xa3, 0x2c, 0xeb,
+  0x0b, 0x3b, 0x26, 0xf3, 0x1b, 0x11, 0xed, 0x3c, 0x25, 0x14, 0xe5, 0x04,
+  0x28, 0x01, 0xcc, 0xeb, 0xe9, 0x23, 0x7c, 0xfe, 0xfa, 0x11, 0xe5, 0xcb,
+  0xe5, 0x02, 0x08, 0x1a, 0xfc, 0xd5, 0x4e, 0x68, 0xc8, 0xfd, 0x81, 0x1c,
+  0xf5, 0xdd, 0x17, 0xd6, 0xeb, 0xe7, 0x0f, 0x4b, 0x05, 0x38, 0x2c, 0x27,
+  0xde, 0xf3, 0x39, 0xe3, 0xf4, 0x0e, 0xf2, 0x27, 0xdd, 0x50, 0xee, 0x21,
+  0x52, 0xf5, 0xd3, 0x15, 0x33, 0xef, 0xf8, 0x0a, 0x1e, 0xf3, 0x35, 0x0e,
+  0xd9, 0x0e, 0x05, 0x20, 0xd2, 0x32, 0xef, 0x43, 0x03, 0xc4, 0xe9, 0xbb,
+  0x28, 0xe0, 0x11, 0x20, 0xf0, 0x1e, 0xbc, 0xed, 0x0f, 0xf7, 0x25, 0xf6,
+  0x52, 0x0e, 0x12, 0xf7, 0xc2, 0xf0, 0x3d, 0x18, 0xad, 0x21, 0x1e, 0x10,
+  0x48, 0xee, 0x45, 0x0b, 0x1b, 0x33, 0xe7, 0xfa, 0x57, 0x0a, 0xf5, 0xd0,
+  0x15, 0xde, 0x44, 0x1c, 0x84, 0xe2, 0xa1, 0x45, 0xab, 0xee, 0x2c, 0x1b,
+  0x1b, 0xc0, 0xea, 0x41, 0x1c, 0x76, 0x0e, 0xe6, 0xd5, 0x10, 0x17, 0xbf,
+  0x10, 0x7f, 0x71, 0xed, 0xf6, 0x76, 0x11, 0xe2, 0x09, 0x1e, 0x27, 0x47,
+  0xef, 0xeb, 0x05, 0xc5, 0x00, 0xe3, 0xc3, 0x85, 0x29, 0x40, 0xb9, 0xe7,
+  0x5b, 0xa1, 0xc2, 0x9e, 0xcd, 0x04, 0xf0, 0x05, 0xd6, 0x15, 0xe3, 0xae,
+  0x07, 0x0c, 0xd5, 0xe1, 0x78, 0x38, 0x03, 0xd2, 0x94, 0x3b, 0x0a, 0x16,
+  0x02, 0x16, 0x22, 0xe1, 0x0e, 0x26, 0x0e, 0x66, 0x48, 0xeb, 0xbd, 0x29,
+  0xd6, 0xb1, 0x61, 0x5d, 0x9e, 0x48, 0xd3, 0x0e, 0x9f, 0xa4, 0x65, 0x0e,
+  0x1d, 0xbe, 0xff, 0x0c, 0xf7, 0xfc, 0xb9, 0xa3, 0xc9, 0x28, 0x38, 0xff,
+  0x09, 0x05, 0x40, 0xde, 0x06, 0x0b, 0x26, 0x9b, 0x15, 0xe7, 0x14, 0x26,
+  0x1c, 0xf6, 0xbc, 0xb2, 0xfb, 0xcf, 0x96, 0x29, 0x1c, 0x81, 0xf8, 0x41,
+  0xf1, 0x0c, 0xf1, 0xb8, 0x2d, 0x34, 0x21, 0xc9, 0xb6, 0x14, 0x9c, 0xf3,
+  0x05, 0x07, 0xb6, 0x2e, 0x26, 0x01, 0xf2, 0xbf, 0xea, 0x10, 0x33, 0x52,
+  0x2d, 0xdd, 0x0e, 0x8a, 0x06, 0x04, 0xcd, 0x4f, 0xd9, 0xd1, 0x09, 0xf8,
+  0xb2, 0x1c, 0x37, 0x38, 0xef, 0xf5, 0xb2, 0x65, 0xf3, 0x50, 0xde, 0xba,
+  0xec, 0x09, 0x01, 0x03, 0xb7, 0x15, 0xe9, 0xd3, 0xd5, 0x0c, 0xef, 0xf2,
+  0xa2, 0xf1, 0xd7, 0x2b, 0xfb, 0x73, 0x30, 0x1d, 0x10, 0xfe, 0x07, 0x25,
+  0x59, 0x2a, 0x66, 0xb3, 0x5e, 0x0d, 0xc5, 0x34, 0x0e, 0x21, 0xff, 0x4b,
+  0xa9, 0x03, 0x20, 0xc5, 0x11, 0xb9, 0x3d, 0xff, 0x12, 0xdb, 0x81, 0xe4,
+  0x07, 0x23, 0x13, 0xf5, 0x41, 0xe4, 0xaa, 0x2a, 0xfa, 0x73, 0x23, 0xed,
+  0xd1, 0x1c, 0xd6, 0x31, 0xdf, 0x00, 0x82, 0x1b, 0x18, 0x36, 0xee, 0x3d,
+  0xeb, 0x20, 0x21, 0xbf, 0xf3, 0x8f, 0x54, 0xbf, 0x49, 0xcf, 0xf2, 0xeb,
+  0xf7, 0x4a, 0xb1, 0x2f, 0x1f, 0xd4, 0xeb, 0x04, 0x18, 0x64, 0xd3, 0x3e,
+  0xe0, 0xc3, 0xbc, 0x16, 0xbf, 0xda, 0x18, 0x0b, 0xfe, 0x54, 0xfa, 0x6e,
+  0x09, 0xd2, 0x2a, 0x17, 0x43, 0xe4, 0xfc, 0x0d, 0xe4, 0x61, 0x14, 0x40,
+  0xea, 0xe8, 0xd9, 0xd0, 0xf2, 0xce, 0xf4, 0xc2, 0xca, 0x30, 0x35, 0xf4,
+  0xf7, 0xfc, 0x28, 0x3d, 0xde, 0xea, 0x14, 0xde, 0xf5, 0x0b, 0x3d, 0x5c,
+  0x0b, 0xdd, 0xae, 0x75, 0xd9, 0x50, 0xf1, 0xe9, 0xd4, 0x15, 0x19, 0x4c,
+  0x0a, 0xc9, 0xdd, 0xf0, 0xd6, 0x22, 0x13, 0x0b, 0xdc, 0xd1, 0x88, 0xd4,
+  0xd4, 0x37, 0xc7, 0xf1, 0xd6, 0x05, 0xc4, 0xc9, 0x09, 0x16, 0x19, 0x2f,
+  0x30, 0x5e, 0xcc, 0xed, 0x81, 0x99, 0x25, 0xc6, 0xe5, 0x03, 0xb7, 0x1b,
+  0xda, 0xd7, 0x33, 0x3e, 0xe8, 0x20, 0xe9, 0x6c, 0x99, 0xd0, 0x0a, 0x77,
+  0x01, 0x10, 0x4b, 0xda, 0xdc, 0x3f, 0x2e, 0xb1, 0xe5, 0xfd, 0xee, 0xe6,
+  0x43, 0xd9, 0x48, 0x2f, 0xec, 0xf8, 0xdc, 0x81, 0xe7, 0xed, 0xfa, 0x13,
+  0x14, 0x08, 0x3e, 0xd3, 0xfa, 0xd4, 0x17, 0x02, 0xf6, 0x73, 0xec, 0xfa,
+  0xcd, 0x9b, 0xf0, 0xf1, 0x0b, 0xdd, 0x3a, 0x09, 0xcb, 0x57, 0xe5, 0xdd,
+  0x37, 0x0d, 0x10, 0x00, 0x9b, 0x01, 0x2e, 0x53, 0xf8, 0x61, 0xbb, 0xaa,
+  0xc8, 0x04, 0xf1, 0x2a, 0x38, 0xbb, 0x26, 0xf4, 0x39, 0xd0, 0xf2, 0xf3,
+  0xce, 0xfb, 0xef, 0xd4, 0x6b, 0x1d, 0x0c, 0xfc, 0x1f, 0xfa, 0xd3, 0xea,
+  0xdb, 0x1a, 0x31, 0xf2, 0xf4, 0xde, 0x1a, 0xe2, 0xae, 0xfb, 0xed, 0xf0,
+  0xa7, 0xf6, 0x0a, 0x1f, 0x16, 0x09, 0x23, 0xee, 0x09, 0x49, 0x0e, 0x04,
+  0xea, 0xc4, 0xef, 0xe1, 0x67, 0xd5, 0x00, 0x2e, 0x41, 0xd0, 0x3d, 0x7f,
+  0xea, 0xdb, 0x12, 0x1e, 0xce, 0xa2, 0xe2, 0x3f, 0x0f, 0x76, 0x8e, 0xc3,
+  0x08, 0x3a, 0x19, 0x1e, 0x19, 0xca, 0x2a, 0x4c, 0x10, 0x3f, 0xd2, 0xdd,
+  0xd4, 0xe1, 0xde, 0x61, 0x33, 0xee, 0xca, 0x29, 0x63, 0x10, 0x2b, 0xb9,
+  0x1e, 0xc2, 0x23, 0xe9, 0xee, 0xd9, 0x1c, 0x15, 0xf3, 0xdb, 0x01, 0xe6,
+  0xd5, 0xf8, 0x23, 0x45, 0x29, 0x18, 0xc8, 0x0b, 0xd7, 0xef, 0x2b, 0xd7,
+  0x30, 0xb6, 0xf0, 0xe1, 0x3f, 0xc8, 0x16, 0x23, 0xff, 0x3c, 0xd0, 0x32,
+  0xc1, 0xdf, 0x54, 0xf7, 0xef, 0xf6, 0xbb, 0xc3, 0x19, 0x14, 0xe7, 0x58,
+  0x43, 0xa1, 0x3b, 0xbe, 0x0c, 0x01, 0x18, 0xee, 0x99, 0x1b, 0x9a, 0x01,
+  0xc0, 0x33, 0xbe, 0x40, 0xe7, 0x29, 0x0f, 0xc1, 0x07, 0x20, 0xba, 0xfe,
+  0x24, 0xf8, 0x4b, 0xd3, 0xe7, 0xdf, 0xe9, 0x02, 0xef, 0xd1, 0x0e, 0xa3,
+  0x22, 0xd1, 0x55, 0x5e, 0x7f, 0x19, 0x43, 0x2b, 0xd9, 0x03, 0x29, 0x9b,
+  0x59, 0x41, 0x34, 0x4e, 0x09, 0xf2, 0xcf, 0x55, 0x6e, 0x2d, 0x17, 0x05,
+  0x0d, 0xf0, 0x0a, 0xe1, 0x2e, 0x3f, 0x60, 0x42, 0x5c, 0xdc, 0xe1, 0xf4,
+  0x44, 0x68, 0x1f, 0x23, 0x2e, 0x4a, 0xd8, 0x1f, 0x33, 0x60, 0x23, 0xdf,
+  0x00, 0xec, 0x36, 0x49, 0x78, 0xd5, 0x07, 0xc3, 0xff, 0x07, 0xe6, 0xf0,
+  0xc4, 0x60, 0xfa, 0x1d, 0x1f, 0x32, 0x25, 0xa6, 0x43, 0xe2, 0xf9, 0xc5,
+  0x1d, 0xff, 0x25, 0x62, 0xd1, 0x5a, 0xf8, 0xda, 0xd5, 0x10, 0x3a, 0x31,
+  0xed, 0xec, 0x1b, 0x16, 0xab, 0x45, 0xf8, 0x35, 0x24, 0x89, 0x09, 0x93,
+  0xf1, 0x69, 0xc3, 0xf4, 0x23, 0xc2, 0x41, 0x33, 0xea, 0x04, 0x21, 0x58,
+  0x23, 0x18, 0xa0, 0xce, 0xec, 0x7f, 0x54, 0x2a, 0xcb, 0x7e, 0xec, 0xb3,
+  0x44, 0x22, 0xb7, 0x36, 0x2a, 0xfa, 0xa0, 0xc6, 0xe3, 0x0b, 0x0d, 0xdf,
+  0xd8, 0x0b, 0xf6, 0xe6, 0xde, 0xed, 0xe8, 0xbb, 0x17, 0x81, 0xfb, 0xbb,
+  0xe9, 0xd0, 0xad, 0x06, 0xa8, 0xe9, 0xff, 0x36, 0xf4, 0x17, 0x37, 0xe9,
+  0x1e, 0xf9, 0x37, 0x26, 0x12, 0x16, 0x9c, 0x66, 0xfb, 0xec, 0x25, 0xf4,
+  0x5e, 0xff, 0x0b, 0xdb, 0x01, 0x93, 0x23, 0x0e, 0x2d, 0xf2, 0xce, 0xfe,
+  0x06, 0x05, 0xf7, 0x1c, 0x3b, 0xc1, 0x09, 0xff, 0x3a, 0x2a, 0x01, 0xbe,
+  0xdb, 0x38, 0xc8, 0x1a, 0xe1, 0xdd, 0xb5, 0xfc, 0xe5, 0x17, 0xe5, 0xd7,
+  0xb7, 0xea, 0x2a, 0x3e, 0x0a, 0x29, 0x27, 0xbf, 0x3a, 0x0c, 0x12, 0xdb,
+  0xe2, 0xeb, 0xd3, 0x10, 0xde, 0xe5, 0xd4, 0xfe, 0x02, 0x0b, 0x99, 0xec,
+  0x4a, 0x26, 0xb7, 0xe0, 0x30, 0xae, 0x53, 0xd7, 0x11, 0x09, 0xb9, 0xb8,
+  0xce, 0x37, 0x35, 0x7f, 0x03, 0xdb, 0xed, 0x00, 0xdd, 0x23, 0xe1, 0x53,
+  0x22, 0xde, 0xdf, 0xe2, 0x59, 0xef, 0xef, 0xfd, 0x08, 0x35, 0x53, 0x35,
+  0x31, 0x39, 0x12, 0x0e, 0x04, 0xe3, 0x6b, 0xd2, 0x1c, 0x02, 0x14, 0xf2,
+  0x3c, 0x1f, 0xdb, 0x33, 0xf5, 0x42, 0xb0, 0x10, 0xfd, 0xbe, 0xe0, 0xb1,
+  0x23, 0xd6, 0xbd, 0xfb, 0xe9, 0x2f, 0x07, 0x29, 0xde, 0xce, 0xe3, 0xe6,
+  0x47, 0x12, 0xe3, 0xd1, 0x20, 0x01, 0xd6, 0xe7, 0xfb, 0x4c, 0xe4, 0xf2,
+  0xf8, 0x57, 0x72, 0x07, 0x11, 0xd4, 0xe3, 0xc6, 0xa4, 0xc5, 0x1c, 0xad,
+  0x13, 0xf5, 0xc3, 0xc5, 0xea, 0x35, 0xe7, 0x39, 0xe7, 0xa2, 0x4e, 0x5b,
+  0x82, 0xe4, 0xfd, 0xb1, 0x07, 0xed, 0xf9, 0x9a, 0x3d, 0xfd, 0x19, 0xaf,
+  0xcc, 0x97, 0xc8, 0x46, 0xba, 0x31, 0x30, 0x99, 0xf7, 0xdb, 0x0a, 0xd4,
+  0x15, 0xeb, 0x0f, 0xbe, 0xdf, 0xe1, 0x26, 0x76, 0xbb, 0xc4, 0x1c, 0xb2,
+  0xc2, 0x42, 0x12, 0x95, 0xba, 0xce, 0x77, 0xf6, 0xe4, 0x1c, 0x95, 0x10,
+  0x9a, 0xfa, 0xf4, 0x0c, 0x41, 0xa9, 0x3c, 0xf1, 0x50, 0xe8, 0xd2, 0xde,
+  0xef, 0xf7, 0x22, 0x09, 0x08, 0x4d, 0x56, 0x21, 0x08, 0xd2, 0x81, 0xe2,
+  0xe5, 0xa5, 0x86, 0x15, 0x65, 0xc2, 0xd3, 0x57, 0xf2, 0xe9, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x84, 0x0b, 0x00, 0x00,
+  0x81, 0x10, 0x00, 0x00, 0x58, 0xf6, 0xff, 0xff, 0xdf, 0xee, 0xff, 0xff,
+  0x65, 0xdb, 0xff, 0xff, 0x64, 0x18, 0x00, 0x00, 0x1a, 0x2b, 0x00, 0x00,
+  0xea, 0x03, 0x00, 0x00, 0x28, 0x1a, 0x00, 0x00, 0x86, 0x0c, 0x00, 0x00,
+  0x52, 0xde, 0xff, 0xff, 0x9d, 0xeb, 0xff, 0xff, 0xd1, 0x9c, 0xff, 0xff,
+  0x7c, 0x31, 0x00, 0x00, 0x6d, 0xec, 0xff, 0xff, 0x10, 0x56, 0x00, 0x00,
+  0x3e, 0xea, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+  0xcc, 0x59, 0xc5, 0x1e, 0x25, 0xee, 0x78, 0x44, 0xa9, 0xf0, 0x45, 0x81,
+  0x64, 0x69, 0xbf, 0x2f, 0xe1, 0xfd, 0xc0, 0xe9, 0xe1, 0x2c, 0x22, 0x81,
+  0x11, 0xd8, 0xd8, 0xc0, 0xf8, 0xda, 0xcb, 0xf9, 0xdd, 0xe1, 0x24, 0x38,
+  0x1b, 0x3b, 0x93, 0x7f, 0xd6, 0x02, 0x69, 0xb1, 0xf8, 0xb3, 0xdb, 0x46,
+  0x63, 0xcc, 0x52, 0x02, 0x20, 0xf8, 0xf2, 0x7f, 0xea, 0x17, 0x3f, 0x28,
+  0x0b, 0x35, 0x4a, 0xfd, 0xd4, 0xdc, 0xf0, 0x31, 0xa3, 0x18, 0xea, 0x8e,
+  0xf4, 0x02, 0x25, 0xdf, 0x28, 0x2d, 0x6b, 0x7f, 0x7f, 0x24, 0xd1, 0xe8,
+  0xd1, 0x01, 0x20, 0x43, 0x1f, 0xed, 0x39, 0x4c, 0x5e, 0x32, 0xd1, 0x00,
+  0x0b, 0x01, 0xaa, 0xc8, 0xab, 0x02, 0x07, 0xaf, 0xcd, 0xe9, 0xd7, 0x09,
+  0x7f, 0x50, 0x7f, 0x11, 0xd2, 0x29, 0xf1, 0xc9, 0x0f, 0xc3, 0xac, 0x3f,
+  0xa7, 0x4e, 0xc1, 0xbe, 0x81, 0xf5, 0xfa, 0x59, 0x2a, 0x30, 0x37, 0x00,
+  0x4c, 0x0e, 0x42, 0x00, 0x43, 0xf4, 0x15, 0x05, 0x81, 0xef, 0xb9, 0x0d,
+  0xca, 0x44, 0x24, 0xa4, 0xef, 0xed, 0x22, 0xe7, 0xd0, 0x36, 0xd3, 0x14,
+  0x47, 0x7f, 0x13, 0x1f, 0x44, 0x09, 0xcd, 0x39, 0xcc, 0x03, 0x44, 0x01,
+  0x8f, 0xf1, 0xef, 0x81, 0x83, 0xb4, 0xf9, 0x67, 0x18, 0xe2, 0x18, 0xff,
+  0x0f, 0xdd, 0x1d, 0x7e, 0xa6, 0x12, 0x15, 0xe5, 0xe4, 0xf3, 0x54, 0x7f,
+  0xc8, 0xef, 0xfd, 0xf0, 0x08, 0xfa, 0x78, 0x2d, 0xc8, 0x20, 0xfc, 0xef,
+  0x00, 0x53, 0xd5, 0x7f, 0xeb, 0x10, 0x23, 0x03, 0x5e, 0x34, 0x7f, 0x6b,
+  0xbe, 0x42, 0xd1, 0xc2, 0x21, 0x4b, 0xa6, 0xe0, 0xc5, 0x7f, 0xf4, 0x14,
+  0x1c, 0xf5, 0x24, 0x2f, 0xfc, 0x15, 0x5c, 0x0f, 0xcc, 0x17, 0xe2, 0x2c,
+  0xfb, 0x06, 0x81, 0xe3, 0x41, 0xeb, 0xb5, 0xea, 0xf4, 0xef, 0xf5, 0xce,
+  0x05, 0xb4, 0xe5, 0x14, 0x5f, 0xd8, 0xfa, 0xfb, 0x1f, 0xd2, 0x1f, 0xd6,
+  0xdc, 0x24, 0x7f, 0x57, 0x15, 0xf2, 0xd0, 0x03, 0xfa, 0x08, 0xec, 0x9e,
+  0xf6, 0xde, 0x71, 0x81, 0xfe, 0xf9, 0xeb, 0x1d, 0x1f, 0x34, 0x02, 0x2b,
+  0x30, 0x75, 0xf0, 0x06, 0x38, 0xbc, 0xf4, 0xe5, 0xd5, 0x7f, 0xc9, 0x10,
+  0x21, 0xfd, 0xf3, 0xe6, 0xd0, 0xa4, 0x6d, 0x94, 0x38, 0x81, 0x29, 0xbc,
+  0x2f, 0x1c, 0x63, 0x59, 0x11, 0x00, 0x4f, 0xdb, 0xf1, 0x61, 0x3b, 0xfe,
+  0x0d, 0x05, 0x0a, 0xd5, 0x2f, 0x11, 0x64, 0xd4, 0x81, 0xfe, 0xb2, 0xfe,
+  0xbd, 0x0b, 0x06, 0xf1, 0x4d, 0x27, 0x4d, 0xf3, 0x81, 0x14, 0xb5, 0x24,
+  0xe2, 0x03, 0xc0, 0xc8, 0x0a, 0x9f, 0x1c, 0x16, 0x0e, 0x83, 0x7f, 0x21,
+  0xf6, 0xcb, 0xf7, 0xc8, 0x1e, 0xae, 0xbe, 0xd9, 0xce, 0x8f, 0x17, 0x55,
+  0x1c, 0xf1, 0x25, 0xcd, 0xf8, 0xe8, 0x70, 0x0d, 0x11, 0x3d, 0x5f, 0x7f,
+  0x14, 0x0c, 0x16, 0x5e, 0x3c, 0x0e, 0xd1, 0x81, 0x54, 0x07, 0xd8, 0x0f,
+  0x0a, 0xec, 0xec, 0xdf, 0xf2, 0x22, 0x18, 0xca, 0xe7, 0xef, 0x0b, 0xdb,
+  0xdc, 0x2c, 0xcc, 0xf8, 0x30, 0x7f, 0x00, 0x15, 0xc9, 0x39, 0xfb, 0x0f,
+  0x18, 0xb6, 0xfb, 0xed, 0x0a, 0x30, 0x1b, 0x43, 0xfa, 0x15, 0xad, 0x7f,
+  0xe1, 0x81, 0xc5, 0xfd, 0xb6, 0x4f, 0x01, 0xc9, 0x02, 0xdf, 0x2e, 0xdd,
+  0x1f, 0xd2, 0xa0, 0xf1, 0xd7, 0xf3, 0x45, 0x60, 0x26, 0x1f, 0xd2, 0x81,
+  0x88, 0x32, 0x4e, 0xff, 0x35, 0x0c, 0xe5, 0xc7, 0x81, 0x6b, 0xd6, 0xe2,
+  0xee, 0x10, 0x83, 0xb7, 0xd3, 0xdd, 0xfe, 0x00, 0x1a, 0xd9, 0x8d, 0x3c,
+  0x61, 0x6c, 0xba, 0x68, 0xb7, 0x81, 0x9f, 0xd9, 0xff, 0xfa, 0xf3, 0x96,
+  0x62, 0x21, 0x03, 0x5d, 0x7f, 0x27, 0xbf, 0xee, 0xe2, 0x2c, 0x49, 0x25,
+  0xe0, 0xf1, 0x2a, 0x52, 0x0a, 0x18, 0x00, 0xfa, 0xd8, 0xf4, 0x7f, 0xf7,
+  0xe7, 0x4f, 0x5f, 0x07, 0xe6, 0xf6, 0xe9, 0x19, 0x1e, 0x40, 0x46, 0x35,
+  0x02, 0x28, 0xc6, 0xae, 0xe2, 0x1a, 0x7f, 0x11, 0xf6, 0xeb, 0x1a, 0xd0,
+  0x69, 0x57, 0xcf, 0x46, 0xa9, 0xd6, 0x4c, 0x00, 0x06, 0xca, 0x5b, 0xf5,
+  0x81, 0x10, 0x34, 0xc7, 0x3a, 0x1f, 0xcc, 0xe1, 0xf1, 0x11, 0xd2, 0x1d,
+  0xac, 0x7f, 0xd7, 0xf3, 0xdf, 0x75, 0xfe, 0x58, 0xc3, 0x4c, 0xf6, 0x28,
+  0xfe, 0x9f, 0x7f, 0xe2, 0xdf, 0x22, 0xc5, 0xdf, 0x23, 0x15, 0xb7, 0x72,
+  0xff, 0x92, 0xd2, 0x3a, 0x58, 0xfd, 0x5c, 0xe0, 0x7f, 0xc4, 0xf2, 0x11,
+  0xe4, 0x57, 0xb2, 0x14, 0xc8, 0xba, 0x6a, 0x00, 0x53, 0x4e, 0x11, 0x92,
+  0x08, 0x9b, 0x81, 0x2f, 0xbb, 0x33, 0xa7, 0xd1, 0xc5, 0xa0, 0xa8, 0x5b,
+  0xb3, 0x12, 0xc2, 0xfd, 0xac, 0xc4, 0x4b, 0x14, 0x81, 0xef, 0x41, 0x40,
+  0x32, 0xf4, 0xe4, 0x21, 0x77, 0x29, 0xb0, 0x81, 0x90, 0xfe, 0x24, 0xef,
+  0xcf, 0xb0, 0xed, 0x8a, 0x0a, 0x2a, 0x3a, 0x1e, 0x5c, 0x92, 0xbd, 0xb9,
+  0xe4, 0x29, 0xce, 0xb2, 0x7e, 0x23, 0xdb, 0xa2, 0x7f, 0x9d, 0x5e, 0xc8,
+  0xf0, 0xac, 0xd0, 0x75, 0x1f, 0x99, 0x81, 0x23, 0xfc, 0x1a, 0x1a, 0x23,
+  0x94, 0x3e, 0xb6, 0xf6, 0xb1, 0xd8, 0xc6, 0x9e, 0xcf, 0x01, 0x03, 0x4e,
+  0x20, 0x81, 0xd6, 0x17, 0xec, 0xd7, 0xd2, 0x67, 0xd5, 0x10, 0xff, 0x9c,
+  0xd6, 0xea, 0x30, 0x7b, 0x7f, 0xd0, 0x39, 0x69, 0x61, 0x2e, 0x0e, 0xfa,
+  0x31, 0x3a, 0xab, 0x4e, 0x5b, 0xbd, 0xe5, 0xd7, 0x7f, 0x98, 0x1e, 0xe1,
+  0xfe, 0xfb, 0xc7, 0x23, 0xe1, 0xcb, 0x06, 0x04, 0x53, 0xe0, 0x14, 0x2c,
+  0xd7, 0x62, 0xf7, 0x81, 0x0e, 0x4e, 0xcf, 0x48, 0x37, 0xb5, 0xeb, 0x01,
+  0x42, 0xf5, 0xcd, 0xdf, 0x01, 0x7f, 0xe8, 0x34, 0xbc, 0xb6, 0xa4, 0x2a,
+  0x00, 0xf0, 0xe4, 0xae, 0xde, 0xf9, 0x49, 0x81, 0x0d, 0x05, 0xc5, 0x02,
+  0x3e, 0x0c, 0xfa, 0x02, 0xf2, 0x6c, 0xbc, 0x4a, 0x56, 0xe5, 0x2e, 0x2f,
+  0xed, 0x13, 0xf7, 0xe9, 0xea, 0x05, 0x7f, 0x81, 0x1b, 0x3a, 0xe7, 0x1b,
+  0x81, 0x01, 0xb8, 0xd4, 0x52, 0x50, 0x18, 0x14, 0xe4, 0xea, 0x1d, 0x26,
+  0x7f, 0xd3, 0xc3, 0x11, 0xc7, 0x44, 0x9f, 0xe6, 0x24, 0xf6, 0xec, 0x3b,
+  0xec, 0xcb, 0xfa, 0x0e, 0xe8, 0xbc, 0x27, 0x4b, 0xb9, 0xa3, 0x81, 0xf7,
+  0xec, 0xc1, 0xcd, 0xc8, 0xfa, 0xcf, 0x05, 0x3b, 0x12, 0x4b, 0x2e, 0x81,
+  0xfe, 0x79, 0x5d, 0xdd, 0xd9, 0x0a, 0xf4, 0xe6, 0x67, 0xb9, 0x07, 0x49,
+  0x44, 0x74, 0x07, 0x02, 0x04, 0x86, 0xab, 0x40, 0xf7, 0xd0, 0xc9, 0x7f,
+  0x4f, 0x4f, 0x07, 0x25, 0xee, 0x24, 0x36, 0x4e, 0x3b, 0xe8, 0x65, 0x7f,
+  0xcc, 0x01, 0x0c, 0x17, 0x55, 0x20, 0x1f, 0xfb, 0x63, 0x30, 0x1f, 0xf6,
+  0xe5, 0x7f, 0xc9, 0xb7, 0xe6, 0x4d, 0x96, 0x19, 0xb6, 0x76, 0xe3, 0x3b,
+  0xdc, 0xf4, 0xcd, 0xdd, 0xc5, 0xa2, 0x29, 0x00, 0x81, 0xed, 0x51, 0x26,
+  0x24, 0x1d, 0xf1, 0x2f, 0x47, 0xe0, 0x4f, 0x29, 0x13, 0x9c, 0xdf, 0x07,
+  0x11, 0xcc, 0x81, 0xde, 0x25, 0xfc, 0xdf, 0x23, 0x42, 0x00, 0x82, 0x44,
+  0xfb, 0x19, 0x6b, 0xf6, 0xc8, 0x9f, 0x13, 0x8c, 0x81, 0xbd, 0x3c, 0x64,
+  0xfe, 0x0b, 0xe7, 0x0c, 0xce, 0xee, 0xed, 0x06, 0xd2, 0xcb, 0x42, 0x7f,
+  0xe9, 0x90, 0xdd, 0x12, 0xda, 0x04, 0x44, 0xbe, 0xbf, 0x1b, 0x05, 0x7f,
+  0xeb, 0x95, 0x36, 0x18, 0x4e, 0xf4, 0x04, 0x65, 0x3a, 0x1a, 0xf3, 0x81,
+  0xea, 0x25, 0x16, 0xef, 0xe9, 0x37, 0xda, 0x2d, 0x23, 0xfc, 0xa5, 0xc8,
+  0xfa, 0xcc, 0xec, 0xf6, 0xab, 0xa7, 0xd8, 0x0f, 0x99, 0xec, 0xe1, 0xec,
+  0x7f, 0xf1, 0x2d, 0x0c, 0x26, 0xfd, 0xee, 0x59, 0xab, 0xbe, 0xe8, 0xcb,
+  0x2a, 0x7f, 0x1c, 0xfc, 0x17, 0xf5, 0xa9, 0x72, 0xde, 0x0e, 0xe3, 0x01,
+  0xa1, 0x4a, 0x1e, 0xea, 0x1a, 0xa1, 0x68, 0xa6, 0x68, 0x36, 0x81, 0x36,
+  0x9c, 0x64, 0x9d, 0xba, 0x36, 0xe9, 0x9c, 0xd7, 0xb0, 0x51, 0x40, 0x20,
+  0x81, 0xcc, 0x3e, 0x10, 0x03, 0xea, 0x81, 0x9f, 0x4b, 0x3f, 0x06, 0xf3,
+  0xe5, 0x0e, 0x4d, 0xfa, 0x09, 0x28, 0x12, 0x31, 0x47, 0x21, 0xe7, 0xdf,
+  0xd4, 0x0f, 0x00, 0x23, 0xd7, 0x41, 0x7f, 0xeb, 0xfa, 0xce, 0xac, 0xed,
+  0x3c, 0x9f, 0x25, 0xec, 0x0c, 0xad, 0xce, 0x7f, 0xd5, 0x4e, 0x69, 0x10,
+  0xf2, 0x58, 0xd7, 0xf1, 0x3f, 0x3e, 0x59, 0x27, 0x69, 0xd3, 0x77, 0x09,
+  0x4d, 0x1d, 0xa7, 0x05, 0x9c, 0x7f, 0xb4, 0x0a, 0x03, 0x15, 0x5a, 0xaa,
+  0x81, 0xa0, 0x17, 0x0d, 0xf0, 0xe7, 0x0f, 0xb1, 0xa3, 0xf8, 0x12, 0x19,
+  0xb8, 0x92, 0x04, 0x8a, 0x30, 0xf2, 0x0f, 0x24, 0xbd, 0x11, 0x81, 0xe2,
+  0x35, 0x70, 0xb9, 0x70, 0x0c, 0xfc, 0x12, 0xf0, 0x5d, 0xc0, 0xcc, 0x0f,
+  0x05, 0x65, 0xb7, 0x1e, 0x81, 0x07, 0x40, 0x0c, 0x81, 0xee, 0x82, 0xb1,
+  0x31, 0xd7, 0xdf, 0x11, 0x9f, 0x13, 0x87, 0xdd, 0xe7, 0xd0, 0xc0, 0x67,
+  0x5c, 0xe2, 0x31, 0xc5, 0x1b, 0x00, 0x81, 0xe1, 0xf8, 0x8d, 0x37, 0x11,
+  0xf3, 0xee, 0xf8, 0xfb, 0x0a, 0xee, 0x03, 0x46, 0x33, 0x2f, 0x1a, 0xf3,
+  0x26, 0x81, 0x21, 0x34, 0x15, 0xe3, 0xe2, 0xee, 0xe5, 0xf1, 0x66, 0xea,
+  0x19, 0xef, 0x06, 0x81, 0x21, 0x13, 0x27, 0x5c, 0x2d, 0x36, 0x07, 0x13,
+  0xe0, 0xfe, 0xf8, 0xea, 0xe4, 0xc8, 0x09, 0x11, 0xec, 0xdd, 0x1a, 0xa5,
+  0xb6, 0xde, 0x81, 0xc6, 0xaa, 0xb8, 0xd2, 0x45, 0x69, 0x0f, 0xc2, 0x07,
+  0x31, 0x68, 0xc1, 0x7f, 0xb6, 0xa2, 0xa4, 0xfc, 0xf4, 0x8b, 0x2d, 0x7f,
+  0xcb, 0xe0, 0x92, 0x62, 0xda, 0x35, 0x6c, 0xef, 0xa7, 0x10, 0xde, 0x5e,
+  0x7f, 0x33, 0xa9, 0x29, 0x09, 0x32, 0x04, 0x77, 0x71, 0xfd, 0x65, 0x79,
+  0x73, 0x19, 0x50, 0xe9, 0xd1, 0x24, 0x2e, 0xdb, 0x26, 0x8a, 0x90, 0xbd,
+  0x23, 0x4f, 0xe5, 0xd7, 0xd2, 0x7f, 0xcd, 0xe2, 0x5d, 0xb2, 0x7f, 0xfa,
+  0xd2, 0x2b, 0xa5, 0x15, 0x24, 0x9b, 0xec, 0xf0, 0xf4, 0xe1, 0x14, 0xef,
+  0x0d, 0xcd, 0xb5, 0x02, 0x7f, 0x0d, 0x14, 0x0d, 0xa6, 0x06, 0xa0, 0xf2,
+  0x2c, 0xf0, 0xa0, 0x13, 0xff, 0x7f, 0x24, 0xd9, 0x61, 0x0a, 0x42, 0xa4,
+  0x66, 0xd4, 0x71, 0xe8, 0x7e, 0xd6, 0x31, 0x13, 0x71, 0xf2, 0x7f, 0x38,
+  0xfc, 0xd7, 0x3d, 0x35, 0xce, 0xd0, 0x95, 0xd9, 0x1d, 0x11, 0xc6, 0x0a,
+  0xff, 0x2c, 0x12, 0xb2, 0x3d, 0x13, 0xe8, 0x24, 0x1c, 0xde, 0x58, 0xcd,
+  0xce, 0x81, 0x01, 0x07, 0xcb, 0xe7, 0x0e, 0xf4, 0x02, 0x0c, 0xcd, 0xcc,
+  0xfc, 0x04, 0xc7, 0x81, 0xe2, 0xe5, 0xf6, 0xf2, 0xa2, 0x1f, 0x17, 0xda,
+  0x28, 0x1f, 0x81, 0x18, 0x71, 0x36, 0xca, 0xfb, 0x06, 0xa4, 0xed, 0xd9,
+  0xf9, 0xfc, 0xf8, 0xbf, 0x7f, 0x27, 0xb4, 0x1b, 0x2d, 0x4d, 0xe8, 0x04,
+  0x32, 0x1b, 0x98, 0xf0, 0xe3, 0xda, 0x21, 0x3a, 0xe1, 0x0b, 0xe9, 0x69,
+  0xba, 0xe0, 0x2a, 0xc8, 0x04, 0x37, 0xff, 0x7f, 0xd6, 0x51, 0x2d, 0xfe,
+  0xf6, 0x2f, 0xa1, 0x56, 0xd3, 0x12, 0x64, 0xfe, 0xbc, 0x7f, 0x19, 0x33,
+  0x00, 0x44, 0xc8, 0xa2, 0x6c, 0x6d, 0x81, 0x08, 0x45, 0x0e, 0x3e, 0x4b,
+  0xbc, 0xf7, 0xed, 0x34, 0x1e, 0x49, 0x7f, 0x0d, 0x97, 0xf8, 0x0e, 0x01,
+  0x12, 0xe3, 0x1d, 0x0b, 0xb9, 0xdf, 0x17, 0xce, 0xf5, 0x08, 0x45, 0x05,
+  0x7f, 0xbe, 0x87, 0x44, 0xf1, 0xfc, 0x86, 0x35, 0x1d, 0x25, 0x2e, 0x95,
+  0x4a, 0xf0, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00,
+  0xe5, 0x03, 0x00, 0x00, 0xe3, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00,
+  0x83, 0x0f, 0x00, 0x00, 0x7c, 0x10, 0x00, 0x00, 0x4b, 0xf8, 0xff, 0xff,
+  0x98, 0x0c, 0x00, 0x00, 0xa6, 0xfa, 0xff, 0xff, 0xa3, 0xf9, 0xff, 0xff,
+  0x82, 0xfc, 0xff, 0xff, 0xd2, 0x0e, 0x00, 0x00, 0x68, 0xf9, 0xff, 0xff,
+  0x99, 0x0e, 0x00, 0x00, 0xb9, 0x16, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00,
+  0xa1, 0x07, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff,
+  0x56, 0xfc, 0xff, 0xff, 0x01, 0x11, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00,
+  0xbf, 0xfc, 0xff, 0xff, 0xb3, 0x07, 0x00, 0x00, 0x11, 0xfe, 0xff, 0xff,
+  0x95, 0xfa, 0xff, 0xff, 0xa0, 0x0b, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00,
+  0xc2, 0x06, 0x00, 0x00, 0x18, 0x1d, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00,
+  0x4a, 0x0e, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00, 0x59, 0x06, 0x00, 0x00,
+  0x7a, 0x0d, 0x00, 0x00, 0x76, 0x13, 0x00, 0x00, 0x52, 0x0c, 0x00, 0x00,
+  0xb5, 0xfc, 0xff, 0xff, 0x55, 0x08, 0x00, 0x00, 0x85, 0x06, 0x00, 0x00,
+  0x5a, 0xf5, 0xff, 0xff, 0x94, 0xff, 0xff, 0xff, 0x44, 0x0a, 0x00, 0x00,
+  0xc5, 0xfc, 0xff, 0xff, 0x42, 0x05, 0x00, 0x00, 0x12, 0xfe, 0xff, 0xff,
+  0xc1, 0x02, 0x00, 0x00, 0x0f, 0xfc, 0xff, 0xff, 0xa7, 0xff, 0xff, 0xff,
+  0xd8, 0xef, 0xff, 0xff, 0xfd, 0x06, 0x00, 0x00, 0xd7, 0x03, 0x00, 0x00,
+  0x56, 0xf5, 0xff, 0xff, 0xd6, 0x12, 0x00, 0x00, 0x35, 0xfd, 0xff, 0xff,
+  0x44, 0x0b, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x58, 0x04, 0x00, 0x00,
+  0xdb, 0x08, 0x00, 0x00, 0x18, 0xfd, 0xff, 0xff, 0x78, 0xf8, 0xff, 0xff,
+  0x70, 0x00, 0x00, 0x00, 0xce, 0x04, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00,
+  0x7e, 0x11, 0x00, 0x00, 0xf4, 0x0e, 0x00, 0x00, 0x33, 0x07, 0x00, 0x00,
+  0xfb, 0x0b, 0x00, 0x00, 0x28, 0x11, 0x00, 0x00, 0xb4, 0x0e, 0x00, 0x00,
+  0x0e, 0xfd, 0xff, 0xff, 0x49, 0x0d, 0x00, 0x00, 0xcf, 0x15, 0x00, 0x00,
+  0x4f, 0x0d, 0x00, 0x00, 0x8b, 0xfc, 0xff, 0xff, 0x65, 0x13, 0x00, 0x00,
+  0xca, 0x25, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00, 0x29, 0xf7, 0xff, 0xff,
+  0x02, 0x02, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00, 0x35, 0x24, 0x00, 0x00,
+  0xe5, 0x08, 0x00, 0x00, 0x86, 0xfd, 0xff, 0xff, 0x19, 0xfc, 0xff, 0xff,
+  0x55, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x1c, 0x07, 0x00, 0x00,
+  0x10, 0xfb, 0xff, 0xff, 0x20, 0x0a, 0x00, 0x00, 0xd1, 0xfe, 0xff, 0xff,
+  0x81, 0x0c, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00,
+  0x1c, 0xf5, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x00, 0xeb, 0x08, 0x00, 0x00,
+  0xd6, 0xf1, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+  0xf1, 0xc6, 0x52, 0x02, 0x55, 0xea, 0xc4, 0xbb, 0x30, 0xc5, 0xb7, 0x07,
+  0x37, 0x19, 0xef, 0x35, 0xe0, 0xe8, 0xe0, 0xdf, 0xd5, 0xb2, 0xfa, 0x55,
+  0xc7, 0x1d, 0x50, 0xdf, 0x67, 0x09, 0xf7, 0xcc, 0x56, 0xdd, 0xc9, 0x40,
+  0xaa, 0xd2, 0xd6, 0x13, 0x38, 0xa6, 0xc4, 0x4c, 0x16, 0xbb, 0x56, 0x0b,
+  0xb1, 0xd9, 0xf4, 0x66, 0xdb, 0xd2, 0xc5, 0x65, 0x21, 0x40, 0x73, 0xb4,
+  0xce, 0x5a, 0xef, 0x3f, 0x0a, 0x16, 0x4a, 0x4b, 0x3a, 0x37, 0x55, 0xb2,
+  0x5a, 0xe0, 0x29, 0x55, 0x9c, 0x1f, 0xd0, 0x25, 0x35, 0x03, 0x7f, 0xd7,
+  0xd1, 0xd4, 0xc3, 0x36, 0x1c, 0x4e, 0x02, 0xb6, 0x05, 0x1c, 0xf6, 0x0f,
+  0xd9, 0x19, 0xbb, 0xdc, 0xf2, 0x4b, 0x34, 0xfb, 0x38, 0xbb, 0xb5, 0x23,
+  0x3c, 0xf4, 0x08, 0x33, 0x5d, 0xea, 0x16, 0x6c, 0xd7, 0x0b, 0x30, 0x1f,
+  0x21, 0x1b, 0xe0, 0x5a, 0x0e, 0x15, 0x73, 0xca, 0x2e, 0x68, 0xfe, 0x1c,
+  0x38, 0x42, 0xf1, 0xcc, 0xf3, 0x07, 0xfc, 0xbc, 0xe6, 0x19, 0xd4, 0xe0,
+  0xc3, 0x8a, 0x7f, 0x23, 0x16, 0x50, 0xc6, 0xc7, 0x1c, 0x5b, 0x1b, 0x51,
+  0xd8, 0x55, 0xd7, 0xc8, 0xda, 0x2c, 0x35, 0x2f, 0x54, 0x0c, 0x14, 0x17,
+  0xab, 0x44, 0xe6, 0x2c, 0x54, 0xd0, 0xe9, 0x53, 0xc9, 0x44, 0xc7, 0xb1,
+  0x2f, 0x6c, 0xd9, 0xa2, 0x4b, 0x55, 0x5a, 0x12, 0x3c, 0x5d, 0x2b, 0x17,
+  0x20, 0x06, 0xc9, 0x2d, 0xee, 0xcc, 0x2f, 0x3f, 0x81, 0x3c, 0xe4, 0x57,
+  0x34, 0xf1, 0x2d, 0xb9, 0xe1, 0xf3, 0x15, 0x1b, 0xb3, 0xf8, 0x39, 0x0f,
+  0xf5, 0x2e, 0x45, 0xf1, 0xce, 0x27, 0x30, 0x34, 0xc9, 0xef, 0xc0, 0xb6,
+  0xb3, 0x39, 0x38, 0xf4, 0xab, 0xd5, 0xf6, 0xef, 0xca, 0x44, 0xff, 0xbe,
+  0x2f, 0x03, 0x2f, 0xc4, 0xdb, 0x0a, 0x09, 0x05, 0xca, 0x38, 0xdd, 0xfa,
+  0xe3, 0x0e, 0xc7, 0x22, 0x37, 0x0f, 0x18, 0x2f, 0xba, 0x1b, 0x05, 0xc9,
+  0x11, 0xd6, 0x0f, 0x04, 0xd6, 0xee, 0xf2, 0xf8, 0x0d, 0xba, 0x00, 0xd9,
+  0xfe, 0xb9, 0xee, 0xe6, 0x28, 0x3c, 0xe6, 0xfd, 0xd7, 0xb1, 0xce, 0xe5,
+  0x45, 0x09, 0x2e, 0xd6, 0xdf, 0x1e, 0xc1, 0x2a, 0x12, 0x1c, 0x3b, 0xeb,
+  0x52, 0x52, 0x32, 0x09, 0x68, 0x5d, 0xe0, 0x17, 0x4d, 0xcc, 0xe2, 0xc4,
+  0xdb, 0xbc, 0xc4, 0x65, 0x2e, 0xce, 0x46, 0xf4, 0xe2, 0xfa, 0x05, 0xfb,
+  0xd0, 0xe6, 0x30, 0x40, 0x14, 0xab, 0xda, 0x0d, 0x1c, 0xff, 0xdf, 0xda,
+  0x2f, 0xb7, 0x35, 0xdc, 0x51, 0x2b, 0x39, 0xbd, 0xb0, 0xc4, 0x81, 0xf4,
+  0xc4, 0x27, 0xfc, 0x4c, 0x2e, 0xfd, 0xd3, 0xf5, 0xf8, 0xf5, 0xfe, 0x5b,
+  0x21, 0xb0, 0x38, 0xd9, 0x0f, 0x5f, 0x5a, 0xe3, 0xcb, 0x95, 0x29, 0x42,
+  0x2b, 0x39, 0xe8, 0x83, 0xcd, 0x35, 0x12, 0xcd, 0x4e, 0xc1, 0xc6, 0x21,
+  0x31, 0x6c, 0x0c, 0x1f, 0xf6, 0xea, 0x30, 0x28, 0x32, 0x5b, 0x06, 0x0c,
+  0x22, 0xe2, 0xe8, 0xd6, 0x00, 0x13, 0xe0, 0x25, 0x4f, 0xc3, 0x6d, 0x27,
+  0xd6, 0x0b, 0x36, 0xdc, 0xd9, 0x38, 0xd4, 0xc4, 0x3f, 0x75, 0x18, 0xa0,
+  0xf2, 0x24, 0xc0, 0x45, 0x02, 0xcc, 0xd8, 0xcb, 0x05, 0x41, 0x27, 0x54,
+  0x29, 0xbf, 0x0d, 0xac, 0xc3, 0x49, 0xb3, 0x02, 0x25, 0xc4, 0xed, 0x1d,
+  0x16, 0xc4, 0xff, 0xdd, 0xd8, 0x42, 0xfe, 0xed, 0x24, 0xe0, 0xa2, 0xcd,
+  0xe4, 0x44, 0x6f, 0x2d, 0x3c, 0x09, 0x13, 0xdd, 0x09, 0xc8, 0xcc, 0xfe,
+  0x1d, 0x53, 0x50, 0xe9, 0xa8, 0xe1, 0x40, 0x31, 0x24, 0x7f, 0xc2, 0x23,
+  0x3f, 0xc2, 0x32, 0x2b, 0x1f, 0xb2, 0x10, 0x24, 0x43, 0xc8, 0x07, 0xdf,
+  0x16, 0x41, 0x1f, 0x1a, 0x2a, 0x21, 0xd9, 0x3d, 0x1d, 0x1b, 0x06, 0xf6,
+  0xcc, 0xe9, 0x03, 0xd3, 0x26, 0x16, 0x09, 0xcd, 0xfa, 0x09, 0xe4, 0x14,
+  0xbd, 0xec, 0x27, 0x0d, 0xcb, 0xc9, 0x21, 0x38, 0xde, 0x0b, 0x18, 0xf0,
+  0x81, 0x40, 0x16, 0x14, 0x20, 0x02, 0x12, 0x00, 0x42, 0x26, 0xdf, 0xfb,
+  0x18, 0xed, 0x1c, 0xe7, 0xf6, 0x41, 0xff, 0x14, 0x38, 0xf9, 0x44, 0xe2,
+  0xef, 0x3b, 0xf7, 0xe1, 0xf4, 0xf7, 0x0b, 0x36, 0x46, 0x0f, 0x34, 0x19,
+  0xce, 0x1b, 0xf8, 0x10, 0x2b, 0xbf, 0x46, 0x3c, 0xf5, 0xff, 0x19, 0xc8,
+  0xe1, 0xd0, 0x49, 0x47, 0xca, 0xec, 0xfe, 0xfa, 0xb6, 0xc3, 0xec, 0x81,
+  0x30, 0x3a, 0x3d, 0xd2, 0x0c, 0xe2, 0xfd, 0x61, 0xda, 0xcb, 0x4e, 0xfd,
+  0xc2, 0xd6, 0xe5, 0xf3, 0x0d, 0xc3, 0x0d, 0xc8, 0xec, 0xb6, 0xf8, 0xdb,
+  0x02, 0x2b, 0xb5, 0x03, 0x04, 0x4d, 0xfc, 0xfa, 0xef, 0x41, 0xa1, 0xe7,
+  0xcc, 0x24, 0xda, 0xf5, 0x26, 0x2f, 0x31, 0xe9, 0xfe, 0xe5, 0x00, 0xf9,
+  0xda, 0x02, 0x40, 0xde, 0xdb, 0x09, 0x4c, 0x0f, 0x37, 0xf9, 0xd3, 0x04,
+  0x1b, 0xbe, 0xd3, 0x19, 0x01, 0xc6, 0xd7, 0xfe, 0x1c, 0x01, 0xf3, 0x2c,
+  0xcd, 0xfb, 0xfc, 0xdc, 0x49, 0x49, 0x5a, 0xed, 0xeb, 0x09, 0x2a, 0xf7,
+  0x76, 0x42, 0xdf, 0xb0, 0xce, 0x69, 0xfe, 0x02, 0x71, 0x13, 0xb1, 0xe0,
+  0x3f, 0xbb, 0x23, 0x45, 0x3c, 0x1f, 0xf6, 0x78, 0x31, 0x34, 0x10, 0x5f,
+  0xb8, 0x6d, 0x27, 0x3f, 0xbd, 0x78, 0x00, 0x1c, 0x1c, 0x2b, 0x48, 0x61,
+  0xac, 0x59, 0xfd, 0xf3, 0x7f, 0xa9, 0x5e, 0x50, 0x1d, 0xec, 0x5a, 0xa5,
+  0x0d, 0xa8, 0xb5, 0x9c, 0xf2, 0x65, 0x04, 0x0f, 0x75, 0xbe, 0xd8, 0xe1,
+  0x0f, 0xfe, 0x5b, 0xa3, 0xc3, 0xe0, 0x3c, 0x21, 0xa1, 0x15, 0x42, 0x60,
+  0x5d, 0x19, 0x46, 0x35, 0xca, 0x3c, 0xb6, 0x3e, 0x5d, 0xcd, 0xf9, 0xa8,
+  0x66, 0x2f, 0x9e, 0x2d, 0x58, 0x11, 0x61, 0x42, 0xc9, 0xee, 0x0b, 0xcb,
+  0x14, 0x15, 0xea, 0xab, 0x3f, 0x04, 0xc7, 0xfb, 0x1b, 0x28, 0x2d, 0x41,
+  0x0f, 0xe9, 0xc1, 0xcb, 0xd8, 0x5a, 0xc6, 0x1c, 0x20, 0xf2, 0x4c, 0x6c,
+  0xa7, 0x58, 0x2c, 0x49, 0xd3, 0x1e, 0xb9, 0x5a, 0x5a, 0xf2, 0x33, 0x08,
+  0x6f, 0x12, 0x02, 0x49, 0x51, 0x37, 0xc3, 0xab, 0xdb, 0xdd, 0xf6, 0x76,
+  0xe4, 0xb5, 0xea, 0xfd, 0xd8, 0x09, 0xdc, 0xb0, 0x30, 0x69, 0x92, 0x6a,
+  0x68, 0x36, 0x36, 0x69, 0xee, 0xec, 0xf8, 0x57, 0xcc, 0x36, 0x24, 0x0c,
+  0x4d, 0x6b, 0x12, 0x10, 0xd2, 0x7f, 0x56, 0x54, 0x2b, 0x37, 0xd4, 0x85,
+  0x1b, 0x24, 0x31, 0xca, 0x27, 0xea, 0xcc, 0x60, 0xc2, 0xb3, 0xd9, 0x35,
+  0xf2, 0x00, 0x36, 0x16, 0x27, 0xd2, 0xf7, 0xba, 0x1a, 0x14, 0xe2, 0x07,
+  0xea, 0xce, 0xce, 0xeb, 0xe6, 0x08, 0xad, 0xe9, 0x0f, 0x32, 0xc4, 0xc0,
+  0x27, 0xf4, 0xe9, 0x0d, 0xea, 0xf1, 0xcd, 0x3f, 0x1b, 0x09, 0xfa, 0xf8,
+  0xd7, 0x05, 0xd0, 0xd0, 0x37, 0xfb, 0x1b, 0xfb, 0x5a, 0x26, 0xaa, 0x12,
+  0x27, 0x0a, 0xda, 0xd6, 0x1b, 0xfa, 0xd7, 0x2d, 0x1f, 0xc8, 0xda, 0xe9,
+  0xef, 0x46, 0x1a, 0xba, 0xbb, 0x0b, 0x3d, 0x2b, 0xdb, 0x1c, 0x29, 0xd4,
+  0xf7, 0x1d, 0xcb, 0xdf, 0xf4, 0x81, 0xe8, 0x55, 0x0c, 0x1b, 0x2a, 0x36,
+  0xed, 0x02, 0xea, 0x0e, 0x32, 0x30, 0x04, 0x27, 0x41, 0x1e, 0x3e, 0xef,
+  0xcf, 0x4b, 0x5b, 0x97, 0x06, 0x5f, 0x7a, 0x1b, 0x28, 0x2f, 0x23, 0x87,
+  0x6d, 0x60, 0xd8, 0x0c, 0xe8, 0x5d, 0x9a, 0xd4, 0xef, 0x2f, 0x49, 0xce,
+  0x27, 0x45, 0x92, 0x9a, 0xdb, 0x62, 0xbb, 0xaa, 0x58, 0x77, 0x7f, 0x51,
+  0xec, 0x1d, 0xe6, 0x2a, 0x03, 0x62, 0xb1, 0xea, 0x8d, 0xb5, 0xf3, 0xdd,
+  0xc3, 0xde, 0x4d, 0xf9, 0x4b, 0x22, 0xbc, 0xd2, 0xa9, 0x03, 0xf6, 0xeb,
+  0x07, 0x51, 0x7e, 0x37, 0x7c, 0xcb, 0xa1, 0xf7, 0x1b, 0xe2, 0xae, 0xd0,
+  0x62, 0x56, 0xc0, 0x6b, 0xf7, 0x46, 0x52, 0x34, 0x5b, 0xef, 0x43, 0x4b,
+  0xb4, 0x4e, 0x67, 0xb7, 0x2f, 0x1b, 0x0e, 0xc2, 0xc6, 0xe0, 0xde, 0xd8,
+  0x13, 0x3a, 0xf4, 0x23, 0x2a, 0x14, 0x20, 0xf7, 0x22, 0x15, 0xef, 0x13,
+  0xfa, 0xe4, 0xfc, 0xf9, 0xe2, 0xf6, 0x0f, 0x15, 0x01, 0x14, 0x0f, 0xed,
+  0xed, 0xe6, 0xef, 0x20, 0x14, 0x08, 0x10, 0xf8, 0xeb, 0xeb, 0x0c, 0x0c,
+  0x02, 0x1d, 0xf8, 0xe0, 0x0d, 0x31, 0xda, 0x00, 0xf7, 0x06, 0xdf, 0xee,
+  0x7f, 0x30, 0x24, 0x1b, 0xe8, 0xfe, 0x15, 0x05, 0xf3, 0xe2, 0x23, 0xf1,
+  0xe8, 0x04, 0x24, 0x03, 0x08, 0x12, 0xf3, 0x0e, 0x0e, 0x0b, 0xee, 0xef,
+  0x10, 0x1e, 0xed, 0x12, 0x07, 0xfc, 0xf6, 0x26, 0xda, 0x04, 0xdb, 0x0e,
+  0x13, 0xee, 0x0d, 0x09, 0x01, 0x25, 0x0b, 0xcc, 0xde, 0x13, 0xef, 0xfd,
+  0x04, 0x0e, 0xeb, 0x17, 0x34, 0x0a, 0xd6, 0x35, 0xc3, 0x23, 0xef, 0x36,
+  0xe2, 0x0f, 0x30, 0xbe, 0xb8, 0xd5, 0xe5, 0xbf, 0x1e, 0xfe, 0x00, 0x4f,
+  0xc8, 0xd4, 0x53, 0xa9, 0x3c, 0xf4, 0xdb, 0x50, 0xbc, 0xc4, 0xda, 0x10,
+  0xe5, 0xb1, 0xf3, 0x1c, 0x33, 0x32, 0xcd, 0xe5, 0x02, 0xc0, 0xfa, 0x2c,
+  0xd1, 0xa3, 0xba, 0x66, 0x16, 0xcf, 0xc3, 0x4b, 0xed, 0xd1, 0x53, 0x24,
+  0x1b, 0x4e, 0xda, 0x19, 0x50, 0x03, 0xdb, 0x51, 0x24, 0x7f, 0x31, 0x2b,
+  0x3b, 0x42, 0xf0, 0xfb, 0xe8, 0xe7, 0x96, 0xa8, 0xe3, 0x4e, 0x2e, 0x54,
+  0xe3, 0x0a, 0x42, 0x4b, 0xa7, 0x99, 0x3f, 0x2d, 0x53, 0xdc, 0x18, 0x49,
+  0x56, 0xde, 0x5c, 0x55, 0x49, 0x37, 0x2f, 0x37, 0x4e, 0xbf, 0x10, 0x0c,
+  0x4c, 0x3d, 0x46, 0xec, 0xab, 0xc9, 0xcd, 0x16, 0x49, 0xe6, 0x42, 0xec,
+  0xf1, 0x25, 0x10, 0x15, 0xca, 0xc6, 0x2b, 0x20, 0x32, 0x51, 0xf9, 0x25,
+  0xbe, 0xef, 0x22, 0x29, 0xb7, 0x23, 0xd5, 0x0b, 0xc7, 0x1b, 0x0e, 0xe6,
+  0x2c, 0x5d, 0xee, 0xe2, 0xbb, 0x1f, 0x41, 0xde, 0xec, 0x17, 0xf1, 0xd3,
+  0xf4, 0x6f, 0xca, 0x0d, 0xdd, 0xdc, 0xd3, 0x42, 0xfa, 0xf4, 0x58, 0x06,
+  0xc7, 0x35, 0xcb, 0xee, 0xb9, 0x36, 0x40, 0xd2, 0x2d, 0xb8, 0x65, 0xed,
+  0xb8, 0xbd, 0x38, 0x7f, 0xfe, 0xea, 0xd0, 0x37, 0x5a, 0xdb, 0x19, 0xed,
+  0xcf, 0x9f, 0x3e, 0x23, 0x51, 0xca, 0x01, 0xa1, 0xe6, 0xe2, 0x42, 0x25,
+  0xee, 0xc3, 0xa3, 0xbc, 0xca, 0xde, 0xf3, 0x18, 0xd4, 0x2a, 0x05, 0x4c,
+  0xc5, 0xcc, 0xe4, 0x16, 0x9c, 0x9e, 0xc5, 0x2c, 0x5b, 0xfa, 0xe2, 0x0a,
+  0x5d, 0x79, 0x24, 0xa0, 0x1d, 0x8b, 0x45, 0x50, 0x07, 0x8d, 0x23, 0xdb,
+  0x35, 0xf8, 0x60, 0x33, 0x5d, 0x06, 0xd4, 0x00, 0xe5, 0x12, 0x17, 0x7a,
+  0xf7, 0xb5, 0xfb, 0x47, 0xb9, 0xfe, 0x40, 0xad, 0xb2, 0xa7, 0xce, 0x55,
+  0x0d, 0x6f, 0x33, 0xbc, 0x32, 0x98, 0x3a, 0x37, 0x2d, 0xe3, 0xbb, 0xb5,
+  0xbc, 0xb2, 0x9a, 0x29, 0x58, 0x12, 0x5c, 0xd0, 0x31, 0x7f, 0xfc, 0x48,
+  0x17, 0xf3, 0xe7, 0x25, 0x66, 0xbb, 0x4c, 0xab, 0x31, 0x0d, 0xcf, 0xe1,
+  0x69, 0x0a, 0xa7, 0xa0, 0x59, 0x1c, 0xa6, 0x26, 0x28, 0x26, 0x58, 0x72,
+  0x4d, 0x49, 0x25, 0x5f, 0x18, 0x47, 0x55, 0xa4, 0x05, 0x1b, 0xd2, 0x03,
+  0xdf, 0x77, 0x61, 0xd2, 0x38, 0x66, 0xec, 0xff, 0x13, 0xb0, 0xd3, 0xcc,
+  0xeb, 0x8c, 0x24, 0x12, 0xb8, 0xbf, 0xd0, 0xe9, 0x41, 0x3e, 0xb6, 0x73,
+  0xe6, 0xc3, 0x12, 0x64, 0xec, 0x69, 0xbb, 0x13, 0xce, 0x11, 0x39, 0xd2,
+  0x1e, 0xf9, 0x45, 0xa1, 0x10, 0x33, 0x70, 0x61, 0xc5, 0x32, 0x96, 0xd5,
+  0xb3, 0xf6, 0xba, 0x01, 0x59, 0x57, 0xad, 0xe2, 0x32, 0x7f, 0xbe, 0x7a,
+  0xcd, 0xfa, 0x6e, 0xdf, 0x1e, 0x46, 0xb9, 0x41, 0x3d, 0x2c, 0xa4, 0x6b,
+  0x01, 0xdf, 0xeb, 0xd8, 0x62, 0x37, 0x48, 0x32, 0x71, 0x41, 0xca, 0x2e,
+  0xe2, 0x37, 0xcb, 0x44, 0xb6, 0x12, 0x06, 0x07, 0xb7, 0x43, 0x40, 0x41,
+  0xd4, 0x2a, 0xf1, 0xc9, 0xe9, 0xb0, 0x50, 0x4b, 0x16, 0x4f, 0x75, 0xf3,
+  0xe3, 0xc1, 0xea, 0x68, 0xdd, 0x5b, 0x2b, 0x45, 0x21, 0x59, 0x38, 0x13,
+  0x67, 0x7f, 0x13, 0x41, 0x2b, 0x10, 0xfd, 0x4f, 0x41, 0x6c, 0xee, 0xf7,
+  0x26, 0x75, 0x3a, 0x4a, 0xc9, 0x72, 0xa7, 0xf2, 0x16, 0xae, 0x71, 0xcb,
+  0xfc, 0x3f, 0x47, 0x1d, 0x48, 0xf6, 0xf9, 0x79, 0x4c, 0xd8, 0x92, 0xf4,
+  0xe9, 0xa0, 0x1b, 0x5a, 0xe6, 0xfe, 0xe0, 0xb3, 0xf7, 0xb3, 0x48, 0xfc,
+  0x3b, 0x32, 0xbb, 0x36, 0xf9, 0xf8, 0x4d, 0x58, 0xea, 0xfb, 0x15, 0xc0,
+  0x0d, 0x2d, 0xc3, 0x10, 0x56, 0xd8, 0xf4, 0x43, 0xfb, 0xe5, 0x1c, 0x16,
+  0xd4, 0x61, 0xda, 0xca, 0xb9, 0x0f, 0xe6, 0xfe, 0x5c, 0x2f, 0x02, 0xb2,
+  0xbe, 0x61, 0xee, 0x1a, 0x0f, 0x37, 0x6d, 0xd4, 0xc6, 0x22, 0x28, 0x97,
+  0x24, 0xd0, 0x40, 0x49, 0xd9, 0xb4, 0x37, 0xdf, 0xc4, 0xe1, 0x57, 0x25,
+  0x01, 0xa6, 0xe1, 0x6f, 0x7f, 0x92, 0x03, 0xd6, 0x23, 0x1e, 0xba, 0x35,
+  0xbb, 0x26, 0x55, 0x09, 0x2b, 0x28, 0xe2, 0x97, 0xe3, 0x3b, 0x2f, 0x2b,
+  0xc7, 0xf1, 0x37, 0x19, 0x08, 0x01, 0xfc, 0xdf, 0xe3, 0x25, 0xfa, 0xde,
+  0xed, 0x2a, 0x2f, 0x25, 0x04, 0xe9, 0x60, 0x0b, 0x62, 0xfa, 0x1c, 0xb8,
+  0x18, 0xe4, 0x00, 0xfd, 0x28, 0xfa, 0x4f, 0x5d, 0x22, 0xfc, 0xce, 0xd2,
+  0xac, 0x70, 0x06, 0xda, 0x0e, 0x5b, 0xbc, 0x03, 0x34, 0x7f, 0xd6, 0xe6,
+  0x96, 0x41, 0x38, 0x11, 0xfa, 0xfb, 0x7b, 0x3a, 0xf5, 0xf4, 0x76, 0xec,
+  0x33, 0x35, 0x15, 0x31, 0x00, 0xac, 0x25, 0x66, 0x29, 0xa4, 0x04, 0x5e,
+  0xba, 0xea, 0xe3, 0x44, 0x69, 0xad, 0xd0, 0xbf, 0x04, 0x51, 0xc8, 0x68,
+  0x45, 0x1f, 0x65, 0x53, 0xdc, 0xe5, 0x13, 0x10, 0x1d, 0xee, 0x53, 0x55,
+  0x0c, 0x16, 0x41, 0x1f, 0x31, 0xac, 0x5d, 0x4e, 0x3b, 0xbf, 0x13, 0xe0,
+  0x96, 0x1b, 0xbd, 0x36, 0x42, 0x93, 0x6a, 0x30, 0xdc, 0x47, 0xc6, 0xfe,
+  0x38, 0xb0, 0x12, 0xb8, 0xb1, 0x8c, 0xc2, 0x21, 0x49, 0xa4, 0x20, 0xee,
+  0x0b, 0xbb, 0xc4, 0x91, 0x26, 0xa3, 0xa1, 0xf9, 0xa1, 0x19, 0x3b, 0x99,
+  0xd0, 0x30, 0xcd, 0x1a, 0xe0, 0x2a, 0xfe, 0xf8, 0x05, 0x54, 0x06, 0xdb,
+  0x32, 0xc1, 0x71, 0x42, 0xb6, 0xf5, 0xe3, 0xf5, 0xf1, 0x24, 0x37, 0xca,
+  0xb9, 0x81, 0xc0, 0xb4, 0xe7, 0xa0, 0x03, 0x55, 0x30, 0x8c, 0xe4, 0x7c,
+  0xa7, 0x02, 0x13, 0xf7, 0x57, 0x1c, 0xf6, 0x31, 0xd1, 0x57, 0x55, 0xd8,
+  0xf2, 0x16, 0x38, 0x52, 0xab, 0x3c, 0x13, 0x25, 0x17, 0x10, 0x9c, 0xfd,
+  0xf1, 0x3f, 0x20, 0xc4, 0xb5, 0xd2, 0xaa, 0xf3, 0x1e, 0xd9, 0xb9, 0xb3,
+  0x15, 0xbf, 0xad, 0x0e, 0x0c, 0x0d, 0xd7, 0x50, 0x48, 0x21, 0xeb, 0x25,
+  0x20, 0xe9, 0xd8, 0x81, 0xdf, 0xcd, 0xbb, 0xac, 0xfb, 0xc3, 0xb1, 0x45,
+  0x40, 0xad, 0x90, 0xf5, 0x18, 0x5d, 0x17, 0x06, 0x35, 0x2b, 0x15, 0x2f,
+  0x52, 0xd6, 0x9f, 0xc9, 0xc4, 0xbd, 0xdb, 0x13, 0xa7, 0xbf, 0xbc, 0x3a,
+  0xc1, 0xb7, 0x15, 0x1a, 0x66, 0x12, 0x55, 0x62, 0x40, 0x07, 0x31, 0x01,
+  0x2e, 0x78, 0xcd, 0x3c, 0x0f, 0x5b, 0x24, 0x2a, 0x25, 0x31, 0x26, 0x07,
+  0x4b, 0x3b, 0x3e, 0x8e, 0x5b, 0x9d, 0x3f, 0x14, 0x08, 0xd8, 0xd0, 0x02,
+  0x10, 0x29, 0xcb, 0xb7, 0xab, 0xf5, 0xf7, 0xff, 0x48, 0xea, 0x43, 0xdb,
+  0x33, 0xc7, 0xe3, 0x43, 0x0b, 0x0e, 0xf8, 0xd1, 0x11, 0x1f, 0xc0, 0xb4,
+  0x68, 0x5a, 0xab, 0xf5, 0x13, 0xf6, 0x2d, 0x05, 0x92, 0xa0, 0xc4, 0x5c,
+  0xcf, 0x9c, 0x17, 0x39, 0x22, 0x4a, 0x81, 0x0d, 0xe0, 0x33, 0xb2, 0x6e,
+  0x30, 0xcf, 0x15, 0xfc, 0x40, 0x26, 0xde, 0xd1, 0xaf, 0x02, 0x32, 0x43,
+  0x28, 0x11, 0x44, 0x23, 0xab, 0xf6, 0x3e, 0x69, 0x13, 0x2e, 0x23, 0xa8,
+  0x20, 0xbf, 0x28, 0x9b, 0xb9, 0x4b, 0x5e, 0xb5, 0xd8, 0xe3, 0x2e, 0xf5,
+  0x23, 0xcf, 0xd8, 0xbb, 0x48, 0xd3, 0x49, 0x3d, 0xd1, 0x48, 0xd4, 0xc5,
+  0x5f, 0xbf, 0xbe, 0xd5, 0x2f, 0x3a, 0xbe, 0xd8, 0x50, 0xc8, 0x10, 0x1d,
+  0x63, 0x0c, 0xc4, 0x52, 0xe8, 0xd8, 0xcc, 0xb6, 0x36, 0x35, 0x1a, 0x18,
+  0x03, 0x01, 0xfb, 0xae, 0xf3, 0xd3, 0x15, 0x47, 0x10, 0xc4, 0x4e, 0x09,
+  0x9c, 0xd6, 0x15, 0x13, 0xe0, 0xbe, 0xe8, 0x2d, 0x08, 0xf7, 0xf9, 0xfb,
+  0x5d, 0xe9, 0xde, 0xc4, 0xdd, 0x1a, 0xc8, 0xe3, 0x6b, 0x51, 0x02, 0x07,
+  0xdd, 0x38, 0x38, 0xd1, 0x0d, 0xf7, 0x36, 0x50, 0x5b, 0xa8, 0x10, 0x81,
+  0x35, 0x35, 0x43, 0xec, 0xdc, 0x1c, 0xe0, 0x3c, 0x11, 0x06, 0xd3, 0x46,
+  0x41, 0xb7, 0x10, 0x46, 0x50, 0x94, 0xf3, 0xc6, 0x3d, 0xbb, 0x4d, 0x73,
+  0x15, 0xa8, 0x2a, 0xf1, 0x53, 0xd8, 0xbe, 0x3c, 0x57, 0xac, 0x31, 0xe9,
+  0xfa, 0xfc, 0x45, 0x08, 0x40, 0x2e, 0x3a, 0xe9, 0xf6, 0x29, 0x12, 0x21,
+  0x32, 0xe7, 0xb4, 0x01, 0x81, 0xeb, 0x10, 0x96, 0xc6, 0xcd, 0x75, 0x06,
+  0x59, 0xd0, 0x9b, 0xe6, 0x44, 0xc5, 0xd7, 0x66, 0xce, 0xea, 0x64, 0x17,
+  0x8f, 0xda, 0xbf, 0xfa, 0x10, 0x2f, 0xae, 0x9c, 0x40, 0xfc, 0x6a, 0xc1,
+  0xff, 0xfb, 0xdb, 0xba, 0x04, 0xf9, 0x43, 0x47, 0xd2, 0xd3, 0x51, 0xb5,
+  0x42, 0x0f, 0x56, 0xf4, 0xb2, 0x0d, 0x56, 0x1c, 0x79, 0xc1, 0xd7, 0x21,
+  0xc9, 0xe5, 0xc8, 0xb5, 0xd1, 0xa0, 0xd3, 0xcd, 0x3b, 0x5d, 0x45, 0x08,
+  0x63, 0x36, 0xd9, 0xb1, 0xcf, 0x2f, 0x07, 0xeb, 0x41, 0xce, 0xea, 0x02,
+  0x2a, 0xf1, 0x37, 0x41, 0x54, 0x39, 0xfe, 0xbd, 0x07, 0x15, 0x30, 0x1d,
+  0xf2, 0xd2, 0x3c, 0x08, 0xde, 0xa6, 0x72, 0x17, 0xe9, 0xbe, 0x2a, 0x54,
+  0xb3, 0xc5, 0x0d, 0x0a, 0x41, 0x49, 0x17, 0xc3, 0x01, 0x4f, 0xdb, 0x17,
+  0x51, 0x0c, 0x2d, 0x57, 0xba, 0x5a, 0xdf, 0xc7, 0xbd, 0x46, 0xd6, 0xf8,
+  0xf4, 0x4b, 0x57, 0x43, 0x32, 0xe7, 0xc7, 0xe0, 0xd4, 0xa4, 0xee, 0x81,
+  0x10, 0x3b, 0xe8, 0x99, 0x21, 0xc7, 0x18, 0xd5, 0xf8, 0x2d, 0xad, 0x23,
+  0xcb, 0x0d, 0xc9, 0xfd, 0x3c, 0xe8, 0xc7, 0x21, 0x05, 0x8a, 0xf1, 0xec,
+  0x13, 0xe4, 0xa0, 0xdc, 0xb3, 0x1f, 0x41, 0xb3, 0x1e, 0x3c, 0xf3, 0xb6,
+  0x2d, 0xd1, 0x8f, 0x35, 0x3c, 0xc0, 0x10, 0x45, 0x38, 0x96, 0x1e, 0x21,
+  0x56, 0xda, 0xe8, 0xe9, 0xd0, 0x59, 0xbb, 0xfa, 0x4d, 0x13, 0x12, 0x27,
+  0x01, 0x7f, 0xbb, 0x11, 0x22, 0x0f, 0xc7, 0x00, 0xda, 0xfa, 0xed, 0x3e,
+  0x35, 0x17, 0x39, 0x1b, 0x00, 0x2e, 0xef, 0xf6, 0xc2, 0xd1, 0xaf, 0xab,
+  0x10, 0xbf, 0x25, 0x09, 0x24, 0x64, 0x02, 0x0e, 0x12, 0x34, 0xf3, 0x61,
+  0xc3, 0xd4, 0x9e, 0xc9, 0x1d, 0xfc, 0x2d, 0xf8, 0x87, 0xc9, 0x03, 0x9f,
+  0x51, 0x81, 0xfa, 0x07, 0xaf, 0xfa, 0xf6, 0x09, 0x99, 0xdf, 0x39, 0x6b,
+  0xd1, 0xed, 0x1e, 0xf8, 0x5f, 0x04, 0xfc, 0xbc, 0xf2, 0x37, 0x2f, 0x0d,
+  0x04, 0x36, 0x12, 0x06, 0x18, 0x0a, 0xb9, 0xfc, 0xf4, 0xd9, 0xc1, 0xc3,
+  0xb0, 0x17, 0xd5, 0x52, 0xab, 0x3a, 0x32, 0xf8, 0xd3, 0x25, 0x1f, 0x34,
+  0xdd, 0x30, 0xe8, 0x4c, 0xf7, 0xb6, 0x1b, 0xe1, 0x50, 0x2f, 0x28, 0xf2,
+  0x0b, 0xae, 0x05, 0xf4, 0x45, 0xda, 0xe2, 0x2e, 0xb9, 0x43, 0x40, 0x27,
+  0x32, 0xae, 0xc0, 0x07, 0x21, 0x8e, 0x89, 0xfa, 0xed, 0x2d, 0x3c, 0xf2,
+  0x45, 0xf7, 0xee, 0xf7, 0xa0, 0x4a, 0x0a, 0x33, 0x30, 0x4a, 0x13, 0x4c,
+  0x09, 0xfe, 0xba, 0x92, 0x81, 0xb6, 0xb1, 0xfe, 0x16, 0x56, 0x26, 0x9e,
+  0xe4, 0x32, 0x48, 0xe7, 0x2b, 0xea, 0x3a, 0x93, 0x95, 0x05, 0xcf, 0xed,
+  0x83, 0x25, 0x9f, 0xf2, 0x35, 0x16, 0xde, 0xf0, 0x2f, 0x3d, 0xa2, 0xa1,
+  0xb0, 0xb7, 0x84, 0x45, 0x9e, 0xfb, 0x24, 0x0b, 0x5a, 0x13, 0x4e, 0x6a,
+  0x4b, 0x39, 0x23, 0xab, 0xa5, 0x9b, 0xf1, 0xd9, 0x55, 0xdc, 0xa1, 0xaf,
+  0x94, 0xbd, 0xd2, 0x2b, 0x22, 0xcb, 0x8b, 0x61, 0x24, 0x04, 0x87, 0xff,
+  0x3f, 0xdc, 0xfd, 0x9d, 0x1e, 0xb5, 0x4d, 0x5d, 0x4c, 0xde, 0x6f, 0x1a,
+  0xc0, 0xaa, 0xe0, 0x3b, 0xc9, 0xea, 0xda, 0xd8, 0x2f, 0x09, 0x55, 0x31,
+  0x52, 0xf7, 0x51, 0x26, 0x83, 0xb9, 0x95, 0xab, 0xd7, 0x8a, 0x33, 0x43,
+  0xa1, 0x9b, 0xfe, 0x61, 0x5f, 0x72, 0xb9, 0x4d, 0xdd, 0x12, 0x87, 0xab,
+  0xa1, 0x4b, 0xa0, 0xba, 0xab, 0xab, 0xf4, 0xe4, 0x8e, 0x07, 0x49, 0x48,
+  0x2b, 0x87, 0xcd, 0x1d, 0x68, 0x28, 0x94, 0x2f, 0x8d, 0xed, 0x05, 0x32,
+  0x19, 0xb7, 0xae, 0xe1, 0x9c, 0x16, 0x31, 0x1f, 0x37, 0xea, 0x4b, 0x2d,
+  0xf6, 0xcc, 0x9a, 0xfd, 0x38, 0x43, 0xe6, 0x4d, 0xa3, 0x14, 0x8a, 0xd1,
+  0x40, 0x35, 0xf1, 0x90, 0x81, 0xc8, 0xa2, 0x2c, 0xa7, 0x97, 0x6a, 0xea,
+  0x37, 0x8a, 0x3a, 0xac, 0x8b, 0xc8, 0xd2, 0xaf, 0xcf, 0x36, 0x9a, 0xb3,
+  0x22, 0x22, 0x2e, 0xda, 0xae, 0x27, 0x94, 0xfc, 0x27, 0xf1, 0xa9, 0x9c,
+  0x52, 0xa0, 0xd1, 0xd8, 0xa2, 0x51, 0x4b, 0xc7, 0xc4, 0xd7, 0x32, 0xf8,
+  0x03, 0x01, 0xdc, 0xdd, 0xaa, 0xfb, 0x5b, 0x03, 0x20, 0xf8, 0xb5, 0xcf,
+  0xfa, 0x49, 0x02, 0x46, 0x1e, 0x56, 0xda, 0x43, 0x18, 0x76, 0xbc, 0xe8,
+  0xfb, 0x16, 0x38, 0xe9, 0x3f, 0x98, 0x7f, 0x2b, 0xb5, 0x25, 0x08, 0x55,
+  0xa6, 0x50, 0xbc, 0xd5, 0xd7, 0xbc, 0x31, 0x44, 0x4b, 0xaf, 0x1a, 0xc4,
+  0x53, 0x25, 0x2d, 0x22, 0x71, 0x9d, 0xd6, 0x20, 0xfc, 0xd1, 0x10, 0x25,
+  0x24, 0x68, 0x3a, 0x52, 0xdd, 0x7b, 0x42, 0x3b, 0xa3, 0xff, 0xfc, 0x56,
+  0x14, 0xd3, 0xd9, 0x10, 0xc4, 0x0e, 0xd6, 0xee, 0x2d, 0xe8, 0x01, 0xc5,
+  0xbf, 0x09, 0x29, 0x09, 0xee, 0x18, 0x2a, 0xaa, 0x1b, 0x98, 0xa3, 0x0e,
+  0xac, 0x10, 0xb7, 0x53, 0xcd, 0xbc, 0xc1, 0x01, 0xc8, 0xd3, 0xa4, 0xdc,
+  0x07, 0xc1, 0xf6, 0x14, 0x3e, 0xc9, 0xe1, 0x47, 0x46, 0xdf, 0x3f, 0x1c,
+  0xcc, 0x2a, 0xde, 0xae, 0x30, 0xd3, 0xf6, 0x40, 0xc2, 0xdf, 0xc5, 0xdf,
+  0x9f, 0x00, 0xc1, 0xb5, 0xaa, 0xc9, 0xb2, 0x3f, 0xd8, 0x45, 0xf7, 0xec,
+  0xc9, 0x2a, 0x22, 0xc2, 0xd5, 0xcd, 0xcb, 0xc9, 0x15, 0x0c, 0xb2, 0xbd,
+  0x87, 0x09, 0x92, 0x32, 0xe9, 0x81, 0x34, 0x29, 0xea, 0xfe, 0xb4, 0x93,
+  0x41, 0x9a, 0x1e, 0x60, 0x2e, 0x5b, 0xdc, 0xef, 0x18, 0xea, 0xc2, 0xcf,
+  0x58, 0xb2, 0xea, 0x46, 0xb1, 0xb1, 0xef, 0x15, 0x4a, 0x11, 0xa3, 0x40,
+  0x0e, 0xc6, 0x1b, 0x02, 0xb2, 0xc3, 0x37, 0x66, 0x1f, 0x27, 0xa2, 0x1a,
+  0x33, 0xed, 0xd2, 0x81, 0x46, 0xc6, 0xb7, 0x26, 0x2e, 0xdf, 0xee, 0xf8,
+  0x09, 0x12, 0x5d, 0xdb, 0x94, 0xd1, 0xbb, 0xf6, 0xc4, 0x20, 0x0a, 0x3f,
+  0xbe, 0x15, 0x12, 0xb0, 0x32, 0x68, 0xea, 0xd8, 0x37, 0x88, 0xbd, 0x0f,
+  0xaf, 0xd0, 0x02, 0x10, 0xcd, 0xac, 0xfa, 0x2c, 0xc4, 0xef, 0x58, 0x4a,
+  0x0b, 0x4e, 0x9c, 0xf0, 0x18, 0xc1, 0xa8, 0xde, 0x49, 0x6a, 0xe0, 0xe5,
+  0xe2, 0xfd, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+  0xf9, 0x02, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0x61, 0xfe, 0xff, 0xff,
+  0xf8, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00,
+  0xed, 0x05, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00,
+  0x0d, 0x01, 0x00, 0x00, 0xc2, 0x02, 0x00, 0x00, 0xcd, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0x1a, 0x01, 0x00, 0x00, 0x19, 0x01, 0x00, 0x00,
+  0xcb, 0x01, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0x7d, 0x08, 0x00, 0x00,
+  0xfd, 0x10, 0x00, 0x00, 0xc0, 0xfe, 0xff, 0xff, 0x54, 0xff, 0xff, 0xff,
+  0x07, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x00, 0x37, 0xff, 0xff, 0xff,
+  0xb6, 0x00, 0x00, 0x00, 0x35, 0xfe, 0xff, 0xff, 0x64, 0xfe, 0xff, 0xff,
+  0x16, 0xfe, 0xff, 0xff, 0x51, 0xfe, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00,
+  0x8c, 0xff, 0xff, 0xff, 0x84, 0x01, 0x00, 0x00, 0x6e, 0xfe, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x2b, 0x19, 0x55, 0xdf,
+  0xbe, 0x33, 0x42, 0xfd, 0xd7, 0xfa, 0x20, 0xd1, 0xc7, 0xdb, 0xeb, 0x00,
+  0xc7, 0x7f, 0x79, 0x2a, 0xf9, 0xe3, 0x02, 0xd6, 0xcd, 0x2e, 0xfb, 0xe8,
+  0x2c, 0x11, 0xfe, 0x3d, 0x43, 0xe1, 0xba, 0x14, 0xf5, 0x7f, 0xc3, 0xfd,
+  0x78, 0xc4, 0x04, 0x82, 0xb5, 0x66, 0x26, 0xd2, 0x5c, 0x83, 0xb8, 0xac,
+  0x8a, 0x1f, 0x6a, 0x43, 0x25, 0x05, 0xf4, 0xf7, 0xc2, 0xc8, 0xfb, 0xc4,
+  0xe9, 0x4f, 0xaf, 0x4d, 0x48, 0xdf, 0xaf, 0x70, 0x5f, 0x3a, 0x7d, 0xec,
+  0x92, 0xac, 0x63, 0x78, 0xb7, 0x84, 0xbf, 0x92, 0x40, 0x7f, 0xe9, 0xb4,
+  0x5d, 0x9c, 0xd2, 0x92, 0x18, 0xb5, 0x53, 0xfe, 0xda, 0xfe, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x42, 0x00, 0x00,
+  0x9e, 0x92, 0xff, 0xff, 0xe5, 0x8e, 0xff, 0xff, 0xf2, 0xfe, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x7b, 0xff, 0xff, 0x0c, 0x7b, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x00, 0x4d, 0x4c, 0x49, 0x52, 0x20, 0x43, 0x6f, 0x6e,
+  0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x2e, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x14, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x30, 0x07, 0x00, 0x00,
+  0x34, 0x07, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0xcc, 0x06, 0x00, 0x00, 0x64, 0x06, 0x00, 0x00, 0x0c, 0x06, 0x00, 0x00,
+  0xcc, 0x05, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00,
+  0xc4, 0x04, 0x00, 0x00, 0x7c, 0x04, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
+  0x0c, 0x04, 0x00, 0x00, 0xcc, 0x03, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00,
+  0x14, 0x03, 0x00, 0x00, 0xd4, 0x02, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00,
+  0x50, 0x02, 0x00, 0x00, 0x1c, 0x02, 0x00, 0x00, 0xdc, 0x01, 0x00, 0x00,
+  0x94, 0x01, 0x00, 0x00, 0x58, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x12, 0xfa, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x1c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x80, 0x3f, 0x01, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xe6, 0xf9, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x0f, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2e, 0xfa, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00,
+  0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00, 0x13, 0x00, 0x0c, 0x00,
+  0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
   0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x2e, 0xfa, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x28, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, 0x00,
-  0x13, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x7a, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x43, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x7a, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x6c, 0xfa, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+  0x1a, 0xfb, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0xf0, 0x7c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00,
+  0xe6, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x8e, 0xfb, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x82, 0xfb, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x72, 0xfb, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x62, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x6c, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x06, 0x00, 0x00, 0x00, 0x1a, 0xfb, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x54, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x0b, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0xf0, 0x7c, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
-  0x41, 0x00, 0x00, 0x00, 0xe6, 0xfa, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xd8, 0x7d, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0xce, 0xfb, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x8e, 0xfb, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x82, 0xfb, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x76, 0xfc, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x6a, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
   0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x72, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x5a, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x40, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
-  0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x62, 0xfb, 0xff, 0xff,
+  0x3c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4a, 0xfc, 0xff, 0xff,
   0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x54, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
+  0x1c, 0x00, 0x00, 0x00, 0x3c, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
   0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x3f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00,
-  0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x10, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd8, 0x7d, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xce, 0xfb, 0xff, 0xff,
+  0x3b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x86, 0xfc, 0xff, 0xff,
   0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x76, 0xfc, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x6a, 0xfc, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x5a, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
+  0x18, 0x00, 0x00, 0x00, 0x2e, 0xfd, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x22, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x6a, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x40, 0x7f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x36, 0xfd, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
+  0x28, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0xd6, 0xfd, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0b, 0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xac, 0x7f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x35, 0x00, 0x00, 0x00, 0xa2, 0xfd, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x4a, 0xfe, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
+  0x3e, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x2e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x4a, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x3c, 0xfc, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x86, 0xfc, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x2e, 0xfd, 0xff, 0xff,
+  0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x1d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x10, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
   0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x22, 0xfd, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x24, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0xff, 0xff,
+  0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x5a, 0xfe, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0xf6, 0xfe, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x17, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
-  0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x6a, 0xfd, 0xff, 0xff,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0xff,
   0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x10, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x40, 0x7f, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x36, 0xfd, 0xff, 0xff,
+  0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x24, 0x81, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff,
   0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x1c, 0x00, 0x00, 0x00, 0x28, 0xfd, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00,
-  0x19, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0xd6, 0xfd, 0xff, 0xff,
-  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x10, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xac, 0x7f, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0xa2, 0xfd, 0xff, 0xff,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x4a, 0xfe, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
-  0x1a, 0x00, 0x00, 0x00, 0x3e, 0xfe, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2e, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
+  0x1c, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03,
   0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x1e, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0xfe, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x5a, 0xfe, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
-  0x21, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xf6, 0xfe, 0xff, 0xff,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00,
-  0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x18, 0x00, 0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
+  0x2f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x25, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0xff,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1a, 0x00, 0x14, 0x00,
+  0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
   0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x4e, 0xff, 0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16,
-  0x10, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x24, 0x81, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x1a, 0xff, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x18, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
-  0x56, 0xff, 0xff, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x20, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
-  0x1a, 0x00, 0x14, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
-  0x0e, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x30, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
   0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00,
-  0x0b, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
-  0x2a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
-  0xc8, 0x7d, 0x00, 0x00, 0x54, 0x7d, 0x00, 0x00, 0xc4, 0x7c, 0x00, 0x00,
-  0x38, 0x7c, 0x00, 0x00, 0x54, 0x7a, 0x00, 0x00, 0x70, 0x78, 0x00, 0x00,
-  0x84, 0x73, 0x00, 0x00, 0x98, 0x6e, 0x00, 0x00, 0x6c, 0x6d, 0x00, 0x00,
-  0x40, 0x6c, 0x00, 0x00, 0x4c, 0x67, 0x00, 0x00, 0xf8, 0x61, 0x00, 0x00,
-  0x0c, 0x5d, 0x00, 0x00, 0x20, 0x58, 0x00, 0x00, 0xf4, 0x56, 0x00, 0x00,
-  0xc8, 0x55, 0x00, 0x00, 0xd4, 0x50, 0x00, 0x00, 0x94, 0x4b, 0x00, 0x00,
-  0xa4, 0x46, 0x00, 0x00, 0xb8, 0x41, 0x00, 0x00, 0x8c, 0x40, 0x00, 0x00,
-  0x60, 0x3f, 0x00, 0x00, 0xac, 0x3c, 0x00, 0x00, 0xc4, 0x39, 0x00, 0x00,
-  0x14, 0x37, 0x00, 0x00, 0x68, 0x34, 0x00, 0x00, 0x9c, 0x33, 0x00, 0x00,
-  0xd0, 0x32, 0x00, 0x00, 0x1c, 0x30, 0x00, 0x00, 0x14, 0x2d, 0x00, 0x00,
-  0x64, 0x2a, 0x00, 0x00, 0xb8, 0x27, 0x00, 0x00, 0xec, 0x26, 0x00, 0x00,
-  0x20, 0x26, 0x00, 0x00, 0x6c, 0x23, 0x00, 0x00, 0x64, 0x20, 0x00, 0x00,
-  0xb4, 0x1d, 0x00, 0x00, 0x08, 0x1b, 0x00, 0x00, 0x34, 0x1a, 0x00, 0x00,
-  0x60, 0x19, 0x00, 0x00, 0x2c, 0x18, 0x00, 0x00, 0x9c, 0x16, 0x00, 0x00,
-  0x74, 0x15, 0x00, 0x00, 0x50, 0x14, 0x00, 0x00, 0x84, 0x13, 0x00, 0x00,
-  0x80, 0x12, 0x00, 0x00, 0xac, 0x11, 0x00, 0x00, 0xc0, 0x10, 0x00, 0x00,
-  0x4c, 0x10, 0x00, 0x00, 0x58, 0x0f, 0x00, 0x00, 0x94, 0x0e, 0x00, 0x00,
-  0xa8, 0x0d, 0x00, 0x00, 0xb4, 0x0c, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00,
-  0x9c, 0x0b, 0x00, 0x00, 0xb0, 0x0a, 0x00, 0x00, 0x3c, 0x0a, 0x00, 0x00,
-  0x68, 0x09, 0x00, 0x00, 0xa4, 0x08, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00,
-  0xcc, 0x06, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x94, 0x05, 0x00, 0x00,
-  0xb0, 0x04, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
-  0xa4, 0x02, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00,
-  0x78, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6a, 0x83, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00,
-  0x54, 0x83, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3b, 0x19, 0x00, 0x00, 0x00,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a,
-  0x30, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0xda, 0x83, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x7c, 0x00, 0x00, 0x00, 0xc4, 0x83, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x7e, 0x72, 0x20, 0x3e,
-  0x52, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x6c, 0x6f, 0x67, 0x69, 0x74, 0x73, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41,
-  0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x6c,
-  0x6f, 0x67, 0x69, 0x74, 0x73, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x6c, 0x6f, 0x67,
-  0x69, 0x74, 0x73, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
-  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x4f, 0x70, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x82, 0x84, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x8c, 0x00, 0x00, 0x00, 0x6c, 0x84, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x9f, 0x50, 0x5d, 0x3d, 0x5e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x2f, 0x52, 0x65, 0x6c,
-  0x75, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x68, 0x65,
-  0x61, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x5f, 0x31, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73,
-  0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69,
-  0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x3a, 0x85, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x94, 0x00, 0x00, 0x00, 0x24, 0x85, 0xff, 0xff,
+  0x2d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x0b, 0x00, 0x04, 0x00,
+  0x0e, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x24, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xc8, 0x7d, 0x00, 0x00,
+  0x54, 0x7d, 0x00, 0x00, 0xc4, 0x7c, 0x00, 0x00, 0x38, 0x7c, 0x00, 0x00,
+  0x54, 0x7a, 0x00, 0x00, 0x70, 0x78, 0x00, 0x00, 0x84, 0x73, 0x00, 0x00,
+  0x98, 0x6e, 0x00, 0x00, 0x6c, 0x6d, 0x00, 0x00, 0x40, 0x6c, 0x00, 0x00,
+  0x4c, 0x67, 0x00, 0x00, 0xf8, 0x61, 0x00, 0x00, 0x0c, 0x5d, 0x00, 0x00,
+  0x20, 0x58, 0x00, 0x00, 0xf4, 0x56, 0x00, 0x00, 0xc8, 0x55, 0x00, 0x00,
+  0xd4, 0x50, 0x00, 0x00, 0x94, 0x4b, 0x00, 0x00, 0xa4, 0x46, 0x00, 0x00,
+  0xb8, 0x41, 0x00, 0x00, 0x8c, 0x40, 0x00, 0x00, 0x60, 0x3f, 0x00, 0x00,
+  0xac, 0x3c, 0x00, 0x00, 0xc4, 0x39, 0x00, 0x00, 0x14, 0x37, 0x00, 0x00,
+  0x68, 0x34, 0x00, 0x00, 0x9c, 0x33, 0x00, 0x00, 0xd0, 0x32, 0x00, 0x00,
+  0x1c, 0x30, 0x00, 0x00, 0x14, 0x2d, 0x00, 0x00, 0x64, 0x2a, 0x00, 0x00,
+  0xb8, 0x27, 0x00, 0x00, 0xec, 0x26, 0x00, 0x00, 0x20, 0x26, 0x00, 0x00,
+  0x6c, 0x23, 0x00, 0x00, 0x64, 0x20, 0x00, 0x00, 0xb4, 0x1d, 0x00, 0x00,
+  0x08, 0x1b, 0x00, 0x00, 0x34, 0x1a, 0x00, 0x00, 0x60, 0x19, 0x00, 0x00,
+  0x2c, 0x18, 0x00, 0x00, 0x9c, 0x16, 0x00, 0x00, 0x74, 0x15, 0x00, 0x00,
+  0x50, 0x14, 0x00, 0x00, 0x84, 0x13, 0x00, 0x00, 0x80, 0x12, 0x00, 0x00,
+  0xac, 0x11, 0x00, 0x00, 0xc0, 0x10, 0x00, 0x00, 0x4c, 0x10, 0x00, 0x00,
+  0x58, 0x0f, 0x00, 0x00, 0x94, 0x0e, 0x00, 0x00, 0xa8, 0x0d, 0x00, 0x00,
+  0xb4, 0x0c, 0x00, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x9c, 0x0b, 0x00, 0x00,
+  0xb0, 0x0a, 0x00, 0x00, 0x3c, 0x0a, 0x00, 0x00, 0x68, 0x09, 0x00, 0x00,
+  0xa4, 0x08, 0x00, 0x00, 0xc0, 0x07, 0x00, 0x00, 0xcc, 0x06, 0x00, 0x00,
+  0x08, 0x06, 0x00, 0x00, 0x94, 0x05, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00,
+  0xbc, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00,
+  0xe0, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x6a, 0x83, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00, 0x54, 0x83, 0xff, 0xff,
   0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0xc1, 0xc0, 0xc0, 0x3c, 0x6a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f,
-  0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
-  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78,
-  0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65,
-  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0xfa, 0x85, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00, 0xe4, 0x85, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xef, 0x38, 0xbd, 0x3d, 0x17, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x35, 0x5f, 0x61, 0x64, 0x64, 0x2f, 0x61, 0x64, 0x64, 0x00,
+  0x00, 0x00, 0x80, 0x3b, 0x19, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x66, 0x75, 0x6c, 0x50, 0x61, 0x72, 0x74, 0x69, 0x74, 0x69, 0x6f,
+  0x6e, 0x65, 0x64, 0x43, 0x61, 0x6c, 0x6c, 0x3a, 0x30, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x6a, 0x86, 0xff, 0xff,
+  0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xda, 0x83, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x00, 0x00, 0x00,
-  0x54, 0x86, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x8b, 0x9c, 0x69, 0x3d, 0x4a, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
-  0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
-  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x0a, 0x87, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xc4, 0x00, 0x00, 0x00, 0xf4, 0x86, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xc1, 0xc0, 0xc0, 0x3c, 0x94, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x72, 0x65,
-  0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35,
-  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42,
-  0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
-  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65,
-  0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0xfa, 0x87, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xb4, 0x00, 0x00, 0x00, 0xe4, 0x87, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x00, 0x00, 0x00,
+  0xc4, 0x83, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x7e, 0x72, 0x20, 0x3e, 0x52, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x6c, 0x6f, 0x67, 0x69,
+  0x74, 0x73, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d,
+  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x6c, 0x6f, 0x67, 0x69, 0x74,
+  0x73, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64,
+  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x6c, 0x6f, 0x67, 0x69, 0x74, 0x73, 0x2f,
+  0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64,
+  0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x82, 0x84, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x8c, 0x00, 0x00, 0x00,
+  0x6c, 0x84, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x9f, 0x50, 0x5d, 0x3d,
+  0x5e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x68, 0x65, 0x61, 0x64, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x3b, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x2f, 0x42,
+  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
+  0x5f, 0x31, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
+  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x68,
+  0x65, 0x61, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f,
+  0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x4f, 0x70, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x3a, 0x85, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x94, 0x00, 0x00, 0x00, 0x24, 0x85, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
   0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c,
-  0x88, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x65, 0x78, 0x70, 0x61,
+  0x6a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70, 0x61,
   0x6e, 0x64, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75,
   0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64,
+  0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64,
   0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
   0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
   0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36,
   0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e,
-  0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xfa, 0x85, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x44, 0x00, 0x00, 0x00, 0xe4, 0x85, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xef, 0x38, 0xbd, 0x3d, 0x17, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
+  0x61, 0x64, 0x64, 0x2f, 0x61, 0x64, 0x64, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x6a, 0x86, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x74, 0x00, 0x00, 0x00, 0x54, 0x86, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x8b, 0x9c, 0x69, 0x3d, 0x4a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46,
+  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
+  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xda, 0x88, 0xff, 0xff,
+  0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x87, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00,
-  0xc4, 0x88, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe6, 0x97, 0xa2, 0x3d,
-  0x17, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x61, 0x64, 0x64, 0x2f,
-  0x61, 0x64, 0x64, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x4a, 0x89, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x94, 0x00, 0x00, 0x00, 0x34, 0x89, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xc1, 0x15, 0x90, 0x3d,
-  0x69, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
-  0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc4, 0x00, 0x00, 0x00,
+  0xf4, 0x86, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c,
+  0x94, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52,
+  0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
+  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75,
+  0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
+  0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
+  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e,
+  0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64,
+  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35,
+  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xfa, 0x87, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb4, 0x00, 0x00, 0x00,
+  0xe4, 0x87, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c, 0x88, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x70,
-  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x0a, 0x8a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xc4, 0x00, 0x00, 0x00, 0xf4, 0x89, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xc1, 0xc0, 0xc0, 0x3c, 0x94, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x72, 0x65,
-  0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34,
-  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42,
-  0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
-  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65,
-  0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0xfa, 0x8a, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xb4, 0x00, 0x00, 0x00, 0xe4, 0x8a, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c,
-  0x88, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x65, 0x78, 0x70, 0x61,
-  0x6e, 0x64, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75,
-  0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64,
-  0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
-  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36,
-  0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e,
-  0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x5f, 0x35, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x72,
+  0x65, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
+  0x35, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f,
+  0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
+  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
+  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70,
+  0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
+  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x5f, 0x35, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f,
+  0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xda, 0x88, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00, 0xc4, 0x88, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe6, 0x97, 0xa2, 0x3d, 0x17, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x34, 0x5f, 0x61, 0x64, 0x64, 0x2f, 0x61, 0x64, 0x64, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xda, 0x8b, 0xff, 0xff,
+  0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4a, 0x89, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x94, 0x00, 0x00, 0x00,
-  0xc4, 0x8b, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0xb0, 0x4c, 0x70, 0x3d, 0x69, 0x00, 0x00, 0x00,
+  0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x94, 0x00, 0x00, 0x00,
+  0x34, 0x89, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0xc1, 0x15, 0x90, 0x3d, 0x69, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x33, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
+  0x6b, 0x5f, 0x34, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
   0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
   0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
   0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
   0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
   0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65,
   0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x9a, 0x8c, 0xff, 0xff,
+  0x0c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x8a, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xa4, 0x00, 0x00, 0x00,
-  0x84, 0x8c, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc4, 0x00, 0x00, 0x00,
+  0xf4, 0x89, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c,
-  0x76, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74,
+  0x94, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x64, 0x65, 0x70, 0x74,
   0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52,
   0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
-  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70,
+  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x64, 0x65, 0x70,
   0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75,
   0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
   0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
-  0x73, 0x65, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x6a, 0x8d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x44, 0x00, 0x00, 0x00, 0x54, 0x8d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xc1, 0xc0, 0xc0, 0x3c, 0x17, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f,
-  0x70, 0x61, 0x64, 0x2f, 0x50, 0x61, 0x64, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xda, 0x8d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xbc, 0x00, 0x00, 0x00, 0xc4, 0x8d, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c, 0x8e, 0x00, 0x00, 0x00,
+  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e,
+  0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64,
+  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34,
+  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xfa, 0x8a, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb4, 0x00, 0x00, 0x00,
+  0xe4, 0x8a, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c, 0x88, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x33, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x72,
+  0x6b, 0x5f, 0x34, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x72,
   0x65, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f,
   0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
-  0x33, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f,
+  0x34, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f,
   0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
   0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
-  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
-  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x65, 0x78, 0x70,
-  0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xc2, 0x8e, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00,
-  0xac, 0x8e, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x69, 0x6b, 0xc7, 0x3d,
-  0x17, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x61, 0x64, 0x64, 0x2f,
-  0x61, 0x64, 0x64, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x32, 0x8f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x74, 0x00, 0x00, 0x00, 0x1c, 0x8f, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x99, 0xa3, 0x3d,
-  0x4a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
-  0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f,
-  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xd2, 0x8f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xc4, 0x00, 0x00, 0x00, 0xbc, 0x8f, 0xff, 0xff,
+  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70,
+  0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
+  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x5f, 0x34, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f,
+  0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xda, 0x8b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x94, 0x00, 0x00, 0x00, 0xc4, 0x8b, 0xff, 0xff,
   0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
-  0xc1, 0xc0, 0xc0, 0x3c, 0x9a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x72, 0x65,
-  0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32,
-  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42,
-  0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
-  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xc2, 0x90, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xbc, 0x00, 0x00, 0x00, 0xac, 0x90, 0xff, 0xff,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0xb0, 0x4c, 0x70, 0x3d, 0x69, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46,
+  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
+  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
+  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x5f, 0x33, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x9a, 0x8c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xa4, 0x00, 0x00, 0x00, 0x84, 0x8c, 0xff, 0xff,
   0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c, 0x8e, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c, 0x76, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x32, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x72,
-  0x65, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
-  0x32, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f,
-  0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f,
-  0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
-  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
-  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x65, 0x78, 0x70,
-  0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xaa, 0x91, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x94, 0x00, 0x00, 0x00,
-  0x94, 0x91, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0xb7, 0x63, 0xac, 0x3d, 0x69, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
-  0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f,
-  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
-  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65,
-  0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x6a, 0x92, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc4, 0x00, 0x00, 0x00,
-  0x54, 0x92, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c, 0x9a, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x31, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
+  0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
   0x65, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36,
   0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
   0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42,
   0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d,
   0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
   0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
-  0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
-  0x5f, 0x31, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
   0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x5a, 0x93, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x6a, 0x8d, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00,
-  0x44, 0x93, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00,
+  0x54, 0x8d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c,
   0x17, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x61, 0x64, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x70, 0x61, 0x64, 0x2f,
   0x50, 0x61, 0x64, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x31, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xca, 0x93, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xbc, 0x00, 0x00, 0x00, 0xb4, 0x93, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xda, 0x8d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xbc, 0x00, 0x00, 0x00, 0xc4, 0x8d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
   0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
   0xc1, 0xc0, 0xc0, 0x3c, 0x8e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f,
+  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f,
+  0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
+  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x65, 0x78,
+  0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65,
+  0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
+  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f,
+  0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
+  0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f,
+  0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xc2, 0x8e, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00, 0xac, 0x8e, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x69, 0x6b, 0xc7, 0x3d, 0x17, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x32, 0x5f, 0x61, 0x64, 0x64, 0x2f, 0x61, 0x64, 0x64, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x32, 0x8f, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x74, 0x00, 0x00, 0x00,
+  0x1c, 0x8f, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0x00, 0x3f, 0x99, 0xa3, 0x3d, 0x4a, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
+  0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
+  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
+  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xd2, 0x8f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xc4, 0x00, 0x00, 0x00, 0xbc, 0x8f, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c,
+  0x9a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52,
+  0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
+  0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75,
+  0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
+  0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
+  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
+  0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xc2, 0x90, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xbc, 0x00, 0x00, 0x00, 0xac, 0x90, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xc1, 0xc0, 0xc0, 0x3c, 0x8e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f,
   0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f,
   0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
-  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x65, 0x78,
+  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x65, 0x78,
   0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65,
   0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33,
   0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f,
   0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
   0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65,
   0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f,
-  0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f,
+  0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f,
   0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xaa, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x94, 0x00, 0x00, 0x00, 0x94, 0x91, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0xb7, 0x63, 0xac, 0x3d, 0x69, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46,
+  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
+  0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d,
+  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x5f, 0x31, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x6a, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xc4, 0x00, 0x00, 0x00, 0x54, 0x92, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00,
+  0xc1, 0xc0, 0xc0, 0x3c, 0x9a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x72, 0x65,
+  0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64,
+  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31,
+  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42,
+  0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
+  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
+  0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
+  0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x5a, 0x93, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x44, 0x00, 0x00, 0x00, 0x44, 0x93, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c, 0x17, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x61, 0x64, 0x2f, 0x50, 0x61, 0x64, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+  0x31, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xca, 0x93, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbc, 0x00, 0x00, 0x00,
+  0xb4, 0x93, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c,
+  0x8e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x65, 0x78, 0x70, 0x61,
+  0x6e, 0x64, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75,
+  0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64,
+  0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74,
+  0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64,
+  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33,
+  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64,
+  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31,
+  0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
+  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xb2, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x34, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xa4, 0x00, 0x00, 0x00, 0x9c, 0x94, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0xd1, 0x64, 0xee, 0x3d, 0x75, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64,
+  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
+  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
+  0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f,
+  0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
+  0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f,
+  0x6e, 0x76, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xb2, 0x94, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xa4, 0x00, 0x00, 0x00, 0x9c, 0x94, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x82, 0x95, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xd4, 0x00, 0x00, 0x00, 0x6c, 0x95, 0xff, 0xff,
   0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0xd1, 0x64, 0xee, 0x3d, 0x75, 0x00, 0x00, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c, 0xa7, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61,
-  0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x70, 0x72,
-  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
-  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
-  0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
-  0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65,
-  0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65,
-  0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
+  0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x6c, 0x75,
+  0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
+  0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64, 0x5f,
+  0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69,
+  0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42,
+  0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d,
+  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b,
+  0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
+  0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63,
+  0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
+  0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00,
   0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x82, 0x95, 0xff, 0xff,
+  0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x82, 0x96, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
-  0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd4, 0x00, 0x00, 0x00,
-  0x6c, 0x95, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9c, 0x00, 0x00, 0x00,
+  0x6c, 0x96, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
   0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xc1, 0xc0, 0xc0, 0x3c,
-  0xa7, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e,
-  0x76, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
-  0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d,
-  0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e,
-  0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75,
+  0x6e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x31, 0x5f, 0x72, 0x65, 0x6c, 0x75, 0x2f, 0x52,
+  0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31,
+  0x2f, 0x62, 0x6e, 0x5f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x2f, 0x46, 0x75,
   0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
   0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62,
   0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65,
   0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64,
-  0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x82, 0x96, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x34, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x9c, 0x00, 0x00, 0x00, 0x6c, 0x96, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0xc1, 0xc0, 0xc0, 0x3c, 0x6e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x5f, 0x72, 0x65,
-  0x6c, 0x75, 0x2f, 0x52, 0x65, 0x6c, 0x75, 0x36, 0x3b, 0x6d, 0x6f, 0x64,
-  0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6e, 0x5f, 0x43, 0x6f, 0x6e, 0x76,
-  0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
-  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
-  0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x70,
-  0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x43, 0x6f,
-  0x6e, 0x76, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4a, 0x97, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x00,
-  0x34, 0x97, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4a, 0x97, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xf4, 0x00, 0x00, 0x00, 0x34, 0x97, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0xf9, 0x38, 0x8a, 0x3d, 0x04, 0x2b, 0x78, 0x3e,
-  0xaf, 0xcf, 0xa4, 0x3d, 0xe3, 0xa9, 0x48, 0x3d, 0xd0, 0xf5, 0x08, 0x3c,
-  0x7a, 0x67, 0xd4, 0x3b, 0x8b, 0x20, 0x3b, 0x3d, 0x92, 0x6f, 0xf5, 0x3b,
-  0x09, 0x27, 0x3f, 0x3d, 0xa7, 0x54, 0x3c, 0x3c, 0x66, 0x1f, 0x0d, 0x3e,
-  0x78, 0x33, 0x3b, 0x3e, 0x4d, 0x7d, 0xba, 0x3d, 0x0b, 0xfe, 0xd2, 0x3b,
-  0x2b, 0xa4, 0x2d, 0x3e, 0xc2, 0x50, 0x5b, 0x3c, 0x14, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6a, 0x98, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
-  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x00,
-  0x54, 0x98, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2530,21 +2633,21 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xf9, 0x38, 0x8a, 0x3d, 0x04, 0x2b, 0x78, 0x3e, 0xaf, 0xcf, 0xa4, 0x3d,
+  0xe3, 0xa9, 0x48, 0x3d, 0xd0, 0xf5, 0x08, 0x3c, 0x7a, 0x67, 0xd4, 0x3b,
+  0x8b, 0x20, 0x3b, 0x3d, 0x92, 0x6f, 0xf5, 0x3b, 0x09, 0x27, 0x3f, 0x3d,
+  0xa7, 0x54, 0x3c, 0x3c, 0x66, 0x1f, 0x0d, 0x3e, 0x78, 0x33, 0x3b, 0x3e,
+  0x4d, 0x7d, 0xba, 0x3d, 0x0b, 0xfe, 0xd2, 0x3b, 0x2b, 0xa4, 0x2d, 0x3e,
+  0xc2, 0x50, 0x5b, 0x3c, 0x14, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x2f, 0x43, 0x6f,
+  0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x6a, 0x98, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x04, 0x01, 0x00, 0x00, 0x54, 0x98, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xbd, 0xc3, 0x8a, 0x39,
-  0x29, 0x24, 0x79, 0x3a, 0x25, 0x75, 0xa5, 0x39, 0x57, 0x73, 0x49, 0x39,
-  0x50, 0x7f, 0x09, 0x38, 0xb8, 0x3c, 0xd5, 0x37, 0x68, 0xdc, 0x3b, 0x39,
-  0xf9, 0x65, 0xf6, 0x37, 0xf1, 0xe6, 0x3f, 0x39, 0xb9, 0x11, 0x3d, 0x38,
-  0x14, 0xad, 0x0d, 0x3a, 0x68, 0xef, 0x3b, 0x3a, 0x86, 0x38, 0xbb, 0x39,
-  0xde, 0xd1, 0xd3, 0x37, 0x7e, 0x52, 0x2e, 0x3a, 0xf0, 0x2c, 0x5c, 0x38,
-  0x21, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6e, 0x5f, 0x43, 0x6f, 0x6e, 0x76, 0x31, 0x2f, 0x46, 0x75, 0x73,
-  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
-  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x8e, 0x99, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xe8, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x60, 0x01, 0x00, 0x00, 0x1a, 0xb5, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2555,28 +2658,19 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0xa6, 0x77, 0x90, 0x3b, 0x6f, 0x65, 0xf7, 0x3b, 0x3d, 0x27, 0xf7, 0x3b,
-  0xe2, 0x3b, 0x07, 0x3c, 0x22, 0x12, 0x39, 0x3d, 0x2c, 0xce, 0x30, 0x3d,
-  0xd8, 0x7b, 0xfb, 0x3b, 0x1a, 0x28, 0x12, 0x3d, 0x5f, 0x2d, 0x61, 0x3c,
-  0x5f, 0x95, 0x46, 0x3d, 0x4b, 0x0c, 0x0c, 0x3c, 0x14, 0x8c, 0xec, 0x3b,
-  0xfb, 0x05, 0x7d, 0x3b, 0xe1, 0xca, 0x5b, 0x3c, 0x50, 0x9f, 0xe4, 0x3b,
-  0xc4, 0xd8, 0xa5, 0x3c, 0x7c, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61,
-  0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
-  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72,
-  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44,
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x1a, 0x9b, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xe4, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x10, 0x01, 0x00, 0x00, 0x04, 0x9b, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xbd, 0xc3, 0x8a, 0x39, 0x29, 0x24, 0x79, 0x3a,
+  0x25, 0x75, 0xa5, 0x39, 0x57, 0x73, 0x49, 0x39, 0x50, 0x7f, 0x09, 0x38,
+  0xb8, 0x3c, 0xd5, 0x37, 0x68, 0xdc, 0x3b, 0x39, 0xf9, 0x65, 0xf6, 0x37,
+  0xf1, 0xe6, 0x3f, 0x39, 0xb9, 0x11, 0x3d, 0x38, 0x14, 0xad, 0x0d, 0x3a,
+  0x68, 0xef, 0x3b, 0x3a, 0x86, 0x38, 0xbb, 0x39, 0xde, 0xd1, 0xd3, 0x37,
+  0x7e, 0x52, 0x2e, 0x3a, 0xf0, 0x2c, 0x5c, 0x38, 0x21, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6e, 0x5f, 0x43,
+  0x6f, 0x6e, 0x76, 0x31, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
+  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x8e, 0x99, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00,
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x60, 0x01, 0x00, 0x00,
+  0x1a, 0xb5, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
   0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2588,66 +2682,89 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x8d, 0xd9, 0x38,
-  0x5a, 0x46, 0x3a, 0x39, 0x86, 0x17, 0x3a, 0x39, 0x79, 0xa5, 0x4b, 0x39,
-  0xf3, 0x58, 0x8b, 0x3a, 0xc1, 0x1f, 0x85, 0x3a, 0x3c, 0x5a, 0x3d, 0x39,
-  0x40, 0x18, 0x5c, 0x3a, 0x93, 0x8b, 0xa9, 0x39, 0x8d, 0x85, 0x95, 0x3a,
-  0x56, 0xe5, 0x52, 0x39, 0x2a, 0x1b, 0x32, 0x39, 0xff, 0x82, 0xbe, 0x38,
-  0xa7, 0x7d, 0xa5, 0x39, 0xa0, 0x23, 0x2c, 0x39, 0xe5, 0xbe, 0xf9, 0x39,
-  0x33, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xa6, 0x77, 0x90, 0x3b,
+  0x6f, 0x65, 0xf7, 0x3b, 0x3d, 0x27, 0xf7, 0x3b, 0xe2, 0x3b, 0x07, 0x3c,
+  0x22, 0x12, 0x39, 0x3d, 0x2c, 0xce, 0x30, 0x3d, 0xd8, 0x7b, 0xfb, 0x3b,
+  0x1a, 0x28, 0x12, 0x3d, 0x5f, 0x2d, 0x61, 0x3c, 0x5f, 0x95, 0x46, 0x3d,
+  0x4b, 0x0c, 0x0c, 0x3c, 0x14, 0x8c, 0xec, 0x3b, 0xfb, 0x05, 0x7d, 0x3b,
+  0xe1, 0xca, 0x5b, 0x3c, 0x50, 0x9f, 0xe4, 0x3b, 0xc4, 0xd8, 0xa5, 0x3c,
+  0x7c, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
   0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e,
   0x76, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f,
   0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x4a, 0x9c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xa4, 0x00, 0x00, 0x00, 0x34, 0x9c, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64,
+  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
+  0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
+  0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x9b, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
+  0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x01, 0x00, 0x00,
+  0x04, 0x9b, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x95, 0x69, 0xf4, 0x3b,
-  0xd4, 0x00, 0x28, 0x3c, 0x23, 0x01, 0xf9, 0x3b, 0xf1, 0x1a, 0x1e, 0x3c,
-  0x84, 0x86, 0x08, 0x3c, 0xc9, 0x5d, 0x02, 0x3c, 0x41, 0x17, 0x09, 0x3c,
-  0xe1, 0x57, 0x30, 0x3c, 0x24, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64,
-  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
-  0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1a, 0x9d, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
-  0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb0, 0x00, 0x00, 0x00,
-  0x04, 0x9d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x37, 0x07, 0x38, 0x39, 0x3d, 0xfe, 0x7c, 0x39, 0x57, 0x7c, 0x3b, 0x39,
-  0x80, 0x16, 0x6e, 0x39, 0x5e, 0x97, 0x4d, 0x39, 0xff, 0x50, 0x44, 0x39,
-  0x53, 0x71, 0x4e, 0x39, 0xb0, 0xc6, 0x84, 0x39, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x06, 0x8d, 0xd9, 0x38, 0x5a, 0x46, 0x3a, 0x39,
+  0x86, 0x17, 0x3a, 0x39, 0x79, 0xa5, 0x4b, 0x39, 0xf3, 0x58, 0x8b, 0x3a,
+  0xc1, 0x1f, 0x85, 0x3a, 0x3c, 0x5a, 0x3d, 0x39, 0x40, 0x18, 0x5c, 0x3a,
+  0x93, 0x8b, 0xa9, 0x39, 0x8d, 0x85, 0x95, 0x3a, 0x56, 0xe5, 0x52, 0x39,
+  0x2a, 0x1b, 0x32, 0x39, 0xff, 0x82, 0xbe, 0x38, 0xa7, 0x7d, 0xa5, 0x39,
+  0xa0, 0x23, 0x2c, 0x39, 0xe5, 0xbe, 0xf9, 0x39, 0x33, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61,
-  0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x70, 0x72,
-  0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
-  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
-  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0xea, 0x9d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x64, 0x02, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x7c, 0x02, 0x00, 0x00, 0xd4, 0x9d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x88, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46,
+  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
+  0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x4a, 0x9c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xa4, 0x00, 0x00, 0x00, 0x34, 0x9c, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x95, 0x69, 0xf4, 0x3b, 0xd4, 0x00, 0x28, 0x3c,
+  0x23, 0x01, 0xf9, 0x3b, 0xf1, 0x1a, 0x1e, 0x3c, 0x84, 0x86, 0x08, 0x3c,
+  0xc9, 0x5d, 0x02, 0x3c, 0x41, 0x17, 0x09, 0x3c, 0xe1, 0x57, 0x30, 0x3c,
+  0x24, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6e,
+  0x76, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f,
+  0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x1a, 0x9d, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xb0, 0x00, 0x00, 0x00, 0x04, 0x9d, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x37, 0x07, 0x38, 0x39,
+  0x3d, 0xfe, 0x7c, 0x39, 0x57, 0x7c, 0x3b, 0x39, 0x80, 0x16, 0x6e, 0x39,
+  0x5e, 0x97, 0x4d, 0x39, 0xff, 0x50, 0x44, 0x39, 0x53, 0x71, 0x4e, 0x39,
+  0xb0, 0xc6, 0x84, 0x39, 0x31, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x65, 0x64,
+  0x5f, 0x63, 0x6f, 0x6e, 0x76, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63,
+  0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
+  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xea, 0x9d, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00,
+  0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x02, 0x00, 0x00,
+  0xd4, 0x9d, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2669,32 +2786,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x95, 0x2c, 0xa4, 0x3b, 0xdf, 0xf9, 0x79, 0x3b, 0x7c, 0x0f, 0x48, 0x3b,
-  0xaa, 0xfe, 0x59, 0x3b, 0xd1, 0x84, 0x84, 0x3a, 0xf1, 0xb0, 0x50, 0x3b,
-  0x7d, 0x24, 0xd7, 0x3b, 0x35, 0xca, 0x18, 0x3b, 0xc3, 0x8a, 0x6a, 0x3b,
-  0x8e, 0xd0, 0xa6, 0x3b, 0x38, 0x6e, 0x84, 0x3b, 0x8b, 0x2f, 0x4c, 0x3b,
-  0x90, 0x6a, 0x24, 0x3b, 0x05, 0x00, 0x7e, 0x3b, 0x3f, 0xed, 0x5d, 0x3b,
-  0x71, 0x17, 0x48, 0x3b, 0x73, 0x70, 0x28, 0x3b, 0xf1, 0x2f, 0x5f, 0x3a,
-  0x10, 0xf7, 0x32, 0x3b, 0xc2, 0x94, 0x7c, 0x3b, 0xda, 0x80, 0x9d, 0x3b,
-  0xb0, 0xf2, 0x03, 0x3b, 0x89, 0x59, 0x98, 0x3b, 0x5a, 0x83, 0x14, 0x3b,
-  0x3e, 0x21, 0x55, 0x3b, 0x30, 0x77, 0xe3, 0x3b, 0x60, 0xa3, 0x87, 0x3b,
-  0xcc, 0x6f, 0xcb, 0x3b, 0xd4, 0x6e, 0xf2, 0x3a, 0x5f, 0xd1, 0x1d, 0x3a,
-  0x47, 0xc8, 0x18, 0x3b, 0x3e, 0xae, 0xe8, 0x3b, 0x2c, 0x23, 0x88, 0x3b,
-  0xfa, 0xa7, 0x81, 0x3b, 0xc5, 0xf7, 0x2f, 0x3b, 0xee, 0x2c, 0x6d, 0x3b,
-  0x79, 0x9f, 0x87, 0x3b, 0xd9, 0x7f, 0xa4, 0x3b, 0x46, 0x88, 0x9e, 0x3b,
-  0xab, 0xf8, 0xb0, 0x3b, 0xbe, 0x0d, 0x48, 0x3b, 0x87, 0x34, 0x74, 0x3b,
-  0xb6, 0x69, 0x5a, 0x3b, 0x3f, 0x25, 0x97, 0x3b, 0x6e, 0xe0, 0xa9, 0x3b,
-  0x3a, 0xd5, 0x49, 0x3b, 0xf2, 0xa2, 0x44, 0x3b, 0x0d, 0xfc, 0x96, 0x3b,
-  0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x65, 0x78, 0x70, 0x61,
-  0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x92, 0xa0, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
-  0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8c, 0x02, 0x00, 0x00,
-  0x7c, 0xa0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2705,6 +2796,31 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x95, 0x2c, 0xa4, 0x3b,
+  0xdf, 0xf9, 0x79, 0x3b, 0x7c, 0x0f, 0x48, 0x3b, 0xaa, 0xfe, 0x59, 0x3b,
+  0xd1, 0x84, 0x84, 0x3a, 0xf1, 0xb0, 0x50, 0x3b, 0x7d, 0x24, 0xd7, 0x3b,
+  0x35, 0xca, 0x18, 0x3b, 0xc3, 0x8a, 0x6a, 0x3b, 0x8e, 0xd0, 0xa6, 0x3b,
+  0x38, 0x6e, 0x84, 0x3b, 0x8b, 0x2f, 0x4c, 0x3b, 0x90, 0x6a, 0x24, 0x3b,
+  0x05, 0x00, 0x7e, 0x3b, 0x3f, 0xed, 0x5d, 0x3b, 0x71, 0x17, 0x48, 0x3b,
+  0x73, 0x70, 0x28, 0x3b, 0xf1, 0x2f, 0x5f, 0x3a, 0x10, 0xf7, 0x32, 0x3b,
+  0xc2, 0x94, 0x7c, 0x3b, 0xda, 0x80, 0x9d, 0x3b, 0xb0, 0xf2, 0x03, 0x3b,
+  0x89, 0x59, 0x98, 0x3b, 0x5a, 0x83, 0x14, 0x3b, 0x3e, 0x21, 0x55, 0x3b,
+  0x30, 0x77, 0xe3, 0x3b, 0x60, 0xa3, 0x87, 0x3b, 0xcc, 0x6f, 0xcb, 0x3b,
+  0xd4, 0x6e, 0xf2, 0x3a, 0x5f, 0xd1, 0x1d, 0x3a, 0x47, 0xc8, 0x18, 0x3b,
+  0x3e, 0xae, 0xe8, 0x3b, 0x2c, 0x23, 0x88, 0x3b, 0xfa, 0xa7, 0x81, 0x3b,
+  0xc5, 0xf7, 0x2f, 0x3b, 0xee, 0x2c, 0x6d, 0x3b, 0x79, 0x9f, 0x87, 0x3b,
+  0xd9, 0x7f, 0xa4, 0x3b, 0x46, 0x88, 0x9e, 0x3b, 0xab, 0xf8, 0xb0, 0x3b,
+  0xbe, 0x0d, 0x48, 0x3b, 0x87, 0x34, 0x74, 0x3b, 0xb6, 0x69, 0x5a, 0x3b,
+  0x3f, 0x25, 0x97, 0x3b, 0x6e, 0xe0, 0xa9, 0x3b, 0x3a, 0xd5, 0x49, 0x3b,
+  0xf2, 0xa2, 0x44, 0x3b, 0x0d, 0xfc, 0x96, 0x3b, 0x1d, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x31, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43,
+  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x92, 0xa0, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x8c, 0x02, 0x00, 0x00, 0x7c, 0xa0, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2726,32 +2842,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x1a, 0xe2, 0x18, 0x3a, 0xbf, 0xc8, 0xe8, 0x39, 0x2f, 0x4d, 0xba, 0x39,
-  0x9b, 0x00, 0xcb, 0x39, 0x55, 0xcf, 0xf6, 0x38, 0xb0, 0x56, 0xc2, 0x39,
-  0xa6, 0x58, 0x48, 0x3a, 0x29, 0x48, 0x8e, 0x39, 0x5f, 0x69, 0xda, 0x39,
-  0x96, 0x57, 0x1b, 0x3a, 0x3e, 0xa5, 0xf6, 0x39, 0x9c, 0x24, 0xbe, 0x39,
-  0xd2, 0x1b, 0x99, 0x39, 0x0c, 0x88, 0xec, 0x39, 0xf6, 0xa9, 0xce, 0x39,
-  0x98, 0x54, 0xba, 0x39, 0xe0, 0xda, 0x9c, 0x39, 0x77, 0xd6, 0xcf, 0x38,
-  0x2b, 0xa8, 0xa6, 0x39, 0xc5, 0x35, 0xeb, 0x39, 0xd2, 0xab, 0x12, 0x3a,
-  0x2c, 0xbf, 0x75, 0x39, 0x3d, 0xdf, 0x0d, 0x3a, 0x9a, 0x4c, 0x8a, 0x39,
-  0xd7, 0x78, 0xc6, 0x39, 0x63, 0xd2, 0x53, 0x3a, 0x9c, 0x9e, 0xfc, 0x39,
-  0x0d, 0x72, 0x3d, 0x3a, 0x82, 0xc2, 0x61, 0x39, 0xcd, 0xf6, 0x92, 0x38,
-  0x5d, 0x46, 0x8e, 0x39, 0xa0, 0xad, 0x58, 0x3a, 0xa0, 0x8c, 0xfd, 0x39,
-  0x74, 0x7a, 0xf1, 0x39, 0xa6, 0xdd, 0xa3, 0x39, 0x2c, 0xdd, 0xdc, 0x39,
-  0x57, 0x97, 0xfc, 0x39, 0xa4, 0x2f, 0x19, 0x3a, 0x20, 0xa1, 0x13, 0x3a,
-  0xe1, 0xcc, 0x24, 0x3a, 0x8f, 0x4b, 0xba, 0x39, 0x01, 0x69, 0xe3, 0x39,
-  0x4b, 0x64, 0xcb, 0x39, 0x27, 0xc0, 0x0c, 0x3a, 0x8d, 0x31, 0x1e, 0x3a,
-  0xb8, 0xf3, 0xbb, 0x39, 0xed, 0x1c, 0xb7, 0x39, 0xca, 0x99, 0x0c, 0x3a,
-  0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x65, 0x78, 0x70, 0x61,
-  0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42,
-  0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x3e, 0xa3, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xd8, 0x02, 0x00, 0x00,
-  0xca, 0xbe, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x88, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2763,6 +2853,32 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x1a, 0xe2, 0x18, 0x3a,
+  0xbf, 0xc8, 0xe8, 0x39, 0x2f, 0x4d, 0xba, 0x39, 0x9b, 0x00, 0xcb, 0x39,
+  0x55, 0xcf, 0xf6, 0x38, 0xb0, 0x56, 0xc2, 0x39, 0xa6, 0x58, 0x48, 0x3a,
+  0x29, 0x48, 0x8e, 0x39, 0x5f, 0x69, 0xda, 0x39, 0x96, 0x57, 0x1b, 0x3a,
+  0x3e, 0xa5, 0xf6, 0x39, 0x9c, 0x24, 0xbe, 0x39, 0xd2, 0x1b, 0x99, 0x39,
+  0x0c, 0x88, 0xec, 0x39, 0xf6, 0xa9, 0xce, 0x39, 0x98, 0x54, 0xba, 0x39,
+  0xe0, 0xda, 0x9c, 0x39, 0x77, 0xd6, 0xcf, 0x38, 0x2b, 0xa8, 0xa6, 0x39,
+  0xc5, 0x35, 0xeb, 0x39, 0xd2, 0xab, 0x12, 0x3a, 0x2c, 0xbf, 0x75, 0x39,
+  0x3d, 0xdf, 0x0d, 0x3a, 0x9a, 0x4c, 0x8a, 0x39, 0xd7, 0x78, 0xc6, 0x39,
+  0x63, 0xd2, 0x53, 0x3a, 0x9c, 0x9e, 0xfc, 0x39, 0x0d, 0x72, 0x3d, 0x3a,
+  0x82, 0xc2, 0x61, 0x39, 0xcd, 0xf6, 0x92, 0x38, 0x5d, 0x46, 0x8e, 0x39,
+  0xa0, 0xad, 0x58, 0x3a, 0xa0, 0x8c, 0xfd, 0x39, 0x74, 0x7a, 0xf1, 0x39,
+  0xa6, 0xdd, 0xa3, 0x39, 0x2c, 0xdd, 0xdc, 0x39, 0x57, 0x97, 0xfc, 0x39,
+  0xa4, 0x2f, 0x19, 0x3a, 0x20, 0xa1, 0x13, 0x3a, 0xe1, 0xcc, 0x24, 0x3a,
+  0x8f, 0x4b, 0xba, 0x39, 0x01, 0x69, 0xe3, 0x39, 0x4b, 0x64, 0xcb, 0x39,
+  0x27, 0xc0, 0x0c, 0x3a, 0x8d, 0x31, 0x1e, 0x3a, 0xb8, 0xf3, 0xbb, 0x39,
+  0xed, 0x1c, 0xb7, 0x39, 0xca, 0x99, 0x0c, 0x3a, 0x2a, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x31, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42,
+  0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
+  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x3e, 0xa3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xd8, 0x02, 0x00, 0x00, 0xca, 0xbe, 0xff, 0xff,
+  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2783,39 +2899,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xa9, 0x2c, 0x8b, 0x3b, 0xf1, 0xd3, 0xb9, 0x3b, 0x93, 0xb1, 0x07, 0x3c,
-  0x9c, 0x90, 0xb0, 0x3b, 0xac, 0xda, 0xb6, 0x3c, 0xcb, 0xc1, 0xbc, 0x3b,
-  0xe7, 0x12, 0x8d, 0x3b, 0xad, 0xd2, 0x83, 0x3b, 0xe2, 0xb0, 0xc4, 0x3b,
-  0x37, 0xfd, 0x42, 0x3b, 0xf4, 0xbf, 0x28, 0x3b, 0xee, 0x18, 0x06, 0x3b,
-  0x73, 0xd8, 0x9a, 0x3b, 0xf3, 0xd1, 0x2f, 0x3b, 0xcb, 0xca, 0xe6, 0x3b,
-  0xcc, 0x7f, 0xd3, 0x3b, 0x1c, 0x94, 0xa3, 0x3b, 0x84, 0xe3, 0x63, 0x3c,
-  0xe8, 0xf3, 0xb0, 0x3b, 0x10, 0x78, 0xc6, 0x3b, 0x34, 0x92, 0xb6, 0x3b,
-  0x25, 0xcc, 0x9d, 0x3c, 0x68, 0xa0, 0xb7, 0x3b, 0xbc, 0x86, 0x37, 0x3c,
-  0xb8, 0x12, 0xa4, 0x3b, 0x10, 0x89, 0xb7, 0x3b, 0x3b, 0xd3, 0x1c, 0x3b,
-  0x3b, 0x29, 0x6f, 0x3b, 0xf9, 0x51, 0x12, 0x3c, 0x14, 0xfc, 0x2a, 0x3d,
-  0x10, 0x22, 0x2a, 0x3c, 0xf3, 0xa8, 0x5b, 0x3b, 0x9b, 0x04, 0x7c, 0x3b,
-  0x22, 0xfa, 0xab, 0x3b, 0x99, 0x54, 0xdc, 0x3b, 0x93, 0xb2, 0x2d, 0x3b,
-  0x98, 0xd2, 0x36, 0x3b, 0x2d, 0x09, 0x26, 0x3b, 0x76, 0xbb, 0xaa, 0x3b,
-  0x72, 0x2b, 0x2e, 0x3b, 0x25, 0xd3, 0x9c, 0x3b, 0x7b, 0x23, 0xc6, 0x3b,
-  0x11, 0x99, 0x7b, 0x3b, 0x67, 0x90, 0x7f, 0x3b, 0xcf, 0xb0, 0x29, 0x3b,
-  0xde, 0xc7, 0x51, 0x3c, 0xde, 0x4e, 0x28, 0x3b, 0xb5, 0x5b, 0xe9, 0x3b,
-  0x75, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
-  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
-  0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
-  0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
-  0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
-  0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
-  0x65, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x42, 0xa6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x68, 0x02, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x90, 0x02, 0x00, 0x00, 0x2c, 0xa6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2827,6 +2910,39 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xa9, 0x2c, 0x8b, 0x3b,
+  0xf1, 0xd3, 0xb9, 0x3b, 0x93, 0xb1, 0x07, 0x3c, 0x9c, 0x90, 0xb0, 0x3b,
+  0xac, 0xda, 0xb6, 0x3c, 0xcb, 0xc1, 0xbc, 0x3b, 0xe7, 0x12, 0x8d, 0x3b,
+  0xad, 0xd2, 0x83, 0x3b, 0xe2, 0xb0, 0xc4, 0x3b, 0x37, 0xfd, 0x42, 0x3b,
+  0xf4, 0xbf, 0x28, 0x3b, 0xee, 0x18, 0x06, 0x3b, 0x73, 0xd8, 0x9a, 0x3b,
+  0xf3, 0xd1, 0x2f, 0x3b, 0xcb, 0xca, 0xe6, 0x3b, 0xcc, 0x7f, 0xd3, 0x3b,
+  0x1c, 0x94, 0xa3, 0x3b, 0x84, 0xe3, 0x63, 0x3c, 0xe8, 0xf3, 0xb0, 0x3b,
+  0x10, 0x78, 0xc6, 0x3b, 0x34, 0x92, 0xb6, 0x3b, 0x25, 0xcc, 0x9d, 0x3c,
+  0x68, 0xa0, 0xb7, 0x3b, 0xbc, 0x86, 0x37, 0x3c, 0xb8, 0x12, 0xa4, 0x3b,
+  0x10, 0x89, 0xb7, 0x3b, 0x3b, 0xd3, 0x1c, 0x3b, 0x3b, 0x29, 0x6f, 0x3b,
+  0xf9, 0x51, 0x12, 0x3c, 0x14, 0xfc, 0x2a, 0x3d, 0x10, 0x22, 0x2a, 0x3c,
+  0xf3, 0xa8, 0x5b, 0x3b, 0x9b, 0x04, 0x7c, 0x3b, 0x22, 0xfa, 0xab, 0x3b,
+  0x99, 0x54, 0xdc, 0x3b, 0x93, 0xb2, 0x2d, 0x3b, 0x98, 0xd2, 0x36, 0x3b,
+  0x2d, 0x09, 0x26, 0x3b, 0x76, 0xbb, 0xaa, 0x3b, 0x72, 0x2b, 0x2e, 0x3b,
+  0x25, 0xd3, 0x9c, 0x3b, 0x7b, 0x23, 0xc6, 0x3b, 0x11, 0x99, 0x7b, 0x3b,
+  0x67, 0x90, 0x7f, 0x3b, 0xcf, 0xb0, 0x29, 0x3b, 0xde, 0xc7, 0x51, 0x3c,
+  0xde, 0x4e, 0x28, 0x3b, 0xb5, 0x5b, 0xe9, 0x3b, 0x75, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x31, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
+  0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
+  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
+  0x31, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f,
+  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
+  0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x42, 0xa6, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x02, 0x00, 0x00,
+  0x2c, 0xa6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2848,74 +2964,75 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x92, 0x94, 0xd1, 0x38, 0xe0, 0xea, 0x0b, 0x39,
-  0xb3, 0x56, 0x4c, 0x39, 0x67, 0xf1, 0x04, 0x39, 0xaf, 0xad, 0x09, 0x3a,
-  0x78, 0x1f, 0x0e, 0x39, 0xcc, 0x70, 0xd4, 0x38, 0x86, 0x82, 0xc6, 0x38,
-  0xc2, 0x18, 0x14, 0x39, 0xba, 0xd0, 0x92, 0x38, 0x0c, 0x1e, 0x7e, 0x38,
-  0x55, 0xef, 0x49, 0x38, 0xdb, 0x2d, 0xe9, 0x38, 0xd8, 0x61, 0x84, 0x38,
-  0xde, 0xc5, 0x2d, 0x39, 0x18, 0x3f, 0x1f, 0x39, 0x7f, 0x54, 0xf6, 0x38,
-  0x39, 0x96, 0xab, 0x39, 0x2a, 0x3c, 0x05, 0x39, 0x7c, 0x6f, 0x15, 0x39,
-  0x1e, 0x77, 0x09, 0x39, 0xd8, 0x9f, 0xed, 0x39, 0x91, 0x42, 0x0a, 0x39,
-  0x3c, 0x2f, 0x8a, 0x39, 0x27, 0x13, 0xf7, 0x38, 0xfd, 0x30, 0x0a, 0x39,
-  0x02, 0x29, 0x6c, 0x38, 0xff, 0x12, 0xb4, 0x38, 0x4d, 0x57, 0x5c, 0x39,
-  0xcd, 0xbd, 0x80, 0x3a, 0xa6, 0x19, 0x80, 0x39, 0x1b, 0x64, 0xa5, 0x38,
-  0x36, 0xc1, 0xbd, 0x38, 0x17, 0x7d, 0x01, 0x39, 0x58, 0xe5, 0x25, 0x39,
-  0xb7, 0xc8, 0x82, 0x38, 0x9a, 0xa7, 0x89, 0x38, 0xcc, 0x07, 0x7a, 0x38,
-  0x26, 0x8d, 0x00, 0x39, 0xb9, 0x23, 0x83, 0x38, 0xe1, 0x28, 0xec, 0x38,
-  0xcc, 0x2f, 0x15, 0x39, 0x3d, 0x70, 0xbd, 0x38, 0xba, 0x6c, 0xc0, 0x38,
-  0xc0, 0x88, 0x7f, 0x38, 0xdb, 0xf3, 0x9d, 0x39, 0xc1, 0x73, 0x7d, 0x38,
-  0x7c, 0xb4, 0x2f, 0x39, 0x2d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e,
-  0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e,
-  0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xf2, 0xa8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x9c, 0x00, 0x00, 0x00, 0xdc, 0xa8, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xa8, 0xb4, 0x10, 0x3c,
-  0x84, 0x03, 0xa8, 0x3b, 0x50, 0x73, 0xb4, 0x3b, 0xe0, 0x57, 0xb1, 0x3b,
-  0x86, 0x6d, 0xe5, 0x3b, 0xe3, 0xe4, 0xb8, 0x3b, 0xfc, 0xb6, 0x0a, 0x3c,
-  0xe3, 0xc4, 0x9b, 0x3b, 0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f,
-  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xba, 0xa9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x84, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xa8, 0x00, 0x00, 0x00, 0xa4, 0xa9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0xe5, 0xe8, 0x59, 0x39, 0x49, 0x02, 0xfd, 0x38,
-  0x5b, 0xde, 0x07, 0x39, 0x70, 0x87, 0x05, 0x39, 0xe4, 0xbe, 0x2c, 0x39,
-  0xe1, 0x36, 0x0b, 0x39, 0x5e, 0xe3, 0x50, 0x39, 0xe7, 0x91, 0xea, 0x38,
-  0x2b, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
-  0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x82, 0xaa, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x7c, 0x02, 0x00, 0x00,
-  0x6c, 0xaa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x92, 0x94, 0xd1, 0x38, 0xe0, 0xea, 0x0b, 0x39, 0xb3, 0x56, 0x4c, 0x39,
+  0x67, 0xf1, 0x04, 0x39, 0xaf, 0xad, 0x09, 0x3a, 0x78, 0x1f, 0x0e, 0x39,
+  0xcc, 0x70, 0xd4, 0x38, 0x86, 0x82, 0xc6, 0x38, 0xc2, 0x18, 0x14, 0x39,
+  0xba, 0xd0, 0x92, 0x38, 0x0c, 0x1e, 0x7e, 0x38, 0x55, 0xef, 0x49, 0x38,
+  0xdb, 0x2d, 0xe9, 0x38, 0xd8, 0x61, 0x84, 0x38, 0xde, 0xc5, 0x2d, 0x39,
+  0x18, 0x3f, 0x1f, 0x39, 0x7f, 0x54, 0xf6, 0x38, 0x39, 0x96, 0xab, 0x39,
+  0x2a, 0x3c, 0x05, 0x39, 0x7c, 0x6f, 0x15, 0x39, 0x1e, 0x77, 0x09, 0x39,
+  0xd8, 0x9f, 0xed, 0x39, 0x91, 0x42, 0x0a, 0x39, 0x3c, 0x2f, 0x8a, 0x39,
+  0x27, 0x13, 0xf7, 0x38, 0xfd, 0x30, 0x0a, 0x39, 0x02, 0x29, 0x6c, 0x38,
+  0xff, 0x12, 0xb4, 0x38, 0x4d, 0x57, 0x5c, 0x39, 0xcd, 0xbd, 0x80, 0x3a,
+  0xa6, 0x19, 0x80, 0x39, 0x1b, 0x64, 0xa5, 0x38, 0x36, 0xc1, 0xbd, 0x38,
+  0x17, 0x7d, 0x01, 0x39, 0x58, 0xe5, 0x25, 0x39, 0xb7, 0xc8, 0x82, 0x38,
+  0x9a, 0xa7, 0x89, 0x38, 0xcc, 0x07, 0x7a, 0x38, 0x26, 0x8d, 0x00, 0x39,
+  0xb9, 0x23, 0x83, 0x38, 0xe1, 0x28, 0xec, 0x38, 0xcc, 0x2f, 0x15, 0x39,
+  0x3d, 0x70, 0xbd, 0x38, 0xba, 0x6c, 0xc0, 0x38, 0xc0, 0x88, 0x7f, 0x38,
+  0xdb, 0xf3, 0x9d, 0x39, 0xc1, 0x73, 0x7d, 0x38, 0x7c, 0xb4, 0x2f, 0x39,
+  0x2d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
+  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
+  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xf2, 0xa8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x84, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x9c, 0x00, 0x00, 0x00, 0xdc, 0xa8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0xa8, 0xb4, 0x10, 0x3c, 0x84, 0x03, 0xa8, 0x3b,
+  0x50, 0x73, 0xb4, 0x3b, 0xe0, 0x57, 0xb1, 0x3b, 0x86, 0x6d, 0xe5, 0x3b,
+  0xe3, 0xe4, 0xb8, 0x3b, 0xfc, 0xb6, 0x0a, 0x3c, 0xe3, 0xc4, 0x9b, 0x3b,
+  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
+  0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xba, 0xa9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x00, 0x00,
+  0xa4, 0xa9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0xe5, 0xe8, 0x59, 0x39, 0x49, 0x02, 0xfd, 0x38, 0x5b, 0xde, 0x07, 0x39,
+  0x70, 0x87, 0x05, 0x39, 0xe4, 0xbe, 0x2c, 0x39, 0xe1, 0x36, 0x0b, 0x39,
+  0x5e, 0xe3, 0x50, 0x39, 0xe7, 0x91, 0xea, 0x38, 0x2b, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
+  0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
+  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x82, 0xaa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x7c, 0x02, 0x00, 0x00, 0x6c, 0xaa, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2938,31 +3055,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x0f, 0xfa, 0x51, 0x3b,
-  0x4d, 0x54, 0xce, 0x3a, 0x26, 0xa6, 0x4d, 0x3a, 0xc3, 0xa2, 0x74, 0x3b,
-  0xfd, 0x8c, 0x6c, 0x3b, 0xff, 0xfe, 0x83, 0x3b, 0x11, 0x5f, 0xf4, 0x3a,
-  0xd1, 0x56, 0x7f, 0x3a, 0x99, 0xa1, 0x21, 0x3b, 0x5d, 0x9e, 0x95, 0x3b,
-  0xb8, 0x0b, 0x77, 0x3b, 0x43, 0x27, 0x5d, 0x3b, 0xa9, 0xae, 0x81, 0x3a,
-  0x2b, 0x59, 0x6e, 0x3b, 0x42, 0x91, 0x82, 0x3b, 0xf8, 0x4a, 0x56, 0x3a,
-  0xec, 0x88, 0x8b, 0x3b, 0x61, 0x15, 0x5c, 0x3b, 0x76, 0x51, 0x80, 0x3b,
-  0xdf, 0xdd, 0x42, 0x3b, 0xd7, 0x4d, 0x1a, 0x3b, 0x31, 0xd5, 0x63, 0x3b,
-  0xa8, 0xe2, 0x9b, 0x3b, 0x8e, 0x74, 0xa4, 0x3a, 0x5e, 0x75, 0x2c, 0x3b,
-  0xac, 0x17, 0xe6, 0x3a, 0xb6, 0x10, 0x01, 0x3b, 0x28, 0x80, 0x8b, 0x3b,
-  0x1e, 0x26, 0x1c, 0x3b, 0x16, 0x4f, 0x02, 0x3b, 0xbf, 0x6e, 0xc0, 0x3b,
-  0x79, 0x2e, 0xd9, 0x3b, 0xd2, 0x26, 0x73, 0x3b, 0xee, 0xe4, 0x83, 0x3b,
-  0x07, 0xa9, 0x8b, 0x3b, 0x33, 0xdf, 0x98, 0x3b, 0x0b, 0x6e, 0x45, 0x3b,
-  0xe1, 0xb3, 0x87, 0x3b, 0x85, 0xed, 0x5b, 0x3b, 0x68, 0xf3, 0x3c, 0x3b,
-  0x9b, 0xac, 0x57, 0x3a, 0x32, 0x6c, 0x2e, 0x3b, 0xdf, 0x64, 0x46, 0x3b,
-  0x11, 0x9a, 0x22, 0x3b, 0xaf, 0xb0, 0x1d, 0x3b, 0xaa, 0x69, 0x34, 0x3b,
-  0x49, 0xf5, 0xcf, 0x3b, 0x82, 0x79, 0x12, 0x3b, 0x1d, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x32, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x2a, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x8c, 0x02, 0x00, 0x00, 0x14, 0xad, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2973,6 +3065,31 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x0f, 0xfa, 0x51, 0x3b, 0x4d, 0x54, 0xce, 0x3a,
+  0x26, 0xa6, 0x4d, 0x3a, 0xc3, 0xa2, 0x74, 0x3b, 0xfd, 0x8c, 0x6c, 0x3b,
+  0xff, 0xfe, 0x83, 0x3b, 0x11, 0x5f, 0xf4, 0x3a, 0xd1, 0x56, 0x7f, 0x3a,
+  0x99, 0xa1, 0x21, 0x3b, 0x5d, 0x9e, 0x95, 0x3b, 0xb8, 0x0b, 0x77, 0x3b,
+  0x43, 0x27, 0x5d, 0x3b, 0xa9, 0xae, 0x81, 0x3a, 0x2b, 0x59, 0x6e, 0x3b,
+  0x42, 0x91, 0x82, 0x3b, 0xf8, 0x4a, 0x56, 0x3a, 0xec, 0x88, 0x8b, 0x3b,
+  0x61, 0x15, 0x5c, 0x3b, 0x76, 0x51, 0x80, 0x3b, 0xdf, 0xdd, 0x42, 0x3b,
+  0xd7, 0x4d, 0x1a, 0x3b, 0x31, 0xd5, 0x63, 0x3b, 0xa8, 0xe2, 0x9b, 0x3b,
+  0x8e, 0x74, 0xa4, 0x3a, 0x5e, 0x75, 0x2c, 0x3b, 0xac, 0x17, 0xe6, 0x3a,
+  0xb6, 0x10, 0x01, 0x3b, 0x28, 0x80, 0x8b, 0x3b, 0x1e, 0x26, 0x1c, 0x3b,
+  0x16, 0x4f, 0x02, 0x3b, 0xbf, 0x6e, 0xc0, 0x3b, 0x79, 0x2e, 0xd9, 0x3b,
+  0xd2, 0x26, 0x73, 0x3b, 0xee, 0xe4, 0x83, 0x3b, 0x07, 0xa9, 0x8b, 0x3b,
+  0x33, 0xdf, 0x98, 0x3b, 0x0b, 0x6e, 0x45, 0x3b, 0xe1, 0xb3, 0x87, 0x3b,
+  0x85, 0xed, 0x5b, 0x3b, 0x68, 0xf3, 0x3c, 0x3b, 0x9b, 0xac, 0x57, 0x3a,
+  0x32, 0x6c, 0x2e, 0x3b, 0xdf, 0x64, 0x46, 0x3b, 0x11, 0x9a, 0x22, 0x3b,
+  0xaf, 0xb0, 0x1d, 0x3b, 0xaa, 0x69, 0x34, 0x3b, 0x49, 0xf5, 0xcf, 0x3b,
+  0x82, 0x79, 0x12, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f,
+  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
+  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x2a, 0xad, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x68, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x8c, 0x02, 0x00, 0x00, 0x14, 0xad, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -2995,32 +3112,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xcc, 0x65, 0x8d, 0x39,
-  0x02, 0xf1, 0x0a, 0x39, 0xbc, 0x7b, 0x8a, 0x38, 0xa5, 0xbc, 0xa4, 0x39,
-  0xde, 0x4a, 0x9f, 0x39, 0x7b, 0xc5, 0xb1, 0x39, 0x0f, 0x8f, 0x24, 0x39,
-  0xca, 0xf1, 0xab, 0x38, 0x10, 0xaf, 0x59, 0x39, 0x5b, 0x81, 0xc9, 0x39,
-  0x1a, 0x5c, 0xa6, 0x39, 0x85, 0xec, 0x94, 0x39, 0xba, 0xa7, 0xae, 0x38,
-  0xc0, 0x80, 0xa0, 0x39, 0xe8, 0xd8, 0xaf, 0x39, 0xd7, 0x4d, 0x90, 0x38,
-  0xb1, 0xec, 0xbb, 0x39, 0x17, 0x34, 0x94, 0x39, 0x6d, 0xd1, 0xac, 0x39,
-  0xf9, 0x38, 0x83, 0x39, 0xce, 0xd0, 0x4f, 0x39, 0xfb, 0x6b, 0x99, 0x39,
-  0x02, 0xf2, 0xd1, 0x39, 0xbc, 0x7c, 0xdd, 0x38, 0x10, 0x44, 0x68, 0x39,
-  0x87, 0xf1, 0x1a, 0x39, 0x00, 0xd3, 0x2d, 0x39, 0xe2, 0xe0, 0xbb, 0x39,
-  0xdd, 0x4c, 0x52, 0x39, 0xc9, 0x7f, 0x2f, 0x39, 0x5d, 0x95, 0x01, 0x3a,
-  0xd2, 0x3f, 0x12, 0x3a, 0xcb, 0xbc, 0xa3, 0x39, 0x5f, 0xa2, 0xb1, 0x39,
-  0xee, 0x17, 0xbc, 0x39, 0x04, 0xe3, 0xcd, 0x39, 0xd6, 0xf2, 0x84, 0x39,
-  0x6d, 0xc3, 0xb6, 0x39, 0x3f, 0x19, 0x94, 0x39, 0x46, 0x7a, 0x7e, 0x39,
-  0xfa, 0x3b, 0x91, 0x38, 0x44, 0xe9, 0x6a, 0x39, 0x0d, 0x99, 0x85, 0x39,
-  0xb2, 0xfd, 0x5a, 0x39, 0x43, 0x60, 0x54, 0x39, 0x88, 0xfa, 0x72, 0x39,
-  0xce, 0x09, 0x0c, 0x3a, 0x62, 0x45, 0x45, 0x39, 0x2a, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x32, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42,
-  0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
-  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0xd6, 0xaf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xd8, 0x02, 0x00, 0x00, 0x62, 0xcb, 0xff, 0xff,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3031,6 +3122,31 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xcc, 0x65, 0x8d, 0x39, 0x02, 0xf1, 0x0a, 0x39,
+  0xbc, 0x7b, 0x8a, 0x38, 0xa5, 0xbc, 0xa4, 0x39, 0xde, 0x4a, 0x9f, 0x39,
+  0x7b, 0xc5, 0xb1, 0x39, 0x0f, 0x8f, 0x24, 0x39, 0xca, 0xf1, 0xab, 0x38,
+  0x10, 0xaf, 0x59, 0x39, 0x5b, 0x81, 0xc9, 0x39, 0x1a, 0x5c, 0xa6, 0x39,
+  0x85, 0xec, 0x94, 0x39, 0xba, 0xa7, 0xae, 0x38, 0xc0, 0x80, 0xa0, 0x39,
+  0xe8, 0xd8, 0xaf, 0x39, 0xd7, 0x4d, 0x90, 0x38, 0xb1, 0xec, 0xbb, 0x39,
+  0x17, 0x34, 0x94, 0x39, 0x6d, 0xd1, 0xac, 0x39, 0xf9, 0x38, 0x83, 0x39,
+  0xce, 0xd0, 0x4f, 0x39, 0xfb, 0x6b, 0x99, 0x39, 0x02, 0xf2, 0xd1, 0x39,
+  0xbc, 0x7c, 0xdd, 0x38, 0x10, 0x44, 0x68, 0x39, 0x87, 0xf1, 0x1a, 0x39,
+  0x00, 0xd3, 0x2d, 0x39, 0xe2, 0xe0, 0xbb, 0x39, 0xdd, 0x4c, 0x52, 0x39,
+  0xc9, 0x7f, 0x2f, 0x39, 0x5d, 0x95, 0x01, 0x3a, 0xd2, 0x3f, 0x12, 0x3a,
+  0xcb, 0xbc, 0xa3, 0x39, 0x5f, 0xa2, 0xb1, 0x39, 0xee, 0x17, 0xbc, 0x39,
+  0x04, 0xe3, 0xcd, 0x39, 0xd6, 0xf2, 0x84, 0x39, 0x6d, 0xc3, 0xb6, 0x39,
+  0x3f, 0x19, 0x94, 0x39, 0x46, 0x7a, 0x7e, 0x39, 0xfa, 0x3b, 0x91, 0x38,
+  0x44, 0xe9, 0x6a, 0x39, 0x0d, 0x99, 0x85, 0x39, 0xb2, 0xfd, 0x5a, 0x39,
+  0x43, 0x60, 0x54, 0x39, 0x88, 0xfa, 0x72, 0x39, 0xce, 0x09, 0x0c, 0x3a,
+  0x62, 0x45, 0x45, 0x39, 0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f,
+  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75,
+  0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
+  0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0xd6, 0xaf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x68, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xd8, 0x02, 0x00, 0x00, 0x62, 0xcb, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3052,39 +3168,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xb7, 0x69, 0x5f, 0x3c,
-  0xb0, 0x2c, 0xa9, 0x3b, 0xe4, 0xb0, 0x07, 0x3d, 0x39, 0xf1, 0x60, 0x3c,
-  0xb1, 0x1c, 0xfd, 0x3b, 0x92, 0xc6, 0x48, 0x3c, 0xad, 0x49, 0x63, 0x3c,
-  0x0c, 0xb7, 0x6d, 0x3c, 0x90, 0xb4, 0xb2, 0x3b, 0xa3, 0xf4, 0xf2, 0x3b,
-  0x22, 0x16, 0x10, 0x3c, 0xaf, 0x39, 0x76, 0x3d, 0x2a, 0xcd, 0x9d, 0x3c,
-  0x10, 0x8e, 0xa7, 0x3b, 0xe6, 0x69, 0x2a, 0x3c, 0x2e, 0x85, 0xb1, 0x3c,
-  0x84, 0x17, 0xd4, 0x3b, 0xce, 0x39, 0x6a, 0x3b, 0xc3, 0xff, 0x14, 0x3c,
-  0xf8, 0x91, 0x24, 0x3c, 0xa6, 0x66, 0x19, 0x3c, 0x65, 0x45, 0x05, 0x3c,
-  0xdf, 0x63, 0x30, 0x3b, 0x0a, 0x88, 0x91, 0x3c, 0xfc, 0x4f, 0x08, 0x3c,
-  0xab, 0xee, 0x80, 0x3c, 0xfe, 0xe4, 0x67, 0x3c, 0x9f, 0x7e, 0x0d, 0x3c,
-  0x4d, 0x8a, 0x3b, 0x3c, 0x0f, 0xb6, 0xb4, 0x3c, 0xf7, 0x45, 0xe3, 0x3b,
-  0x80, 0x6c, 0xd8, 0x3b, 0x8a, 0x0d, 0xf5, 0x3b, 0x68, 0x9a, 0xf8, 0x3b,
-  0x2a, 0x07, 0xde, 0x3b, 0x0c, 0x95, 0x75, 0x3c, 0x6a, 0x85, 0x69, 0x3d,
-  0xe9, 0xca, 0x1e, 0x3c, 0x0f, 0x4c, 0xcc, 0x3b, 0x84, 0xae, 0x1d, 0x3c,
-  0xac, 0x7c, 0x6b, 0x3c, 0xf6, 0x86, 0xc4, 0x3b, 0xf4, 0xfb, 0x51, 0x3c,
-  0x12, 0xbd, 0x20, 0x3c, 0x7d, 0x32, 0x4b, 0x3c, 0xb8, 0x55, 0x27, 0x3b,
-  0xe5, 0x2d, 0x04, 0x3b, 0x9c, 0x65, 0xea, 0x3b, 0x75, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x32, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
-  0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
-  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
-  0x32, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
-  0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xda, 0xb2, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
-  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x02, 0x00, 0x00,
-  0xc4, 0xb2, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3096,6 +3179,38 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xb7, 0x69, 0x5f, 0x3c, 0xb0, 0x2c, 0xa9, 0x3b,
+  0xe4, 0xb0, 0x07, 0x3d, 0x39, 0xf1, 0x60, 0x3c, 0xb1, 0x1c, 0xfd, 0x3b,
+  0x92, 0xc6, 0x48, 0x3c, 0xad, 0x49, 0x63, 0x3c, 0x0c, 0xb7, 0x6d, 0x3c,
+  0x90, 0xb4, 0xb2, 0x3b, 0xa3, 0xf4, 0xf2, 0x3b, 0x22, 0x16, 0x10, 0x3c,
+  0xaf, 0x39, 0x76, 0x3d, 0x2a, 0xcd, 0x9d, 0x3c, 0x10, 0x8e, 0xa7, 0x3b,
+  0xe6, 0x69, 0x2a, 0x3c, 0x2e, 0x85, 0xb1, 0x3c, 0x84, 0x17, 0xd4, 0x3b,
+  0xce, 0x39, 0x6a, 0x3b, 0xc3, 0xff, 0x14, 0x3c, 0xf8, 0x91, 0x24, 0x3c,
+  0xa6, 0x66, 0x19, 0x3c, 0x65, 0x45, 0x05, 0x3c, 0xdf, 0x63, 0x30, 0x3b,
+  0x0a, 0x88, 0x91, 0x3c, 0xfc, 0x4f, 0x08, 0x3c, 0xab, 0xee, 0x80, 0x3c,
+  0xfe, 0xe4, 0x67, 0x3c, 0x9f, 0x7e, 0x0d, 0x3c, 0x4d, 0x8a, 0x3b, 0x3c,
+  0x0f, 0xb6, 0xb4, 0x3c, 0xf7, 0x45, 0xe3, 0x3b, 0x80, 0x6c, 0xd8, 0x3b,
+  0x8a, 0x0d, 0xf5, 0x3b, 0x68, 0x9a, 0xf8, 0x3b, 0x2a, 0x07, 0xde, 0x3b,
+  0x0c, 0x95, 0x75, 0x3c, 0x6a, 0x85, 0x69, 0x3d, 0xe9, 0xca, 0x1e, 0x3c,
+  0x0f, 0x4c, 0xcc, 0x3b, 0x84, 0xae, 0x1d, 0x3c, 0xac, 0x7c, 0x6b, 0x3c,
+  0xf6, 0x86, 0xc4, 0x3b, 0xf4, 0xfb, 0x51, 0x3c, 0x12, 0xbd, 0x20, 0x3c,
+  0x7d, 0x32, 0x4b, 0x3c, 0xb8, 0x55, 0x27, 0x3b, 0xe5, 0x2d, 0x04, 0x3b,
+  0x9c, 0x65, 0xea, 0x3b, 0x75, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e,
+  0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e,
+  0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
+  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
+  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0xda, 0xb2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x90, 0x02, 0x00, 0x00, 0xc4, 0xb2, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3116,77 +3231,77 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x81, 0x37, 0xa8, 0x39, 0xca, 0xc1, 0xfe, 0x38, 0xac, 0x55, 0x4c, 0x3a,
-  0x49, 0x5e, 0xa9, 0x39, 0x19, 0x94, 0x3e, 0x39, 0x1a, 0x2c, 0x97, 0x39,
-  0x64, 0x22, 0xab, 0x39, 0x46, 0xfc, 0xb2, 0x39, 0xfa, 0x8d, 0x06, 0x39,
-  0x69, 0xee, 0x36, 0x39, 0x2d, 0xfa, 0x58, 0x39, 0xa8, 0x64, 0xb9, 0x3a,
-  0x61, 0xa1, 0xed, 0x39, 0x6a, 0x51, 0xfc, 0x38, 0xbc, 0x4f, 0x80, 0x39,
-  0x8c, 0xa9, 0x05, 0x3a, 0x55, 0xb1, 0x1f, 0x39, 0xb6, 0x5b, 0xb0, 0x38,
-  0x05, 0x60, 0x60, 0x39, 0xc7, 0xd2, 0x77, 0x39, 0xfa, 0x00, 0x67, 0x39,
-  0xc9, 0xb0, 0x48, 0x39, 0xb7, 0xcf, 0x84, 0x38, 0x36, 0x27, 0xdb, 0x39,
-  0x40, 0x45, 0x4d, 0x39, 0x29, 0x28, 0xc2, 0x39, 0x59, 0x9a, 0xae, 0x39,
-  0x02, 0x13, 0x55, 0x39, 0xef, 0x34, 0x8d, 0x39, 0x9c, 0x10, 0x08, 0x3a,
-  0x99, 0x1f, 0x2b, 0x39, 0x55, 0xf4, 0x22, 0x39, 0xaa, 0x82, 0x38, 0x39,
-  0xfd, 0x2e, 0x3b, 0x39, 0x8c, 0x2c, 0x27, 0x39, 0xb2, 0xe8, 0xb8, 0x39,
-  0xe4, 0xd3, 0xaf, 0x3a, 0x7d, 0x1f, 0x6f, 0x39, 0xde, 0xd2, 0x19, 0x39,
-  0x3a, 0x73, 0x6d, 0x39, 0xd0, 0x4e, 0xb1, 0x39, 0x32, 0xf9, 0x13, 0x39,
-  0x12, 0x1b, 0x9e, 0x39, 0xa9, 0x0d, 0x72, 0x39, 0xdd, 0xfe, 0x98, 0x39,
-  0x91, 0xfc, 0x7b, 0x38, 0xe4, 0x0b, 0x47, 0x38, 0xb2, 0x7c, 0x30, 0x39,
-  0x2d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
-  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
-  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x8a, 0xb5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x84, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x9c, 0x00, 0x00, 0x00, 0x74, 0xb5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x71, 0x28, 0x8b, 0x3b, 0x85, 0x91, 0xa4, 0x3b,
-  0xda, 0xcc, 0xb9, 0x3b, 0x74, 0x36, 0xa2, 0x3b, 0x1a, 0x78, 0xbb, 0x3b,
-  0x7f, 0x0a, 0xe5, 0x3b, 0x1f, 0x6b, 0xb2, 0x3b, 0xb8, 0xda, 0x86, 0x3b,
-  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
-  0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x52, 0xb6, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
-  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x00, 0x00,
-  0x3c, 0xb6, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x38, 0x8e, 0xd1, 0x38, 0x1a, 0xd2, 0xf7, 0x38, 0x89, 0xe5, 0x0b, 0x39,
-  0xf4, 0x45, 0xf4, 0x38, 0x3b, 0x27, 0x0d, 0x39, 0x54, 0x74, 0x2c, 0x39,
-  0xae, 0x56, 0x06, 0x39, 0x27, 0x13, 0xcb, 0x38, 0x2b, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
-  0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x1a, 0xb7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x7c, 0x02, 0x00, 0x00, 0x04, 0xb7, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x81, 0x37, 0xa8, 0x39,
+  0xca, 0xc1, 0xfe, 0x38, 0xac, 0x55, 0x4c, 0x3a, 0x49, 0x5e, 0xa9, 0x39,
+  0x19, 0x94, 0x3e, 0x39, 0x1a, 0x2c, 0x97, 0x39, 0x64, 0x22, 0xab, 0x39,
+  0x46, 0xfc, 0xb2, 0x39, 0xfa, 0x8d, 0x06, 0x39, 0x69, 0xee, 0x36, 0x39,
+  0x2d, 0xfa, 0x58, 0x39, 0xa8, 0x64, 0xb9, 0x3a, 0x61, 0xa1, 0xed, 0x39,
+  0x6a, 0x51, 0xfc, 0x38, 0xbc, 0x4f, 0x80, 0x39, 0x8c, 0xa9, 0x05, 0x3a,
+  0x55, 0xb1, 0x1f, 0x39, 0xb6, 0x5b, 0xb0, 0x38, 0x05, 0x60, 0x60, 0x39,
+  0xc7, 0xd2, 0x77, 0x39, 0xfa, 0x00, 0x67, 0x39, 0xc9, 0xb0, 0x48, 0x39,
+  0xb7, 0xcf, 0x84, 0x38, 0x36, 0x27, 0xdb, 0x39, 0x40, 0x45, 0x4d, 0x39,
+  0x29, 0x28, 0xc2, 0x39, 0x59, 0x9a, 0xae, 0x39, 0x02, 0x13, 0x55, 0x39,
+  0xef, 0x34, 0x8d, 0x39, 0x9c, 0x10, 0x08, 0x3a, 0x99, 0x1f, 0x2b, 0x39,
+  0x55, 0xf4, 0x22, 0x39, 0xaa, 0x82, 0x38, 0x39, 0xfd, 0x2e, 0x3b, 0x39,
+  0x8c, 0x2c, 0x27, 0x39, 0xb2, 0xe8, 0xb8, 0x39, 0xe4, 0xd3, 0xaf, 0x3a,
+  0x7d, 0x1f, 0x6f, 0x39, 0xde, 0xd2, 0x19, 0x39, 0x3a, 0x73, 0x6d, 0x39,
+  0xd0, 0x4e, 0xb1, 0x39, 0x32, 0xf9, 0x13, 0x39, 0x12, 0x1b, 0x9e, 0x39,
+  0xa9, 0x0d, 0x72, 0x39, 0xdd, 0xfe, 0x98, 0x39, 0x91, 0xfc, 0x7b, 0x38,
+  0xe4, 0x0b, 0x47, 0x38, 0xb2, 0x7c, 0x30, 0x39, 0x2d, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x32, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
+  0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
+  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x8a, 0xb5, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9c, 0x00, 0x00, 0x00,
+  0x74, 0xb5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x71, 0x28, 0x8b, 0x3b, 0x85, 0x91, 0xa4, 0x3b, 0xda, 0xcc, 0xb9, 0x3b,
+  0x74, 0x36, 0xa2, 0x3b, 0x1a, 0x78, 0xbb, 0x3b, 0x7f, 0x0a, 0xe5, 0x3b,
+  0x1f, 0x6b, 0xb2, 0x3b, 0xb8, 0xda, 0x86, 0x3b, 0x1e, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x32, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x52, 0xb6, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xa8, 0x00, 0x00, 0x00, 0x3c, 0xb6, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x48, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x38, 0x8e, 0xd1, 0x38,
+  0x1a, 0xd2, 0xf7, 0x38, 0x89, 0xe5, 0x0b, 0x39, 0xf4, 0x45, 0xf4, 0x38,
+  0x3b, 0x27, 0x0d, 0x39, 0x54, 0x74, 0x2c, 0x39, 0xae, 0x56, 0x06, 0x39,
+  0x27, 0x13, 0xcb, 0x38, 0x2b, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x32, 0x5f,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46,
+  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
+  0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x1a, 0xb7, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x64, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x7c, 0x02, 0x00, 0x00, 0x04, 0xb7, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x88, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3207,31 +3322,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x65, 0x1b, 0x3e, 0x3b, 0x0b, 0xb3, 0x5c, 0x3b,
-  0x84, 0xfe, 0x77, 0x3b, 0x7c, 0x4b, 0x29, 0x3b, 0x19, 0xad, 0x25, 0x3b,
-  0xd2, 0xa6, 0x34, 0x3b, 0xb4, 0x7b, 0x01, 0x3b, 0xfc, 0x74, 0x02, 0x3b,
-  0x4e, 0x8a, 0x51, 0x3b, 0x9f, 0x8b, 0x62, 0x3b, 0x90, 0x66, 0x18, 0x3b,
-  0x70, 0x5c, 0x0c, 0x3b, 0xd9, 0x2b, 0x4f, 0x3b, 0xa6, 0xa3, 0x5e, 0x3b,
-  0x9e, 0xdf, 0x15, 0x3b, 0x57, 0x3b, 0x10, 0x3b, 0xe1, 0x60, 0x3d, 0x3b,
-  0x6f, 0xfa, 0x3b, 0x3b, 0x16, 0x77, 0xce, 0x3a, 0x4c, 0x6d, 0x53, 0x3b,
-  0x19, 0xe3, 0x69, 0x3b, 0xc1, 0xe7, 0x2f, 0x3b, 0x7b, 0x54, 0x35, 0x3b,
-  0x0f, 0x70, 0x00, 0x3b, 0x38, 0x1f, 0x41, 0x3b, 0x4a, 0x88, 0x40, 0x3b,
-  0x3e, 0x8b, 0x36, 0x3b, 0x26, 0x78, 0x56, 0x3b, 0x5b, 0x41, 0xed, 0x39,
-  0x17, 0x0b, 0x4c, 0x3b, 0xe5, 0x64, 0x1a, 0x3b, 0x35, 0x91, 0xf1, 0x3a,
-  0x01, 0x0f, 0x32, 0x3b, 0x02, 0xba, 0x0f, 0x3b, 0x79, 0x2d, 0x3e, 0x3b,
-  0x4b, 0x81, 0x14, 0x3b, 0x00, 0x7f, 0x10, 0x3b, 0x64, 0x07, 0x5d, 0x3b,
-  0xc6, 0x97, 0x29, 0x3b, 0x6d, 0xcd, 0xca, 0x3a, 0x31, 0x8c, 0x81, 0x3b,
-  0x7e, 0x88, 0xa4, 0x3a, 0x7c, 0x70, 0x04, 0x3b, 0x3a, 0xbc, 0x57, 0x3b,
-  0x38, 0x7d, 0xad, 0x3a, 0x5f, 0x39, 0x2a, 0x3b, 0x95, 0x1c, 0x4c, 0x3b,
-  0x76, 0x7a, 0x2c, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0xc2, 0xb9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x68, 0x02, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x8c, 0x02, 0x00, 0x00, 0xac, 0xb9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3243,6 +3333,32 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x65, 0x1b, 0x3e, 0x3b, 0x0b, 0xb3, 0x5c, 0x3b, 0x84, 0xfe, 0x77, 0x3b,
+  0x7c, 0x4b, 0x29, 0x3b, 0x19, 0xad, 0x25, 0x3b, 0xd2, 0xa6, 0x34, 0x3b,
+  0xb4, 0x7b, 0x01, 0x3b, 0xfc, 0x74, 0x02, 0x3b, 0x4e, 0x8a, 0x51, 0x3b,
+  0x9f, 0x8b, 0x62, 0x3b, 0x90, 0x66, 0x18, 0x3b, 0x70, 0x5c, 0x0c, 0x3b,
+  0xd9, 0x2b, 0x4f, 0x3b, 0xa6, 0xa3, 0x5e, 0x3b, 0x9e, 0xdf, 0x15, 0x3b,
+  0x57, 0x3b, 0x10, 0x3b, 0xe1, 0x60, 0x3d, 0x3b, 0x6f, 0xfa, 0x3b, 0x3b,
+  0x16, 0x77, 0xce, 0x3a, 0x4c, 0x6d, 0x53, 0x3b, 0x19, 0xe3, 0x69, 0x3b,
+  0xc1, 0xe7, 0x2f, 0x3b, 0x7b, 0x54, 0x35, 0x3b, 0x0f, 0x70, 0x00, 0x3b,
+  0x38, 0x1f, 0x41, 0x3b, 0x4a, 0x88, 0x40, 0x3b, 0x3e, 0x8b, 0x36, 0x3b,
+  0x26, 0x78, 0x56, 0x3b, 0x5b, 0x41, 0xed, 0x39, 0x17, 0x0b, 0x4c, 0x3b,
+  0xe5, 0x64, 0x1a, 0x3b, 0x35, 0x91, 0xf1, 0x3a, 0x01, 0x0f, 0x32, 0x3b,
+  0x02, 0xba, 0x0f, 0x3b, 0x79, 0x2d, 0x3e, 0x3b, 0x4b, 0x81, 0x14, 0x3b,
+  0x00, 0x7f, 0x10, 0x3b, 0x64, 0x07, 0x5d, 0x3b, 0xc6, 0x97, 0x29, 0x3b,
+  0x6d, 0xcd, 0xca, 0x3a, 0x31, 0x8c, 0x81, 0x3b, 0x7e, 0x88, 0xa4, 0x3a,
+  0x7c, 0x70, 0x04, 0x3b, 0x3a, 0xbc, 0x57, 0x3b, 0x38, 0x7d, 0xad, 0x3a,
+  0x5f, 0x39, 0x2a, 0x3b, 0x95, 0x1c, 0x4c, 0x3b, 0x76, 0x7a, 0x2c, 0x3b,
+  0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x65, 0x78, 0x70, 0x61,
+  0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xc2, 0xb9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8c, 0x02, 0x00, 0x00,
+  0xac, 0xb9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3264,31 +3380,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x0f, 0x17, 0x94, 0x39, 0xc7, 0xeb, 0xab, 0x39,
-  0xe6, 0x2e, 0xc1, 0x39, 0xb5, 0xe0, 0x83, 0x39, 0x12, 0x0f, 0x81, 0x39,
-  0x79, 0xb9, 0x8c, 0x39, 0xf9, 0xba, 0x49, 0x39, 0x59, 0x3f, 0x4b, 0x39,
-  0x6d, 0x3a, 0xa3, 0x39, 0x96, 0x79, 0xb0, 0x39, 0x57, 0x6f, 0x6d, 0x39,
-  0x7f, 0xad, 0x5a, 0x39, 0x02, 0x62, 0xa1, 0x39, 0xa0, 0x6e, 0xad, 0x39,
-  0x6c, 0x7f, 0x69, 0x39, 0x49, 0xb5, 0x60, 0x39, 0xc4, 0x85, 0x93, 0x39,
-  0x8b, 0x6e, 0x92, 0x39, 0x33, 0xd5, 0x20, 0x39, 0xab, 0xb2, 0xa4, 0x39,
-  0xaa, 0x31, 0xb6, 0x39, 0xf5, 0x06, 0x89, 0x39, 0xc0, 0x40, 0x8d, 0x39,
-  0xfe, 0x19, 0x48, 0x39, 0x4c, 0x70, 0x96, 0x39, 0xb9, 0xfa, 0x95, 0x39,
-  0xd4, 0x32, 0x8e, 0x39, 0x62, 0x11, 0xa7, 0x39, 0x59, 0xd1, 0x38, 0x38,
-  0x3b, 0xf2, 0x9e, 0x39, 0x6b, 0x8a, 0x70, 0x39, 0x3b, 0x2d, 0x3c, 0x39,
-  0x5f, 0xb4, 0x8a, 0x39, 0xcb, 0xeb, 0x5f, 0x39, 0x24, 0x25, 0x94, 0x39,
-  0xa1, 0x5d, 0x67, 0x39, 0xb3, 0x1e, 0x61, 0x39, 0x7b, 0x2d, 0xac, 0x39,
-  0x23, 0x1c, 0x84, 0x39, 0xc7, 0xfa, 0x1d, 0x39, 0xaa, 0xd4, 0xc9, 0x39,
-  0x22, 0x2b, 0x00, 0x39, 0x03, 0x56, 0x4e, 0x39, 0xd5, 0x0d, 0xa8, 0x39,
-  0x21, 0x25, 0x07, 0x39, 0x05, 0x9a, 0x84, 0x39, 0xdb, 0xff, 0x9e, 0x39,
-  0x90, 0x5b, 0x86, 0x39, 0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75,
-  0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
-  0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x6e, 0xbc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x6c, 0x02, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xb8, 0x02, 0x00, 0x00, 0xfa, 0xd7, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3299,6 +3390,32 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+  0x0f, 0x17, 0x94, 0x39, 0xc7, 0xeb, 0xab, 0x39, 0xe6, 0x2e, 0xc1, 0x39,
+  0xb5, 0xe0, 0x83, 0x39, 0x12, 0x0f, 0x81, 0x39, 0x79, 0xb9, 0x8c, 0x39,
+  0xf9, 0xba, 0x49, 0x39, 0x59, 0x3f, 0x4b, 0x39, 0x6d, 0x3a, 0xa3, 0x39,
+  0x96, 0x79, 0xb0, 0x39, 0x57, 0x6f, 0x6d, 0x39, 0x7f, 0xad, 0x5a, 0x39,
+  0x02, 0x62, 0xa1, 0x39, 0xa0, 0x6e, 0xad, 0x39, 0x6c, 0x7f, 0x69, 0x39,
+  0x49, 0xb5, 0x60, 0x39, 0xc4, 0x85, 0x93, 0x39, 0x8b, 0x6e, 0x92, 0x39,
+  0x33, 0xd5, 0x20, 0x39, 0xab, 0xb2, 0xa4, 0x39, 0xaa, 0x31, 0xb6, 0x39,
+  0xf5, 0x06, 0x89, 0x39, 0xc0, 0x40, 0x8d, 0x39, 0xfe, 0x19, 0x48, 0x39,
+  0x4c, 0x70, 0x96, 0x39, 0xb9, 0xfa, 0x95, 0x39, 0xd4, 0x32, 0x8e, 0x39,
+  0x62, 0x11, 0xa7, 0x39, 0x59, 0xd1, 0x38, 0x38, 0x3b, 0xf2, 0x9e, 0x39,
+  0x6b, 0x8a, 0x70, 0x39, 0x3b, 0x2d, 0x3c, 0x39, 0x5f, 0xb4, 0x8a, 0x39,
+  0xcb, 0xeb, 0x5f, 0x39, 0x24, 0x25, 0x94, 0x39, 0xa1, 0x5d, 0x67, 0x39,
+  0xb3, 0x1e, 0x61, 0x39, 0x7b, 0x2d, 0xac, 0x39, 0x23, 0x1c, 0x84, 0x39,
+  0xc7, 0xfa, 0x1d, 0x39, 0xaa, 0xd4, 0xc9, 0x39, 0x22, 0x2b, 0x00, 0x39,
+  0x03, 0x56, 0x4e, 0x39, 0xd5, 0x0d, 0xa8, 0x39, 0x21, 0x25, 0x07, 0x39,
+  0x05, 0x9a, 0x84, 0x39, 0xdb, 0xff, 0x9e, 0x39, 0x90, 0x5b, 0x86, 0x39,
+  0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x65, 0x78, 0x70, 0x61,
+  0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42,
+  0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x6e, 0xbc, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb8, 0x02, 0x00, 0x00,
+  0xfa, 0xd7, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3321,36 +3438,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x51, 0xbd, 0x6e, 0x3b,
-  0x9f, 0x7b, 0x4a, 0x3b, 0x14, 0x53, 0x1c, 0x3b, 0xe7, 0xa6, 0xc4, 0x3b,
-  0x95, 0xac, 0x89, 0x3b, 0x0a, 0x7f, 0x3c, 0x3b, 0x25, 0xfe, 0x13, 0x3b,
-  0x2f, 0x6d, 0x0a, 0x3c, 0xe0, 0xc5, 0x97, 0x3b, 0xbf, 0xac, 0xb3, 0x3a,
-  0x26, 0xb8, 0x13, 0x3b, 0xc2, 0xde, 0x78, 0x3b, 0x65, 0x31, 0x39, 0x3b,
-  0x24, 0xc0, 0x87, 0x3b, 0x74, 0x4b, 0xfc, 0x3a, 0xf1, 0xad, 0x59, 0x3b,
-  0xf6, 0x18, 0xc0, 0x3b, 0xc9, 0xd5, 0x2a, 0x3b, 0xe3, 0x75, 0xc8, 0x3b,
-  0x48, 0x90, 0xfe, 0x3a, 0x7a, 0x1f, 0x0c, 0x3b, 0x19, 0x1d, 0x54, 0x3b,
-  0xa3, 0xe6, 0x27, 0x3b, 0xca, 0x16, 0x79, 0x3b, 0xca, 0xf6, 0x94, 0x3b,
-  0xd1, 0x3f, 0xf0, 0x3a, 0x23, 0xcf, 0x0a, 0x3b, 0x4f, 0xe7, 0x11, 0x3b,
-  0x9c, 0xc2, 0x15, 0x3c, 0x90, 0x08, 0x30, 0x3b, 0xbc, 0xea, 0xc2, 0x3a,
-  0x8a, 0x52, 0x35, 0x3c, 0x59, 0xa9, 0x85, 0x3b, 0x54, 0x71, 0x09, 0x3c,
-  0x68, 0x39, 0x24, 0x3b, 0x73, 0x6e, 0x66, 0x3b, 0x4a, 0x53, 0x45, 0x3b,
-  0xa2, 0xbb, 0xe6, 0x3a, 0x9f, 0x2e, 0x67, 0x3b, 0x5b, 0x0d, 0x60, 0x3b,
-  0x1a, 0xed, 0x02, 0x3b, 0xc4, 0x63, 0xf3, 0x3b, 0x03, 0x97, 0x17, 0x3c,
-  0x97, 0xfa, 0x2e, 0x3b, 0x81, 0x98, 0xca, 0x3b, 0x8f, 0x35, 0x32, 0x3b,
-  0xc2, 0xc3, 0x2e, 0x3b, 0x92, 0x9a, 0x2f, 0x3b, 0x51, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
-  0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
-  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
-  0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x52, 0xbf, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00,
-  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x90, 0x02, 0x00, 0x00,
-  0x3c, 0xbf, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00,
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3361,6 +3448,35 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x51, 0xbd, 0x6e, 0x3b, 0x9f, 0x7b, 0x4a, 0x3b,
+  0x14, 0x53, 0x1c, 0x3b, 0xe7, 0xa6, 0xc4, 0x3b, 0x95, 0xac, 0x89, 0x3b,
+  0x0a, 0x7f, 0x3c, 0x3b, 0x25, 0xfe, 0x13, 0x3b, 0x2f, 0x6d, 0x0a, 0x3c,
+  0xe0, 0xc5, 0x97, 0x3b, 0xbf, 0xac, 0xb3, 0x3a, 0x26, 0xb8, 0x13, 0x3b,
+  0xc2, 0xde, 0x78, 0x3b, 0x65, 0x31, 0x39, 0x3b, 0x24, 0xc0, 0x87, 0x3b,
+  0x74, 0x4b, 0xfc, 0x3a, 0xf1, 0xad, 0x59, 0x3b, 0xf6, 0x18, 0xc0, 0x3b,
+  0xc9, 0xd5, 0x2a, 0x3b, 0xe3, 0x75, 0xc8, 0x3b, 0x48, 0x90, 0xfe, 0x3a,
+  0x7a, 0x1f, 0x0c, 0x3b, 0x19, 0x1d, 0x54, 0x3b, 0xa3, 0xe6, 0x27, 0x3b,
+  0xca, 0x16, 0x79, 0x3b, 0xca, 0xf6, 0x94, 0x3b, 0xd1, 0x3f, 0xf0, 0x3a,
+  0x23, 0xcf, 0x0a, 0x3b, 0x4f, 0xe7, 0x11, 0x3b, 0x9c, 0xc2, 0x15, 0x3c,
+  0x90, 0x08, 0x30, 0x3b, 0xbc, 0xea, 0xc2, 0x3a, 0x8a, 0x52, 0x35, 0x3c,
+  0x59, 0xa9, 0x85, 0x3b, 0x54, 0x71, 0x09, 0x3c, 0x68, 0x39, 0x24, 0x3b,
+  0x73, 0x6e, 0x66, 0x3b, 0x4a, 0x53, 0x45, 0x3b, 0xa2, 0xbb, 0xe6, 0x3a,
+  0x9f, 0x2e, 0x67, 0x3b, 0x5b, 0x0d, 0x60, 0x3b, 0x1a, 0xed, 0x02, 0x3b,
+  0xc4, 0x63, 0xf3, 0x3b, 0x03, 0x97, 0x17, 0x3c, 0x97, 0xfa, 0x2e, 0x3b,
+  0x81, 0x98, 0xca, 0x3b, 0x8f, 0x35, 0x32, 0x3b, 0xc2, 0xc3, 0x2e, 0x3b,
+  0x92, 0x9a, 0x2f, 0x3b, 0x51, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e,
+  0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e,
+  0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
+  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x52, 0xbf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x90, 0x02, 0x00, 0x00, 0x3c, 0xbf, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3382,32 +3498,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0xbf, 0xc1, 0xb3, 0x38, 0x2d, 0x75, 0x98, 0x38, 0x06, 0x68, 0x6b, 0x38,
-  0x3f, 0x11, 0x14, 0x39, 0x32, 0x52, 0xcf, 0x38, 0x35, 0xed, 0x8d, 0x38,
-  0x14, 0xdc, 0x5e, 0x38, 0x3b, 0x74, 0x50, 0x39, 0x5e, 0x8d, 0xe4, 0x38,
-  0xd8, 0x48, 0x07, 0x38, 0xac, 0x72, 0x5e, 0x38, 0x74, 0x62, 0xbb, 0x38,
-  0x7c, 0x70, 0x8b, 0x38, 0xa3, 0x6c, 0xcc, 0x38, 0x8e, 0xf6, 0x3d, 0x38,
-  0x5b, 0xe6, 0xa3, 0x38, 0x5c, 0xa3, 0x10, 0x39, 0xf8, 0xa0, 0x80, 0x38,
-  0x5a, 0xef, 0x16, 0x39, 0xe2, 0xab, 0x3f, 0x38, 0x39, 0x02, 0x53, 0x38,
-  0x88, 0xb5, 0x9f, 0x38, 0xcc, 0xd6, 0x7c, 0x38, 0xa4, 0x8c, 0xbb, 0x38,
-  0x82, 0x52, 0xe0, 0x38, 0xc2, 0xe4, 0x34, 0x38, 0xbd, 0x07, 0x51, 0x38,
-  0xad, 0xb6, 0x5b, 0x38, 0x70, 0x85, 0x61, 0x39, 0xf7, 0x8a, 0x84, 0x38,
-  0xd0, 0xc2, 0x12, 0x38, 0x6e, 0x86, 0x88, 0x39, 0x4d, 0x47, 0xc9, 0x38,
-  0xf7, 0xf8, 0x4e, 0x39, 0x6a, 0x4d, 0x77, 0x38, 0x57, 0x80, 0xad, 0x38,
-  0x0b, 0x93, 0x94, 0x38, 0x74, 0xba, 0x2d, 0x38, 0x09, 0x11, 0xae, 0x38,
-  0xb7, 0xb2, 0xa8, 0x38, 0xd0, 0x28, 0x45, 0x38, 0x15, 0x42, 0x37, 0x39,
-  0xcc, 0x46, 0x64, 0x39, 0xb1, 0xbf, 0x83, 0x38, 0xec, 0x8a, 0x18, 0x39,
-  0x5a, 0x2e, 0x86, 0x38, 0x68, 0x96, 0x83, 0x38, 0x26, 0x38, 0x84, 0x38,
-  0x2d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
-  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
-  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
-  0x02, 0xc2, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xe4, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xfc, 0x00, 0x00, 0x00, 0xec, 0xc1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3418,20 +3508,32 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xd4, 0xec, 0x91, 0x3b,
-  0xd1, 0xfe, 0xc0, 0x3b, 0x37, 0x94, 0xb9, 0x3b, 0x7c, 0x5e, 0xd6, 0x3b,
-  0x2b, 0xe5, 0x5a, 0x3b, 0x37, 0xc0, 0x9d, 0x3b, 0xb0, 0x79, 0x7d, 0x3b,
-  0x4f, 0xe1, 0xbf, 0x3b, 0xae, 0x6f, 0x6f, 0x3b, 0x81, 0x81, 0x68, 0x3b,
-  0x6e, 0x2b, 0xb8, 0x3b, 0x4e, 0xdc, 0x7b, 0x3b, 0x16, 0xd8, 0x8b, 0x3b,
-  0xe1, 0x92, 0x68, 0x3b, 0x82, 0x19, 0xa0, 0x3b, 0x2a, 0x3d, 0x8b, 0x3b,
-  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
-  0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x2a, 0xc3, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xbf, 0xc1, 0xb3, 0x38,
+  0x2d, 0x75, 0x98, 0x38, 0x06, 0x68, 0x6b, 0x38, 0x3f, 0x11, 0x14, 0x39,
+  0x32, 0x52, 0xcf, 0x38, 0x35, 0xed, 0x8d, 0x38, 0x14, 0xdc, 0x5e, 0x38,
+  0x3b, 0x74, 0x50, 0x39, 0x5e, 0x8d, 0xe4, 0x38, 0xd8, 0x48, 0x07, 0x38,
+  0xac, 0x72, 0x5e, 0x38, 0x74, 0x62, 0xbb, 0x38, 0x7c, 0x70, 0x8b, 0x38,
+  0xa3, 0x6c, 0xcc, 0x38, 0x8e, 0xf6, 0x3d, 0x38, 0x5b, 0xe6, 0xa3, 0x38,
+  0x5c, 0xa3, 0x10, 0x39, 0xf8, 0xa0, 0x80, 0x38, 0x5a, 0xef, 0x16, 0x39,
+  0xe2, 0xab, 0x3f, 0x38, 0x39, 0x02, 0x53, 0x38, 0x88, 0xb5, 0x9f, 0x38,
+  0xcc, 0xd6, 0x7c, 0x38, 0xa4, 0x8c, 0xbb, 0x38, 0x82, 0x52, 0xe0, 0x38,
+  0xc2, 0xe4, 0x34, 0x38, 0xbd, 0x07, 0x51, 0x38, 0xad, 0xb6, 0x5b, 0x38,
+  0x70, 0x85, 0x61, 0x39, 0xf7, 0x8a, 0x84, 0x38, 0xd0, 0xc2, 0x12, 0x38,
+  0x6e, 0x86, 0x88, 0x39, 0x4d, 0x47, 0xc9, 0x38, 0xf7, 0xf8, 0x4e, 0x39,
+  0x6a, 0x4d, 0x77, 0x38, 0x57, 0x80, 0xad, 0x38, 0x0b, 0x93, 0x94, 0x38,
+  0x74, 0xba, 0x2d, 0x38, 0x09, 0x11, 0xae, 0x38, 0xb7, 0xb2, 0xa8, 0x38,
+  0xd0, 0x28, 0x45, 0x38, 0x15, 0x42, 0x37, 0x39, 0xcc, 0x46, 0x64, 0x39,
+  0xb1, 0xbf, 0x83, 0x38, 0xec, 0x8a, 0x18, 0x39, 0x5a, 0x2e, 0x86, 0x38,
+  0x68, 0x96, 0x83, 0x38, 0x26, 0x38, 0x84, 0x38, 0x2d, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x33, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
+  0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
+  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x02, 0xc2, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x01, 0x00, 0x00,
-  0x14, 0xc3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfc, 0x00, 0x00, 0x00,
+  0xec, 0xc1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
   0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3443,22 +3545,20 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0xfd, 0xbe, 0xdb, 0x38, 0x6d, 0x50, 0x11, 0x39,
-  0xe4, 0xba, 0x0b, 0x39, 0x45, 0x68, 0x21, 0x39, 0xb1, 0xd0, 0xa4, 0x38,
-  0xe1, 0x8d, 0xed, 0x38, 0x1e, 0xda, 0xbe, 0x38, 0x75, 0x79, 0x10, 0x39,
-  0x0b, 0x48, 0xb4, 0x38, 0x31, 0x10, 0xaf, 0x38, 0x3e, 0xab, 0x0a, 0x39,
-  0xde, 0xa2, 0xbd, 0x38, 0xb8, 0x96, 0xd2, 0x38, 0x46, 0x1d, 0xaf, 0x38,
-  0x5b, 0x17, 0xf1, 0x38, 0x6d, 0xad, 0xd1, 0x38, 0x2b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xd4, 0xec, 0x91, 0x3b, 0xd1, 0xfe, 0xc0, 0x3b,
+  0x37, 0x94, 0xb9, 0x3b, 0x7c, 0x5e, 0xd6, 0x3b, 0x2b, 0xe5, 0x5a, 0x3b,
+  0x37, 0xc0, 0x9d, 0x3b, 0xb0, 0x79, 0x7d, 0x3b, 0x4f, 0xe1, 0xbf, 0x3b,
+  0xae, 0x6f, 0x6f, 0x3b, 0x81, 0x81, 0x68, 0x3b, 0x6e, 0x2b, 0xb8, 0x3b,
+  0x4e, 0xdc, 0x7b, 0x3b, 0x16, 0xd8, 0x8b, 0x3b, 0xe1, 0x92, 0x68, 0x3b,
+  0x82, 0x19, 0xa0, 0x3b, 0x2a, 0x3d, 0x8b, 0x3b, 0x1e, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x33, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
-  0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x52, 0xc4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xbc, 0x04, 0x00, 0x00, 0x3c, 0xc4, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x5f, 0x33, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x30, 0x00, 0x00, 0x00, 0x2a, 0xc3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x08, 0x01, 0x00, 0x00, 0x14, 0xc3, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3469,6 +3569,21 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xfd, 0xbe, 0xdb, 0x38, 0x6d, 0x50, 0x11, 0x39, 0xe4, 0xba, 0x0b, 0x39,
+  0x45, 0x68, 0x21, 0x39, 0xb1, 0xd0, 0xa4, 0x38, 0xe1, 0x8d, 0xed, 0x38,
+  0x1e, 0xda, 0xbe, 0x38, 0x75, 0x79, 0x10, 0x39, 0x0b, 0x48, 0xb4, 0x38,
+  0x31, 0x10, 0xaf, 0x38, 0x3e, 0xab, 0x0a, 0x39, 0xde, 0xa2, 0xbd, 0x38,
+  0xb8, 0x96, 0xd2, 0x38, 0x46, 0x1d, 0xaf, 0x38, 0x5b, 0x17, 0xf1, 0x38,
+  0x6d, 0xad, 0xd1, 0x38, 0x2b, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x33, 0x5f,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46,
+  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
+  0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x52, 0xc4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0xa4, 0x04, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xbc, 0x04, 0x00, 0x00, 0x3c, 0xc4, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3521,47 +3636,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x86, 0x2c, 0x8e, 0x3b, 0xef, 0x99, 0x27, 0x3b,
-  0xee, 0xe4, 0xb1, 0x3b, 0x67, 0xa7, 0x1c, 0x3b, 0x66, 0x66, 0x16, 0x3b,
-  0xee, 0x31, 0x71, 0x3a, 0xc7, 0x8f, 0x41, 0x3b, 0x8f, 0x14, 0x27, 0x3b,
-  0xd2, 0x77, 0xe7, 0x3a, 0x84, 0xa1, 0x4c, 0x3b, 0x8c, 0x63, 0xb6, 0x3a,
-  0xa8, 0x05, 0xea, 0x3a, 0x52, 0xa6, 0x31, 0x3b, 0x61, 0x0b, 0x07, 0x3c,
-  0x46, 0x6a, 0x6a, 0x3b, 0xf3, 0x56, 0x39, 0x3b, 0x82, 0xd3, 0x85, 0x3b,
-  0xd7, 0x3d, 0x7d, 0x3b, 0xa8, 0x2d, 0x86, 0x3b, 0x81, 0xc8, 0xd4, 0x3a,
-  0x81, 0xe9, 0x0a, 0x3c, 0x21, 0xa6, 0x18, 0x3b, 0xb6, 0x71, 0xff, 0x3a,
-  0x16, 0xb7, 0x48, 0x3b, 0x93, 0xd4, 0xb6, 0x3a, 0x73, 0x51, 0xf8, 0x3a,
-  0x94, 0xd9, 0x78, 0x3b, 0x2d, 0xc9, 0xc7, 0x3b, 0x91, 0x0c, 0x7b, 0x3b,
-  0xc1, 0x39, 0x46, 0x3b, 0xee, 0x0a, 0x6e, 0x3b, 0x00, 0xc0, 0xf0, 0x3a,
-  0x10, 0x46, 0x55, 0x3b, 0xd1, 0x1f, 0x80, 0x3a, 0xe5, 0x05, 0x44, 0x3b,
-  0xea, 0xd9, 0xbc, 0x3a, 0xa8, 0x26, 0x3d, 0x3b, 0x46, 0x81, 0xcd, 0x3b,
-  0x2f, 0x3a, 0x8c, 0x3b, 0x23, 0x89, 0x94, 0x3b, 0xe9, 0xc4, 0x9f, 0x3a,
-  0xeb, 0xe9, 0x74, 0x3b, 0xfa, 0xab, 0x88, 0x3b, 0x77, 0xf3, 0x28, 0x3b,
-  0xee, 0xe3, 0x1a, 0x3b, 0xdb, 0xb8, 0xd5, 0x3a, 0xbc, 0x64, 0x0e, 0x3b,
-  0xd3, 0x53, 0xce, 0x3a, 0x9a, 0x60, 0x32, 0x3b, 0x41, 0xdf, 0x8b, 0x3b,
-  0x62, 0xfa, 0x95, 0x3b, 0x7e, 0x50, 0x6e, 0x3b, 0x2f, 0x7f, 0x6e, 0x3b,
-  0xc3, 0xdc, 0x41, 0x3b, 0xe2, 0x5a, 0xdd, 0x3a, 0xa4, 0xa3, 0xa6, 0x3b,
-  0xb2, 0x2b, 0x7e, 0x3b, 0x35, 0xb7, 0xb6, 0x3a, 0xa2, 0xa7, 0x4f, 0x3b,
-  0x97, 0xab, 0x62, 0x3b, 0xe4, 0x9c, 0x9b, 0x3b, 0xd8, 0xed, 0xb4, 0x3a,
-  0xb9, 0x18, 0x31, 0x3b, 0x58, 0xcb, 0x4a, 0x3b, 0xf3, 0x4f, 0x0d, 0x3b,
-  0x69, 0xb2, 0x9b, 0x3a, 0x1b, 0x99, 0x9a, 0x3b, 0x4e, 0x93, 0x39, 0x3b,
-  0x49, 0x5e, 0xce, 0x3a, 0xdf, 0x3e, 0x29, 0x3b, 0x26, 0x94, 0x80, 0x3b,
-  0x61, 0xf1, 0x4e, 0x3b, 0x6a, 0x79, 0x79, 0x3b, 0xd2, 0x1f, 0x3d, 0x3b,
-  0x59, 0x9f, 0x46, 0x3b, 0x96, 0x7e, 0xa6, 0x3b, 0xff, 0x1e, 0xa5, 0x3b,
-  0xf5, 0x00, 0x05, 0x3b, 0x9d, 0xbe, 0x75, 0x3b, 0x07, 0x30, 0x51, 0x3b,
-  0xcb, 0x5b, 0x4a, 0x3b, 0x12, 0x29, 0x60, 0x3b, 0xcc, 0xd9, 0x2f, 0x3b,
-  0x52, 0x07, 0xac, 0x3a, 0x34, 0x8d, 0x18, 0x3b, 0xe1, 0x5c, 0xe2, 0x3a,
-  0xeb, 0xb5, 0x28, 0x3b, 0xaa, 0x2d, 0xbe, 0x3b, 0x8e, 0xf8, 0x90, 0x3b,
-  0xed, 0x52, 0x74, 0x3b, 0x6b, 0xcb, 0x87, 0x3b, 0xbe, 0xc6, 0xf5, 0x3a,
-  0xcd, 0x57, 0x36, 0x3b, 0x31, 0xc7, 0x82, 0x3b, 0x8b, 0x0a, 0x61, 0x3b,
-  0x48, 0x24, 0x41, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x3a, 0xc9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa8, 0x04, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xcc, 0x04, 0x00, 0x00, 0x24, 0xc9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3573,6 +3647,48 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x86, 0x2c, 0x8e, 0x3b, 0xef, 0x99, 0x27, 0x3b, 0xee, 0xe4, 0xb1, 0x3b,
+  0x67, 0xa7, 0x1c, 0x3b, 0x66, 0x66, 0x16, 0x3b, 0xee, 0x31, 0x71, 0x3a,
+  0xc7, 0x8f, 0x41, 0x3b, 0x8f, 0x14, 0x27, 0x3b, 0xd2, 0x77, 0xe7, 0x3a,
+  0x84, 0xa1, 0x4c, 0x3b, 0x8c, 0x63, 0xb6, 0x3a, 0xa8, 0x05, 0xea, 0x3a,
+  0x52, 0xa6, 0x31, 0x3b, 0x61, 0x0b, 0x07, 0x3c, 0x46, 0x6a, 0x6a, 0x3b,
+  0xf3, 0x56, 0x39, 0x3b, 0x82, 0xd3, 0x85, 0x3b, 0xd7, 0x3d, 0x7d, 0x3b,
+  0xa8, 0x2d, 0x86, 0x3b, 0x81, 0xc8, 0xd4, 0x3a, 0x81, 0xe9, 0x0a, 0x3c,
+  0x21, 0xa6, 0x18, 0x3b, 0xb6, 0x71, 0xff, 0x3a, 0x16, 0xb7, 0x48, 0x3b,
+  0x93, 0xd4, 0xb6, 0x3a, 0x73, 0x51, 0xf8, 0x3a, 0x94, 0xd9, 0x78, 0x3b,
+  0x2d, 0xc9, 0xc7, 0x3b, 0x91, 0x0c, 0x7b, 0x3b, 0xc1, 0x39, 0x46, 0x3b,
+  0xee, 0x0a, 0x6e, 0x3b, 0x00, 0xc0, 0xf0, 0x3a, 0x10, 0x46, 0x55, 0x3b,
+  0xd1, 0x1f, 0x80, 0x3a, 0xe5, 0x05, 0x44, 0x3b, 0xea, 0xd9, 0xbc, 0x3a,
+  0xa8, 0x26, 0x3d, 0x3b, 0x46, 0x81, 0xcd, 0x3b, 0x2f, 0x3a, 0x8c, 0x3b,
+  0x23, 0x89, 0x94, 0x3b, 0xe9, 0xc4, 0x9f, 0x3a, 0xeb, 0xe9, 0x74, 0x3b,
+  0xfa, 0xab, 0x88, 0x3b, 0x77, 0xf3, 0x28, 0x3b, 0xee, 0xe3, 0x1a, 0x3b,
+  0xdb, 0xb8, 0xd5, 0x3a, 0xbc, 0x64, 0x0e, 0x3b, 0xd3, 0x53, 0xce, 0x3a,
+  0x9a, 0x60, 0x32, 0x3b, 0x41, 0xdf, 0x8b, 0x3b, 0x62, 0xfa, 0x95, 0x3b,
+  0x7e, 0x50, 0x6e, 0x3b, 0x2f, 0x7f, 0x6e, 0x3b, 0xc3, 0xdc, 0x41, 0x3b,
+  0xe2, 0x5a, 0xdd, 0x3a, 0xa4, 0xa3, 0xa6, 0x3b, 0xb2, 0x2b, 0x7e, 0x3b,
+  0x35, 0xb7, 0xb6, 0x3a, 0xa2, 0xa7, 0x4f, 0x3b, 0x97, 0xab, 0x62, 0x3b,
+  0xe4, 0x9c, 0x9b, 0x3b, 0xd8, 0xed, 0xb4, 0x3a, 0xb9, 0x18, 0x31, 0x3b,
+  0x58, 0xcb, 0x4a, 0x3b, 0xf3, 0x4f, 0x0d, 0x3b, 0x69, 0xb2, 0x9b, 0x3a,
+  0x1b, 0x99, 0x9a, 0x3b, 0x4e, 0x93, 0x39, 0x3b, 0x49, 0x5e, 0xce, 0x3a,
+  0xdf, 0x3e, 0x29, 0x3b, 0x26, 0x94, 0x80, 0x3b, 0x61, 0xf1, 0x4e, 0x3b,
+  0x6a, 0x79, 0x79, 0x3b, 0xd2, 0x1f, 0x3d, 0x3b, 0x59, 0x9f, 0x46, 0x3b,
+  0x96, 0x7e, 0xa6, 0x3b, 0xff, 0x1e, 0xa5, 0x3b, 0xf5, 0x00, 0x05, 0x3b,
+  0x9d, 0xbe, 0x75, 0x3b, 0x07, 0x30, 0x51, 0x3b, 0xcb, 0x5b, 0x4a, 0x3b,
+  0x12, 0x29, 0x60, 0x3b, 0xcc, 0xd9, 0x2f, 0x3b, 0x52, 0x07, 0xac, 0x3a,
+  0x34, 0x8d, 0x18, 0x3b, 0xe1, 0x5c, 0xe2, 0x3a, 0xeb, 0xb5, 0x28, 0x3b,
+  0xaa, 0x2d, 0xbe, 0x3b, 0x8e, 0xf8, 0x90, 0x3b, 0xed, 0x52, 0x74, 0x3b,
+  0x6b, 0xcb, 0x87, 0x3b, 0xbe, 0xc6, 0xf5, 0x3a, 0xcd, 0x57, 0x36, 0x3b,
+  0x31, 0xc7, 0x82, 0x3b, 0x8b, 0x0a, 0x61, 0x3b, 0x48, 0x24, 0x41, 0x3b,
+  0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x65, 0x78, 0x70, 0x61,
+  0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x3a, 0xc9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcc, 0x04, 0x00, 0x00,
+  0x24, 0xc9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3626,47 +3742,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x55, 0x74, 0x85, 0x39, 0x85, 0x52, 0x1d, 0x39,
-  0xe9, 0xfb, 0xa6, 0x39, 0xde, 0x0b, 0x13, 0x39, 0x0d, 0x2d, 0x0d, 0x39,
-  0x10, 0x67, 0x62, 0x38, 0xc6, 0xb0, 0x35, 0x39, 0x53, 0xd5, 0x1c, 0x39,
-  0xac, 0x45, 0xd9, 0x38, 0xb8, 0x14, 0x40, 0x39, 0xf6, 0x33, 0xab, 0x38,
-  0x68, 0xab, 0xdb, 0x38, 0x24, 0xc1, 0x26, 0x39, 0x3e, 0x86, 0xfd, 0x39,
-  0xda, 0x09, 0x5c, 0x39, 0x09, 0xf9, 0x2d, 0x39, 0xc1, 0x3c, 0x7b, 0x39,
-  0xd6, 0xb5, 0x6d, 0x39, 0xff, 0xe5, 0x7b, 0x39, 0xb7, 0xbb, 0xc7, 0x38,
-  0x86, 0x64, 0x02, 0x3a, 0x79, 0x49, 0x0f, 0x39, 0x20, 0xc7, 0xef, 0x38,
-  0xc5, 0x67, 0x3c, 0x39, 0x0f, 0x9e, 0xab, 0x38, 0xbf, 0x16, 0xe9, 0x38,
-  0x86, 0x96, 0x69, 0x39, 0x73, 0x88, 0xbb, 0x39, 0xfc, 0xa6, 0x6b, 0x39,
-  0x86, 0x11, 0x3a, 0x39, 0x8e, 0x71, 0x5f, 0x39, 0x1f, 0xfc, 0xe1, 0x38,
-  0x92, 0x31, 0x48, 0x39, 0x6b, 0x88, 0x70, 0x38, 0x3f, 0x00, 0x38, 0x39,
-  0xde, 0x44, 0xb1, 0x38, 0xe7, 0x8c, 0x31, 0x39, 0xc1, 0xe6, 0xc0, 0x39,
-  0x8e, 0xa0, 0x83, 0x39, 0x10, 0x6d, 0x8b, 0x39, 0x77, 0xf8, 0x95, 0x38,
-  0xaa, 0xe4, 0x65, 0x39, 0x2b, 0x4a, 0x80, 0x39, 0xdc, 0x96, 0x1e, 0x39,
-  0x15, 0x64, 0x11, 0x39, 0x53, 0x9d, 0xc8, 0x38, 0x18, 0xa9, 0x05, 0x39,
-  0x65, 0xac, 0xc1, 0x38, 0x00, 0x70, 0x27, 0x39, 0x33, 0x4b, 0x83, 0x39,
-  0xa9, 0xc7, 0x8c, 0x39, 0xda, 0xb2, 0x5f, 0x39, 0xae, 0xde, 0x5f, 0x39,
-  0x0a, 0xf9, 0x35, 0x39, 0x83, 0xc7, 0xcf, 0x38, 0x55, 0x6b, 0x9c, 0x39,
-  0x1b, 0x95, 0x6e, 0x39, 0x7e, 0x82, 0xab, 0x38, 0x5c, 0xeb, 0x42, 0x39,
-  0xc4, 0xc4, 0x54, 0x39, 0xb3, 0x11, 0x92, 0x39, 0x2d, 0xd5, 0xa9, 0x38,
-  0x3b, 0x3c, 0x26, 0x39, 0x62, 0x5b, 0x3e, 0x39, 0x49, 0xa5, 0x04, 0x39,
-  0xe6, 0x25, 0x92, 0x38, 0xd9, 0x1d, 0x91, 0x39, 0xb0, 0x31, 0x2e, 0x39,
-  0x36, 0xb6, 0xc1, 0x38, 0xa4, 0xdd, 0x1e, 0x39, 0xd0, 0x62, 0x71, 0x39,
-  0x49, 0x40, 0x42, 0x39, 0x8f, 0x2c, 0x6a, 0x39, 0x7c, 0x86, 0x31, 0x39,
-  0xe3, 0x70, 0x3a, 0x39, 0x8d, 0x48, 0x9c, 0x39, 0x86, 0xfe, 0x9a, 0x39,
-  0x7b, 0xb1, 0xf9, 0x38, 0x51, 0xac, 0x66, 0x39, 0xb1, 0x5b, 0x44, 0x39,
-  0xad, 0xf2, 0x3d, 0x39, 0xa7, 0x69, 0x52, 0x39, 0xdd, 0x10, 0x25, 0x39,
-  0x65, 0x7a, 0xa1, 0x38, 0x14, 0x32, 0x0f, 0x39, 0xe2, 0x7a, 0xd4, 0x38,
-  0x16, 0x5d, 0x1e, 0x39, 0xc8, 0x83, 0xb2, 0x39, 0x73, 0x14, 0x88, 0x39,
-  0xef, 0x56, 0x65, 0x39, 0xc4, 0xee, 0x7e, 0x39, 0xf2, 0xb3, 0xe6, 0x38,
-  0xf0, 0x28, 0x2b, 0x39, 0xd6, 0x83, 0x75, 0x39, 0x4c, 0x3d, 0x53, 0x39,
-  0xdf, 0x4b, 0x35, 0x39, 0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75,
-  0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
-  0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x26, 0xce, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa8, 0x04, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x10, 0x05, 0x00, 0x00, 0xb2, 0xe9, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3677,6 +3752,48 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x55, 0x74, 0x85, 0x39, 0x85, 0x52, 0x1d, 0x39, 0xe9, 0xfb, 0xa6, 0x39,
+  0xde, 0x0b, 0x13, 0x39, 0x0d, 0x2d, 0x0d, 0x39, 0x10, 0x67, 0x62, 0x38,
+  0xc6, 0xb0, 0x35, 0x39, 0x53, 0xd5, 0x1c, 0x39, 0xac, 0x45, 0xd9, 0x38,
+  0xb8, 0x14, 0x40, 0x39, 0xf6, 0x33, 0xab, 0x38, 0x68, 0xab, 0xdb, 0x38,
+  0x24, 0xc1, 0x26, 0x39, 0x3e, 0x86, 0xfd, 0x39, 0xda, 0x09, 0x5c, 0x39,
+  0x09, 0xf9, 0x2d, 0x39, 0xc1, 0x3c, 0x7b, 0x39, 0xd6, 0xb5, 0x6d, 0x39,
+  0xff, 0xe5, 0x7b, 0x39, 0xb7, 0xbb, 0xc7, 0x38, 0x86, 0x64, 0x02, 0x3a,
+  0x79, 0x49, 0x0f, 0x39, 0x20, 0xc7, 0xef, 0x38, 0xc5, 0x67, 0x3c, 0x39,
+  0x0f, 0x9e, 0xab, 0x38, 0xbf, 0x16, 0xe9, 0x38, 0x86, 0x96, 0x69, 0x39,
+  0x73, 0x88, 0xbb, 0x39, 0xfc, 0xa6, 0x6b, 0x39, 0x86, 0x11, 0x3a, 0x39,
+  0x8e, 0x71, 0x5f, 0x39, 0x1f, 0xfc, 0xe1, 0x38, 0x92, 0x31, 0x48, 0x39,
+  0x6b, 0x88, 0x70, 0x38, 0x3f, 0x00, 0x38, 0x39, 0xde, 0x44, 0xb1, 0x38,
+  0xe7, 0x8c, 0x31, 0x39, 0xc1, 0xe6, 0xc0, 0x39, 0x8e, 0xa0, 0x83, 0x39,
+  0x10, 0x6d, 0x8b, 0x39, 0x77, 0xf8, 0x95, 0x38, 0xaa, 0xe4, 0x65, 0x39,
+  0x2b, 0x4a, 0x80, 0x39, 0xdc, 0x96, 0x1e, 0x39, 0x15, 0x64, 0x11, 0x39,
+  0x53, 0x9d, 0xc8, 0x38, 0x18, 0xa9, 0x05, 0x39, 0x65, 0xac, 0xc1, 0x38,
+  0x00, 0x70, 0x27, 0x39, 0x33, 0x4b, 0x83, 0x39, 0xa9, 0xc7, 0x8c, 0x39,
+  0xda, 0xb2, 0x5f, 0x39, 0xae, 0xde, 0x5f, 0x39, 0x0a, 0xf9, 0x35, 0x39,
+  0x83, 0xc7, 0xcf, 0x38, 0x55, 0x6b, 0x9c, 0x39, 0x1b, 0x95, 0x6e, 0x39,
+  0x7e, 0x82, 0xab, 0x38, 0x5c, 0xeb, 0x42, 0x39, 0xc4, 0xc4, 0x54, 0x39,
+  0xb3, 0x11, 0x92, 0x39, 0x2d, 0xd5, 0xa9, 0x38, 0x3b, 0x3c, 0x26, 0x39,
+  0x62, 0x5b, 0x3e, 0x39, 0x49, 0xa5, 0x04, 0x39, 0xe6, 0x25, 0x92, 0x38,
+  0xd9, 0x1d, 0x91, 0x39, 0xb0, 0x31, 0x2e, 0x39, 0x36, 0xb6, 0xc1, 0x38,
+  0xa4, 0xdd, 0x1e, 0x39, 0xd0, 0x62, 0x71, 0x39, 0x49, 0x40, 0x42, 0x39,
+  0x8f, 0x2c, 0x6a, 0x39, 0x7c, 0x86, 0x31, 0x39, 0xe3, 0x70, 0x3a, 0x39,
+  0x8d, 0x48, 0x9c, 0x39, 0x86, 0xfe, 0x9a, 0x39, 0x7b, 0xb1, 0xf9, 0x38,
+  0x51, 0xac, 0x66, 0x39, 0xb1, 0x5b, 0x44, 0x39, 0xad, 0xf2, 0x3d, 0x39,
+  0xa7, 0x69, 0x52, 0x39, 0xdd, 0x10, 0x25, 0x39, 0x65, 0x7a, 0xa1, 0x38,
+  0x14, 0x32, 0x0f, 0x39, 0xe2, 0x7a, 0xd4, 0x38, 0x16, 0x5d, 0x1e, 0x39,
+  0xc8, 0x83, 0xb2, 0x39, 0x73, 0x14, 0x88, 0x39, 0xef, 0x56, 0x65, 0x39,
+  0xc4, 0xee, 0x7e, 0x39, 0xf2, 0xb3, 0xe6, 0x38, 0xf0, 0x28, 0x2b, 0x39,
+  0xd6, 0x83, 0x75, 0x39, 0x4c, 0x3d, 0x53, 0x39, 0xdf, 0x4b, 0x35, 0x39,
+  0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x65, 0x78, 0x70, 0x61,
+  0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42,
+  0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x26, 0xce, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00,
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x05, 0x00, 0x00,
+  0xb2, 0xe9, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3731,54 +3848,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0xc4, 0x44, 0xfa, 0x3b, 0x23, 0xcb, 0x3b, 0x3c,
-  0x3b, 0xe6, 0xa6, 0x3b, 0xe6, 0x27, 0x87, 0x3b, 0x33, 0x15, 0x5d, 0x3c,
-  0x0a, 0x50, 0xe5, 0x3c, 0xb4, 0x5b, 0x10, 0x3c, 0xac, 0xd7, 0x28, 0x3c,
-  0x27, 0x05, 0x28, 0x3c, 0xec, 0x81, 0x9f, 0x3b, 0xd3, 0xb7, 0x52, 0x3c,
-  0x4b, 0x07, 0x0b, 0x3c, 0x4e, 0x2c, 0xb0, 0x3b, 0x93, 0x9d, 0x2f, 0x3b,
-  0x9a, 0x24, 0xf2, 0x3b, 0x09, 0x02, 0xbc, 0x3b, 0xe2, 0xc7, 0x35, 0x3c,
-  0x24, 0x0f, 0x26, 0x3c, 0xc5, 0x1a, 0x00, 0x3c, 0xaa, 0xd8, 0x8c, 0x3c,
-  0x39, 0x25, 0xc3, 0x3b, 0xdf, 0x14, 0xd4, 0x3b, 0xd5, 0x58, 0x0e, 0x3c,
-  0xab, 0x32, 0xcb, 0x3b, 0x24, 0xc8, 0x09, 0x3e, 0xf9, 0x75, 0xeb, 0x3b,
-  0xdc, 0x2e, 0x08, 0x3c, 0x37, 0xd8, 0xae, 0x3b, 0xdb, 0x13, 0x1f, 0x3c,
-  0x6d, 0x99, 0xd8, 0x3b, 0x47, 0xc2, 0xa5, 0x3b, 0xa9, 0x96, 0xaa, 0x3c,
-  0xd0, 0xf2, 0x4b, 0x3b, 0x79, 0xcf, 0xc3, 0x3c, 0xa2, 0xe4, 0xa0, 0x3b,
-  0x3a, 0x94, 0x1c, 0x3c, 0x0b, 0x81, 0x79, 0x3c, 0xb7, 0x25, 0xac, 0x3b,
-  0x98, 0x4c, 0x23, 0x3c, 0x99, 0x50, 0x7f, 0x3b, 0x05, 0xdd, 0xae, 0x3c,
-  0x1d, 0x18, 0xd5, 0x3b, 0x84, 0xdc, 0xe5, 0x3b, 0xd2, 0x06, 0x62, 0x3b,
-  0xa5, 0xd7, 0x41, 0x3c, 0xf7, 0x6e, 0x4c, 0x3c, 0xaa, 0x2a, 0x12, 0x3c,
-  0xa2, 0xb6, 0x1d, 0x3c, 0xed, 0xca, 0x64, 0x3b, 0x71, 0x4f, 0x89, 0x3c,
-  0xd8, 0xa6, 0x9d, 0x3b, 0x24, 0x64, 0x33, 0x3c, 0xe1, 0x1e, 0xb7, 0x3b,
-  0x03, 0x68, 0x7c, 0x3b, 0x03, 0x56, 0x3d, 0x3c, 0x8f, 0x02, 0x19, 0x3c,
-  0xa9, 0x56, 0x9f, 0x3b, 0x44, 0x0e, 0x52, 0x3c, 0x6b, 0xe7, 0xc5, 0x3c,
-  0x11, 0x6c, 0x36, 0x3c, 0x2f, 0x23, 0x4c, 0x3c, 0x37, 0x16, 0x6a, 0x3c,
-  0x9a, 0x09, 0xd2, 0x3b, 0x65, 0x3e, 0x9f, 0x3b, 0x0f, 0xad, 0x93, 0x3b,
-  0x29, 0x45, 0xb4, 0x3c, 0x06, 0xad, 0x5b, 0x3b, 0x3f, 0x8f, 0x9a, 0x3b,
-  0x5b, 0x77, 0x66, 0x3c, 0x1d, 0xd4, 0x98, 0x3c, 0x9f, 0x90, 0xd2, 0x3b,
-  0xcd, 0xa0, 0x12, 0x3c, 0x8b, 0x7d, 0xb1, 0x3c, 0x86, 0x46, 0xef, 0x3b,
-  0xb1, 0x19, 0x4c, 0x3c, 0xb3, 0xc1, 0xd6, 0x3b, 0xb5, 0x85, 0xc0, 0x3b,
-  0x68, 0x3e, 0xc5, 0x3b, 0xcb, 0x47, 0x83, 0x3b, 0x8d, 0xf2, 0xc5, 0x3b,
-  0xab, 0x77, 0xda, 0x3b, 0x8f, 0xdd, 0x1d, 0x3c, 0xbc, 0xaa, 0x7e, 0x3b,
-  0xbb, 0xb3, 0xec, 0x3b, 0x33, 0x86, 0x6c, 0x3b, 0x54, 0xdf, 0xe6, 0x3b,
-  0x24, 0x4b, 0xbb, 0x3b, 0xe6, 0xf9, 0xf2, 0x3b, 0x9f, 0x89, 0x07, 0x3c,
-  0xcd, 0xab, 0x2b, 0x3c, 0xf8, 0x25, 0xbb, 0x3b, 0xc4, 0x68, 0x2a, 0x3c,
-  0x9b, 0x19, 0x5f, 0x3c, 0x4a, 0x76, 0xfd, 0x3b, 0x7a, 0x76, 0x51, 0x3b,
-  0x27, 0xb5, 0x49, 0x3c, 0x6f, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e,
-  0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e,
-  0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
-  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
-  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78,
-  0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x62, 0xd3, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00,
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd0, 0x04, 0x00, 0x00,
-  0x4c, 0xd3, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3788,6 +3857,54 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xc4, 0x44, 0xfa, 0x3b, 0x23, 0xcb, 0x3b, 0x3c, 0x3b, 0xe6, 0xa6, 0x3b,
+  0xe6, 0x27, 0x87, 0x3b, 0x33, 0x15, 0x5d, 0x3c, 0x0a, 0x50, 0xe5, 0x3c,
+  0xb4, 0x5b, 0x10, 0x3c, 0xac, 0xd7, 0x28, 0x3c, 0x27, 0x05, 0x28, 0x3c,
+  0xec, 0x81, 0x9f, 0x3b, 0xd3, 0xb7, 0x52, 0x3c, 0x4b, 0x07, 0x0b, 0x3c,
+  0x4e, 0x2c, 0xb0, 0x3b, 0x93, 0x9d, 0x2f, 0x3b, 0x9a, 0x24, 0xf2, 0x3b,
+  0x09, 0x02, 0xbc, 0x3b, 0xe2, 0xc7, 0x35, 0x3c, 0x24, 0x0f, 0x26, 0x3c,
+  0xc5, 0x1a, 0x00, 0x3c, 0xaa, 0xd8, 0x8c, 0x3c, 0x39, 0x25, 0xc3, 0x3b,
+  0xdf, 0x14, 0xd4, 0x3b, 0xd5, 0x58, 0x0e, 0x3c, 0xab, 0x32, 0xcb, 0x3b,
+  0x24, 0xc8, 0x09, 0x3e, 0xf9, 0x75, 0xeb, 0x3b, 0xdc, 0x2e, 0x08, 0x3c,
+  0x37, 0xd8, 0xae, 0x3b, 0xdb, 0x13, 0x1f, 0x3c, 0x6d, 0x99, 0xd8, 0x3b,
+  0x47, 0xc2, 0xa5, 0x3b, 0xa9, 0x96, 0xaa, 0x3c, 0xd0, 0xf2, 0x4b, 0x3b,
+  0x79, 0xcf, 0xc3, 0x3c, 0xa2, 0xe4, 0xa0, 0x3b, 0x3a, 0x94, 0x1c, 0x3c,
+  0x0b, 0x81, 0x79, 0x3c, 0xb7, 0x25, 0xac, 0x3b, 0x98, 0x4c, 0x23, 0x3c,
+  0x99, 0x50, 0x7f, 0x3b, 0x05, 0xdd, 0xae, 0x3c, 0x1d, 0x18, 0xd5, 0x3b,
+  0x84, 0xdc, 0xe5, 0x3b, 0xd2, 0x06, 0x62, 0x3b, 0xa5, 0xd7, 0x41, 0x3c,
+  0xf7, 0x6e, 0x4c, 0x3c, 0xaa, 0x2a, 0x12, 0x3c, 0xa2, 0xb6, 0x1d, 0x3c,
+  0xed, 0xca, 0x64, 0x3b, 0x71, 0x4f, 0x89, 0x3c, 0xd8, 0xa6, 0x9d, 0x3b,
+  0x24, 0x64, 0x33, 0x3c, 0xe1, 0x1e, 0xb7, 0x3b, 0x03, 0x68, 0x7c, 0x3b,
+  0x03, 0x56, 0x3d, 0x3c, 0x8f, 0x02, 0x19, 0x3c, 0xa9, 0x56, 0x9f, 0x3b,
+  0x44, 0x0e, 0x52, 0x3c, 0x6b, 0xe7, 0xc5, 0x3c, 0x11, 0x6c, 0x36, 0x3c,
+  0x2f, 0x23, 0x4c, 0x3c, 0x37, 0x16, 0x6a, 0x3c, 0x9a, 0x09, 0xd2, 0x3b,
+  0x65, 0x3e, 0x9f, 0x3b, 0x0f, 0xad, 0x93, 0x3b, 0x29, 0x45, 0xb4, 0x3c,
+  0x06, 0xad, 0x5b, 0x3b, 0x3f, 0x8f, 0x9a, 0x3b, 0x5b, 0x77, 0x66, 0x3c,
+  0x1d, 0xd4, 0x98, 0x3c, 0x9f, 0x90, 0xd2, 0x3b, 0xcd, 0xa0, 0x12, 0x3c,
+  0x8b, 0x7d, 0xb1, 0x3c, 0x86, 0x46, 0xef, 0x3b, 0xb1, 0x19, 0x4c, 0x3c,
+  0xb3, 0xc1, 0xd6, 0x3b, 0xb5, 0x85, 0xc0, 0x3b, 0x68, 0x3e, 0xc5, 0x3b,
+  0xcb, 0x47, 0x83, 0x3b, 0x8d, 0xf2, 0xc5, 0x3b, 0xab, 0x77, 0xda, 0x3b,
+  0x8f, 0xdd, 0x1d, 0x3c, 0xbc, 0xaa, 0x7e, 0x3b, 0xbb, 0xb3, 0xec, 0x3b,
+  0x33, 0x86, 0x6c, 0x3b, 0x54, 0xdf, 0xe6, 0x3b, 0x24, 0x4b, 0xbb, 0x3b,
+  0xe6, 0xf9, 0xf2, 0x3b, 0x9f, 0x89, 0x07, 0x3c, 0xcd, 0xab, 0x2b, 0x3c,
+  0xf8, 0x25, 0xbb, 0x3b, 0xc4, 0x68, 0x2a, 0x3c, 0x9b, 0x19, 0x5f, 0x3c,
+  0x4a, 0x76, 0xfd, 0x3b, 0x7a, 0x76, 0x51, 0x3b, 0x27, 0xb5, 0x49, 0x3c,
+  0x6f, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
+  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
+  0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77,
+  0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
+  0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c,
+  0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64,
+  0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x62, 0xd3, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xd0, 0x04, 0x00, 0x00, 0x4c, 0xd3, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3842,48 +3959,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x03, 0x70, 0x3c, 0x39, 0xc0, 0x65, 0x8d, 0x39, 0xad, 0x54, 0xfb, 0x38,
-  0x61, 0x87, 0xcb, 0x38, 0x5d, 0x76, 0xa6, 0x39, 0xb0, 0xa8, 0x2c, 0x3a,
-  0xf1, 0x62, 0x59, 0x39, 0xc4, 0x41, 0x7e, 0x39, 0xc0, 0x04, 0x7d, 0x39,
-  0x15, 0x33, 0xf0, 0x38, 0x87, 0xa8, 0x9e, 0x39, 0x4d, 0x5c, 0x51, 0x39,
-  0xe1, 0xa5, 0x04, 0x39, 0x69, 0x3a, 0x84, 0x38, 0xc6, 0x51, 0x36, 0x39,
-  0x16, 0x8f, 0x0d, 0x39, 0xc8, 0xde, 0x88, 0x39, 0xc7, 0x10, 0x7a, 0x39,
-  0x11, 0xe9, 0x40, 0x39, 0x18, 0x19, 0xd4, 0x39, 0xda, 0xee, 0x12, 0x39,
-  0x57, 0xaf, 0x1f, 0x39, 0x9b, 0x5b, 0x56, 0x39, 0xff, 0xfe, 0x18, 0x39,
-  0xb2, 0x7b, 0x4f, 0x3b, 0xc5, 0x49, 0x31, 0x39, 0x5e, 0x13, 0x4d, 0x39,
-  0xcf, 0xa5, 0x03, 0x39, 0x56, 0x8d, 0x6f, 0x39, 0x28, 0x16, 0x23, 0x39,
-  0x08, 0x9d, 0xf9, 0x38, 0x70, 0x71, 0x00, 0x3a, 0xac, 0x8f, 0x99, 0x38,
-  0x0a, 0x6f, 0x13, 0x3a, 0x3d, 0x49, 0xf2, 0x38, 0x21, 0xca, 0x6b, 0x39,
-  0xa5, 0xdc, 0xbb, 0x39, 0xe7, 0x9d, 0x01, 0x39, 0xcd, 0xe8, 0x75, 0x39,
-  0xb0, 0x3c, 0xc0, 0x38, 0x6d, 0xa9, 0x03, 0x3a, 0x88, 0x72, 0x20, 0x39,
-  0x76, 0x12, 0x2d, 0x39, 0x4d, 0x2f, 0xaa, 0x38, 0xb0, 0xf3, 0x91, 0x39,
-  0x27, 0xed, 0x99, 0x39, 0x1b, 0x1c, 0x5c, 0x39, 0x73, 0x7f, 0x6d, 0x39,
-  0x76, 0x44, 0xac, 0x38, 0xf0, 0xc5, 0xce, 0x39, 0xac, 0x67, 0xed, 0x38,
-  0x2d, 0x12, 0x87, 0x39, 0x0a, 0xe1, 0x09, 0x39, 0x0f, 0x0c, 0xbe, 0x38,
-  0x12, 0x8f, 0x8e, 0x39, 0x41, 0x6a, 0x66, 0x39, 0xf0, 0xf1, 0xef, 0x38,
-  0xdc, 0x28, 0x9e, 0x39, 0x93, 0x02, 0x15, 0x3a, 0x67, 0x5a, 0x89, 0x39,
-  0x18, 0xb4, 0x99, 0x39, 0xea, 0x40, 0xb0, 0x39, 0x59, 0x25, 0x1e, 0x39,
-  0x65, 0xcd, 0xef, 0x38, 0xf9, 0x61, 0xde, 0x38, 0x9b, 0xbb, 0x07, 0x3a,
-  0x2c, 0x67, 0xa5, 0x38, 0x9e, 0xbf, 0xe8, 0x38, 0x0c, 0x87, 0xad, 0x39,
-  0x50, 0x24, 0xe6, 0x39, 0x02, 0x8b, 0x1e, 0x39, 0x02, 0xce, 0x5c, 0x39,
-  0xcc, 0xa3, 0x05, 0x3a, 0x0e, 0x29, 0x34, 0x39, 0xf2, 0xac, 0x99, 0x39,
-  0xf9, 0xb2, 0x21, 0x39, 0x3d, 0xf5, 0x10, 0x39, 0x52, 0x83, 0x14, 0x39,
-  0x62, 0xb1, 0xc5, 0x38, 0xf5, 0x0a, 0x15, 0x39, 0x3f, 0x7e, 0x24, 0x39,
-  0x11, 0xba, 0x6d, 0x39, 0xcd, 0xbf, 0xbf, 0x38, 0x05, 0x39, 0x32, 0x39,
-  0xbd, 0x16, 0xb2, 0x38, 0x55, 0xd5, 0x2d, 0x39, 0x61, 0x05, 0x0d, 0x39,
-  0x5f, 0xf2, 0x36, 0x39, 0x89, 0x1a, 0x4c, 0x39, 0x1c, 0x42, 0x81, 0x39,
-  0x64, 0xe9, 0x0c, 0x39, 0xe2, 0x4e, 0x80, 0x39, 0x30, 0xfb, 0xa7, 0x39,
-  0x8f, 0xd7, 0x3e, 0x39, 0x92, 0xb6, 0x9d, 0x38, 0xbd, 0xdf, 0x97, 0x39,
-  0x2d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
-  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
-  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x52, 0xd8, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xe4, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xfc, 0x00, 0x00, 0x00, 0x3c, 0xd8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3894,20 +3969,47 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x4c, 0x9b, 0x7a, 0x3b,
-  0x5d, 0x91, 0x86, 0x3b, 0x09, 0xd8, 0x2b, 0x3b, 0xc1, 0xd4, 0x57, 0x3b,
-  0x05, 0x50, 0xa1, 0x3b, 0x2b, 0xd7, 0xc1, 0x3b, 0xcd, 0xa0, 0x53, 0x3b,
-  0x0c, 0x5d, 0x9c, 0x3b, 0xc4, 0xa1, 0xa3, 0x3b, 0x2a, 0x11, 0x91, 0x3b,
-  0xfe, 0x87, 0x75, 0x3b, 0x11, 0xbc, 0x75, 0x3b, 0x3a, 0xac, 0x8e, 0x3b,
-  0x7f, 0xac, 0xa7, 0x3b, 0x86, 0xeb, 0x3d, 0x3b, 0xf5, 0xeb, 0x86, 0x3b,
-  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
-  0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
-  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x7a, 0xd9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x70, 0x3c, 0x39,
+  0xc0, 0x65, 0x8d, 0x39, 0xad, 0x54, 0xfb, 0x38, 0x61, 0x87, 0xcb, 0x38,
+  0x5d, 0x76, 0xa6, 0x39, 0xb0, 0xa8, 0x2c, 0x3a, 0xf1, 0x62, 0x59, 0x39,
+  0xc4, 0x41, 0x7e, 0x39, 0xc0, 0x04, 0x7d, 0x39, 0x15, 0x33, 0xf0, 0x38,
+  0x87, 0xa8, 0x9e, 0x39, 0x4d, 0x5c, 0x51, 0x39, 0xe1, 0xa5, 0x04, 0x39,
+  0x69, 0x3a, 0x84, 0x38, 0xc6, 0x51, 0x36, 0x39, 0x16, 0x8f, 0x0d, 0x39,
+  0xc8, 0xde, 0x88, 0x39, 0xc7, 0x10, 0x7a, 0x39, 0x11, 0xe9, 0x40, 0x39,
+  0x18, 0x19, 0xd4, 0x39, 0xda, 0xee, 0x12, 0x39, 0x57, 0xaf, 0x1f, 0x39,
+  0x9b, 0x5b, 0x56, 0x39, 0xff, 0xfe, 0x18, 0x39, 0xb2, 0x7b, 0x4f, 0x3b,
+  0xc5, 0x49, 0x31, 0x39, 0x5e, 0x13, 0x4d, 0x39, 0xcf, 0xa5, 0x03, 0x39,
+  0x56, 0x8d, 0x6f, 0x39, 0x28, 0x16, 0x23, 0x39, 0x08, 0x9d, 0xf9, 0x38,
+  0x70, 0x71, 0x00, 0x3a, 0xac, 0x8f, 0x99, 0x38, 0x0a, 0x6f, 0x13, 0x3a,
+  0x3d, 0x49, 0xf2, 0x38, 0x21, 0xca, 0x6b, 0x39, 0xa5, 0xdc, 0xbb, 0x39,
+  0xe7, 0x9d, 0x01, 0x39, 0xcd, 0xe8, 0x75, 0x39, 0xb0, 0x3c, 0xc0, 0x38,
+  0x6d, 0xa9, 0x03, 0x3a, 0x88, 0x72, 0x20, 0x39, 0x76, 0x12, 0x2d, 0x39,
+  0x4d, 0x2f, 0xaa, 0x38, 0xb0, 0xf3, 0x91, 0x39, 0x27, 0xed, 0x99, 0x39,
+  0x1b, 0x1c, 0x5c, 0x39, 0x73, 0x7f, 0x6d, 0x39, 0x76, 0x44, 0xac, 0x38,
+  0xf0, 0xc5, 0xce, 0x39, 0xac, 0x67, 0xed, 0x38, 0x2d, 0x12, 0x87, 0x39,
+  0x0a, 0xe1, 0x09, 0x39, 0x0f, 0x0c, 0xbe, 0x38, 0x12, 0x8f, 0x8e, 0x39,
+  0x41, 0x6a, 0x66, 0x39, 0xf0, 0xf1, 0xef, 0x38, 0xdc, 0x28, 0x9e, 0x39,
+  0x93, 0x02, 0x15, 0x3a, 0x67, 0x5a, 0x89, 0x39, 0x18, 0xb4, 0x99, 0x39,
+  0xea, 0x40, 0xb0, 0x39, 0x59, 0x25, 0x1e, 0x39, 0x65, 0xcd, 0xef, 0x38,
+  0xf9, 0x61, 0xde, 0x38, 0x9b, 0xbb, 0x07, 0x3a, 0x2c, 0x67, 0xa5, 0x38,
+  0x9e, 0xbf, 0xe8, 0x38, 0x0c, 0x87, 0xad, 0x39, 0x50, 0x24, 0xe6, 0x39,
+  0x02, 0x8b, 0x1e, 0x39, 0x02, 0xce, 0x5c, 0x39, 0xcc, 0xa3, 0x05, 0x3a,
+  0x0e, 0x29, 0x34, 0x39, 0xf2, 0xac, 0x99, 0x39, 0xf9, 0xb2, 0x21, 0x39,
+  0x3d, 0xf5, 0x10, 0x39, 0x52, 0x83, 0x14, 0x39, 0x62, 0xb1, 0xc5, 0x38,
+  0xf5, 0x0a, 0x15, 0x39, 0x3f, 0x7e, 0x24, 0x39, 0x11, 0xba, 0x6d, 0x39,
+  0xcd, 0xbf, 0xbf, 0x38, 0x05, 0x39, 0x32, 0x39, 0xbd, 0x16, 0xb2, 0x38,
+  0x55, 0xd5, 0x2d, 0x39, 0x61, 0x05, 0x0d, 0x39, 0x5f, 0xf2, 0x36, 0x39,
+  0x89, 0x1a, 0x4c, 0x39, 0x1c, 0x42, 0x81, 0x39, 0x64, 0xe9, 0x0c, 0x39,
+  0xe2, 0x4e, 0x80, 0x39, 0x30, 0xfb, 0xa7, 0x39, 0x8f, 0xd7, 0x3e, 0x39,
+  0x92, 0xb6, 0x9d, 0x38, 0xbd, 0xdf, 0x97, 0x39, 0x2d, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x34, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
+  0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
+  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x52, 0xd8, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x01, 0x00, 0x00,
-  0x64, 0xd9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfc, 0x00, 0x00, 0x00,
+  0x3c, 0xd8, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
   0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3919,21 +4021,20 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x2a, 0xb1, 0xbc, 0x38, 0xb0, 0xa4, 0xca, 0x38,
-  0x6a, 0x63, 0x81, 0x38, 0x13, 0x82, 0xa2, 0x38, 0xf3, 0xea, 0xf2, 0x38,
-  0x54, 0xf3, 0x11, 0x39, 0xf2, 0x57, 0x9f, 0x38, 0x09, 0x77, 0xeb, 0x38,
-  0x0f, 0x69, 0xf6, 0x38, 0x33, 0x74, 0xda, 0x38, 0xde, 0xde, 0xb8, 0x38,
-  0x13, 0x06, 0xb9, 0x38, 0x30, 0xd9, 0xd6, 0x38, 0x3e, 0x7f, 0xfc, 0x38,
-  0xa4, 0xff, 0x8e, 0x38, 0x1d, 0x2d, 0xcb, 0x38, 0x2b, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x4c, 0x9b, 0x7a, 0x3b, 0x5d, 0x91, 0x86, 0x3b,
+  0x09, 0xd8, 0x2b, 0x3b, 0xc1, 0xd4, 0x57, 0x3b, 0x05, 0x50, 0xa1, 0x3b,
+  0x2b, 0xd7, 0xc1, 0x3b, 0xcd, 0xa0, 0x53, 0x3b, 0x0c, 0x5d, 0x9c, 0x3b,
+  0xc4, 0xa1, 0xa3, 0x3b, 0x2a, 0x11, 0x91, 0x3b, 0xfe, 0x87, 0x75, 0x3b,
+  0x11, 0xbc, 0x75, 0x3b, 0x3a, 0xac, 0x8e, 0x3b, 0x7f, 0xac, 0xa7, 0x3b,
+  0x86, 0xeb, 0x3d, 0x3b, 0xf5, 0xeb, 0x86, 0x3b, 0x1e, 0x00, 0x00, 0x00,
   0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x34, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
-  0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
-  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0xa2, 0xda, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xbc, 0x04, 0x00, 0x00, 0x8c, 0xda, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0x5f, 0x34, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f,
+  0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x7a, 0xd9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x08, 0x01, 0x00, 0x00, 0x64, 0xd9, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3944,6 +4045,21 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x2a, 0xb1, 0xbc, 0x38, 0xb0, 0xa4, 0xca, 0x38, 0x6a, 0x63, 0x81, 0x38,
+  0x13, 0x82, 0xa2, 0x38, 0xf3, 0xea, 0xf2, 0x38, 0x54, 0xf3, 0x11, 0x39,
+  0xf2, 0x57, 0x9f, 0x38, 0x09, 0x77, 0xeb, 0x38, 0x0f, 0x69, 0xf6, 0x38,
+  0x33, 0x74, 0xda, 0x38, 0xde, 0xde, 0xb8, 0x38, 0x13, 0x06, 0xb9, 0x38,
+  0x30, 0xd9, 0xd6, 0x38, 0x3e, 0x7f, 0xfc, 0x38, 0xa4, 0xff, 0x8e, 0x38,
+  0x1d, 0x2d, 0xcb, 0x38, 0x2b, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x34, 0x5f,
+  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46,
+  0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72,
+  0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xa2, 0xda, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0xa4, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xbc, 0x04, 0x00, 0x00, 0x8c, 0xda, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -3997,47 +4113,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x6d, 0xff, 0x15, 0x3b, 0xbe, 0xc6, 0xc3, 0x3a,
-  0xe5, 0x3d, 0xe5, 0x3a, 0xe2, 0x02, 0x31, 0x3b, 0x48, 0xa6, 0x59, 0x3b,
-  0x7c, 0x54, 0xbf, 0x3a, 0xab, 0x1e, 0xcb, 0x3a, 0xb0, 0x6c, 0x01, 0x3b,
-  0x92, 0xd9, 0x18, 0x3b, 0x3d, 0x8d, 0xc9, 0x3a, 0xd2, 0x02, 0x3d, 0x3b,
-  0x26, 0x13, 0x02, 0x3b, 0x88, 0x83, 0x46, 0x3b, 0x2b, 0xbf, 0x44, 0x3b,
-  0x90, 0x04, 0x33, 0x3b, 0x30, 0xe7, 0x3d, 0x3b, 0x6c, 0x06, 0x2b, 0x3b,
-  0xd1, 0x6c, 0xfa, 0x3a, 0xb2, 0xcf, 0xf3, 0x3a, 0xca, 0x2a, 0xea, 0x3a,
-  0x33, 0xaa, 0x09, 0x3b, 0xe3, 0x19, 0xa5, 0x3a, 0x69, 0xc3, 0x64, 0x3a,
-  0x07, 0x3d, 0x13, 0x3b, 0x63, 0xea, 0x27, 0x3b, 0x89, 0xf2, 0x2e, 0x3b,
-  0x02, 0x52, 0xb7, 0x3a, 0xa2, 0x6a, 0xe7, 0x3a, 0x9a, 0xe4, 0xf0, 0x3a,
-  0xeb, 0x34, 0x2d, 0x3b, 0x8f, 0x23, 0xdd, 0x3a, 0x41, 0x46, 0x38, 0x3b,
-  0x45, 0x63, 0xc4, 0x3a, 0xbe, 0x77, 0xfe, 0x3a, 0x4b, 0x1c, 0x23, 0x3b,
-  0x1b, 0xba, 0xe3, 0x3a, 0x77, 0x6e, 0x55, 0x3b, 0xf7, 0x47, 0x21, 0x3b,
-  0xd8, 0x55, 0xe7, 0x3a, 0xff, 0xed, 0x17, 0x3b, 0xd4, 0x8f, 0xfd, 0x3a,
-  0x0a, 0x67, 0x10, 0x3b, 0x98, 0x37, 0x21, 0x3b, 0x3a, 0xcd, 0x37, 0x3b,
-  0xc6, 0xba, 0x6c, 0x3b, 0x0d, 0x2f, 0x2c, 0x3b, 0x8d, 0x0c, 0xfd, 0x3a,
-  0x62, 0x9d, 0xed, 0x3a, 0x01, 0xea, 0xef, 0x3a, 0x85, 0x61, 0x31, 0x3b,
-  0x94, 0xc9, 0xae, 0x3a, 0x17, 0x44, 0x23, 0x3b, 0x34, 0x30, 0x2f, 0x3b,
-  0xbc, 0x16, 0x0e, 0x3b, 0xf8, 0x4e, 0x67, 0x3b, 0xe0, 0xf8, 0x38, 0x3b,
-  0xd4, 0xba, 0x1a, 0x3b, 0xfa, 0x1e, 0x1e, 0x3b, 0x58, 0x0f, 0xe3, 0x3a,
-  0x42, 0x0b, 0x4f, 0x3b, 0x97, 0xac, 0x4d, 0x3b, 0x92, 0x29, 0xfc, 0x3a,
-  0x65, 0x20, 0x4b, 0x3b, 0xa1, 0x75, 0xe5, 0x3a, 0xc6, 0xff, 0x07, 0x3b,
-  0xe8, 0x75, 0x13, 0x3b, 0x3f, 0xb5, 0x12, 0x3b, 0xc4, 0x17, 0x15, 0x3b,
-  0xd0, 0xbc, 0x0f, 0x3b, 0xdb, 0xca, 0x34, 0x3b, 0x50, 0x4c, 0x03, 0x3b,
-  0x34, 0xb3, 0x0e, 0x3b, 0x93, 0x78, 0x12, 0x3b, 0xfd, 0x73, 0x11, 0x3b,
-  0x23, 0x38, 0x23, 0x3b, 0xc6, 0x04, 0x26, 0x3b, 0x49, 0xe3, 0x07, 0x3b,
-  0x77, 0x32, 0x20, 0x3b, 0xc8, 0x9a, 0x05, 0x3b, 0x9c, 0x69, 0x2c, 0x3b,
-  0xa0, 0x3c, 0x18, 0x3b, 0x57, 0xd8, 0x3a, 0x3b, 0xf9, 0x87, 0xbc, 0x3a,
-  0x0b, 0x7a, 0xbc, 0x3a, 0x0e, 0x57, 0x1e, 0x3b, 0x97, 0x8f, 0x20, 0x3b,
-  0xcb, 0xda, 0x4d, 0x3b, 0x82, 0x0f, 0x3f, 0x3b, 0x18, 0x5d, 0x6a, 0x3a,
-  0x51, 0xec, 0x28, 0x3b, 0x13, 0x80, 0x25, 0x3b, 0x78, 0x8d, 0x22, 0x3b,
-  0xc9, 0x33, 0xd9, 0x3a, 0x8c, 0x8b, 0x1e, 0x3b, 0x98, 0x4c, 0xf2, 0x3a,
-  0x10, 0x16, 0x16, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
-  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x8a, 0xdf, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa4, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xc8, 0x04, 0x00, 0x00, 0x74, 0xdf, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4048,6 +4123,48 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x6d, 0xff, 0x15, 0x3b, 0xbe, 0xc6, 0xc3, 0x3a, 0xe5, 0x3d, 0xe5, 0x3a,
+  0xe2, 0x02, 0x31, 0x3b, 0x48, 0xa6, 0x59, 0x3b, 0x7c, 0x54, 0xbf, 0x3a,
+  0xab, 0x1e, 0xcb, 0x3a, 0xb0, 0x6c, 0x01, 0x3b, 0x92, 0xd9, 0x18, 0x3b,
+  0x3d, 0x8d, 0xc9, 0x3a, 0xd2, 0x02, 0x3d, 0x3b, 0x26, 0x13, 0x02, 0x3b,
+  0x88, 0x83, 0x46, 0x3b, 0x2b, 0xbf, 0x44, 0x3b, 0x90, 0x04, 0x33, 0x3b,
+  0x30, 0xe7, 0x3d, 0x3b, 0x6c, 0x06, 0x2b, 0x3b, 0xd1, 0x6c, 0xfa, 0x3a,
+  0xb2, 0xcf, 0xf3, 0x3a, 0xca, 0x2a, 0xea, 0x3a, 0x33, 0xaa, 0x09, 0x3b,
+  0xe3, 0x19, 0xa5, 0x3a, 0x69, 0xc3, 0x64, 0x3a, 0x07, 0x3d, 0x13, 0x3b,
+  0x63, 0xea, 0x27, 0x3b, 0x89, 0xf2, 0x2e, 0x3b, 0x02, 0x52, 0xb7, 0x3a,
+  0xa2, 0x6a, 0xe7, 0x3a, 0x9a, 0xe4, 0xf0, 0x3a, 0xeb, 0x34, 0x2d, 0x3b,
+  0x8f, 0x23, 0xdd, 0x3a, 0x41, 0x46, 0x38, 0x3b, 0x45, 0x63, 0xc4, 0x3a,
+  0xbe, 0x77, 0xfe, 0x3a, 0x4b, 0x1c, 0x23, 0x3b, 0x1b, 0xba, 0xe3, 0x3a,
+  0x77, 0x6e, 0x55, 0x3b, 0xf7, 0x47, 0x21, 0x3b, 0xd8, 0x55, 0xe7, 0x3a,
+  0xff, 0xed, 0x17, 0x3b, 0xd4, 0x8f, 0xfd, 0x3a, 0x0a, 0x67, 0x10, 0x3b,
+  0x98, 0x37, 0x21, 0x3b, 0x3a, 0xcd, 0x37, 0x3b, 0xc6, 0xba, 0x6c, 0x3b,
+  0x0d, 0x2f, 0x2c, 0x3b, 0x8d, 0x0c, 0xfd, 0x3a, 0x62, 0x9d, 0xed, 0x3a,
+  0x01, 0xea, 0xef, 0x3a, 0x85, 0x61, 0x31, 0x3b, 0x94, 0xc9, 0xae, 0x3a,
+  0x17, 0x44, 0x23, 0x3b, 0x34, 0x30, 0x2f, 0x3b, 0xbc, 0x16, 0x0e, 0x3b,
+  0xf8, 0x4e, 0x67, 0x3b, 0xe0, 0xf8, 0x38, 0x3b, 0xd4, 0xba, 0x1a, 0x3b,
+  0xfa, 0x1e, 0x1e, 0x3b, 0x58, 0x0f, 0xe3, 0x3a, 0x42, 0x0b, 0x4f, 0x3b,
+  0x97, 0xac, 0x4d, 0x3b, 0x92, 0x29, 0xfc, 0x3a, 0x65, 0x20, 0x4b, 0x3b,
+  0xa1, 0x75, 0xe5, 0x3a, 0xc6, 0xff, 0x07, 0x3b, 0xe8, 0x75, 0x13, 0x3b,
+  0x3f, 0xb5, 0x12, 0x3b, 0xc4, 0x17, 0x15, 0x3b, 0xd0, 0xbc, 0x0f, 0x3b,
+  0xdb, 0xca, 0x34, 0x3b, 0x50, 0x4c, 0x03, 0x3b, 0x34, 0xb3, 0x0e, 0x3b,
+  0x93, 0x78, 0x12, 0x3b, 0xfd, 0x73, 0x11, 0x3b, 0x23, 0x38, 0x23, 0x3b,
+  0xc6, 0x04, 0x26, 0x3b, 0x49, 0xe3, 0x07, 0x3b, 0x77, 0x32, 0x20, 0x3b,
+  0xc8, 0x9a, 0x05, 0x3b, 0x9c, 0x69, 0x2c, 0x3b, 0xa0, 0x3c, 0x18, 0x3b,
+  0x57, 0xd8, 0x3a, 0x3b, 0xf9, 0x87, 0xbc, 0x3a, 0x0b, 0x7a, 0xbc, 0x3a,
+  0x0e, 0x57, 0x1e, 0x3b, 0x97, 0x8f, 0x20, 0x3b, 0xcb, 0xda, 0x4d, 0x3b,
+  0x82, 0x0f, 0x3f, 0x3b, 0x18, 0x5d, 0x6a, 0x3a, 0x51, 0xec, 0x28, 0x3b,
+  0x13, 0x80, 0x25, 0x3b, 0x78, 0x8d, 0x22, 0x3b, 0xc9, 0x33, 0xd9, 0x3a,
+  0x8c, 0x8b, 0x1e, 0x3b, 0x98, 0x4c, 0xf2, 0x3a, 0x10, 0x16, 0x16, 0x3b,
+  0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x65, 0x78, 0x70, 0x61,
+  0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x8a, 0xdf, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8, 0x04, 0x00, 0x00,
+  0x74, 0xdf, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4101,50 +4218,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x47, 0x89, 0x3e, 0x39, 0xdd, 0xaf, 0xf8, 0x38, 0x30, 0x99, 0x11, 0x39,
-  0xb5, 0xd9, 0x60, 0x39, 0x5e, 0x3c, 0x8a, 0x39, 0xfa, 0x09, 0xf3, 0x38,
-  0xee, 0x01, 0x01, 0x39, 0x26, 0x67, 0x24, 0x39, 0xc0, 0x28, 0x42, 0x39,
-  0xf8, 0x02, 0x00, 0x39, 0xdf, 0x17, 0x70, 0x39, 0x98, 0x3a, 0x25, 0x39,
-  0x0c, 0x2a, 0x7c, 0x39, 0x6d, 0xeb, 0x79, 0x39, 0x37, 0x66, 0x63, 0x39,
-  0xf5, 0x39, 0x71, 0x39, 0x16, 0x3f, 0x59, 0x39, 0x73, 0x0d, 0x1f, 0x39,
-  0x19, 0xda, 0x1a, 0x39, 0x05, 0xba, 0x14, 0x39, 0xc7, 0xde, 0x2e, 0x39,
-  0xb1, 0xb8, 0xd1, 0x38, 0x65, 0x4b, 0x91, 0x38, 0xf7, 0x07, 0x3b, 0x39,
-  0xea, 0x4b, 0x55, 0x39, 0x92, 0x3a, 0x5e, 0x39, 0x57, 0xdd, 0xe8, 0x38,
-  0xca, 0xfa, 0x12, 0x39, 0x99, 0xff, 0x18, 0x39, 0x85, 0x04, 0x5c, 0x39,
-  0xb7, 0x73, 0x0c, 0x39, 0x98, 0x13, 0x6a, 0x39, 0xb1, 0x76, 0xf9, 0x38,
-  0xc3, 0x9e, 0x21, 0x39, 0x5f, 0x31, 0x4f, 0x39, 0xe4, 0xa2, 0x10, 0x39,
-  0x8b, 0x8e, 0x87, 0x39, 0x79, 0xde, 0x4c, 0x39, 0x96, 0xed, 0x12, 0x39,
-  0x82, 0xfd, 0x40, 0x39, 0x78, 0x0b, 0x21, 0x39, 0xc6, 0x6d, 0x37, 0x39,
-  0xae, 0xc9, 0x4c, 0x39, 0xdc, 0x79, 0x69, 0x39, 0xa8, 0x5a, 0x96, 0x39,
-  0xe1, 0xb7, 0x5a, 0x39, 0x17, 0xb8, 0x20, 0x39, 0x95, 0xea, 0x16, 0x39,
-  0x6f, 0x60, 0x18, 0x39, 0xec, 0x51, 0x61, 0x39, 0x8b, 0x06, 0xde, 0x38,
-  0xed, 0x63, 0x4f, 0x39, 0xe7, 0x88, 0x5e, 0x39, 0x64, 0x7d, 0x34, 0x39,
-  0x38, 0xe9, 0x92, 0x39, 0x7d, 0xf6, 0x6a, 0x39, 0x13, 0x8c, 0x44, 0x39,
-  0xd9, 0xda, 0x48, 0x39, 0x70, 0x36, 0x10, 0x39, 0xf9, 0x7f, 0x83, 0x39,
-  0x41, 0xa1, 0x82, 0x39, 0xed, 0x27, 0x20, 0x39, 0x07, 0x03, 0x81, 0x39,
-  0x96, 0xbc, 0x11, 0x39, 0x1b, 0xc1, 0x2c, 0x39, 0x38, 0x50, 0x3b, 0x39,
-  0x7d, 0x5b, 0x3a, 0x39, 0x02, 0x63, 0x3d, 0x39, 0x8a, 0x95, 0x36, 0x39,
-  0x49, 0xa7, 0x65, 0x39, 0x65, 0xc8, 0x26, 0x39, 0x26, 0x44, 0x35, 0x39,
-  0x6b, 0x0e, 0x3a, 0x39, 0x68, 0xc3, 0x38, 0x39, 0xbe, 0x54, 0x4f, 0x39,
-  0x0f, 0xe3, 0x52, 0x39, 0xeb, 0x9c, 0x2c, 0x39, 0xfa, 0x7d, 0x4b, 0x39,
-  0x72, 0xb6, 0x29, 0x39, 0x44, 0x02, 0x5b, 0x39, 0x64, 0x61, 0x41, 0x39,
-  0x89, 0x57, 0x6d, 0x39, 0xd2, 0x7b, 0xef, 0x38, 0x21, 0x6a, 0xef, 0x38,
-  0x15, 0x22, 0x49, 0x39, 0x45, 0xf4, 0x4b, 0x39, 0x99, 0xbe, 0x82, 0x39,
-  0x5c, 0xb2, 0x72, 0x39, 0xf9, 0xd9, 0x94, 0x38, 0x8d, 0x93, 0x56, 0x39,
-  0x7f, 0x3a, 0x52, 0x39, 0xf3, 0x7b, 0x4e, 0x39, 0xa6, 0xf3, 0x09, 0x39,
-  0xc3, 0x64, 0x49, 0x39, 0x3d, 0xe4, 0x19, 0x39, 0x08, 0xa6, 0x3e, 0x39,
-  0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x65, 0x78, 0x70, 0x61,
-  0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42,
-  0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x72, 0xe4, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x28, 0x00, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00,
-  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x24, 0x05, 0x00, 0x00,
-  0x00, 0x00, 0x12, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4155,6 +4228,49 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x47, 0x89, 0x3e, 0x39,
+  0xdd, 0xaf, 0xf8, 0x38, 0x30, 0x99, 0x11, 0x39, 0xb5, 0xd9, 0x60, 0x39,
+  0x5e, 0x3c, 0x8a, 0x39, 0xfa, 0x09, 0xf3, 0x38, 0xee, 0x01, 0x01, 0x39,
+  0x26, 0x67, 0x24, 0x39, 0xc0, 0x28, 0x42, 0x39, 0xf8, 0x02, 0x00, 0x39,
+  0xdf, 0x17, 0x70, 0x39, 0x98, 0x3a, 0x25, 0x39, 0x0c, 0x2a, 0x7c, 0x39,
+  0x6d, 0xeb, 0x79, 0x39, 0x37, 0x66, 0x63, 0x39, 0xf5, 0x39, 0x71, 0x39,
+  0x16, 0x3f, 0x59, 0x39, 0x73, 0x0d, 0x1f, 0x39, 0x19, 0xda, 0x1a, 0x39,
+  0x05, 0xba, 0x14, 0x39, 0xc7, 0xde, 0x2e, 0x39, 0xb1, 0xb8, 0xd1, 0x38,
+  0x65, 0x4b, 0x91, 0x38, 0xf7, 0x07, 0x3b, 0x39, 0xea, 0x4b, 0x55, 0x39,
+  0x92, 0x3a, 0x5e, 0x39, 0x57, 0xdd, 0xe8, 0x38, 0xca, 0xfa, 0x12, 0x39,
+  0x99, 0xff, 0x18, 0x39, 0x85, 0x04, 0x5c, 0x39, 0xb7, 0x73, 0x0c, 0x39,
+  0x98, 0x13, 0x6a, 0x39, 0xb1, 0x76, 0xf9, 0x38, 0xc3, 0x9e, 0x21, 0x39,
+  0x5f, 0x31, 0x4f, 0x39, 0xe4, 0xa2, 0x10, 0x39, 0x8b, 0x8e, 0x87, 0x39,
+  0x79, 0xde, 0x4c, 0x39, 0x96, 0xed, 0x12, 0x39, 0x82, 0xfd, 0x40, 0x39,
+  0x78, 0x0b, 0x21, 0x39, 0xc6, 0x6d, 0x37, 0x39, 0xae, 0xc9, 0x4c, 0x39,
+  0xdc, 0x79, 0x69, 0x39, 0xa8, 0x5a, 0x96, 0x39, 0xe1, 0xb7, 0x5a, 0x39,
+  0x17, 0xb8, 0x20, 0x39, 0x95, 0xea, 0x16, 0x39, 0x6f, 0x60, 0x18, 0x39,
+  0xec, 0x51, 0x61, 0x39, 0x8b, 0x06, 0xde, 0x38, 0xed, 0x63, 0x4f, 0x39,
+  0xe7, 0x88, 0x5e, 0x39, 0x64, 0x7d, 0x34, 0x39, 0x38, 0xe9, 0x92, 0x39,
+  0x7d, 0xf6, 0x6a, 0x39, 0x13, 0x8c, 0x44, 0x39, 0xd9, 0xda, 0x48, 0x39,
+  0x70, 0x36, 0x10, 0x39, 0xf9, 0x7f, 0x83, 0x39, 0x41, 0xa1, 0x82, 0x39,
+  0xed, 0x27, 0x20, 0x39, 0x07, 0x03, 0x81, 0x39, 0x96, 0xbc, 0x11, 0x39,
+  0x1b, 0xc1, 0x2c, 0x39, 0x38, 0x50, 0x3b, 0x39, 0x7d, 0x5b, 0x3a, 0x39,
+  0x02, 0x63, 0x3d, 0x39, 0x8a, 0x95, 0x36, 0x39, 0x49, 0xa7, 0x65, 0x39,
+  0x65, 0xc8, 0x26, 0x39, 0x26, 0x44, 0x35, 0x39, 0x6b, 0x0e, 0x3a, 0x39,
+  0x68, 0xc3, 0x38, 0x39, 0xbe, 0x54, 0x4f, 0x39, 0x0f, 0xe3, 0x52, 0x39,
+  0xeb, 0x9c, 0x2c, 0x39, 0xfa, 0x7d, 0x4b, 0x39, 0x72, 0xb6, 0x29, 0x39,
+  0x44, 0x02, 0x5b, 0x39, 0x64, 0x61, 0x41, 0x39, 0x89, 0x57, 0x6d, 0x39,
+  0xd2, 0x7b, 0xef, 0x38, 0x21, 0x6a, 0xef, 0x38, 0x15, 0x22, 0x49, 0x39,
+  0x45, 0xf4, 0x4b, 0x39, 0x99, 0xbe, 0x82, 0x39, 0x5c, 0xb2, 0x72, 0x39,
+  0xf9, 0xd9, 0x94, 0x38, 0x8d, 0x93, 0x56, 0x39, 0x7f, 0x3a, 0x52, 0x39,
+  0xf3, 0x7b, 0x4e, 0x39, 0xa6, 0xf3, 0x09, 0x39, 0xc3, 0x64, 0x49, 0x39,
+  0x3d, 0xe4, 0x19, 0x39, 0x08, 0xa6, 0x3e, 0x39, 0x2a, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x35, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42,
+  0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68,
+  0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x72, 0xe4, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x28, 0x00, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x24, 0x05, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4208,54 +4324,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xd7, 0x93, 0x20, 0x3c,
-  0x1b, 0x08, 0x00, 0x3c, 0x37, 0x2f, 0xeb, 0x3b, 0x67, 0x9e, 0xc0, 0x3b,
-  0x9e, 0xae, 0x41, 0x3c, 0x6a, 0x06, 0x1e, 0x3c, 0xfe, 0x87, 0x5d, 0x3c,
-  0x86, 0x00, 0xe4, 0x3b, 0x95, 0x29, 0x08, 0x3c, 0xd0, 0x7e, 0x04, 0x3c,
-  0x56, 0x8a, 0xa3, 0x3b, 0x81, 0xff, 0xc5, 0x3b, 0x4c, 0x2c, 0xe4, 0x3b,
-  0x2b, 0xf3, 0x54, 0x3b, 0xf3, 0xad, 0x63, 0x3b, 0x61, 0xec, 0x8f, 0x3b,
-  0xea, 0x28, 0x82, 0x3b, 0xad, 0xaa, 0x10, 0x3c, 0x9d, 0xc4, 0x09, 0x3c,
-  0x44, 0x54, 0x4a, 0x3b, 0x73, 0x6a, 0xc3, 0x3b, 0x4e, 0x70, 0x15, 0x3c,
-  0x27, 0x5c, 0x25, 0x3c, 0x6f, 0xa2, 0xf0, 0x3b, 0xe2, 0xc1, 0x86, 0x3c,
-  0x14, 0xd8, 0xa5, 0x3b, 0xdf, 0xc8, 0x47, 0x3c, 0xdb, 0x16, 0xcd, 0x3b,
-  0x6e, 0x53, 0x8d, 0x3b, 0x36, 0x99, 0xa6, 0x3b, 0xf8, 0xfd, 0x69, 0x3c,
-  0x03, 0x97, 0xbd, 0x3b, 0x1d, 0x2e, 0xee, 0x3b, 0x4d, 0x1a, 0x4a, 0x3c,
-  0xa8, 0x51, 0x02, 0x3c, 0x34, 0x05, 0x57, 0x3c, 0xb7, 0x46, 0xc1, 0x3b,
-  0xe2, 0xc8, 0xe7, 0x3b, 0xb7, 0xfd, 0x66, 0x3c, 0x7e, 0xe5, 0x8d, 0x3b,
-  0x75, 0xd7, 0xb8, 0x3b, 0x9c, 0x7f, 0x29, 0x3c, 0xde, 0xe1, 0xf4, 0x3b,
-  0x90, 0xe8, 0x53, 0x3b, 0xd7, 0x2b, 0x8d, 0x3b, 0x0f, 0x52, 0x8c, 0x3b,
-  0xf2, 0xab, 0x26, 0x3c, 0x02, 0xfc, 0x81, 0x3b, 0x9d, 0xed, 0x2b, 0x3c,
-  0x96, 0x9c, 0xad, 0x3b, 0x39, 0x22, 0xad, 0x3b, 0xab, 0x99, 0x9f, 0x3b,
-  0x49, 0x52, 0x88, 0x3b, 0xfc, 0x03, 0x9c, 0x3b, 0x31, 0x08, 0xa7, 0x3b,
-  0x0f, 0x5f, 0xdf, 0x3b, 0x5c, 0x7e, 0xfd, 0x3b, 0x4b, 0x5a, 0x01, 0x3c,
-  0x1e, 0x5a, 0x50, 0x3b, 0x67, 0xd9, 0xcf, 0x3b, 0x5e, 0x42, 0xc2, 0x3b,
-  0x5e, 0x29, 0xb6, 0x3b, 0x70, 0x2e, 0x66, 0x3b, 0xdc, 0xf4, 0x80, 0x3b,
-  0x5e, 0x45, 0xe6, 0x3b, 0xcd, 0x17, 0x25, 0x3c, 0x55, 0xe2, 0x76, 0x3c,
-  0x4d, 0xca, 0xee, 0x3b, 0x4c, 0xa9, 0x10, 0x3c, 0x4d, 0x1f, 0xc2, 0x3b,
-  0xcb, 0x10, 0x00, 0x3c, 0xa3, 0x10, 0x81, 0x3b, 0x9a, 0xa5, 0x45, 0x3b,
-  0x85, 0xc3, 0x10, 0x3c, 0xce, 0x04, 0x6d, 0x3c, 0x98, 0x73, 0x81, 0x3b,
-  0x60, 0x1e, 0xb9, 0x3b, 0xb7, 0x69, 0xe8, 0x3b, 0xfd, 0x1b, 0xb0, 0x3b,
-  0x34, 0x9c, 0x19, 0x3c, 0x42, 0x91, 0x32, 0x3c, 0x79, 0xdf, 0x80, 0x3b,
-  0x9f, 0xfe, 0x12, 0x3c, 0xa1, 0xcf, 0x06, 0x3c, 0x49, 0xe2, 0x82, 0x3b,
-  0x23, 0xfd, 0xd9, 0x3b, 0xaf, 0x42, 0xd1, 0x3b, 0x80, 0xf6, 0xcd, 0x3b,
-  0x0d, 0x61, 0x5b, 0x3c, 0xaa, 0x90, 0x98, 0x3b, 0x90, 0x41, 0x9a, 0x3b,
-  0xdc, 0x78, 0xdb, 0x3b, 0x99, 0xaa, 0x04, 0x3c, 0xfc, 0x57, 0x2c, 0x3c,
-  0x7e, 0x13, 0x22, 0x3c, 0x77, 0x77, 0x0c, 0x3c, 0x6f, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x35, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73,
-  0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61,
-  0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
-  0x35, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f,
-  0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f,
-  0x36, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0xc2, 0xe9, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa8, 0x04, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xd0, 0x04, 0x00, 0x00, 0xac, 0xe9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4267,6 +4335,54 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0xd7, 0x93, 0x20, 0x3c, 0x1b, 0x08, 0x00, 0x3c,
+  0x37, 0x2f, 0xeb, 0x3b, 0x67, 0x9e, 0xc0, 0x3b, 0x9e, 0xae, 0x41, 0x3c,
+  0x6a, 0x06, 0x1e, 0x3c, 0xfe, 0x87, 0x5d, 0x3c, 0x86, 0x00, 0xe4, 0x3b,
+  0x95, 0x29, 0x08, 0x3c, 0xd0, 0x7e, 0x04, 0x3c, 0x56, 0x8a, 0xa3, 0x3b,
+  0x81, 0xff, 0xc5, 0x3b, 0x4c, 0x2c, 0xe4, 0x3b, 0x2b, 0xf3, 0x54, 0x3b,
+  0xf3, 0xad, 0x63, 0x3b, 0x61, 0xec, 0x8f, 0x3b, 0xea, 0x28, 0x82, 0x3b,
+  0xad, 0xaa, 0x10, 0x3c, 0x9d, 0xc4, 0x09, 0x3c, 0x44, 0x54, 0x4a, 0x3b,
+  0x73, 0x6a, 0xc3, 0x3b, 0x4e, 0x70, 0x15, 0x3c, 0x27, 0x5c, 0x25, 0x3c,
+  0x6f, 0xa2, 0xf0, 0x3b, 0xe2, 0xc1, 0x86, 0x3c, 0x14, 0xd8, 0xa5, 0x3b,
+  0xdf, 0xc8, 0x47, 0x3c, 0xdb, 0x16, 0xcd, 0x3b, 0x6e, 0x53, 0x8d, 0x3b,
+  0x36, 0x99, 0xa6, 0x3b, 0xf8, 0xfd, 0x69, 0x3c, 0x03, 0x97, 0xbd, 0x3b,
+  0x1d, 0x2e, 0xee, 0x3b, 0x4d, 0x1a, 0x4a, 0x3c, 0xa8, 0x51, 0x02, 0x3c,
+  0x34, 0x05, 0x57, 0x3c, 0xb7, 0x46, 0xc1, 0x3b, 0xe2, 0xc8, 0xe7, 0x3b,
+  0xb7, 0xfd, 0x66, 0x3c, 0x7e, 0xe5, 0x8d, 0x3b, 0x75, 0xd7, 0xb8, 0x3b,
+  0x9c, 0x7f, 0x29, 0x3c, 0xde, 0xe1, 0xf4, 0x3b, 0x90, 0xe8, 0x53, 0x3b,
+  0xd7, 0x2b, 0x8d, 0x3b, 0x0f, 0x52, 0x8c, 0x3b, 0xf2, 0xab, 0x26, 0x3c,
+  0x02, 0xfc, 0x81, 0x3b, 0x9d, 0xed, 0x2b, 0x3c, 0x96, 0x9c, 0xad, 0x3b,
+  0x39, 0x22, 0xad, 0x3b, 0xab, 0x99, 0x9f, 0x3b, 0x49, 0x52, 0x88, 0x3b,
+  0xfc, 0x03, 0x9c, 0x3b, 0x31, 0x08, 0xa7, 0x3b, 0x0f, 0x5f, 0xdf, 0x3b,
+  0x5c, 0x7e, 0xfd, 0x3b, 0x4b, 0x5a, 0x01, 0x3c, 0x1e, 0x5a, 0x50, 0x3b,
+  0x67, 0xd9, 0xcf, 0x3b, 0x5e, 0x42, 0xc2, 0x3b, 0x5e, 0x29, 0xb6, 0x3b,
+  0x70, 0x2e, 0x66, 0x3b, 0xdc, 0xf4, 0x80, 0x3b, 0x5e, 0x45, 0xe6, 0x3b,
+  0xcd, 0x17, 0x25, 0x3c, 0x55, 0xe2, 0x76, 0x3c, 0x4d, 0xca, 0xee, 0x3b,
+  0x4c, 0xa9, 0x10, 0x3c, 0x4d, 0x1f, 0xc2, 0x3b, 0xcb, 0x10, 0x00, 0x3c,
+  0xa3, 0x10, 0x81, 0x3b, 0x9a, 0xa5, 0x45, 0x3b, 0x85, 0xc3, 0x10, 0x3c,
+  0xce, 0x04, 0x6d, 0x3c, 0x98, 0x73, 0x81, 0x3b, 0x60, 0x1e, 0xb9, 0x3b,
+  0xb7, 0x69, 0xe8, 0x3b, 0xfd, 0x1b, 0xb0, 0x3b, 0x34, 0x9c, 0x19, 0x3c,
+  0x42, 0x91, 0x32, 0x3c, 0x79, 0xdf, 0x80, 0x3b, 0x9f, 0xfe, 0x12, 0x3c,
+  0xa1, 0xcf, 0x06, 0x3c, 0x49, 0xe2, 0x82, 0x3b, 0x23, 0xfd, 0xd9, 0x3b,
+  0xaf, 0x42, 0xd1, 0x3b, 0x80, 0xf6, 0xcd, 0x3b, 0x0d, 0x61, 0x5b, 0x3c,
+  0xaa, 0x90, 0x98, 0x3b, 0x90, 0x41, 0x9a, 0x3b, 0xdc, 0x78, 0xdb, 0x3b,
+  0x99, 0xaa, 0x04, 0x3c, 0xfc, 0x57, 0x2c, 0x3c, 0x7e, 0x13, 0x22, 0x3c,
+  0x77, 0x77, 0x0c, 0x3c, 0x6f, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e,
+  0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e,
+  0x6f, 0x72, 0x6d, 0x56, 0x33, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
+  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x2f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x3b, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f,
+  0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78,
+  0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xc2, 0xe9, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa8, 0x04, 0x00, 0x00,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd0, 0x04, 0x00, 0x00,
+  0xac, 0xe9, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4320,47 +4436,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x92, 0xcf, 0x71, 0x39, 0xf6, 0xcc, 0x40, 0x39,
-  0x7e, 0x14, 0x31, 0x39, 0xd5, 0x07, 0x11, 0x39, 0xcb, 0xd4, 0x91, 0x39,
-  0x97, 0xf7, 0x6d, 0x39, 0xcc, 0xcc, 0xa6, 0x39, 0x11, 0xac, 0x2b, 0x39,
-  0x6b, 0x0b, 0x4d, 0x39, 0xbe, 0x85, 0x47, 0x39, 0xc7, 0x45, 0xf6, 0x38,
-  0xb6, 0x14, 0x15, 0x39, 0x06, 0xcd, 0x2b, 0x39, 0xb7, 0x56, 0xa0, 0x38,
-  0xe4, 0x6d, 0xab, 0x38, 0x4d, 0xbb, 0xd8, 0x38, 0x61, 0x01, 0xc4, 0x38,
-  0xde, 0xd9, 0x59, 0x39, 0x62, 0x76, 0x4f, 0x39, 0x8b, 0x57, 0x98, 0x38,
-  0xf9, 0x22, 0x13, 0x39, 0x7f, 0x09, 0x61, 0x39, 0x3e, 0x03, 0x79, 0x39,
-  0x02, 0x2f, 0x35, 0x39, 0xc1, 0xed, 0xca, 0x39, 0xdc, 0xbd, 0xf9, 0x38,
-  0x15, 0x6d, 0x96, 0x39, 0x90, 0x6b, 0x1a, 0x39, 0xf7, 0xd1, 0xd4, 0x38,
-  0xb2, 0xe0, 0xfa, 0x38, 0xa9, 0x2e, 0xb0, 0x39, 0x02, 0xc0, 0x0e, 0x39,
-  0xec, 0x55, 0x33, 0x39, 0xe6, 0x2b, 0x98, 0x39, 0xbb, 0x3e, 0x44, 0x39,
-  0xcd, 0xe5, 0xa1, 0x39, 0x90, 0x86, 0x11, 0x39, 0x2f, 0x85, 0x2e, 0x39,
-  0x36, 0xec, 0xad, 0x39, 0xeb, 0xad, 0xd5, 0x38, 0xc5, 0x2c, 0x0b, 0x39,
-  0xa9, 0x3e, 0x7f, 0x39, 0xc9, 0x61, 0x38, 0x39, 0xfa, 0x8d, 0x9f, 0x38,
-  0x59, 0x96, 0xd4, 0x38, 0x65, 0x4e, 0xd3, 0x38, 0xe8, 0xfc, 0x7a, 0x39,
-  0xc1, 0xbd, 0xc3, 0x38, 0xaa, 0x73, 0x81, 0x39, 0x29, 0xb8, 0x02, 0x39,
-  0x07, 0x5c, 0x02, 0x39, 0xd8, 0x56, 0xf0, 0x38, 0xb6, 0x48, 0xcd, 0x38,
-  0xeb, 0xf0, 0xea, 0x38, 0xd2, 0x87, 0xfb, 0x38, 0x7b, 0x2f, 0x28, 0x39,
-  0xa3, 0xdd, 0x3e, 0x39, 0x3b, 0xca, 0x42, 0x39, 0x77, 0xe0, 0x9c, 0x38,
-  0x8d, 0x7f, 0x1c, 0x39, 0x0b, 0x44, 0x12, 0x39, 0x2f, 0x28, 0x09, 0x39,
-  0x24, 0x50, 0xad, 0x38, 0x7c, 0x31, 0xc2, 0x38, 0x68, 0x61, 0x2d, 0x39,
-  0x50, 0x9c, 0x78, 0x39, 0xa4, 0xe3, 0xb9, 0x39, 0x86, 0xcb, 0x33, 0x39,
-  0xca, 0xd7, 0x59, 0x39, 0xa4, 0x29, 0x12, 0x39, 0x0b, 0xda, 0x40, 0x39,
-  0x50, 0x5b, 0xc2, 0x38, 0x05, 0xd1, 0x94, 0x38, 0x47, 0xff, 0x59, 0x39,
-  0x11, 0x76, 0xb2, 0x39, 0x55, 0xf0, 0xc2, 0x38, 0x2a, 0x62, 0x0b, 0x39,
-  0x48, 0xfe, 0x2e, 0x39, 0x98, 0x99, 0x04, 0x39, 0xa0, 0x51, 0x67, 0x39,
-  0x65, 0x73, 0x86, 0x39, 0x47, 0x11, 0xc2, 0x38, 0x4a, 0x5b, 0x5d, 0x39,
-  0x74, 0x02, 0x4b, 0x39, 0x86, 0x18, 0xc5, 0x38, 0xfc, 0x21, 0x24, 0x39,
-  0x93, 0x8f, 0x1d, 0x39, 0xf4, 0x13, 0x1b, 0x39, 0xf8, 0x2d, 0xa5, 0x39,
-  0xbe, 0xbe, 0xe5, 0x38, 0xa3, 0x4a, 0xe8, 0x38, 0xe5, 0x3f, 0x25, 0x39,
-  0xad, 0xc7, 0x47, 0x39, 0xc1, 0xc3, 0x81, 0x39, 0x4f, 0x11, 0x74, 0x39,
-  0xb9, 0x86, 0x53, 0x39, 0x2d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e,
-  0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e,
-  0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0xb2, 0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0xfc, 0x00, 0x00, 0x00, 0x9c, 0xee, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4371,20 +4446,47 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x08, 0x35, 0x1e, 0x3b, 0x9c, 0xbe, 0x2f, 0x3b, 0x0f, 0xc9, 0x7f, 0x3b,
-  0xf1, 0x2d, 0x23, 0x3b, 0x04, 0xff, 0x72, 0x3b, 0xac, 0xb3, 0x82, 0x3b,
-  0x22, 0x7f, 0x56, 0x3b, 0x33, 0x7b, 0x6e, 0x3b, 0xe0, 0xd5, 0x84, 0x3b,
-  0x39, 0x4c, 0x7a, 0x3b, 0x53, 0x91, 0x86, 0x3b, 0x78, 0xbf, 0x48, 0x3b,
-  0xba, 0x8f, 0x8a, 0x3b, 0x5e, 0x7c, 0x98, 0x3b, 0x2a, 0xf2, 0x8d, 0x3b,
-  0x94, 0xed, 0x64, 0x3b, 0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f,
-  0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76,
-  0x32, 0x44, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0xda, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xe4, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x08, 0x01, 0x00, 0x00, 0xc4, 0xef, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x92, 0xcf, 0x71, 0x39, 0xf6, 0xcc, 0x40, 0x39, 0x7e, 0x14, 0x31, 0x39,
+  0xd5, 0x07, 0x11, 0x39, 0xcb, 0xd4, 0x91, 0x39, 0x97, 0xf7, 0x6d, 0x39,
+  0xcc, 0xcc, 0xa6, 0x39, 0x11, 0xac, 0x2b, 0x39, 0x6b, 0x0b, 0x4d, 0x39,
+  0xbe, 0x85, 0x47, 0x39, 0xc7, 0x45, 0xf6, 0x38, 0xb6, 0x14, 0x15, 0x39,
+  0x06, 0xcd, 0x2b, 0x39, 0xb7, 0x56, 0xa0, 0x38, 0xe4, 0x6d, 0xab, 0x38,
+  0x4d, 0xbb, 0xd8, 0x38, 0x61, 0x01, 0xc4, 0x38, 0xde, 0xd9, 0x59, 0x39,
+  0x62, 0x76, 0x4f, 0x39, 0x8b, 0x57, 0x98, 0x38, 0xf9, 0x22, 0x13, 0x39,
+  0x7f, 0x09, 0x61, 0x39, 0x3e, 0x03, 0x79, 0x39, 0x02, 0x2f, 0x35, 0x39,
+  0xc1, 0xed, 0xca, 0x39, 0xdc, 0xbd, 0xf9, 0x38, 0x15, 0x6d, 0x96, 0x39,
+  0x90, 0x6b, 0x1a, 0x39, 0xf7, 0xd1, 0xd4, 0x38, 0xb2, 0xe0, 0xfa, 0x38,
+  0xa9, 0x2e, 0xb0, 0x39, 0x02, 0xc0, 0x0e, 0x39, 0xec, 0x55, 0x33, 0x39,
+  0xe6, 0x2b, 0x98, 0x39, 0xbb, 0x3e, 0x44, 0x39, 0xcd, 0xe5, 0xa1, 0x39,
+  0x90, 0x86, 0x11, 0x39, 0x2f, 0x85, 0x2e, 0x39, 0x36, 0xec, 0xad, 0x39,
+  0xeb, 0xad, 0xd5, 0x38, 0xc5, 0x2c, 0x0b, 0x39, 0xa9, 0x3e, 0x7f, 0x39,
+  0xc9, 0x61, 0x38, 0x39, 0xfa, 0x8d, 0x9f, 0x38, 0x59, 0x96, 0xd4, 0x38,
+  0x65, 0x4e, 0xd3, 0x38, 0xe8, 0xfc, 0x7a, 0x39, 0xc1, 0xbd, 0xc3, 0x38,
+  0xaa, 0x73, 0x81, 0x39, 0x29, 0xb8, 0x02, 0x39, 0x07, 0x5c, 0x02, 0x39,
+  0xd8, 0x56, 0xf0, 0x38, 0xb6, 0x48, 0xcd, 0x38, 0xeb, 0xf0, 0xea, 0x38,
+  0xd2, 0x87, 0xfb, 0x38, 0x7b, 0x2f, 0x28, 0x39, 0xa3, 0xdd, 0x3e, 0x39,
+  0x3b, 0xca, 0x42, 0x39, 0x77, 0xe0, 0x9c, 0x38, 0x8d, 0x7f, 0x1c, 0x39,
+  0x0b, 0x44, 0x12, 0x39, 0x2f, 0x28, 0x09, 0x39, 0x24, 0x50, 0xad, 0x38,
+  0x7c, 0x31, 0xc2, 0x38, 0x68, 0x61, 0x2d, 0x39, 0x50, 0x9c, 0x78, 0x39,
+  0xa4, 0xe3, 0xb9, 0x39, 0x86, 0xcb, 0x33, 0x39, 0xca, 0xd7, 0x59, 0x39,
+  0xa4, 0x29, 0x12, 0x39, 0x0b, 0xda, 0x40, 0x39, 0x50, 0x5b, 0xc2, 0x38,
+  0x05, 0xd1, 0x94, 0x38, 0x47, 0xff, 0x59, 0x39, 0x11, 0x76, 0xb2, 0x39,
+  0x55, 0xf0, 0xc2, 0x38, 0x2a, 0x62, 0x0b, 0x39, 0x48, 0xfe, 0x2e, 0x39,
+  0x98, 0x99, 0x04, 0x39, 0xa0, 0x51, 0x67, 0x39, 0x65, 0x73, 0x86, 0x39,
+  0x47, 0x11, 0xc2, 0x38, 0x4a, 0x5b, 0x5d, 0x39, 0x74, 0x02, 0x4b, 0x39,
+  0x86, 0x18, 0xc5, 0x38, 0xfc, 0x21, 0x24, 0x39, 0x93, 0x8f, 0x1d, 0x39,
+  0xf4, 0x13, 0x1b, 0x39, 0xf8, 0x2d, 0xa5, 0x39, 0xbe, 0xbe, 0xe5, 0x38,
+  0xa3, 0x4a, 0xe8, 0x38, 0xe5, 0x3f, 0x25, 0x39, 0xad, 0xc7, 0x47, 0x39,
+  0xc1, 0xc3, 0x81, 0x39, 0x4f, 0x11, 0x74, 0x39, 0xb9, 0x86, 0x53, 0x39,
+  0x2d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x77, 0x69, 0x73, 0x65, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73,
+  0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56,
+  0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0xb2, 0xee, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0xe4, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xfc, 0x00, 0x00, 0x00, 0x9c, 0xee, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
   0x88, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4396,21 +4498,21 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0xca, 0x3d, 0x6e, 0x38,
-  0x48, 0x53, 0x84, 0x38, 0x63, 0x97, 0xc0, 0x38, 0xa4, 0xba, 0x75, 0x38,
-  0x39, 0xf6, 0xb6, 0x38, 0x55, 0xd2, 0xc4, 0x38, 0xdb, 0x80, 0xa1, 0x38,
-  0xf6, 0x8f, 0xb3, 0x38, 0xd9, 0x08, 0xc8, 0x38, 0xa1, 0x75, 0xbc, 0x38,
-  0xa1, 0xa4, 0xca, 0x38, 0xc1, 0x26, 0x97, 0x38, 0x40, 0xa8, 0xd0, 0x38,
-  0x2d, 0xa0, 0xe5, 0x38, 0x00, 0xc1, 0xd5, 0x38, 0x8e, 0x5e, 0xac, 0x38,
-  0x2b, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x08, 0x35, 0x1e, 0x3b,
+  0x9c, 0xbe, 0x2f, 0x3b, 0x0f, 0xc9, 0x7f, 0x3b, 0xf1, 0x2d, 0x23, 0x3b,
+  0x04, 0xff, 0x72, 0x3b, 0xac, 0xb3, 0x82, 0x3b, 0x22, 0x7f, 0x56, 0x3b,
+  0x33, 0x7b, 0x6e, 0x3b, 0xe0, 0xd5, 0x84, 0x3b, 0x39, 0x4c, 0x7a, 0x3b,
+  0x53, 0x91, 0x86, 0x3b, 0x78, 0xbf, 0x48, 0x3b, 0xba, 0x8f, 0x8a, 0x3b,
+  0x5e, 0x7c, 0x98, 0x3b, 0x2a, 0xf2, 0x8d, 0x3b, 0x94, 0xed, 0x64, 0x3b,
+  0x1e, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
   0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a,
-  0x65, 0x63, 0x74, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64,
-  0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0xf1, 0xff, 0xff,
-  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbc, 0x04, 0x00, 0x00,
-  0xec, 0xf0, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x65, 0x63, 0x74, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xda, 0xef, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0x00,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x01, 0x00, 0x00,
+  0xc4, 0xef, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4421,6 +4523,20 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0xca, 0x3d, 0x6e, 0x38, 0x48, 0x53, 0x84, 0x38,
+  0x63, 0x97, 0xc0, 0x38, 0xa4, 0xba, 0x75, 0x38, 0x39, 0xf6, 0xb6, 0x38,
+  0x55, 0xd2, 0xc4, 0x38, 0xdb, 0x80, 0xa1, 0x38, 0xf6, 0x8f, 0xb3, 0x38,
+  0xd9, 0x08, 0xc8, 0x38, 0xa1, 0x75, 0xbc, 0x38, 0xa1, 0xa4, 0xca, 0x38,
+  0xc1, 0x26, 0x97, 0x38, 0x40, 0xa8, 0xd0, 0x38, 0x2d, 0xa0, 0xe5, 0x38,
+  0x00, 0xc1, 0xd5, 0x38, 0x8e, 0x5e, 0xac, 0x38, 0x2b, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x35, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x5f,
+  0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63,
+  0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x02, 0xf1, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
+  0x14, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xbc, 0x04, 0x00, 0x00, 0xec, 0xf0, 0xff, 0xff,
+  0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4474,47 +4590,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x76, 0x83, 0xe6, 0x3a,
-  0x80, 0xfe, 0x55, 0x3b, 0xde, 0x9a, 0xeb, 0x3a, 0x85, 0x58, 0x13, 0x3b,
-  0xe9, 0xea, 0xd4, 0x3a, 0x6d, 0x67, 0x14, 0x3b, 0xb8, 0xbb, 0xea, 0x3a,
-  0x97, 0x2a, 0x19, 0x3b, 0xfe, 0xc8, 0x17, 0x3b, 0xbf, 0x57, 0x0e, 0x3b,
-  0xc6, 0x24, 0xf7, 0x3a, 0xef, 0x03, 0x33, 0x3b, 0x04, 0x07, 0xdb, 0x3a,
-  0x26, 0x44, 0xa5, 0x3a, 0xd6, 0x86, 0x27, 0x3b, 0x9d, 0x0b, 0x27, 0x3b,
-  0x0f, 0xf0, 0x4a, 0x3b, 0xb3, 0x45, 0x2e, 0x3b, 0x95, 0x4a, 0x20, 0x3b,
-  0x17, 0xf1, 0xd3, 0x3a, 0x23, 0x63, 0x12, 0x3b, 0xc9, 0x9b, 0xe2, 0x3a,
-  0x7d, 0x27, 0x0b, 0x3b, 0xb5, 0xb1, 0x1d, 0x3b, 0xfe, 0x71, 0x0e, 0x3b,
-  0x2d, 0xe7, 0x0f, 0x3b, 0x4e, 0xe5, 0x2a, 0x3b, 0xfb, 0xcf, 0x0f, 0x3b,
-  0x28, 0x15, 0x93, 0x3a, 0x0b, 0x72, 0x20, 0x3b, 0x97, 0x71, 0xb9, 0x3a,
-  0xbf, 0x5b, 0x4e, 0x3b, 0xa8, 0xbf, 0x0e, 0x3b, 0xc5, 0x57, 0xfb, 0x3a,
-  0xe9, 0x74, 0xb2, 0x3a, 0x20, 0x6d, 0xd9, 0x3a, 0x04, 0x99, 0x13, 0x3b,
-  0xde, 0xbd, 0x28, 0x3b, 0x0d, 0xed, 0xe1, 0x3a, 0x47, 0x43, 0xed, 0x3a,
-  0x63, 0x65, 0xec, 0x3a, 0x61, 0xab, 0xc2, 0x3a, 0xb2, 0x3a, 0x16, 0x3b,
-  0xcb, 0x3e, 0x01, 0x3b, 0xa2, 0x6f, 0x23, 0x3b, 0x8b, 0xc3, 0xdf, 0x3a,
-  0xe4, 0x4f, 0x14, 0x3b, 0x4f, 0xc2, 0x1f, 0x3b, 0x0c, 0x9b, 0xe7, 0x3a,
-  0xda, 0xc3, 0x18, 0x3b, 0x32, 0x69, 0x2a, 0x3b, 0x09, 0x30, 0xf8, 0x3a,
-  0x94, 0x1d, 0xd5, 0x3a, 0x25, 0xc2, 0x11, 0x3b, 0x49, 0xc0, 0xd2, 0x3a,
-  0x61, 0x56, 0x11, 0x3b, 0xbb, 0xb4, 0xc7, 0x3a, 0x77, 0xa6, 0x03, 0x3b,
-  0x4c, 0x1c, 0x15, 0x3b, 0x08, 0xc0, 0xf6, 0x3a, 0x18, 0x64, 0x49, 0x3b,
-  0x4a, 0xff, 0x1b, 0x3b, 0x9c, 0xc8, 0x4a, 0x3b, 0x91, 0x42, 0xda, 0x3a,
-  0x00, 0x4a, 0xdb, 0x3a, 0x8d, 0x5e, 0x12, 0x3b, 0xd9, 0xea, 0xc4, 0x3a,
-  0x73, 0x16, 0xe4, 0x3a, 0xcd, 0x91, 0xf6, 0x3a, 0x8a, 0xc4, 0x15, 0x3b,
-  0x1c, 0x89, 0xc3, 0x3a, 0xcb, 0xad, 0xb6, 0x3a, 0x36, 0x75, 0xc0, 0x3a,
-  0x8e, 0xe5, 0x3b, 0x3b, 0xa6, 0x0d, 0xc6, 0x3a, 0x0e, 0x0b, 0x7d, 0x3a,
-  0x6c, 0x24, 0x43, 0x3b, 0x5d, 0xe4, 0x34, 0x3b, 0x52, 0x60, 0x2f, 0x3b,
-  0xbe, 0x1e, 0xde, 0x3a, 0x19, 0xfc, 0x86, 0x3a, 0xb4, 0x88, 0xcf, 0x3a,
-  0xec, 0xd8, 0x1f, 0x3b, 0x95, 0xae, 0x22, 0x3b, 0xde, 0xf3, 0xfe, 0x3a,
-  0xbb, 0x30, 0xea, 0x3a, 0x8a, 0xd9, 0xf4, 0x3a, 0x6f, 0x14, 0x15, 0x3b,
-  0xd2, 0x31, 0x2f, 0x3b, 0xab, 0x31, 0x26, 0x3b, 0xc2, 0x8a, 0xfb, 0x3a,
-  0x3c, 0x86, 0x2d, 0x3b, 0x5f, 0x32, 0x0a, 0x3b, 0xf0, 0xa8, 0xde, 0x3a,
-  0x83, 0x73, 0x36, 0x3b, 0x4a, 0x46, 0xe2, 0x3a, 0x1d, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
-  0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0xea, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0xa4, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0xc8, 0x04, 0x00, 0x00, 0xd4, 0xf5, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4526,6 +4601,47 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x76, 0x83, 0xe6, 0x3a, 0x80, 0xfe, 0x55, 0x3b,
+  0xde, 0x9a, 0xeb, 0x3a, 0x85, 0x58, 0x13, 0x3b, 0xe9, 0xea, 0xd4, 0x3a,
+  0x6d, 0x67, 0x14, 0x3b, 0xb8, 0xbb, 0xea, 0x3a, 0x97, 0x2a, 0x19, 0x3b,
+  0xfe, 0xc8, 0x17, 0x3b, 0xbf, 0x57, 0x0e, 0x3b, 0xc6, 0x24, 0xf7, 0x3a,
+  0xef, 0x03, 0x33, 0x3b, 0x04, 0x07, 0xdb, 0x3a, 0x26, 0x44, 0xa5, 0x3a,
+  0xd6, 0x86, 0x27, 0x3b, 0x9d, 0x0b, 0x27, 0x3b, 0x0f, 0xf0, 0x4a, 0x3b,
+  0xb3, 0x45, 0x2e, 0x3b, 0x95, 0x4a, 0x20, 0x3b, 0x17, 0xf1, 0xd3, 0x3a,
+  0x23, 0x63, 0x12, 0x3b, 0xc9, 0x9b, 0xe2, 0x3a, 0x7d, 0x27, 0x0b, 0x3b,
+  0xb5, 0xb1, 0x1d, 0x3b, 0xfe, 0x71, 0x0e, 0x3b, 0x2d, 0xe7, 0x0f, 0x3b,
+  0x4e, 0xe5, 0x2a, 0x3b, 0xfb, 0xcf, 0x0f, 0x3b, 0x28, 0x15, 0x93, 0x3a,
+  0x0b, 0x72, 0x20, 0x3b, 0x97, 0x71, 0xb9, 0x3a, 0xbf, 0x5b, 0x4e, 0x3b,
+  0xa8, 0xbf, 0x0e, 0x3b, 0xc5, 0x57, 0xfb, 0x3a, 0xe9, 0x74, 0xb2, 0x3a,
+  0x20, 0x6d, 0xd9, 0x3a, 0x04, 0x99, 0x13, 0x3b, 0xde, 0xbd, 0x28, 0x3b,
+  0x0d, 0xed, 0xe1, 0x3a, 0x47, 0x43, 0xed, 0x3a, 0x63, 0x65, 0xec, 0x3a,
+  0x61, 0xab, 0xc2, 0x3a, 0xb2, 0x3a, 0x16, 0x3b, 0xcb, 0x3e, 0x01, 0x3b,
+  0xa2, 0x6f, 0x23, 0x3b, 0x8b, 0xc3, 0xdf, 0x3a, 0xe4, 0x4f, 0x14, 0x3b,
+  0x4f, 0xc2, 0x1f, 0x3b, 0x0c, 0x9b, 0xe7, 0x3a, 0xda, 0xc3, 0x18, 0x3b,
+  0x32, 0x69, 0x2a, 0x3b, 0x09, 0x30, 0xf8, 0x3a, 0x94, 0x1d, 0xd5, 0x3a,
+  0x25, 0xc2, 0x11, 0x3b, 0x49, 0xc0, 0xd2, 0x3a, 0x61, 0x56, 0x11, 0x3b,
+  0xbb, 0xb4, 0xc7, 0x3a, 0x77, 0xa6, 0x03, 0x3b, 0x4c, 0x1c, 0x15, 0x3b,
+  0x08, 0xc0, 0xf6, 0x3a, 0x18, 0x64, 0x49, 0x3b, 0x4a, 0xff, 0x1b, 0x3b,
+  0x9c, 0xc8, 0x4a, 0x3b, 0x91, 0x42, 0xda, 0x3a, 0x00, 0x4a, 0xdb, 0x3a,
+  0x8d, 0x5e, 0x12, 0x3b, 0xd9, 0xea, 0xc4, 0x3a, 0x73, 0x16, 0xe4, 0x3a,
+  0xcd, 0x91, 0xf6, 0x3a, 0x8a, 0xc4, 0x15, 0x3b, 0x1c, 0x89, 0xc3, 0x3a,
+  0xcb, 0xad, 0xb6, 0x3a, 0x36, 0x75, 0xc0, 0x3a, 0x8e, 0xe5, 0x3b, 0x3b,
+  0xa6, 0x0d, 0xc6, 0x3a, 0x0e, 0x0b, 0x7d, 0x3a, 0x6c, 0x24, 0x43, 0x3b,
+  0x5d, 0xe4, 0x34, 0x3b, 0x52, 0x60, 0x2f, 0x3b, 0xbe, 0x1e, 0xde, 0x3a,
+  0x19, 0xfc, 0x86, 0x3a, 0xb4, 0x88, 0xcf, 0x3a, 0xec, 0xd8, 0x1f, 0x3b,
+  0x95, 0xae, 0x22, 0x3b, 0xde, 0xf3, 0xfe, 0x3a, 0xbb, 0x30, 0xea, 0x3a,
+  0x8a, 0xd9, 0xf4, 0x3a, 0x6f, 0x14, 0x15, 0x3b, 0xd2, 0x31, 0x2f, 0x3b,
+  0xab, 0x31, 0x26, 0x3b, 0xc2, 0x8a, 0xfb, 0x3a, 0x3c, 0x86, 0x2d, 0x3b,
+  0x5f, 0x32, 0x0a, 0x3b, 0xf0, 0xa8, 0xde, 0x3a, 0x83, 0x73, 0x36, 0x3b,
+  0x4a, 0x46, 0xe2, 0x3a, 0x1d, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f,
+  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
+  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0xea, 0xf5, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0xa4, 0x04, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xc8, 0x04, 0x00, 0x00, 0xd4, 0xf5, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x08, 0x03, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4579,47 +4695,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x60, 0x00, 0x00, 0x00, 0x52, 0x62, 0x2a, 0x39, 0x7c, 0x2c, 0x9e, 0x39,
-  0xbc, 0x25, 0x2e, 0x39, 0x3e, 0xd2, 0x59, 0x39, 0xc8, 0x60, 0x1d, 0x39,
-  0xb9, 0x62, 0x5b, 0x39, 0xcb, 0x80, 0x2d, 0x39, 0x04, 0x6d, 0x62, 0x39,
-  0x4a, 0x62, 0x60, 0x39, 0xe0, 0x6c, 0x52, 0x39, 0x1d, 0xad, 0x36, 0x39,
-  0xb7, 0x51, 0x84, 0x39, 0xe4, 0xe4, 0x21, 0x39, 0x23, 0x50, 0xf4, 0x38,
-  0x9c, 0xa7, 0x77, 0x39, 0x73, 0xf1, 0x76, 0x39, 0x5d, 0x00, 0x96, 0x39,
-  0x37, 0xd0, 0x80, 0x39, 0x6c, 0xf5, 0x6c, 0x39, 0x21, 0xa8, 0x1c, 0x39,
-  0x7e, 0x67, 0x58, 0x39, 0x69, 0x7f, 0x27, 0x39, 0x34, 0xb6, 0x4d, 0x39,
-  0x89, 0x1e, 0x69, 0x39, 0xad, 0x93, 0x52, 0x39, 0x5a, 0xbb, 0x54, 0x39,
-  0x99, 0xa2, 0x7c, 0x39, 0x10, 0x99, 0x54, 0x39, 0xa9, 0x6e, 0xd9, 0x38,
-  0xc2, 0x2f, 0x6d, 0x39, 0x1a, 0x12, 0x09, 0x39, 0xa1, 0x87, 0x98, 0x39,
-  0x7c, 0x06, 0x53, 0x39, 0xb2, 0xc7, 0x39, 0x39, 0x00, 0xe8, 0x03, 0x39,
-  0xeb, 0xb5, 0x20, 0x39, 0x96, 0x31, 0x5a, 0x39, 0x68, 0x73, 0x79, 0x39,
-  0x41, 0xfe, 0x26, 0x39, 0x70, 0x5f, 0x2f, 0x39, 0x6d, 0xbb, 0x2e, 0x39,
-  0xd2, 0xe3, 0x0f, 0x39, 0x7d, 0x15, 0x5e, 0x39, 0x35, 0x10, 0x3f, 0x39,
-  0x87, 0x9b, 0x71, 0x39, 0x21, 0x65, 0x25, 0x39, 0xef, 0x3f, 0x5b, 0x39,
-  0xf8, 0x2b, 0x6c, 0x39, 0xfa, 0x30, 0x2b, 0x39, 0x23, 0xd5, 0x61, 0x39,
-  0x20, 0xeb, 0x7b, 0x39, 0xa9, 0x72, 0x37, 0x39, 0x3c, 0x86, 0x1d, 0x39,
-  0x80, 0x79, 0x57, 0x39, 0xd5, 0xc6, 0x1b, 0x39, 0x30, 0xda, 0x56, 0x39,
-  0xd8, 0x9c, 0x13, 0x39, 0x5a, 0x9e, 0x42, 0x39, 0x1b, 0x6e, 0x5c, 0x39,
-  0xa6, 0x62, 0x36, 0x39, 0xb0, 0xdb, 0x94, 0x39, 0x56, 0x9c, 0x66, 0x39,
-  0x34, 0xe3, 0x95, 0x39, 0xaf, 0x53, 0x21, 0x39, 0x67, 0x16, 0x22, 0x39,
-  0xb7, 0x60, 0x58, 0x39, 0x2d, 0x8d, 0x11, 0x39, 0x4d, 0x97, 0x28, 0x39,
-  0x7a, 0x40, 0x36, 0x39, 0xd1, 0x66, 0x5d, 0x39, 0xb6, 0x87, 0x10, 0x39,
-  0xef, 0x06, 0x07, 0x39, 0x56, 0x41, 0x0e, 0x39, 0x43, 0xe2, 0x8a, 0x39,
-  0x1f, 0x64, 0x12, 0x39, 0x70, 0x09, 0xbb, 0x38, 0x4a, 0x3d, 0x90, 0x39,
-  0xd3, 0xb4, 0x85, 0x39, 0x1d, 0xa1, 0x81, 0x39, 0x18, 0x2e, 0x24, 0x39,
-  0x47, 0x8c, 0xc7, 0x38, 0x15, 0x66, 0x19, 0x39, 0x66, 0x4d, 0x6c, 0x39,
-  0x24, 0x7e, 0x70, 0x39, 0xbe, 0x72, 0x3c, 0x39, 0x0f, 0x1a, 0x2d, 0x39,
-  0x0f, 0xfb, 0x34, 0x39, 0x7b, 0x62, 0x5c, 0x39, 0xbe, 0x7e, 0x81, 0x39,
-  0x43, 0xaf, 0x75, 0x39, 0x62, 0xed, 0x39, 0x39, 0xb2, 0x42, 0x80, 0x39,
-  0xd8, 0x4b, 0x4c, 0x39, 0x3e, 0x94, 0x24, 0x39, 0xdb, 0xdb, 0x86, 0x39,
-  0x37, 0x40, 0x27, 0x39, 0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f,
-  0x65, 0x78, 0x70, 0x61, 0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75,
-  0x73, 0x65, 0x64, 0x42, 0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d,
-  0x56, 0x33, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0xd2, 0xfa, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa8, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0xb4, 0x01, 0x00, 0x00, 0xbc, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x0c, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4630,6 +4705,48 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
+  0x52, 0x62, 0x2a, 0x39, 0x7c, 0x2c, 0x9e, 0x39, 0xbc, 0x25, 0x2e, 0x39,
+  0x3e, 0xd2, 0x59, 0x39, 0xc8, 0x60, 0x1d, 0x39, 0xb9, 0x62, 0x5b, 0x39,
+  0xcb, 0x80, 0x2d, 0x39, 0x04, 0x6d, 0x62, 0x39, 0x4a, 0x62, 0x60, 0x39,
+  0xe0, 0x6c, 0x52, 0x39, 0x1d, 0xad, 0x36, 0x39, 0xb7, 0x51, 0x84, 0x39,
+  0xe4, 0xe4, 0x21, 0x39, 0x23, 0x50, 0xf4, 0x38, 0x9c, 0xa7, 0x77, 0x39,
+  0x73, 0xf1, 0x76, 0x39, 0x5d, 0x00, 0x96, 0x39, 0x37, 0xd0, 0x80, 0x39,
+  0x6c, 0xf5, 0x6c, 0x39, 0x21, 0xa8, 0x1c, 0x39, 0x7e, 0x67, 0x58, 0x39,
+  0x69, 0x7f, 0x27, 0x39, 0x34, 0xb6, 0x4d, 0x39, 0x89, 0x1e, 0x69, 0x39,
+  0xad, 0x93, 0x52, 0x39, 0x5a, 0xbb, 0x54, 0x39, 0x99, 0xa2, 0x7c, 0x39,
+  0x10, 0x99, 0x54, 0x39, 0xa9, 0x6e, 0xd9, 0x38, 0xc2, 0x2f, 0x6d, 0x39,
+  0x1a, 0x12, 0x09, 0x39, 0xa1, 0x87, 0x98, 0x39, 0x7c, 0x06, 0x53, 0x39,
+  0xb2, 0xc7, 0x39, 0x39, 0x00, 0xe8, 0x03, 0x39, 0xeb, 0xb5, 0x20, 0x39,
+  0x96, 0x31, 0x5a, 0x39, 0x68, 0x73, 0x79, 0x39, 0x41, 0xfe, 0x26, 0x39,
+  0x70, 0x5f, 0x2f, 0x39, 0x6d, 0xbb, 0x2e, 0x39, 0xd2, 0xe3, 0x0f, 0x39,
+  0x7d, 0x15, 0x5e, 0x39, 0x35, 0x10, 0x3f, 0x39, 0x87, 0x9b, 0x71, 0x39,
+  0x21, 0x65, 0x25, 0x39, 0xef, 0x3f, 0x5b, 0x39, 0xf8, 0x2b, 0x6c, 0x39,
+  0xfa, 0x30, 0x2b, 0x39, 0x23, 0xd5, 0x61, 0x39, 0x20, 0xeb, 0x7b, 0x39,
+  0xa9, 0x72, 0x37, 0x39, 0x3c, 0x86, 0x1d, 0x39, 0x80, 0x79, 0x57, 0x39,
+  0xd5, 0xc6, 0x1b, 0x39, 0x30, 0xda, 0x56, 0x39, 0xd8, 0x9c, 0x13, 0x39,
+  0x5a, 0x9e, 0x42, 0x39, 0x1b, 0x6e, 0x5c, 0x39, 0xa6, 0x62, 0x36, 0x39,
+  0xb0, 0xdb, 0x94, 0x39, 0x56, 0x9c, 0x66, 0x39, 0x34, 0xe3, 0x95, 0x39,
+  0xaf, 0x53, 0x21, 0x39, 0x67, 0x16, 0x22, 0x39, 0xb7, 0x60, 0x58, 0x39,
+  0x2d, 0x8d, 0x11, 0x39, 0x4d, 0x97, 0x28, 0x39, 0x7a, 0x40, 0x36, 0x39,
+  0xd1, 0x66, 0x5d, 0x39, 0xb6, 0x87, 0x10, 0x39, 0xef, 0x06, 0x07, 0x39,
+  0x56, 0x41, 0x0e, 0x39, 0x43, 0xe2, 0x8a, 0x39, 0x1f, 0x64, 0x12, 0x39,
+  0x70, 0x09, 0xbb, 0x38, 0x4a, 0x3d, 0x90, 0x39, 0xd3, 0xb4, 0x85, 0x39,
+  0x1d, 0xa1, 0x81, 0x39, 0x18, 0x2e, 0x24, 0x39, 0x47, 0x8c, 0xc7, 0x38,
+  0x15, 0x66, 0x19, 0x39, 0x66, 0x4d, 0x6c, 0x39, 0x24, 0x7e, 0x70, 0x39,
+  0xbe, 0x72, 0x3c, 0x39, 0x0f, 0x1a, 0x2d, 0x39, 0x0f, 0xfb, 0x34, 0x39,
+  0x7b, 0x62, 0x5c, 0x39, 0xbe, 0x7e, 0x81, 0x39, 0x43, 0xaf, 0x75, 0x39,
+  0x62, 0xed, 0x39, 0x39, 0xb2, 0x42, 0x80, 0x39, 0xd8, 0x4b, 0x4c, 0x39,
+  0x3e, 0x94, 0x24, 0x39, 0xdb, 0xdb, 0x86, 0x39, 0x37, 0x40, 0x27, 0x39,
+  0x2a, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x36, 0x5f, 0x65, 0x78, 0x70, 0x61,
+  0x6e, 0x64, 0x5f, 0x42, 0x4e, 0x2f, 0x46, 0x75, 0x73, 0x65, 0x64, 0x42,
+  0x61, 0x74, 0x63, 0x68, 0x4e, 0x6f, 0x72, 0x6d, 0x56, 0x33, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xd2, 0xfa, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xb4, 0x01, 0x00, 0x00,
+  0xbc, 0xfa, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4641,25 +4758,6 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x98, 0x1e, 0x3b,
-  0xe1, 0x0e, 0x13, 0x3b, 0xca, 0xa7, 0x42, 0x3b, 0xd2, 0x78, 0x22, 0x3b,
-  0x45, 0x17, 0x07, 0x3b, 0xf3, 0x52, 0x57, 0x3b, 0x35, 0x9e, 0x58, 0x3b,
-  0x9c, 0x7a, 0x00, 0x3b, 0xe1, 0xf9, 0x12, 0x3b, 0x53, 0xf9, 0x65, 0x3b,
-  0x97, 0xa9, 0xf6, 0x3a, 0xf7, 0xeb, 0xd2, 0x3b, 0xce, 0x27, 0x23, 0x3b,
-  0xe7, 0xc4, 0x26, 0x3b, 0x0e, 0x06, 0x10, 0x3b, 0xfc, 0x96, 0x08, 0x3b,
-  0x45, 0x5b, 0x08, 0x3b, 0x98, 0xa2, 0x46, 0x3b, 0x6d, 0xc8, 0x65, 0x3b,
-  0x94, 0x63, 0xf6, 0x3a, 0x9c, 0xd7, 0x12, 0x3b, 0x8a, 0xb9, 0x1c, 0x3b,
-  0x44, 0x48, 0x25, 0x3b, 0x50, 0xa9, 0x0b, 0x3b, 0x2b, 0xb5, 0x1f, 0x3b,
-  0xa8, 0x1e, 0x36, 0x3b, 0x23, 0x22, 0x2f, 0x3b, 0x34, 0x9d, 0xf4, 0x3a,
-  0xb6, 0x5c, 0xe3, 0x3a, 0x25, 0xe6, 0x0c, 0x3b, 0x97, 0x8e, 0x31, 0x3b,
-  0x55, 0x5e, 0x18, 0x3b, 0x13, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x2f, 0x43, 0x6f, 0x6e,
-  0x76, 0x32, 0x44, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0xb2, 0xfc, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0xa4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0xc0, 0x01, 0x00, 0x00, 0x9c, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4670,6 +4768,25 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x0c, 0x98, 0x1e, 0x3b, 0xe1, 0x0e, 0x13, 0x3b,
+  0xca, 0xa7, 0x42, 0x3b, 0xd2, 0x78, 0x22, 0x3b, 0x45, 0x17, 0x07, 0x3b,
+  0xf3, 0x52, 0x57, 0x3b, 0x35, 0x9e, 0x58, 0x3b, 0x9c, 0x7a, 0x00, 0x3b,
+  0xe1, 0xf9, 0x12, 0x3b, 0x53, 0xf9, 0x65, 0x3b, 0x97, 0xa9, 0xf6, 0x3a,
+  0xf7, 0xeb, 0xd2, 0x3b, 0xce, 0x27, 0x23, 0x3b, 0xe7, 0xc4, 0x26, 0x3b,
+  0x0e, 0x06, 0x10, 0x3b, 0xfc, 0x96, 0x08, 0x3b, 0x45, 0x5b, 0x08, 0x3b,
+  0x98, 0xa2, 0x46, 0x3b, 0x6d, 0xc8, 0x65, 0x3b, 0x94, 0x63, 0xf6, 0x3a,
+  0x9c, 0xd7, 0x12, 0x3b, 0x8a, 0xb9, 0x1c, 0x3b, 0x44, 0x48, 0x25, 0x3b,
+  0x50, 0xa9, 0x0b, 0x3b, 0x2b, 0xb5, 0x1f, 0x3b, 0xa8, 0x1e, 0x36, 0x3b,
+  0x23, 0x22, 0x2f, 0x3b, 0x34, 0x9d, 0xf4, 0x3a, 0xb6, 0x5c, 0xe3, 0x3a,
+  0x25, 0xe6, 0x0c, 0x3b, 0x97, 0x8e, 0x31, 0x3b, 0x55, 0x5e, 0x18, 0x3b,
+  0x13, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x68, 0x65, 0x61, 0x64, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0xb2, 0xfc, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc0, 0x01, 0x00, 0x00,
+  0x9c, 0xfc, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -4681,74 +4798,84 @@ MODEL_SECTION(EI_MODEL_SECTION) ALIGN(16) const unsigned char tflite_learn_27[]
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0xe5, 0xd2, 0x6e, 0x38, 0xc6, 0x73, 0x5d, 0x38,
-  0x68, 0x90, 0x92, 0x38, 0xe5, 0xa9, 0x74, 0x38, 0x56, 0x6e, 0x4b, 0x38,
-  0x57, 0x20, 0xa2, 0x38, 0xc2, 0x19, 0xa3, 0x38, 0x64, 0x79, 0x41, 0x38,
-  0x26, 0x54, 0x5d, 0x38, 0x27, 0x28, 0xad, 0x38, 0xea, 0xb8, 0x39, 0x38,
-  0xc9, 0xcf, 0x1e, 0x39, 0x67, 0xb1, 0x75, 0x38, 0x7d, 0x22, 0x7b, 0x38,
-  0xf7, 0xe1, 0x58, 0x38, 0x2a, 0xb0, 0x4d, 0x38, 0x3e, 0x56, 0x4d, 0x38,
-  0x82, 0x8f, 0x95, 0x38, 0x55, 0x03, 0xad, 0x38, 0x33, 0x84, 0x39, 0x38,
-  0x8b, 0x20, 0x5d, 0x38, 0x52, 0x02, 0x6c, 0x38, 0x4c, 0xe5, 0x78, 0x38,
-  0x49, 0x50, 0x52, 0x38, 0x41, 0x80, 0x70, 0x38, 0x1e, 0x20, 0x89, 0x38,
-  0x78, 0xdd, 0x83, 0x38, 0x15, 0x2e, 0x38, 0x38, 0xb9, 0x30, 0x2b, 0x38,
-  0x65, 0x2d, 0x54, 0x38, 0xa2, 0xb0, 0x85, 0x38, 0xf3, 0x72, 0x65, 0x38,
-  0x23, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x68, 0x65, 0x61, 0x64, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64,
-  0x2f, 0x52, 0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c,
-  0x65, 0x4f, 0x70, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
-  0x92, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x5c, 0x00, 0x00, 0x00, 0x7c, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
-  0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x86, 0x32, 0xbf, 0x3b, 0xb8, 0x2c, 0x61, 0x3b,
-  0xa2, 0xbe, 0x61, 0x3b, 0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
-  0x6c, 0x5f, 0x31, 0x2f, 0x6c, 0x6f, 0x67, 0x69, 0x74, 0x73, 0x2f, 0x43,
-  0x6f, 0x6e, 0x76, 0x32, 0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01,
-  0x14, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x02, 0x6c, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff,
-  0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xd4, 0x4a, 0xa5, 0x39,
-  0x85, 0xaa, 0x42, 0x39, 0xaa, 0x28, 0x43, 0x39, 0x25, 0x00, 0x00, 0x00,
-  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x6c, 0x6f, 0x67, 0x69,
-  0x74, 0x73, 0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52,
-  0x65, 0x61, 0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f,
-  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
-  0xa6, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00,
-  0x18, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
-  0x34, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x20, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
-  0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x61, 0x64, 0x2f,
-  0x50, 0x61, 0x64, 0x2f, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x73,
-  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00,
-  0x17, 0x00, 0x10, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x4c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x81, 0x80, 0x80, 0x3b, 0x13, 0x00, 0x00, 0x00,
-  0x73, 0x65, 0x72, 0x76, 0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61,
-  0x75, 0x6c, 0x74, 0x5f, 0x78, 0x3a, 0x30, 0x00, 0x04, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00,
-  0x4c, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x00, 0x00,
-  0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x19, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0xe0, 0xff, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x22, 0xf0, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x10, 0x00,
-  0x0f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0xe5, 0xd2, 0x6e, 0x38, 0xc6, 0x73, 0x5d, 0x38, 0x68, 0x90, 0x92, 0x38,
+  0xe5, 0xa9, 0x74, 0x38, 0x56, 0x6e, 0x4b, 0x38, 0x57, 0x20, 0xa2, 0x38,
+  0xc2, 0x19, 0xa3, 0x38, 0x64, 0x79, 0x41, 0x38, 0x26, 0x54, 0x5d, 0x38,
+  0x27, 0x28, 0xad, 0x38, 0xea, 0xb8, 0x39, 0x38, 0xc9, 0xcf, 0x1e, 0x39,
+  0x67, 0xb1, 0x75, 0x38, 0x7d, 0x22, 0x7b, 0x38, 0xf7, 0xe1, 0x58, 0x38,
+  0x2a, 0xb0, 0x4d, 0x38, 0x3e, 0x56, 0x4d, 0x38, 0x82, 0x8f, 0x95, 0x38,
+  0x55, 0x03, 0xad, 0x38, 0x33, 0x84, 0x39, 0x38, 0x8b, 0x20, 0x5d, 0x38,
+  0x52, 0x02, 0x6c, 0x38, 0x4c, 0xe5, 0x78, 0x38, 0x49, 0x50, 0x52, 0x38,
+  0x41, 0x80, 0x70, 0x38, 0x1e, 0x20, 0x89, 0x38, 0x78, 0xdd, 0x83, 0x38,
+  0x15, 0x2e, 0x38, 0x38, 0xb9, 0x30, 0x2b, 0x38, 0x65, 0x2d, 0x54, 0x38,
+  0xa2, 0xb0, 0x85, 0x38, 0xf3, 0x72, 0x65, 0x38, 0x23, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x68, 0x65, 0x61, 0x64,
+  0x2f, 0x42, 0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61,
+  0x64, 0x56, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x92, 0xfe, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x5c, 0x00, 0x00, 0x00,
+  0x7c, 0xfe, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x86, 0x32, 0xbf, 0x3b, 0xb8, 0x2c, 0x61, 0x3b, 0xa2, 0xbe, 0x61, 0x3b,
+  0x15, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f,
+  0x6c, 0x6f, 0x67, 0x69, 0x74, 0x73, 0x2f, 0x43, 0x6f, 0x6e, 0x76, 0x32,
+  0x44, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x1a, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x14, 0x00, 0x00, 0x00,
+  0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x6c, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x24, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0xd4, 0x4a, 0xa5, 0x39, 0x85, 0xaa, 0x42, 0x39,
+  0xaa, 0x28, 0x43, 0x39, 0x25, 0x00, 0x00, 0x00, 0x6d, 0x6f, 0x64, 0x65,
+  0x6c, 0x5f, 0x31, 0x2f, 0x6c, 0x6f, 0x67, 0x69, 0x74, 0x73, 0x2f, 0x42,
+  0x69, 0x61, 0x73, 0x41, 0x64, 0x64, 0x2f, 0x52, 0x65, 0x61, 0x64, 0x56,
+  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x4f, 0x70, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x00, 0x01, 0x18, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x00, 0x00, 0x00,
+  0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+  0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x5f, 0x31, 0x2f, 0x62, 0x6c, 0x6f, 0x63,
+  0x6b, 0x5f, 0x31, 0x5f, 0x70, 0x61, 0x64, 0x2f, 0x50, 0x61, 0x64, 0x2f,
+  0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x73, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0x00, 0x1c, 0x00, 0x18, 0x00, 0x17, 0x00, 0x10, 0x00,
+  0x0c, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0x4c, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x81, 0x80, 0x80, 0x3b, 0x13, 0x00, 0x00, 0x00, 0x73, 0x65, 0x72, 0x76,
+  0x69, 0x6e, 0x67, 0x5f, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f,
+  0x78, 0x3a, 0x30, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x60, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x05, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00,
+  0x38, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0x0e, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x00,
+  0x0c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x19, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff,
+  0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+  0xf0, 0xff, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x0c, 0x00, 0x10, 0x00, 0x0f, 0x00, 0x00, 0x00,
+  0x08, 0x00, 0x04, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03
 };
-unsigned int tflite_learn_27_len = 56328;
+unsigned int tflite_learn_27_len = 57848;
 #endif // _EI_CLASSIFIER_TFLITE_LEARN_27_H_
@@ -0,0 +1,2484 @@
+// Generated by tools/aot_compile.py from tflite_learn_27.h, do not edit
+#include "tflite_learn_27_compiled.h"
+#include <string.h>
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/classifier/ei_profiling.h"
+#include "edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn.h"
+#if !ESP_NN
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/softmax.h"
+#endif
+
+#ifndef EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE
+#define EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE        0
+#endif
+
+namespace {
+
+typedef struct {
+    uint8_t input;
+    uint8_t output;
+    const int8_t *filter;
+    const int32_t *bias;
+    data_dims_t input_dims;
+    data_dims_t filter_dims;
+    data_dims_t output_dims;
+    conv_params_t params;
+    const int32_t *shift;
+    const int32_t *mult;
+} conv_2d_t;
+
+typedef struct {
+    uint8_t input;
+    uint8_t output;
+    const int8_t *filter;
+    const int32_t *bias;
+    data_dims_t input_dims;
+    data_dims_t filter_dims;
+    data_dims_t output_dims;
+    dw_conv_params_t params;
+    const int32_t *shift;
+    const int32_t *mult;
+} depthwise_conv_2d_t;
+
+typedef struct {
+    uint8_t input1;
+    uint8_t input2;
+    uint8_t output;
+    int32_t input1_offset;
+    int32_t input2_offset;
+    int32_t input1_multiplier;
+    int32_t input2_multiplier;
+    int32_t input1_shift;
+    int32_t input2_shift;
+    int32_t left_shift;
+    int32_t output_offset;
+    int32_t output_multiplier;
+    int32_t output_shift;
+    int32_t activation_min;
+    int32_t activation_max;
+    int32_t size;
+} add_t;
+
+typedef struct {
+    conv_2d_t conv;
+    uint8_t add_input;
+    uint8_t output;
+    add_params_t add_params;
+} conv_2d_add_t;
+
+typedef struct {
+    uint8_t input;
+    uint8_t output;
+    int32_t input_height;
+    int32_t input_width;
+    int32_t output_width;
+    int32_t channels;
+    int32_t top;
+    int32_t bottom;
+    int32_t left;
+    int32_t value;
+} pad_t;
+
+typedef struct {
+    uint8_t input;
+    uint8_t output;
+    int32_t outer_size;
+    int32_t depth;
+    int32_t input_multiplier;
+    int32_t input_left_shift;
+    int32_t diff_min;
+    int32_t scratch_width;
+    int32_t scratch_height;
+} softmax_t;
+
+// dims of a TfLiteTensor, laid out like TfLiteIntArray
+typedef struct {
+    int size;
+    int data[4];
+} tensor_dims_t;
+
+typedef struct {
+    size_t bytes;
+    float scale;
+    int32_t zero_point;
+    tensor_dims_t dims;
+} tensor_info_t;
+
+typedef struct {
+    uint8_t tensor;
+    uint8_t fast;
+    uint32_t offset;
+} tensor_placement_t;
+
+} // namespace
+
+#define TENSORS_SIZE                                71
+#define OPERATORS_SIZE                              22
+
+// model_1/logits/BiasAdd/ReadVariableOp
+alignas(16) static const int32_t tensor_data2[3] = {
+    16910, -28002, -28955,
+};
+
+// model_1/logits/Conv2D
+alignas(16) static const int8_t tensor_data3[96] = {
+    43, 25, 85, -33, -66, 51, 66, -3, -41, -6, 32, -47, -57, -37, -21, 0,
+    -57, 127, 121, 42, -7, -29, 2, -42, -51, 46, -5, -24, 44, 17, -2, 61,
+    67, -31, -70, 20, -11, 127, -61, -3, 120, -60, 4, -126, -75, 102, 38, -46,
+    92, -125, -72, -84, -118, 31, 106, 67, 37, 5, -12, -9, -62, -56, -5, -60,
+    -23, 79, -81, 77, 72, -33, -81, 112, 95, 58, 125, -20, -110, -84, 99, 120,
+    -73, -124, -65, -110, 64, 127, -23, -76, 93, -100, -46, -110, 24, -75, 83, -2,
+};
+
+// model_1/head/BiasAdd/ReadVariableOp
+alignas(16) static const int32_t tensor_data4[32] = {
+    761, 720, -415, 248, 127, 425, 1517, 437, 344, 269, 706, 205, -128, 282, 281, 459,
+    -253, 2173, 4349, -320, -172, 263, 467, -201, 182, -459, -412, -490, -431, 113, -116, 388,
+};
+
+// model_1/head/Conv2D
+alignas(16) static const int8_t tensor_data5[3072] = {
+    -15, -58, 82, 2, 85, -22, -60, -69, 48, -59, -73, 7, 55, 25, -17, 53,
+    -32, -24, -32, -33, -43, -78, -6, 85, -57, 29, 80, -33, 103, 9, -9, -52,
+    86, -35, -55, 64, -86, -46, -42, 19, 56, -90, -60, 76, 22, -69, 86, 11,
+    -79, -39, -12, 102, -37, -46, -59, 101, 33, 64, 115, -76, -50, 90, -17, 63,
+    10, 22, 74, 75, 58, 55, 85, -78, 90, -32, 41, 85, -100, 31, -48, 37,
+    53, 3, 127, -41, -47, -44, -61, 54, 28, 78, 2, -74, 5, 28, -10, 15,
+    -39, 25, -69, -36, -14, 75, 52, -5, 56, -69, -75, 35, 60, -12, 8, 51,
+    93, -22, 22, 108, -41, 11, 48, 31, 33, 27, -32, 90, 14, 21, 115, -54,
+    46, 104, -2, 28, 56, 66, -15, -52, -13, 7, -4, -68, -26, 25, -44, -32,
+    -61, -118, 127, 35, 22, 80, -58, -57, 28, 91, 27, 81, -40, 85, -41, -56,
+    -38, 44, 53, 47, 84, 12, 20, 23, -85, 68, -26, 44, 84, -48, -23, 83,
+    -55, 68, -57, -79, 47, 108, -39, -94, 75, 85, 90, 18, 60, 93, 43, 23,
+    32, 6, -55, 45, -18, -52, 47, 63, -127, 60, -28, 87, 52, -15, 45, -71,
+    -31, -13, 21, 27, -77, -8, 57, 15, -11, 46, 69, -15, -50, 39, 48, 52,
+    -55, -17, -64, -74, -77, 57, 56, -12, -85, -43, -10, -17, -54, 68, -1, -66,
+    47, 3, 47, -60, -37, 10, 9, 5, -54, 56, -35, -6, -29, 14, -57, 34,
+    55, 15, 24, 47, -70, 27, 5, -55, 17, -42, 15, 4, -42, -18, -14, -8,
+    13, -70, 0, -39, -2, -71, -18, -26, 40, 60, -26, -3, -41, -79, -50, -27,
+    69, 9, 46, -42, -33, 30, -63, 42, 18, 28, 59, -21, 82, 82, 50, 9,
+    104, 93, -32, 23, 77, -52, -30, -60, -37, -68, -60, 101, 46, -50, 70, -12,
+    -30, -6, 5, -5, -48, -26, 48, 64, 20, -85, -38, 13, 28, -1, -33, -38,
+    47, -73, 53, -36, 81, 43, 57, -67, -80, -60, -127, -12, -60, 39, -4, 76,
+    46, -3, -45, -11, -8, -11, -2, 91, 33, -80, 56, -39, 15, 95, 90, -29,
+    -53, -107, 41, 66, 43, 57, -24, -125, -51, 53, 18, -51, 78, -63, -58, 33,
+    49, 108, 12, 31, -10, -22, 48, 40, 50, 91, 6, 12, 34, -30, -24, -42,
+    0, 19, -32, 37, 79, -61, 109, 39, -42, 11, 54, -36, -39, 56, -44, -60,
+    63, 117, 24, -96, -14, 36, -64, 69, 2, -52, -40, -53, 5, 65, 39, 84,
+    41, -65, 13, -84, -61, 73, -77, 2, 37, -60, -19, 29, 22, -60, -1, -35,
+    -40, 66, -2, -19, 36, -32, -94, -51, -28, 68, 111, 45, 60, 9, 19, -35,
+    9, -56, -52, -2, 29, 83, 80, -23, -88, -31, 64, 49, 36, 127, -62, 35,
+    63, -62, 50, 43, 31, -78, 16, 36, 67, -56, 7, -33, 22, 65, 31, 26,
+    42, 33, -39, 61, 29, 27, 6, -10, -52, -23, 3, -45, 38, 22, 9, -51,
+    -6, 9, -28, 20, -67, -20, 39, 13, -53, -55, 33, 56, -34, 11, 24, -16,
+    -127, 64, 22, 20, 32, 2, 18, 0, 66, 38, -33, -5, 24, -19, 28, -25,
+    -10, 65, -1, 20, 56, -7, 68, -30, -17, 59, -9, -31, -12, -9, 11, 54,
+    70, 15, 52, 25, -50, 27, -8, 16, 43, -65, 70, 60, -11, -1, 25, -56,
+    -31, -48, 73, 71, -54, -20, -2, -6, -74, -61, -20, -127, 48, 58, 61, -46,
+    12, -30, -3, 97, -38, -53, 78, -3, -62, -42, -27, -13, 13, -61, 13, -56,
+    -20, -74, -8, -37, 2, 43, -75, 3, 4, 77, -4, -6, -17, 65, -95, -25,
+    -52, 36, -38, -11, 38, 47, 49, -23, -2, -27, 0, -7, -38, 2, 64, -34,
+    -37, 9, 76, 15, 55, -7, -45, 4, 27, -66, -45, 25, 1, -58, -41, -2,
+    28, 1, -13, 44, -51, -5, -4, -36, 73, 73, 90, -19, -21, 9, 42, -9,
+    118, 66, -33, -80, -50, 105, -2, 2, 113, 19, -79, -32, 63, -69, 35, 69,
+    60, 31, -10, 120, 49, 52, 16, 95, -72, 109, 39, 63, -67, 120, 0, 28,
+    28, 43, 72, 97, -84, 89, -3, -13, 127, -87, 94, 80, 29, -20, 90, -91,
+    13, -88, -75, -100, -14, 101, 4, 15, 117, -66, -40, -31, 15, -2, 91, -93,
+    -61, -32, 60, 33, -95, 21, 66, 96, 93, 25, 70, 53, -54, 60, -74, 62,
+    93, -51, -7, -88, 102, 47, -98, 45, 88, 17, 97, 66, -55, -18, 11, -53,
+    20, 21, -22, -85, 63, 4, -57, -5, 27, 40, 45, 65, 15, -23, -63, -53,
+    -40, 90, -58, 28, 32, -14, 76, 108, -89, 88, 44, 73, -45, 30, -71, 90,
+    90, -14, 51, 8, 111, 18, 2, 73, 81, 55, -61, -85, -37, -35, -10, 118,
+    -28, -75, -22, -3, -40, 9, -36, -80, 48, 105, -110, 106, 104, 54, 54, 105,
+    -18, -20, -8, 87, -52, 54, 36, 12, 77, 107, 18, 16, -46, 127, 86, 84,
+    43, 55, -44, -123, 27, 36, 49, -54, 39, -22, -52, 96, -62, -77, -39, 53,
+    -14, 0, 54, 22, 39, -46, -9, -70, 26, 20, -30, 7, -22, -50, -50, -21,
+    -26, 8, -83, -23, 15, 50, -60, -64, 39, -12, -23, 13, -22, -15, -51, 63,
+    27, 9, -6, -8, -41, 5, -48, -48, 55, -5, 27, -5, 90, 38, -86, 18,
+    39, 10, -38, -42, 27, -6, -41, 45, 31, -56, -38, -23, -17, 70, 26, -70,
+    -69, 11, 61, 43, -37, 28, 41, -44, -9, 29, -53, -33, -12, -127, -24, 85,
+    12, 27, 42, 54, -19, 2, -22, 14, 50, 48, 4, 39, 65, 30, 62, -17,
+    -49, 75, 91, -105, 6, 95, 122, 27, 40, 47, 35, -121, 109, 96, -40, 12,
+    -24, 93, -102, -44, -17, 47, 73, -50, 39, 69, -110, -102, -37, 98, -69, -86,
+    88, 119, 127, 81, -20, 29, -26, 42, 3, 98, -79, -22, -115, -75, -13, -35,
+    -61, -34, 77, -7, 75, 34, -68, -46, -87, 3, -10, -21, 7, 81, 126, 55,
+    124, -53, -95, -9, 27, -30, -82, -48, 98, 86, -64, 107, -9, 70, 82, 52,
+    91, -17, 67, 75, -76, 78, 103, -73, 47, 27, 14, -62, -58, -32, -34, -40,
+    19, 58, -12, 35, 42, 20, 32, -9, 34, 21, -17, 19, -6, -28, -4, -7,
+    -30, -10, 15, 21, 1, 20, 15, -19, -19, -26, -17, 32, 20, 8, 16, -8,
+    -21, -21, 12, 12, 2, 29, -8, -32, 13, 49, -38, 0, -9, 6, -33, -18,
+    127, 48, 36, 27, -24, -2, 21, 5, -13, -30, 35, -15, -24, 4, 36, 3,
+    8, 18, -13, 14, 14, 11, -18, -17, 16, 30, -19, 18, 7, -4, -10, 38,
+    -38, 4, -37, 14, 19, -18, 13, 9, 1, 37, 11, -52, -34, 19, -17, -3,
+    4, 14, -21, 23, 52, 10, -42, 53, -61, 35, -17, 54, -30, 15, 48, -66,
+    -72, -43, -27, -65, 30, -2, 0, 79, -56, -44, 83, -87, 60, -12, -37, 80,
+    -68, -60, -38, 16, -27, -79, -13, 28, 51, 50, -51, -27, 2, -64, -6, 44,
+    -47, -93, -70, 102, 22, -49, -61, 75, -19, -47, 83, 36, 27, 78, -38, 25,
+    80, 3, -37, 81, 36, 127, 49, 43, 59, 66, -16, -5, -24, -25, -106, -88,
+    -29, 78, 46, 84, -29, 10, 66, 75, -89, -103, 63, 45, 83, -36, 24, 73,
+    86, -34, 92, 85, 73, 55, 47, 55, 78, -65, 16, 12, 76, 61, 70, -20,
+    -85, -55, -51, 22, 73, -26, 66, -20, -15, 37, 16, 21, -54, -58, 43, 32,
+    50, 81, -7, 37, -66, -17, 34, 41, -73, 35, -43, 11, -57, 27, 14, -26,
+    44, 93, -18, -30, -69, 31, 65, -34, -20, 23, -15, -45, -12, 111, -54, 13,
+    -35, -36, -45, 66, -6, -12, 88, 6, -57, 53, -53, -18, -71, 54, 64, -46,
+    45, -72, 101, -19, -72, -67, 56, 127, -2, -22, -48, 55, 90, -37, 25, -19,
+    -49, -97, 62, 35, 81, -54, 1, -95, -26, -30, 66, 37, -18, -61, -93, -68,
+    -54, -34, -13, 24, -44, 42, 5, 76, -59, -52, -28, 22, -100, -98, -59, 44,
+    91, -6, -30, 10, 93, 121, 36, -96, 29, -117, 69, 80, 7, -115, 35, -37,
+    53, -8, 96, 51, 93, 6, -44, 0, -27, 18, 23, 122, -9, -75, -5, 71,
+    -71, -2, 64, -83, -78, -89, -50, 85, 13, 111, 51, -68, 50, -104, 58, 55,
+    45, -29, -69, -75, -68, -78, -102, 41, 88, 18, 92, -48, 49, 127, -4, 72,
+    23, -13, -25, 37, 102, -69, 76, -85, 49, 13, -49, -31, 105, 10, -89, -96,
+    89, 28, -90, 38, 40, 38, 88, 114, 77, 73, 37, 95, 24, 71, 85, -92,
+    5, 27, -46, 3, -33, 119, 97, -46, 56, 102, -20, -1, 19, -80, -45, -52,
+    -21, -116, 36, 18, -72, -65, -48, -23, 65, 62, -74, 115, -26, -61, 18, 100,
+    -20, 105, -69, 19, -50, 17, 57, -46, 30, -7, 69, -95, 16, 51, 112, 97,
+    -59, 50, -106, -43, -77, -10, -70, 1, 89, 87, -83, -30, 50, 127, -66, 122,
+    -51, -6, 110, -33, 30, 70, -71, 65, 61, 44, -92, 107, 1, -33, -21, -40,
+    98, 55, 72, 50, 113, 65, -54, 46, -30, 55, -53, 68, -74, 18, 6, 7,
+    -73, 67, 64, 65, -44, 42, -15, -55, -23, -80, 80, 75, 22, 79, 117, -13,
+    -29, -63, -22, 104, -35, 91, 43, 69, 33, 89, 56, 19, 103, 127, 19, 65,
+    43, 16, -3, 79, 65, 108, -18, -9, 38, 117, 58, 74, -55, 114, -89, -14,
+    22, -82, 113, -53, -4, 63, 71, 29, 72, -10, -7, 121, 76, -40, -110, -12,
+    -23, -96, 27, 90, -26, -2, -32, -77, -9, -77, 72, -4, 59, 50, -69, 54,
+    -7, -8, 77, 88, -22, -5, 21, -64, 13, 45, -61, 16, 86, -40, -12, 67,
+    -5, -27, 28, 22, -44, 97, -38, -54, -71, 15, -26, -2, 92, 47, 2, -78,
+    -66, 97, -18, 26, 15, 55, 109, -44, -58, 34, 40, -105, 36, -48, 64, 73,
+    -39, -76, 55, -33, -60, -31, 87, 37, 1, -90, -31, 111, 127, -110, 3, -42,
+    35, 30, -70, 53, -69, 38, 85, 9, 43, 40, -30, -105, -29, 59, 47, 43,
+    -57, -15, 55, 25, 8, 1, -4, -33, -29, 37, -6, -34, -19, 42, 47, 37,
+    4, -23, 96, 11, 98, -6, 28, -72, 24, -28, 0, -3, 40, -6, 79, 93,
+    34, -4, -50, -46, -84, 112, 6, -38, 14, 91, -68, 3, 52, 127, -42, -26,
+    -106, 65, 56, 17, -6, -5, 123, 58, -11, -12, 118, -20, 51, 53, 21, 49,
+    0, -84, 37, 102, 41, -92, 4, 94, -70, -22, -29, 68, 105, -83, -48, -65,
+    4, 81, -56, 104, 69, 31, 101, 83, -36, -27, 19, 16, 29, -18, 83, 85,
+    12, 22, 65, 31, 49, -84, 93, 78, 59, -65, 19, -32, -106, 27, -67, 54,
+    66, -109, 106, 48, -36, 71, -58, -2, 56, -80, 18, -72, -79, -116, -62, 33,
+    73, -92, 32, -18, 11, -69, -60, -111, 38, -93, -95, -7, -95, 25, 59, -103,
+    -48, 48, -51, 26, -32, 42, -2, -8, 5, 84, 6, -37, 50, -63, 113, 66,
+    -74, -11, -29, -11, -15, 36, 55, -54, -71, -127, -64, -76, -25, -96, 3, 85,
+    48, -116, -28, 124, -89, 2, 19, -9, 87, 28, -10, 49, -47, 87, 85, -40,
+    -14, 22, 56, 82, -85, 60, 19, 37, 23, 16, -100, -3, -15, 63, 32, -60,
+    -75, -46, -86, -13, 30, -39, -71, -77, 21, -65, -83, 14, 12, 13, -41, 80,
+    72, 33, -21, 37, 32, -23, -40, -127, -33, -51, -69, -84, -5, -61, -79, 69,
+    64, -83, -112, -11, 24, 93, 23, 6, 53, 43, 21, 47, 82, -42, -97, -55,
+    -60, -67, -37, 19, -89, -65, -68, 58, -63, -73, 21, 26, 102, 18, 85, 98,
+    64, 7, 49, 1, 46, 120, -51, 60, 15, 91, 36, 42, 37, 49, 38, 7,
+    75, 59, 62, -114, 91, -99, 63, 20, 8, -40, -48, 2, 16, 41, -53, -73,
+    -85, -11, -9, -1, 72, -22, 67, -37, 51, -57, -29, 67, 11, 14, -8, -47,
+    17, 31, -64, -76, 104, 90, -85, -11, 19, -10, 45, 5, -110, -96, -60, 92,
+    -49, -100, 23, 57, 34, 74, -127, 13, -32, 51, -78, 110, 48, -49, 21, -4,
+    64, 38, -34, -47, -81, 2, 50, 67, 40, 17, 68, 35, -85, -10, 62, 105,
+    19, 46, 35, -88, 32, -65, 40, -101, -71, 75, 94, -75, -40, -29, 46, -11,
+    35, -49, -40, -69, 72, -45, 73, 61, -47, 72, -44, -59, 95, -65, -66, -43,
+    47, 58, -66, -40, 80, -56, 16, 29, 99, 12, -60, 82, -24, -40, -52, -74,
+    54, 53, 26, 24, 3, 1, -5, -82, -13, -45, 21, 71, 16, -60, 78, 9,
+    -100, -42, 21, 19, -32, -66, -24, 45, 8, -9, -7, -5, 93, -23, -34, -60,
+    -35, 26, -56, -29, 107, 81, 2, 7, -35, 56, 56, -47, 13, -9, 54, 80,
+    91, -88, 16, -127, 53, 53, 67, -20, -36, 28, -32, 60, 17, 6, -45, 70,
+    65, -73, 16, 70, 80, -108, -13, -58, 61, -69, 77, 115, 21, -88, 42, -15,
+    83, -40, -66, 60, 87, -84, 49, -23, -6, -4, 69, 8, 64, 46, 58, -23,
+    -10, 41, 18, 33, 50, -25, -76, 1, -127, -21, 16, -106, -58, -51, 117, 6,
+    89, -48, -101, -26, 68, -59, -41, 102, -50, -22, 100, 23, -113, -38, -65, -6,
+    16, 47, -82, -100, 64, -4, 106, -63, -1, -5, -37, -70, 4, -7, 67, 71,
+    -46, -45, 81, -75, 66, 15, 86, -12, -78, 13, 86, 28, 121, -63, -41, 33,
+    -55, -27, -56, -75, -47, -96, -45, -51, 59, 93, 69, 8, 99, 54, -39, -79,
+    -49, 47, 7, -21, 65, -50, -22, 2, 42, -15, 55, 65, 84, 57, -2, -67,
+    7, 21, 48, 29, -14, -46, 60, 8, -34, -90, 114, 23, -23, -66, 42, 84,
+    -77, -59, 13, 10, 65, 73, 23, -61, 1, 79, -37, 23, 81, 12, 45, 87,
+    -70, 90, -33, -57, -67, 70, -42, -8, -12, 75, 87, 67, 50, -25, -57, -32,
+    -44, -92, -18, -127, 16, 59, -24, -103, 33, -57, 24, -43, -8, 45, -83, 35,
+    -53, 13, -55, -3, 60, -24, -57, 33, 5, -118, -15, -20, 19, -28, -96, -36,
+    -77, 31, 65, -77, 30, 60, -13, -74, 45, -47, -113, 53, 60, -64, 16, 69,
+    56, -106, 30, 33, 86, -38, -24, -23, -48, 89, -69, -6, 77, 19, 18, 39,
+    1, 127, -69, 17, 34, 15, -57, 0, -38, -6, -19, 62, 53, 23, 57, 27,
+    0, 46, -17, -10, -62, -47, -81, -85, 16, -65, 37, 9, 36, 100, 2, 14,
+    18, 52, -13, 97, -61, -44, -98, -55, 29, -4, 45, -8, -121, -55, 3, -97,
+    81, -127, -6, 7, -81, -6, -10, 9, -103, -33, 57, 107, -47, -19, 30, -8,
+    95, 4, -4, -68, -14, 55, 47, 13, 4, 54, 18, 6, 24, 10, -71, -4,
+    -12, -39, -63, -61, -80, 23, -43, 82, -85, 58, 50, -8, -45, 37, 31, 52,
+    -35, 48, -24, 76, -9, -74, 27, -31, 80, 47, 40, -14, 11, -82, 5, -12,
+    69, -38, -30, 46, -71, 67, 64, 39, 50, -82, -64, 7, 33, -114, -119, -6,
+    -19, 45, 60, -14, 69, -9, -18, -9, -96, 74, 10, 51, 48, 74, 19, 76,
+    9, -2, -70, -110, -127, -74, -79, -2, 22, 86, 38, -98, -28, 50, 72, -25,
+    43, -22, 58, -109, -107, 5, -49, -19, -125, 37, -97, -14, 53, 22, -34, -16,
+    47, 61, -94, -95, -80, -73, -124, 69, -98, -5, 36, 11, 90, 19, 78, 106,
+    75, 57, 35, -85, -91, -101, -15, -39, 85, -36, -95, -81, -108, -67, -46, 43,
+    34, -53, -117, 97, 36, 4, -121, -1, 63, -36, -3, -99, 30, -75, 77, 93,
+    76, -34, 111, 26, -64, -86, -32, 59, -55, -22, -38, -40, 47, 9, 85, 49,
+    82, -9, 81, 38, -125, -71, -107, -85, -41, -118, 51, 67, -95, -101, -2, 97,
+    95, 114, -71, 77, -35, 18, -121, -85, -95, 75, -96, -70, -85, -85, -12, -28,
+    -114, 7, 73, 72, 43, -121, -51, 29, 104, 40, -108, 47, -115, -19, 5, 50,
+    25, -73, -82, -31, -100, 22, 49, 31, 55, -22, 75, 45, -10, -52, -102, -3,
+    56, 67, -26, 77, -93, 20, -118, -47, 64, 53, -15, -112, -127, -56, -94, 44,
+    -89, -105, 106, -22, 55, -118, 58, -84, -117, -56, -46, -81, -49, 54, -102, -77,
+    34, 34, 46, -38, -82, 39, -108, -4, 39, -15, -87, -100, 82, -96, -47, -40,
+    -94, 81, 75, -57, -60, -41, 50, -8, 3, 1, -36, -35, -86, -5, 91, 3,
+    32, -8, -75, -49, -6, 73, 2, 70, 30, 86, -38, 67, 24, 118, -68, -24,
+    -5, 22, 56, -23, 63, -104, 127, 43, -75, 37, 8, 85, -90, 80, -68, -43,
+    -41, -68, 49, 68, 75, -81, 26, -60, 83, 37, 45, 34, 113, -99, -42, 32,
+    -4, -47, 16, 37, 36, 104, 58, 82, -35, 123, 66, 59, -93, -1, -4, 86,
+    20, -45, -39, 16, -60, 14, -42, -18, 45, -24, 1, -59, -65, 9, 41, 9,
+    -18, 24, 42, -86, 27, -104, -93, 14, -84, 16, -73, 83, -51, -68, -63, 1,
+    -56, -45, -92, -36, 7, -63, -10, 20, 62, -55, -31, 71, 70, -33, 63, 28,
+    -52, 42, -34, -82, 48, -45, -10, 64, -62, -33, -59, -33, -97, 0, -63, -75,
+    -86, -55, -78, 63, -40, 69, -9, -20, -55, 42, 34, -62, -43, -51, -53, -55,
+    21, 12, -78, -67, -121, 9, -110, 50, -23, -127, 52, 41, -22, -2, -76, -109,
+    65, -102, 30, 96, 46, 91, -36, -17, 24, -22, -62, -49, 88, -78, -22, 70,
+    -79, -79, -17, 21, 74, 17, -93, 64, 14, -58, 27, 2, -78, -61, 55, 102,
+    31, 39, -94, 26, 51, -19, -46, -127, 70, -58, -73, 38, 46, -33, -18, -8,
+    9, 18, 93, -37, -108, -47, -69, -10, -60, 32, 10, 63, -66, 21, 18, -80,
+    50, 104, -22, -40, 55, -120, -67, 15, -81, -48, 2, 16, -51, -84, -6, 44,
+    -60, -17, 88, 74, 11, 78, -100, -16, 24, -63, -88, -34, 73, 106, -32, -27,
+};
+
+// model_1/block_6_expand_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data6[96] = {
+    997, -29, 3839, 3971, 4220, -1973, 3224, -1370, -1629, -894, 3794, -1688, 3737, 5817, 1094, 1953,
+    -255, -258, -938, 4353, 2081, -833, 1971, -495, -1387, 2976, 746, 1730, 7448, 1796, 3658, 887,
+    1625, 3450, 4982, 3154, -843, 2133, 1669, -2726, -108, 2628, -827, 1346, -494, 705, -1009, -89,
+    -4136, 1789, 983, -2730, 4822, -715, 2884, 1031, 1112, 2267, -744, -1928, 112, 1230, 480, 4478,
+    3828, 1843, 3067, 4392, 3764, -754, 3401, 5583, 3407, -885, 4965, 9674, 593, -2263, 514, 866,
+    9269, 2277, -634, -999, 853, 768, 1820, -1264, 2592, -303, 3201, 858, 114, -2788, 196, 2283,
+};
+
+// model_1/block_6_expand/Conv2D
+alignas(16) static const int8_t tensor_data7[1536] = {
+    -52, 89, -59, 30, 37, -18, 120, 68, -87, -16, 69, -127, 100, 105, -65, 47,
+    -31, -3, -64, -23, -31, 44, 34, -127, 17, -40, -40, -64, -8, -38, -53, -7,
+    -35, -31, 36, 56, 27, 59, -109, 127, -42, 2, 105, -79, -8, -77, -37, 70,
+    99, -52, 82, 2, 32, -8, -14, 127, -22, 23, 63, 40, 11, 53, 74, -3,
+    -44, -36, -16, 49, -93, 24, -22, -114, -12, 2, 37, -33, 40, 45, 107, 127,
+    127, 36, -47, -24, -47, 1, 32, 67, 31, -19, 57, 76, 94, 50, -47, 0,
+    11, 1, -86, -56, -85, 2, 7, -81, -51, -23, -41, 9, 127, 80, 127, 17,
+    -46, 41, -15, -55, 15, -61, -84, 63, -89, 78, -63, -66, -127, -11, -6, 89,
+    42, 48, 55, 0, 76, 14, 66, 0, 67, -12, 21, 5, -127, -17, -71, 13,
+    -54, 68, 36, -92, -17, -19, 34, -25, -48, 54, -45, 20, 71, 127, 19, 31,
+    68, 9, -51, 57, -52, 3, 68, 1, -113, -15, -17, -127, -125, -76, -7, 103,
+    24, -30, 24, -1, 15, -35, 29, 126, -90, 18, 21, -27, -28, -13, 84, 127,
+    -56, -17, -3, -16, 8, -6, 120, 45, -56, 32, -4, -17, 0, 83, -43, 127,
+    -21, 16, 35, 3, 94, 52, 127, 107, -66, 66, -47, -62, 33, 75, -90, -32,
+    -59, 127, -12, 20, 28, -11, 36, 47, -4, 21, 92, 15, -52, 23, -30, 44,
+    -5, 6, -127, -29, 65, -21, -75, -22, -12, -17, -11, -50, 5, -76, -27, 20,
+    95, -40, -6, -5, 31, -46, 31, -42, -36, 36, 127, 87, 21, -14, -48, 3,
+    -6, 8, -20, -98, -10, -34, 113, -127, -2, -7, -21, 29, 31, 52, 2, 43,
+    48, 117, -16, 6, 56, -68, -12, -27, -43, 127, -55, 16, 33, -3, -13, -26,
+    -48, -92, 109, -108, 56, -127, 41, -68, 47, 28, 99, 89, 17, 0, 79, -37,
+    -15, 97, 59, -2, 13, 5, 10, -43, 47, 17, 100, -44, -127, -2, -78, -2,
+    -67, 11, 6, -15, 77, 39, 77, -13, -127, 20, -75, 36, -30, 3, -64, -56,
+    10, -97, 28, 22, 14, -125, 127, 33, -10, -53, -9, -56, 30, -82, -66, -39,
+    -50, -113, 23, 85, 28, -15, 37, -51, -8, -24, 112, 13, 17, 61, 95, 127,
+    20, 12, 22, 94, 60, 14, -47, -127, 84, 7, -40, 15, 10, -20, -20, -33,
+    -14, 34, 24, -54, -25, -17, 11, -37, -36, 44, -52, -8, 48, 127, 0, 21,
+    -55, 57, -5, 15, 24, -74, -5, -19, 10, 48, 27, 67, -6, 21, -83, 127,
+    -31, -127, -59, -3, -74, 79, 1, -55, 2, -33, 46, -35, 31, -46, -96, -15,
+    -41, -13, 69, 96, 38, 31, -46, -127, -120, 50, 78, -1, 53, 12, -27, -57,
+    -127, 107, -42, -30, -18, 16, -125, -73, -45, -35, -2, 0, 26, -39, -115, 60,
+    97, 108, -70, 104, -73, -127, -97, -39, -1, -6, -13, -106, 98, 33, 3, 93,
+    127, 39, -65, -18, -30, 44, 73, 37, -32, -15, 42, 82, 10, 24, 0, -6,
+    -40, -12, 127, -9, -25, 79, 95, 7, -26, -10, -23, 25, 30, 64, 70, 53,
+    2, 40, -58, -82, -30, 26, 127, 17, -10, -21, 26, -48, 105, 87, -49, 70,
+    -87, -42, 76, 0, 6, -54, 91, -11, -127, 16, 52, -57, 58, 31, -52, -31,
+    -15, 17, -46, 29, -84, 127, -41, -13, -33, 117, -2, 88, -61, 76, -10, 40,
+    -2, -97, 127, -30, -33, 34, -59, -33, 35, 21, -73, 114, -1, -110, -46, 58,
+    88, -3, 92, -32, 127, -60, -14, 17, -28, 87, -78, 20, -56, -70, 106, 0,
+    83, 78, 17, -110, 8, -101, -127, 47, -69, 51, -89, -47, -59, -96, -88, 91,
+    -77, 18, -62, -3, -84, -60, 75, 20, -127, -17, 65, 64, 50, -12, -28, 33,
+    119, 41, -80, -127, -112, -2, 36, -17, -49, -80, -19, -118, 10, 42, 58, 30,
+    92, -110, -67, -71, -28, 41, -50, -78, 126, 35, -37, -94, 127, -99, 94, -56,
+    -16, -84, -48, 117, 31, -103, -127, 35, -4, 26, 26, 35, -108, 62, -74, -10,
+    -79, -40, -58, -98, -49, 1, 3, 78, 32, -127, -42, 23, -20, -41, -46, 103,
+    -43, 16, -1, -100, -42, -22, 48, 123, 127, -48, 57, 105, 97, 46, 14, -6,
+    49, 58, -85, 78, 91, -67, -27, -41, 127, -104, 30, -31, -2, -5, -57, 35,
+    -31, -53, 6, 4, 83, -32, 20, 44, -41, 98, -9, -127, 14, 78, -49, 72,
+    55, -75, -21, 1, 66, -11, -51, -33, 1, 127, -24, 52, -68, -74, -92, 42,
+    0, -16, -28, -82, -34, -7, 73, -127, 13, 5, -59, 2, 62, 12, -6, 2,
+    -14, 108, -68, 74, 86, -27, 46, 47, -19, 19, -9, -23, -22, 5, 127, -127,
+    27, 58, -25, 27, -127, 1, -72, -44, 82, 80, 24, 20, -28, -22, 29, 38,
+    127, -45, -61, 17, -57, 68, -97, -26, 36, -10, -20, 59, -20, -53, -6, 14,
+    -24, -68, 39, 75, -71, -93, -127, -9, -20, -63, -51, -56, -6, -49, 5, 59,
+    18, 75, 46, -127, -2, 121, 93, -35, -39, 10, -12, -26, 103, -71, 7, 73,
+    68, 116, 7, 2, 4, -122, -85, 64, -9, -48, -55, 127, 79, 79, 7, 37,
+    -18, 36, 54, 78, 59, -24, 101, 127, -52, 1, 12, 23, 85, 32, 31, -5,
+    99, 48, 31, -10, -27, 127, -55, -73, -26, 77, -106, 25, -74, 118, -29, 59,
+    -36, -12, -51, -35, -59, -94, 41, 0, -127, -19, 81, 38, 36, 29, -15, 47,
+    71, -32, 79, 41, 19, -100, -33, 7, 17, -52, -127, -34, 37, -4, -33, 35,
+    66, 0, -126, 68, -5, 25, 107, -10, -56, -97, 19, -116, -127, -67, 60, 100,
+    -2, 11, -25, 12, -50, -18, -19, 6, -46, -53, 66, 127, -23, -112, -35, 18,
+    -38, 4, 68, -66, -65, 27, 5, 127, -21, -107, 54, 24, 78, -12, 4, 101,
+    58, 26, -13, -127, -22, 37, 22, -17, -23, 55, -38, 45, 35, -4, -91, -56,
+    -6, -52, -20, -10, -85, -89, -40, 15, -103, -20, -31, -20, 127, -15, 45, 12,
+    38, -3, -18, 89, -85, -66, -24, -53, 42, 127, 28, -4, 23, -11, -87, 114,
+    -34, 14, -29, 1, -95, 74, 30, -22, 26, -95, 104, -90, 104, 54, -127, 54,
+    -100, 100, -99, -70, 54, -23, -100, -41, -80, 81, 64, 32, -127, -52, 62, 16,
+    3, -22, -127, -97, 75, 63, 6, -13, -27, 14, 77, -6, 9, 40, 18, 49,
+    71, 33, -25, -33, -44, 15, 0, 35, -41, 65, 127, -21, -6, -50, -84, -19,
+    60, -97, 37, -20, 12, -83, -50, 127, -43, 78, 105, 16, -14, 88, -41, -15,
+    63, 62, 89, 39, 105, -45, 119, 9, 77, 29, -89, 5, -100, 127, -76, 10,
+    3, 21, 90, -86, -127, -96, 23, 13, -16, -25, 15, -79, -93, -8, 18, 25,
+    -72, -110, 4, -118, 48, -14, 15, 36, -67, 17, -127, -30, 53, 112, -71, 112,
+    12, -4, 18, -16, 93, -64, -52, 15, 5, 101, -73, 30, -127, 7, 64, 12,
+    -127, -18, -126, -79, 49, -41, -33, 17, -97, 19, -121, -35, -25, -48, -64, 103,
+    92, -30, 49, -59, 27, 0, -127, -31, -8, -115, 55, 17, -13, -18, -8, -5,
+    10, -18, 3, 70, 51, 47, 26, -13, 38, -127, 33, 52, 21, -29, -30, -18,
+    -27, -15, 102, -22, 25, -17, 6, -127, 33, 19, 39, 92, 45, 54, 7, 19,
+    -32, -2, -8, -22, -28, -56, 9, 17, -20, -35, 26, -91, -74, -34, -127, -58,
+    -86, -72, -46, 69, 105, 15, -62, 7, 49, 104, -63, 127, -74, -94, -92, -4,
+    -12, -117, 45, 127, -53, -32, -110, 98, -38, 53, 108, -17, -89, 16, -34, 94,
+    127, 51, -87, 41, 9, 50, 4, 119, 113, -3, 101, 121, 115, 25, 80, -23,
+    -47, 36, 46, -37, 38, -118, -112, -67, 35, 79, -27, -41, -46, 127, -51, -30,
+    93, -78, 127, -6, -46, 43, -91, 21, 36, -101, -20, -16, -12, -31, 20, -17,
+    13, -51, -75, 2, 127, 13, 20, 13, -90, 6, -96, -14, 44, -16, -96, 19,
+    -1, 127, 36, -39, 97, 10, 66, -92, 102, -44, 113, -24, 126, -42, 49, 19,
+    113, -14, 127, 56, -4, -41, 61, 53, -50, -48, -107, -39, 29, 17, -58, 10,
+    -1, 44, 18, -78, 61, 19, -24, 36, 28, -34, 88, -51, -50, -127, 1, 7,
+    -53, -25, 14, -12, 2, 12, -51, -52, -4, 4, -57, -127, -30, -27, -10, -14,
+    -94, 31, 23, -38, 40, 31, -127, 24, 113, 54, -54, -5, 6, -92, -19, -39,
+    -7, -4, -8, -65, 127, 39, -76, 27, 45, 77, -24, 4, 50, 27, -104, -16,
+    -29, -38, 33, 58, -31, 11, -23, 105, -70, -32, 42, -56, 4, 55, -1, 127,
+    -42, 81, 45, -2, -10, 47, -95, 86, -45, 18, 100, -2, -68, 127, 25, 51,
+    0, 68, -56, -94, 108, 109, -127, 8, 69, 14, 62, 75, -68, -9, -19, 52,
+    30, 73, 127, 13, -105, -8, 14, 1, 18, -29, 29, 11, -71, -33, 23, -50,
+    -11, 8, 69, 5, 127, -66, -121, 68, -15, -4, -122, 53, 29, 37, 46, -107,
+};
+
+// model_1/block_5_project_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data8[16] = {
+    2948, 4225, -2472, -4385, -9371, 6244, 11034, 1002, 6696, 3206, -8622, -5219, -25391, 12668, -5011, 22032,
+};
+
+// model_1/block_5_project/Conv2D
+alignas(16) static const int8_t tensor_data9[1536] = {
+    -87, 47, 53, -28, -66, -27, -49, -23, -50, -28, 18, -48, 53, 83, -9, -36,
+    13, 1, 111, 27, 15, -76, 109, 75, 40, 25, -3, 69, -46, -116, -80, -37,
+    -18, -44, 21, 54, 25, 38, -3, 63, -34, 18, -71, 43, -81, -17, 20, 80,
+    -22, 43, -47, -2, 41, 21, 16, -48, -114, 9, -37, 127, 79, 35, 7, 9,
+    -11, -39, -62, 22, -37, -54, -5, -15, -19, -21, -59, -48, -17, 16, -32, -10,
+    -49, 36, 63, -78, 26, 58, 3, 55, 17, 28, 11, -25, -71, -29, -43, 22,
+    82, 24, 13, -56, -87, -65, 18, -27, -23, 1, 85, -73, 31, 40, -95, -56,
+    7, 3, -15, 53, 26, -86, 10, 51, -29, -60, -6, 1, 88, -111, 123, -117,
+    79, 28, -37, 78, 41, 80, 15, -6, -12, 53, -13, 5, 30, 57, -85, -82,
+    -53, -20, -6, 12, 81, -62, -39, 59, -42, 69, -66, 83, 60, 56, 32, -127,
+    -6, -4, -89, 43, 28, -6, -64, 4, -87, -26, 25, -101, 35, 5, 37, -70,
+    -45, -6, -120, -43, 55, 11, -17, 24, -52, 41, -66, 37, 0, 71, -74, 99,
+    67, -6, -20, -54, 40, -73, 36, 46, -57, -15, -9, -9, -86, -59, -16, -47,
+    -97, -30, -31, 11, -36, -73, 2, 41, -26, -59, -29, -18, 14, 21, -51, 91,
+    -50, 127, 3, 12, -3, -29, 2, 6, -84, 47, 100, 12, -68, 2, 4, -45,
+    50, 29, -63, -26, 56, -23, -47, 54, 50, -37, 50, 9, 11, 53, -13, 10,
+    52, 10, -53, 5, 9, 29, -50, 48, 86, 19, 55, 4, -8, -42, 101, 64,
+    63, -44, -50, 51, -19, 7, -5, 63, 28, 15, -9, 51, -46, 46, -6, 20,
+    -38, -7, -33, 11, 6, -1, -11, -106, -7, 55, 107, 96, 27, 8, -118, 57,
+    -27, -4, 19, 18, 2, 127, 93, -53, 21, 47, -23, 13, 126, -38, 89, -66,
+    8, 37, -45, 29, 43, 122, 26, 35, -117, -23, -35, 52, -61, 33, 34, 21,
+    -25, -23, -30, -37, 71, -59, -25, -53, 41, 61, -29, 53, 28, -21, -17, 25,
+    43, 77, 7, 15, -17, 9, 4, -83, -49, -58, 62, -19, 40, 29, -33, -22,
+    -20, -53, -57, 1, 21, -93, 44, -21, 11, 59, 38, -13, 27, 17, -19, 60,
+    37, 20, -27, 4, 40, 1, -52, -21, -23, 35, 124, -2, -6, 17, -27, -53,
+    -27, 2, 8, 26, -4, -43, 78, 104, -56, -3, -127, 28, -11, -35, 23, -42,
+    -21, -25, 15, 75, 5, 56, 44, 39, -34, -13, 57, -29, -12, 14, -14, 39,
+    -35, 80, -18, 33, 82, -11, -45, 21, 51, -17, -8, 10, 30, -13, 53, 14,
+    -39, 14, 5, 32, -46, 50, -17, 67, 3, -60, -23, -69, 40, -32, 17, 32,
+    -16, 30, -68, -19, 15, -9, 37, -10, 82, 14, 18, -9, -62, -16, 61, 24,
+    -83, 33, 30, 16, 72, -18, 69, 11, 27, 51, -25, -6, 87, 10, -11, -48,
+    21, -34, 68, 28, -124, -30, -95, 69, -85, -18, 44, 27, 27, -64, -22, 65,
+    28, 118, 14, -26, -43, 16, 23, -65, 16, 127, 113, -19, -10, 118, 17, -30,
+    9, 30, 39, 71, -17, -21, 5, -59, 0, -29, -61, -123, 41, 64, -71, -25,
+    91, -95, -62, -98, -51, 4, -16, 5, -42, 21, -29, -82, 7, 12, -43, -31,
+    120, 56, 3, -46, -108, 59, 10, 22, 2, 22, 34, -31, 14, 38, 14, 102,
+    72, -21, -67, 41, -42, -79, 97, 93, -98, 72, -45, 14, -97, -92, 101, 14,
+    29, -66, -1, 12, -9, -4, -71, -93, -55, 40, 56, -1, 9, 5, 64, -34,
+    6, 11, 38, -101, 21, -25, 20, 38, 28, -10, -68, -78, -5, -49, -106, 41,
+    28, -127, -8, 65, -15, 12, -15, -72, 45, 52, 33, -55, -74, 20, -100, -13,
+    5, 7, -74, 46, 38, 1, -14, -65, -22, 16, 51, 82, 45, -35, 14, -118,
+    6, 4, -51, 79, -39, -47, 9, -8, -78, 28, 55, 56, -17, -11, -78, 101,
+    -13, 80, -34, -70, -20, 9, 1, 3, -73, 21, -23, -45, -43, 12, -17, -14,
+    -94, -15, -41, 43, -5, 115, 48, 29, 16, -2, 7, 37, 89, 42, 102, -77,
+    94, 13, -59, 52, 14, 33, -1, 75, -87, 3, 32, -59, 17, -71, 61, -1,
+    18, -37, -127, -28, 7, 35, 19, -11, 65, -28, -86, 42, -6, 115, 35, -19,
+    -47, 28, -42, 49, -33, 0, -126, 27, 24, 54, -18, 61, -21, 32, 33, -65,
+    -13, -113, 84, -65, 73, -49, -14, -21, -9, 74, -79, 47, 31, -44, -21, 4,
+    24, 100, -45, 62, -32, -61, -68, 22, -65, -38, 24, 11, -2, 84, -6, 110,
+    9, -46, 42, 23, 67, -28, -4, 13, -28, 97, 20, 64, -22, -24, -39, -48,
+    -14, -50, -12, -62, -54, 48, 53, -12, -9, -4, 40, 61, -34, -22, 20, -34,
+    -11, 11, 61, 92, 11, -35, -82, 117, -39, 80, -15, -23, -44, 21, 25, 76,
+    10, -55, -35, -16, -42, 34, 19, 11, -36, -47, -120, -44, -44, 55, -57, -15,
+    -42, 5, -60, -55, 9, 22, 25, 47, 48, 94, -52, -19, -127, -103, 37, -58,
+    -27, 3, -73, 27, -38, -41, 51, 62, -24, 32, -23, 108, -103, -48, 10, 119,
+    1, 16, 75, -38, -36, 63, 46, -79, -27, -3, -18, -26, 67, -39, 72, 47,
+    -20, -8, -36, -127, -25, -19, -6, 19, 20, 8, 62, -45, -6, -44, 23, 2,
+    -10, 115, -20, -6, -51, -101, -16, -15, 11, -35, 58, 9, -53, 87, -27, -35,
+    55, 13, 16, 0, -101, 1, 46, 83, -8, 97, -69, -86, -56, 4, -15, 42,
+    56, -69, 38, -12, 57, -48, -14, -13, -50, -5, -17, -44, 107, 29, 12, -4,
+    31, -6, -45, -22, -37, 26, 49, -14, -12, -34, 26, -30, -82, -5, -19, -16,
+    -89, -10, 10, 31, 22, 9, 35, -18, 9, 73, 14, 4, -22, -60, -17, -31,
+    103, -43, 0, 46, 65, -48, 61, 127, -22, -37, 18, 30, -50, -94, -30, 63,
+    15, 118, -114, -61, 8, 58, 25, 30, 25, -54, 42, 76, 16, 63, -46, -35,
+    -44, -31, -34, 97, 51, -18, -54, 41, 99, 16, 43, -71, 30, -62, 35, -23,
+    -18, -39, 28, 21, -13, -37, 1, -26, -43, -8, 35, 69, 41, 24, -56, 11,
+    -41, -17, 43, -41, 48, -74, -16, -31, 63, -56, 22, 35, -1, 60, -48, 50,
+    -63, -33, 84, -9, -17, -10, -69, -61, 25, 20, -25, 88, 67, -95, 59, -66,
+    12, 1, 24, -18, -103, 27, -102, 1, -64, 51, -66, 64, -25, 41, 15, -63,
+    7, 32, -70, -2, 36, -8, 75, -45, -25, -33, -23, 2, -17, -47, 14, -93,
+    34, -47, 85, 94, 127, 25, 67, 43, -39, 3, 41, -101, 89, 65, 52, 78,
+    9, -14, -49, 85, 110, 45, 23, 5, 13, -16, 10, -31, 46, 63, 96, 66,
+    92, -36, -31, -12, 68, 104, 31, 35, 46, 74, -40, 31, 51, 96, 35, -33,
+    0, -20, 54, 73, 120, -43, 7, -61, -1, 7, -26, -16, -60, 96, -6, 29,
+    31, 50, 37, -90, 67, -30, -7, -59, 29, -1, 37, 98, -47, 90, -8, -38,
+    -43, 16, 58, 49, -19, -20, 27, 22, -85, 69, -8, 53, 36, -119, 9, -109,
+    -15, 105, -61, -12, 35, -62, 65, 51, -22, 4, 33, 88, 35, 24, -96, -50,
+    -20, 127, 84, 42, -53, 126, -20, -77, 68, 34, -73, 54, 42, -6, -96, -58,
+    -29, 11, 13, -33, -40, 11, -10, -26, -34, -19, -24, -69, 23, -127, -5, -69,
+    -23, -48, -83, 6, -88, -23, -1, 54, -12, 23, 55, -23, 30, -7, 55, 38,
+    18, 22, -100, 102, -5, -20, 37, -12, 94, -1, 11, -37, 1, -109, 35, 14,
+    45, -14, -50, -2, 6, 5, -9, 28, 59, -63, 9, -1, 58, 42, 1, -66,
+    -37, 56, -56, 26, -31, -35, -75, -4, -27, 23, -27, -41, -73, -22, 42, 62,
+    10, 41, 39, -65, 58, 12, 18, -37, -30, -21, -45, 16, -34, -27, -44, -2,
+    2, 11, -103, -20, 74, 38, -73, -32, 48, -82, 83, -41, 17, 9, -71, -72,
+    -50, 55, 53, 127, 3, -37, -19, 0, -35, 35, -31, 83, 34, -34, -33, -30,
+    89, -17, -17, -3, 8, 53, 83, 53, 49, 57, 18, 14, 4, -29, 107, -46,
+    28, 2, 20, -14, 60, 31, -37, 51, -11, 66, -80, 16, -3, -66, -32, -79,
+    35, -42, -67, -5, -23, 47, 7, 41, -34, -50, -29, -26, 71, 18, -29, -47,
+    32, 1, -42, -25, -5, 76, -28, -14, -8, 87, 114, 7, 17, -44, -29, -58,
+    -92, -59, 28, -83, 19, -11, -61, -59, -22, 53, -25, 57, -25, -94, 78, 91,
+    -126, -28, -3, -79, 7, -19, -7, -102, 61, -3, 25, -81, -52, -105, -56, 70,
+    -70, 49, 48, -103, -9, -37, 10, -44, 21, -21, 15, -66, -33, -31, 38, 118,
+    -69, -60, 28, -78, -62, 66, 18, -107, -70, -50, 119, -10, -28, 28, -107, 16,
+    -102, -6, -12, 12, 65, -87, 60, -15, 80, -24, -46, -34, -17, -9, 34, 9,
+    8, 77, 86, 33, 8, -46, -127, -30, -27, -91, -122, 21, 101, -62, -45, 87,
+};
+
+// model_1/block_5_depthwise_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data10[96] = {
+    -2617, 5092, 894, -4820, -2420, 5179, -1793, -3608, -1472, 45, 11470, -6067, -1717, 25598, 16608, -7437,
+    20436, 2568, -3249, 560, 78, -7156, -823, -1663, 1977, -6463, -835, -3375, 10272, -6046, -5155, 7226,
+    12263, 1956, 5954, -112, 2998, -2791, -750, 11163, -2488, -7, 3372, -10179, 13100, 17364, -714, 16226,
+    -1301, 8813, 11462, -5511, -1374, 4485, 456, 10255, -2436, 1404, 27016, 7706, 7430, 16089, 12494, -12429,
+    1144, 1067, -2386, 9921, -2136, 150, -1747, 4273, 21655, 2040, -2796, 20070, -2171, -2172, 9077, -5571,
+    -4197, 17346, 3775, 3589, 17309, -2290, -3825, -5374, -1190, -8713, 12091, -1880, -1407, 106, -1820, -6019,
+};
+
+// model_1/block_5_depthwise_BN/FusedBatchNormV3;model_1/block_5_depthwise/depthwise;model_1/block_6_expand/Conv2D
+alignas(16) static const int8_t tensor_data11[864] = {
+    46, -11, -38, 80, -15, -2, 43, 58, 56, -81, -127, 101, -47, -95, -60, -12,
+    -47, -8, 47, 60, 87, 69, 87, 127, -15, 103, -23, 50, -83, 10, 21, -50,
+    -27, -12, -87, 105, -72, 67, 4, -60, 52, -55, 62, 104, -49, -19, 7, -60,
+    -15, -80, -4, 9, 86, 76, -96, -25, -91, -96, -98, -127, -109, 30, -127, -5,
+    -40, 21, 120, -34, -4, 45, 96, -32, -43, 26, 22, -56, 33, -72, -28, 64,
+    34, -117, 72, -52, -110, -48, 7, 20, -111, 33, -94, 127, 119, -15, 127, 61,
+    -28, -35, -54, 69, 17, 67, -42, 49, 127, 9, -66, 127, -31, -94, -105, 88,
+    -82, 59, 6, 127, 93, -7, 96, 116, -5, 127, 23, 43, -48, 127, -18, -127,
+    70, 88, -12, 106, 44, 59, -9, -116, 127, 1, 79, 127, -33, -127, 127, -99,
+    13, -127, 11, -31, 85, 127, -99, -127, -23, -61, -111, -93, -29, -69, -46, 44,
+    -16, 73, 127, -21, 13, 127, 127, 2, -43, 18, -35, -102, 55, -70, 14, 115,
+    -1, -26, 127, -95, -61, -84, 100, 118, 110, 72, -127, 10, 123, -51, 84, 85,
+    24, -43, -49, 70, -4, -23, -25, 37, 27, 47, -123, 90, -66, -58, -50, -58,
+    -45, -23, 58, 39, 107, 74, 82, 100, -25, 11, 38, 51, -50, 19, 11, -42,
+    -18, -80, -84, 127, -93, 38, 3, -5, 26, 75, 28, 106, -60, -26, 9, -27,
+    28, -81, -24, -4, 53, 29, -21, -4, 110, -88, -105, -97, -127, 32, -96, -5,
+    74, 14, 98, -25, -21, 51, 78, -87, -31, -67, 21, -90, 12, -72, -81, 37,
+    17, -84, 26, -30, -121, -35, -8, 8, -82, 13, -65, 78, 57, 38, 98, 42,
+    127, -61, 37, 79, -19, -61, 127, 40, -27, -126, -64, 112, -55, -79, -104, 79,
+    -41, -53, 110, 47, -127, 36, -118, -52, -52, 67, -127, 26, -94, 45, 127, -42,
+    -6, 35, -16, 97, -104, 63, -10, -94, 73, -127, 17, 76, -67, -87, -5, -118,
+    -127, -79, -67, 61, 109, -28, 38, -2, -127, -9, -67, -6, -94, -127, -98, 89,
+    -127, -30, 103, -85, -50, -18, -58, -125, -127, 43, 98, -89, 38, 42, -118, -20,
+    127, -127, -32, 124, -99, 19, 26, 86, -52, 36, -8, 89, 23, -84, 50, 5,
+    -119, 14, -52, 65, -53, -127, -122, -127, 115, -28, -11, 123, -62, -99, -7, 127,
+    -127, -127, 127, 122, -1, -127, -127, 31, -127, 73, 19, 54, -127, -8, -89, -16,
+    -108, 76, 127, -42, -23, 114, 127, -79, -68, 17, -21, 19, 17, -78, -78, -127,
+    -2, -110, -24, 127, 127, 68, 127, -83, 5, 41, 127, 16, 67, -14, -121, 127,
+    -24, -127, 29, 127, 0, 97, -99, -77, -102, 42, -127, -16, 127, 127, 38, -127,
+    -69, -37, -113, 67, -127, -53, 127, 117, 127, 58, -113, -31, -127, -91, -54, 127,
+    83, 0, 71, 86, -5, -37, -2, 75, -49, 127, -42, 45, -12, -77, -122, 42,
+    -29, -30, 80, 7, -121, 46, -70, -79, -25, 122, 101, -22, 94, 21, 55, -63,
+    -18, -127, -50, 92, -127, 50, -9, -104, 19, 79, 18, 106, -42, -78, -18, -98,
+    77, -28, -50, 32, 83, -61, -98, 4, 118, -16, -117, 12, -88, -92, -64, 81,
+    114, -19, 76, -63, -63, -44, -41, -73, -105, -127, 41, -127, -10, -37, -127, -20,
+    -10, -111, -19, 127, -51, 42, 12, 72, -50, 27, 21, 104, 23, 127, 60, -30,
+    51, -127, 6, 84, 25, 2, 55, 44, -59, -48, -22, 41, 79, -127, -82, 76,
+    -94, 17, 5, 51, -19, 79, 30, -9, 17, 25, -2, 104, -108, 30, 21, -81,
+    -51, -58, -30, 21, 90, 78, -16, -62, 50, -11, -70, 5, -94, -31, 3, 1,
+    4, 32, -114, 70, 27, -90, -99, 13, -40, 28, -86, 52, -28, -80, 45, 42,
+    -89, 48, 11, -63, 30, -63, 1, 115, -80, 25, 44, -75, -14, 35, 0, 53,
+    27, -23, -54, -46, -29, 68, 7, 68, -20, 127, 26, 67, -45, -9, 63, -31,
+    -55, -31, 127, 62, 127, 66, 5, 14, -31, 17, -68, 62, 127, -95, -127, 62,
+    -90, 68, -3, 55, 7, 44, 16, -7, 42, -117, -23, 127, -90, 28, 15, -49,
+    -127, 34, -23, -13, 115, 127, 12, -127, 30, -17, -127, 45, -64, -65, -22, -12,
+    3, 32, -71, 45, 29, -114, -54, -113, -20, 127, -44, 59, 78, -83, 74, 77,
+    -22, 60, 20, -30, 127, -39, 2, 43, -110, -10, 6, -88, 2, 20, -14, 23,
+    12, -98, -75, -59, 52, 127, 13, 127, 109, 91, 3, 65, -49, -4, 20, -8,
+    20, 41, 17, 127, 10, -31, 3, 69, -36, 61, -19, 28, 70, -95, -37, 56,
+    -75, 20, -41, 52, -10, 57, -1, -40, 15, 81, 7, 82, -19, 26, 10, -46,
+    -61, -29, -28, 27, 66, 56, -5, -23, 42, 27, -63, 23, -127, -67, 1, 1,
+    44, 60, -127, 33, -12, -103, 6, 13, 89, 9, -53, 20, -19, -76, 39, 34,
+    93, 33, -12, -40, 10, -29, 1, 127, -38, -36, 29, -116, 8, 16, -39, 60,
+    2, -27, -47, -27, -20, 73, 4, 47, -40, 101, -5, 61, -31, 29, 53, 0,
+};
+
+// model_1/block_5_expand_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data12[96] = {
+    4152, 4062, 2077, -1514, 2117, 6793, 7397, 1756, 793, 6322, 178, -2561, 2096, 2061, 671, -134,
+    2877, 4865, -1939, -625, 3223, 9237, 13916, -1054, -2944, -792, 8185, -1745, 2632, 8, 6453, -626,
+    7176, 3964, 3462, -4615, 878, -3009, 1676, 1877, 2707, 1572, 2187, 526, 486, 1212, 4419, 4258,
+    5236, 1993, 8273, 1726, -1776, 2804, 752, 2282, 2116, 2468, 5015, -284, -873, 5323, 1688, 5838,
+    3917, 3836, -3803, 2594, 3642, -673, 4662, 567, 1756, 2110, 2978, 1961, 362, 1622, 2335, 2524,
+    2399, 1469, 7512, 2667, 2157, 2710, -658, -1643, 13120, -95, 849, -1755, 5685, 2625, -1740, -998,
+};
+
+// model_1/block_5_expand/Conv2D
+alignas(16) static const int8_t tensor_data13[1536] = {
+    -21, 26, -21, -4, 3, -34, -47, -21, 77, -47, 14, -5, 84, -81, 10, -127,
+    -120, 117, -127, -107, -107, 51, 14, 78, -29, 14, 97, -59, 24, 104, 40, 23,
+    -74, -127, -81, -45, -67, -21, 59, -122, -93, 90, 50, 42, 54, 110, -86, 121,
+    -70, -82, -30, -52, -127, 2, -4, -106, -7, -8, -14, -67, -27, 5, -75, -46,
+    47, -11, 29, 16, -6, 33, -127, -6, 23, -11, -15, 46, 13, -29, -8, -44,
+    -58, 116, -127, -48, 82, -29, -30, -111, 32, -114, -1, -37, 73, -53, -119, -69,
+    -19, -30, 14, -1, -70, 52, 14, -26, -55, -38, 127, -31, -21, 15, -68, 16,
+    -118, 112, 127, -39, 81, 92, -44, -117, 116, 42, -63, 34, 100, -61, 8, 85,
+    -66, 19, 4, -71, 87, 19, 87, 127, -71, -22, -13, -49, -18, 79, -21, -55,
+    -23, 14, 3, 51, -127, 80, -43, -105, -58, -19, 113, -16, -12, 8, 28, -60,
+    -48, -69, 25, -97, -127, 119, 57, 59, -69, -58, 20, -7, -12, 68, -108, 20,
+    72, -66, 0, 75, -105, 30, 106, 13, 127, 120, -59, 78, -6, -78, -52, 55,
+    -95, -27, 96, 1, 36, -10, -4, 5, 30, 1, 11, 127, -55, 44, -16, 26,
+    -17, -34, 53, 22, -23, -11, 127, 35, -82, 9, -11, 25, 19, 81, 25, -74,
+    100, -63, 105, 6, 90, 94, 65, 60, -14, 20, 63, 18, 114, 63, 127, -22,
+    -5, 102, -10, -48, 17, 86, -127, 4, -47, -9, -74, -14, -30, 76, 2, -36,
+    -19, 59, 84, -51, 26, 59, 28, -7, 4, 1, -5, 1, 105, -53, 59, 127,
+    2, 53, 127, -70, -12, -8, -12, -59, -34, 44, -74, 16, -53, -22, 90, -77,
+    -75, -28, -43, -68, 127, 90, 5, -13, 74, 68, 36, 26, 7, 53, -53, 43,
+    65, 116, 107, 74, 68, -56, 19, 29, -99, 127, 64, 105, 106, 54, -45, 49,
+    110, -27, 17, 89, -9, 7, -36, 74, -28, 21, -127, 3, 62, -68, -5, -15,
+    -51, -60, -35, 127, -17, -24, -33, 51, -27, 35, 32, 5, -69, 30, 6, 78,
+    -48, -11, -111, -60, 90, -31, -44, 46, 84, 127, 58, 38, -92, -10, -12, -36,
+    -91, -19, -6, 41, 32, 74, 127, 72, -13, 109, -13, -60, -1, 22, -64, -95,
+    9, -104, 30, 10, 127, 33, 99, -13, 31, 35, 48, 32, -39, 73, 0, -6,
+    71, -127, 79, -6, 17, 10, -23, 76, 61, -13, -26, 18, 112, -44, -3, 18,
+    40, 44, 127, 58, 38, 3, -74, 10, 17, 30, -14, 87, -7, -51, 45, -84,
+    2, -19, -63, 8, 13, 110, 35, -105, 66, -127, 51, -15, -2, -34, 26, 64,
+    -74, 22, -74, -89, 127, -51, -55, 15, -90, 61, -72, 90, -36, 1, -33, 22,
+    39, 30, -42, 47, -4, 127, -82, -7, 29, 101, -27, 65, -117, -15, -81, 42,
+    -47, 39, -61, -33, 57, -26, -16, 71, -72, 56, -44, -31, -39, 71, -7, 127,
+    14, -92, 118, 36, 127, 8, -104, 0, -71, 12, -18, -39, -22, 50, 84, 67,
+    -41, 34, -11, -15, -127, 57, 43, -25, 44, -84, 11, 12, 69, 94, -15, 58,
+    -127, 2, 39, 49, -51, 38, -72, -4, -66, -41, 71, -27, -35, 2, -7, 113,
+    -20, -14, 1, -77, 87, -23, 18, 73, 3, -10, -23, -1, -62, 22, -40, 127,
+    103, -54, 21, -35, -11, 51, -66, -42, -19, -127, -68, 27, -16, -18, 65, -16,
+    -23, 12, -51, -6, -30, 127, -13, 58, -2, 12, 78, 27, 66, 36, -27, -14,
+    -7, -22, 33, -68, 11, -93, 44, -34, -127, 61, -88, -34, 47, 38, 96, 42,
+    -109, 92, 26, -97, 71, 19, 71, -72, 14, -9, -78, 20, -56, -85, -127, 17,
+    73, 28, -127, -84, -51, -27, 54, -63, 14, -71, -26, -65, 80, 12, -44, -16,
+    -80, 14, -64, -127, -82, -49, 30, -107, 12, -35, 40, -83, 101, 76, 12, 113,
+    -99, -127, -40, 52, 24, 1, -77, -21, -4, -17, 69, -49, -118, 25, -38, 44,
+    -47, 74, -2, -127, 62, 39, 11, -96, 65, 32, -32, -22, 94, 3, -17, 28,
+    -14, 26, 32, -10, 127, 94, 61, 19, 12, -5, -23, -76, -100, -80, -22, -39,
+    90, 4, 31, 10, 28, 6, 22, 50, 14, -86, 36, -38, 127, -16, -13, -20,
+    -7, -81, -127, 10, -48, -85, -8, 107, 15, -63, 21, -34, -61, 123, 60, -7,
+    -20, -127, 50, 23, -10, 8, -106, 126, 20, -99, 68, 45, 14, 106, 88, 53,
+    -45, -86, -33, 127, 45, -10, 95, 9, 29, -86, -110, -71, 42, -47, -101, 38,
+    -92, 35, -9, -30, -41, 87, 16, -53, 37, -19, 57, -20, -4, -127, -87, -13,
+    -81, 43, 36, -127, -15, -44, 112, 120, -69, -29, -13, 100, -83, 21, -75, -21,
+    68, 42, -127, -26, 56, -91, 43, 34, -77, 71, -66, 11, 66, -43, -74, -39,
+    -97, 0, -41, 112, -94, 0, -77, -56, -62, -127, 11, -37, -63, 34, -8, 126,
+    -127, -7, 13, -41, 5, 36, 37, 2, 36, -35, -38, -58, -96, -94, -65, 16,
+    -10, -22, -123, -101, -15, -21, -22, 77, -3, -70, -95, 30, -59, 44, 86, 127,
+    -33, -100, 8, 8, -65, 38, 92, -50, -37, -52, 21, -32, -39, 20, -127, 97,
+    -10, -11, -15, 2, 19, -1, 61, 76, -60, -15, -127, -30, 30, -16, 0, 69,
+    94, 45, -62, -20, -127, 8, -81, -49, 3, -4, -8, 56, 35, -38, 17, -44,
+    -20, -13, -3, -22, 83, 9, 55, 15, 22, 70, -7, 31, -49, 36, -127, -44,
+    65, 37, 21, -13, 55, -11, -42, -40, 24, -127, -48, -1, -52, -78, -1, 32,
+    -26, 29, 3, 28, 45, 29, -69, -35, 22, 127, -22, 31, 5, -23, -45, -61,
+    -10, -50, 6, -29, -127, -44, 30, -39, 7, 94, -39, 53, 23, 6, 26, 41,
+    8, -10, -44, 29, -50, -30, -127, -74, -27, 3, -7, 106, 83, -8, 93, 11,
+    27, 24, -2, -31, -21, 35, -4, 127, -41, 78, -2, 104, -1, 80, 104, 35,
+    15, -127, -52, -25, -71, -2, 25, -24, -28, 3, 1, -14, -32, 127, 104, 22,
+    -22, -34, -109, -46, -50, 122, 24, -48, -21, -62, -4, 9, 70, 35, -25, 127,
+    -18, -28, 26, 16, 4, -33, 71, 64, -20, 20, -92, -15, 36, 127, -51, 62,
+    -35, -92, 61, -58, -10, -74, 47, -8, 29, -27, 41, 94, -38, -6, -127, 25,
+    -30, -119, -99, 12, -97, 113, -39, -127, -12, -36, -82, -74, 42, -39, -48, 39,
+    78, 41, 3, 10, -47, 12, -18, -29, -19, -127, -20, 1, 33, -25, -8, -22,
+    72, 36, 64, -18, -1, -15, -44, 33, -13, 102, -41, 23, 25, 85, 127, -34,
+    -33, -57, -7, 15, -127, 52, -32, -95, 63, 78, 9, 96, 62, 1, -7, 74,
+    105, -58, 73, 48, -73, -73, -5, -37, 127, -22, -12, 45, -23, -33, 107, -40,
+    38, 4, 95, 113, 78, -27, -127, 57, 80, -49, 20, 68, -41, -77, -98, 6,
+    61, 18, -2, -110, 11, -127, -112, 15, 36, 18, -58, 24, -33, -89, 20, -19,
+    95, 21, 69, 52, -91, -12, 17, 47, -127, -19, -14, 2, 87, -36, 10, -16,
+    80, 114, -64, 36, 40, 29, 7, -6, 32, 1, 46, 57, -127, 42, 42, 82,
+    -127, -83, 5, -35, -54, -1, 94, 33, -65, 24, 95, 70, -53, -119, -45, 84,
+    -57, -13, 36, 94, -19, -110, 64, 60, 58, -88, 46, 73, -67, 127, -25, 98,
+    67, 58, -30, -2, -75, 48, -108, -63, 63, -55, -67, 16, 75, -127, 36, 50,
+    -69, -36, 65, -34, -8, -24, -24, -61, 1, 39, 14, 34, -85, 127, -39, 62,
+    34, 78, 16, -118, 22, 37, 96, -14, 6, 33, -71, 29, 127, 4, 3, -12,
+    50, -95, 38, -127, 23, 44, 19, 109, 112, -7, 26, -8, -39, -34, -83, -35,
+    37, 32, 1, -29, 100, -120, -6, -24, 3, 124, -127, 11, -45, 24, 24, -9,
+    -67, 13, 30, 34, 49, 107, 118, 89, -51, 79, -61, -26, -92, 71, 3, -127,
+    11, -95, -56, 59, -3, -39, -127, 23, -38, 31, -49, -10, -56, 12, -32, -117,
+    -127, 72, -42, -19, 0, -52, -42, 20, -57, -1, -11, -79, -109, -55, -77, -5,
+    21, 1, 21, 127, 21, -45, 74, -2, -17, 11, -49, -67, -12, 89, -83, -14,
+    -46, -6, 127, 20, -108, -35, 65, 60, 16, -31, 28, 37, -62, 18, -12, 14,
+    -37, -43, -97, 62, 50, 86, 64, 10, -21, -41, -127, -110, 83, 16, 14, 5,
+    39, 7, 26, -96, -42, -45, -87, 23, 127, -12, 41, -91, -42, -28, 57, -94,
+    -48, 83, 22, 57, -92, 77, 106, 127, -20, -21, -20, 119, 66, -5, -11, 111,
+    1, 95, 35, 20, 58, 19, -10, -62, -93, 9, -44, 24, -21, -127, -62, -58,
+    -34, 35, -3, -42, -127, -20, -44, 18, -85, 59, 93, 74, -9, 12, 10, 6,
+    81, -24, 104, 47, -127, -57, 32, 42, -37, -70, -10, -52, 27, -7, -24, -54,
+    -66, -119, 42, -127, 37, 36, -8, -20, 107, -35, -8, 69, 23, 23, -45, 53,
+    -41, -71, -127, -49, 68, 20, -97, 43, 122, 34, -105, 91, -35, 68, -21, 48,
+};
+
+// model_1/block_4_project_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data14[16] = {
+    -23611, -5628, 4123, -15868, 4466, -830, 33535, -3927, 15598, -334, 24465, 12389, -2375, -25342, 1239, 4510,
+};
+
+// model_1/block_4_project/Conv2D
+alignas(16) static const int8_t tensor_data15[1536] = {
+    -21, 42, 39, 31, -29, -87, -16, -33, -27, -68, 40, -25, 58, -74, 46, 48,
+    -78, -15, 29, 24, 75, 10, -47, -4, -11, 43, 127, 46, -1, 88, 48, -2,
+    -9, -6, 8, -48, 35, 54, -13, 8, 89, 14, 22, -20, -6, -4, 18, -41,
+    15, -18, 56, -15, -44, 8, 37, 25, 23, -40, 0, 28, -6, 46, -64, -17,
+    8, 29, 52, 9, 14, -22, 33, -6, 17, 13, -2, 25, 61, -17, 31, 35,
+    12, 28, 39, 27, -46, 22, -4, 66, 27, 17, -73, -20, 12, 22, 93, 84,
+    -6, 50, -2, 27, -27, -19, 61, -44, -45, -36, -68, -69, -11, -19, -14, -21,
+    -4, -9, -26, -9, -17, -45, 127, -6, 5, 14, 10, 50, -43, 7, -10, 31,
+    -64, 3, 37, 10, -13, 58, -50, 114, 9, 7, 26, -63, 67, -11, 21, 5,
+    -53, -6, 24, -90, -19, 62, 18, 45, 72, 8, -37, 39, -42, 33, 7, -2,
+    27, 55, 69, 14, -56, -96, 3, 28, 40, 22, -45, 9, -45, 22, 63, -11,
+    48, -34, 70, -32, -22, -27, -2, -6, -12, -28, 26, -9, 25, -112, -28, 32,
+    -17, 21, 33, 2, 102, 60, -35, 12, -76, 8, 8, -29, 66, -19, 24, 29,
+    1, -20, -127, -11, 8, -38, -11, 62, -10, -13, -48, -3, -37, -34, -42, 57,
+    -29, -30, 5, 20, 3, 27, -13, -20, 51, -8, -7, 60, 11, 64, -20, -27,
+    -94, 15, -27, -30, -18, 34, 55, -51, 28, -1, 50, 10, -10, 8, -8, 16,
+    43, -42, -42, -16, 18, 25, -57, -21, 21, 54, 62, 70, -62, -26, -36, -46,
+    38, 54, 59, -23, -2, -70, -27, -39, -20, -18, -61, 50, -1, 14, 86, -15,
+    16, -14, 1, -81, 11, -26, 94, -63, 20, 111, -90, -21, -16, -13, -22, 95,
+    51, 30, -55, 29, -32, 27, 41, 8, -61, 77, 51, -13, -62, 8, -48, 72,
+    -33, -17, 52, -21, 32, -34, -13, 70, 28, 22, 3, 21, 50, -10, 2, 20,
+    54, 5, 27, -51, 100, 26, 59, 11, 28, -15, -23, -29, -12, 58, 57, -22,
+    -24, -60, 127, -40, -31, -29, -59, -3, 2, -81, 17, -74, 39, -26, 121, 9,
+    2, -37, -14, -36, -33, -35, 73, 67, -39, 62, -83, -14, 6, -90, -7, 42,
+    -47, 82, 50, 5, -5, 68, -58, -25, -4, -38, 26, -18, 61, 50, -26, 52,
+    -34, -30, -45, -92, 92, -51, -71, 0, -44, -13, -5, 6, -47, 127, -73, -12,
+    -26, -42, 8, -70, 49, 82, -47, 39, 6, 36, 57, -37, -57, 37, 52, -73,
+    8, -18, -50, -33, -55, 44, 14, 20, 61, 88, -47, 31, -81, -36, -5, -4,
+    51, -5, -42, -14, 57, -11, -10, -107, -9, 35, 64, 48, -43, 47, -45, 74,
+    51, 75, 48, -70, 57, -56, -35, -50, -14, -43, -79, -41, -25, 3, 56, 2,
+    -11, -54, 26, -73, 4, -5, 4, -34, 44, 28, -25, 14, -8, 12, 6, -31,
+    -26, -13, -81, -32, -15, 47, -17, 35, 52, -88, 60, -25, 7, 53, 31, 96,
+    -7, -52, 8, 0, -29, -2, -36, -56, -52, -35, -8, 27, -40, 39, -127, -30,
+    -2, 38, 56, 0, -5, -104, 34, -36, -6, -69, 30, -55, 41, 11, 7, 72,
+    -77, 1, 109, -1, -11, -1, 17, 31, -17, 26, 35, 29, -46, -17, 120, 72,
+    -25, 12, -37, 1, 37, 86, -2, 100, -66, -46, -38, 22, 20, -5, -66, 0,
+    7, -112, 24, 45, -73, 97, -66, -107, -24, -82, -127, 30, -24, -4, -8, 60,
+    25, 28, -33, -54, -50, -39, -75, -59, 23, -37, -16, 84, -81, 27, -3, -4,
+    45, 77, -37, 5, -23, -27, 28, -33, -53, 58, -9, -35, 23, 44, -94, -30,
+    43, 28, -101, -87, 96, 0, 35, -60, 11, -66, 31, -8, -35, -51, 28, 2,
+    60, -37, -66, -28, -81, 66, -26, -59, -21, -76, -15, -83, 89, -12, -92, 23,
+    -61, 55, 3, -64, 52, -45, 0, -7, -81, 51, -72, 53, 24, -117, 78, -112,
+    -32, 13, 1, 62, -41, 15, -1, -41, -80, 0, 40, 22, -28, -71, 19, 35,
+    -18, -1, -35, 1, -39, -39, -34, -48, 25, 34, 22, 67, -8, 42, 45, 1,
+    -33, -127, 39, 36, -27, 43, -31, 36, -29, -11, 33, -65, 7, 18, 40, 81,
+    -37, 69, -28, -11, 43, 9, 3, -63, 11, 17, -77, -5, 56, 10, 15, -66,
+    69, -19, 58, -23, 0, -41, 45, 10, -4, -32, -52, -25, 47, -47, 49, -36,
+    -22, 0, -69, 5, 21, 12, -34, 49, 13, 18, 4, 0, 30, 20, 60, -21,
+    -11, -53, -4, -5, -31, -15, 22, -24, 2, -5, 97, 52, 34, 14, -37, -10,
+    31, -2, 30, -6, -7, -72, -18, 12, -21, -86, 42, -6, -22, 38, 2, -8,
+    -6, 23, -10, -7, -50, -3, 21, -30, -9, 26, 29, -26, 16, 12, 27, -10,
+    28, -8, 54, -25, -11, 9, -46, 9, -10, 117, -46, 23, -45, -64, -71, 44,
+    -79, -30, -49, 7, -17, -20, 51, -23, -28, -127, 22, -94, 3, -2, -59, 38,
+    -3, -7, 7, 54, 74, -37, -38, 51, -45, 90, 34, -19, -74, -2, 1, -41,
+    -20, -60, -23, 45, 74, 16, 29, 16, -37, 9, 18, 64, -57, 64, 24, -24,
+    17, 32, -57, -44, -17, 41, -28, 55, -30, 5, -4, -3, 52, 6, 50, -10,
+    -5, -34, -1, 63, -27, -63, 61, -10, -20, -41, -11, 16, -22, 44, -3, 52,
+    -68, -15, -15, 29, 111, -12, -35, -28, 7, -19, 7, 22, 20, -7, 69, -7,
+    20, 9, 40, 14, 73, 3, -43, 51, -3, -121, -40, -127, -36, -24, 34, -48,
+    -43, 37, -6, -24, 37, -1, -60, -20, -41, 92, 51, 36, 36, 18, -4, 10,
+    25, 57, 8, 16, -34, -8, -58, -54, 57, -27, -63, 28, 2, -7, 1, -36,
+    -20, -23, -2, -18, -3, -9, -26, -61, -9, -39, -87, 40, -67, 86, 44, -3,
+    31, -20, -69, -28, 45, 22, 3, 31, 17, -29, 32, -47, -28, -2, -28, 33,
+    16, -6, 23, -8, -42, 17, 2, -20, 13, 22, -28, -26, 12, -80, -21, -44,
+    41, -10, -127, -80, -41, 10, 67, -50, 12, 51, 25, 47, 78, -25, -116, 8,
+    -18, 36, -7, -31, -25, -10, -103, -92, -31, 28, 9, 25, 73, -28, 9, 2,
+    24, 2, 44, 38, 32, 41, 27, 25, 52, 9, 36, -12, -14, -16, 11, -16,
+    -34, 54, 36, -59, 14, 11, -2, -20, 44, -21, 26, 0, 41, -70, -89, 21,
+    50, 80, -76, -1, 44, -44, 85, -41, -44, 1, -11, 19, -30, 15, 16, -16,
+    37, 0, -18, -59, -6, -27, -69, 55, -31, 7, -9, -5, -3, 9, -23, -65,
+    0, -29, -127, -92, -24, -60, -116, 29, 14, 25, 2, 6, 14, -4, -116, -95,
+    4, -3, -19, 50, 29, -31, 56, 36, 1, -28, 42, -16, -44, 60, 124, 52,
+    -14, 6, -84, -2, 20, -54, 20, 11, 108, -50, 42, -29, -1, -5, -51, 23,
+    32, -53, 12, 2, -28, 41, 33, 9, 0, -52, -120, 12, 69, -4, 45, 47,
+    -2, -73, 73, 7, 56, -28, 14, -2, 38, -76, -24, 58, 51, 6, 18, -34,
+    -43, -6, -109, 127, 71, -6, 46, -78, 1, -17, -69, -33, -19, 51, 71, 10,
+    -41, 36, 7, 23, 75, 40, 38, 11, 27, -10, -31, -13, -32, -45, 15, -40,
+    28, -55, 16, -19, 18, 12, -11, -95, -3, 19, -9, 56, -2, 18, -2, 63,
+    3, 1, -80, 79, 26, 2, -13, 20, 56, 96, -21, 39, -123, -41, 88, -30,
+    51, 28, 64, 15, -80, -68, -51, -28, 56, 91, -21, 55, 39, 34, 61, -55,
+    9, 72, -36, 63, -10, -48, -41, -77, 13, -8, 14, 31, 47, -18, -53, 93,
+    -39, 36, -8, 23, -28, -5, 69, 16, -17, -79, -44, -10, 49, -22, 10, -41,
+    17, 127, 117, 45, 83, -11, -60, 5, 43, 73, -84, 67, 19, -106, 114, -85,
+    -65, -22, -19, 49, 23, 36, -53, -45, -18, -38, 60, 66, 47, -2, 90, 70,
+    -51, 78, 48, 60, -20, -91, 21, 11, -49, 6, 90, -37, -71, -6, 45, 7,
+    -9, 12, -95, 33, -22, 44, -127, -2, -40, -3, -52, -104, -13, 29, 30, 86,
+    -107, 4, 28, -11, 9, -41, -3, -30, 51, -27, 49, -28, -18, 77, -54, 10,
+    -14, -49, 17, 50, -35, 23, -20, 45, -51, 50, 5, 47, 20, 78, -20, 42,
+    3, -31, -12, -87, 61, 5, 98, 34, -62, 41, 19, 1, 36, 32, 33, 12,
+    -43, 90, 11, -105, 79, 0, -16, 20, -65, -22, -21, 9, -17, -23, 25, 40,
+    56, 3, -10, 18, 40, 9, -8, 15, 8, 17, -33, -21, 78, 48, 42, -21,
+    -1, 25, -44, 27, -13, -53, 8, -36, 34, 10, 80, 10, 6, -34, -20, 32,
+    84, 4, 16, -64, 44, 54, 68, 43, 65, 20, -7, 23, -46, -127, 29, -18,
+    -43, -2, 16, -3, -3, -27, -33, 31, -4, 11, -44, 17, -23, -60, -20, 16,
+    41, 13, -53, 20, -2, -17, -14, -23, 12, -105, -54, -74, -32, 23, -106, 13,
+    34, -36, 16, 30, -34, 3, -18, -10, 56, 80, 3, -47, -18, -32, 16, -15,
+};
+
+// model_1/block_4_depthwise_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data16[96] = {
+    5147, -1640, -6537, 15377, -2847, 244, -613, -2319, 8578, -12885, 625, 220, 10802, -7148, -3681, -8119,
+    523, -2127, -6498, 308, -3685, 5352, -3695, 857, 39, 8194, -11956, -3565, -821, -3572, 8843, 34,
+    16056, -706, -5149, 3665, 1180, 9544, 1102, 16251, 49, 5705, -5706, 16707, -465, -68, 6778, 7956,
+    -13725, -234, -8617, -1370, -5148, -11514, -602, 3504, 2265, 5943, -34, 1957, -803, 1054, -537, 608,
+    16883, 874, 20472, 13881, -66, -151, 8998, -2671, -225, -2808, -945, -2581, 10779, 12985, 13595, 11028,
+    4700, -2104, 9307, 16436, -3233, -4611, 10710, -6602, 5869, -446, -4196, -3277, -590, 2224, 19237, -1607,
+};
+
+// model_1/block_4_depthwise_BN/FusedBatchNormV3;model_1/block_4_depthwise/depthwise;model_1/block_6_expand/Conv2D
+alignas(16) static const int8_t tensor_data17[864] = {
+    -7, 37, 41, -97, 72, 8, 41, 3, -22, 73, -31, -84, -127, 53, -27, -9,
+    -14, 0, 3, 1, -74, 18, 36, 68, -4, -127, -8, 10, 29, 33, -12, -8,
+    -69, -1, 36, -69, -8, -127, 29, -55, 11, -103, 41, -48, -2, 56, -41, -34,
+    66, 25, 62, 50, -84, 67, 11, -24, -111, -35, 6, -10, -21, -29, -14, -66,
+    -22, -31, -53, -46, 1, 19, -127, 45, 87, 26, -24, 2, -37, -45, 127, -127,
+    -127, 21, -127, -19, 41, -5, 8, 67, -21, -24, -35, -23, 0, 50, -22, -11,
+    -127, 32, 111, -43, -34, 4, 127, -3, -15, 28, -75, 32, -41, 26, -57, 127,
+    2, 127, 127, -42, -30, 127, 127, 125, 25, -2, 92, 25, 127, 86, 127, -55,
+    -63, -21, -52, -81, -29, -86, 127, 67, -31, -127, -18, -81, 39, -22, -21, 17,
+    92, 4, 42, 127, -50, 127, -127, -28, -108, -17, -7, 35, -4, -127, -102, -52,
+    -91, -3, 0, -127, 10, 6, -38, 127, -127, -4, -7, -39, -127, -54, -25, -90,
+    -16, 17, 41, -115, 124, 118, -127, 33, -127, 4, -32, -4, 10, 115, -21, -81,
+    -22, 38, 0, -97, 66, -3, 38, -8, -37, 127, -25, 21, -110, 84, -19, 21,
+    -18, -19, 33, -2, -73, 0, 30, 60, -6, -110, 68, 40, 34, 46, -19, -3,
+    -89, -5, 60, 42, -24, -90, 9, -60, -16, -35, 33, -44, -8, -61, -54, -48,
+    123, 16, 78, 22, 9, 56, 22, -29, 41, -38, 12, -9, -3, -10, -97, 6,
+    -29, -37, 127, -29, -10, 4, -88, 75, 61, 7, -24, 67, -86, 1, -52, -112,
+    -92, -1, -77, -30, 17, -14, 1, 16, -32, -37, -29, 46, 12, 48, -40, -10,
+    -53, 1, 57, -127, 39, 74, 10, 11, -19, 55, -16, -46, -98, 47, 28, 69,
+    -4, 59, 64, 40, 11, -47, 68, -13, 39, 77, 127, 61, -36, -2, -22, 3,
+    -71, -4, 102, -21, 5, -79, -47, -126, -6, 35, 127, -70, -65, 127, -51, -96,
+    80, 43, 82, -21, -64, 127, 80, -14, -58, -29, 38, -11, -5, -35, 57, -3,
+    -56, 7, -27, -58, -13, 2, -44, -25, 85, 109, 1, -44, -69, -127, -50, 4,
+    -14, -1, 0, -54, 127, 33, -41, 20, 17, 127, 53, -84, 127, 7, -14, -8,
+    68, 127, 127, 98, -127, -127, 47, -87, 127, 105, -57, -79, -33, 127, -2, 82,
+    127, -124, 56, 127, 127, -87, 1, -127, -127, -109, 74, 127, -111, 127, -16, 127,
+    -123, 127, 89, -85, 127, 51, 2, -48, 127, 0, -99, -127, 127, -23, 127, 113,
+    127, -127, 127, -100, 127, 116, -94, 127, -106, 127, -127, 127, -115, 79, 85, -42,
+    107, 127, -15, 122, -127, -127, 82, -127, -25, 127, 127, 115, 27, 0, 106, -12,
+    24, 127, 83, 116, 53, 95, -121, 127, -34, 50, 106, -5, -113, -7, -90, 14,
+    -39, -19, 48, -104, 24, 41, -21, 13, -45, 55, 10, 127, -90, 57, 27, 103,
+    -25, 54, 42, 27, 7, -44, 80, -24, 38, 67, 27, 67, -27, 2, -29, 8,
+    -127, -23, 116, 127, 1, -36, -51, -122, -31, -20, 54, -73, -45, -88, -51, -127,
+    91, 41, 67, -26, 85, 62, 115, -23, 110, -28, 42, -17, -9, -23, -101, 52,
+    -83, -5, -59, -50, -17, 6, -64, -27, 53, -40, -21, 127, -23, -115, -52, -30,
+    -19, -23, -80, -96, 64, 38, -31, 49, -8, -101, 41, 127, -40, 4, -27, -1,
+    -46, -48, -14, -45, 44, 17, 13, 35, -38, 69, 36, -50, 52, 62, 33, -14,
+    0, -15, -20, -42, 67, -69, 46, -50, 5, 1, -7, -65, -14, -24, -124, 2,
+    -27, -10, 60, -43, -13, -46, -41, -44, -23, 55, 79, -54, 6, 39, -93, -30,
+    -70, 11, -31, -10, 57, 50, 29, -33, 26, -27, 15, -45, 29, 40, 26, 107,
+    -127, -30, 104, 32, 21, 46, -43, -7, 38, 10, -17, -48, -13, 4, -13, 2,
+    15, 10, -126, -17, 114, -2, 11, -27, 48, 18, -36, -20, 1, -42, -127, -7,
+    37, -68, 51, -37, 8, 4, 8, 127, -86, 81, 127, -27, -24, 38, 127, 33,
+    -16, -30, -7, -88, 55, -55, 114, -57, 4, 45, 5, -28, -7, -10, -100, -78,
+    10, -22, -127, 9, -105, -4, -9, -127, -33, -58, -5, 87, 4, -20, 10, -13,
+    56, -1, -44, -13, 89, 74, -50, -47, 4, -69, 34, -82, 127, 26, 127, 64,
+    -127, -55, -6, -111, 102, 24, -19, 43, 26, -14, 1, -20, -12, -56, 10, 25,
+    0, -25, -69, -127, 86, -127, 2, 4, -16, 6, 127, 16, 20, -127, -81, 127,
+    -23, -13, -39, -46, 41, 11, 3, 22, -44, 53, 26, 55, 54, 65, 26, -14,
+    -20, -8, -14, -47, 52, -65, 17, -46, -2, 1, -44, -60, -29, -2, -98, 14,
+    32, -4, 9, -48, -9, -5, -34, -19, -38, -28, 28, -67, 0, -10, -81, -49,
+    -33, 6, -16, 3, 47, 40, 22, -16, 127, -27, 17, -31, 19, 49, 46, 127,
+    -75, -27, -7, -2, 23, 34, -45, -39, -23, -35, -12, 2, -11, -20, 78, -3,
+    21, 8, -106, -16, 54, 3, 7, -26, -23, -12, -49, 39, 6, -37, -101, -7,
+};
+
+// model_1/block_4_expand_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data18[96] = {
+    240, 4755, -275, 3342, 4300, 18258, -571, 1426, 9662, -892, 10442, 6982, 3067, 247, 2117, 728,
+    1874, 2089, -340, 8537, 197, 5297, -4483, 608, -10666, 4057, 3092, 860, 2777, 1299, 2053, 6259,
+    1598, 17959, 2045, 8931, 4376, 1505, 1972, 957, 14074, 1778, 1534, 1680, 3456, 9491, 4316, 10303,
+    2364, -32, 1428, 2972, 2863, -2223, 7982, 35, 1516, 9789, 72, 1776, 2044, 11815, 4498, 78,
+    5668, 11067, 1661, 4208, 8771, 3847, 1701, 1333, -2632, 4700, 3034, 2442, -46, 6796, 3181, 4041,
+    2225, 570, 3152, 12867, -1643, 6603, 4262, 1323, -1086, 3415, 183, 7973, 3685, 2099, 2809, 3104,
+};
+
+// model_1/block_4_expand/Conv2D
+alignas(16) static const int8_t tensor_data19[1536] = {
+    60, -30, -23, 111, -127, -56, 105, 10, 38, 68, -24, 44, 24, 48, 1, 41,
+    -22, -23, -76, -62, 110, 47, 32, -25, 1, 13, -67, -13, -90, 80, -127, -55,
+    -33, 64, 75, -12, 87, 79, 22, 52, 6, 5, 19, 2, 70, -127, -10, 19,
+    127, -82, 63, 42, 67, 45, -71, 37, 17, 64, -8, 8, -39, 59, -44, 28,
+    -127, -39, -1, 32, -115, 21, -125, -78, -82, 49, 10, -28, -42, 29, -16, 110,
+    -127, 7, 37, -10, 118, 2, 36, 73, -113, 63, -12, -29, -94, 79, -86, -13,
+    -110, 28, -26, 3, 1, -72, 127, 22, 11, -42, -61, 35, 53, -14, -44, 18,
+    -12, 67, -70, -104, 92, 113, 127, -37, -61, 49, 18, 55, 101, 49, -82, 48,
+    2, 20, -115, 62, 29, 28, -37, -33, 5, -11, 31, 49, 127, 47, -75, -17,
+    -55, -116, -14, 108, -20, -78, 3, 96, 64, 16, -26, 127, -123, 36, -19, -1,
+    -20, -4, -109, 66, -86, 74, 41, -82, 37, -99, 52, -37, 33, 74, -127, 84,
+    -14, -94, 29, 42, 92, 127, 26, 47, 2, 57, -42, -36, -42, 106, -76, 100,
+    -34, -30, -43, 83, -77, -127, 43, 80, -28, 34, -47, 83, 34, 4, 94, 49,
+    -58, -15, -40, 1, 1, -10, 24, 16, -4, 127, -14, -10, 41, 21, 15, -19,
+    -81, -88, 2, -14, -22, 15, 25, -16, 107, -108, 88, 20, 124, -24, 18, -127,
+    -9, -127, 108, -75, -74, -34, 11, 64, 27, -62, -89, -39, 120, -51, -57, -67,
+    -7, -34, 14, -19, 18, 29, -7, 24, 80, -127, 43, -13, 21, -33, -43, -102,
+    -38, 3, 98, -32, 54, -5, 29, -7, 72, -96, 34, 75, 127, -31, 15, -95,
+    62, -4, -20, -104, -20, 5, 59, -35, 47, 31, 14, 69, -1, 50, -17, -127,
+    -117, -25, -46, -127, -21, 55, -10, -3, -40, 33, 60, 1, -22, 43, -23, 29,
+    15, 48, 53, -44, 49, -36, -21, 54, -97, -127, 38, -32, -46, 90, -2, -12,
+    17, -77, -75, 60, 127, 1, 23, 42, -77, -7, -31, -10, 60, -54, -61, -2,
+    65, 3, 109, 6, 69, 37, 84, -1, 24, 127, -16, 28, -8, -12, 84, 6,
+    -91, -79, -33, 127, 64, 34, 24, 6, -56, -17, 26, -51, 10, 76, 4, 71,
+    44, 9, 47, 61, 5, -112, -8, -4, 35, 127, -85, 82, -36, -54, 64, -45,
+    48, -64, 88, 52, 41, 4, -16, 53, -127, 99, 95, -125, -17, 37, 85, 1,
+    -20, 30, 15, 33, -56, 127, -15, 44, -37, -37, -84, 46, 7, 29, 65, -119,
+    63, 7, 8, -41, -41, -12, -82, 20, -106, -12, -100, -35, -71, 63, -34, 127,
+    -69, -5, 26, -4, 57, 0, -127, -40, -10, -49, -33, -6, 30, -68, -84, -59,
+    -13, -127, -9, 74, -59, 23, 126, -12, 93, 31, -105, 66, 38, -23, -36, 50,
+    -18, -65, -61, -47, -127, 28, 17, -31, -18, 30, -13, -27, -29, 13, 30, 65,
+    -127, -25, -36, 62, -69, -40, -70, -32, -49, -51, 21, -29, -82, -43, -55, 49,
+    -123, -65, -55, -19, -127, -25, 29, -43, 59, 16, -65, -65, 28, 76, 46, 25,
+    -47, 2, -82, 75, -78, -82, 76, 46, -127, 7, -49, -71, -13, 86, 88, 94,
+    12, 47, 62, 70, -31, -8, 59, -4, -50, -108, -1, 83, -28, 127, -33, 96,
+    121, 9, -45, -33, -127, -19, 123, 0, 37, 32, -96, 20, 58, 101, 89, 95,
+    20, -15, -20, 33, 127, 41, 55, 39, -13, 11, -54, -28, 25, -8, -28, 22,
+    -127, 27, 4, -49, 14, -82, -35, -23, -15, -39, -19, 8, 36, -46, 14, -90,
+    22, 47, 22, -27, -24, -13, -90, -46, -33, -51, 17, 12, -39, -127, 66, -9,
+    19, 46, -29, 48, -2, 10, 116, -22, -29, 54, 7, -31, 16, 127, 24, 47,
+    71, 13, 39, 54, -127, -1, 22, 47, -34, 7, 5, -19, -34, -41, 84, -34,
+    -39, -44, 35, 62, -108, 127, -19, 62, -67, 48, -117, 14, 2, 72, 102, -122,
+    -11, -83, 36, -6, 127, 2, 59, 26, 6, -63, -68, -29, -85, -12, -32, 34,
+    -37, -63, -41, 18, 105, 14, -17, 89, -66, -41, -127, -92, 105, -29, -71, 80,
+    3, -81, -43, -127, 36, 109, 23, -18, -12, -64, -50, -3, -37, 14, -11, 121,
+    -8, -78, -86, 18, -127, 81, -69, -65, 63, -28, 44, -10, 2, 72, -79, 54,
+    -10, -90, -33, -25, 65, -14, -60, 67, 32, -23, 108, 41, -22, -18, 17, -127,
+    -34, -74, -38, 91, -96, -17, 58, 8, -40, 127, 92, 30, -86, 40, -8, 30,
+    52, -17, -100, -127, 46, -65, 27, 108, 58, -116, -24, 46, -44, 6, -64, -101,
+    39, -10, 21, 26, 32, -13, 57, 59, -82, 127, -32, 33, -77, 25, 77, 108,
+    14, 8, 1, -6, -127, -3, 1, -42, 55, 26, 18, 27, -17, -53, 11, 11,
+    -4, -45, -25, -127, -74, 40, -39, -53, 2, 30, 19, -17, 27, 36, -14, -8,
+    5, -2, -18, -67, 59, -44, -28, -9, 48, -14, 127, -37, 14, -14, -31, 28,
+    -63, -86, 32, -10, -63, -127, -24, -117, 25, 127, -97, 104, -67, -12, 22, -122,
+    109, 73, -3, 5, -127, -83, -85, -89, -31, 28, 99, 100, -19, -52, 71, -21,
+    16, 21, -31, 55, -84, -7, 59, 49, 31, 127, 57, 23, -17, -23, 20, 7,
+    24, -125, -24, 71, -51, -28, -1, 53, 25, -8, 35, 44, -77, 27, 5, 127,
+    -21, 39, 124, -110, 106, 29, 30, 1, -15, -12, 4, 127, 92, 14, 67, -31,
+    85, -96, 12, -26, 57, 38, -2, 127, 55, 92, 31, 57, 19, -21, 12, -50,
+    -48, 40, 79, -102, -30, -3, -23, 4, 34, 35, -2, -64, -127, -24, 38, 8,
+    20, 12, 30, 22, -27, 6, -1, -45, -6, 127, 1, -4, -29, -53, -35, -8,
+    83, 46, 35, -38, -63, -127, -33, -29, -22, 15, -47, 48, -120, -33, 91, 5,
+    -25, 107, -29, 23, -46, 127, -67, 30, -2, 29, 21, 21, -28, 13, 17, -102,
+    44, -14, -48, -122, 15, -52, 127, -43, 21, -104, -99, 11, -11, 48, 22, -44,
+    -21, 0, -11, 20, 20, -49, 38, 82, -105, -19, -47, -49, -25, 127, 24, 97,
+    -71, -46, -89, -48, 102, 125, -81, -51, -127, -46, 39, -69, -71, 100, 49, 65,
+    -42, 55, -3, 50, -43, 127, -41, 32, -77, 11, -28, 60, -53, 33, 53, -75,
+    -12, -17, -54, 45, -28, -127, 24, -89, -1, 9, 53, 123, -64, 27, 49, -106,
+    1, -98, -5, 96, 63, 6, 2, 90, -15, 127, 24, 30, -25, 94, -37, -3,
+    9, 98, 118, -80, -28, -25, -40, 74, 42, 95, 58, 47, 31, -127, 19, -22,
+    31, 83, 46, -37, 89, 3, -127, -28, -120, -100, -3, 48, -9, 21, -101, 11,
+    -24, -80, 86, -7, 78, -50, 0, 43, -54, 29, -127, -55, 16, 38, -36, -25,
+    6, -2, 42, -2, -27, -37, -61, -62, -10, 12, -9, 31, 7, 73, -127, -13,
+    -1, -39, -32, -71, 2, -116, 64, -24, 115, 63, 127, -46, 45, -9, -74, 125,
+    7, 5, -19, 69, -64, -4, 95, 52, 48, 89, 34, 127, 126, 36, -53, 1,
+    -30, 35, -26, 29, -59, 127, 9, 39, -35, 11, -38, 31, 3, 58, 28, -68,
+    -90, 64, 4, 70, -88, 2, -21, -10, 44, -1, -41, -16, 29, -19, -127, 74,
+    82, 117, -79, 106, 31, 72, 59, 103, 116, -19, 127, -12, 50, -8, 70, 40,
+    10, -23, 23, -47, 48, -127, 18, -9, 33, 55, 106, -26, 0, -16, -31, 119,
+    -55, 101, 4, 38, 20, -49, -39, 7, -123, 17, 32, -18, 127, -15, -35, -43,
+    -84, 12, 34, 14, 122, 18, -10, -10, -70, 42, -118, -25, -32, -74, 78, 127,
+    79, 94, -21, -15, 21, -37, 89, 127, -71, 91, -98, -28, -20, 6, 119, 96,
+    21, 51, -59, 24, 97, 32, 127, -41, -32, -8, -57, 89, 46, 51, 28, -25,
+    -21, -45, -16, 3, -9, 41, -45, -92, 47, -50, 72, 27, 38, -39, -86, -127,
+    -123, -56, -48, -19, -19, 92, 127, 50, 45, 39, 107, 74, 21, 66, -97, 48,
+    94, 59, 127, -76, 15, -26, 3, 37, -4, 46, -66, 38, 20, 35, 106, 40,
+    -58, 55, -25, -1, -7, 119, 3, 17, 98, 64, 127, -51, -20, 46, -41, -27,
+    16, -45, 22, -41, 41, -127, 39, -23, 53, -15, 75, -36, 41, -37, -41, 78,
+    -26, 60, 26, 16, 90, -16, 71, 6, -33, -79, 74, -83, 127, 97, 84, -102,
+    -31, 38, -25, 28, -38, 127, -40, 31, -24, 9, -26, 16, -5, 51, 13, -101,
+    42, -91, -4, 12, 127, 22, 42, 22, -43, -65, -94, -7, -15, -8, -46, 37,
+    -5, 65, -23, -10, -24, -24, -127, 58, -63, 13, -38, -35, -65, -79, 19, -36,
+    64, 48, 12, 36, -118, -127, -6, -3, -44, 78, 21, -29, 12, -83, 31, -17,
+    -22, -35, 3, 59, 6, -18, 1, 38, 92, 48, -3, 127, -35, 38, -22, 17,
+    48, -42, 127, -43, -12, -5, -17, 37, 55, 46, 26, 24, 1, -2, 66, -27,
+    -63, -34, -17, 24, 127, 58, 33, 24, -28, -2, -33, -87, -18, 38, -81, 53,
+};
+
+// model_1/block_3_project_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data20[16] = {
+    1240, 6271, -16442, 1777, 11043, -12806, -40191, -8763, -13301, 14573, -11217, -15356, 789, -6834, -5221, -4976,
+};
+
+// model_1/block_3_project/Conv2D
+alignas(16) static const int8_t tensor_data21[768] = {
+    24, 40, 27, -36, 50, 59, -28, 53, 3, 86, 2, 32, -14, 37, -4, 43,
+    16, 66, 8, -63, -46, 88, -5, 35, 80, 17, 38, 52, -26, -61, -35, 67,
+    -14, 4, -67, 30, 48, -127, -36, 17, 15, -36, 81, -11, -12, -53, -72, -34,
+    -39, 4, -62, -55, 15, 75, -59, 19, -7, -29, -37, 55, 63, -5, -47, -35,
+    -37, -25, 5, 16, -54, 63, -106, -49, -45, -25, 53, 47, -41, -14, 47, -21,
+    -2, -55, -33, 60, 28, -38, 127, -30, -19, 36, -27, -14, 35, 44, 41, 24,
+    20, 6, 33, -4, -17, -58, 9, -32, 91, 54, -51, 15, 127, -50, 121, 66,
+    -66, -5, -9, 37, 92, -90, -36, -92, -22, -40, 37, -57, 55, 38, -28, 25,
+    0, -18, 63, 52, -51, 26, 14, -48, 13, 28, 87, -26, 9, -87, 101, -85,
+    42, -3, -31, -31, 24, 120, 24, 3, 40, -58, 27, -29, -49, 18, 8, 57,
+    -43, -76, 52, -127, 1, 15, -27, 4, -34, 87, 127, 68, 17, -49, 25, 54,
+    66, -46, 91, 24, -48, -57, 0, 45, 19, 11, 12, -10, 19, 30, -19, -23,
+    95, -25, 17, -54, 100, 88, 43, 4, 29, -5, -99, 30, 40, -23, -3, -12,
+    -103, -108, -34, -86, -3, 20, -37, -60, -89, 127, -74, 120, -5, -56, 34, 92,
+    17, -62, 9, -10, -36, 19, -36, 24, -48, -28, -4, 53, -57, 114, -14, -69,
+    -12, -12, -63, 18, -28, 55, 28, -10, 55, 64, 40, 93, 52, -25, 27, -11,
+    -48, 127, -33, 38, -3, -13, -67, -11, 24, -3, -70, -35, -10, 40, 17, -17,
+    -59, 24, 38, -1, -42, 1, -88, -9, 75, -21, 24, 63, -45, 1, -46, 25,
+    24, 1, 6, 79, 19, -28, 124, 6, -32, 83, 125, 85, 26, 74, -31, 58,
+    13, -44, -63, 101, 59, -57, -53, 62, -86, 97, 72, 0, 88, 25, -30, -13,
+    70, -5, -127, -43, 80, 28, 4, 20, 6, 47, 60, -22, 60, 118, 44, -25,
+    -101, -6, -15, 23, -49, -49, 26, 50, 85, 106, -53, -95, -100, 11, -23, -16,
+    -103, 105, 8, 127, -40, 53, 19, 34, 1, -107, -19, -80, 36, 59, -3, 18,
+    4, -6, 15, -13, -16, -45, 111, 31, 11, 20, 29, -25, 31, 63, -31, -6,
+    -27, -100, 52, -68, 60, -59, 85, -65, -14, -101, 41, 28, -38, 32, 34, 55,
+    -8, 13, -32, 110, 26, 42, -38, 25, 96, 2, -50, -31, -99, -37, -72, -126,
+    -28, -73, -7, 87, 4, 34, 123, 34, 24, -28, 104, 127, -21, -87, -17, 70,
+    16, -29, 1, -63, 24, 62, -48, 43, 48, -64, -16, -26, 15, -52, 114, -12,
+    -15, -110, 50, 36, -72, 46, 29, -34, -7, -103, -17, 63, 17, 71, -15, -17,
+    -38, 28, -32, 127, -8, -43, -32, -63, -26, 1, 24, 82, 26, 65, -94, 29,
+    -26, 19, -35, -12, 16, 18, -70, -11, 43, 15, 63, -12, -24, -6, 48, -61,
+    -70, 127, -29, 47, -12, -2, 14, 35, -38, 23, 9, 90, 49, 20, -42, 1,
+    98, 16, -8, 17, -15, -51, -66, 9, -90, -5, 30, 6, 20, 56, 10, 55,
+    -35, 54, -19, 32, 23, 59, 12, -11, 19, 43, -127, -53, 77, 33, -9, -30,
+    -5, 14, -32, -58, -5, -14, 77, -1, 66, 25, -20, 37, -15, 18, -3, 46,
+    5, -20, -41, 15, 62, 69, 96, 18, 40, -27, 71, 15, -45, 3, 78, -20,
+    -45, 2, 33, 66, -36, -45, 23, -3, -30, -21, -127, 9, 76, -90, 36, 44,
+    59, 86, 87, -110, -20, 57, -61, -46, -18, 6, 20, -21, -9, 5, -10, 84,
+    54, 84, 58, -39, -39, -40, 46, 3, -25, 27, 51, -7, 43, 2, -54, -29,
+    -44, -83, -37, -105, 10, 27, 46, 71, -111, 1, 105, -53, 61, 41, 126, -2,
+    110, 13, 19, -92, 58, -76, 127, -19, -59, -8, -29, 16, -36, -94, -85, 23,
+    74, -38, -80, 42, 24, -61, 77, -64, 0, 65, 46, 48, 59, -16, 96, -58,
+    48, 41, -57, 17, -39, 25, -82, -60, -27, 51, 82, 34, -10, -55, 29, -38,
+    54, -120, 18, 19, 112, -76, 14, 19, -21, 114, -91, -1, -72, -24, -92, -13,
+    127, 71, 89, -18, -93, 9, -2, 59, -31, -41, 123, -40, -46, -66, -60, 49,
+    -59, 27, 21, 38, 101, 13, 24, 69, 33, 84, -16, 85, 70, -19, -34, -19,
+    8, 36, 21, -52, 24, -77, -53, -67, 46, -83, -59, 98, -32, 37, 21, 24,
+    -76, 13, 127, -1, -109, 34, 80, -46, -64, -38, 28, -18, -38, -25, -1, -8,
+};
+
+// model_1/block_3_depthwise_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data22[48] = {
+    15867, -212, 19930, -23, 18368, -1563, 40815, -711, 8727, 53881, 2704, 31043, -3821, 13664, 38419, 31826,
+    697, -1164, 2404, 48768, 2216, 18617, -2762, 12769, 10559, 49160, 3054, -1091, -8721, 23665, 30811, -608,
+    900, 1658, 502, 16265, 13064, 45040, 3762, 27420, 28410, 6874, 951, 13767, 3066, 1355, 34629, 31566,
+};
+
+// model_1/block_3_depthwise_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise
+alignas(16) static const int8_t tensor_data23[432] = {
+    -121, 117, -127, 80, -127, 89, -46, 57, -127, -88, 94, -78, 116, -75, -12, -87,
+    75, 74, 80, -93, 119, -127, 103, -78, -105, -96, 89, 125, -82, -2, -126, 67,
+    75, -89, 83, -108, -123, -77, 85, -109, -37, -103, 127, -80, 87, 51, -80, -79,
+    -127, 127, -73, 79, -78, 112, -42, 94, -103, -127, 127, -113, 127, -116, -36, -98,
+    76, 97, 127, -127, 127, -94, 106, -85, -127, -112, 89, 127, 45, -15, -127, 127,
+    95, -127, 89, -127, -123, -115, 99, -127, -127, 70, 125, -100, -42, 91, -127, -127,
+    -12, 104, -32, 12, -14, 76, -19, 29, -72, -63, 78, -44, 55, -80, 0, -47,
+    2, 58, 64, -30, 79, -82, 68, -38, -75, -30, 29, 80, 112, 25, -104, 74,
+    44, -68, 42, -17, -45, -63, 45, -79, -123, -42, 66, -4, -88, 22, -76, -96,
+    -100, 55, -69, 113, -90, 127, -127, 115, -94, -92, 79, -85, 106, -81, -89, -109,
+    112, 102, -28, -97, 78, -79, 109, -91, -60, -99, 95, 109, -127, -64, -97, 86,
+    106, 25, 106, -110, -102, -126, 110, -103, -100, -127, 107, -110, 127, 80, -81, -78,
+    -121, 97, -82, 127, -101, 124, -122, 127, -71, -127, 110, -127, 127, -102, -127, -127,
+    127, 127, -18, -112, 76, -63, 127, -127, -60, -127, 127, 118, 40, -66, -100, 96,
+    127, 25, 127, -83, -127, -127, 127, -109, -120, 83, 122, -105, -63, 127, -81, -102,
+    -49, 75, -112, 34, -61, 39, -61, 84, -21, -58, 81, -91, 43, -108, -101, -25,
+    41, 59, -29, -44, 36, -37, 102, -30, -25, -42, 39, 103, 125, -22, -63, 58,
+    48, 3, 41, -34, -64, -59, 58, -74, -60, -55, 86, -65, -117, 68, -42, -83,
+    -82, 26, -6, 49, -37, 79, -73, 77, -58, -38, 24, -45, 75, -76, -58, -75,
+    73, 40, -96, -72, 7, -50, 68, -35, 5, -43, 36, 24, -69, -100, -62, 82,
+    65, 46, 52, -90, -55, -75, 27, -71, -82, -81, 59, -111, 86, 50, -31, -52,
+    -94, 48, -78, 81, -78, 69, -103, 107, -73, -61, 37, -59, 57, -127, -107, -76,
+    80, 54, -123, -78, -13, -6, 88, -51, 2, -50, 64, 70, 22, -127, -82, 83,
+    67, 76, 69, -45, -65, -76, 47, -70, -58, 62, 34, -127, -40, 76, -30, -38,
+    -45, 68, -118, 45, -34, 9, -62, 83, -26, 15, 37, -36, 30, -61, -90, 2,
+    36, 10, -99, -31, -6, -13, 70, -31, 23, -5, 15, 61, 95, -105, -102, 8,
+    37, 61, 56, -48, -50, -46, 25, -29, -5, -30, 56, -34, -78, 60, 3, -49,
+};
+
+// model_1/block_3_expand_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data24[48] = {
+    1424, -980, 769, -1602, 3482, -652, 4203, -2916, 526, 520, 1994, 3861, 361, -664, 1388, 4306,
+    -1778, 3187, 6089, 886, 252, 2012, 70, 3803, 1475, 1365, 1059, -1285, 25547, -74, 1576, -1809,
+    -635, 4160, -51, 2634, 2565, 481, -64, 5620, 1380, 7783, -3266, 731, 7508, 0, 1856, 2734,
+};
+
+// model_1/block_3_expand/Conv2D
+alignas(16) static const int8_t tensor_data25[384] = {
+    73, 43, 127, -10, 65, 108, -83, -67, 12, -100, -127, 7, 43, 35, 49, -7,
+    -127, 6, -41, -24, 42, 24, -67, -42, 33, 81, 127, -40, -21, -126, -57, -30,
+    -127, 20, -34, -20, 52, 18, -30, -38, -102, 15, -69, -5, 19, 36, -82, -127,
+    -54, -126, -127, 73, 97, -29, 35, 33, -63, -103, -81, -65, -127, -65, 20, 71,
+    91, 39, -4, 7, 105, -83, -127, 17, -33, 47, -39, 97, -44, -29, 127, -43,
+    -25, 127, 17, 57, 117, -32, 3, 55, -80, -30, -33, -3, -92, 46, 127, -8,
+    83, 28, -127, 19, -2, -46, -74, -20, 57, -8, -64, 2, -6, -127, -27, -2,
+    22, -112, 88, 11, 127, -89, -29, -9, -34, -33, -15, 127, 42, 51, -46, 7,
+    95, 38, -28, 19, 53, -66, -127, -18, 48, 127, 60, 74, 36, 33, 28, -89,
+    12, -31, 35, 46, 127, -19, 15, 14, 22, 127, 25, 11, -125, 10, -10, -32,
+    -17, 46, 54, -127, 24, 18, -35, 104, -44, 68, 31, -118, 35, 46, -3, 127,
+    -72, -63, -57, 19, -123, 127, 102, -20, 100, -7, -127, 40, -8, -28, -68, -45,
+    -42, 44, 22, 1, -45, 59, -127, 89, -87, -43, -127, 12, -56, -77, 64, 77,
+    74, -9, -33, -47, 106, -26, 127, -51, 127, -64, 24, 88, 16, 44, -14, 105,
+    52, 86, 30, -17, 127, -44, 72, -62, 7, -38, -28, -88, -115, 26, 127, -54,
+    25, -114, -79, -66, -127, -5, 26, -35, 26, 25, -16, -26, -127, 1, -41, -18,
+    33, -61, -51, 63, -4, -86, 127, -105, 39, 127, 43, 71, 36, -25, -3, -38,
+    -126, -17, 88, 6, -25, 127, 69, 40, 5, 114, 127, -7, -72, -108, -84, 20,
+    -112, 13, 76, 12, 8, 127, 52, 46, -23, -92, -18, -100, -56, -127, 100, 36,
+    53, -40, 103, -83, 57, 69, -127, 7, -5, 111, -127, -67, -20, 64, -22, 122,
+    53, -49, 39, 44, 12, 2, 17, 127, -40, 127, 96, 14, -5, 57, -98, 12,
+    47, -64, -127, -8, -64, 6, 6, -50, 1, -68, 0, -84, 127, -81, 5, 43,
+    38, 119, 127, 21, -25, 28, -99, 35, -55, 45, 19, 78, -127, 46, -120, 28,
+    -44, -43, 53, 31, -87, -127, 11, 4, -39, 55, 43, -36, -127, 46, 5, 23,
+};
+
+// model_1/block_2_project_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data26[8] = {
+    142, 4938, 22035, 1053, 1165, -11321, -1618, -9260,
+};
+
+// model_1/block_2_project/Conv2D
+alignas(16) static const int8_t tensor_data27[384] = {
+    -41, -52, 6, -106, 17, -11, 95, 76, -95, -94, 6, 33, -60, 2, -58, 26,
+    -74, 16, 0, 121, 75, -24, 1, 127, 84, 34, 27, 36, -94, -65, -66, -28,
+    -52, 108, 43, -38, 20, -24, 94, -4, 29, 6, -22, -86, 9, -44, -28, -64,
+    -2, 68, -31, -73, -104, 60, -30, -77, -41, 54, -37, -1, 37, 39, -69, 0,
+    -12, -127, 88, -58, 125, 26, -61, 25, 59, -12, -82, 70, 27, -15, 69, 32,
+    -57, -10, 9, 13, 3, 91, -22, -42, 68, 40, -20, 29, 126, -16, -30, 53,
+    -4, -23, 118, -3, 87, -43, 5, 5, -49, 9, -24, 44, -16, -53, -39, -127,
+    -46, -106, -17, 20, -119, 30, -29, -48, -57, 36, -1, -46, -25, 2, -27, -23,
+    -22, -8, 12, 13, 35, -29, -54, 10, 53, -40, 27, -41, -26, -46, -62, -71,
+    58, 35, 52, 11, 14, -52, -14, 34, -75, -44, 18, -18, -108, 72, -19, 33,
+    53, 14, -40, 7, -84, -51, 127, -45, -20, -18, -56, -57, -107, 82, 95, -71,
+    -15, -126, -3, 50, 32, -93, -28, 81, -81, -91, 12, -2, -80, -6, 53, -16,
+    24, -18, 93, -24, 12, 0, -4, 9, -67, -24, -11, -14, 33, -67, 45, -95,
+    46, 51, -16, -39, 16, 39, 28, 1, 6, -20, 83, -23, 38, 35, -127, -18,
+    -43, -8, 25, 8, 44, -16, 37, 7, -44, -13, -96, 42, -14, -94, 9, 39,
+    14, -54, 39, 45, 23, 39, 32, 41, -73, 8, -32, 48, 46, -24, 5, -41,
+    74, 68, 21, -26, 65, -79, 127, -95, -28, 57, 7, 36, 11, 13, -36, -42,
+    -11, -49, -50, -5, 37, 22, 60, 7, -89, 37, 36, 25, 28, -1, 87, -5,
+    -56, 42, -96, 85, 41, 29, 14, 14, -14, 9, 46, -89, -98, -38, -30, 35,
+    -94, 25, 9, 70, 17, 39, -50, -65, -29, -10, 18, 41, -20, -17, -40, 6,
+    26, 57, -13, -22, 4, 14, 72, 4, 63, 60, -64, -63, -2, 127, -32, -60,
+    27, 71, -68, 35, -8, 36, 112, 90, 43, 58, -127, 17, -52, 8, -64, -50,
+    9, 55, 118, 92, 106, 5, 91, 14, 118, 83, -45, 93, -50, 25, 13, -86,
+    36, -68, -14, 43, 21, 72, -62, 45, -73, 23, 10, -90, 67, -39, 52, -11,
+};
+
+// model_1/block_2_depthwise_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data28[48] = {
+    -155, 12444, -590, -1271, 3383, -1404, 676, -5710, -3776, -585, 238, -176, -513, -5330, -4705, 4596,
+    7002, 2840, 117, -4841, -12275, -3748, 22183, -1113, -2610, -353, 6059, -6621, -1777, 20, -7913, 7982,
+    2072, -645, 3673, 809, 189, -1066, 11245, -685, 5359, -1222, 2529, 6607, 225, 7446, -1144, -1884,
+};
+
+// model_1/block_2_depthwise_BN/FusedBatchNormV3;model_1/block_2_depthwise/depthwise;model_1/block_3_depthwise/depthwise
+alignas(16) static const int8_t tensor_data29[432] = {
+    2, -110, 10, 6, -48, -28, -23, 69, -34, 13, -57, 15, 71, 93, 12, 19,
+    80, 15, 68, 9, 35, -8, -59, 14, -11, 1, -12, -7, -40, 84, -1, -127,
+    56, -3, -59, -48, -34, -39, 21, 14, -30, 112, 20, -20, -19, 102, 118, -28,
+    -127, -127, -22, 127, -91, 42, -86, 127, 11, 35, -58, -15, 56, 109, 31, -26,
+    -19, 57, 36, 30, 17, 127, 24, 127, 127, -31, -63, 32, 78, -127, 14, -77,
+    34, -16, -72, -127, 10, 31, -62, -39, -127, 2, -71, -127, 23, 117, 96, 127,
+    2, -110, 9, -5, -42, 48, 24, 63, -20, -40, -34, 9, -16, 68, 25, 12,
+    -38, 21, -83, -14, 7, -45, 127, 10, -50, 14, 0, 65, 33, 38, 14, 7,
+    17, -7, -23, 60, 16, 53, 8, 49, 17, 8, 26, -8, -10, 70, -41, -45,
+    -22, 34, -17, 12, 19, -87, 127, -59, -1, 6, -10, 36, 127, 65, 12, -30,
+    -18, -18, 38, 21, 113, -51, 50, 8, -80, 127, -90, -21, 127, -87, 0, -54,
+    -28, 20, -71, 21, -6, -92, -41, 6, 100, 127, 22, -113, -56, -74, -35, 106,
+    102, -36, 127, 23, 127, 25, -55, -25, 46, 127, 127, -127, -99, 127, 127, 127,
+    127, 127, 94, 127, 127, 80, 0, -9, 119, -110, -127, 76, 35, 117, 127, -4,
+    -127, 127, 127, 115, -127, 127, -127, -127, 32, 25, -127, -39, 127, -127, -46, 112,
+    14, 88, -32, 3, -63, 127, -105, 82, 47, -97, 6, 52, -48, 54, 5, -66,
+    27, 3, -127, 16, 17, -100, -46, -8, 96, -26, -17, 127, -67, -33, -1, -30,
+    -23, 16, 98, -30, 41, 4, -1, -82, 93, 8, 33, 62, -49, 108, 127, -99,
+    1, -13, 1, -32, 28, -62, -1, 4, 30, 29, -1, 20, -10, 32, 23, -7,
+    -39, -15, 5, -50, 16, 40, 116, -19, -94, 2, 34, -37, 3, 4, 16, 10,
+    36, 9, -57, 14, -4, -42, -23, 43, -20, -18, 15, 14, -34, 8, 16, 49,
+    36, -13, -42, -30, 48, 19, 111, -63, 127, -46, 0, -1, -73, 2, -35, -90,
+    -20, 62, -10, 33, -6, 58, -15, -45, -79, 47, 67, -16, -97, 4, -3, -10,
+    9, 10, -33, -9, 62, -50, -32, 114, -97, -67, -42, 27, 21, 60, 44, -110,
+    -6, -14, -1, -23, -14, 6, -10, -45, -6, -40, 7, 22, 12, 19, -16, 5,
+    47, 11, -27, -4, 10, 37, -53, -24, 33, -41, 20, -23, -28, -7, 1, 18,
+    39, -8, -20, -38, 8, 15, 15, 25, -13, -71, -4, 3, -20, 31, 123, -48,
+};
+
+// model_1/block_2_expand_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data30[48] = {
+    2404, 6230, 15049, 565, 1783, -1256, 5302, 11387, 2650, -192, 2176, -1815, 9974, -705, 1274, 15091,
+    -204, 1355, 687, 2271, 4376, 2001, 571, 9101, 3914, 4170, 4592, 1360, 4020, 4903, 833, 930,
+    426, 863, -461, 101, -2072, -132, 2336, 2105, 16148, 3184, 3047, 4473, 3402, 3544, 1351, 4331,
+};
+
+// model_1/block_2_expand/Conv2D
+alignas(16) static const int8_t tensor_data31[384] = {
+    43, 127, -91, -88, -5, 92, 10, 47, 69, -102, 1, -127, -51, 73, -88, -41,
+    -44, 127, 116, 46, 122, -6, 61, 28, 78, 20, -75, 35, -19, -79, -127, -17,
+    -41, 44, 3, -62, -87, 118, 127, 30, 20, 99, -127, -58, 50, 65, 13, -17,
+    -1, 104, 38, 65, 127, 16, 62, -56, 117, -16, -36, 29, 76, -24, 127, -3,
+    40, 127, 58, 111, 88, 75, 103, -63, 30, 93, -127, -37, 8, 73, -24, 66,
+    -73, -71, 47, -67, 15, -19, -93, 127, -14, -127, -95, -39, 18, 6, 28, -6,
+    -41, -100, -116, -47, -127, 36, -110, 18, -6, 27, -103, 119, -127, -40, -5, -6,
+    -49, -48, -127, 4, 43, -5, 7, -77, 39, -127, -112, 1, -70, -29, -72, -6,
+    127, -73, -28, 63, -94, 26, 31, 94, -36, 105, 127, -21, -41, -25, -15, -23,
+    -15, -127, 43, 87, -7, -46, 55, -38, 127, -55, -68, 28, -100, -7, 31, 94,
+    -32, -127, 92, 84, -27, -88, -7, -70, 21, -64, -52, -33, 127, -28, 26, 24,
+    -127, 28, -76, 45, 32, 33, -102, -105, -55, -61, 23, -26, -109, 127, 82, -30,
+    -5, 27, -12, -51, -34, 127, 76, 22, -10, -127, -83, -45, -127, -30, -52, -85,
+    18, 66, 8, 127, -64, 40, -71, -9, 19, -94, 34, 66, 17, -35, -10, -127,
+    14, 66, 19, 26, 127, 1, 38, -43, 114, 16, -72, -6, 3, -127, -113, -5,
+    20, 5, 29, -127, 29, -43, 9, -14, 34, -73, 11, 69, -26, 16, 14, 127,
+    -114, -22, 56, -79, -47, 127, 92, 92, -50, 35, 49, -28, 28, 127, -88, 73,
+    30, 127, -56, -23, 15, 38, -69, 57, 33, -127, 35, 57, -35, -50, 18, -55,
+    -19, -37, -90, -2, -127, -73, -2, 48, -37, -127, 53, 91, -82, -87, -22, -83,
+    -60, 27, 52, -47, -127, -82, -63, 68, 96, -110, 11, 127, -22, -122, -6, -93,
+    -5, 71, 6, 81, -127, -11, -67, 3, 127, 121, -85, -97, 33, 52, -19, 18,
+    22, -46, -24, 0, 127, -1, 33, -16, 117, 47, 79, 17, -90, -20, 56, 127,
+    86, 53, -5, 51, 122, -127, -105, 17, 21, 5, 33, 43, 73, -127, 17, -100,
+    33, -36, -14, 127, 36, 47, 24, 55, -106, -127, 75, 20, -62, 46, 72, -78,
+};
+
+// model_1/block_1_project_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data32[8] = {
+    9755, 16945, -2513, 3419, -2102, 4137, -9726, -17476,
+};
+
+// model_1/block_1_project/Conv2D
+alignas(16) static const int8_t tensor_data33[384] = {
+    -42, 3, 30, 6, -29, -14, 20, 4, -44, -11, -65, -46, -25, -64, -2, -37,
+    43, -45, 42, 49, -19, 34, -14, 8, 7, -36, 46, -10, -1, -14, 14, 16,
+    79, 32, 34, -127, 15, 1, -10, -31, 5, -21, 42, 51, 32, -3, 25, -3,
+    9, 14, 49, -25, -4, 39, -59, -14, -6, 10, -15, -94, 1, 94, -23, 60,
+    -25, 10, -21, -60, 13, -97, -39, 15, -69, -7, -12, -127, -29, -11, 17, -90,
+    37, 56, -47, -8, 124, -24, 8, 61, -30, 28, -88, -35, 122, -23, -39, -32,
+    5, -25, -60, 19, -2, 50, 16, 10, 1, 44, -19, 18, 69, -87, 14, -64,
+    31, -78, 33, 33, -38, 46, -42, 25, -30, 58, -24, -64, 10, -8, 17, -68,
+    -86, -98, 33, -14, 97, 23, -11, -57, -6, 33, 81, 34, 127, 19, 19, 30,
+    -22, 25, -65, 49, 21, -39, -69, -99, 22, -12, -17, 12, 3, 16, 28, 75,
+    -16, 5, -23, 13, 23, -106, 36, -49, -70, -15, 127, -12, -29, 0, -62, 13,
+    10, -91, -2, -14, -13, -35, -10, 101, -41, -37, 4, 12, 34, 15, -45, 48,
+    -25, -56, -2, 14, 35, -31, -8, -5, 36, -38, 63, -75, 2, 23, 12, 25,
+    -15, -26, 22, -12, -6, -51, -4, -22, 16, -5, 36, 34, 38, 16, -23, 34,
+    -12, -6, -6, 10, -65, 100, 42, -38, 27, -30, -22, -14, -76, 9, 127, 20,
+    67, 6, -8, 16, 21, -43, 28, -127, 36, -30, -16, 98, -87, 83, 29, -80,
+    2, -82, 33, 18, -59, 68, -65, -46, -54, 88, -27, 25, -30, 52, -45, -22,
+    -10, 45, 19, -1, -54, -23, -43, -48, 10, -34, -51, -2, -42, 46, 93, 19,
+    45, -42, 19, -12, -38, -23, -34, 26, -39, 1, -43, 127, -48, -42, -13, 61,
+    5, 59, 20, 36, 33, -91, -15, 16, 21, 33, -65, 1, 10, -45, 17, 40,
+    -1, 9, -23, -1, 8, 16, 7, -13, -18, -15, 40, 60, -9, -35, 78, -10,
+    -14, -3, -24, 65, 30, 36, 3, 27, 25, -11, 76, -9, 109, 97, 58, 58,
+    55, 38, -8, -24, 40, -18, -75, -12, 5, 15, -23, 52, 24, -25, -19, -15,
+    17, -16, 26, -89, -52, 31, 37, 55, -20, 34, 86, 127, -51, -31, -99, 42,
+};
+
+// model_1/block_1_depthwise_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data34[48] = {
+    9865, 5048, 2318, 2083, 806, -300, -2026, 32813, -126, -875, 7471, 51714, 108, 6517, -6, 13690,
+    1030, 16009, -1258, 9871, 14206, 40, 4881, -7016, 11559, 2535, 3227, 14179, 3201, 992, -9203, 12799,
+    5662, 1799, -2644, 11113, -10543, 5606, -732, 19363, -3434, 1342, 949, 2151, 1087, -1131, 627, -2528,
+};
+
+// model_1/block_1_depthwise_BN/FusedBatchNormV3;model_1/block_1_depthwise/depthwise;model_1/block_3_depthwise/depthwise
+alignas(16) static const int8_t tensor_data35[432] = {
+    -34, -100, -12, -63, 127, -67, 79, -65, -92, -62, 3, -46, 94, 69, 82, -109,
+    56, -37, -4, -26, -107, 101, -17, -4, 9, 42, 67, -22, 87, -87, 3, -51,
+    -71, -87, 67, 61, 25, 97, 110, -66, -95, -44, 27, 63, 57, -101, 74, 104,
+    -24, -117, -39, 68, -79, 117, 71, -96, -87, 26, 100, -123, 127, 85, 119, -85,
+    -80, -96, 18, -43, -62, 122, -78, 78, -69, 46, 104, -113, 85, -59, 2, -107,
+    -104, -108, 95, 127, 103, 116, 127, -78, -105, -70, 58, 71, 94, 127, 87, 73,
+    14, -26, -52, 65, -37, -18, 37, -6, 109, 57, 81, -80, 44, 47, -27, -18,
+    -88, -34, 28, -36, -18, 59, -66, -15, -57, 23, 32, -73, 34, 72, 111, -51,
+    -26, -1, -11, 73, 59, 95, 48, -16, -28, 104, 63, 15, 44, 42, 19, -107,
+    -96, -83, -8, -95, -60, -110, 127, -126, -127, -127, 122, -69, 59, 85, -117, -62,
+    127, -127, -51, -72, -80, 105, -70, -8, -6, 103, 106, -49, -109, -89, 4, -82,
+    -63, -123, -127, 70, 36, 127, 10, -62, 79, -8, 65, 127, 82, 117, 124, -83,
+    -88, -127, -66, -127, -24, 127, 126, -127, 82, 66, 127, -127, 77, 127, 51, -127,
+    45, -68, -113, -127, -127, 127, -127, 127, -127, 127, 127, -127, -127, 127, -17, -127,
+    -127, -127, 74, 121, 127, 119, -16, -127, 127, -109, 127, 108, 127, 3, 127, 127,
+    -26, -4, -127, 108, 55, -39, 44, -49, 78, 40, 18, -55, 19, 54, 100, -84,
+    -25, 2, -6, -69, -74, 31, -46, -16, -110, 53, 28, -90, -46, 45, 127, -71,
+    -94, -7, 85, 95, 74, 72, -43, -66, 53, 127, 87, 18, 45, -54, 32, 38,
+    -84, -54, 19, 35, -58, -48, 63, -30, 22, -54, 28, 27, -25, 42, -53, -38,
+    -68, -56, 127, -61, -12, 32, -98, -12, -6, 43, 76, -43, 3, 48, -5, -41,
+    24, -112, -48, 36, 18, 17, -69, -39, 24, -1, 20, 81, 45, 45, 27, -64,
+    -127, -73, -42, -79, 68, 49, 65, -51, 122, 35, -53, -15, -21, 43, -127, -89,
+    9, 4, 73, -91, -65, 40, -58, 43, -95, 78, 64, -81, 0, -11, -13, -84,
+    -68, -50, -85, 96, 45, 35, -114, -119, 10, -73, 80, 76, 63, -118, 45, -5,
+    -29, -36, -48, -48, -16, -9, 53, -31, -70, 32, -37, -5, 2, 3, 32, -35,
+    -9, 16, 10, -31, -39, 18, 12, -16, -73, 40, -1, -36, -17, -72, 38, -16,
+    -96, 10, 16, 74, 40, 17, -51, -48, -14, 20, 30, 16, 35, -29, 19, 74,
+};
+
+// model_1/block_1_expand_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data36[48] = {
+    700, -521, -570, 1076, 7674, 1807, -290, 3177, 1190, 1246, 21, 2360, 797, 197, -269, 680,
+    2390, 9553, 2328, -347, 725, -1033, -8, 3239, -393, -822, 833, 36, 4485, 14452, 2911, -64,
+    331, -189, 2584, -54, 496, -259, 666, 738, 1417, 1596, 299, -193, 423, 1213, 924, -77,
+};
+
+// model_1/block_1_expand/Conv2D
+alignas(16) static const int8_t tensor_data37[384] = {
+    -52, 29, 14, -36, -87, -47, -127, 15, 66, -62, -42, -56, 127, -75, 95, 20,
+    -116, 127, -61, -87, 38, -24, -9, 54, 76, 13, 94, 38, 60, 110, 127, -33,
+    -95, -125, 79, 5, -53, -127, 8, -64, 127, -3, 114, 72, -100, -37, -9, -27,
+    25, 34, 127, -26, 45, -25, -36, 23, 37, 11, -127, -23, -55, 105, 110, -83,
+    13, 74, -2, 27, 34, 127, 14, 53, -47, 93, -91, 86, 5, -127, 25, 110,
+    -14, -127, -23, -30, -82, -109, -38, -89, -127, -91, 122, 64, -7, -78, 106, 67,
+    -27, 44, -127, 63, 33, -42, -58, 83, 108, -127, 81, 103, -2, 26, 40, -68,
+    -36, 104, -41, -94, -23, -127, -25, -65, 7, 117, 30, -20, 49, -49, 127, -106,
+    -125, -127, -24, 105, -40, 37, -8, 85, -42, -98, -127, 88, -53, 116, -29, 86,
+    -108, -77, -38, 62, -6, 57, -19, 127, 56, -105, 97, -127, 13, -85, 25, -42,
+    9, 53, 17, 6, 58, 127, 66, -17, 30, 119, 49, -37, 38, -67, 95, -127,
+    54, 7, 91, 9, 7, 127, 28, -45, -106, -52, 44, -73, 75, 81, -55, -127,
+    -105, -102, 59, -106, 87, 122, -50, -127, 127, 21, -54, -22, 15, 29, -52, -12,
+    -90, -34, -127, -30, -40, -46, -4, -24, 78, 41, 0, -62, -127, -28, 97, 109,
+    -97, -89, 1, 64, -75, -127, 24, -5, 94, 80, 34, -127, 19, -7, -69, -84,
+    -89, -74, 45, -67, 70, 89, -37, -127, 48, 34, -11, 127, 4, -86, 7, 14,
+    -10, 127, -15, 31, 28, 94, -16, 53, -5, 127, -86, 31, 29, -14, -26, 13,
+    -127, -105, -32, 110, 1, 31, 5, 106, -55, 127, -44, -5, 73, 102, 61, 66,
+    76, 28, 0, -64, -123, -15, 70, 127, -79, 121, 36, 20, -122, 127, -11, -98,
+    43, 47, 63, 0, 127, 58, 100, 30, -23, -53, 32, -11, 13, 44, -75, 127,
+    -106, -68, -59, 113, -3, 8, 19, 127, 127, 9, 73, 71, -60, -13, -8, -1,
+    -37, 7, -69, -127, 56, -101, 16, 63, 41, -2, 84, 5, 36, 127, 98, 6,
+    -30, -20, -54, 127, 42, 5, -49, -30, 37, 95, 75, -86, 49, -58, 26, -127,
+    -26, -102, -28, 34, 11, 44, -55, 127, 6, 38, 72, 13, 64, 85, 127, -31,
+};
+
+// model_1/expanded_conv_project_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data38[8] = {
+    -9892, -3953, 12136, -8882, 21381, 6360, -9578, 12635,
+};
+
+// model_1/expanded_conv_project/Conv2D
+alignas(16) static const int8_t tensor_data39[128] = {
+    8, -17, -25, -72, -33, -40, 26, -22, 33, 9, -22, -11, 115, 127, -13, -95,
+    127, -50, -41, 7, -47, 67, -59, -46, -46, 73, -24, -45, -12, 6, -44, -6,
+    -34, -103, 49, 43, 56, -69, -91, -26, 35, -98, 23, -127, 53, -22, -88, 40,
+    31, 13, 26, 1, -13, 67, -53, -16, 127, 50, 15, 12, 4, -18, 10, 20,
+    -73, -34, -40, -127, -16, 52, 59, -120, 35, -34, -48, -41, -108, 32, -29, -15,
+    82, 44, 61, -41, 44, -38, -127, -107, -15, -67, 58, 47, -42, 52, 51, -37,
+    95, 41, -127, -68, 20, -70, 14, -79, -28, 24, -98, 75, 83, -84, 28, 55,
+    -127, -8, 105, -43, -58, 2, 0, -64, -49, 60, 85, -25, 58, -19, 12, 33,
+};
+
+// model_1/expanded_conv_depthwise_BN/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data40[16] = {
+    24123, -708, 314, 3249, -810, 294, 9119, 1389, -971, 419, -1994, 3488, 970, 123, -270, -1216,
+};
+
+// model_1/expanded_conv_depthwise_BN/FusedBatchNormV3;model_1/expanded_conv_depthwise/depthwise;model_1/block_5_project/Conv2D
+alignas(16) static const int8_t tensor_data41[144] = {
+    -8, -1, 17, -4, -19, 9, 3, 17, -10, -13, 3, 5, 8, -3, 6, -3,
+    -22, -16, 21, -2, 15, -3, 5, -27, 0, 7, -17, 81, -5, 22, -21, 0,
+    -6, -2, -5, -12, 1, -15, -3, 11, 2, 0, 2, -5, -2, -4, 1, -3,
+    0, -26, 2, 6, 127, -23, -127, -20, 127, 127, 2, 5, 127, -27, -11, -24,
+    -127, 127, 127, 0, -85, -91, -10, -102, 12, -105, 127, 127, 122, 127, 127, 127,
+    17, -15, -8, 3, -12, 127, 7, -10, 0, -12, 3, -6, 12, -7, -22, -14,
+    2, -6, -6, -22, -17, 16, 58, 8, -11, -8, -3, 4, 8, -4, 1, -13,
+    21, -29, -12, -127, 6, -16, -9, 127, -4, 2, -25, -10, -10, -67, -38, -36,
+    -1, 2, -11, -5, -2, -5, -8, -1, 1, 2, -5, 2, 6, -11, -8, -14,
+};
+
+// model_1/bn_Conv1/FusedBatchNormV3
+alignas(16) static const int32_t tensor_data42[16] = {
+    169, 503, 54, 1386, 49548, 64852, 3530, 8802, 5056, 3797, 997, -41, 4342, -19018, 49, 44382,
+};
+
+// model_1/Conv1/Conv2D
+alignas(16) static const int8_t tensor_data43[144] = {
+    -86, -110, -31, 67, -37, 16, 33, 127, 18, 105, -95, -11, -127, 104, 23, 13,
+    -2, -12, -24, -1, -47, 35, 96, 127, -13, -95, -80, 120, 126, 58, 2, -21,
+    -14, -101, -127, -43, 26, -46, -2, 32, -127, 1, 22, -102, -27, -79, 12, -4,
+    -127, 19, 1, -82, 8, -5, -16, 79, 127, -50, 55, -16, -36, -51, -88, 45,
+    28, -7, 127, 62, -13, 38, 9, -25, -21, -30, 52, -54, -86, 127, -27, -61,
+    96, -27, 47, -3, -30, 127, -6, -8, 96, -4, 25, 88, 12, -37, -127, -29,
+    12, 39, 17, 7, -19, 10, 64, -94, 35, -85, 127, -45, -41, 49, -9, -127,
+    115, 7, -78, 79, 6, 45, -12, 0, 105, 82, 21, 109, 127, 54, -30, -27,
+    48, 45, 99, -127, -16, -69, 80, -92, -39, 16, -116, -127, 12, -8, -95, -27,
+};
+
+static const int32_t operator_0_multiplier[16] = {
+    1545993107, 1387856268, 1843382857, 1122192343, 1531874023, 1187850458, 2092981502, 1372576652, 2138004394, 2106443006, 1578430185, 2093808382, 2085849341, 1179954820, 1942144930, 1226500998,
+};
+
+static const int32_t operator_0_shift[16] = {
+    -6, -4, -6, -6, -9, -9, -7, -9, -7, -9, -5, -5, -6, -9, -5, -8,
+};
+
+static const int32_t operator_1_multiplier[16] = {
+    1211880192, 2075309952, 2073271936, 1134424320, 1552486656, 1483150848, 2109598720, 1226050816, 1888923520, 1665838976, 1174807936, 1984301568, 2122513792, 1843753088, 1917822976, 1391223296,
+};
+
+static const int32_t operator_1_shift[16] = {
+    -7, -7, -7, -6, -4, -4, -7, -4, -6, -4, -6, -7, -8, -6, -7, -5,
+};
+
+static const int32_t operator_2_multiplier[8] = {
+    1657750734, 1139498045, 1688896485, 2144727890, 1851993926, 1768444508, 1859663467, 1196065180,
+};
+
+static const int32_t operator_2_shift[8] = {
+    -9, -8, -9, -9, -9, -9, -9, -8,
+};
+
+static const int32_t operator_3_multiplier[48] = {
+    1703290142, 1296738130, 2075607252, 1130836875, 1374869257, 1082574901, 1116040977, 1585179419, 1216674929, 1730685250, 1373953443, 2118406083, 1705802021, 1317612516, 1151233724, 2075929726,
+    1747540186, 1157772652, 1856744637, 1310251572, 1634081039, 1368947098, 1580613172, 1540808269, 1105600302, 1179966142, 1407232399, 2110635199, 1257608492, 1637344249, 1585101215, 1207018988,
+    1412411616, 1345169495, 1825648595, 1230335914, 1407074249, 1706664643, 1644756723, 1836059905, 2075536646, 1266802014, 1133006017, 1568119157, 1762453311, 2093996038, 2040083799, 1566449637,
+};
+
+static const int32_t operator_3_shift[48] = {
+    -5, -5, -6, -5, -7, -5, -4, -6, -5, -5, -5, -6, -6, -5, -5, -6,
+    -6, -7, -6, -5, -5, -6, -5, -6, -5, -4, -5, -5, -6, -8, -6, -4,
+    -5, -5, -6, -5, -5, -5, -5, -5, -6, -5, -5, -5, -5, -6, -6, -5,
+};
+
+static const int32_t operator_4_multiplier[48] = {
+    1167479936, 1558837376, 1138280832, 1481133568, 1533892096, 1583408512, 1183413120, 1105811072, 1649963264, 1635687296, 1415576064, 1124890368, 1298938240, 1474886016, 1936024960, 1774183936,
+    1372196352, 1911669248, 1484387328, 1664878592, 1531517440, 1323700864, 1540371456, 1539530240, 1376345088, 1539606528, 1315544448, 2006228352, 1227422848, 1434323456, 1427179520, 1842641280,
+    2114080128, 1442648320, 1848265856, 1457080704, 1533627392, 1392809600, 1432206080, 1461041408, 1315541632, 1662107008, 2110556288, 2143826816, 1423468416, 1759768320, 1411870464, 1957550720,
+};
+
+static const int32_t operator_4_shift[48] = {
+    -7, -7, -6, -7, -5, -7, -7, -7, -7, -8, -8, -8, -7, -8, -7, -7,
+    -7, -6, -7, -7, -7, -5, -7, -6, -7, -7, -8, -8, -6, -4, -6, -8,
+    -8, -7, -7, -8, -8, -8, -7, -8, -7, -7, -8, -8, -8, -6, -8, -7,
+};
+
+static const int32_t operator_5_multiplier[8] = {
+    1357268245, 1575886247, 1692536442, 1663392642, 1075960129, 1734215689, 1301076493, 1461037502,
+};
+
+static const int32_t operator_5_shift[8] = {
+    -8, -9, -9, -9, -8, -9, -8, -9,
+};
+
+static const int32_t operator_6_multiplier[48] = {
+    1575328069, 1547963161, 1542859414, 1835353426, 1774696198, 1980572482, 1833369533, 1915654061, 1212620828, 1122497344, 1853434102, 1659179107, 1945854232, 1788182323, 1959135672, 1607708805,
+    2093690127, 1651152638, 1925386816, 1461966129, 1157649463, 1709290676, 1169513100, 1233807963, 1293850905, 1726243750, 1936596444, 2093176352, 1171490125, 1955257177, 1443704693, 1629380866,
+    1824218781, 1979044667, 2095571907, 1146904614, 1481196044, 2036188812, 1649984510, 1417582895, 1618072559, 1308586895, 1488429643, 1219902506, 1183053374, 1353527062, 1560183395, 1098910075,
+};
+
+static const int32_t operator_6_shift[48] = {
+    -6, -7, -8, -6, -6, -6, -7, -8, -6, -5, -6, -6, -8, -6, -6, -8,
+    -6, -6, -6, -6, -6, -6, -5, -7, -6, -7, -7, -6, -6, -7, -5, -5,
+    -6, -6, -6, -5, -6, -6, -6, -6, -8, -6, -6, -6, -6, -6, -5, -6,
+};
+
+static const int32_t operator_7_multiplier[48] = {
+    1874123648, 1419139072, 1138258432, 1886952576, 2123257984, 1684228352, 1906628224, 1994098176, 1499088896, 2038059392, 1208684800, 2065487744, 1323734272, 1405552640, 1429533440, 1489147648,
+    1779155456, 1964828416, 1249894784, 1380514816, 1286820608, 1117958784, 1479667584, 1220805888, 1143471616, 1081562496, 1945272064, 1186942848, 1573201536, 1515915136, 1906506624, 1815494656,
+    2055652608, 2085434368, 1862505728, 2060092928, 1958917376, 1332049024, 1713768320, 1322729984, 1975408128, 1648589568, 1761475072, 1348372736, 1704541824, 1403706368, 1108800128, 1966263808,
+};
+
+static const int32_t operator_7_shift[48] = {
+    -6, -7, -4, -6, -7, -6, -6, -6, -7, -7, -6, -4, -5, -7, -6, -5,
+    -7, -8, -6, -6, -6, -6, -8, -5, -6, -5, -6, -6, -6, -5, -7, -7,
+    -7, -7, -7, -6, -4, -6, -7, -6, -6, -7, -6, -6, -6, -8, -8, -7,
+};
+
+static const int32_t operator_8_multiplier[8] = {
+    1375369505, 1626514105, 1836358516, 1603231238, 1852853557, 1131864735, 1763400806, 1332834782,
+};
+
+static const int32_t operator_8_shift[8] = {
+    -9, -9, -9, -9, -9, -8, -9, -9,
+};
+
+static const int32_t operator_10_multiplier[48] = {
+    1649889227, 1915392497, 1076138544, 1469266006, 1437860267, 1567828550, 1123751103, 1132202068, 1818545280, 1966128480, 1322645417, 1218157292, 1797985582, 1932228081, 1300713113, 1251750196,
+    1643566100, 1631414328, 1791857520, 1834919356, 2029845229, 1526636187, 1573715860, 1114677598, 1676055092, 1670938375, 1584251094, 1861323457, 2059076912, 1770838830, 1339946350, 2096498944,
+    1545324293, 1247365668, 1650502099, 1288836658, 1254043965, 1918251994, 1471852306, 1760069597, 1124310077, 1427940554, 1149406991, 1872310135, 1505667025, 1477330681, 1771431838, 1496894792,
+};
+
+static const int32_t operator_10_shift[48] = {
+    -6, -6, -5, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6,
+    -6, -6, -7, -6, -6, -6, -6, -6, -6, -6, -6, -6, -9, -6, -6, -7,
+    -6, -6, -6, -6, -6, -6, -6, -7, -5, -7, -6, -6, -7, -6, -6, -6,
+};
+
+static const int32_t operator_11_multiplier[48] = {
+    2002692224, 1698549632, 1311345152, 1649636224, 1154894464, 1581221120, 1241453184, 1161205632, 1273163776, 1507221376, 1239159552, 2087674112, 1553511040, 1138758144, 2116401664, 1826027648,
+    1611430656, 1433068672, 1681584512, 2135434240, 1175436544, 1779338368, 1408455040, 2089510144, 1249600768, 2015357056, 1164415360, 1223927680, 1256279552, 1476675584, 1635081728, 1521042688,
+    1121234048, 1152952832, 1377612800, 1932999040, 1655284992, 1935528192, 1939296128, 1879485824, 1098288384, 2041700864, 1271628160, 1467829120, 1699496064, 1494927232, 1466032384, 1473071360,
+};
+
+static const int32_t operator_11_shift[48] = {
+    -8, -8, -8, -7, -7, -8, -8, -6, -7, -9, -8, -8, -8, -7, -9, -8,
+    -7, -8, -7, -9, -8, -8, -8, -8, -7, -9, -8, -8, -6, -8, -9, -6,
+    -7, -6, -8, -8, -8, -9, -8, -8, -8, -7, -6, -8, -7, -8, -8, -8,
+};
+
+static const int32_t operator_12_multiplier[16] = {
+    1963803232, 1298628264, 1248724671, 1442447745, 1472903042, 2122949287, 1705586159, 1291123864, 1611119839, 1564486703, 1239241652, 1694720642, 1881967179, 1564943394, 1077279265, 1873823124,
+};
+
+static const int32_t operator_12_shift[16] = {
+    -9, -8, -8, -8, -9, -9, -9, -8, -9, -9, -8, -9, -9, -9, -8, -9,
+};
+
+static const int32_t operator_13_multiplier[96] = {
+    1486831631, 1752747054, 1860389080, 1638261061, 1572858571, 1261189156, 2024235915, 1747298562, 1210327521, 2139996743, 1907392856, 1223682422, 1857831429, 1412272789, 1225737575, 1938251740,
+    1399532567, 1324179446, 1403215214, 1112626072, 1452720311, 1596377693, 1335696774, 2099046564, 1912010127, 1298435385, 1301215881, 2089327714, 1312715177, 2073010961, 1244705808, 1258862089,
+    1115190664, 1339902823, 2049976784, 1974975285, 1978110274, 1074568728, 1466473987, 1553361989, 1670839993, 1280633956, 1429291189, 1766862325, 1619817986, 1117535364, 1489127900, 1078869325,
+    1865441190, 1462759426, 1568446033, 1246126654, 1247080347, 2027380798, 1157447276, 1742685758, 1329037754, 1910810451, 1085810073, 1185240346, 1627373811, 1892126738, 1852047034, 2120789788,
+    1477820970, 1628252904, 1616761347, 1940717317, 1079082995, 1769942740, 1344655094, 1082087453, 1304480604, 1977831020, 2077161160, 1741172040, 1726809270, 1390931373, 1284978357, 1093824913,
+    2116232835, 1172116587, 1839018621, 1799046949, 1595359452, 1183632638, 1764348078, 1988854387, 1516082169, 1277549871, 1420117763, 1285144393, 1906913017, 1367655920, 1176721970, 2019844600,
+};
+
+static const int32_t operator_13_shift[96] = {
+    -6, -7, -6, -7, -7, -8, -7, -7, -7, -7, -8, -7, -7, -5, -6, -7,
+    -6, -6, -6, -7, -5, -7, -7, -7, -8, -7, -6, -6, -6, -7, -6, -7,
+    -6, -8, -7, -8, -7, -5, -6, -6, -8, -6, -6, -7, -7, -7, -7, -7,
+    -7, -6, -6, -6, -6, -7, -7, -6, -6, -8, -6, -6, -6, -8, -7, -7,
+    -7, -8, -6, -7, -7, -7, -6, -6, -6, -7, -7, -6, -6, -7, -6, -6,
+    -7, -6, -7, -8, -7, -7, -7, -6, -6, -6, -6, -7, -7, -6, -6, -7,
+};
+
+static const int32_t operator_14_multiplier[96] = {
+    2099405312, 1575326080, 1400053120, 1133769472, 1854577024, 1923613952, 1210964480, 1416353280, 1409454976, 1338045952, 1767631232, 1166255488, 1477846784, 1473169792, 2031242496, 1577124992,
+    1524887808, 1393005056, 1074619008, 1181504768, 1636998272, 1779068800, 1194093184, 1704547712, 1155797504, 1975188608, 1142386176, 1466702720, 1334439296, 1816966784, 1390486400, 1431000192,
+    1710843904, 1642577024, 1349669120, 1313479936, 2092991872, 1444076416, 1369852928, 2141736064, 1466860160, 1787563648, 1928217088, 1896048896, 1626067584, 1714912128, 1226134784, 1322995968,
+    1919252096, 1151842432, 1322478592, 1504842240, 1536127104, 2117337472, 1588265344, 1283540864, 1336628352, 1762075136, 1660138880, 1530267776, 1712428928, 1963662208, 1761922304, 1335833216,
+    1238796160, 1512215680, 1842774784, 1296539520, 1933290880, 1282018944, 1766346624, 1230005888, 1488897408, 2007188224, 1712117888, 1801509248, 1614994048, 1654600704, 1101260160, 1660503680,
+    1832637824, 1324271488, 2136301056, 1985600896, 1984108928, 1936697856, 1571131904, 2038231808, 1136971648, 1440081536, 1569913856, 1429496320, 1871498624, 2126193920, 1757101312, 1692046208,
+};
+
+static const int32_t operator_14_shift[96] = {
+    -7, -6, -7, -7, -6, -5, -6, -6, -6, -7, -6, -6, -7, -8, -7, -7,
+    -6, -6, -6, -5, -7, -7, -6, -7, -2, -7, -6, -7, -6, -7, -7, -5,
+    -8, -5, -7, -6, -6, -7, -6, -8, -5, -7, -7, -8, -6, -6, -6, -6,
+    -8, -5, -7, -6, -7, -8, -6, -6, -7, -6, -5, -6, -6, -6, -7, -7,
+    -7, -5, -8, -7, -6, -5, -7, -6, -5, -7, -6, -7, -7, -7, -7, -7,
+    -7, -6, -8, -7, -8, -7, -7, -7, -6, -6, -7, -6, -6, -7, -8, -6,
+};
+
+static const int32_t operator_15_multiplier[16] = {
+    1406160135, 1510126947, 1928440802, 1211033596, 1810257896, 1087643951, 1187450782, 1754718712, 1836285430, 1627949746, 1377681887, 1378823253, 1601080934, 1881644015, 2131292004, 1514098227,
+};
+
+static const int32_t operator_15_shift[16] = {
+    -9, -9, -10, -9, -9, -8, -9, -9, -9, -9, -9, -9, -9, -9, -10, -9,
+};
+
+static const int32_t operator_17_multiplier[96] = {
+    2122787035, 1385325613, 1622129153, 1252542763, 1540101742, 1353863177, 1437288396, 1831632584, 1081575347, 1426192531, 1337453787, 1840834834, 1404696032, 1392192318, 1266741316, 1343766054,
+    1210184210, 1772023429, 1725224090, 1656981374, 1948250060, 1168265860, 1618743579, 2083736101, 1188181106, 1237938774, 1297186222, 1637517883, 1704573769, 1225621528, 1564792704, 1303937397,
+    1389652165, 1800629678, 1154180245, 1611410326, 1510254677, 1141235249, 1636943256, 1075063871, 1794219371, 2043602206, 1140782738, 1300592096, 1675113353, 1218383291, 1790590751, 1681377033,
+    1697647032, 1255158604, 1236806686, 1155280266, 1239643331, 2010858573, 1636753225, 1308874639, 1094877732, 1118874109, 1606690324, 1465056133, 1455363366, 1784316814, 1437336120, 1623669700,
+    1924676501, 2086880466, 2076229877, 2109980459, 2034191786, 1279298369, 1858147088, 2019508438, 2072875831, 2058470187, 1154949871, 1174758333, 1923101620, 1133564908, 1890789227, 1220001901,
+    1077237242, 1322127464, 1334058170, 1333673142, 1120424157, 1136138963, 1456640460, 1351956605, 1658371840, 1195310507, 1171090411, 1150232460, 1536936970, 1121875087, 1714524266, 2124038432,
+};
+
+static const int32_t operator_17_shift[96] = {
+    -7, -7, -7, -6, -6, -7, -7, -7, -6, -7, -6, -7, -6, -6, -6, -6,
+    -6, -7, -7, -7, -7, -7, -8, -7, -6, -6, -7, -7, -7, -6, -7, -6,
+    -7, -7, -6, -7, -6, -6, -7, -6, -7, -7, -6, -6, -6, -6, -7, -7,
+    -7, -6, -7, -6, -6, -7, -6, -6, -6, -6, -7, -6, -6, -7, -6, -7,
+    -7, -7, -7, -7, -7, -6, -7, -7, -7, -7, -6, -6, -7, -6, -7, -6,
+    -6, -6, -7, -7, -6, -6, -6, -6, -8, -6, -6, -6, -7, -6, -7, -7,
+};
+
+static const int32_t operator_18_multiplier[96] = {
+    1347021696, 1074007424, 1972870016, 1615803264, 1624723200, 1325610240, 1858338560, 1912619776, 1142213248, 1111451648, 1371876096, 1660928128, 1914054144, 1786353024, 1909913984, 1207316608,
+    1091859712, 1213552256, 1155681920, 1697260032, 1639266688, 1253582592, 1387139968, 2018588544, 1130426624, 1391200768, 1675915136, 1720413568, 1185527552, 1397529344, 1962867712, 1590395264,
+    1997999744, 1695360640, 1093194752, 1803721216, 1621318528, 1944350976, 1937693568, 1190313728, 1550563968, 1421856256, 2054221568, 1777616896, 1184230272, 1177094016, 1398143232, 1090388224,
+    1442238080, 1456360192, 1452350592, 1338824064, 1143547008, 1308753408, 1401165952, 1873774464, 2126458368, 1085089152, 1747783424, 1743565696, 1629564672, 1528082176, 1930901504, 1081765376,
+    1931652864, 1384900224, 2071014016, 2003117696, 1213507072, 1628415616, 1074292096, 1082675584, 1657982208, 1214366336, 1988257536, 1085918208, 1552887808, 1949621120, 1477312128, 1288575488,
+    1497932032, 1081064576, 1233080192, 1130877056, 1097933952, 1828622720, 1755404160, 1727741952, 1840285312, 1279808768, 1293993984, 1841065472, 1112886400, 1445723648, 1359593216, 1178319744,
+};
+
+static const int32_t operator_18_shift[96] = {
+    -6, -6, -7, -7, -6, -6, -6, -7, -6, -6, -7, -7, -7, -8, -8, -7,
+    -7, -6, -6, -8, -7, -6, -6, -7, -5, -7, -6, -7, -7, -7, -6, -7,
+    -7, -6, -6, -6, -7, -7, -6, -7, -7, -6, -7, -8, -7, -7, -6, -7,
+    -6, -7, -7, -7, -7, -7, -7, -7, -7, -6, -8, -7, -7, -7, -8, -7,
+    -7, -6, -6, -7, -6, -7, -6, -7, -8, -6, -6, -7, -7, -7, -7, -6,
+    -6, -7, -6, -6, -7, -7, -7, -7, -6, -7, -7, -7, -6, -6, -6, -6,
+};
+
+static const int32_t operator_19_multiplier[16] = {
+    1095021958, 1216406192, 1770404229, 1129437491, 1681884287, 1809290988, 1484626300, 1650634605, 1838826256, 1732421833, 1862805232, 1389465527, 1918090393, 2110843992, 1964941945, 1584512614,
+};
+
+static const int32_t operator_19_shift[16] = {
+    -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9, -9,
+};
+
+static const int32_t operator_21_multiplier[96] = {
+    1898269277, 1762232878, 1940196997, 1213386386, 1753367757, 1222100846, 1933018801, 1261318680, 1249944219, 1172186713, 2035217683, 1474184116, 1803681600, 1360960347, 1379575454, 1375611652,
+    1671183786, 1435124859, 1319992508, 1745331586, 1205492959, 1866111899, 1145929490, 1298604938, 1173030993, 1185035491, 1407319182, 1184289348, 1211219457, 1321261880, 1527121268, 1699352732,
+    1175529275, 2069797949, 1469583365, 1790496317, 1215461084, 1389580647, 1860491077, 1953849341, 1946711606, 1603094842, 1237131882, 2128659130, 1345889226, 1842685945, 1221343772, 1315608891,
+    1907262943, 1258013815, 1403326856, 2043814906, 1754997635, 1200314194, 1735526687, 1196847610, 1644570454, 1084134379, 1227919072, 2031977027, 1658446465, 1284630664, 1669914791, 1797362259,
+    1805836340, 1205345440, 1621606410, 1878292692, 2030489895, 1233331055, 1610227425, 1504352995, 1584882460, 1547321520, 1630960833, 2083800118, 1606988529, 1489638485, 1444216159, 1829149707,
+    1111593874, 1709033860, 1316336310, 1339679206, 2099524144, 1928547853, 2016327641, 1227666128, 1442720356, 1368600829, 2071438131, 1428965855, 1138044607, 1833595147, 1502478215, 1863361677,
+};
+
+static const int32_t operator_21_shift[96] = {
+    -7, -6, -7, -6, -7, -6, -7, -6, -6, -6, -7, -6, -7, -7, -6, -6,
+    -6, -6, -6, -7, -6, -7, -6, -6, -6, -6, -6, -6, -7, -6, -7, -6,
+    -6, -7, -7, -7, -6, -6, -7, -7, -7, -7, -6, -7, -6, -7, -6, -6,
+    -7, -6, -6, -7, -7, -6, -7, -6, -7, -6, -6, -7, -6, -6, -6, -7,
+    -7, -6, -7, -7, -7, -6, -7, -7, -7, -6, -7, -8, -6, -6, -6, -7,
+    -7, -7, -6, -6, -7, -7, -7, -6, -6, -6, -7, -6, -6, -7, -6, -7,
+};
+
+static const int32_t operator_22_multiplier[32] = {
+    1158688741, 1074407989, 1422154342, 1187021600, 1973950678, 1573159283, 1582613083, 1877336688, 1073808668, 1680191605, 1802118215, 1540996165, 1192015496, 1218416950, 2104476253, 1995852430,
+    1992444014, 1451230109, 1678796088, 1800120144, 2145661293, 1145032559, 1207553921, 2040734622, 1166825840, 1330568584, 1279525849, 1787152691, 1661109985, 2058818823, 1297233022, 1113205556,
+};
+
+static const int32_t operator_22_shift[32] = {
+    -9, -9, -9, -9, -10, -9, -9, -10, -9, -9, -10, -8, -9, -9, -10, -10,
+    -10, -9, -9, -10, -10, -9, -9, -10, -9, -9, -9, -10, -10, -10, -9, -9,
+};
+
+static const int32_t operator_23_multiplier[3] = {
+    1106165877, 1302740550, 1306038131,
+};
+
+static const int32_t operator_23_shift[3] = {
+    -8, -9, -9,
+};
+
+static const tensor_info_t tensor_info[TENSORS_SIZE] = {
+    { 9216, 0.003921568859368563f, -128, { 4, { 1, 96, 96, 1 } } }, // 0 serving_default_x:0
+    { 0, 0.0f, 0, { 0, { } } }, // 1 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 2 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 3 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 4 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 5 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 6 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 7 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 8 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 9 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 10 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 11 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 12 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 13 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 14 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 15 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 16 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 17 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 18 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 19 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 20 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 21 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 22 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 23 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 24 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 25 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 26 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 27 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 28 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 29 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 30 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 31 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 32 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 33 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 34 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 35 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 36 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 37 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 38 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 39 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 40 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 41 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 42 constant
+    { 0, 0.0f, 0, { 0, { } } }, // 43 constant
+    { 36864, 0.0235294122248888f, -128, { 4, { 1, 48, 48, 16 } } }, // 44 model_1/Conv1_relu/Relu6;model_1/bn_Conv1/FusedBatchNormV3;model_1/block_5_project/Conv2D;model_1/Conv1/Conv2D
+    { 36864, 0.0235294122248888f, -128, { 4, { 1, 48, 48, 16 } } }, // 45 model_1/expanded_conv_depthwise_relu/Relu6;model_1/expanded_conv_depthwise_BN/FusedBatchNormV3;model_1/block_5_project/Conv2D;model_1/expanded_conv_depthwise/depthwise
+    { 18432, 0.11640322953462601f, 3, { 4, { 1, 48, 48, 8 } } }, // 46 model_1/expanded_conv_project_BN/FusedBatchNormV3;model_1/block_2_project/Conv2D;model_1/expanded_conv_project/Conv2D
+    { 110592, 0.0235294122248888f, -128, { 4, { 1, 48, 48, 48 } } }, // 47 model_1/block_1_expand_relu/Relu6;model_1/block_1_expand_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_1_expand/Conv2D
+    { 0, 0.0f, 0, { 0, { } } }, // 48 constant
+    { 27648, 0.0235294122248888f, -128, { 4, { 1, 24, 24, 48 } } }, // 49 model_1/block_1_depthwise_relu/Relu6;model_1/block_1_depthwise_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_1_depthwise/depthwise
+    { 4608, 0.08417456597089767f, -1, { 4, { 1, 24, 24, 8 } } }, // 50 model_1/block_1_project_BN/FusedBatchNormV3;model_1/block_2_project/Conv2D;model_1/block_1_project/Conv2D
+    { 27648, 0.0235294122248888f, -128, { 4, { 1, 24, 24, 48 } } }, // 51 model_1/block_2_expand_relu/Relu6;model_1/block_2_expand_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_2_expand/Conv2D
+    { 27648, 0.0235294122248888f, -128, { 4, { 1, 24, 24, 48 } } }, // 52 model_1/block_2_depthwise_relu/Relu6;model_1/block_2_depthwise_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_2_depthwise/depthwise
+    { 4608, 0.07988213747739792f, -6, { 4, { 1, 24, 24, 8 } } }, // 53 model_1/block_2_project_BN/FusedBatchNormV3;model_1/block_2_project/Conv2D
+    { 4608, 0.09737283736467361f, -11, { 4, { 1, 24, 24, 8 } } }, // 54 model_1/block_2_add/add
+    { 27648, 0.0235294122248888f, -128, { 4, { 1, 24, 24, 48 } } }, // 55 model_1/block_3_expand_relu/Relu6;model_1/block_3_expand_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_3_expand/Conv2D
+    { 0, 0.0f, 0, { 0, { } } }, // 56 constant
+    { 6912, 0.0235294122248888f, -128, { 4, { 1, 12, 12, 48 } } }, // 57 model_1/block_3_depthwise_relu/Relu6;model_1/block_3_depthwise_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise
+    { 2304, 0.058666884899139404f, -13, { 4, { 1, 12, 12, 16 } } }, // 58 model_1/block_3_project_BN/FusedBatchNormV3;model_1/block_5_project/Conv2D;model_1/block_3_project/Conv2D
+    { 13824, 0.0235294122248888f, -128, { 4, { 1, 12, 12, 96 } } }, // 59 model_1/block_4_expand_relu/Relu6;model_1/block_4_expand_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D;model_1/block_4_expand/Conv2D
+    { 13824, 0.0235294122248888f, -128, { 4, { 1, 12, 12, 96 } } }, // 60 model_1/block_4_depthwise_relu/Relu6;model_1/block_4_depthwise_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D;model_1/block_4_depthwise/depthwise
+    { 2304, 0.07035399228334427f, -32, { 4, { 1, 12, 12, 16 } } }, // 61 model_1/block_4_project_BN/FusedBatchNormV3;model_1/block_5_project/Conv2D;model_1/block_4_project/Conv2D
+    { 2304, 0.07939128577709198f, -14, { 4, { 1, 12, 12, 16 } } }, // 62 model_1/block_4_add/add
+    { 13824, 0.0235294122248888f, -128, { 4, { 1, 12, 12, 96 } } }, // 63 model_1/block_5_expand_relu/Relu6;model_1/block_5_expand_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D;model_1/block_5_expand/Conv2D
+    { 13824, 0.0235294122248888f, -128, { 4, { 1, 12, 12, 96 } } }, // 64 model_1/block_5_depthwise_relu/Relu6;model_1/block_5_depthwise_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D;model_1/block_5_depthwise/depthwise
+    { 2304, 0.05703405663371086f, 1, { 4, { 1, 12, 12, 16 } } }, // 65 model_1/block_5_project_BN/FusedBatchNormV3;model_1/block_5_project/Conv2D
+    { 2304, 0.09239374846220016f, -12, { 4, { 1, 12, 12, 16 } } }, // 66 model_1/block_5_add/add
+    { 13824, 0.0235294122248888f, -128, { 4, { 1, 12, 12, 96 } } }, // 67 model_1/block_6_expand_relu/Relu6;model_1/block_6_expand_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D
+    { 4608, 0.054031964391469955f, -128, { 4, { 1, 12, 12, 32 } } }, // 68 model_1/head/Relu;model_1/head/BiasAdd;model_1/head/Conv2D;model_1/head/BiasAdd/ReadVariableOp
+    { 432, 0.15668675303459167f, -13, { 4, { 1, 12, 12, 3 } } }, // 69 model_1/logits/BiasAdd;model_1/logits/Conv2D;model_1/logits/BiasAdd/ReadVariableOp
+    { 432, 0.00390625f, -128, { 4, { 1, 12, 12, 3 } } }, // 70 StatefulPartitionedCall:0
+};
+
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE >= 62464
+#define MAIN_ARENA_SIZE                             110592
+#define FAST_ARENA_USED                             62464
+static const tensor_placement_t placements[] = {
+    { 0, 1, 16384 },
+    { 44, 1, 25600 },
+    { 45, 0, 0 },
+    { 46, 1, 16384 },
+    { 47, 0, 0 },
+    { 49, 1, 20992 },
+    { 50, 1, 16384 },
+    { 51, 1, 20992 },
+    { 52, 0, 0 },
+    { 53, 1, 25600 },
+    { 54, 1, 20992 },
+    { 55, 1, 27904 },
+    { 57, 1, 20992 },
+    { 58, 1, 18688 },
+    { 59, 1, 20992 },
+    { 60, 1, 34816 },
+    { 61, 1, 20992 },
+    { 62, 1, 16384 },
+    { 63, 1, 18688 },
+    { 64, 1, 32512 },
+    { 65, 1, 20992 },
+    { 66, 1, 18688 },
+    { 67, 1, 21424 },
+    { 68, 1, 16816 },
+    { 69, 1, 16384 },
+    { 70, 1, 16816 },
+};
+// bytes of the activations of every operator in the fast arena
+static const uint32_t operator_fast_bytes[22] = {
+    46080, 36864, 18432, 18432, 27648, 32256, 32256, 27648, 9216, 32256, 34560, 9216, 16128, 27648, 18432, 16128,
+    27648, 18432, 16128, 18432, 5040, 864,
+};
+#else
+#define MAIN_ARENA_SIZE                             138240
+#define FAST_ARENA_USED                             0
+static const tensor_placement_t placements[] = {
+    { 0, 0, 36864 },
+    { 44, 0, 0 },
+    { 45, 0, 36864 },
+    { 46, 0, 110592 },
+    { 47, 0, 0 },
+    { 49, 0, 110592 },
+    { 50, 0, 55296 },
+    { 51, 0, 0 },
+    { 52, 0, 27648 },
+    { 53, 0, 0 },
+    { 54, 0, 59904 },
+    { 55, 0, 0 },
+    { 57, 0, 27648 },
+    { 58, 0, 34560 },
+    { 59, 0, 0 },
+    { 60, 0, 13824 },
+    { 61, 0, 0 },
+    { 62, 0, 27648 },
+    { 63, 0, 0 },
+    { 64, 0, 13824 },
+    { 65, 0, 0 },
+    { 66, 0, 29952 },
+    { 67, 0, 0 },
+    { 68, 0, 13824 },
+    { 69, 0, 0 },
+    { 70, 0, 432 },
+};
+#endif
+
+// 0: CONV_2D model_1/Conv1_relu/Relu6;model_1/bn_Conv1/FusedBatchNormV3;model_1/block_5_project/Conv2D;model_1/Conv1/Conv2D
+static const conv_2d_t operator_0 = {
+    0, // input
+    44, // output
+    tensor_data43, // filter
+    tensor_data42, // bias
+    { 96, 96, 1, 1 }, // input_dims
+    { 3, 3, 0, 0 }, // filter_dims
+    { 48, 48, 16, 1 }, // output_dims
+    { 128, -128, { 2, 2 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_0_shift, // shift
+    operator_0_multiplier, // mult
+};
+
+// 1: DEPTHWISE_CONV_2D model_1/expanded_conv_depthwise_relu/Relu6;model_1/expanded_conv_depthwise_BN/FusedBatchNormV3;model_1/block_5_project/Conv2D;model_1/expanded_conv_depthwise/depthwise
+static const depthwise_conv_2d_t operator_1 = {
+    44, // input
+    45, // output
+    tensor_data41, // filter
+    tensor_data40, // bias
+    { 48, 48, 16, 1 }, // input_dims
+    { 3, 3, 0, 0 }, // filter_dims
+    { 48, 48, 16, 1 }, // output_dims
+    { 128, -128, 1, { 1, 1 }, { 1, 1 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_1_shift, // shift
+    operator_1_multiplier, // mult
+};
+
+// 2: CONV_2D model_1/expanded_conv_project_BN/FusedBatchNormV3;model_1/block_2_project/Conv2D;model_1/expanded_conv_project/Conv2D
+static const conv_2d_t operator_2 = {
+    45, // input
+    46, // output
+    tensor_data39, // filter
+    tensor_data38, // bias
+    { 48, 48, 16, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 48, 48, 8, 1 }, // output_dims
+    { 128, 3, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_2_shift, // shift
+    operator_2_multiplier, // mult
+};
+
+// 3: CONV_2D model_1/block_1_expand_relu/Relu6;model_1/block_1_expand_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_1_expand/Conv2D
+static const conv_2d_t operator_3 = {
+    46, // input
+    47, // output
+    tensor_data37, // filter
+    tensor_data36, // bias
+    { 48, 48, 8, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 48, 48, 48, 1 }, // output_dims
+    { -3, -128, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_3_shift, // shift
+    operator_3_multiplier, // mult
+};
+
+// 4: DEPTHWISE_CONV_2D model_1/block_1_depthwise_relu/Relu6;model_1/block_1_depthwise_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_1_depthwise/depthwise
+static const depthwise_conv_2d_t operator_4 = {
+    47, // input
+    49, // output
+    tensor_data35, // filter
+    tensor_data34, // bias
+    { 48, 48, 48, 1 }, // input_dims
+    { 3, 3, 0, 0 }, // filter_dims
+    { 24, 24, 48, 1 }, // output_dims
+    { 128, -128, 1, { 2, 2 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_4_shift, // shift
+    operator_4_multiplier, // mult
+};
+
+// 5: CONV_2D model_1/block_1_project_BN/FusedBatchNormV3;model_1/block_2_project/Conv2D;model_1/block_1_project/Conv2D
+static const conv_2d_t operator_5 = {
+    49, // input
+    50, // output
+    tensor_data33, // filter
+    tensor_data32, // bias
+    { 24, 24, 48, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 24, 24, 8, 1 }, // output_dims
+    { 128, -1, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_5_shift, // shift
+    operator_5_multiplier, // mult
+};
+
+// 6: CONV_2D model_1/block_2_expand_relu/Relu6;model_1/block_2_expand_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_2_expand/Conv2D
+static const conv_2d_t operator_6 = {
+    50, // input
+    51, // output
+    tensor_data31, // filter
+    tensor_data30, // bias
+    { 24, 24, 8, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 24, 24, 48, 1 }, // output_dims
+    { 1, -128, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_6_shift, // shift
+    operator_6_multiplier, // mult
+};
+
+// 7: DEPTHWISE_CONV_2D model_1/block_2_depthwise_relu/Relu6;model_1/block_2_depthwise_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_2_depthwise/depthwise
+static const depthwise_conv_2d_t operator_7 = {
+    51, // input
+    52, // output
+    tensor_data29, // filter
+    tensor_data28, // bias
+    { 24, 24, 48, 1 }, // input_dims
+    { 3, 3, 0, 0 }, // filter_dims
+    { 24, 24, 48, 1 }, // output_dims
+    { 128, -128, 1, { 1, 1 }, { 1, 1 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_7_shift, // shift
+    operator_7_multiplier, // mult
+};
+
+// 8: CONV_2D+ADD model_1/block_2_add/add
+static const conv_2d_add_t operator_8 = {
+    { // conv
+        52, // input
+        53, // output
+        tensor_data27, // filter
+        tensor_data26, // bias
+        { 24, 24, 48, 1 }, // input_dims
+        { 1, 1, 0, 0 }, // filter_dims
+        { 24, 24, 8, 1 }, // output_dims
+        { 128, -6, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+        operator_8_shift, // shift
+        operator_8_multiplier, // mult
+    },
+    50, // add_input
+    54, // output
+    { 6, 1, 2037974084, 1073741824, -1, 0, 20, -11, 1856405841, -19, { -128, 127 } }, // add_params
+};
+
+// 10: CONV_2D model_1/block_3_expand_relu/Relu6;model_1/block_3_expand_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise;model_1/block_3_expand/Conv2D
+static const conv_2d_t operator_10 = {
+    54, // input
+    55, // output
+    tensor_data25, // filter
+    tensor_data24, // bias
+    { 24, 24, 8, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 24, 24, 48, 1 }, // output_dims
+    { 11, -128, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_10_shift, // shift
+    operator_10_multiplier, // mult
+};
+
+// 11: DEPTHWISE_CONV_2D model_1/block_3_depthwise_relu/Relu6;model_1/block_3_depthwise_BN/FusedBatchNormV3;model_1/block_3_depthwise/depthwise
+static const depthwise_conv_2d_t operator_11 = {
+    55, // input
+    57, // output
+    tensor_data23, // filter
+    tensor_data22, // bias
+    { 24, 24, 48, 1 }, // input_dims
+    { 3, 3, 0, 0 }, // filter_dims
+    { 12, 12, 48, 1 }, // output_dims
+    { 128, -128, 1, { 2, 2 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_11_shift, // shift
+    operator_11_multiplier, // mult
+};
+
+// 12: CONV_2D model_1/block_3_project_BN/FusedBatchNormV3;model_1/block_5_project/Conv2D;model_1/block_3_project/Conv2D
+static const conv_2d_t operator_12 = {
+    57, // input
+    58, // output
+    tensor_data21, // filter
+    tensor_data20, // bias
+    { 12, 12, 48, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 12, 12, 16, 1 }, // output_dims
+    { 128, -13, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_12_shift, // shift
+    operator_12_multiplier, // mult
+};
+
+// 13: CONV_2D model_1/block_4_expand_relu/Relu6;model_1/block_4_expand_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D;model_1/block_4_expand/Conv2D
+static const conv_2d_t operator_13 = {
+    58, // input
+    59, // output
+    tensor_data19, // filter
+    tensor_data18, // bias
+    { 12, 12, 16, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 12, 12, 96, 1 }, // output_dims
+    { 13, -128, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_13_shift, // shift
+    operator_13_multiplier, // mult
+};
+
+// 14: DEPTHWISE_CONV_2D model_1/block_4_depthwise_relu/Relu6;model_1/block_4_depthwise_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D;model_1/block_4_depthwise/depthwise
+static const depthwise_conv_2d_t operator_14 = {
+    59, // input
+    60, // output
+    tensor_data17, // filter
+    tensor_data16, // bias
+    { 12, 12, 96, 1 }, // input_dims
+    { 3, 3, 0, 0 }, // filter_dims
+    { 12, 12, 96, 1 }, // output_dims
+    { 128, -128, 1, { 1, 1 }, { 1, 1 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_14_shift, // shift
+    operator_14_multiplier, // mult
+};
+
+// 15: CONV_2D+ADD model_1/block_4_add/add
+static const conv_2d_add_t operator_15 = {
+    { // conv
+        60, // input
+        61, // output
+        tensor_data15, // filter
+        tensor_data14, // bias
+        { 12, 12, 96, 1 }, // input_dims
+        { 1, 1, 0, 0 }, // filter_dims
+        { 12, 12, 16, 1 }, // output_dims
+        { 128, -32, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+        operator_15_shift, // shift
+        operator_15_multiplier, // mult
+    },
+    58, // add_input
+    62, // output
+    { 32, 13, 1073741824, 1790746650, 0, -1, 20, -14, 1903030623, -19, { -128, 127 } }, // add_params
+};
+
+// 17: CONV_2D model_1/block_5_expand_relu/Relu6;model_1/block_5_expand_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D;model_1/block_5_expand/Conv2D
+static const conv_2d_t operator_17 = {
+    62, // input
+    63, // output
+    tensor_data13, // filter
+    tensor_data12, // bias
+    { 12, 12, 16, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 12, 12, 96, 1 }, // output_dims
+    { 14, -128, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_17_shift, // shift
+    operator_17_multiplier, // mult
+};
+
+// 18: DEPTHWISE_CONV_2D model_1/block_5_depthwise_relu/Relu6;model_1/block_5_depthwise_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D;model_1/block_5_depthwise/depthwise
+static const depthwise_conv_2d_t operator_18 = {
+    63, // input
+    64, // output
+    tensor_data11, // filter
+    tensor_data10, // bias
+    { 12, 12, 96, 1 }, // input_dims
+    { 3, 3, 0, 0 }, // filter_dims
+    { 12, 12, 96, 1 }, // output_dims
+    { 128, -128, 1, { 1, 1 }, { 1, 1 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_18_shift, // shift
+    operator_18_multiplier, // mult
+};
+
+// 19: CONV_2D+ADD model_1/block_5_add/add
+static const conv_2d_add_t operator_19 = {
+    { // conv
+        64, // input
+        65, // output
+        tensor_data9, // filter
+        tensor_data8, // bias
+        { 12, 12, 96, 1 }, // input_dims
+        { 1, 1, 0, 0 }, // filter_dims
+        { 12, 12, 16, 1 }, // output_dims
+        { 128, 1, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+        operator_19_shift, // shift
+        operator_19_multiplier, // mult
+    },
+    62, // add_input
+    66, // output
+    { -1, 14, 1542734858, 1073741824, -1, 0, 20, -12, 1845270820, -19, { -128, 127 } }, // add_params
+};
+
+// 21: CONV_2D model_1/block_6_expand_relu/Relu6;model_1/block_6_expand_BN/FusedBatchNormV3;model_1/block_6_expand/Conv2D
+static const conv_2d_t operator_21 = {
+    66, // input
+    67, // output
+    tensor_data7, // filter
+    tensor_data6, // bias
+    { 12, 12, 16, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 12, 12, 96, 1 }, // output_dims
+    { 12, -128, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_21_shift, // shift
+    operator_21_multiplier, // mult
+};
+
+// 22: CONV_2D model_1/head/Relu;model_1/head/BiasAdd;model_1/head/Conv2D;model_1/head/BiasAdd/ReadVariableOp
+static const conv_2d_t operator_22 = {
+    67, // input
+    68, // output
+    tensor_data5, // filter
+    tensor_data4, // bias
+    { 12, 12, 96, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 12, 12, 32, 1 }, // output_dims
+    { 128, -128, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_22_shift, // shift
+    operator_22_multiplier, // mult
+};
+
+// 23: CONV_2D model_1/logits/BiasAdd;model_1/logits/Conv2D;model_1/logits/BiasAdd/ReadVariableOp
+static const conv_2d_t operator_23 = {
+    68, // input
+    69, // output
+    tensor_data3, // filter
+    tensor_data2, // bias
+    { 12, 12, 32, 1 }, // input_dims
+    { 1, 1, 0, 0 }, // filter_dims
+    { 12, 12, 3, 1 }, // output_dims
+    { 128, -13, { 1, 1 }, { 0, 0 }, { 0, 0 }, { -128, 127 } }, // params
+    operator_23_shift, // shift
+    operator_23_multiplier, // mult
+};
+
+// 24: SOFTMAX StatefulPartitionedCall:0
+static const softmax_t operator_24 = {
+    69, // input
+    70, // output
+    144, // outer_size
+    3, // depth
+    1345928960, // input_multiplier
+    24, // input_left_shift
+    -124, // diff_min
+    12, // scratch_width
+    12, // scratch_height
+};
+
+static const char *const operator_names[OPERATORS_SIZE] = {
+    "CONV_2D",
+    "DEPTHWISE_CONV_2D",
+    "CONV_2D",
+    "CONV_2D",
+    "DEPTHWISE_CONV_2D",
+    "CONV_2D",
+    "CONV_2D",
+    "DEPTHWISE_CONV_2D",
+    "CONV_2D+ADD",
+    "CONV_2D",
+    "DEPTHWISE_CONV_2D",
+    "CONV_2D",
+    "CONV_2D",
+    "DEPTHWISE_CONV_2D",
+    "CONV_2D+ADD",
+    "CONV_2D",
+    "DEPTHWISE_CONV_2D",
+    "CONV_2D+ADD",
+    "CONV_2D",
+    "CONV_2D",
+    "CONV_2D",
+    "SOFTMAX",
+};
+
+static const uint16_t operator_indexes[22] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 10, 11, 12, 13, 14, 15, 17,
+    18, 19, 21, 22, 23, 24,
+};
+
+static const uint8_t operator_outputs[22] = {
+    44, 45, 46, 47, 49, 50, 51, 52, 54, 55, 57, 58, 59, 60, 62, 63,
+    64, 66, 67, 68, 69, 70,
+};
+
+namespace {
+
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+// internal SRAM, the main arena comes from the allocator given to init (PSRAM on the ESP32-S3)
+alignas(16) uint8_t fast_arena[EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE];
+#endif
+uint8_t *main_arena = nullptr;
+void *scratch_buffer = nullptr;
+int8_t *activations[TENSORS_SIZE];
+
+#if !ESP_NN
+tflite::RuntimeShape shape(int32_t d0, int32_t d1, int32_t d2, int32_t d3)
+{
+    const int32_t dims[4] = { d0, d1, d2, d3 };
+    return tflite::RuntimeShape(4, dims);
+}
+#endif
+
+void conv_2d(const conv_2d_t *op)
+{
+#if ESP_NN
+    const quant_data_t quant_data = { (int32_t*)op->shift, (int32_t*)op->mult };
+    esp_nn_set_conv_scratch_buf(scratch_buffer);
+    esp_nn_conv_s8(&op->input_dims, activations[op->input], &op->filter_dims, op->filter, op->bias,
+                   &op->output_dims, activations[op->output], &op->params, &quant_data);
+#else
+    tflite::ConvParams params = { };
+    params.input_offset = op->params.in_offset;
+    params.output_offset = op->params.out_offset;
+    params.stride_width = op->params.stride.width;
+    params.stride_height = op->params.stride.height;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+    params.padding_values.width = op->params.padding.width;
+    params.padding_values.height = op->params.padding.height;
+    params.quantized_activation_min = op->params.activation.min;
+    params.quantized_activation_max = op->params.activation.max;
+    tflite::reference_integer_ops::ConvPerChannel(
+        params, op->mult, op->shift,
+        shape(1, op->input_dims.height, op->input_dims.width, op->input_dims.channels), activations[op->input],
+        shape(op->output_dims.channels, op->filter_dims.height, op->filter_dims.width, op->input_dims.channels),
+        op->filter, tflite::RuntimeShape(1, &op->output_dims.channels), op->bias,
+        shape(1, op->output_dims.height, op->output_dims.width, op->output_dims.channels), activations[op->output]);
+#endif
+}
+
+// the convolution output is not written, the Add is done on it in the requantization
+void conv_2d_add(const conv_2d_add_t *op)
+{
+#if ESP_NN
+    const conv_2d_t *conv = &op->conv;
+    const quant_data_t quant_data = { (int32_t*)conv->shift, (int32_t*)conv->mult };
+    esp_nn_set_conv_add_scratch_buf(scratch_buffer);
+    esp_nn_conv_add_s8(&conv->input_dims, activations[conv->input], &conv->filter_dims, conv->filter, conv->bias,
+                       &conv->output_dims, activations[op->output], &conv->params, &quant_data,
+                       activations[op->add_input], &op->add_params);
+#else
+    conv_2d(&op->conv);
+    tflite::ArithmeticParams params = { };
+    params.left_shift = op->add_params.left_shift;
+    params.input1_offset = op->add_params.input1_offset;
+    params.input1_multiplier = op->add_params.input1_mult;
+    params.input1_shift = op->add_params.input1_shift;
+    params.input2_offset = op->add_params.input2_offset;
+    params.input2_multiplier = op->add_params.input2_mult;
+    params.input2_shift = op->add_params.input2_shift;
+    params.output_offset = op->add_params.out_offset;
+    params.output_multiplier = op->add_params.out_mult;
+    params.output_shift = op->add_params.out_shift;
+    params.quantized_activation_min = op->add_params.activation.min;
+    params.quantized_activation_max = op->add_params.activation.max;
+    const data_dims_t *dims = &op->conv.output_dims;
+    const int32_t size = dims->width * dims->height * dims->channels;
+    const tflite::RuntimeShape flat(1, &size);
+    tflite::reference_integer_ops::Add(params, flat, activations[op->conv.output], flat,
+                                       activations[op->add_input], flat, activations[op->output]);
+#endif
+}
+
+void depthwise_conv_2d(const depthwise_conv_2d_t *op)
+{
+#if ESP_NN
+    const quant_data_t quant_data = { (int32_t*)op->shift, (int32_t*)op->mult };
+    esp_nn_set_depthwise_conv_scratch_buf(scratch_buffer);
+    esp_nn_depthwise_conv_s8(&op->input_dims, activations[op->input], &op->filter_dims, op->filter, op->bias,
+                             &op->output_dims, activations[op->output], &op->params, &quant_data);
+#else
+    tflite::DepthwiseParams params = { };
+    params.input_offset = op->params.in_offset;
+    params.output_offset = op->params.out_offset;
+    params.depth_multiplier = op->params.ch_mult;
+    params.stride_width = op->params.stride.width;
+    params.stride_height = op->params.stride.height;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+    params.padding_values.width = op->params.padding.width;
+    params.padding_values.height = op->params.padding.height;
+    params.quantized_activation_min = op->params.activation.min;
+    params.quantized_activation_max = op->params.activation.max;
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        params, op->mult, op->shift,
+        shape(1, op->input_dims.height, op->input_dims.width, op->input_dims.channels), activations[op->input],
+        shape(1, op->filter_dims.height, op->filter_dims.width, op->output_dims.channels),
+        op->filter, tflite::RuntimeShape(1, &op->output_dims.channels), op->bias,
+        shape(1, op->output_dims.height, op->output_dims.width, op->output_dims.channels), activations[op->output]);
+#endif
+}
+
+void softmax(const softmax_t *op)
+{
+#if ESP_NN
+    esp_nn_set_softmax_scratch_buf(scratch_buffer);
+    esp_nn_softmax_s8(activations[op->input], op->outer_size, op->depth, op->input_multiplier,
+                      op->input_left_shift, op->diff_min, activations[op->output]);
+#else
+    tflite::SoftmaxParams params = { };
+    params.input_multiplier = op->input_multiplier;
+    params.input_left_shift = op->input_left_shift;
+    params.diff_min = op->diff_min;
+    const int32_t dims[2] = { op->outer_size, op->depth };
+    const tflite::RuntimeShape shape(2, dims);
+    tflite::reference_ops::Softmax(params, shape, activations[op->input], shape, activations[op->output]);
+#endif
+}
+
+TfLiteStatus fill_tensor(int index, TfLiteTensor *tensor)
+{
+    if (index < 0 || index >= TENSORS_SIZE || activations[index] == nullptr) {
+        return kTfLiteError;
+    }
+    const tensor_info_t *info = &tensor_info[index];
+    memset(tensor, 0, sizeof(TfLiteTensor));
+    tensor->type = kTfLiteInt8;
+    tensor->data.int8 = activations[index];
+    tensor->dims = (TfLiteIntArray*)&info->dims;
+    tensor->params.scale = info->scale;
+    tensor->params.zero_point = info->zero_point;
+    tensor->bytes = info->bytes;
+    tensor->allocation_type = kTfLiteArenaRw;
+    return kTfLiteOk;
+}
+
+} // namespace
+
+TfLiteStatus tflite_learn_27_init(void*(*alloc_fnc)(size_t, size_t))
+{
+    size_t scratch_size = 0;
+#if ESP_NN
+    int size;
+    size = esp_nn_get_conv_scratch_size(&operator_0.input_dims, &operator_0.filter_dims, &operator_0.output_dims, &operator_0.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_depthwise_conv_scratch_size(&operator_1.input_dims, &operator_1.filter_dims, &operator_1.output_dims, &operator_1.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_2.input_dims, &operator_2.filter_dims, &operator_2.output_dims, &operator_2.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_3.input_dims, &operator_3.filter_dims, &operator_3.output_dims, &operator_3.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_depthwise_conv_scratch_size(&operator_4.input_dims, &operator_4.filter_dims, &operator_4.output_dims, &operator_4.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_5.input_dims, &operator_5.filter_dims, &operator_5.output_dims, &operator_5.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_6.input_dims, &operator_6.filter_dims, &operator_6.output_dims, &operator_6.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_depthwise_conv_scratch_size(&operator_7.input_dims, &operator_7.filter_dims, &operator_7.output_dims, &operator_7.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_add_scratch_size(&operator_8.conv.input_dims, &operator_8.conv.filter_dims, &operator_8.conv.output_dims, &operator_8.conv.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_10.input_dims, &operator_10.filter_dims, &operator_10.output_dims, &operator_10.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_depthwise_conv_scratch_size(&operator_11.input_dims, &operator_11.filter_dims, &operator_11.output_dims, &operator_11.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_12.input_dims, &operator_12.filter_dims, &operator_12.output_dims, &operator_12.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_13.input_dims, &operator_13.filter_dims, &operator_13.output_dims, &operator_13.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_depthwise_conv_scratch_size(&operator_14.input_dims, &operator_14.filter_dims, &operator_14.output_dims, &operator_14.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_add_scratch_size(&operator_15.conv.input_dims, &operator_15.conv.filter_dims, &operator_15.conv.output_dims, &operator_15.conv.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_17.input_dims, &operator_17.filter_dims, &operator_17.output_dims, &operator_17.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_depthwise_conv_scratch_size(&operator_18.input_dims, &operator_18.filter_dims, &operator_18.output_dims, &operator_18.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_add_scratch_size(&operator_19.conv.input_dims, &operator_19.conv.filter_dims, &operator_19.conv.output_dims, &operator_19.conv.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_21.input_dims, &operator_21.filter_dims, &operator_21.output_dims, &operator_21.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_22.input_dims, &operator_22.filter_dims, &operator_22.output_dims, &operator_22.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_conv_scratch_size(&operator_23.input_dims, &operator_23.filter_dims, &operator_23.output_dims, &operator_23.params);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+    size = esp_nn_get_softmax_scratch_size(operator_24.scratch_width, operator_24.scratch_height);
+    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;
+#endif
+    scratch_size = (scratch_size + 15) & ~(size_t)15;
+
+    // scratch buffer after the activations of the fast arena when it fits, of the main one otherwise
+    bool scratch_in_fast_arena = false;
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+    scratch_in_fast_arena = scratch_size > 0 && FAST_ARENA_USED + scratch_size <= EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE;
+#endif
+    const size_t main_size = MAIN_ARENA_SIZE + (scratch_in_fast_arena ? 0 : scratch_size);
+    // the arena is kept until reset, a second init only binds the activations to it again
+    if (main_arena == nullptr) {
+        main_arena = (uint8_t*)alloc_fnc(16, main_size);
+        if (main_arena == nullptr) {
+            return kTfLiteError;
+        }
+    }
+    scratch_buffer = nullptr;
+    if (scratch_size > 0) {
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+        scratch_buffer = scratch_in_fast_arena ? fast_arena + FAST_ARENA_USED : main_arena + MAIN_ARENA_SIZE;
+#else
+        scratch_buffer = main_arena + MAIN_ARENA_SIZE;
+#endif
+    }
+
+    memset(activations, 0, sizeof(activations));
+    for (size_t ix = 0; ix < sizeof(placements) / sizeof(placements[0]); ix++) {
+        const tensor_placement_t *placement = &placements[ix];
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+        uint8_t *arena = placement->fast ? fast_arena : main_arena;
+#else
+        uint8_t *arena = main_arena;
+#endif
+        activations[placement->tensor] = (int8_t*)(arena + placement->offset);
+    }
+
+#if EI_CLASSIFIER_PROFILING == 1
+    ei_profiling_record(EI_PROFILING_MEMORY, "tflite_arena", 0, (uint32_t)main_size);
+#if FAST_ARENA_USED > 0
+    ei_profiling_record(EI_PROFILING_MEMORY, "fast_arena", 0,
+        (uint32_t)(FAST_ARENA_USED + (scratch_in_fast_arena ? scratch_size : 0)));
+    // memory tier of every operator, to split its latency by tier in tools/profile_report.py
+    for (size_t ix = 0; ix < OPERATORS_SIZE; ix++) {
+        ei_profiling_record(EI_PROFILING_TIER, "fast_arena", operator_indexes[ix], operator_fast_bytes[ix]);
+    }
+#endif
+#endif
+    return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_27_input(int index, TfLiteTensor* tensor)
+{
+    static const int inputs[] = { 0 };
+    if (index < 0 || index >= (int)(sizeof(inputs) / sizeof(inputs[0]))) {
+        return kTfLiteError;
+    }
+    return fill_tensor(inputs[index], tensor);
+}
+
+TfLiteStatus tflite_learn_27_output(int index, TfLiteTensor* tensor)
+{
+    static const int outputs[] = { 70 };
+    if (index < 0 || index >= (int)(sizeof(outputs) / sizeof(outputs[0]))) {
+        return kTfLiteError;
+    }
+    return fill_tensor(outputs[index], tensor);
+}
+
+TfLiteStatus tflite_learn_27_tensor(int index, TfLiteTensor* tensor)
+{
+    return fill_tensor(index, tensor);
+}
+
+size_t tflite_learn_27_operators_size()
+{
+    return OPERATORS_SIZE;
+}
+
+int tflite_learn_27_operator_output(size_t index)
+{
+    return index < OPERATORS_SIZE ? operator_outputs[index] : -1;
+}
+
+TfLiteStatus tflite_learn_27_invoke_operator(size_t index)
+{
+    if (main_arena == nullptr) {
+        return kTfLiteError;
+    }
+    switch (index) {
+        case 0: conv_2d(&operator_0); break;
+        case 1: depthwise_conv_2d(&operator_1); break;
+        case 2: conv_2d(&operator_2); break;
+        case 3: conv_2d(&operator_3); break;
+        case 4: depthwise_conv_2d(&operator_4); break;
+        case 5: conv_2d(&operator_5); break;
+        case 6: conv_2d(&operator_6); break;
+        case 7: depthwise_conv_2d(&operator_7); break;
+        case 8: conv_2d_add(&operator_8); break;
+        case 9: conv_2d(&operator_10); break;
+        case 10: depthwise_conv_2d(&operator_11); break;
+        case 11: conv_2d(&operator_12); break;
+        case 12: conv_2d(&operator_13); break;
+        case 13: depthwise_conv_2d(&operator_14); break;
+        case 14: conv_2d_add(&operator_15); break;
+        case 15: conv_2d(&operator_17); break;
+        case 16: depthwise_conv_2d(&operator_18); break;
+        case 17: conv_2d_add(&operator_19); break;
+        case 18: conv_2d(&operator_21); break;
+        case 19: conv_2d(&operator_22); break;
+        case 20: conv_2d(&operator_23); break;
+        case 21: softmax(&operator_24); break;
+        default: return kTfLiteError;
+    }
+    return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_27_invoke()
+{
+    for (size_t ix = 0; ix < OPERATORS_SIZE; ix++) {
+        const uint32_t start = ei_profiling_cycles();
+        TfLiteStatus status = tflite_learn_27_invoke_operator(ix);
+        if (status != kTfLiteOk) {
+            return status;
+        }
+        ei_profiling_record(EI_PROFILING_OP, operator_names[ix], operator_indexes[ix], ei_profiling_cycles() - start);
+    }
+    return kTfLiteOk;
+}
+
+TfLiteStatus tflite_learn_27_reset(void (*free)(void* ptr))
+{
+    if (main_arena != nullptr) {
+        free(main_arena);
+    }
+    main_arena = nullptr;
+    scratch_buffer = nullptr;
+    memset(activations, 0, sizeof(activations));
+    return kTfLiteOk;
+}
@@ -0,0 +1,24 @@
+// Generated by tools/aot_compile.py from tflite_learn_27.h, do not edit
+#ifndef _TFLITE_LEARN_27_COMPILED_H_
+#define _TFLITE_LEARN_27_COMPILED_H_
+
+#include <stddef.h>
+#include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+
+// executor with the interface of the Edge Impulse EON compiler (ei_config_tflite_eon_graph_t)
+// init allocates the arena on the first call and keeps it until reset, later calls reuse it
+TfLiteStatus tflite_learn_27_init(void*(*alloc_fnc)(size_t, size_t));
+TfLiteStatus tflite_learn_27_input(int index, TfLiteTensor* tensor);
+TfLiteStatus tflite_learn_27_output(int index, TfLiteTensor* tensor);
+TfLiteStatus tflite_learn_27_invoke();
+TfLiteStatus tflite_learn_27_reset(void (*free)(void* ptr));
+
+// one operator at a time and any activation by its tensor index in the model,
+// to compare the executor with the interpreter (tools/benchmark/compiled_compare.cpp)
+// fused operators make it fewer than the model has, each is found by the tensor it writes
+size_t tflite_learn_27_operators_size();
+int tflite_learn_27_operator_output(size_t index);
+TfLiteStatus tflite_learn_27_invoke_operator(size_t index);
+TfLiteStatus tflite_learn_27_tensor(int index, TfLiteTensor* tensor);
+
+#endif // _TFLITE_LEARN_27_COMPILED_H_
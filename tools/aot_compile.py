@@ -0,0 +1,1151 @@
+#!/usr/bin/env python3
+#author: Stepan Vondracek (xvondr27)
+# Ahead-of-time compiler of the model into a static C++ executor, the "EON compiled" model of
+# Edge Impulse (EI_CLASSIFIER_COMPILED, see edge-impulse-sdk/classifier/inferencing_engines/tflite_eon.h)
+# Every operator becomes a direct call of the kernel TFLite Micro runs for it (ESP-NN, or the
+# reference kernels without EI_CLASSIFIER_TFLITE_ENABLE_ESP_NN) with the parameters of its Prepare()
+# folded into constants. The quantization math below mirrors tensorflow/lite/kernels/internal/
+# quantization_util.cc and kernel_util.cc bit for bit. Activations are placed by the offline memory
+# plan stored in the model (tools/memory_plan.py), so nothing is parsed, registered or planned on
+# the device. tools/benchmark/compiled_compare checks the executor against the interpreter tensor
+# by tensor.
+#
+# A Conv2D followed by the Add of a residual block, when the Add is the only reader of the
+# convolution output, runs as one operator: esp_nn_conv_add_s8 adds the residual input in the
+# requantization of the convolution, so its output is never written to the arena and read back.
+# tools/memory_plan.py keeps the Add output apart from the convolution input for it.
+#
+# Only what the photo trap models use is supported: one subgraph of int8 Conv2D, DepthwiseConv2D,
+# Add, Pad and Softmax with batch 1. Anything else is an error instead of a wrong executor.
+#
+# usage: python3 tools/aot_compile.py              # tflite-model/tflite_learn_27_compiled.{h,cpp}
+#        python3 tools/aot_compile.py model.tflite --name my_model -o out/
+import argparse
+import math
+import os
+import struct
+import sys
+
+import memory_plan
+from memory_plan import ALIGNMENT, ONLINE_PLANNED, FlatBuffer, align_up
+
+# field indexes of schema.fbs tables, the rest is in memory_plan.py
+MODEL_OPERATOR_CODES, MODEL_SUBGRAPHS = 1, 2
+OPCODE_DEPRECATED_BUILTIN, OPCODE_BUILTIN = 0, 3
+TENSOR_QUANTIZATION = 4
+QUANTIZATION_SCALE, QUANTIZATION_ZERO_POINT = 2, 3
+OPERATOR_OPCODE, OPERATOR_OPTIONS = 0, 4
+
+# BuiltinOperator
+OP_ADD, OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_SOFTMAX, OP_PAD = 0, 3, 4, 25, 34
+# not a BuiltinOperator, a Conv2D with the residual Add after it fused into one kernel
+OP_CONV_2D_ADD = -1
+OP_NAMES = {OP_ADD: "ADD", OP_CONV_2D: "CONV_2D", OP_DEPTHWISE_CONV_2D: "DEPTHWISE_CONV_2D",
+            OP_SOFTMAX: "SOFTMAX", OP_PAD: "PAD", OP_CONV_2D_ADD: "CONV_2D+ADD"}
+# TensorType
+TYPE_INT32, TYPE_INT8 = 2, 9
+# Padding and ActivationFunctionType
+PADDING_SAME, PADDING_VALID = 0, 1
+ACT_NONE, ACT_RELU, ACT_RELU_N1_TO_1, ACT_RELU6 = 0, 1, 2, 3
+
+INT8_MIN, INT8_MAX = -128, 127
+# bits of the input difference of the int8 softmax (softmax_common.cc)
+SOFTMAX_SCALED_DIFF_INTEGER_BITS = 5
+# left shift of the int8 Add (add_common.cc)
+ADD_LEFT_SHIFT = 20
+
+REPO_ROOT = memory_plan.REPO_ROOT
+DEFAULT_OUTPUT = os.path.normpath(os.path.join(REPO_ROOT, "tflite-model"))
+
+
+def f32(value):
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+# std::round, halves away from zero
+def tflite_round(value):
+    magnitude = abs(value)
+    whole = math.floor(magnitude)
+    rounded = int(whole) + (1 if magnitude - whole >= 0.5 else 0)
+    return -rounded if value < 0 else rounded
+
+
+def quantize_multiplier(multiplier):
+    if multiplier == 0.0:
+        return 0, 0
+    q, shift = math.frexp(multiplier)
+    q_fixed = tflite_round(q * (1 << 31))
+    if q_fixed == 1 << 31:
+        q_fixed //= 2
+        shift += 1
+    if shift < -31:
+        shift, q_fixed = 0, 0
+    return q_fixed, shift
+
+
+def quantize_multiplier_smaller_than_one(multiplier):
+    if not 0.0 < multiplier < 1.0:
+        raise ValueError(f"multiplier {multiplier} is not in (0, 1)")
+    return quantize_multiplier(multiplier)
+
+
+def quantize_multiplier_greater_than_one(multiplier):
+    if multiplier <= 1.0:
+        raise ValueError(f"multiplier {multiplier} is not above 1")
+    return quantize_multiplier(multiplier)
+
+
+# CalculateActivationRangeQuantized of an int8 output, Quantize() divides in float
+def activation_range(activation, scale, zero_point):
+    quantize = lambda value: zero_point + tflite_round(f32(value / scale))
+    if activation == ACT_RELU:
+        return max(INT8_MIN, quantize(0.0)), INT8_MAX
+    if activation == ACT_RELU6:
+        return max(INT8_MIN, quantize(0.0)), min(INT8_MAX, quantize(6.0))
+    if activation == ACT_RELU_N1_TO_1:
+        return max(INT8_MIN, quantize(-1.0)), min(INT8_MAX, quantize(1.0))
+    return INT8_MIN, INT8_MAX
+
+
+# ComputePaddingHeightWidth of tensorflow/lite/kernels/padding.h for one dimension
+def compute_padding(padding, stride, in_size, filter_size):
+    if padding == PADDING_SAME:
+        out_size = (in_size + stride - 1) // stride
+    else:
+        out_size = (in_size + stride - filter_size) // stride
+    total = max((out_size - 1) * stride + filter_size - in_size, 0)
+    return out_size, total // 2
+
+
+def scalar_vector(fb, table, index, fmt):
+    vector = fb.ref(table, index)
+    count = fb.vector_len(vector)
+    return list(struct.unpack_from(f"<{count}{fmt}", fb.data, vector + 4)) if count else []
+
+
+class ModelTensor:
+    def __init__(self, fb, index, table, buffers):
+        self.index = index
+        self.name = fb.string(table, memory_plan.TENSOR_NAME).decode(errors="replace")
+        self.type = fb.scalar(table, memory_plan.TENSOR_TYPE, "<b")
+        self.shape = fb.int_vector(table, memory_plan.TENSOR_SHAPE)
+        data = fb.ref(buffers[fb.scalar(table, memory_plan.TENSOR_BUFFER, "<I")], memory_plan.BUFFER_DATA)
+        self.data = bytes(fb.data[data + 4:data + 4 + fb.vector_len(data)]) if data is not None else b""
+        quantization = fb.ref(table, TENSOR_QUANTIZATION)
+        self.scales, self.zero_points = [], []
+        if quantization is not None:
+            self.scales = scalar_vector(fb, quantization, QUANTIZATION_SCALE, "f")
+            self.zero_points = scalar_vector(fb, quantization, QUANTIZATION_ZERO_POINT, "q")
+
+    @property
+    def scale(self):
+        return self.scales[0] if self.scales else 0.0
+
+    @property
+    def zero_point(self):
+        return self.zero_points[0] if self.zero_points else 0
+
+    def values(self, fmt):
+        return list(struct.unpack(f"<{len(self.data) // struct.calcsize(fmt)}{fmt}", self.data))
+
+
+class Operator:
+    def __init__(self, index, code, inputs, outputs):
+        self.index = index
+        self.code = code
+        self.name = OP_NAMES[code]
+        self.inputs = inputs
+        self.outputs = outputs
+        # C initializer of the operator struct and constant arrays it references
+        self.fields = []
+        self.arrays = []
+
+
+def operator_codes(fb):
+    codes = []
+    for code in fb.table_vector(fb.root(), MODEL_OPERATOR_CODES):
+        builtin = fb.scalar(code, OPCODE_BUILTIN, "<i")
+        codes.append(builtin if builtin else fb.scalar(code, OPCODE_DEPRECATED_BUILTIN, "<b"))
+    return codes
+
+
+# (convolution, add) operator indexes of the residual Adds that run in the convolution kernel:
+# the Add right after a Conv2D reads its output and nothing else does
+def residual_fusions(fb):
+    subgraph = fb.table_vector(fb.root(), MODEL_SUBGRAPHS)[0]
+    codes = operator_codes(fb)
+    operators = fb.table_vector(subgraph, memory_plan.SUBGRAPH_OPERATORS)
+    graph_outputs = set(fb.int_vector(subgraph, memory_plan.SUBGRAPH_OUTPUTS))
+    readers = {}
+    for index, table in enumerate(operators):
+        for tensor in fb.int_vector(table, memory_plan.OPERATOR_INPUTS):
+            readers.setdefault(tensor, []).append(index)
+
+    fusions = []
+    for index in range(len(operators) - 1):
+        conv, add = operators[index], operators[index + 1]
+        if codes[fb.scalar(conv, OPERATOR_OPCODE, "<I")] != OP_CONV_2D \
+                or codes[fb.scalar(add, OPERATOR_OPCODE, "<I")] != OP_ADD:
+            continue
+        conv_output = fb.int_vector(conv, memory_plan.OPERATOR_OUTPUTS)[0]
+        add_inputs = fb.int_vector(add, memory_plan.OPERATOR_INPUTS)
+        if conv_output in graph_outputs or readers.get(conv_output) != [index + 1] \
+                or add_inputs.count(conv_output) != 1:
+            continue
+        fusions.append((index, index + 1))
+    return fusions
+
+
+# the Add is run in the requantization of the convolution with the convolution output as input1
+def fuse_conv_add(conv, add, tensors):
+    conv_output = conv.outputs[0]
+    skip = add.inputs[1] if add.inputs[0] == conv_output else add.inputs[0]
+    output = tensors[add.outputs[0]]
+    if tensors[skip].shape != output.shape:
+        raise ValueError(f"operator {add.index}: broadcasting Add is not supported")
+    params = dict((field, value) for value, field in add.fields)
+    first, second = ("1", "2") if add.inputs[0] == conv_output else ("2", "1")
+    add_params = (f"{{ {params[f'input{first}_offset']}, {params[f'input{second}_offset']}, "
+                  f"{params[f'input{first}_multiplier']}, {params[f'input{second}_multiplier']}, "
+                  f"{params[f'input{first}_shift']}, {params[f'input{second}_shift']}, {params['left_shift']}, "
+                  f"{params['output_offset']}, {params['output_multiplier']}, {params['output_shift']}, "
+                  f"{{ {params['activation_min']}, {params['activation_max']} }} }}")
+    # filter and bias stay at 1 and 2, a missing bias is -1
+    inputs = conv.inputs + [-1] * (3 - len(conv.inputs)) + [skip]
+    op = Operator(conv.index, OP_CONV_2D_ADD, inputs, add.outputs)
+    op.arrays = conv.arrays
+    op.fields = [
+        (conv.fields, "conv"),
+        (skip, "add_input"),
+        (output.index, "output"),
+        (add_params, "add_params"),
+    ]
+    return op
+
+
+def read_operators(fb, tensors, fusions=()):
+    model = fb.root()
+    codes = operator_codes(fb)
+
+    subgraph = fb.table_vector(model, MODEL_SUBGRAPHS)[0]
+    operators = []
+    fused_adds = {add: conv for conv, add in fusions}
+    for index, table in enumerate(fb.table_vector(subgraph, memory_plan.SUBGRAPH_OPERATORS)):
+        code = codes[fb.scalar(table, OPERATOR_OPCODE, "<I")]
+        if code not in OP_NAMES:
+            raise ValueError(f"operator {index}: builtin operator {code} is not supported")
+        op = Operator(index, code, fb.int_vector(table, memory_plan.OPERATOR_INPUTS),
+                      fb.int_vector(table, memory_plan.OPERATOR_OUTPUTS))
+        options = fb.ref(table, OPERATOR_OPTIONS)
+        if code == OP_CONV_2D:
+            compile_conv(op, tensors, fb, options, depthwise=False)
+        elif code == OP_DEPTHWISE_CONV_2D:
+            compile_conv(op, tensors, fb, options, depthwise=True)
+        elif code == OP_ADD:
+            compile_add(op, tensors, fb, options)
+        elif code == OP_PAD:
+            compile_pad(op, tensors)
+        else:
+            compile_softmax(op, tensors, fb, options)
+        if index in fused_adds:
+            op = fuse_conv_add(operators.pop(), op, tensors)
+        operators.append(op)
+    return operators, fb.int_vector(subgraph, memory_plan.SUBGRAPH_INPUTS), \
+        fb.int_vector(subgraph, memory_plan.SUBGRAPH_OUTPUTS)
+
+
+def nhwc(tensor):
+    if len(tensor.shape) != 4 or tensor.shape[0] != 1:
+        raise ValueError(f"tensor {tensor.index} ({tensor.name}): shape {tensor.shape} is not [1, h, w, c]")
+    return tensor.shape[1:]
+
+
+# Prepare() of conv.cc / depthwise_conv.cc: padding, per channel multipliers and activation range
+def compile_conv(op, tensors, fb, options, depthwise):
+    input, filter, output = (tensors[i] for i in (op.inputs[0], op.inputs[1], op.outputs[0]))
+    bias = tensors[op.inputs[2]] if len(op.inputs) > 2 and op.inputs[2] >= 0 else None
+    # Conv2DOptions: padding, stride_w, stride_h, activation, dilation_w, dilation_h
+    # DepthwiseConv2DOptions has depth_multiplier before the activation
+    act_field = 4 if depthwise else 3
+    padding = fb.scalar(options, 0, "<b")
+    stride_w = fb.scalar(options, 1, "<i")
+    stride_h = fb.scalar(options, 2, "<i")
+    activation = fb.scalar(options, act_field, "<b")
+    dilation_w = fb.scalar(options, act_field + 1, "<i", 1)
+    dilation_h = fb.scalar(options, act_field + 2, "<i", 1)
+    if dilation_w != 1 or dilation_h != 1:
+        raise ValueError(f"operator {op.index}: dilated convolutions are not supported")
+
+    in_h, in_w, in_c = nhwc(input)
+    out_h, out_w, out_c = nhwc(output)
+    _, filter_h, filter_w, _ = filter.shape
+    ch_mult = fb.scalar(options, 3, "<i") if depthwise else 0
+    if depthwise and out_c != in_c * ch_mult:
+        raise ValueError(f"operator {op.index}: depth multiplier {ch_mult} does not match the channels")
+    expected_h, pad_h = compute_padding(padding, stride_h, in_h, filter_h)
+    expected_w, pad_w = compute_padding(padding, stride_w, in_w, filter_w)
+    if (expected_h, expected_w) != (out_h, out_w):
+        raise ValueError(f"operator {op.index}: output {out_h}x{out_w} does not match the padding")
+    if input.type != TYPE_INT8 or filter.type != TYPE_INT8 or (bias and bias.type != TYPE_INT32):
+        raise ValueError(f"operator {op.index}: only int8 convolutions with int32 bias are supported")
+
+    # filter channels are the first dimension of Conv2D and the last of DepthwiseConv2D
+    channels = filter.shape[3] if depthwise else filter.shape[0]
+    multipliers, shifts = [], []
+    for c in range(channels):
+        filter_scale = filter.scales[c] if len(filter.scales) > 1 else filter.scales[0]
+        multiplier, shift = quantize_multiplier(input.scale * filter_scale / output.scale)
+        multipliers.append(multiplier)
+        shifts.append(shift)
+    act_min, act_max = activation_range(activation, output.scale, output.zero_point)
+
+    prefix = f"operator_{op.index}"
+    op.arrays.append(("const int32_t", f"{prefix}_multiplier", multipliers))
+    op.arrays.append(("const int32_t", f"{prefix}_shift", shifts))
+    params = f"{{ {-input.zero_point}, {output.zero_point}, "
+    if depthwise:
+        params += f"{ch_mult}, "
+    params += f"{{ {stride_w}, {stride_h} }}, {{ {pad_w}, {pad_h} }}, {{ 0, 0 }}, {{ {act_min}, {act_max} }} }}"
+    op.fields = [
+        (input.index, "input"),
+        (output.index, "output"),
+        (f"tensor_data{filter.index}", "filter"),
+        (f"tensor_data{bias.index}" if bias else "nullptr", "bias"),
+        (f"{{ {in_w}, {in_h}, {in_c}, 1 }}", "input_dims"),
+        (f"{{ {filter_w}, {filter_h}, 0, 0 }}", "filter_dims"),
+        (f"{{ {out_w}, {out_h}, {out_c}, 1 }}", "output_dims"),
+        (params, "params"),
+        (f"{prefix}_shift", "shift"),
+        (f"{prefix}_multiplier", "mult"),
+    ]
+
+
+# CalculateOpDataAdd of add_common.cc for int8 tensors of one shape
+def compile_add(op, tensors, fb, options):
+    input1, input2, output = (tensors[i] for i in (op.inputs[0], op.inputs[1], op.outputs[0]))
+    if input1.shape != input2.shape or input1.shape != output.shape:
+        raise ValueError(f"operator {op.index}: broadcasting Add is not supported")
+    if {input1.type, input2.type, output.type} != {TYPE_INT8}:
+        raise ValueError(f"operator {op.index}: only int8 Add is supported")
+    activation = fb.scalar(options, 0, "<b") if options is not None else ACT_NONE
+
+    twice_max_input_scale = 2 * max(input1.scale, input2.scale)
+    multiplier1, shift1 = quantize_multiplier_smaller_than_one(input1.scale / twice_max_input_scale)
+    multiplier2, shift2 = quantize_multiplier_smaller_than_one(input2.scale / twice_max_input_scale)
+    output_multiplier, output_shift = quantize_multiplier_smaller_than_one(
+        twice_max_input_scale / ((1 << ADD_LEFT_SHIFT) * output.scale))
+    act_min, act_max = activation_range(activation, output.scale, output.zero_point)
+    size = 1
+    for dim in output.shape:
+        size *= dim
+    op.fields = [
+        (input1.index, "input1"),
+        (input2.index, "input2"),
+        (output.index, "output"),
+        (-input1.zero_point, "input1_offset"),
+        (-input2.zero_point, "input2_offset"),
+        (multiplier1, "input1_multiplier"),
+        (multiplier2, "input2_multiplier"),
+        (shift1, "input1_shift"),
+        (shift2, "input2_shift"),
+        (ADD_LEFT_SHIFT, "left_shift"),
+        (output.zero_point, "output_offset"),
+        (output_multiplier, "output_multiplier"),
+        (output_shift, "output_shift"),
+        (act_min, "activation_min"),
+        (act_max, "activation_max"),
+        (size, "size"),
+    ]
+
+
+# Pad of the height and width with the output zero point (pad.cc without constant values)
+def compile_pad(op, tensors):
+    input, paddings, output = (tensors[i] for i in (op.inputs[0], op.inputs[1], op.outputs[0]))
+    if len(op.inputs) > 2 or not paddings.data or input.type != TYPE_INT8:
+        raise ValueError(f"operator {op.index}: only int8 Pad with constant paddings is supported")
+    pads = paddings.values("q" if paddings.type == 4 else "i")
+    in_h, in_w, channels = nhwc(input)
+    out_h, out_w, _ = nhwc(output)
+    if pads[0] or pads[1] or pads[6] or pads[7]:
+        raise ValueError(f"operator {op.index}: only height and width can be padded")
+    top, bottom, left, right = pads[2:6]
+    if (in_h + top + bottom, in_w + left + right) != (out_h, out_w):
+        raise ValueError(f"operator {op.index}: paddings do not match the output shape")
+    op.fields = [
+        (input.index, "input"),
+        (output.index, "output"),
+        (in_h, "input_height"),
+        (in_w, "input_width"),
+        (out_w, "output_width"),
+        (channels, "channels"),
+        (top, "top"),
+        (bottom, "bottom"),
+        (left, "left"),
+        (output.zero_point, "value"),
+    ]
+
+
+# CalculateSoftmaxParams of softmax_common.cc for int8 input and output
+def compile_softmax(op, tensors, fb, options):
+    input, output = tensors[op.inputs[0]], tensors[op.outputs[0]]
+    if input.type != TYPE_INT8 or output.type != TYPE_INT8 or output.zero_point != -128 \
+            or output.scale != 1.0 / 256:
+        raise ValueError(f"operator {op.index}: only int8 Softmax with the standard output is supported")
+    beta = fb.scalar(options, 0, "<f", 1.0) if options is not None else 1.0
+    max_real_multiplier = (1 << 31) - 1.0
+    real_multiplier = min(beta * input.scale * (1 << (31 - SOFTMAX_SCALED_DIFF_INTEGER_BITS)),
+                          max_real_multiplier)
+    multiplier, left_shift = quantize_multiplier_greater_than_one(real_multiplier)
+    radius = math.floor(1.0 * ((1 << SOFTMAX_SCALED_DIFF_INTEGER_BITS) - 1)
+                        * (1 << (31 - SOFTMAX_SCALED_DIFF_INTEGER_BITS)) / (1 << left_shift))
+    depth = input.shape[-1]
+    outer = 1
+    for dim in input.shape[:-1]:
+        outer *= dim
+    # esp_nn_get_softmax_scratch_size is asked with dims 1 and 2 like softmax.cc does
+    width = input.shape[1] if len(input.shape) > 1 else 1
+    height = input.shape[2] if len(input.shape) > 2 else 1
+    op.fields = [
+        (input.index, "input"),
+        (output.index, "output"),
+        (outer, "outer_size"),
+        (depth, "depth"),
+        (multiplier, "input_multiplier"),
+        (left_shift, "input_left_shift"),
+        (-radius, "diff_min"),
+        (width, "scratch_width"),
+        (height, "scratch_height"),
+    ]
+
+
+# (offset of every tensor in the main arena, offset in the fast arena or ONLINE_PLANNED)
+def read_layout(fb, planned, all_tensors):
+    def metadata_offsets(name):
+        data = memory_plan.find_metadata(fb, name)
+        if data is None:
+            return None
+        count = fb.u32(data)
+        _version, _subgraph, tensor_count = struct.unpack_from("<III", fb.data, data + 4)
+        if tensor_count != len(all_tensors) or count != 12 + 4 * tensor_count:
+            raise ValueError(f"{name.decode()} metadata does not match the model")
+        return list(struct.unpack_from(f"<{tensor_count}i", fb.data, data + 16))
+
+    main = metadata_offsets(memory_plan.METADATA_NAME)
+    fast = metadata_offsets(memory_plan.FAST_METADATA_NAME) or [ONLINE_PLANNED] * len(all_tensors)
+    if main is None or any(main[t.index] == ONLINE_PLANNED and fast[t.index] == ONLINE_PLANNED
+                           for t in planned):
+        # not planned offline (yet), plan the main arena here
+        rest = [t for t in planned if fast[t.index] == ONLINE_PLANNED]
+        memory_plan.plan(rest)
+        main = [ONLINE_PLANNED] * len(all_tensors)
+        for tensor in rest:
+            main[tensor.index] = tensor.offset
+    return main, fast
+
+
+# the fused kernel writes the Add output while it reads the convolution input, a plan made
+# without the fusion may have put them at the same place
+def check_fusions(operators, planned, main, fast):
+    sizes = {t.index: align_up(t.size) for t in planned}
+
+    def place(index):
+        return ("fast", fast[index]) if fast[index] != ONLINE_PLANNED else ("main", main[index])
+
+    for op in operators:
+        if op.code != OP_CONV_2D_ADD:
+            continue
+        (input_arena, input_at), (output_arena, output_at) = place(op.inputs[0]), place(op.outputs[0])
+        if input_arena == output_arena and input_at < output_at + sizes[op.outputs[0]] \
+                and output_at < input_at + sizes[op.inputs[0]]:
+            raise ValueError(f"operator {op.index}: the memory plan overlaps the input and the output of "
+                             f"the fused Add, run tools/memory_plan.py again")
+
+
+def arena_size(tensors, offsets):
+    return max((offsets[t.index] + align_up(t.size) for t in tensors
+                if offsets[t.index] != ONLINE_PLANNED), default=0)
+
+
+def c_array(ctype, name, values, per_line=16, align=False):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    prefix = f"alignas({ALIGNMENT}) " if align else ""
+    return f"{prefix}static {ctype} {name}[{len(values)}] = {{\n" + "\n".join(lines) + "\n};\n"
+
+
+HEADER_TEMPLATE = """\
+// Generated by tools/aot_compile.py from {source}, do not edit
+#ifndef _{guard}_COMPILED_H_
+#define _{guard}_COMPILED_H_
+
+#include <stddef.h>
+#include "edge-impulse-sdk/tensorflow/lite/c/common.h"
+
+// executor with the interface of the Edge Impulse EON compiler (ei_config_tflite_eon_graph_t)
+// init allocates the arena on the first call and keeps it until reset, later calls reuse it
+TfLiteStatus {name}_init(void*(*alloc_fnc)(size_t, size_t));
+TfLiteStatus {name}_input(int index, TfLiteTensor* tensor);
+TfLiteStatus {name}_output(int index, TfLiteTensor* tensor);
+TfLiteStatus {name}_invoke();
+TfLiteStatus {name}_reset(void (*free)(void* ptr));
+
+// one operator at a time and any activation by its tensor index in the model,
+// to compare the executor with the interpreter (tools/benchmark/compiled_compare.cpp)
+// fused operators make it fewer than the model has, each is found by the tensor it writes
+size_t {name}_operators_size();
+int {name}_operator_output(size_t index);
+TfLiteStatus {name}_invoke_operator(size_t index);
+TfLiteStatus {name}_tensor(int index, TfLiteTensor* tensor);
+
+#endif // _{guard}_COMPILED_H_
+"""
+
+KERNELS = """\
+#ifndef EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE
+#define EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE        0
+#endif
+
+namespace {
+
+typedef struct {
+    uint8_t input;
+    uint8_t output;
+    const int8_t *filter;
+    const int32_t *bias;
+    data_dims_t input_dims;
+    data_dims_t filter_dims;
+    data_dims_t output_dims;
+    conv_params_t params;
+    const int32_t *shift;
+    const int32_t *mult;
+} conv_2d_t;
+
+typedef struct {
+    uint8_t input;
+    uint8_t output;
+    const int8_t *filter;
+    const int32_t *bias;
+    data_dims_t input_dims;
+    data_dims_t filter_dims;
+    data_dims_t output_dims;
+    dw_conv_params_t params;
+    const int32_t *shift;
+    const int32_t *mult;
+} depthwise_conv_2d_t;
+
+typedef struct {
+    uint8_t input1;
+    uint8_t input2;
+    uint8_t output;
+    int32_t input1_offset;
+    int32_t input2_offset;
+    int32_t input1_multiplier;
+    int32_t input2_multiplier;
+    int32_t input1_shift;
+    int32_t input2_shift;
+    int32_t left_shift;
+    int32_t output_offset;
+    int32_t output_multiplier;
+    int32_t output_shift;
+    int32_t activation_min;
+    int32_t activation_max;
+    int32_t size;
+} add_t;
+
+typedef struct {
+    conv_2d_t conv;
+    uint8_t add_input;
+    uint8_t output;
+    add_params_t add_params;
+} conv_2d_add_t;
+
+typedef struct {
+    uint8_t input;
+    uint8_t output;
+    int32_t input_height;
+    int32_t input_width;
+    int32_t output_width;
+    int32_t channels;
+    int32_t top;
+    int32_t bottom;
+    int32_t left;
+    int32_t value;
+} pad_t;
+
+typedef struct {
+    uint8_t input;
+    uint8_t output;
+    int32_t outer_size;
+    int32_t depth;
+    int32_t input_multiplier;
+    int32_t input_left_shift;
+    int32_t diff_min;
+    int32_t scratch_width;
+    int32_t scratch_height;
+} softmax_t;
+
+// dims of a TfLiteTensor, laid out like TfLiteIntArray
+typedef struct {
+    int size;
+    int data[4];
+} tensor_dims_t;
+
+typedef struct {
+    size_t bytes;
+    float scale;
+    int32_t zero_point;
+    tensor_dims_t dims;
+} tensor_info_t;
+
+typedef struct {
+    uint8_t tensor;
+    uint8_t fast;
+    uint32_t offset;
+} tensor_placement_t;
+
+} // namespace
+"""
+
+# the executor, with only the kernel functions of the operators in the model (an unused static
+# function is an error in the ESP-IDF build)
+RUNTIME_BEGIN = """\
+namespace {
+
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+// internal SRAM, the main arena comes from the allocator given to init (PSRAM on the ESP32-S3)
+alignas(16) uint8_t fast_arena[EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE];
+#endif
+uint8_t *main_arena = nullptr;
+void *scratch_buffer = nullptr;
+int8_t *activations[TENSORS_SIZE];
+
+#if !ESP_NN
+tflite::RuntimeShape shape(int32_t d0, int32_t d1, int32_t d2, int32_t d3)
+{
+    const int32_t dims[4] = { d0, d1, d2, d3 };
+    return tflite::RuntimeShape(4, dims);
+}
+#endif
+
+"""
+
+OPERATOR_FUNCTIONS = {
+    OP_CONV_2D: """\
+void conv_2d(const conv_2d_t *op)
+{
+#if ESP_NN
+    const quant_data_t quant_data = { (int32_t*)op->shift, (int32_t*)op->mult };
+    esp_nn_set_conv_scratch_buf(scratch_buffer);
+    esp_nn_conv_s8(&op->input_dims, activations[op->input], &op->filter_dims, op->filter, op->bias,
+                   &op->output_dims, activations[op->output], &op->params, &quant_data);
+#else
+    tflite::ConvParams params = { };
+    params.input_offset = op->params.in_offset;
+    params.output_offset = op->params.out_offset;
+    params.stride_width = op->params.stride.width;
+    params.stride_height = op->params.stride.height;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+    params.padding_values.width = op->params.padding.width;
+    params.padding_values.height = op->params.padding.height;
+    params.quantized_activation_min = op->params.activation.min;
+    params.quantized_activation_max = op->params.activation.max;
+    tflite::reference_integer_ops::ConvPerChannel(
+        params, op->mult, op->shift,
+        shape(1, op->input_dims.height, op->input_dims.width, op->input_dims.channels), activations[op->input],
+        shape(op->output_dims.channels, op->filter_dims.height, op->filter_dims.width, op->input_dims.channels),
+        op->filter, tflite::RuntimeShape(1, &op->output_dims.channels), op->bias,
+        shape(1, op->output_dims.height, op->output_dims.width, op->output_dims.channels), activations[op->output]);
+#endif
+}
+
+""",
+    OP_CONV_2D_ADD: """\
+// the convolution output is not written, the Add is done on it in the requantization
+void conv_2d_add(const conv_2d_add_t *op)
+{
+#if ESP_NN
+    const conv_2d_t *conv = &op->conv;
+    const quant_data_t quant_data = { (int32_t*)conv->shift, (int32_t*)conv->mult };
+    esp_nn_set_conv_add_scratch_buf(scratch_buffer);
+    esp_nn_conv_add_s8(&conv->input_dims, activations[conv->input], &conv->filter_dims, conv->filter, conv->bias,
+                       &conv->output_dims, activations[op->output], &conv->params, &quant_data,
+                       activations[op->add_input], &op->add_params);
+#else
+    conv_2d(&op->conv);
+    tflite::ArithmeticParams params = { };
+    params.left_shift = op->add_params.left_shift;
+    params.input1_offset = op->add_params.input1_offset;
+    params.input1_multiplier = op->add_params.input1_mult;
+    params.input1_shift = op->add_params.input1_shift;
+    params.input2_offset = op->add_params.input2_offset;
+    params.input2_multiplier = op->add_params.input2_mult;
+    params.input2_shift = op->add_params.input2_shift;
+    params.output_offset = op->add_params.out_offset;
+    params.output_multiplier = op->add_params.out_mult;
+    params.output_shift = op->add_params.out_shift;
+    params.quantized_activation_min = op->add_params.activation.min;
+    params.quantized_activation_max = op->add_params.activation.max;
+    const data_dims_t *dims = &op->conv.output_dims;
+    const int32_t size = dims->width * dims->height * dims->channels;
+    const tflite::RuntimeShape flat(1, &size);
+    tflite::reference_integer_ops::Add(params, flat, activations[op->conv.output], flat,
+                                       activations[op->add_input], flat, activations[op->output]);
+#endif
+}
+
+""",
+    OP_DEPTHWISE_CONV_2D: """\
+void depthwise_conv_2d(const depthwise_conv_2d_t *op)
+{
+#if ESP_NN
+    const quant_data_t quant_data = { (int32_t*)op->shift, (int32_t*)op->mult };
+    esp_nn_set_depthwise_conv_scratch_buf(scratch_buffer);
+    esp_nn_depthwise_conv_s8(&op->input_dims, activations[op->input], &op->filter_dims, op->filter, op->bias,
+                             &op->output_dims, activations[op->output], &op->params, &quant_data);
+#else
+    tflite::DepthwiseParams params = { };
+    params.input_offset = op->params.in_offset;
+    params.output_offset = op->params.out_offset;
+    params.depth_multiplier = op->params.ch_mult;
+    params.stride_width = op->params.stride.width;
+    params.stride_height = op->params.stride.height;
+    params.dilation_width_factor = 1;
+    params.dilation_height_factor = 1;
+    params.padding_values.width = op->params.padding.width;
+    params.padding_values.height = op->params.padding.height;
+    params.quantized_activation_min = op->params.activation.min;
+    params.quantized_activation_max = op->params.activation.max;
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        params, op->mult, op->shift,
+        shape(1, op->input_dims.height, op->input_dims.width, op->input_dims.channels), activations[op->input],
+        shape(1, op->filter_dims.height, op->filter_dims.width, op->output_dims.channels),
+        op->filter, tflite::RuntimeShape(1, &op->output_dims.channels), op->bias,
+        shape(1, op->output_dims.height, op->output_dims.width, op->output_dims.channels), activations[op->output]);
+#endif
+}
+
+""",
+    OP_ADD: """\
+void add(const add_t *op)
+{
+#if ESP_NN
+    esp_nn_add_elementwise_s8(activations[op->input1], activations[op->input2],
+                              op->input1_offset, op->input2_offset,
+                              op->input1_multiplier, op->input2_multiplier,
+                              op->input1_shift, op->input2_shift, op->left_shift,
+                              activations[op->output], op->output_offset,
+                              op->output_multiplier, op->output_shift,
+                              op->activation_min, op->activation_max, op->size);
+#else
+    tflite::ArithmeticParams params = { };
+    params.left_shift = op->left_shift;
+    params.input1_offset = op->input1_offset;
+    params.input1_multiplier = op->input1_multiplier;
+    params.input1_shift = op->input1_shift;
+    params.input2_offset = op->input2_offset;
+    params.input2_multiplier = op->input2_multiplier;
+    params.input2_shift = op->input2_shift;
+    params.output_offset = op->output_offset;
+    params.output_multiplier = op->output_multiplier;
+    params.output_shift = op->output_shift;
+    params.quantized_activation_min = op->activation_min;
+    params.quantized_activation_max = op->activation_max;
+    const tflite::RuntimeShape flat(1, &op->size);
+    tflite::reference_integer_ops::Add(params, flat, activations[op->input1], flat, activations[op->input2],
+                                       flat, activations[op->output]);
+#endif
+}
+
+""",
+    OP_PAD: """\
+// only the border is written with the pad value, the rows of the input are copied
+void pad(const pad_t *op)
+{
+    const int8_t *input = activations[op->input];
+    int8_t *output = activations[op->output];
+    const size_t input_row = (size_t)op->input_width * op->channels;
+    const size_t output_row = (size_t)op->output_width * op->channels;
+    const size_t left = (size_t)op->left * op->channels;
+    const size_t right = output_row - left - input_row;
+
+    memset(output, op->value, op->top * output_row);
+    output += op->top * output_row;
+    for (int32_t y = 0; y < op->input_height; y++) {
+        memset(output, op->value, left);
+        memcpy(output + left, input, input_row);
+        memset(output + left + input_row, op->value, right);
+        input += input_row;
+        output += output_row;
+    }
+    memset(output, op->value, op->bottom * output_row);
+}
+
+""",
+    OP_SOFTMAX: """\
+void softmax(const softmax_t *op)
+{
+#if ESP_NN
+    esp_nn_set_softmax_scratch_buf(scratch_buffer);
+    esp_nn_softmax_s8(activations[op->input], op->outer_size, op->depth, op->input_multiplier,
+                      op->input_left_shift, op->diff_min, activations[op->output]);
+#else
+    tflite::SoftmaxParams params = { };
+    params.input_multiplier = op->input_multiplier;
+    params.input_left_shift = op->input_left_shift;
+    params.diff_min = op->diff_min;
+    const int32_t dims[2] = { op->outer_size, op->depth };
+    const tflite::RuntimeShape shape(2, dims);
+    tflite::reference_ops::Softmax(params, shape, activations[op->input], shape, activations[op->output]);
+#endif
+}
+
+""",
+}
+
+RUNTIME_END = """\
+TfLiteStatus fill_tensor(int index, TfLiteTensor *tensor)
+{
+    if (index < 0 || index >= TENSORS_SIZE || activations[index] == nullptr) {
+        return kTfLiteError;
+    }
+    const tensor_info_t *info = &tensor_info[index];
+    memset(tensor, 0, sizeof(TfLiteTensor));
+    tensor->type = kTfLiteInt8;
+    tensor->data.int8 = activations[index];
+    tensor->dims = (TfLiteIntArray*)&info->dims;
+    tensor->params.scale = info->scale;
+    tensor->params.zero_point = info->zero_point;
+    tensor->bytes = info->bytes;
+    tensor->allocation_type = kTfLiteArenaRw;
+    return kTfLiteOk;
+}
+
+} // namespace
+"""
+
+
+def emit_header(name, source):
+    return HEADER_TEMPLATE.format(name=name, guard=name.upper(), source=source)
+
+
+def emit_source(name, source, tensors, planned, operators, inputs, outputs, main, fast, flat):
+    out = [f"// Generated by tools/aot_compile.py from {source}, do not edit\n"]
+    out.append(f"#include \"{name}_compiled.h\"\n")
+    out.append("""#include <string.h>
+#include "edge-impulse-sdk/classifier/ei_classifier_config.h"
+#include "edge-impulse-sdk/classifier/ei_profiling.h"
+#include "edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn.h"
+#if !ESP_NN
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/softmax.h"
+#endif
+
+""")
+    out.append(KERNELS)
+    out.append(f"\n#define TENSORS_SIZE                                {len(tensors)}\n")
+    out.append(f"#define OPERATORS_SIZE                              {len(operators)}\n\n")
+
+    # weights, biases and folded quantization parameters
+    used = sorted({t for op in operators if op.code in (OP_CONV_2D, OP_DEPTHWISE_CONV_2D, OP_CONV_2D_ADD)
+                   for t in op.inputs[1:3] if t >= 0})
+    for index in used:
+        tensor = tensors[index]
+        ctype, fmt = ("const int8_t", "b") if tensor.type == TYPE_INT8 else ("const int32_t", "i")
+        out.append(f"// {tensor.name}\n")
+        out.append(c_array(ctype, f"tensor_data{index}", tensor.values(fmt), align=True))
+        out.append("\n")
+    for op in operators:
+        for ctype, array, values in op.arrays:
+            out.append(c_array(ctype, array, values))
+            out.append("\n")
+
+    out.append("static const tensor_info_t tensor_info[TENSORS_SIZE] = {\n")
+    planned_indexes = {t.index for t in planned}
+    for tensor in tensors:
+        if tensor.index not in planned_indexes:
+            out.append(f"    {{ 0, 0.0f, 0, {{ 0, {{ }} }} }}, // {tensor.index} constant\n")
+            continue
+        if tensor.type != TYPE_INT8 or len(tensor.shape) > 4:
+            raise ValueError(f"tensor {tensor.index} ({tensor.name}): only int8 activations are supported")
+        dims = ", ".join(str(d) for d in tensor.shape)
+        size = 1
+        for dim in tensor.shape:
+            size *= dim
+        out.append(f"    {{ {size}, {tensor.scale!r}f, {tensor.zero_point}, "
+                   f"{{ {len(tensor.shape)}, {{ {dims} }} }} }}, // {tensor.index} {tensor.name}\n")
+    out.append("};\n\n")
+
+    def placements(main_offsets, fast_offsets):
+        lines = []
+        for tensor in sorted(planned, key=lambda t: t.index):
+            in_fast = fast_offsets[tensor.index] != ONLINE_PLANNED
+            offset = fast_offsets[tensor.index] if in_fast else main_offsets[tensor.index]
+            lines.append(f"    {{ {tensor.index}, {int(in_fast)}, {offset} }},\n")
+        return "static const tensor_placement_t placements[] = {\n" + "".join(lines) + "};\n"
+
+    fast_used = arena_size(planned, fast)
+    if fast_used > 0:
+        # the offline plan of the fast arena is only used when the arena is large enough,
+        # otherwise every activation goes to the main arena like the interpreter falls back
+        out.append(f"#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE >= {fast_used}\n")
+        out.append(f"#define MAIN_ARENA_SIZE                             {arena_size(planned, main)}\n")
+        out.append(f"#define FAST_ARENA_USED                             {fast_used}\n")
+        out.append(placements(main, fast))
+        sizes = {t.index: t.size for t in planned}
+        fast_bytes = [sum(sizes[t] for t in op.inputs + op.outputs if t >= 0 and fast[t] != ONLINE_PLANNED)
+                      for op in operators]
+        out.append("// bytes of the activations of every operator in the fast arena\n")
+        out.append(c_array("const uint32_t", "operator_fast_bytes", fast_bytes))
+        out.append("#else\n")
+    out.append(f"#define MAIN_ARENA_SIZE                             {arena_size(planned, flat)}\n")
+    out.append("#define FAST_ARENA_USED                             0\n")
+    out.append(placements(flat, [ONLINE_PLANNED] * len(tensors)))
+    if fast_used > 0:
+        out.append("#endif\n")
+    out.append("\n")
+
+    # operator constants
+    type_names = {OP_CONV_2D: "conv_2d_t", OP_DEPTHWISE_CONV_2D: "depthwise_conv_2d_t",
+                  OP_ADD: "add_t", OP_PAD: "pad_t", OP_SOFTMAX: "softmax_t", OP_CONV_2D_ADD: "conv_2d_add_t"}
+
+    # a field of a nested struct is a list of fields
+    def initializer(fields, indent):
+        lines = []
+        for value, field in fields:
+            if isinstance(value, list):
+                lines.append(f"{indent}{{ // {field}\n")
+                lines.extend(initializer(value, indent + "    "))
+                lines.append(f"{indent}}},\n")
+            else:
+                lines.append(f"{indent}{value}, // {field}\n")
+        return lines
+
+    for op in operators:
+        names = " ".join(tensors[t].name for t in op.outputs)
+        out.append(f"// {op.index}: {op.name} {names}\n")
+        out.append(f"static const {type_names[op.code]} operator_{op.index} = {{\n")
+        out.extend(initializer(op.fields, "    "))
+        out.append("};\n\n")
+    out.append("static const char *const operator_names[OPERATORS_SIZE] = {\n")
+    for op in operators:
+        out.append(f"    \"{op.name}\",\n")
+    out.append("};\n\n")
+    # fused operators are recorded under the index of their first operator in the model
+    out.append(c_array("const uint16_t", "operator_indexes", [op.index for op in operators]))
+    out.append("\n")
+    out.append(c_array("const uint8_t", "operator_outputs", [op.outputs[0] for op in operators]))
+    out.append("\n")
+
+    out.append(RUNTIME_BEGIN)
+    codes = set(op.code for op in operators)
+    if OP_CONV_2D_ADD in codes:
+        # the reference kernels run the convolution of the fused operator on its own
+        codes.add(OP_CONV_2D)
+    for code in sorted(codes, key=list(OPERATOR_FUNCTIONS).index):
+        out.append(OPERATOR_FUNCTIONS[code])
+    out.append(RUNTIME_END)
+    out.append("\n")
+
+    # init: scratch buffer size of the kernels of this build, arena and activation pointers
+    out.append(f"TfLiteStatus {name}_init(void*(*alloc_fnc)(size_t, size_t))\n{{\n")
+    out.append("    size_t scratch_size = 0;\n#if ESP_NN\n    int size;\n")
+    for op in operators:
+        ref = f"operator_{op.index}"
+        if op.code == OP_CONV_2D:
+            call = (f"esp_nn_get_conv_scratch_size(&{ref}.input_dims, &{ref}.filter_dims, "
+                    f"&{ref}.output_dims, &{ref}.params)")
+        elif op.code == OP_CONV_2D_ADD:
+            call = (f"esp_nn_get_conv_add_scratch_size(&{ref}.conv.input_dims, &{ref}.conv.filter_dims, "
+                    f"&{ref}.conv.output_dims, &{ref}.conv.params)")
+        elif op.code == OP_DEPTHWISE_CONV_2D:
+            call = (f"esp_nn_get_depthwise_conv_scratch_size(&{ref}.input_dims, &{ref}.filter_dims, "
+                    f"&{ref}.output_dims, &{ref}.params)")
+        elif op.code == OP_SOFTMAX:
+            call = f"esp_nn_get_softmax_scratch_size({ref}.scratch_width, {ref}.scratch_height)"
+        else:
+            continue
+        out.append(f"    size = {call};\n")
+        out.append("    scratch_size = size > (int)scratch_size ? (size_t)size : scratch_size;\n")
+    out.append("#endif\n")
+    out.append("""    scratch_size = (scratch_size + 15) & ~(size_t)15;
+
+    // scratch buffer after the activations of the fast arena when it fits, of the main one otherwise
+    bool scratch_in_fast_arena = false;
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+    scratch_in_fast_arena = scratch_size > 0 && FAST_ARENA_USED + scratch_size <= EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE;
+#endif
+    const size_t main_size = MAIN_ARENA_SIZE + (scratch_in_fast_arena ? 0 : scratch_size);
+    // the arena is kept until reset, a second init only binds the activations to it again
+    if (main_arena == nullptr) {
+        main_arena = (uint8_t*)alloc_fnc(16, main_size);
+        if (main_arena == nullptr) {
+            return kTfLiteError;
+        }
+    }
+    scratch_buffer = nullptr;
+    if (scratch_size > 0) {
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+        scratch_buffer = scratch_in_fast_arena ? fast_arena + FAST_ARENA_USED : main_arena + MAIN_ARENA_SIZE;
+#else
+        scratch_buffer = main_arena + MAIN_ARENA_SIZE;
+#endif
+    }
+
+    memset(activations, 0, sizeof(activations));
+    for (size_t ix = 0; ix < sizeof(placements) / sizeof(placements[0]); ix++) {
+        const tensor_placement_t *placement = &placements[ix];
+#if EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE > 0
+        uint8_t *arena = placement->fast ? fast_arena : main_arena;
+#else
+        uint8_t *arena = main_arena;
+#endif
+        activations[placement->tensor] = (int8_t*)(arena + placement->offset);
+    }
+
+#if EI_CLASSIFIER_PROFILING == 1
+    ei_profiling_record(EI_PROFILING_MEMORY, "tflite_arena", 0, (uint32_t)main_size);
+#if FAST_ARENA_USED > 0
+    ei_profiling_record(EI_PROFILING_MEMORY, "fast_arena", 0,
+        (uint32_t)(FAST_ARENA_USED + (scratch_in_fast_arena ? scratch_size : 0)));
+    // memory tier of every operator, to split its latency by tier in tools/profile_report.py
+    for (size_t ix = 0; ix < OPERATORS_SIZE; ix++) {
+        ei_profiling_record(EI_PROFILING_TIER, "fast_arena", operator_indexes[ix], operator_fast_bytes[ix]);
+    }
+#endif
+#endif
+    return kTfLiteOk;
+}
+
+""")
+    out.append(f"""TfLiteStatus {name}_input(int index, TfLiteTensor* tensor)
+{{
+    static const int inputs[] = {{ {", ".join(str(i) for i in inputs)} }};
+    if (index < 0 || index >= (int)(sizeof(inputs) / sizeof(inputs[0]))) {{
+        return kTfLiteError;
+    }}
+    return fill_tensor(inputs[index], tensor);
+}}
+
+TfLiteStatus {name}_output(int index, TfLiteTensor* tensor)
+{{
+    static const int outputs[] = {{ {", ".join(str(i) for i in outputs)} }};
+    if (index < 0 || index >= (int)(sizeof(outputs) / sizeof(outputs[0]))) {{
+        return kTfLiteError;
+    }}
+    return fill_tensor(outputs[index], tensor);
+}}
+
+TfLiteStatus {name}_tensor(int index, TfLiteTensor* tensor)
+{{
+    return fill_tensor(index, tensor);
+}}
+
+size_t {name}_operators_size()
+{{
+    return OPERATORS_SIZE;
+}}
+
+int {name}_operator_output(size_t index)
+{{
+    return index < OPERATORS_SIZE ? operator_outputs[index] : -1;
+}}
+
+TfLiteStatus {name}_invoke_operator(size_t index)
+{{
+    if (main_arena == nullptr) {{
+        return kTfLiteError;
+    }}
+    switch (index) {{
+""")
+    calls = {OP_CONV_2D: "conv_2d", OP_DEPTHWISE_CONV_2D: "depthwise_conv_2d", OP_ADD: "add",
+             OP_PAD: "pad", OP_SOFTMAX: "softmax", OP_CONV_2D_ADD: "conv_2d_add"}
+    for position, op in enumerate(operators):
+        out.append(f"        case {position}: {calls[op.code]}(&operator_{op.index}); break;\n")
+    out.append(f"""        default: return kTfLiteError;
+    }}
+    return kTfLiteOk;
+}}
+
+TfLiteStatus {name}_invoke()
+{{
+    for (size_t ix = 0; ix < OPERATORS_SIZE; ix++) {{
+        const uint32_t start = ei_profiling_cycles();
+        TfLiteStatus status = {name}_invoke_operator(ix);
+        if (status != kTfLiteOk) {{
+            return status;
+        }}
+        ei_profiling_record(EI_PROFILING_OP, operator_names[ix], operator_indexes[ix], ei_profiling_cycles() - start);
+    }}
+    return kTfLiteOk;
+}}
+
+TfLiteStatus {name}_reset(void (*free)(void* ptr))
+{{
+    if (main_arena != nullptr) {{
+        free(main_arena);
+    }}
+    main_arena = nullptr;
+    scratch_buffer = nullptr;
+    memset(activations, 0, sizeof(activations));
+    return kTfLiteOk;
+}}
+""")
+    return "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile the model into a static C++ executor")
+    parser.add_argument("model", nargs="?", default=memory_plan.DEFAULT_HEADER,
+                        help="model header of the Edge Impulse export or a .tflite file")
+    parser.add_argument("--name", help="prefix of the functions and files, the model array name by default")
+    parser.add_argument("-o", "--output", default=DEFAULT_OUTPUT, help="directory of the generated files")
+    args = parser.parse_args()
+
+    model, text = memory_plan.read_model(args.model)
+    name = args.name
+    if name is None:
+        match = memory_plan.ARRAY_RE.search(text) if text else None
+        name = match.group(2) if match else os.path.splitext(os.path.basename(args.model))[0]
+    fb = FlatBuffer(bytearray(model))
+    fusions = residual_fusions(fb)
+    planned, all_tensors = memory_plan.read_tensors(fb, fusions)
+    if len(all_tensors) > 255:
+        raise ValueError("models with more than 255 tensors are not supported")
+
+    subgraph = fb.table_vector(fb.root(), MODEL_SUBGRAPHS)[0]
+    buffers = fb.table_vector(fb.root(), memory_plan.MODEL_BUFFERS)
+    tensors = [ModelTensor(fb, i, table, buffers)
+               for i, table in enumerate(fb.table_vector(subgraph, memory_plan.SUBGRAPH_TENSORS))]
+    operators, inputs, outputs = read_operators(fb, tensors, fusions)
+
+    main_offsets, fast_offsets = read_layout(fb, planned, all_tensors)
+    check_fusions(operators, planned, main_offsets, fast_offsets)
+    # every activation in the main arena, when the fast arena is too small for its plan
+    memory_plan.plan(planned)
+    flat = [ONLINE_PLANNED] * len(all_tensors)
+    for tensor in planned:
+        flat[tensor.index] = tensor.offset
+
+    source = os.path.basename(args.model)
+    header_path = os.path.join(args.output, f"{name}_compiled.h")
+    source_path = os.path.join(args.output, f"{name}_compiled.cpp")
+    with open(header_path, "w") as f:
+        f.write(emit_header(name, source))
+    with open(source_path, "w") as f:
+        f.write(emit_source(name, source, tensors, planned, operators, inputs, outputs,
+                            main_offsets, fast_offsets, flat))
+
+    fast_used = arena_size(planned, fast_offsets)
+    print(f"{len(operators)} operators ({len(fusions)} residual Adds fused), {len(planned)} activations")
+    print(f"main arena {arena_size(planned, main_offsets)} B + fast arena {fast_used} B, "
+          f"{arena_size(planned, flat)} B without the fast arena (plus kernel scratch)")
+    print(f"{header_path}\n{source_path}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,192 @@
+//author: Stepan Vondracek (xvondr27)
+// Host benchmark of the inference pipeline of the photo trap
+// Every fixture goes through the same steps as a burst frame on P4 (camera_capture_frame):
+// centre crop to the aspect ratio of the model input, then run_classifier_image() which
+// area-resizes, quantizes, runs TFLite Micro and decodes the FOMO output.
+// Fixtures are binary PPM (P6) RGB images of any size, e.g. `magick photo.jpg photo.ppm`.
+// Without fixtures, synthetic 1280x720 frames are used so the numbers are still reproducible.
+#include <algorithm>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "edge-impulse-sdk/classifier/ei_profiling.h"
+#include "fixtures.h"
+
+static bool append_export(const void *data, size_t size, void *ctx)
+{
+    std::vector<uint8_t> *out = (std::vector<uint8_t> *)ctx;
+    out->insert(out->end(), (const uint8_t *)data, (const uint8_t *)data + size);
+    return true;
+}
+
+typedef struct {
+    std::map<std::string, std::vector<uint32_t>> stages_us;
+    std::map<std::string, uint32_t> memory_max;
+    std::map<std::string, uint64_t> op_cycles;
+    uint32_t cycles_per_second = 1;
+} samples_t;
+
+// move the records of one inference from the profiling ring to samples
+static void collect_records(samples_t *samples)
+{
+    std::vector<uint8_t> data;
+    ei_profiling_export(append_export, &data);
+    ei_profiling_reset();
+
+    ei_profiling_header_t header;
+    memcpy(&header, data.data(), sizeof(header));
+    samples->cycles_per_second = header.cycles_per_second;
+    if (header.dropped > 0) {
+        printf("ERR: %u profiling records were dropped\n", (unsigned)header.dropped);
+    }
+
+    std::vector<std::string> tags;
+    const uint8_t *p = data.data() + sizeof(header);
+    for (uint16_t ix = 0; ix < header.tag_count; ix++, p += header.tag_size) {
+        tags.emplace_back((const char *)p, strnlen((const char *)p, header.tag_size));
+    }
+
+    for (uint32_t ix = 0; ix < header.record_count; ix++, p += sizeof(ei_profiling_record_t)) {
+        ei_profiling_record_t r;
+        memcpy(&r, p, sizeof(r));
+        std::string tag = r.tag < tags.size() ? tags[r.tag] : "?";
+        if (r.kind == EI_PROFILING_OP) {
+            samples->op_cycles[tag] += r.value;
+        }
+        else if (r.kind == EI_PROFILING_STAGE) {
+            samples->stages_us[tag].push_back(r.value);
+        }
+        else if (r.kind == EI_PROFILING_MEMORY) {
+            samples->memory_max[tag] = std::max(samples->memory_max[tag], r.value);
+        }
+    }
+}
+
+static double percentile_ms(const std::vector<uint32_t> &sorted, double p)
+{
+    size_t ix = (size_t)(p / 100.0 * (sorted.size() - 1) + 0.5);
+    return sorted[ix] / 1000.0;
+}
+
+static void print_detections(const fixture_t &fixture, const ei_impulse_result_t *result)
+{
+    printf("%s (%u x %u): %u objects\n", fixture.name.c_str(), (unsigned)fixture.width,
+           (unsigned)fixture.height, (unsigned)result->bounding_boxes_count);
+    for (uint32_t ix = 0; ix < result->bounding_boxes_count; ix++) {
+        const ei_impulse_result_bounding_box_t *bb = &result->bounding_boxes[ix];
+        if (bb->value == 0) {
+            continue;
+        }
+        printf("    %s (%.5f) [ x: %u, y: %u, width: %u, height: %u ]\n", bb->label, bb->value,
+               (unsigned)bb->x, (unsigned)bb->y, (unsigned)bb->width, (unsigned)bb->height);
+    }
+}
+
+static void usage(const char *name)
+{
+    printf("usage: %s [-n iterations] [-w warmup] [fixture.ppm | fixture_dir]...\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    int iterations = 20;
+    int warmup = 2;
+    std::vector<fixture_t> fixtures;
+    for (int i = 1; i < argc; i++) {
+        if ((strcmp(argv[i], "-n") == 0 || strcmp(argv[i], "-w") == 0) && i + 1 < argc) {
+            int value = atoi(argv[i + 1]);
+            if (argv[i][1] == 'n') {
+                iterations = std::max(value, 1);
+            }
+            else {
+                warmup = std::max(value, 0);
+            }
+            i++;
+        }
+        else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 1;
+        }
+        else if (!load_fixtures(argv[i], &fixtures)) {
+            return 1;
+        }
+    }
+    if (fixtures.empty()) {
+        printf("No fixtures given, using %d synthetic %u x %u frames\n", SYNTHETIC_FRAME_COUNT,
+               SYNTHETIC_FRAME_COLS, SYNTHETIC_FRAME_ROWS);
+        make_synthetic_fixtures(&fixtures);
+    }
+
+    samples_t samples;
+    printf("Detections:\n");
+    for (const fixture_t &fixture : fixtures) {
+        for (int run = 0; run < warmup + iterations; run++) {
+            ei_profiling_reset();
+            uint64_t start_us = ei_read_timer_us();
+
+            ei::image_signal_t image;
+            image.buffer = fixture.rgb.data();
+            image.width = fixture.width;
+            image.height = fixture.height;
+            image.stride = fixture.width * 3;
+            image.channels = 3;
+            image.bgr = false;
+            crop_image_signal(&image, EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT);
+            ei_profiling_record_stage("crop", start_us);
+
+            ei_impulse_result_t result = { };
+            EI_IMPULSE_ERROR res = run_classifier_image(&image, &result, false);
+            if (res != EI_IMPULSE_OK) {
+                printf("ERR: Failed to run classifier on %s (%d)\n", fixture.name.c_str(), res);
+                return 1;
+            }
+            ei_profiling_record_stage("total", start_us);
+
+            if (run == 0) {
+                print_detections(fixture, &result);
+            }
+            if (run < warmup) {
+                ei_profiling_reset();
+                continue;
+            }
+            collect_records(&samples);
+        }
+    }
+    run_classifier_deinit();
+
+    printf("\n%d fixtures x %d iterations (%d warm-up)\n", (int)fixtures.size(), iterations, warmup);
+    printf("%-14s %8s %9s %9s %9s %9s %9s\n", "stage", "count", "mean ms", "p50 ms", "p90 ms", "p99 ms", "max ms");
+    for (auto &stage : samples.stages_us) {
+        std::vector<uint32_t> &v = stage.second;
+        std::sort(v.begin(), v.end());
+        double sum = 0;
+        for (uint32_t us : v) {
+            sum += us;
+        }
+        printf("%-14s %8u %9.3f %9.3f %9.3f %9.3f %9.3f\n", stage.first.c_str(), (unsigned)v.size(),
+               sum / v.size() / 1000.0, percentile_ms(v, 50), percentile_ms(v, 90), percentile_ms(v, 99),
+               v.back() / 1000.0);
+    }
+
+    uint64_t total_cycles = 0;
+    for (auto &op : samples.op_cycles) {
+        total_cycles += op.second;
+    }
+    printf("\n%-20s %12s %7s\n", "operator", "ms / frame", "share");
+    size_t frames = fixtures.size() * iterations;
+    for (auto &op : samples.op_cycles) {
+        printf("%-20s %12.3f %6.1f%%\n", op.first.c_str(),
+               (double)op.second / samples.cycles_per_second * 1000.0 / frames,
+               total_cycles ? 100.0 * op.second / total_cycles : 0.0);
+    }
+
+    printf("\n%-20s %12s\n", "memory", "max bytes");
+    for (auto &memory : samples.memory_max) {
+        printf("%-20s %12u\n", memory.first.c_str(), (unsigned)memory.second);
+    }
+    return 0;
+}
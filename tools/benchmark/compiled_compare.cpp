@@ -0,0 +1,189 @@
+//author: Stepan Vondracek (xvondr27)
+// Equivalence check of the ahead-of-time compiled model (tools/aot_compile.py) with TFLite Micro
+// Every fixture is cropped and quantized like run_classifier_image() does it, then run through
+// the interpreter and through the compiled executor one operator at a time. The output of every
+// operator has to match the interpreter bit by bit, the first difference is reported. A fused
+// operator of the executor is compared with the operator of the model writing the same tensor.
+// Without fixtures, the synthetic frames of photo_trap_benchmark are used.
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_interpreter.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_mutable_op_resolver.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_profiler_interface.h"
+#include "tflite-model/tflite-resolver.h"
+#include "tflite-model/tflite_learn_27.h"
+#include "tflite-model/tflite_learn_27_compiled.h"
+#include "fixtures.h"
+
+// the arena of the export plus the tensor structs the check asks for
+#define INTERPRETER_ARENA_SIZE      (tflite_learn_27_arena_size + 32768)
+
+// copies the output of every operator before the next one can overwrite it in the arena
+class OutputRecorder : public tflite::MicroProfilerInterface {
+public:
+    std::vector<const TfLiteTensor*> outputs;
+    std::vector<std::vector<int8_t>> data;
+
+    uint32_t BeginEvent(const char *tag) override {
+        return (uint32_t)data.size();
+    }
+
+    void EndEvent(uint32_t event_handle) override {
+        const TfLiteTensor *tensor = outputs[event_handle];
+        data.emplace_back(tensor->data.int8, tensor->data.int8 + tensor->bytes);
+    }
+};
+
+static void usage(const char *name)
+{
+    printf("usage: %s [fixture.ppm | fixture_dir]...\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<fixture_t> fixtures;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 1;
+        }
+        if (!load_fixtures(argv[i], &fixtures)) {
+            return 1;
+        }
+    }
+    if (fixtures.empty()) {
+        printf("No fixtures given, using %d synthetic %u x %u frames\n", SYNTHETIC_FRAME_COUNT,
+               SYNTHETIC_FRAME_COLS, SYNTHETIC_FRAME_ROWS);
+        make_synthetic_fixtures(&fixtures);
+    }
+
+    EI_TFLITE_RESOLVER
+    const tflite::Model *model = tflite::GetModel(tflite_learn_27);
+    const auto *operators = model->subgraphs()->Get(0)->operators();
+    std::vector<uint8_t> arena(INTERPRETER_ARENA_SIZE + 16);
+    uint8_t *aligned_arena = (uint8_t*)(((uintptr_t)arena.data() + 15) & ~(uintptr_t)15);
+
+    OutputRecorder recorder;
+    uint64_t start_us = ei_read_timer_us();
+    tflite::MicroInterpreter interpreter(model, resolver, aligned_arena, INTERPRETER_ARENA_SIZE,
+                                         nullptr, &recorder);
+    if (interpreter.AllocateTensors(true) != kTfLiteOk) {
+        printf("ERR: AllocateTensors() failed\n");
+        return 1;
+    }
+    uint64_t interpreter_init_us = ei_read_timer_us() - start_us;
+    // tensor() allocates the struct, so only ask before Invoke()
+    std::vector<int> output_index;
+    for (size_t ix = 0; ix < operators->size(); ix++) {
+        output_index.push_back(operators->Get(ix)->outputs()->Get(0));
+        recorder.outputs.push_back(interpreter.tensor(output_index.back()));
+    }
+    TfLiteTensor *interpreter_input = interpreter.input(0);
+
+    start_us = ei_read_timer_us();
+    if (tflite_learn_27_init(ei_aligned_calloc) != kTfLiteOk) {
+        printf("ERR: Failed to initialize the compiled model\n");
+        return 1;
+    }
+    uint64_t compiled_init_us = ei_read_timer_us() - start_us;
+    // operator of the model whose output every compiled operator writes
+    const size_t compiled_size = tflite_learn_27_operators_size();
+    std::vector<size_t> model_op;
+    for (size_t ix = 0; ix < compiled_size; ix++) {
+        const int tensor = tflite_learn_27_operator_output(ix);
+        size_t op = 0;
+        while (op < operators->size() && output_index[op] != tensor) {
+            op++;
+        }
+        if (op == operators->size()) {
+            printf("ERR: Compiled operator %u writes tensor %d, no operator of the model does\n",
+                   (unsigned)ix, tensor);
+            return 1;
+        }
+        model_op.push_back(op);
+    }
+    if (compiled_size < operators->size()) {
+        printf("The compiled model fuses %u operators into %u\n", (unsigned)operators->size(),
+               (unsigned)compiled_size);
+    }
+    TfLiteTensor compiled_input;
+    tflite_learn_27_input(0, &compiled_input);
+
+    const ei_impulse_t *impulse = ei_default_impulse.impulse;
+    uint64_t interpreter_us = 0, compiled_us = 0;
+    int failures = 0;
+    for (const fixture_t &fixture : fixtures) {
+        ei::image_signal_t image;
+        image.buffer = fixture.rgb.data();
+        image.width = fixture.width;
+        image.height = fixture.height;
+        image.stride = fixture.width * 3;
+        image.channels = 3;
+        image.bgr = false;
+        crop_image_signal(&image, EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT);
+
+        ei::matrix_i8_t features(1, impulse->nn_input_frame_size, interpreter_input->data.int8);
+        int ret = extract_image_features_quantized_resized(&image, impulse->input_width, impulse->input_height,
+            &features, impulse->dsp_blocks[0].config, interpreter_input->params.scale,
+            interpreter_input->params.zero_point, impulse->learning_blocks[0].image_scaling);
+        if (ret != EIDSP_OK) {
+            printf("ERR: Failed to quantize %s (%d)\n", fixture.name.c_str(), ret);
+            return 1;
+        }
+        memcpy(compiled_input.data.int8, interpreter_input->data.int8, compiled_input.bytes);
+
+        recorder.data.clear();
+        start_us = ei_read_timer_us();
+        if (interpreter.Invoke() != kTfLiteOk) {
+            printf("ERR: Invoke() failed on %s\n", fixture.name.c_str());
+            return 1;
+        }
+        interpreter_us += ei_read_timer_us() - start_us;
+
+        int first_mismatch = -1;
+        for (size_t ix = 0; ix < compiled_size; ix++) {
+            const size_t op = model_op[ix];
+            start_us = ei_read_timer_us();
+            if (tflite_learn_27_invoke_operator(ix) != kTfLiteOk) {
+                printf("ERR: Compiled operator %u failed on %s\n", (unsigned)ix, fixture.name.c_str());
+                return 1;
+            }
+            compiled_us += ei_read_timer_us() - start_us;
+
+            TfLiteTensor output;
+            if (tflite_learn_27_tensor(output_index[op], &output) != kTfLiteOk
+                    || output.bytes != recorder.data[op].size()) {
+                printf("ERR: Compiled operator %u has no output like tensor %d\n", (unsigned)ix, output_index[op]);
+                return 1;
+            }
+            if (first_mismatch < 0 && memcmp(output.data.int8, recorder.data[op].data(), output.bytes) != 0) {
+                first_mismatch = (int)op;
+                size_t byte = 0;
+                while (output.data.int8[byte] == recorder.data[op][byte]) {
+                    byte++;
+                }
+                printf("%s: operator %u (tensor %d) differs at byte %u, compiled %d, interpreter %d\n",
+                       fixture.name.c_str(), (unsigned)op, output_index[op], (unsigned)byte,
+                       output.data.int8[byte], recorder.data[op][byte]);
+            }
+        }
+        if (first_mismatch < 0) {
+            printf("%s: %u operators match\n", fixture.name.c_str(), (unsigned)compiled_size);
+        }
+        else {
+            failures++;
+        }
+    }
+    tflite_learn_27_reset(ei_aligned_free);
+
+    printf("\n%-12s %12s %16s\n", "", "init us", "invoke us / frame");
+    printf("%-12s %12u %16.0f\n", "interpreter", (unsigned)interpreter_init_us,
+           (double)interpreter_us / fixtures.size());
+    printf("%-12s %12u %16.0f\n", "compiled", (unsigned)compiled_init_us,
+           (double)compiled_us / fixtures.size());
+    printf("\n%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
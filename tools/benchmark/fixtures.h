@@ -0,0 +1,138 @@
+//author: Stepan Vondracek (xvondr27)
+// Input frames of the host tools: binary PPM (P6) fixtures or seeded synthetic frames,
+// centre cropped to the aspect ratio of the model input like camera_capture_frame does.
+#ifndef _BENCHMARK_FIXTURES_H_
+#define _BENCHMARK_FIXTURES_H_
+
+#include <algorithm>
+#include <dirent.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "edge-impulse-sdk/dsp/numpy_types.h"
+#include "edge-impulse-sdk/dsp/image/processing.hpp"
+
+#define SYNTHETIC_FRAME_COLS        1280
+#define SYNTHETIC_FRAME_ROWS        720
+#define SYNTHETIC_FRAME_COUNT       3
+
+typedef struct {
+    std::string name;
+    std::vector<uint8_t> rgb;
+    uint32_t width;
+    uint32_t height;
+} fixture_t;
+
+// read a binary PPM with maxval 255
+static bool load_ppm(const std::string &path, fixture_t *fixture)
+{
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f == NULL) {
+        printf("ERR: Can not open %s\n", path.c_str());
+        return false;
+    }
+
+    char magic[3] = { };
+    unsigned int width = 0, height = 0, maxval = 0;
+    bool ok = fscanf(f, "%2s", magic) == 1 && strcmp(magic, "P6") == 0;
+    // skip comments between the header fields
+    for (unsigned int *field : { &width, &height, &maxval }) {
+        int c;
+        while (ok && (c = fgetc(f)) != EOF) {
+            if (c == '#') {
+                while ((c = fgetc(f)) != EOF && c != '\n') { }
+            }
+            else if (c > ' ') {
+                ungetc(c, f);
+                break;
+            }
+        }
+        ok = ok && fscanf(f, "%u", field) == 1;
+    }
+    ok = ok && maxval == 255 && width > 0 && height > 0 && fgetc(f) != EOF;
+    if (!ok) {
+        printf("ERR: %s is not a binary PPM with maxval 255\n", path.c_str());
+        fclose(f);
+        return false;
+    }
+
+    fixture->name = path;
+    fixture->width = width;
+    fixture->height = height;
+    fixture->rgb.resize((size_t)width * height * 3);
+    ok = fread(fixture->rgb.data(), 1, fixture->rgb.size(), f) == fixture->rgb.size();
+    fclose(f);
+    if (!ok) {
+        printf("ERR: %s is truncated\n", path.c_str());
+    }
+    return ok;
+}
+
+// .ppm files of a directory in name order, or the file itself
+static bool load_fixtures(const std::string &path, std::vector<fixture_t> *fixtures)
+{
+    DIR *dir = opendir(path.c_str());
+    if (dir == NULL) {
+        fixtures->emplace_back();
+        return load_ppm(path, &fixtures->back());
+    }
+
+    std::vector<std::string> names;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".ppm") == 0) {
+            names.push_back(path + "/" + name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+
+    for (const std::string &name : names) {
+        fixtures->emplace_back();
+        if (!load_ppm(name, &fixtures->back())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// gradients with noise and a few bright blocks, seeded so every run classifies the same frames
+static void make_synthetic_fixtures(std::vector<fixture_t> *fixtures)
+{
+    uint32_t seed = 1;
+    for (int i = 0; i < SYNTHETIC_FRAME_COUNT; i++) {
+        fixture_t fixture;
+        fixture.name = "synthetic_" + std::to_string(i);
+        fixture.width = SYNTHETIC_FRAME_COLS;
+        fixture.height = SYNTHETIC_FRAME_ROWS;
+        fixture.rgb.resize(SYNTHETIC_FRAME_COLS * SYNTHETIC_FRAME_ROWS * 3);
+        for (uint32_t y = 0; y < SYNTHETIC_FRAME_ROWS; y++) {
+            for (uint32_t x = 0; x < SYNTHETIC_FRAME_COLS; x++) {
+                seed = seed * 1103515245 + 12345;
+                uint8_t *p = &fixture.rgb[(y * SYNTHETIC_FRAME_COLS + x) * 3];
+                bool block = ((x / 160 + y / 120 + i) % 5) == 0;
+                p[0] = (uint8_t)(block ? 230 : (x * 255 / SYNTHETIC_FRAME_COLS) ^ ((seed >> 16) & 31));
+                p[1] = (uint8_t)(block ? 200 : (y * 255 / SYNTHETIC_FRAME_ROWS) ^ ((seed >> 21) & 31));
+                p[2] = (uint8_t)(block ? 180 : ((x + y) * i) & 0xff);
+            }
+        }
+        fixtures->push_back(std::move(fixture));
+    }
+}
+
+// centre crop with the aspect ratio of the model input, as camera_crop_image_signal does
+static void crop_image_signal(ei::image_signal_t *image, uint32_t img_width, uint32_t img_height)
+{
+    int crop_width, crop_height;
+    ei::image::processing::calculate_crop_dims(image->width, image->height, img_width, img_height,
+                                               crop_width, crop_height);
+
+    image->buffer += ((image->height - crop_height) / 2) * image->stride +
+                     ((image->width - crop_width) / 2) * image->channels;
+    image->width = crop_width;
+    image->height = crop_height;
+}
+
+#endif // _BENCHMARK_FIXTURES_H_
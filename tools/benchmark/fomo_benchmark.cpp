@@ -0,0 +1,220 @@
+//author: Stepan Vondracek (xvondr27)
+// Benchmark of the int8 FOMO decoder (fill_result_struct_i8_fomo) on synthetic output tensors
+// Grids of several sizes with the output quantization of the model (softmax, zero point -128,
+// scale 1/256) are decoded with: no cell above the threshold (the usual empty scene), a few 2x2
+// objects (sparse) and a quarter of the cells of every class above it (dense). Each result is
+// checked against a flood fill of the same grid, boxes, cell counts and peaks have to match.
+// The time is the mean of the repetitions per call, the quantized threshold of the model is
+// timed separately, computed on every call and taken from the cache of ei_fomo_get_threshold_i8.
+// Built with EI_CLASSIFIER_FOMO_MAX_WIDTH / HEIGHT raised to the largest grid.
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+
+#define OUTPUT_ZERO_POINT           -128
+#define OUTPUT_SCALE                (1.0f / 256)
+// background score of an empty cell, the class channels share the rest
+#define BACKGROUND_SCORE            120
+
+typedef enum {
+    ACTIVATION_EMPTY,
+    ACTIVATION_SPARSE,
+    ACTIVATION_DENSE,
+} activation_t;
+
+static const char *const activation_names[] = { "empty", "sparse", "dense" };
+static const int grid_sizes[] = { 12, 24, 48 };
+
+static_assert(EI_CLASSIFIER_FOMO_MAX_WIDTH >= 48 && EI_CLASSIFIER_FOMO_MAX_HEIGHT >= 48,
+              "the largest grid does not fit the decoder");
+
+// blob of the flood fill reference
+typedef struct {
+    uint16_t label_ix;
+    uint32_t min_x, min_y, max_x, max_y;
+    uint32_t cell_count;
+    int8_t peak;
+} reference_blob_t;
+
+static std::vector<int8_t> make_output(int grid, size_t channels, activation_t activation, int8_t threshold_q,
+                                       uint32_t seed)
+{
+    std::vector<int8_t> output((size_t)grid * grid * channels);
+    for (size_t cell = 0; cell < (size_t)grid * grid; cell++) {
+        output[cell * channels] = BACKGROUND_SCORE;
+        for (size_t ix = 1; ix < channels; ix++) {
+            seed = seed * 1103515245 + 12345;
+            // below the threshold, noise so the sweep can not stop early
+            output[cell * channels + ix] = (int8_t)(OUTPUT_ZERO_POINT + (seed >> 16) % (threshold_q - OUTPUT_ZERO_POINT));
+        }
+    }
+
+    if (activation == ACTIVATION_SPARSE) {
+        // three 2x2 objects, the last two of the second class touch diagonally
+        const int objects[][3] = { { 1, grid / 4, grid / 4 }, { 2, grid / 2, grid / 2 }, { 2, grid / 2 + 2, grid / 2 + 2 } };
+        for (const auto &object : objects) {
+            for (int y = object[2]; y < object[2] + 2 && y < grid; y++) {
+                for (int x = object[1]; x < object[1] + 2 && x < grid; x++) {
+                    output[((size_t)y * grid + x) * channels + (object[0] % channels)] = (int8_t)(threshold_q + 20 + x);
+                }
+            }
+        }
+    }
+    else if (activation == ACTIVATION_DENSE) {
+        for (size_t cell = 0; cell < (size_t)grid * grid; cell++) {
+            for (size_t ix = 1; ix < channels; ix++) {
+                seed = seed * 1103515245 + 12345;
+                if ((seed >> 16) % 4 == 0) {
+                    output[cell * channels + ix] = (int8_t)(threshold_q + (seed >> 20) % (127 - threshold_q + 1));
+                }
+            }
+        }
+    }
+    return output;
+}
+
+// 8-connected flood fill of every class, blobs in raster order of their first cell like the decoder
+static std::vector<reference_blob_t> flood_fill(const std::vector<int8_t> &output, int grid, size_t channels,
+                                                int8_t threshold_q)
+{
+    std::vector<reference_blob_t> blobs;
+    std::vector<uint8_t> visited((size_t)grid * grid);
+    std::vector<int> stack;
+    for (size_t ix = 1; ix < channels; ix++) {
+        std::fill(visited.begin(), visited.end(), 0);
+        for (int start = 0; start < grid * grid; start++) {
+            if (visited[start] || output[start * channels + ix] < threshold_q) {
+                continue;
+            }
+            reference_blob_t blob = { (uint16_t)(ix - 1), (uint32_t)grid, (uint32_t)grid, 0, 0, 0, -128 };
+            visited[start] = 1;
+            stack.push_back(start);
+            while (!stack.empty()) {
+                int cell = stack.back();
+                stack.pop_back();
+                uint32_t x = cell % grid, y = cell / grid;
+                blob.min_x = std::min(blob.min_x, x);
+                blob.min_y = std::min(blob.min_y, y);
+                blob.max_x = std::max(blob.max_x, x);
+                blob.max_y = std::max(blob.max_y, y);
+                blob.cell_count++;
+                blob.peak = std::max(blob.peak, output[cell * channels + ix]);
+                for (int dy = -1; dy <= 1; dy++) {
+                    for (int dx = -1; dx <= 1; dx++) {
+                        int nx = (int)x + dx, ny = (int)y + dy;
+                        if (nx < 0 || ny < 0 || nx >= grid || ny >= grid) {
+                            continue;
+                        }
+                        int next = ny * grid + nx;
+                        if (!visited[next] && output[next * channels + ix] >= threshold_q) {
+                            visited[next] = 1;
+                            stack.push_back(next);
+                        }
+                    }
+                }
+            }
+            blobs.push_back(blob);
+        }
+    }
+    return blobs;
+}
+
+static bool matches(const ei_impulse_result_t *result, const std::vector<reference_blob_t> &reference,
+                    uint32_t cell_width, uint32_t cell_height)
+{
+    if (result->bounding_boxes_count != reference.size()) {
+        printf("%u blobs, the flood fill finds %u\n", (unsigned)result->bounding_boxes_count,
+               (unsigned)reference.size());
+        return false;
+    }
+    for (size_t ix = 0; ix < reference.size(); ix++) {
+        const ei_impulse_result_bounding_box_t *box = &result->bounding_boxes[ix];
+        const ei_impulse_result_fomo_blob_t *blob = &result->fomo_blobs[ix];
+        const reference_blob_t *expected = &reference[ix];
+        float peak = static_cast<float>(expected->peak - OUTPUT_ZERO_POINT) * OUTPUT_SCALE;
+        if (blob->label_ix != expected->label_ix || box->x != expected->min_x * cell_width ||
+                box->y != expected->min_y * cell_height ||
+                box->width != (expected->max_x - expected->min_x + 1) * cell_width ||
+                box->height != (expected->max_y - expected->min_y + 1) * cell_height ||
+                blob->cell_count != expected->cell_count || box->value != peak) {
+            printf("blob %u differs from the flood fill\n", (unsigned)ix);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    int repetitions = argc > 1 ? atoi(argv[1]) : 2000;
+    if (repetitions <= 0) {
+        printf("usage: %s [repetitions]\n", argv[0]);
+        return 1;
+    }
+
+    ei_impulse_t impulse = *ei_default_impulse.impulse;
+    ei_learning_block_config_tflite_graph_t block_config =
+        *(const ei_learning_block_config_tflite_graph_t *)impulse.learning_blocks[0].config;
+    const size_t channels = impulse.label_count + 1;
+    int8_t threshold_q;
+    if (!ei_fomo_quantize_threshold(block_config.threshold, OUTPUT_ZERO_POINT, OUTPUT_SCALE, &threshold_q)) {
+        printf("ERR: the threshold %f can not be reached\n", block_config.threshold);
+        return 1;
+    }
+
+    printf("int8 FOMO decoder, %u classes, threshold %.2f (%d), mean of %d calls\n", (unsigned)impulse.label_count,
+           block_config.threshold, threshold_q, repetitions);
+    printf("%-8s %-8s %8s %10s\n", "grid", "scene", "blobs", "us / call");
+
+    int failures = 0;
+    for (int grid : grid_sizes) {
+        // the input is 8 pixels per cell, as FOMO cuts the model at 1/8
+        impulse.input_width = grid * 8;
+        impulse.input_height = grid * 8;
+        for (activation_t activation : { ACTIVATION_EMPTY, ACTIVATION_SPARSE, ACTIVATION_DENSE }) {
+            std::vector<int8_t> output = make_output(grid, channels, activation, threshold_q, (uint32_t)grid);
+            std::vector<int8_t> data = output;
+            ei_impulse_result_t result = { };
+
+            auto start = std::chrono::steady_clock::now();
+            for (int r = 0; r < repetitions; r++) {
+                fill_result_struct_i8_fomo(&impulse, &block_config, &result, data.data(), OUTPUT_ZERO_POINT,
+                                           OUTPUT_SCALE, grid, grid);
+            }
+            double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() /
+                        repetitions;
+
+            bool ok = matches(&result, flood_fill(output, grid, channels, threshold_q), 8, 8);
+            char name[16];
+            snprintf(name, sizeof(name), "%dx%d", grid, grid);
+            printf("%-8s %-8s %8u %10.3f%s\n", name, activation_names[activation],
+                   (unsigned)result.bounding_boxes_count, us, ok ? "" : "  *");
+            failures += ok ? 0 : 1;
+        }
+    }
+
+    // the quantized threshold, recomputed every call and cached per model
+    volatile int8_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) {
+        int8_t q;
+        ei_fomo_quantize_threshold(block_config.threshold, OUTPUT_ZERO_POINT, OUTPUT_SCALE, &q);
+        sink = q;
+    }
+    double computed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) {
+        int8_t q;
+        ei_fomo_get_threshold_i8(&block_config, OUTPUT_ZERO_POINT, OUTPUT_SCALE, &q);
+        sink = q;
+    }
+    double cached = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    (void)sink;
+    printf("\nthreshold: computed %.1f ns, cached %.1f ns per call\n", computed / repetitions, cached / repetitions);
+
+    printf("\n%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,185 @@
+//author: Stepan Vondracek (xvondr27)
+// Equivalence test of extract_image_features_quantized_raw() with the get_data() float path
+// Every case quantizes the same pixels twice: once read straight from the image buffer, once
+// packed as (r << 16) + (g << 8) + b floats and paged in through signal_t::get_data() by
+// extract_image_features_quantized(), like run_classifier() did before. The two input tensors
+// have to be equal byte by byte.
+// Images are model sized windows into the fixtures (row stride of the whole frame), as RGB888,
+// BGR888 and one channel gray, with RGB and grayscale models and the fast and float quantization.
+// Without fixtures, the synthetic frames of photo_trap_benchmark are used.
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "edge-impulse-sdk/classifier/ei_run_classifier.h"
+#include "fixtures.h"
+
+// input quantization of a model and the image scaling of its learning block
+typedef struct {
+    const char *name;
+    float scale;
+    float zero_point;
+    int image_scaling;
+} quantization_t;
+
+static const quantization_t quantizations[] = {
+    // the fast path of both functions, every FOMO export uses it
+    { "fast", 0.003921568859368563f, -128, EI_CLASSIFIER_IMAGE_SCALING_NONE },
+    { "float", 0.0078125f, 0, EI_CLASSIFIER_IMAGE_SCALING_NONE },
+    { "0..255", 1.0f, -128, EI_CLASSIFIER_IMAGE_SCALING_0_255 },
+    { "torch", 0.0186584f, -14, EI_CLASSIFIER_IMAGE_SCALING_TORCH },
+    { "-128..127", 1.0f, 0, EI_CLASSIFIER_IMAGE_SCALING_MIN128_127 },
+};
+
+typedef struct {
+    const char *name;
+    size_t channels;
+    bool bgr;
+} layout_t;
+
+static const layout_t layouts[] = {
+    { "RGB888", 3, false },
+    { "BGR888", 3, true },
+    { "gray", 1, false },
+};
+
+static void usage(const char *name)
+{
+    printf("usage: %s [fixture.ppm | fixture_dir]...\n", name);
+}
+
+// pixels of the image packed like the get_data() callback of the photo trap did it
+static std::vector<float> packed_pixels(const ei::image_signal_t *image)
+{
+    const size_t r_ix = image->channels == 1 ? 0 : (image->bgr ? 2 : 0);
+    const size_t g_ix = image->channels == 1 ? 0 : 1;
+    const size_t b_ix = image->channels == 1 ? 0 : (image->bgr ? 0 : 2);
+
+    std::vector<float> packed;
+    packed.reserve(image->width * image->height);
+    for (size_t y = 0; y < image->height; y++) {
+        const uint8_t *pixel = image->buffer + y * image->stride;
+        for (size_t x = 0; x < image->width; x++, pixel += image->channels) {
+            packed.push_back((float)((pixel[r_ix] << 16) + (pixel[g_ix] << 8) + pixel[b_ix]));
+        }
+    }
+    return packed;
+}
+
+// quantize the image both ways, returns false and prints the first difference when they differ
+static bool compare_paths(const std::string &name, const ei::image_signal_t *image, const char *channels,
+                          const quantization_t *quantization)
+{
+    ei_dsp_config_image_t config = ei_dsp_config_26;
+    config.channels = channels;
+    const size_t features = image->width * image->height * (strcmp(channels, "Grayscale") == 0 ? 1 : 3);
+
+    std::vector<float> packed = packed_pixels(image);
+    ei::signal_t signal;
+    signal.total_length = packed.size();
+    signal.get_data = [&packed](size_t offset, size_t length, float *out_ptr) -> int {
+        memcpy(out_ptr, packed.data() + offset, length * sizeof(float));
+        return 0;
+    };
+
+    // one more byte than the features, to catch writes past them
+    std::vector<int8_t> expected(features + 1, 0x55);
+    std::vector<int8_t> actual(features + 1, 0x55);
+    ei::matrix_i8_t expected_matrix(1, features, expected.data());
+    ei::matrix_i8_t actual_matrix(1, features, actual.data());
+
+    int ret = extract_image_features_quantized(&signal, &expected_matrix, &config, quantization->scale,
+                                               quantization->zero_point, 0, quantization->image_scaling);
+    if (ret != EIDSP_OK) {
+        printf("ERR: %s: extract_image_features_quantized failed (%d)\n", name.c_str(), ret);
+        return false;
+    }
+    ret = extract_image_features_quantized_raw(image, &actual_matrix, &config, quantization->scale,
+                                               quantization->zero_point, quantization->image_scaling);
+    if (ret != EIDSP_OK) {
+        printf("ERR: %s: extract_image_features_quantized_raw failed (%d)\n", name.c_str(), ret);
+        return false;
+    }
+
+    for (size_t ix = 0; ix < expected.size(); ix++) {
+        if (expected[ix] != actual[ix]) {
+            printf("%s: byte %u differs, get_data %d, raw %d\n", name.c_str(), (unsigned)ix, expected[ix],
+                   actual[ix]);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<fixture_t> fixtures;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 1;
+        }
+        if (!load_fixtures(argv[i], &fixtures)) {
+            return 1;
+        }
+    }
+    if (fixtures.empty()) {
+        printf("No fixtures given, using %d synthetic %u x %u frames\n", SYNTHETIC_FRAME_COUNT,
+               SYNTHETIC_FRAME_COLS, SYNTHETIC_FRAME_ROWS);
+        make_synthetic_fixtures(&fixtures);
+    }
+
+    const size_t width = EI_CLASSIFIER_INPUT_WIDTH;
+    const size_t height = EI_CLASSIFIER_INPUT_HEIGHT;
+    int cases = 0, failures = 0;
+    for (const fixture_t &fixture : fixtures) {
+        if (fixture.width < width || fixture.height < height) {
+            printf("%s: smaller than %u x %u, skipped\n", fixture.name.c_str(), (unsigned)width, (unsigned)height);
+            continue;
+        }
+
+        // BGR888 and one channel copies of the frame, gray is the green channel
+        std::vector<uint8_t> bgr(fixture.rgb.size());
+        std::vector<uint8_t> gray((size_t)fixture.width * fixture.height);
+        for (size_t ix = 0; ix < gray.size(); ix++) {
+            bgr[ix * 3] = fixture.rgb[ix * 3 + 2];
+            bgr[ix * 3 + 1] = fixture.rgb[ix * 3 + 1];
+            bgr[ix * 3 + 2] = fixture.rgb[ix * 3];
+            gray[ix] = fixture.rgb[ix * 3 + 1];
+        }
+
+        // top left corner and the centre, both with the row stride of the whole frame
+        const size_t origins[][2] = {
+            { 0, 0 },
+            { (fixture.width - width) / 2, (fixture.height - height) / 2 },
+        };
+        int fixture_failures = 0;
+        for (const auto &origin : origins) {
+            for (const layout_t &layout : layouts) {
+                const uint8_t *frame = layout.channels == 1 ? gray.data() : layout.bgr ? bgr.data() : fixture.rgb.data();
+                ei::image_signal_t image;
+                image.width = width;
+                image.height = height;
+                image.channels = layout.channels;
+                image.bgr = layout.bgr;
+                image.stride = fixture.width * layout.channels;
+                image.buffer = frame + origin[1] * image.stride + origin[0] * layout.channels;
+
+                for (const char *channels : { "RGB", "Grayscale" }) {
+                    for (const quantization_t &quantization : quantizations) {
+                        std::string name = fixture.name + " " + layout.name + " at " + std::to_string(origin[0]) +
+                                           "," + std::to_string(origin[1]) + ", " + channels + " model, " +
+                                           quantization.name;
+                        cases++;
+                        fixture_failures += compare_paths(name, &image, channels, &quantization) ? 0 : 1;
+                    }
+                }
+            }
+        }
+        printf("%s: %s\n", fixture.name.c_str(), fixture_failures ? "FAILED" : "bit-identical");
+        failures += fixture_failures;
+    }
+
+    printf("\n%d of %d cases bit-identical\n%s\n", cases - failures, cases, failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
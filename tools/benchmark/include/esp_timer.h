@@ -0,0 +1,14 @@
+//author: Stepan Vondracek (xvondr27)
+// Host replacement of esp_timer.h, the ESP-NN kernels of TFLite Micro only read the time
+#ifndef BENCHMARK_ESP_TIMER_H
+#define BENCHMARK_ESP_TIMER_H
+
+#include <stdint.h>
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+
+static inline int64_t esp_timer_get_time(void)
+{
+    return (int64_t)ei_read_timer_us();
+}
+
+#endif
@@ -0,0 +1,689 @@
+//author: Stepan Vondracek (xvondr27)
+// Benchmark and equivalence check of the convolution kernels on the layers of the model
+// Every Conv2D and DepthwiseConv2D of tflite_learn_27 is run with the real weights and
+// quantization, on a random int8 input, through each implementation:
+//   reference - TFLite Micro reference_integer_ops, used without ESP-NN
+//   ansi      - ESP-NN plain C
+//   opt       - ESP-NN generic optimisations (what the device runs on targets without assembly)
+//   esp32s3 / esp32p4 - target specific ESP-NN, only when built for the target
+// Outputs are compared with the reference bit by bit, the time is the best of the repetitions.
+// Every Conv2D followed by the residual Add of its block is then run through the fused
+// convolution + add kernels (esp_nn_conv_add_s8) against the reference conv and Add, and
+// against the conv and the separate esp_nn_add_elementwise_s8 the device ran before.
+#include <algorithm>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "edge-impulse-sdk/porting/espressif/ESP-NN/include/esp_nn.h"
+#include "edge-impulse-sdk/tensorflow/lite/core/api/flatbuffer_conversions.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/quantization_util.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/add.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h"
+#include "edge-impulse-sdk/tensorflow/lite/kernels/padding.h"
+#include "edge-impulse-sdk/tensorflow/lite/micro/micro_error_reporter.h"
+#include "edge-impulse-sdk/tensorflow/lite/schema/schema_generated.h"
+#include "edge-impulse-sdk/tensorflow/lite/schema/schema_generated_full.h"
+#include "edge-impulse-sdk/tensorflow/lite/schema/schema_utils.h"
+#include "tflite-model/tflite_learn_27.h"
+
+#if defined(ESP_PLATFORM)
+#include "esp_cpu.h"
+#define BENCH_TIME_UNIT "cycles"
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TIME_UNIT "TSC cycles"
+#else
+#include <time.h>
+#define BENCH_TIME_UNIT "ns"
+#endif
+
+#define BENCH_DEFAULT_REPETITIONS   10
+
+// CPU cycles on the device, time stamp counter on x86 hosts
+static inline uint64_t bench_time(void)
+{
+#if defined(ESP_PLATFORM)
+    return esp_cpu_get_cycle_count();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+typedef void (*conv_fn)(const data_dims_t *input_dims, const int8_t *input_data,
+                        const data_dims_t *filter_dims, const int8_t *filter_data,
+                        const int32_t *bias, const data_dims_t *output_dims, int8_t *out_data,
+                        const conv_params_t *conv_params, const quant_data_t *quant_data);
+typedef void (*dw_conv_fn)(const data_dims_t *input_dims, const int8_t *input_data,
+                           const data_dims_t *filter_dims, const int8_t *filter_data,
+                           const int32_t *bias, const data_dims_t *output_dims, int8_t *out_data,
+                           const dw_conv_params_t *conv_params, const quant_data_t *quant_data);
+typedef int (*conv_scratch_size_fn)(const data_dims_t *input_dims, const data_dims_t *filter_dims,
+                                    const data_dims_t *output_dims, const conv_params_t *conv_params);
+typedef int (*dw_conv_scratch_size_fn)(const data_dims_t *input_dims, const data_dims_t *filter_dims,
+                                       const data_dims_t *output_dims, const dw_conv_params_t *conv_params);
+typedef void (*set_scratch_fn)(const void *buf);
+typedef void (*conv_add_fn)(const data_dims_t *input_dims, const int8_t *input_data,
+                            const data_dims_t *filter_dims, const int8_t *filter_data,
+                            const int32_t *bias, const data_dims_t *output_dims, int8_t *out_data,
+                            const conv_params_t *conv_params, const quant_data_t *quant_data,
+                            const int8_t *add_data, const add_params_t *add_params);
+
+// one implementation of both kernels, scratch functions are nullptr if it needs none
+typedef struct {
+    const char *name;
+    conv_fn conv;
+    conv_scratch_size_fn conv_scratch_size;
+    set_scratch_fn set_conv_scratch;
+    dw_conv_fn dw_conv;
+    dw_conv_scratch_size_fn dw_conv_scratch_size;
+    set_scratch_fn set_dw_conv_scratch;
+} kernel_variant_t;
+
+static tflite::RuntimeShape shape(int32_t d0, int32_t d1, int32_t d2, int32_t d3)
+{
+    const int32_t dims[4] = { d0, d1, d2, d3 };
+    return tflite::RuntimeShape(4, dims);
+}
+
+// filter layout is [out_channels, height, width, in_channels] for Conv2D
+// and [1, height, width, out_channels] for DepthwiseConv2D
+static void reference_conv(const data_dims_t *input_dims, const int8_t *input_data,
+                           const data_dims_t *filter_dims, const int8_t *filter_data,
+                           const int32_t *bias, const data_dims_t *output_dims, int8_t *out_data,
+                           const conv_params_t *conv_params, const quant_data_t *quant_data)
+{
+    tflite::ConvParams op_params = { };
+    op_params.input_offset = conv_params->in_offset;
+    op_params.output_offset = conv_params->out_offset;
+    op_params.stride_width = conv_params->stride.width;
+    op_params.stride_height = conv_params->stride.height;
+    op_params.dilation_width_factor = 1;
+    op_params.dilation_height_factor = 1;
+    op_params.padding_values.width = conv_params->padding.width;
+    op_params.padding_values.height = conv_params->padding.height;
+    op_params.quantized_activation_min = conv_params->activation.min;
+    op_params.quantized_activation_max = conv_params->activation.max;
+
+    tflite::reference_integer_ops::ConvPerChannel(
+        op_params, quant_data->mult, quant_data->shift,
+        shape(1, input_dims->height, input_dims->width, input_dims->channels), input_data,
+        shape(output_dims->channels, filter_dims->height, filter_dims->width, input_dims->channels),
+        filter_data, tflite::RuntimeShape(1, &output_dims->channels), bias,
+        shape(1, output_dims->height, output_dims->width, output_dims->channels), out_data);
+}
+
+static void reference_dw_conv(const data_dims_t *input_dims, const int8_t *input_data,
+                              const data_dims_t *filter_dims, const int8_t *filter_data,
+                              const int32_t *bias, const data_dims_t *output_dims, int8_t *out_data,
+                              const dw_conv_params_t *conv_params, const quant_data_t *quant_data)
+{
+    tflite::DepthwiseParams op_params = { };
+    op_params.input_offset = conv_params->in_offset;
+    op_params.output_offset = conv_params->out_offset;
+    op_params.depth_multiplier = conv_params->ch_mult;
+    op_params.stride_width = conv_params->stride.width;
+    op_params.stride_height = conv_params->stride.height;
+    op_params.dilation_width_factor = 1;
+    op_params.dilation_height_factor = 1;
+    op_params.padding_values.width = conv_params->padding.width;
+    op_params.padding_values.height = conv_params->padding.height;
+    op_params.quantized_activation_min = conv_params->activation.min;
+    op_params.quantized_activation_max = conv_params->activation.max;
+
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        op_params, quant_data->mult, quant_data->shift,
+        shape(1, input_dims->height, input_dims->width, input_dims->channels), input_data,
+        shape(1, filter_dims->height, filter_dims->width, output_dims->channels),
+        filter_data, tflite::RuntimeShape(1, &output_dims->channels), bias,
+        shape(1, output_dims->height, output_dims->width, output_dims->channels), out_data);
+}
+
+static const kernel_variant_t variants[] = {
+    { "reference", reference_conv, nullptr, nullptr, reference_dw_conv, nullptr, nullptr },
+    { "ansi", esp_nn_conv_s8_ansi, esp_nn_get_conv_scratch_size_ansi, esp_nn_set_conv_scratch_buf_ansi,
+      esp_nn_depthwise_conv_s8_ansi, esp_nn_get_depthwise_conv_scratch_size_ansi,
+      esp_nn_set_depthwise_conv_scratch_buf_ansi },
+    { "opt", esp_nn_conv_s8_opt, esp_nn_get_conv_scratch_size_opt, esp_nn_set_conv_scratch_buf_opt,
+      esp_nn_depthwise_conv_s8_opt, esp_nn_get_depthwise_conv_scratch_size_opt,
+      esp_nn_set_depthwise_conv_scratch_buf_opt },
+#if defined(CONFIG_IDF_TARGET_ESP32S3)
+    { "esp32s3", esp_nn_conv_s8_esp32s3, esp_nn_get_conv_scratch_size_esp32s3, esp_nn_set_conv_scratch_buf_esp32s3,
+      esp_nn_depthwise_conv_s8_esp32s3, esp_nn_get_depthwise_conv_scratch_size_esp32s3,
+      esp_nn_set_depthwise_conv_scratch_buf_esp32s3 },
+#elif defined(CONFIG_IDF_TARGET_ESP32P4)
+    // P4 has no depthwise assembly, it uses the generic optimisations
+    { "esp32p4", esp_nn_conv_s8_esp32p4, esp_nn_get_conv_scratch_size_esp32p4, esp_nn_set_conv_scratch_buf_esp32p4,
+      esp_nn_depthwise_conv_s8_opt, esp_nn_get_depthwise_conv_scratch_size_opt,
+      esp_nn_set_depthwise_conv_scratch_buf_opt },
+#endif
+};
+#define VARIANT_COUNT (sizeof(variants) / sizeof(variants[0]))
+
+// one implementation of the convolution with the residual Add
+typedef struct {
+    const char *name;
+    conv_add_fn conv_add;
+    conv_scratch_size_fn scratch_size;
+    set_scratch_fn set_scratch;
+} conv_add_variant_t;
+
+// the convolution output of the separate kernels, written and read again by the Add
+static std::vector<int8_t> conv_output;
+
+static void reference_conv_add(const data_dims_t *input_dims, const int8_t *input_data,
+                               const data_dims_t *filter_dims, const int8_t *filter_data,
+                               const int32_t *bias, const data_dims_t *output_dims, int8_t *out_data,
+                               const conv_params_t *conv_params, const quant_data_t *quant_data,
+                               const int8_t *add_data, const add_params_t *add_params)
+{
+    reference_conv(input_dims, input_data, filter_dims, filter_data, bias, output_dims, conv_output.data(),
+                   conv_params, quant_data);
+
+    tflite::ArithmeticParams op_params = { };
+    op_params.left_shift = add_params->left_shift;
+    op_params.input1_offset = add_params->input1_offset;
+    op_params.input1_multiplier = add_params->input1_mult;
+    op_params.input1_shift = add_params->input1_shift;
+    op_params.input2_offset = add_params->input2_offset;
+    op_params.input2_multiplier = add_params->input2_mult;
+    op_params.input2_shift = add_params->input2_shift;
+    op_params.output_offset = add_params->out_offset;
+    op_params.output_multiplier = add_params->out_mult;
+    op_params.output_shift = add_params->out_shift;
+    op_params.quantized_activation_min = add_params->activation.min;
+    op_params.quantized_activation_max = add_params->activation.max;
+    const tflite::RuntimeShape output_shape = shape(1, output_dims->height, output_dims->width,
+                                                    output_dims->channels);
+    tflite::reference_integer_ops::Add(op_params, output_shape, conv_output.data(), output_shape, add_data,
+                                       output_shape, out_data);
+}
+
+// esp_nn_conv_s8 and esp_nn_add_elementwise_s8 of this build, one after the other
+static void separate_conv_add(const data_dims_t *input_dims, const int8_t *input_data,
+                              const data_dims_t *filter_dims, const int8_t *filter_data,
+                              const int32_t *bias, const data_dims_t *output_dims, int8_t *out_data,
+                              const conv_params_t *conv_params, const quant_data_t *quant_data,
+                              const int8_t *add_data, const add_params_t *add_params)
+{
+    esp_nn_conv_s8(input_dims, input_data, filter_dims, filter_data, bias, output_dims, conv_output.data(),
+                   conv_params, quant_data);
+    esp_nn_add_elementwise_s8(conv_output.data(), add_data, add_params->input1_offset, add_params->input2_offset,
+                              add_params->input1_mult, add_params->input2_mult, add_params->input1_shift,
+                              add_params->input2_shift, add_params->left_shift, out_data, add_params->out_offset,
+                              add_params->out_mult, add_params->out_shift, add_params->activation.min,
+                              add_params->activation.max,
+                              output_dims->width * output_dims->height * output_dims->channels);
+}
+
+static const conv_add_variant_t conv_add_variants[] = {
+    { "reference", reference_conv_add, nullptr, nullptr },
+    { "separate", separate_conv_add, esp_nn_get_conv_scratch_size, esp_nn_set_conv_scratch_buf },
+    { "ansi", esp_nn_conv_add_s8_ansi, esp_nn_get_conv_add_scratch_size_ansi, esp_nn_set_conv_add_scratch_buf_ansi },
+    { "opt", esp_nn_conv_add_s8_opt, esp_nn_get_conv_add_scratch_size_opt, esp_nn_set_conv_add_scratch_buf_opt },
+    // the SIMD kernels of the target in bands, the generic optimisations on the host
+    { "banded", esp_nn_conv_add_s8_banded, esp_nn_get_conv_add_scratch_size_banded,
+      esp_nn_set_conv_add_scratch_buf_banded },
+};
+#define CONV_ADD_VARIANT_COUNT (sizeof(conv_add_variants) / sizeof(conv_add_variants[0]))
+
+// one convolution layer of the model with everything the kernels need
+typedef struct {
+    int op_index;
+    bool depthwise;
+    data_dims_t input_dims;
+    data_dims_t filter_dims;
+    data_dims_t output_dims;
+    conv_params_t conv_params;
+    dw_conv_params_t dw_conv_params;
+    const int8_t *filter;
+    const int32_t *bias;
+    std::vector<int32_t> mult;
+    std::vector<int32_t> shift;
+    uint64_t macs;
+    // the Add right after the convolution, with the convolution output as input1
+    bool residual;
+    add_params_t add_params;
+} conv_layer_t;
+
+// builtin options of the operators are parsed like TFLite Micro does
+class MallocDataAllocator : public tflite::BuiltinDataAllocator {
+public:
+    void *Allocate(size_t size, size_t) override {
+        return malloc(size);
+    }
+    void Deallocate(void *data) override {
+        free(data);
+    }
+};
+
+// zero point + value / scale, clamped to int8 like CalculateActivationRangeQuantized
+static int32_t quantize_activation(float value, float scale, int32_t zero_point)
+{
+    int32_t q = zero_point + (int32_t)roundf(value / scale);
+    return std::min<int32_t>(std::max<int32_t>(q, -128), 127);
+}
+
+static void activation_range(TfLiteFusedActivation activation, float scale, int32_t zero_point,
+                             act_params_t *range)
+{
+    range->min = -128;
+    range->max = 127;
+    if (activation == kTfLiteActRelu) {
+        range->min = quantize_activation(0.0f, scale, zero_point);
+    }
+    else if (activation == kTfLiteActRelu6) {
+        range->min = quantize_activation(0.0f, scale, zero_point);
+        range->max = quantize_activation(6.0f, scale, zero_point);
+    }
+    else if (activation == kTfLiteActReluN1To1) {
+        range->min = quantize_activation(-1.0f, scale, zero_point);
+        range->max = quantize_activation(1.0f, scale, zero_point);
+    }
+}
+
+template<typename T>
+static const T *tensor_data(const tflite::Model *model, const tflite::Tensor *tensor)
+{
+    const tflite::Buffer *buffer = model->buffers()->Get(tensor->buffer());
+    if (buffer == nullptr || buffer->data() == nullptr) {
+        return nullptr;
+    }
+    return (const T *)buffer->data()->data();
+}
+
+// parameters of the Add after the convolution op_index, like CalculateOpDataAdd of add_common.cc
+static bool extract_residual_add(const tflite::Model *model, uint32_t op_index, conv_layer_t *layer)
+{
+    const tflite::SubGraph *subgraph = model->subgraphs()->Get(0);
+    if (op_index + 1 >= subgraph->operators()->size()) {
+        return true;
+    }
+    const tflite::Operator *conv = subgraph->operators()->Get(op_index);
+    const tflite::Operator *op = subgraph->operators()->Get(op_index + 1);
+    if (tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index())) != tflite::BuiltinOperator_ADD) {
+        return true;
+    }
+    const int32_t conv_output = conv->outputs()->Get(0);
+    int32_t skip_index;
+    if (op->inputs()->Get(0) == conv_output) {
+        skip_index = op->inputs()->Get(1);
+    }
+    else if (op->inputs()->Get(1) == conv_output) {
+        skip_index = op->inputs()->Get(0);
+    }
+    else {
+        return true;
+    }
+
+    MallocDataAllocator allocator;
+    void *builtin_data = nullptr;
+    if (tflite::ParseAdd(op, tflite::GetMicroErrorReporter(), &allocator, &builtin_data) != kTfLiteOk
+            || builtin_data == nullptr) {
+        printf("ERR: Failed to parse operator %d\n", (int)op_index + 1);
+        return false;
+    }
+    TfLiteFusedActivation activation = ((const TfLiteAddParams *)builtin_data)->activation;
+    allocator.Deallocate(builtin_data);
+
+    const tflite::Tensor *input1 = subgraph->tensors()->Get(conv_output);
+    const tflite::Tensor *input2 = subgraph->tensors()->Get(skip_index);
+    const tflite::Tensor *output = subgraph->tensors()->Get(op->outputs()->Get(0));
+    const double input1_scale = input1->quantization()->scale()->Get(0);
+    const double input2_scale = input2->quantization()->scale()->Get(0);
+    const double output_scale = output->quantization()->scale()->Get(0);
+    const int left_shift = 20;
+    const double twice_max_input_scale = 2 * std::max(input1_scale, input2_scale);
+
+    add_params_t *params = &layer->add_params;
+    int shift;
+    params->input1_offset = -(int32_t)input1->quantization()->zero_point()->Get(0);
+    params->input2_offset = -(int32_t)input2->quantization()->zero_point()->Get(0);
+    params->left_shift = left_shift;
+    tflite::QuantizeMultiplierSmallerThanOneExp(input1_scale / twice_max_input_scale, &params->input1_mult, &shift);
+    params->input1_shift = shift;
+    tflite::QuantizeMultiplierSmallerThanOneExp(input2_scale / twice_max_input_scale, &params->input2_mult, &shift);
+    params->input2_shift = shift;
+    tflite::QuantizeMultiplierSmallerThanOneExp(twice_max_input_scale / ((1 << left_shift) * output_scale),
+                                                &params->out_mult, &shift);
+    params->out_shift = shift;
+    params->out_offset = (int32_t)output->quantization()->zero_point()->Get(0);
+    activation_range(activation, (float)output_scale, params->out_offset, &params->activation);
+    layer->residual = true;
+    return true;
+}
+
+// shapes, parameters and weights of every Conv2D and DepthwiseConv2D of the model
+static bool extract_layers(std::vector<conv_layer_t> *layers)
+{
+    const tflite::Model *model = tflite::GetModel(tflite_learn_27);
+    const tflite::SubGraph *subgraph = model->subgraphs()->Get(0);
+    MallocDataAllocator allocator;
+
+    for (uint32_t ix = 0; ix < subgraph->operators()->size(); ix++) {
+        const tflite::Operator *op = subgraph->operators()->Get(ix);
+        tflite::BuiltinOperator code = tflite::GetBuiltinCode(model->operator_codes()->Get(op->opcode_index()));
+        if (code != tflite::BuiltinOperator_CONV_2D && code != tflite::BuiltinOperator_DEPTHWISE_CONV_2D) {
+            continue;
+        }
+
+        conv_layer_t layer = { };
+        layer.op_index = ix;
+        layer.depthwise = code == tflite::BuiltinOperator_DEPTHWISE_CONV_2D;
+        const tflite::Tensor *input = subgraph->tensors()->Get(op->inputs()->Get(0));
+        const tflite::Tensor *filter = subgraph->tensors()->Get(op->inputs()->Get(1));
+        const tflite::Tensor *bias = op->inputs()->size() > 2 && op->inputs()->Get(2) >= 0 ?
+            subgraph->tensors()->Get(op->inputs()->Get(2)) : nullptr;
+        const tflite::Tensor *output = subgraph->tensors()->Get(op->outputs()->Get(0));
+        if (input->type() != tflite::TensorType_INT8) {
+            printf("ERR: Operator %d is not int8\n", (int)ix);
+            return false;
+        }
+
+        layer.input_dims = { (int32_t)input->shape()->Get(2), (int32_t)input->shape()->Get(1),
+                             (int32_t)input->shape()->Get(3), 1 };
+        layer.output_dims = { (int32_t)output->shape()->Get(2), (int32_t)output->shape()->Get(1),
+                              (int32_t)output->shape()->Get(3), 1 };
+        layer.filter_dims = { (int32_t)filter->shape()->Get(2), (int32_t)filter->shape()->Get(1), 0, 0 };
+        layer.filter = tensor_data<int8_t>(model, filter);
+        layer.bias = bias ? tensor_data<int32_t>(model, bias) : nullptr;
+
+        void *builtin_data = nullptr;
+        TfLiteStatus parsed = layer.depthwise ?
+            tflite::ParseDepthwiseConv2D(op, tflite::GetMicroErrorReporter(), &allocator, &builtin_data) :
+            tflite::ParseConv2D(op, tflite::GetMicroErrorReporter(), &allocator, &builtin_data);
+        if (parsed != kTfLiteOk || builtin_data == nullptr) {
+            printf("ERR: Failed to parse operator %d\n", (int)ix);
+            return false;
+        }
+        int stride_w, stride_h, dilation_w, dilation_h, depth_multiplier = 1;
+        TfLitePadding padding;
+        TfLiteFusedActivation activation;
+        if (layer.depthwise) {
+            const TfLiteDepthwiseConvParams *p = (const TfLiteDepthwiseConvParams *)builtin_data;
+            stride_w = p->stride_width;
+            stride_h = p->stride_height;
+            dilation_w = p->dilation_width_factor;
+            dilation_h = p->dilation_height_factor;
+            depth_multiplier = p->depth_multiplier;
+            padding = p->padding;
+            activation = p->activation;
+        }
+        else {
+            const TfLiteConvParams *p = (const TfLiteConvParams *)builtin_data;
+            stride_w = p->stride_width;
+            stride_h = p->stride_height;
+            dilation_w = p->dilation_width_factor;
+            dilation_h = p->dilation_height_factor;
+            padding = p->padding;
+            activation = p->activation;
+        }
+        allocator.Deallocate(builtin_data);
+        if (dilation_w != 1 || dilation_h != 1) {
+            // ESP-NN is not used for dilated convolutions, conv.cc falls back to the reference
+            printf("Operator %d is dilated, skipped\n", (int)ix);
+            continue;
+        }
+
+        int out_w, out_h;
+        TfLitePaddingValues pad = tflite::ComputePaddingHeightWidth(
+            stride_h, stride_w, 1, 1, layer.input_dims.height, layer.input_dims.width,
+            layer.filter_dims.height, layer.filter_dims.width, padding, &out_h, &out_w);
+
+        float input_scale = input->quantization()->scale()->Get(0);
+        int32_t input_zp = (int32_t)input->quantization()->zero_point()->Get(0);
+        float output_scale = output->quantization()->scale()->Get(0);
+        int32_t output_zp = (int32_t)output->quantization()->zero_point()->Get(0);
+        act_params_t act;
+        activation_range(activation, output_scale, output_zp, &act);
+
+        layer.conv_params = { -input_zp, output_zp, { stride_w, stride_h }, { pad.width, pad.height },
+                              { 0, 0 }, act };
+        layer.dw_conv_params = { -input_zp, output_zp, depth_multiplier, { stride_w, stride_h },
+                                 { pad.width, pad.height }, { 0, 0 }, act };
+
+        // per channel requantization, as PopulateConvolutionQuantizationParams
+        const flatbuffers::Vector<float> *filter_scales = filter->quantization()->scale();
+        for (int32_t c = 0; c < layer.output_dims.channels; c++) {
+            double filter_scale = filter_scales->Get(filter_scales->size() == 1 ? 0 : c);
+            int32_t mult;
+            int shift;
+            tflite::QuantizeMultiplier((double)input_scale * filter_scale / (double)output_scale, &mult, &shift);
+            layer.mult.push_back(mult);
+            layer.shift.push_back(shift);
+        }
+
+        uint64_t per_output = (uint64_t)layer.filter_dims.width * layer.filter_dims.height *
+                              (layer.depthwise ? 1 : layer.input_dims.channels);
+        layer.macs = (uint64_t)layer.output_dims.width * layer.output_dims.height *
+                     layer.output_dims.channels * per_output;
+        if (!layer.depthwise && !extract_residual_add(model, ix, &layer)) {
+            return false;
+        }
+        layers->push_back(std::move(layer));
+    }
+    return true;
+}
+
+// best time of the repetitions, output is left in out
+static uint64_t run_variant(const kernel_variant_t *variant, const conv_layer_t *layer, const int8_t *input,
+                            int8_t *out, int repetitions)
+{
+    quant_data_t quant_data = { (int32_t *)layer->shift.data(), (int32_t *)layer->mult.data() };
+
+    int scratch_size = 0;
+    if (layer->depthwise && variant->dw_conv_scratch_size) {
+        scratch_size = variant->dw_conv_scratch_size(&layer->input_dims, &layer->filter_dims,
+                                                     &layer->output_dims, &layer->dw_conv_params);
+    }
+    else if (!layer->depthwise && variant->conv_scratch_size) {
+        scratch_size = variant->conv_scratch_size(&layer->input_dims, &layer->filter_dims,
+                                                  &layer->output_dims, &layer->conv_params);
+    }
+    // 16 byte aligned like the scratch buffers of the tensor arena
+    std::vector<int8_t> scratch(std::max(scratch_size, 0) + 16);
+    void *scratch_buf = (void *)(((uintptr_t)scratch.data() + 15) & ~(uintptr_t)15);
+    if (layer->depthwise && variant->set_dw_conv_scratch) {
+        variant->set_dw_conv_scratch(scratch_buf);
+    }
+    else if (!layer->depthwise && variant->set_conv_scratch) {
+        variant->set_conv_scratch(scratch_buf);
+    }
+
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < repetitions; r++) {
+        uint64_t start = bench_time();
+        if (layer->depthwise) {
+            variant->dw_conv(&layer->input_dims, input, &layer->filter_dims, layer->filter, layer->bias,
+                             &layer->output_dims, out, &layer->dw_conv_params, &quant_data);
+        }
+        else {
+            variant->conv(&layer->input_dims, input, &layer->filter_dims, layer->filter, layer->bias,
+                          &layer->output_dims, out, &layer->conv_params, &quant_data);
+        }
+        best = std::min(best, bench_time() - start);
+    }
+    return best;
+}
+
+// best time of the repetitions of the convolution with the residual Add, output is left in out
+static uint64_t run_conv_add_variant(const conv_add_variant_t *variant, const conv_layer_t *layer,
+                                     const int8_t *input, const int8_t *add_data, int8_t *out, int repetitions)
+{
+    quant_data_t quant_data = { (int32_t *)layer->shift.data(), (int32_t *)layer->mult.data() };
+
+    int scratch_size = 0;
+    if (variant->scratch_size) {
+        scratch_size = variant->scratch_size(&layer->input_dims, &layer->filter_dims,
+                                             &layer->output_dims, &layer->conv_params);
+    }
+    std::vector<int8_t> scratch(std::max(scratch_size, 0) + 16);
+    void *scratch_buf = (void *)(((uintptr_t)scratch.data() + 15) & ~(uintptr_t)15);
+    if (variant->set_scratch) {
+        variant->set_scratch(scratch_buf);
+    }
+
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < repetitions; r++) {
+        uint64_t start = bench_time();
+        variant->conv_add(&layer->input_dims, input, &layer->filter_dims, layer->filter, layer->bias,
+                          &layer->output_dims, out, &layer->conv_params, &quant_data, add_data,
+                          &layer->add_params);
+        best = std::min(best, bench_time() - start);
+    }
+    return best;
+}
+
+// Run the fused convolution + add variants on the residual blocks and print the results
+// Returns the number of blocks where a variant differs from the reference
+static int run_residual_blocks(const std::vector<conv_layer_t> &layers, int repetitions)
+{
+    printf("\nresidual blocks, Conv2D with the Add after it, best of %d, %s, * output differs from reference\n",
+           repetitions, BENCH_TIME_UNIT);
+    printf("%-3s", "op");
+    for (size_t v = 0; v < CONV_ADD_VARIANT_COUNT; v++) {
+        printf(" %12s ", conv_add_variants[v].name);
+    }
+    printf("\n");
+
+    uint32_t seed = 2;
+    int differing = 0;
+    for (const conv_layer_t &layer : layers) {
+        if (!layer.residual) {
+            continue;
+        }
+        size_t input_size = (size_t)layer.input_dims.width * layer.input_dims.height * layer.input_dims.channels;
+        size_t output_size = (size_t)layer.output_dims.width * layer.output_dims.height * layer.output_dims.channels;
+        std::vector<int8_t> input(input_size);
+        std::vector<int8_t> add_data(output_size);
+        for (int8_t &value : input) {
+            seed = seed * 1103515245 + 12345;
+            value = (int8_t)(seed >> 16);
+        }
+        for (int8_t &value : add_data) {
+            seed = seed * 1103515245 + 12345;
+            value = (int8_t)(seed >> 16);
+        }
+        conv_output.resize(output_size);
+        std::vector<int8_t> expected(output_size);
+        std::vector<int8_t> out(output_size);
+
+        printf("%-3d", layer.op_index);
+        bool differs = false;
+        for (size_t v = 0; v < CONV_ADD_VARIANT_COUNT; v++) {
+            int8_t *dst = v == 0 ? expected.data() : out.data();
+            uint64_t time = run_conv_add_variant(&conv_add_variants[v], &layer, input.data(), add_data.data(),
+                                                 dst, repetitions);
+            bool equal = v == 0 || memcmp(expected.data(), out.data(), output_size) == 0;
+            differs |= !equal;
+            printf(" %12llu%c", (unsigned long long)time, equal ? ' ' : '*');
+        }
+        printf("\n");
+        differing += differs ? 1 : 0;
+    }
+    return differing;
+}
+
+// Run all variants on all layers and print the results
+// Returns the number of layers where a variant differs from the reference
+int kernel_benchmark_run(int repetitions)
+{
+    std::vector<conv_layer_t> layers;
+    if (!extract_layers(&layers)) {
+        return -1;
+    }
+
+    printf("%-3s %-6s %-14s %-5s %-3s %-5s %-14s %10s\n", "op", "type", "input", "k", "s", "pad",
+           "output", "MACs");
+    for (const conv_layer_t &layer : layers) {
+        char input[32], output[32], kernel[16], pad[16];
+        snprintf(input, sizeof(input), "%dx%dx%d", (int)layer.input_dims.height, (int)layer.input_dims.width,
+                 (int)layer.input_dims.channels);
+        snprintf(output, sizeof(output), "%dx%dx%d", (int)layer.output_dims.height, (int)layer.output_dims.width,
+                 (int)layer.output_dims.channels);
+        snprintf(kernel, sizeof(kernel), "%dx%d", (int)layer.filter_dims.height, (int)layer.filter_dims.width);
+        snprintf(pad, sizeof(pad), "%d,%d", (int)layer.conv_params.padding.height,
+                 (int)layer.conv_params.padding.width);
+        printf("%-3d %-6s %-14s %-5s %-3d %-5s %-14s %10llu\n", layer.op_index, layer.depthwise ? "dw" : "conv",
+               input, kernel, (int)layer.conv_params.stride.width, pad, output, (unsigned long long)layer.macs);
+    }
+
+    printf("\nbest of %d, %s, MACs per %s in brackets, * output differs from reference\n", repetitions,
+           BENCH_TIME_UNIT, strcmp(BENCH_TIME_UNIT, "ns") == 0 ? "ns" : "cycle");
+    printf("%-3s", "op");
+    for (size_t v = 0; v < VARIANT_COUNT; v++) {
+        printf(" %22s", variants[v].name);
+    }
+    printf("\n");
+
+    uint32_t seed = 1;
+    int differing = 0;
+    std::vector<uint64_t> totals(VARIANT_COUNT, 0);
+    std::vector<uint64_t> layer_times;
+    for (const conv_layer_t &layer : layers) {
+        size_t input_size = (size_t)layer.input_dims.width * layer.input_dims.height * layer.input_dims.channels;
+        size_t output_size = (size_t)layer.output_dims.width * layer.output_dims.height * layer.output_dims.channels;
+        std::vector<int8_t> input(input_size);
+        for (int8_t &value : input) {
+            seed = seed * 1103515245 + 12345;
+            value = (int8_t)(seed >> 16);
+        }
+        std::vector<int8_t> expected(output_size);
+        std::vector<int8_t> out(output_size);
+
+        printf("%-3d", layer.op_index);
+        bool differs = false;
+        for (size_t v = 0; v < VARIANT_COUNT; v++) {
+            int8_t *dst = v == 0 ? expected.data() : out.data();
+            uint64_t time = run_variant(&variants[v], &layer, input.data(), dst, repetitions);
+            bool equal = v == 0 || memcmp(expected.data(), out.data(), output_size) == 0;
+            differs |= !equal;
+            totals[v] += time;
+            if (v == VARIANT_COUNT - 1) {
+                layer_times.push_back(time);
+            }
+            printf(" %12llu (%6.2f)%c", (unsigned long long)time, time ? (double)layer.macs / time : 0.0,
+                   equal ? ' ' : '*');
+        }
+        printf("\n");
+        differing += differs ? 1 : 0;
+    }
+
+    printf("%-3s", "sum");
+    for (size_t v = 0; v < VARIANT_COUNT; v++) {
+        printf(" %12llu %9s", (unsigned long long)totals[v], "");
+    }
+    printf("\n");
+
+    // layers the fastest available variant spends the most time in, worth optimising first
+    const char *fastest = variants[VARIANT_COUNT - 1].name;
+    std::vector<size_t> order(layers.size());
+    for (size_t ix = 0; ix < order.size(); ix++) {
+        order[ix] = ix;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return layer_times[a] > layer_times[b]; });
+    printf("\nshare of %s time per layer\n", fastest);
+    for (size_t ix : order) {
+        printf("op %-3d %-5s %5.1f%%\n", layers[ix].op_index, layers[ix].depthwise ? "dw" : "conv",
+               totals[VARIANT_COUNT - 1] ? 100.0 * layer_times[ix] / totals[VARIANT_COUNT - 1] : 0.0);
+    }
+
+    differing += run_residual_blocks(layers, repetitions);
+    if (differing > 0) {
+        printf("\nERR: %d layers differ from the reference\n", differing);
+    }
+    return differing;
+}
+
+#if !defined(ESP_PLATFORM)
+int main(int argc, char **argv)
+{
+    int repetitions = argc > 1 ? std::max(atoi(argv[1]), 1) : BENCH_DEFAULT_REPETITIONS;
+    return kernel_benchmark_run(repetitions) == 0 ? 0 : 1;
+}
+#endif
@@ -0,0 +1,192 @@
+//author: Stepan Vondracek (xvondr27)
+// Test of RAK3172LineParser, the line splitting and classification of the RAK3172 driver
+// Scripted module output is fed like the UART event task does it: whole, split at every byte
+// and in chunks of every size. The lines, their kind and their order are checked against the
+// expected callbacks, also for empty lines, a line longer than the buffer (dropped, the next
+// line has to survive), a line of exactly the buffer size, reset() of a partial line and a
+// parser without a callback. classify() is checked on its own for the edge cases.
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "rak3172_parser.hpp"
+
+typedef struct {
+    rak3172_line_t type;
+    std::string line;
+} line_t;
+
+static const char *const type_names[] = { "DATA", "OK", "ERROR", "EVENT" };
+
+static void record_line(void* ctx, rak3172_line_t type, const char* line, size_t len)
+{
+    std::vector<line_t> *lines = static_cast<std::vector<line_t> *>(ctx);
+    if (strlen(line) != len) {
+        // the line has to be null terminated at len, recorded so the comparison fails
+        lines->push_back({ type, std::string(line, len) + " (not terminated)" });
+        return;
+    }
+    lines->push_back({ type, std::string(line, len) });
+}
+
+static bool same_lines(const char *name, const std::vector<line_t> &actual, const std::vector<line_t> &expected)
+{
+    if (actual.size() != expected.size()) {
+        printf("%s: %u lines, expected %u\n", name, (unsigned)actual.size(), (unsigned)expected.size());
+        return false;
+    }
+    for (size_t ix = 0; ix < expected.size(); ix++) {
+        if (actual[ix].type != expected[ix].type || actual[ix].line != expected[ix].line) {
+            printf("%s: line %u is %s \"%.40s\", expected %s \"%.40s\"\n", name, (unsigned)ix,
+                   type_names[actual[ix].type], actual[ix].line.c_str(), type_names[expected[ix].type],
+                   expected[ix].line.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+// feeds the stream in chunks of chunk bytes, 0 feeds it whole
+static std::vector<line_t> parse(const std::string &stream, size_t chunk)
+{
+    std::vector<line_t> lines;
+    RAK3172LineParser parser;
+    parser.begin(record_line, &lines);
+    if (chunk == 0) {
+        chunk = stream.size();
+    }
+    for (size_t offset = 0; offset < stream.size(); offset += chunk) {
+        parser.feed(stream.data() + offset, std::min(chunk, stream.size() - offset));
+    }
+    return lines;
+}
+
+// the stream whole, in chunks of every size and split in two at every byte
+static int check_stream(const char *name, const std::string &stream, const std::vector<line_t> &expected)
+{
+    int failures = 0;
+    for (size_t chunk = 0; chunk <= stream.size() && chunk <= 64; chunk++) {
+        failures += same_lines(name, parse(stream, chunk), expected) ? 0 : 1;
+    }
+    for (size_t split = 1; split < stream.size(); split++) {
+        std::vector<line_t> lines;
+        RAK3172LineParser parser;
+        parser.begin(record_line, &lines);
+        parser.feed(stream.data(), split);
+        parser.feed(stream.data() + split, stream.size() - split);
+        failures += same_lines(name, lines, expected) ? 0 : 1;
+    }
+    printf("%-28s %s\n", name, failures ? "FAILED" : "ok");
+    return failures ? 1 : 0;
+}
+
+int main()
+{
+    int failures = 0;
+
+    // a query with its echo, as the module answers AT+VER=?
+    failures += check_stream("query", "AT+VER=?\r\nAT+VER=4.0.5\r\nOK\r\n", {
+        { RAK3172_LINE_DATA, "AT+VER=?" },
+        { RAK3172_LINE_DATA, "AT+VER=4.0.5" },
+        { RAK3172_LINE_OK, "OK" },
+    });
+
+    // status codes of failed commands
+    failures += check_stream("errors", "AT+JOIN=1:0:10:8\r\nAT_BUSY_ERROR\r\nAT_PARAM_ERROR\r\nERROR\r\n", {
+        { RAK3172_LINE_DATA, "AT+JOIN=1:0:10:8" },
+        { RAK3172_LINE_ERROR, "AT_BUSY_ERROR" },
+        { RAK3172_LINE_ERROR, "AT_PARAM_ERROR" },
+        { RAK3172_LINE_ERROR, "ERROR" },
+    });
+
+    // unsolicited events between the answers, with empty lines and bare line feeds
+    failures += check_stream("events", "OK\r\n\r\n+EVT:JOINED\r\n\n\n+EVT:TX_DONE\n+EVT:RX_1:-70:8:UNICAST:2:1234\r\n", {
+        { RAK3172_LINE_OK, "OK" },
+        { RAK3172_LINE_EVENT, "+EVT:JOINED" },
+        { RAK3172_LINE_EVENT, "+EVT:TX_DONE" },
+        { RAK3172_LINE_EVENT, "+EVT:RX_1:-70:8:UNICAST:2:1234" },
+    });
+
+    // a line longer than the buffer is dropped when it ends, the lines around it are not
+    std::string overflow(RAK3172_LINE_BUFFER_SIZE + 1, 'A');
+    failures += check_stream("overflow", "OK\r\n+EVT:RX_1:" + overflow + "\r\nAT_BUSY_ERROR\r\n", {
+        { RAK3172_LINE_OK, "OK" },
+        { RAK3172_LINE_ERROR, "AT_BUSY_ERROR" },
+    });
+
+    // a line of exactly the buffer size still fits
+    std::string longest = "+EVT:" + std::string(RAK3172_LINE_BUFFER_SIZE - 5, 'F');
+    failures += check_stream("longest line", longest + "\r\nOK\r\n", {
+        { RAK3172_LINE_EVENT, longest },
+        { RAK3172_LINE_OK, "OK" },
+    });
+
+    // reset() forgets the partial line, begin() too
+    {
+        std::vector<line_t> lines;
+        RAK3172LineParser parser;
+        parser.begin(record_line, &lines);
+        parser.feed("AT+DEVE", 7);
+        parser.reset();
+        parser.feed("OK\r\n+EVT:JOI", 12);
+        parser.begin(record_line, &lines);
+        parser.feed("AT_ERROR\r\n", 10);
+        bool ok = same_lines("reset", lines, { { RAK3172_LINE_OK, "OK" }, { RAK3172_LINE_ERROR, "AT_ERROR" } });
+        printf("%-28s %s\n", "reset", ok ? "ok" : "FAILED");
+        failures += ok ? 0 : 1;
+    }
+
+    // reset() also clears the overflow of the dropped line
+    {
+        std::vector<line_t> lines;
+        RAK3172LineParser parser;
+        parser.begin(record_line, &lines);
+        parser.feed(overflow.data(), overflow.size());
+        parser.reset();
+        parser.feed("OK\r\n", 4);
+        bool ok = same_lines("reset after overflow", lines, { { RAK3172_LINE_OK, "OK" } });
+        printf("%-28s %s\n", "reset after overflow", ok ? "ok" : "FAILED");
+        failures += ok ? 0 : 1;
+    }
+
+    // without a callback, the lines are parsed and dropped
+    {
+        RAK3172LineParser parser;
+        parser.begin(nullptr, nullptr);
+        parser.feed("AT+VER=4.0.5\r\nOK\r\n", 18);
+        printf("%-28s ok\n", "no callback");
+    }
+
+    // classify() on its own
+    typedef struct {
+        const char *line;
+        rak3172_line_t type;
+    } classify_case_t;
+    static const classify_case_t classify_cases[] = {
+        { "OK", RAK3172_LINE_OK },
+        { "OKAY", RAK3172_LINE_DATA },
+        { "ERROR", RAK3172_LINE_ERROR },
+        { "ERRORS", RAK3172_LINE_DATA },
+        { "AT_", RAK3172_LINE_DATA },
+        { "AT_NO_NETWORK_JOINED", RAK3172_LINE_ERROR },
+        { "AT+SEND=2:AABB", RAK3172_LINE_DATA },
+        { "+EVT:", RAK3172_LINE_EVENT },
+        { "+EVT", RAK3172_LINE_DATA },
+        { "+EVT:SEND_CONFIRMED_OK", RAK3172_LINE_EVENT },
+        { "", RAK3172_LINE_DATA },
+    };
+    int classify_failures = 0;
+    for (const classify_case_t &c : classify_cases) {
+        rak3172_line_t type = RAK3172LineParser::classify(c.line, strlen(c.line));
+        if (type != c.type) {
+            printf("classify \"%s\": %s, expected %s\n", c.line, type_names[type], type_names[c.type]);
+            classify_failures++;
+        }
+    }
+    printf("%-28s %s\n", "classify", classify_failures ? "FAILED" : "ok");
+    failures += classify_failures;
+
+    printf("\n%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,233 @@
+//author: Stepan Vondracek (xvondr27)
+// Accuracy and throughput of the area downscale (resize_image_area) against bilinear (resize_image)
+// Accuracy is measured against a float area average: every output pixel is the mean of the
+// source area it covers, partial pixels weighted by the covered fraction. The integer area
+// downscale has to be within 0.5 LSB of it (rounding only), and its in place output has to be
+// the same as the out of place one. A frame of one pixel wide stripes shows the aliasing of
+// bilinear, fixtures (or the synthetic frames) the error on photos.
+// Throughput is the 720x720 -> 96x96 RGB crop the camera path resizes, best of the repetitions.
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "edge-impulse-sdk/porting/ei_classifier_porting.h"
+#include "model-parameters/model_metadata.h"
+#include "fixtures.h"
+
+using namespace ei::image::processing;
+
+// largest difference to the float reference allowed for the area downscale
+#define MAX_AREA_ERROR              0.5001
+
+typedef struct {
+    int src_width;
+    int src_height;
+    int dst_width;
+    int dst_height;
+    int channels;
+} resize_case_t;
+
+static const resize_case_t cases[] = {
+    { 720, 720, 96, 96, 3 },
+    { 720, 720, 96, 96, 1 },
+    { 1280, 720, 160, 90, 3 },
+    { 640, 480, 96, 96, 1 },
+    { 100, 100, 33, 33, 3 },
+    { 97, 61, 13, 7, 1 },
+    { 50, 40, 49, 39, 3 },
+};
+
+typedef struct {
+    double max;
+    double mean;
+} resize_error_t;
+
+// mean of the source area every output pixel covers, in float
+static std::vector<float> area_reference(const uint8_t *src, int src_width, int src_height, int dst_width,
+                                         int dst_height, int channels)
+{
+    const double x_scale = (double)src_width / dst_width;
+    const double y_scale = (double)src_height / dst_height;
+    std::vector<float> dst((size_t)dst_width * dst_height * channels);
+    for (int y = 0; y < dst_height; y++) {
+        const double y0 = y * y_scale, y1 = (y + 1) * y_scale;
+        for (int x = 0; x < dst_width; x++) {
+            const double x0 = x * x_scale, x1 = (x + 1) * x_scale;
+            for (int c = 0; c < channels; c++) {
+                double sum = 0;
+                for (int sy = (int)y0; sy < src_height && sy < y1; sy++) {
+                    const double wy = std::min<double>(sy + 1, y1) - std::max<double>(sy, y0);
+                    for (int sx = (int)x0; sx < src_width && sx < x1; sx++) {
+                        const double wx = std::min<double>(sx + 1, x1) - std::max<double>(sx, x0);
+                        sum += wx * wy * src[((size_t)sy * src_width + sx) * channels + c];
+                    }
+                }
+                dst[((size_t)y * dst_width + x) * channels + c] = (float)(sum / (x_scale * y_scale));
+            }
+        }
+    }
+    return dst;
+}
+
+static resize_error_t compare(const std::vector<uint8_t> &image, const std::vector<float> &reference)
+{
+    resize_error_t error = { 0, 0 };
+    for (size_t ix = 0; ix < reference.size(); ix++) {
+        double diff = fabs(image[ix] - reference[ix]);
+        error.max = std::max(error.max, diff);
+        error.mean += diff;
+    }
+    error.mean /= reference.size();
+    return error;
+}
+
+static std::vector<uint8_t> resize(const std::vector<uint8_t> &src, const resize_case_t &c, bool area)
+{
+    std::vector<uint8_t> dst((size_t)c.dst_width * c.dst_height * c.channels);
+    if (area) {
+        resize_image_area(src.data(), c.src_width, c.src_height, dst.data(), c.dst_width, c.dst_height, c.channels);
+    }
+    else {
+        resize_image(src.data(), c.src_width, c.src_height, dst.data(), c.dst_width, c.dst_height, c.channels);
+    }
+    return dst;
+}
+
+static std::vector<uint8_t> random_image(const resize_case_t &c, uint32_t seed)
+{
+    std::vector<uint8_t> image((size_t)c.src_width * c.src_height * c.channels);
+    for (uint8_t &value : image) {
+        seed = seed * 1103515245 + 12345;
+        value = (uint8_t)(seed >> 16);
+    }
+    return image;
+}
+
+// best time of the resize in microseconds
+static uint64_t time_resize(const std::vector<uint8_t> &src, const resize_case_t &c, bool area, int repetitions)
+{
+    std::vector<uint8_t> dst((size_t)c.dst_width * c.dst_height * c.channels);
+    uint64_t best = UINT64_MAX;
+    for (int r = 0; r < repetitions; r++) {
+        uint64_t start = ei_read_timer_us();
+        if (area) {
+            resize_image_area(src.data(), c.src_width, c.src_height, dst.data(), c.dst_width, c.dst_height,
+                              c.channels);
+        }
+        else {
+            resize_image(src.data(), c.src_width, c.src_height, dst.data(), c.dst_width, c.dst_height, c.channels);
+        }
+        best = std::min(best, ei_read_timer_us() - start);
+    }
+    return best;
+}
+
+static void usage(const char *name)
+{
+    printf("usage: %s [-n repetitions] [fixture.ppm | fixture_dir]...\n", name);
+}
+
+int main(int argc, char **argv)
+{
+    int repetitions = 50;
+    std::vector<fixture_t> fixtures;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            repetitions = atoi(argv[++i]);
+            continue;
+        }
+        if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 1;
+        }
+        if (!load_fixtures(argv[i], &fixtures)) {
+            return 1;
+        }
+    }
+    if (repetitions <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (fixtures.empty()) {
+        printf("No fixtures given, using %d synthetic %u x %u frames\n", SYNTHETIC_FRAME_COUNT,
+               SYNTHETIC_FRAME_COLS, SYNTHETIC_FRAME_ROWS);
+        make_synthetic_fixtures(&fixtures);
+    }
+
+    int failures = 0;
+    printf("random images, error against the float area average (LSB)\n");
+    printf("%-24s %10s %10s %10s %10s  %s\n", "", "area max", "area mean", "bilin max", "bilin mean", "in place");
+    for (const resize_case_t &c : cases) {
+        std::vector<uint8_t> src = random_image(c, (uint32_t)(c.src_width * 31 + c.channels));
+        std::vector<float> reference = area_reference(src.data(), c.src_width, c.src_height, c.dst_width,
+                                                      c.dst_height, c.channels);
+        std::vector<uint8_t> area = resize(src, c, true);
+        resize_error_t area_error = compare(area, reference);
+        resize_error_t bilinear_error = compare(resize(src, c, false), reference);
+
+        // in place, the output overwrites the start of the input
+        std::vector<uint8_t> in_place = src;
+        resize_image_area(in_place.data(), c.src_width, c.src_height, in_place.data(), c.dst_width, c.dst_height,
+                          c.channels);
+        bool same = memcmp(in_place.data(), area.data(), area.size()) == 0;
+
+        char name[32];
+        snprintf(name, sizeof(name), "%dx%dx%d -> %dx%d", c.src_width, c.src_height, c.channels, c.dst_width,
+                 c.dst_height);
+        bool ok = same && area_error.max <= MAX_AREA_ERROR;
+        printf("%-24s %10.3f %10.3f %10.3f %10.3f  %s%s\n", name, area_error.max, area_error.mean,
+               bilinear_error.max, bilinear_error.mean, same ? "same" : "DIFFERS", ok ? "" : "  *");
+        failures += ok ? 0 : 1;
+    }
+
+    // one pixel wide vertical stripes, the area average is mid grey, bilinear hits single stripes
+    const resize_case_t stripes_case = { 720, 720, 96, 96, 1 };
+    std::vector<uint8_t> stripes((size_t)stripes_case.src_width * stripes_case.src_height);
+    for (size_t ix = 0; ix < stripes.size(); ix++) {
+        stripes[ix] = (ix % stripes_case.src_width) % 2 ? 255 : 0;
+    }
+    std::vector<float> stripes_reference = area_reference(stripes.data(), 720, 720, 96, 96, 1);
+    resize_error_t stripes_area = compare(resize(stripes, stripes_case, true), stripes_reference);
+    resize_error_t stripes_bilinear = compare(resize(stripes, stripes_case, false), stripes_reference);
+    printf("\none pixel stripes 720x720 -> 96x96, mean error: area %.1f, bilinear %.1f\n", stripes_area.mean,
+           stripes_bilinear.mean);
+    failures += stripes_area.max <= MAX_AREA_ERROR ? 0 : 1;
+
+    printf("\nfixtures, centre crop -> %dx%d RGB, mean error against the float area average\n",
+           EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT);
+    for (const fixture_t &fixture : fixtures) {
+        ei::image_signal_t image;
+        image.buffer = fixture.rgb.data();
+        image.width = fixture.width;
+        image.height = fixture.height;
+        image.stride = fixture.width * 3;
+        image.channels = 3;
+        image.bgr = false;
+        crop_image_signal(&image, EI_CLASSIFIER_INPUT_WIDTH, EI_CLASSIFIER_INPUT_HEIGHT);
+
+        const resize_case_t c = { (int)image.width, (int)image.height, EI_CLASSIFIER_INPUT_WIDTH,
+                                  EI_CLASSIFIER_INPUT_HEIGHT, 3 };
+        std::vector<uint8_t> crop((size_t)c.src_width * c.src_height * 3);
+        for (int y = 0; y < c.src_height; y++) {
+            memcpy(&crop[(size_t)y * c.src_width * 3], image.buffer + y * image.stride, (size_t)c.src_width * 3);
+        }
+        std::vector<float> reference = area_reference(crop.data(), c.src_width, c.src_height, c.dst_width,
+                                                      c.dst_height, 3);
+        resize_error_t area_error = compare(resize(crop, c, true), reference);
+        resize_error_t bilinear_error = compare(resize(crop, c, false), reference);
+        printf("%-24s area %.2f, bilinear %.2f%s\n", fixture.name.c_str(), area_error.mean, bilinear_error.mean,
+               area_error.max <= MAX_AREA_ERROR ? "" : "  *");
+        failures += area_error.max <= MAX_AREA_ERROR ? 0 : 1;
+    }
+
+    const resize_case_t timed = { 720, 720, 96, 96, 3 };
+    std::vector<uint8_t> src = random_image(timed, 7);
+    printf("\n720x720 RGB -> 96x96, best of %d: area %.2f ms, bilinear %.2f ms\n", repetitions,
+           time_resize(src, timed, true, repetitions) / 1000.0, time_resize(src, timed, false, repetitions) / 1000.0);
+
+    printf("\n%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,482 @@
+#!/usr/bin/env python3
+#author: Stepan Vondracek (xvondr27)
+# Offline memory plan of the model activations, stored in the flatbuffer as
+# "OfflineMemoryAllocation" metadata (see tensorflow/lite/micro/micro_allocation_info.cc)
+# TFLite Micro then places every planned tensor at its offset in AllocateTensors() and the
+# GreedyMemoryPlanner only fits the kernel scratch buffers into the gaps
+#
+# With --fast-arena, the hottest activations are placed in the internal SRAM arena of
+# EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE instead ("FastArenaAllocation" metadata, see
+# MicroAllocator::SetFastArena). Hotness is operator time per byte, with --profile taken
+# from profiling records of the device (tools/profile_report.py), otherwise every operator
+# counts the same.
+#
+# usage: python3 tools/memory_plan.py                      # print the plan
+#        python3 tools/memory_plan.py --write              # store it in tflite-model/tflite_learn_27.h
+#        python3 tools/memory_plan.py --fast-arena 65536 --profile /sdcard/*.prf --write
+#        python3 tools/memory_plan.py model.tflite -o planned.tflite
+import argparse
+import os
+import random
+import re
+import struct
+import sys
+
+METADATA_NAME = b"OfflineMemoryAllocation"
+FAST_METADATA_NAME = b"FastArenaAllocation"
+ONLINE_PLANNED = -1
+# MicroArenaBufferAlignment(), sizes and offsets of the non-persistent arena
+ALIGNMENT = 16
+# random orderings tried after the fixed heuristics
+RANDOM_ORDERINGS = 2000
+
+REPO_ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+DEFAULT_HEADER = os.path.join(REPO_ROOT, "tflite-model", "tflite_learn_27.h")
+
+# TensorType -> bytes per element, types TFLite Micro cannot plan are missing
+TYPE_SIZE = {0: 4, 1: 2, 2: 4, 3: 1, 4: 8, 6: 1, 7: 2, 8: 8, 9: 1, 10: 8, 11: 16, 12: 8, 15: 4, 16: 2}
+
+# field indexes of schema.fbs tables
+MODEL_BUFFERS = 4
+MODEL_METADATA = 6
+MODEL_FIELDS = 8
+SUBGRAPH_TENSORS, SUBGRAPH_INPUTS, SUBGRAPH_OUTPUTS, SUBGRAPH_OPERATORS = 0, 1, 2, 3
+TENSOR_SHAPE, TENSOR_TYPE, TENSOR_BUFFER, TENSOR_NAME, TENSOR_IS_VARIABLE = 0, 1, 2, 3, 5
+OPERATOR_INPUTS, OPERATOR_OUTPUTS = 1, 2
+BUFFER_DATA = 0
+METADATA_NAME_FIELD, METADATA_BUFFER = 0, 1
+
+
+def align_up(value, alignment=ALIGNMENT):
+    return (value + alignment - 1) // alignment * alignment
+
+
+# read only access to the tables of a flatbuffer
+class FlatBuffer:
+    def __init__(self, data):
+        self.data = data
+
+    def u8(self, pos):
+        return self.data[pos]
+
+    def u16(self, pos):
+        return struct.unpack_from("<H", self.data, pos)[0]
+
+    def u32(self, pos):
+        return struct.unpack_from("<I", self.data, pos)[0]
+
+    def i32(self, pos):
+        return struct.unpack_from("<i", self.data, pos)[0]
+
+    def root(self):
+        return self.u32(0)
+
+    # absolute position of a table field, None when it is not stored
+    def field(self, table, index):
+        vtable = table - self.i32(table)
+        entry = 4 + 2 * index
+        if entry >= self.u16(vtable):
+            return None
+        offset = self.u16(vtable + entry)
+        return table + offset if offset else None
+
+    def field_count(self, table):
+        return (self.u16(table - self.i32(table)) - 4) // 2
+
+    def indirect(self, pos):
+        return pos + self.u32(pos)
+
+    # position of the referenced table / vector / string, None when not stored
+    def ref(self, table, index):
+        pos = self.field(table, index)
+        return None if pos is None else self.indirect(pos)
+
+    def scalar(self, table, index, fmt, default=0):
+        pos = self.field(table, index)
+        return default if pos is None else struct.unpack_from(fmt, self.data, pos)[0]
+
+    def vector_len(self, vector):
+        return 0 if vector is None else self.u32(vector)
+
+    def int_vector(self, table, index):
+        vector = self.ref(table, index)
+        return [self.i32(vector + 4 + 4 * i) for i in range(self.vector_len(vector))]
+
+    def table_vector(self, table, index):
+        vector = self.ref(table, index)
+        return [self.indirect(vector + 4 + 4 * i) for i in range(self.vector_len(vector))]
+
+    def string(self, table, index):
+        pos = self.ref(table, index)
+        if pos is None:
+            return b""
+        return bytes(self.data[pos + 4:pos + 4 + self.u32(pos)])
+
+
+class Tensor:
+    def __init__(self, index, name, size, planned):
+        self.index = index
+        self.name = name
+        self.size = size
+        self.planned = planned
+        self.first = -1
+        self.last = -1
+        self.offset = ONLINE_PLANNED
+        self.fast_offset = ONLINE_PLANNED
+        # indexes of the operators reading or writing the tensor
+        self.ops = []
+
+
+# tensors of the model with the lifetimes AllocationInfoBuilder gives them
+# fused: (convolution, add) operator pairs the compiled executor runs as one kernel, the Add output
+# is written during the convolution and must not share memory with the convolution input
+def read_tensors(fb, fused=()):
+    model = fb.root()
+    subgraphs = fb.table_vector(model, 2)
+    if len(subgraphs) != 1:
+        raise ValueError("only models with one subgraph are supported")
+    subgraph = subgraphs[0]
+    buffers = fb.table_vector(model, MODEL_BUFFERS)
+
+    tensors = []
+    for index, tensor in enumerate(fb.table_vector(subgraph, SUBGRAPH_TENSORS)):
+        tensor_type = fb.scalar(tensor, TENSOR_TYPE, "<b")
+        if tensor_type not in TYPE_SIZE:
+            raise ValueError(f"tensor {index}: type {tensor_type} cannot be planned")
+        size = TYPE_SIZE[tensor_type]
+        for dim in fb.int_vector(tensor, TENSOR_SHAPE):
+            size *= dim
+        # weights point to the flatbuffer and variables are allocated persistent
+        buffer = fb.scalar(tensor, TENSOR_BUFFER, "<I")
+        has_data = fb.vector_len(fb.ref(buffers[buffer], BUFFER_DATA)) > 0
+        is_variable = fb.scalar(tensor, TENSOR_IS_VARIABLE, "<B") != 0
+        name = fb.string(tensor, TENSOR_NAME).decode(errors="replace")
+        tensors.append(Tensor(index, name, size, not has_data and not is_variable and size != 0))
+
+    # one allocation scope for the subgraph inputs and one for every operator
+    scope = 0
+    for index in fb.int_vector(subgraph, SUBGRAPH_INPUTS):
+        tensors[index].first = scope
+        tensors[index].last = scope
+    for op, operator in enumerate(fb.table_vector(subgraph, SUBGRAPH_OPERATORS)):
+        scope += 1
+        outputs = fb.int_vector(operator, OPERATOR_OUTPUTS)
+        for index in outputs:
+            if tensors[index].first < 0:
+                tensors[index].first = scope
+        for index in fb.int_vector(operator, OPERATOR_INPUTS) + outputs:
+            if index >= 0:
+                tensors[index].last = scope
+                tensors[index].ops.append(op)
+    # outputs live to the end of the invocation
+    for index in fb.int_vector(subgraph, SUBGRAPH_OUTPUTS):
+        if tensors[index].first < 0:
+            tensors[index].first = scope
+        tensors[index].last = scope
+    operators = fb.table_vector(subgraph, SUBGRAPH_OPERATORS)
+    for conv, add in fused:
+        for index in fb.int_vector(operators[add], OPERATOR_OUTPUTS):
+            tensors[index].first = min(tensors[index].first, conv + 1)
+            tensors[index].ops.insert(0, conv)
+    return [t for t in tensors if t.planned and t.first >= 0], tensors
+
+
+def overlaps(a, b):
+    return a.first <= b.last and b.first <= a.last
+
+
+# lowest offset from base where the tensor does not overlap a placed one alive at the same time
+def first_fit(tensor, placed, offset_of, base=0):
+    size = align_up(tensor.size)
+    busy = sorted((offset_of(p), offset_of(p) + align_up(p.size)) for p in placed if overlaps(p, tensor))
+    offset = base
+    for start, end in busy:
+        if offset + size <= start:
+            break
+        offset = max(offset, end)
+    return offset
+
+
+# lowest offset of every buffer in the given order, like the first fit of GreedyMemoryPlanner
+def place(order):
+    placed = []
+    peak = 0
+    for tensor in order:
+        tensor.offset = first_fit(tensor, placed, lambda p: p.offset)
+        placed.append(tensor)
+        peak = max(peak, tensor.offset + align_up(tensor.size))
+    return peak
+
+
+# mean cycles of every operator from profiling exports of the device
+def operator_cycles(paths):
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    import profile_report
+
+    cycles = {}
+    for path in paths:
+        for _rate, records in profile_report.read_exports(path):
+            for kind, _tag, ix, value in records:
+                if kind == profile_report.KIND_OP:
+                    cycles.setdefault(ix, []).append(value)
+    return {ix: sum(v) / len(v) for ix, v in cycles.items()}
+
+
+# hottest tensors per byte into the fast arena, the first reserve bytes are left to the scratch
+# buffers, which MicroAllocator places at run time
+def place_fast(tensors, cycles, size, reserve):
+    heat = lambda t: sum(cycles.get(op, 1.0) for op in t.ops) / t.size
+    placed = []
+    for tensor in sorted(tensors, key=heat, reverse=True):
+        offset = first_fit(tensor, placed, lambda p: p.fast_offset, reserve)
+        if offset + align_up(tensor.size) <= size:
+            tensor.fast_offset = offset
+            placed.append(tensor)
+    return placed
+
+
+# no placement can use less than the activations alive in one scope
+def lower_bound(tensors):
+    scopes = range(max(t.last for t in tensors) + 1)
+    return max(sum(align_up(t.size) for t in tensors if t.first <= s <= t.last) for s in scopes)
+
+
+def plan(tensors):
+    orderings = {
+        # the online GreedyMemoryPlanner order
+        "size": sorted(tensors, key=lambda t: -t.size),
+        "area": sorted(tensors, key=lambda t: -t.size * (t.last - t.first + 1)),
+        "lifetime": sorted(tensors, key=lambda t: (-(t.last - t.first), -t.size)),
+        "creation": sorted(tensors, key=lambda t: (t.first, -t.size)),
+    }
+    rng = random.Random(0)
+    for i in range(RANDOM_ORDERINGS):
+        order = list(tensors)
+        rng.shuffle(order)
+        orderings[f"random {i}"] = order
+
+    greedy = place(orderings["size"])
+    bound = lower_bound(tensors)
+    best_name, best_peak, best_offsets = None, None, None
+    for name, order in orderings.items():
+        peak = place(order)
+        if best_peak is None or peak < best_peak:
+            best_name, best_peak = name, peak
+            best_offsets = {t.index: t.offset for t in tensors}
+        if best_peak == bound:
+            break
+    for tensor in tensors:
+        tensor.offset = best_offsets[tensor.index]
+    return greedy, best_peak, bound, best_name
+
+
+# metadata buffer: version, subgraph, tensor count and one offset per tensor
+def metadata_buffer(all_tensors, offset_of):
+    offsets = [offset_of(t) if t.planned and t.first >= 0 else ONLINE_PLANNED for t in all_tensors]
+    return struct.pack(f"<III{len(offsets)}i", 1, 0, len(offsets), *offsets)
+
+
+# data of an existing metadata buffer, None when the model has none
+def find_metadata(fb, name):
+    model = fb.root()
+    buffers = fb.table_vector(model, MODEL_BUFFERS)
+    for metadata in fb.table_vector(model, MODEL_METADATA):
+        if fb.string(metadata, METADATA_NAME_FIELD) == name:
+            return fb.ref(buffers[fb.scalar(metadata, METADATA_BUFFER, "<I")], BUFFER_DATA)
+    return None
+
+
+# objects of the new Model table, referenced by labels or by positions in the old buffer
+class Prefix:
+    def __init__(self):
+        # root offset and file identifier
+        self.data = bytearray(8)
+        self.labels = {}
+        # (position of an uoffset, target), resolved once the prefix size is known
+        self.refs = []
+
+    def pad(self, alignment):
+        self.data += bytes(align_up(len(self.data), alignment) - len(self.data))
+
+    def ref(self, target):
+        self.refs.append((len(self.data), target))
+        self.data += bytes(4)
+
+    # fields are None, ("value", uint32) or ("ref", target), the vtable goes first
+    def table(self, label, fields):
+        self.pad(4)
+        vtable = len(self.data)
+        present = [f for f in fields if f is not None]
+        self.data += struct.pack("<HH", 4 + 2 * len(fields), 4 + 4 * len(present))
+        slot = 4
+        for field in fields:
+            self.data += struct.pack("<H", slot if field is not None else 0)
+            slot += 4 if field is not None else 0
+        self.pad(4)
+        self.labels[label] = len(self.data)
+        self.data += struct.pack("<i", len(self.data) - vtable)
+        for kind, value in present:
+            if kind == "ref":
+                self.ref(value)
+            else:
+                self.data += struct.pack("<I", value)
+
+    def vector(self, label, targets):
+        self.pad(4)
+        self.labels[label] = len(self.data)
+        self.data += struct.pack("<I", len(targets))
+        for target in targets:
+            self.ref(target)
+
+    # the payload is aligned, TFLite Micro reads it as uint32_t in place
+    def bytes_vector(self, label, payload, alignment=4, terminator=b""):
+        while (len(self.data) + 4) % alignment:
+            self.data += b"\0"
+        self.labels[label] = len(self.data)
+        self.data += struct.pack("<I", len(payload)) + payload + terminator
+
+    # prefix followed by the old buffer, which keeps its alignment
+    def link(self, old):
+        self.pad(ALIGNMENT)
+        shift = len(self.data)
+        out = self.data + old
+        for pos, target in self.refs:
+            absolute = target + shift if isinstance(target, int) else self.labels[target]
+            struct.pack_into("<I", out, pos, absolute - pos)
+        struct.pack_into("<I", out, 0, self.labels["model"])
+        out[4:8] = old[4:8]
+        return bytes(out)
+
+
+# new model with the metadata: a fresh Model table is put in front of the unchanged old buffer,
+# flatbuffer offsets only point forward, so the old tables still reference each other
+def add_metadata(fb, entries):
+    model = fb.root()
+    old_buffers = fb.table_vector(model, MODEL_BUFFERS)
+    old_metadata = fb.table_vector(model, MODEL_METADATA)
+
+    prefix = Prefix()
+    fields = []
+    for index in range(max(MODEL_FIELDS, fb.field_count(model))):
+        pos = fb.field(model, index)
+        if index == MODEL_BUFFERS:
+            fields.append(("ref", "buffers"))
+        elif index == MODEL_METADATA:
+            fields.append(("ref", "metadata"))
+        elif pos is None:
+            fields.append(None)
+        elif index == 0:
+            # version is the only scalar field of Model
+            fields.append(("value", fb.u32(pos)))
+        else:
+            fields.append(("ref", fb.indirect(pos)))
+    prefix.table("model", fields)
+    prefix.vector("buffers", old_buffers + [("buffer", name) for name, _ in entries])
+    prefix.vector("metadata", old_metadata + [("metadata", name) for name, _ in entries])
+    for i, (name, payload) in enumerate(entries):
+        prefix.table(("metadata", name), [("ref", ("name", name)), ("value", len(old_buffers) + i)])
+        prefix.bytes_vector(("name", name), name, terminator=b"\0")
+        prefix.table(("buffer", name), [("ref", ("data", name))])
+        prefix.bytes_vector(("data", name), payload, ALIGNMENT)
+    return prefix.link(fb.data)
+
+
+ARRAY_RE = re.compile(r"(const unsigned char (\w+)\[\] = \{\n)(.*?)(\n\};\n)", re.S)
+
+
+# model bytes from the C array of the Edge Impulse export or from a .tflite file
+def read_model(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if not path.endswith((".h", ".cpp")):
+        return data, None
+    text = data.decode()
+    match = ARRAY_RE.search(text)
+    if match is None:
+        raise ValueError(f"{path}: no model array")
+    return bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})", match.group(3))), text
+
+
+def write_model(path, model, text):
+    if text is None:
+        with open(path, "wb") as f:
+            f.write(model)
+        return
+    match = ARRAY_RE.search(text)
+    lines = []
+    for i in range(0, len(model), 12):
+        lines.append("  " + ", ".join(f"0x{b:02x}" for b in model[i:i + 12]))
+    text = text[:match.start(3)] + ",\n".join(lines) + text[match.end(3):]
+    name = match.group(2)
+    text = re.sub(rf"(unsigned int {name}_len = )\d+;", rf"\g<1>{len(model)};", text)
+    with open(path, "w") as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Offline memory plan of the model activations")
+    parser.add_argument("model", nargs="?", default=DEFAULT_HEADER,
+                        help="model header of the Edge Impulse export or a .tflite file")
+    parser.add_argument("-o", "--output", help="write the planned model here")
+    parser.add_argument("--write", action="store_true", help="update the model file in place")
+    parser.add_argument("--fast-arena", type=int, default=0,
+                        help="bytes of the internal SRAM arena (EI_CLASSIFIER_TFLITE_FAST_ARENA_SIZE)")
+    parser.add_argument("--scratch-reserve", type=int, default=16384,
+                        help="bytes of the fast arena kept for kernel scratch buffers")
+    parser.add_argument("--profile", nargs="+", default=[],
+                        help=".prf files or console logs with operator cycles")
+    args = parser.parse_args()
+
+    model, text = read_model(args.model)
+    fb = FlatBuffer(bytearray(model))
+    # the residual Adds tools/aot_compile.py fuses into their convolutions, the plan stays valid
+    # for the interpreter, which only sees longer lifetimes
+    sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+    import aot_compile
+    tensors, all_tensors = read_tensors(fb, aot_compile.residual_fusions(fb))
+    fast = []
+    if args.fast_arena > 0:
+        fast = place_fast(tensors, operator_cycles(args.profile), args.fast_arena,
+                          align_up(args.scratch_reserve))
+    # tensors in the fast arena are skipped by the main plan
+    greedy, peak, bound, name = plan([t for t in tensors if t.fast_offset == ONLINE_PLANNED])
+
+    print(f"{'tensor':>6} {'bytes':>8} {'scopes':>9} {'arena':>6} {'offset':>8}  name")
+    for tensor in sorted(tensors, key=lambda t: t.first):
+        in_fast = tensor.fast_offset != ONLINE_PLANNED
+        print(f"{tensor.index:>6} {tensor.size:>8} {tensor.first:>4}-{tensor.last:<4} "
+              f"{'fast' if in_fast else 'main':>6} "
+              f"{tensor.fast_offset if in_fast else tensor.offset:>8}  {tensor.name}")
+    print()
+    print(f"GreedyMemoryPlanner {greedy} B, offline plan {peak} B ({name} order), "
+          f"lower bound {bound} B")
+    if args.fast_arena > 0:
+        used = max((t.fast_offset + align_up(t.size) for t in fast), default=0)
+        print(f"fast arena: {len(fast)} tensors, {used} of {args.fast_arena} B "
+              f"({align_up(args.scratch_reserve)} B kept for scratch buffers), "
+              f"{'profiled' if args.profile else 'unprofiled'} operator weights")
+
+    output = args.model if args.write else args.output
+    if output is None:
+        return 0
+    entries = [(METADATA_NAME, metadata_buffer(all_tensors, lambda t: t.offset))]
+    if args.fast_arena > 0 or find_metadata(fb, FAST_METADATA_NAME) is not None:
+        entries.append((FAST_METADATA_NAME, metadata_buffer(all_tensors, lambda t: t.fast_offset)))
+    missing = []
+    for name, payload in entries:
+        existing = find_metadata(fb, name)
+        if existing is None:
+            missing.append((name, payload))
+            continue
+        # planned before, the tensor count matches so the offsets are replaced in place
+        if fb.u32(existing) != len(payload):
+            raise ValueError(f"existing {name.decode()} metadata has a different size")
+        fb.data[existing + 4:existing + 4 + len(payload)] = payload
+    model = add_metadata(fb, missing) if missing else bytes(fb.data)
+    write_model(output, model, text if output.endswith((".h", ".cpp")) else None)
+    print(f"{output}: {len(model)} B")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+#author: Stepan Vondracek (xvondr27)
+# Graph rewrites of the model that TFLite Micro and tools/aot_compile.py both profit from
+#
+# Pad fusion: a Pad of the height and width followed by a Conv2D or DepthwiseConv2D with VALID
+# padding is the same as the convolution with SAME padding on the unpadded input, when SAME pads
+# the top and left by the same amount. What SAME leaves out at the bottom and right is read as
+# padding by the kernels (ESP-NN and the reference ones), which is the zero point, the value
+# Pad writes. The convolution then reads the Pad input and the Pad is dropped from the graph, so
+# the padded copy of the activation is neither written nor kept in the arena.
+#
+# The flatbuffer is patched in place: padding of the convolution options, its input index and
+# the operator vector. The Pad output stays in the tensor list without readers or writers.
+# The memory plan is no longer valid afterwards, its offsets are reset to online planning,
+# run tools/memory_plan.py again (and tools/aot_compile.py after it).
+#
+# usage: python3 tools/optimize_model.py            # print what would be fused
+#        python3 tools/optimize_model.py --write    # rewrite tflite-model/tflite_learn_27.h
+#        python3 tools/optimize_model.py model.tflite -o optimized.tflite
+import argparse
+import struct
+import sys
+
+import memory_plan
+from aot_compile import (MODEL_SUBGRAPHS, OPERATOR_OPCODE, OPERATOR_OPTIONS, OP_CONV_2D, OP_DEPTHWISE_CONV_2D,
+                         OP_NAMES, OP_PAD, PADDING_SAME, PADDING_VALID, ModelTensor, compute_padding,
+                         operator_codes)
+from memory_plan import ONLINE_PLANNED, FlatBuffer
+
+# TensorType of int64 paddings
+TYPE_INT64 = 4
+# padding is the first field of Conv2DOptions and of DepthwiseConv2DOptions
+OPTIONS_PADDING, OPTIONS_STRIDE_W, OPTIONS_STRIDE_H = 0, 1, 2
+
+
+# reason the Pad can not be fused into the convolution, None when it can
+def check_fusion(fb, pad, conv, tensors, codes, readers, graph_outputs):
+    inputs = fb.int_vector(pad, memory_plan.OPERATOR_INPUTS)
+    padded = fb.int_vector(pad, memory_plan.OPERATOR_OUTPUTS)[0]
+    if len(inputs) != 2 or not tensors[inputs[1]].data:
+        return "paddings are not constant or the pad value is given"
+    if padded in graph_outputs or len(readers[padded]) != 1:
+        return "the padded tensor has other readers"
+    source, target = tensors[inputs[0]], tensors[padded]
+    if (source.scales, source.zero_points) != (target.scales, target.zero_points):
+        return "the Pad requantizes"
+    if len(source.shape) != 4:
+        return "the input is not NHWC"
+    paddings = tensors[inputs[1]]
+    pads = paddings.values("q" if paddings.type == TYPE_INT64 else "i")
+    if pads[0] or pads[1] or pads[6] or pads[7]:
+        return "batch or channels are padded"
+    if codes[fb.scalar(conv, OPERATOR_OPCODE, "<I")] not in (OP_CONV_2D, OP_DEPTHWISE_CONV_2D):
+        return "not followed by a convolution"
+    if fb.int_vector(conv, memory_plan.OPERATOR_INPUTS)[0] != padded:
+        return "the padded tensor is not the convolution input"
+    options = fb.ref(conv, OPERATOR_OPTIONS)
+    if fb.scalar(options, OPTIONS_PADDING, "<b") != PADDING_VALID:
+        return "the convolution does not use VALID padding"
+
+    filter_shape = tensors[fb.int_vector(conv, memory_plan.OPERATOR_INPUTS)[1]].shape
+    output_shape = tensors[fb.int_vector(conv, memory_plan.OPERATOR_OUTPUTS)[0]].shape
+    strides = (fb.scalar(options, OPTIONS_STRIDE_H, "<i"), fb.scalar(options, OPTIONS_STRIDE_W, "<i"))
+    # Conv2D filter is [out, h, w, in], DepthwiseConv2D [1, h, w, out], dilation is 1 in both
+    for axis, (stride, before) in enumerate(zip(strides, (pads[2], pads[4]))):
+        out_size, pad_before = compute_padding(PADDING_SAME, stride, source.shape[1 + axis], filter_shape[1 + axis])
+        if out_size != output_shape[1 + axis] or pad_before != before:
+            return "SAME padding does not pad like the Pad"
+    return None
+
+
+# positions of the uoffsets in the operator vector are relative, every moved entry is rewritten
+def remove_operator(fb, subgraph, index):
+    vector = fb.ref(subgraph, memory_plan.SUBGRAPH_OPERATORS)
+    count = fb.u32(vector)
+    for i in range(index, count - 1):
+        pos = vector + 4 + 4 * i
+        target = fb.indirect(pos + 4)
+        struct.pack_into("<I", fb.data, pos, target - pos)
+    struct.pack_into("<I", fb.data, vector, count - 1)
+
+
+def fuse_pads(fb):
+    model = fb.root()
+    subgraph = fb.table_vector(model, MODEL_SUBGRAPHS)[0]
+    buffers = fb.table_vector(model, memory_plan.MODEL_BUFFERS)
+    tensors = [ModelTensor(fb, i, table, buffers)
+               for i, table in enumerate(fb.table_vector(subgraph, memory_plan.SUBGRAPH_TENSORS))]
+    codes = operator_codes(fb)
+    graph_outputs = set(fb.int_vector(subgraph, memory_plan.SUBGRAPH_OUTPUTS))
+
+    operators = fb.table_vector(subgraph, memory_plan.SUBGRAPH_OPERATORS)
+    readers = {t.index: [] for t in tensors}
+    for index, op in enumerate(operators):
+        for tensor in fb.int_vector(op, memory_plan.OPERATOR_INPUTS):
+            if tensor >= 0:
+                readers[tensor].append(index)
+
+    fused = []
+    for index, pad in enumerate(operators):
+        if codes[fb.scalar(pad, OPERATOR_OPCODE, "<I")] != OP_PAD:
+            continue
+        padded = fb.int_vector(pad, memory_plan.OPERATOR_OUTPUTS)[0]
+        conv_index = readers[padded][0] if readers[padded] else None
+        reason = "the padded tensor is not read" if conv_index is None else \
+            check_fusion(fb, pad, operators[conv_index], tensors, codes, readers, graph_outputs)
+        conv_name = OP_NAMES.get(codes[fb.scalar(operators[conv_index], OPERATOR_OPCODE, "<I")], "?") \
+            if conv_index is not None else "-"
+        if reason is not None:
+            print(f"operator {index} PAD: kept, {reason}")
+            continue
+
+        conv = operators[conv_index]
+        source = fb.int_vector(pad, memory_plan.OPERATOR_INPUTS)[0]
+        struct.pack_into("<i", fb.data, fb.ref(conv, memory_plan.OPERATOR_INPUTS) + 4, source)
+        options = fb.ref(conv, OPERATOR_OPTIONS)
+        struct.pack_into("<b", fb.data, fb.field(options, OPTIONS_PADDING), PADDING_SAME)
+        fused.append(index)
+        print(f"operator {index} PAD: fused into operator {conv_index} {conv_name}, "
+              f"which reads tensor {source} with SAME padding, tensor {padded} "
+              f"({tensors[padded].name}) is no longer used")
+
+    # from the back, so the indexes of the Pads still to remove do not move
+    for index in reversed(fused):
+        remove_operator(fb, subgraph, index)
+    return fused
+
+
+# the plan of the old graph may overlap tensors whose lifetimes changed, leave it to the planner
+def reset_memory_plan(fb):
+    for name in (memory_plan.METADATA_NAME, memory_plan.FAST_METADATA_NAME):
+        data = memory_plan.find_metadata(fb, name)
+        if data is None:
+            continue
+        count = fb.u32(data + 12)
+        struct.pack_into(f"<{count}i", fb.data, data + 16, *([ONLINE_PLANNED] * count))
+        print(f"{name.decode()} metadata reset, run tools/memory_plan.py again")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Graph rewrites of the model")
+    parser.add_argument("model", nargs="?", default=memory_plan.DEFAULT_HEADER,
+                        help="model header of the Edge Impulse export or a .tflite file")
+    parser.add_argument("-o", "--output", help="write the optimized model here")
+    parser.add_argument("--write", action="store_true", help="update the model file in place")
+    args = parser.parse_args()
+
+    model, text = memory_plan.read_model(args.model)
+    fb = FlatBuffer(bytearray(model))
+    fused = fuse_pads(fb)
+    print(f"{len(fused)} Pad operators fused")
+
+    output = args.model if args.write else args.output
+    if output is None or not fused:
+        return 0
+    reset_memory_plan(fb)
+    memory_plan.write_model(output, bytes(fb.data), text if output.endswith((".h", ".cpp")) else None)
+    print(f"{output}: {len(fb.data)} B")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
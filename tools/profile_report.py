@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+#author: Stepan Vondracek (xvondr27)
+# Aggregate profiling records of the photo trap (see edge-impulse-sdk/classifier/ei_profiling.h)
+# Input is any number of <counter>.prf files from the SD card or console logs with the
+# hex dump between EI_PROFILING_BEGIN and EI_PROFILING_END (ProfilingUart in menuconfig)
+#
+# usage: python3 tools/profile_report.py /sdcard/*.prf monitor.log
+import argparse
+import binascii
+import struct
+import sys
+
+MAGIC = 0x52504945
+HEADER = struct.Struct("<IHHIIIHH")
+RECORD = struct.Struct("<BBHII")
+
+KIND_OP = 1
+KIND_STAGE = 2
+KIND_MEMORY = 3
+KIND_TIER = 4
+
+
+# split one export into (cycles per second, [(kind, tag, id, value)])
+def parse_export(data, name):
+    if len(data) < HEADER.size:
+        raise ValueError(f"{name}: too short")
+    magic, version, record_size, cycles_per_second, record_count, dropped, tag_count, tag_size = \
+        HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != 1 or record_size != RECORD.size:
+        raise ValueError(f"{name}: not a profiling export (version 1)")
+    if dropped:
+        print(f"warning: {name}: {dropped} records were overwritten, increase "
+              "EI_CLASSIFIER_PROFILING_RING_SIZE", file=sys.stderr)
+
+    offset = HEADER.size
+    tags = []
+    for _ in range(tag_count):
+        tags.append(data[offset:offset + tag_size].split(b"\0")[0].decode(errors="replace"))
+        offset += tag_size
+
+    records = []
+    for _ in range(record_count):
+        if offset + RECORD.size > len(data):
+            raise ValueError(f"{name}: truncated")
+        kind, tag, ix, value, _time_us = RECORD.unpack_from(data, offset)
+        offset += RECORD.size
+        records.append((kind, tags[tag] if tag < len(tags) else "?", ix, value))
+    return cycles_per_second, records
+
+
+# exports in one file, a console log can hold one per wake-up
+def read_exports(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] == struct.pack("<I", MAGIC):
+        return [parse_export(data, path)]
+
+    exports = []
+    hex_lines = None
+    for line in data.decode(errors="replace").splitlines():
+        line = line.strip()
+        if line.endswith("EI_PROFILING_BEGIN"):
+            hex_lines = []
+        elif line.endswith("EI_PROFILING_END") and hex_lines is not None:
+            exports.append(parse_export(binascii.unhexlify("".join(hex_lines)), path))
+            hex_lines = None
+        elif hex_lines is not None:
+            hex_lines.append(line)
+    return exports
+
+
+class Stat:
+    def __init__(self):
+        self.values = []
+
+    def add(self, value):
+        self.values.append(value)
+
+    def row(self, scale=1.0):
+        v = self.values
+        return (len(v), sum(v) / len(v) * scale, min(v) * scale, max(v) * scale)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Aggregate photo trap profiling records")
+    parser.add_argument("files", nargs="+", help=".prf files or console logs")
+    args = parser.parse_args()
+
+    ops = {}
+    # (op, tag) -> {tier: Stat}, tier of an op is "sram" when its tensors were in the fast arena
+    tiers = {}
+    stages = {}
+    memory = {}
+    cycles_per_second = None
+    wake_ups = 0
+    for path in args.files:
+        for rate, records in read_exports(path):
+            wake_ups += 1
+            if cycles_per_second not in (None, rate):
+                print(f"warning: {path}: counter rate differs ({rate} Hz)", file=sys.stderr)
+            cycles_per_second = rate
+            # wake-ups without fast arena records ran everything from the main arena (PSRAM)
+            fast_bytes = {ix: value for kind, _tag, ix, value in records if kind == KIND_TIER}
+            for kind, tag, ix, value in records:
+                if kind == KIND_OP:
+                    ops.setdefault((ix, tag), Stat()).add(value)
+                    tier = "sram" if fast_bytes.get(ix, 0) > 0 else "psram"
+                    tiers.setdefault((ix, tag), {}).setdefault(tier, Stat()).add(value)
+                elif kind == KIND_STAGE:
+                    stages.setdefault(tag, Stat()).add(value)
+                elif kind == KIND_MEMORY:
+                    memory.setdefault(tag, Stat()).add(value)
+
+    if wake_ups == 0:
+        print("no profiling records found", file=sys.stderr)
+        return 1
+    print(f"{wake_ups} wake-ups, counter {cycles_per_second} Hz")
+
+    if ops:
+        us_per_cycle = 1e6 / cycles_per_second
+        total = sum(sum(s.values) for s in ops.values())
+        print()
+        print(f"{'op':>3} {'tag':<20} {'count':>6} {'mean cyc':>12} {'min cyc':>12} {'max cyc':>12} "
+              f"{'mean us':>10} {'share':>6}")
+        for (ix, tag), stat in sorted(ops.items()):
+            count, mean, low, high = stat.row()
+            print(f"{ix:>3} {tag:<20} {count:>6} {mean:>12.0f} {low:>12.0f} {high:>12.0f} "
+                  f"{mean * us_per_cycle:>10.1f} {sum(stat.values) / total:>6.1%}")
+
+        # the same operator with its tensors in PSRAM and in internal SRAM, from wake-ups
+        # with and without the fast arena
+        if any(len(by_tier) > 1 or "sram" in by_tier for by_tier in tiers.values()):
+            print()
+            print(f"{'op':>3} {'tag':<20} {'psram us':>10} {'sram us':>10} {'speedup':>8}")
+            for (ix, tag), by_tier in sorted(tiers.items()):
+                means = {t: stat.row(us_per_cycle)[1] for t, stat in by_tier.items()}
+                psram, sram = means.get("psram"), means.get("sram")
+                column = lambda mean: f"{mean:>10.1f}" if mean is not None else f"{'-':>10}"
+                speedup = f"{psram / sram:>7.2f}x" if psram and sram else f"{'-':>8}"
+                print(f"{ix:>3} {tag:<20} {column(psram)} {column(sram)} {speedup}")
+
+        # operators of the same type together, e.g. all CONV_2D
+        by_tag = {}
+        for (ix, tag), stat in ops.items():
+            by_tag[tag] = by_tag.get(tag, 0) + sum(stat.values)
+        print()
+        for tag, cycles in sorted(by_tag.items(), key=lambda t: -t[1]):
+            print(f"{tag:<20} {cycles / total:>6.1%}")
+
+    if stages:
+        print()
+        print(f"{'stage':<20} {'count':>6} {'mean ms':>10} {'min ms':>10} {'max ms':>10}")
+        for tag, stat in sorted(stages.items()):
+            count, mean, low, high = stat.row(1e-3)
+            print(f"{tag:<20} {count:>6} {mean:>10.2f} {low:>10.2f} {high:>10.2f}")
+
+    if memory:
+        print()
+        print(f"{'memory':<20} {'count':>6} {'mean B':>10} {'max B':>10}")
+        for tag, stat in sorted(memory.items()):
+            count, mean, _low, high = stat.row()
+            print(f"{tag:<20} {count:>6} {mean:>10.0f} {high:>10.0f}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())